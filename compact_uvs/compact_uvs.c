@@ -0,0 +1,306 @@
+/*
+ * this dreamcast demo showcases
+ * - textured models with the pvr's 16-bit uv vertex format
+ * - pre-baked vertex streams from obj2h --pvr
+ * - a twiddled texture generated at startup
+ *
+ * with 16-bit uvs u and v share one word as the top halves of two
+ * floats, so the uvs take half the memory and the cpu only has one word
+ * to copy per vertex. the Makefile generates monkey.h from monkey.obj
+ * with
+ *
+ * ```sh
+ * obj2h --cache --strips --pvr --prelight 0.3,-0.8,0.5 --uv16 64 \
+ *     monkey.obj > monkey.h
+ * ```
+ *
+ * which checks that the rounding stays under half a texel on the 64x64
+ * texture. the three ways of drawing it can be switched between:
+ * - faces with float uvs, copied vertex by vertex
+ * - strips with the packed uvs from monkey_uvs16
+ * - the pre-baked stream, already packed and prelit, transformed in
+ *   place and sent to the ta in one go
+ *
+ * # controls
+ * - d-pad (arrow keys in the emulator) to rotate the model
+ * - a (z in the emulator) to zoom in
+ * - b (x in the emulator) to zoom out
+ * - x (a in the emulator) to switch how the model is drawn
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#include <kos.h>
+
+KOS_INIT_FLAGS(INIT_DEFAULT);
+
+/* assets -------------------------------------------------------------- */
+
+#include "monkey.h"
+#include "obj2h_pvr.h"
+
+/* --------------------------------------------------------------------- */
+
+#define ARRAY_LENGTH(a) (sizeof(a) / sizeof((a)[0]))
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#define CLAMP(x, a, b) MAX(a, MIN(x, b))
+
+static
+void angle_sub(float* angle, float amt)
+{
+    *angle -= amt;
+    while (*angle < 0) *angle += F_PI*2;
+}
+
+static
+void angle_add(float* angle, float amt)
+{
+    *angle += amt;
+    while (*angle > F_PI*2) *angle -= F_PI*2;
+}
+
+/* --------------------------------------------------------------------- */
+
+#define TEXTURE_SIZE 64
+#define CHECKER_SIZE 8
+
+enum { DRAW_FACES, DRAW_STRIPS_UV16, DRAW_STREAM, NDRAW_MODES };
+
+static pvr_poly_hdr_t poly;      /* 32-bit uvs */
+static pvr_poly_hdr_t poly_uv16; /* 16-bit uvs */
+
+static uint16 texels[TEXTURE_SIZE * TEXTURE_SIZE];
+
+static vector_t t[ARRAY_LENGTH(monkey_vertices)];
+static obj2h_pvr_vertex_uv16_t stream[ARRAY_LENGTH(monkey_pvr.vertices) + 1]
+__attribute__((aligned(32)));
+
+/* same light obj2h baked into the stream */
+static vector_t light_dir = { 0.3f, -0.8f, 0.5f, 0 };
+static float ambient = .01f;
+
+static int mode = DRAW_STREAM;
+static vector_t model_rot = { 0, 0, 0, 1 };
+static float distance = 3;
+
+/* texel x, y of a square twiddled texture, y in the low bit */
+static
+size_t twiddle(size_t x, size_t y)
+{
+    size_t t = 0;
+    int bit;
+
+    for (bit = 0; 1 << bit < TEXTURE_SIZE; ++bit)
+    {
+        t |= ((y >> bit) & 1) << (bit * 2);
+        t |= ((x >> bit) & 1) << (bit * 2 + 1);
+    }
+
+    return t;
+}
+
+static
+void init()
+{
+    pvr_poly_cxt_t cxt;
+    pvr_ptr_t tex;
+    size_t x, y;
+    float len;
+
+    for (y = 0; y < TEXTURE_SIZE; ++y)
+    {
+        for (x = 0; x < TEXTURE_SIZE; ++x)
+        {
+            int odd = (x / CHECKER_SIZE + y / CHECKER_SIZE) & 1;
+            texels[twiddle(x, y)] = odd ? 0xFFFF : 0xF800;
+        }
+    }
+
+    tex = pvr_mem_malloc(sizeof(texels));
+    pvr_txr_load(texels, tex, sizeof(texels));
+
+    pvr_poly_cxt_txr(&cxt, PVR_LIST_OP_POLY, PVR_TXRFMT_RGB565 |
+        PVR_TXRFMT_TWIDDLED, TEXTURE_SIZE, TEXTURE_SIZE, tex,
+        PVR_FILTER_BILINEAR);
+    pvr_poly_compile(&poly, &cxt);
+
+    /* the only difference is what the ta expects in the uv word */
+    cxt.fmt.uv = PVR_UVFMT_16BIT;
+    pvr_poly_compile(&poly_uv16, &cxt);
+    pvr_poly_compile(&monkey_pvr.hdr, &cxt);
+
+    vec3f_length(light_dir.x, light_dir.y, light_dir.z, len);
+    light_dir.x /= len;
+    light_dir.y /= len;
+    light_dir.z /= len;
+}
+
+#define SENS (F_PI/60.0f)
+#define MOVSPEED (4.0f/60.0f)
+
+static
+void update()
+{
+    static uint32 prev_buttons = 0;
+    maple_device_t* joy;
+    cont_state_t* st;
+
+    joy = maple_enum_type(0, MAPLE_FUNC_CONTROLLER);
+    if (!joy) return;
+
+    st = (cont_state_t*)maple_dev_status(joy);
+    if (!st) return;
+
+    if ((st->buttons & CONT_X) && !(prev_buttons & CONT_X)) {
+        mode = (mode + 1) % NDRAW_MODES;
+    }
+
+    prev_buttons = st->buttons;
+
+    if (st->buttons & CONT_DPAD_UP   ) angle_sub(&model_rot.x, SENS);
+    if (st->buttons & CONT_DPAD_DOWN ) angle_add(&model_rot.x, SENS);
+    if (st->buttons & CONT_DPAD_RIGHT) angle_sub(&model_rot.y, SENS);
+    if (st->buttons & CONT_DPAD_LEFT ) angle_add(&model_rot.y, SENS);
+
+    if (st->buttons & CONT_A) distance -= MOVSPEED;
+    if (st->buttons & CONT_B) distance += MOVSPEED;
+    distance = CLAMP(distance, 1.5f, 20);
+}
+
+/* directional light, like --prelight bakes it */
+static
+uint32 light_argb(int normal_index)
+{
+    vector_t const* n = &monkey_normals[normal_index];
+    float light;
+
+    vec3f_dot(light_dir.x, light_dir.y, light_dir.z, n->x, n->y, n->z,
+        light);
+    light = CLAMP(light, 0, 1);
+    light = ambient + light * (1 - ambient);
+
+    return 0xFF000000 | 0x00010101 * (uint32)(light * 255);
+}
+
+/* the classic way, every corner of every face with float uvs */
+static
+void draw_faces()
+{
+    size_t i, j;
+    pvr_vertex_t pv;
+
+    pvr_prim(&poly, sizeof(poly));
+    pv.oargb = 0;
+
+    for (i = 0; i < ARRAY_LENGTH(monkey_faces); ++i)
+    {
+        face_t const* f = &monkey_faces[i];
+
+        for (j = 0; j < 3; ++j)
+        {
+            vector_t const* v = &t[f->vertex_indices[2-j]];
+            uv_t const* uv = &monkey_uvs[f->uv_indices[2-j]];
+
+            pv.x = v->x;
+            pv.y = v->y;
+            pv.z = v->z;
+            pv.u = uv->u;
+            pv.v = uv->v;
+            pv.argb = light_argb(f->normal_indices[2-j]);
+            pv.flags = j == 2 ? PVR_CMD_VERTEX_EOL : PVR_CMD_VERTEX;
+            pvr_prim(&pv, sizeof(pv));
+        }
+    }
+}
+
+/* strips, and one word per uv straight from monkey_uvs16 */
+static
+void draw_strips_uv16()
+{
+    size_t i;
+    obj2h_pvr_vertex_uv16_t pv;
+
+    pvr_prim(&poly_uv16, sizeof(poly_uv16));
+    pv.pad = 0;
+    pv.oargb = 0;
+
+    for (i = 0; i < ARRAY_LENGTH(monkey_strips); ++i)
+    {
+        corner_t const* c = &monkey_strips[i];
+        vector_t const* v;
+
+        if (c->vertex_index < 0) continue;
+
+        v = &t[c->vertex_index];
+        pv.x = v->x;
+        pv.y = v->y;
+        pv.z = v->z;
+        pv.uv = monkey_uvs16[c->uv_index];
+        pv.argb = light_argb(c->normal_index);
+        pv.flags = c[1].vertex_index < 0 ? PVR_CMD_VERTEX_EOL :
+            PVR_CMD_VERTEX;
+        pvr_prim(&pv, sizeof(pv));
+    }
+}
+
+static
+void draw()
+{
+    mat_identity();
+    mat_perspective(320, 240, 1, 1, 100);
+    mat_translate(0, 0, -distance);
+    mat_rotate(model_rot.x, model_rot.y, model_rot.z);
+
+    if (mode == DRAW_STREAM)
+    {
+        obj2h_pvr_transform(&monkey_pvr, stream,
+            ARRAY_LENGTH(monkey_pvr.vertices));
+    }
+
+    else
+    {
+        mat_transform(monkey_vertices, t, ARRAY_LENGTH(t),
+            sizeof(vector_t));
+    }
+
+    pvr_wait_ready();
+    pvr_scene_begin();
+    pvr_list_begin(PVR_LIST_OP_POLY);
+
+    switch (mode)
+    {
+    case DRAW_FACES:
+        draw_faces();
+        break;
+
+    case DRAW_STRIPS_UV16:
+        draw_strips_uv16();
+        break;
+
+    default:
+        obj2h_pvr_submit(stream, ARRAY_LENGTH(monkey_pvr.vertices));
+        break;
+    }
+
+    pvr_list_finish();
+    pvr_scene_finish();
+}
+
+int main()
+{
+    pvr_init_defaults();
+    init();
+
+    while (1)
+    {
+        update();
+        draw();
+    }
+
+    return 0;
+}
@@ -2,17 +2,139 @@
  * very rough tool that converts a .obj model into hardcoded C arrays
  *
  * ```sh
- * gcc obj2h.c -o obj2h
+ * gcc obj2h.c -o obj2h -lm -pthread
  * obj2h model.obj > model.h
  * ```
  *
+ * options:
+ * - --morton: sort vertices and triangles along a z-order curve for
+ *   spatial locality (tighter clusters, better tile binning and cache
+ *   behaviour when walking the arrays)
+ * - --blob: write a versioned, relocatable binary blob instead of a
+ *   header. it can be loaded at runtime with no parsing and no copies
+ *   using obj2h_blob.h
+ * - --zblob: write a compressed blob (quantized, delta coded and lz
+ *   compressed) that obj2h_zblob.h can decode while streaming from disc.
+ *   blobs only hold the plain arrays, so --strips, --pvr, --icodec,
+ *   --morph, --draw and --stats are refused with either
+ * - --bench: with --zblob, report compression ratio and host decode
+ *   speed to stderr
+ * - --cache: reorder faces for a fifo vertex cache (tipsify), which is
+ *   what the index codec works best with
+ * - --strips: also emit triangle strips as model_strips, an array of
+ *   corner_t where vertex_index -1 ends a strip
+ * - --pvr: also emit model_pvr, a poly header slot followed by ready to
+ *   submit pvr_vertex_t's in model space with flags already set. uses
+ *   strips if --strips is given. see obj2h_pvr.h
+ * - --prelight x,y,z: bake a directional light into the --pvr vertex
+ *   colors, otherwise they are white. models with their own vertex
+ *   colors use those instead
+ * - --draw: also emit model_draw(t), a function that submits the strips
+ *   (or faces) unrolled, with the flags, uvs and colors of every vertex
+ *   baked in as constants the same way --pvr does. t is model_vertices
+ *   transformed, the poly header is up to the caller
+ * - --bvh: also emit model_bvh, a bounding volume hierarchy over the
+ *   faces built with the surface area heuristic, with 32-byte nodes
+ *   holding both children's bounds quantized to 16 bits. see
+ *   obj2h_bvh.h for ray picking and sphere collision against it
+ * - --collision n: also emit model_collision_vertices, _faces and
+ *   _planes, a copy of the mesh collapsed down to n faces for gameplay
+ *   queries. see obj2h_collision.h
+ * - --hull n: also emit model_hull, the convex hull of the model as
+ *   planes and vertices, with at most n vertices (0 for the exact hull).
+ *   a capped hull has its planes pushed out to keep every vertex inside
+ * - --edges: also emit model_edges, every edge once with the faces on
+ *   either side of it, and model_planes, the plane of every face with
+ *   its normal pointing out of the model, for finding silhouettes and
+ *   building shadow volumes at runtime. see obj2h_shadow.h
+ * - --prt n: also emit model_prt, 9 spherical harmonic coefficients per
+ *   vertex with the cosine term and the model's shadows on itself baked
+ *   in from n rays per vertex, so lighting it against any number of
+ *   lights or a whole sky is a 9-term dot product per vertex and
+ *   channel. see obj2h_prt.h
+ * - --uv16 n: also emit model_uvs16, the uvs packed in the pvr's 16-bit
+ *   uv format (one word per uv instead of two floats), and use the
+ *   compact textured vertex for --pvr streams. n is the texture size in
+ *   texels, the worst rounding error on it is reported to stderr
+ * - --icodec: emit faces and strips compressed with a dedicated index
+ *   codec (model_faces_encoded, model_strips_encoded) that
+ *   obj2h_icodec.h decodes straight into model_faces and model_strips
+ * - --morph: every model given is a frame of a vertex animation with the
+ *   same topology. the first one is emitted as usual and the others as
+ *   quantized position and normal deltas against it in model_morph,
+ *   skipping whatever doesn't move. trailing frame numbers are dropped
+ *   from the array name. see obj2h_morph.h
+ * - --chunks size: cut the model into a grid of size sided cells for
+ *   streaming. every cell with faces becomes a blob with its own arrays
+ *   in model.chunks, written to the current directory, and the header
+ *   only gets the table of chunks with their bounds and where they are
+ *   in the file. see obj2h_chunks.h
+ * - --incbin: write model.bin and model.S to the current directory and
+ *   only declare the arrays in the header. the .S pulls the blob in with
+ *   .incbin and defines the same model_vertices, model_normals,
+ *   model_uvs and model_faces symbols (plus model_blob), so the compiler
+ *   never has to chew through the initializers
+ * - --stats: print a json report instead of the header, with memory use
+ *   per stream and format, fifo cache acmr/atvr, strips, bounds,
+ *   degenerate and duplicate faces and what goes to the pvr per frame.
+ *   it reflects the other options given (--cache, --morton, ...)
+ * - --weld: weld positions within --epsilon, and normals and uvs that
+ *   are practically equal, then drop degenerate and duplicate faces and
+ *   anything left unreferenced. reports what was saved to stderr
+ * - --epsilon e: weld positions closer than e on each axis (the default
+ *   of 0 only welds exact matches), for --weld and .ply/.stl input
+ * - --pool name: append every model given to one shared set of arrays
+ *   (name_vertices, ...) with rebased indices, plus name_ranges telling
+ *   which slice of each array belongs to which model and name_pool
+ *   wrapping it all. see obj2h_pool.h
+ * - --impostor n[xm]: render the model from n directions around it (on
+ *   m rings going up from the horizon) with a software rasterizer into
+ *   model_impostor_color, an ARGB1555 atlas, plus each view's direction
+ *   and uv rect, for drawing far away instances as a single quad. see
+ *   obj2h_impostor.h
+ * - --impostor-size n: texels per view, a power of two (default 64)
+ * - --impostor-normals: also bake model space normals into an RGB565
+ *   atlas, model_impostor_normal
+ * - --progressive: simplify the model with error quadric edge collapses
+ *   and reorder it so every level of detail is a prefix of the arrays,
+ *   plus model_pm with the vertex splits that refine it one vertex at a
+ *   time. see obj2h_pm.h
+ * - --threads n: how many threads the heavy passes (reading .obj text,
+ *   exact welds, sorts, bounds, impostor views, --prt rays, the first
+ *   round of --progressive and --collision, printing the header arrays)
+ *   run on, 0 (the default) for one per core. work is cut the same way
+ *   whatever the number, so the output is byte for byte the same on any
+ *   of them
+ *
+ * obj vertices written as `v x y z r g b [a]`, which is how most tools
+ * export colors baked offline, keep them: they're emitted as
+ * model_colors, ARGB8888 words ready for pvr_vertex_t.argb, go into
+ * blobs, chunks and --pvr streams, and follow the vertices through
+ * every reordering. vertices without one are white
+ *
+ * .glb (binary gltf 2) files are read too. the first node with a mesh
+ * is imported, and if it's skinned its skeleton, per-vertex joints and
+ * weights and animation clips are emitted as model_skin,
+ * model_skeleton and model_clips for obj2h_skin.h
+ *
+ * binary .ply and .stl files are read from a memory mapping and their
+ * positions welded with a spatial hash, so unindexed stl triangles come
+ * out properly indexed
+ *
  * arrays will be named according to the obj filename:
  * model_vertices, model_normals, model_uvs, model_faces
  *
  * any unspecified index is -1
  *
+ * model_vertices have y flipped (y is down) for every input format,
+ * model_normals keep the y the file had
+ *
  * the vector_t type is assumed to exist (already defined if using kos)
  *
+ * built with -DOBJ2H_NO_MAIN this is a library instead, converting
+ * models from memory with any number of conversions going at once. see
+ * obj2h.h
+ *
  * # license
  * this is free and unencumbered software released into the
  * public domain.
@@ -21,9 +143,11 @@
  */
 
 #define WHOAMI "obj2h"
-#define VERSION_MAJOR 1
-#define VERSION_MINOR 0
-#define VERSION_PATCH 0
+
+/* the numbers are in obj2h.h, which the library interface shares */
+#define VERSION_MAJOR OBJ2H_VERSION_MAJOR
+#define VERSION_MINOR OBJ2H_VERSION_MINOR
+#define VERSION_PATCH OBJ2H_VERSION_PATCH
 
 #define STRINGIFY_(x) #x
 #define STRINGIFY(x) STRINGIFY_(x)
@@ -35,9 +159,18 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdarg.h>
 #include <string.h>
+#include <strings.h>
+#include <errno.h>
 #include <ctype.h>
-#include <libgen.h>
+#include <time.h>
+#include <math.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 static
 void* push_back(size_t tsize, void** pp, size_t* n, size_t* cap)
@@ -60,6 +193,41 @@ void* push_back(size_t tsize, void** pp, size_t* n, size_t* cap)
     return (char*)*pp + tsize * (*n)++;
 }
 
+/* grows *pp up front so it can hold n items */
+static
+int reserve(size_t tsize, void** pp, size_t n, size_t* cap)
+{
+    if (n <= *cap) return 0;
+
+    *pp = realloc(*pp, n * tsize);
+    if (!*pp) {
+        perror("realloc");
+        return 1;
+    }
+
+    *cap = n;
+
+    return 0;
+}
+
+/* appends count items, growing like push_back */
+static
+int push_many(size_t tsize, void** pp, size_t* n, size_t* cap,
+    void const* items, size_t count)
+{
+    size_t want = *cap ? *cap : 512;
+
+    if (!count) return 0;
+
+    while (want < *n + count) want *= 2;
+    if (reserve(tsize, pp, want, cap)) return 1;
+
+    memcpy((char*)*pp + tsize * *n, items, tsize * count);
+    *n += count;
+
+    return 0;
+}
+
 /*
  * skip until the first space or tab and move right after it
  * 123123meme asd -> 123123meme asd
@@ -75,250 +243,11430 @@ char const* skip_after_space(char const* s)
 
 /* --------------------------------------------------------------------- */
 
-struct face { int vertex_indices[3], uv_indices[3], normal_indices[3]; };
-typedef struct face face_t;
+#include "obj2h.h"
 
-struct vec3 { float x, y, z; };
-typedef struct vec3 vec3_t;
+typedef obj2h_face_t face_t;
+typedef obj2h_vec3_t vec3_t;
+typedef obj2h_uv_t uv_t;
+
+/*
+ * the runtime headers are shared with the tool so formats can't drift.
+ * this has the same layout as kos' vector_t
+ */
+struct vector { float x, y, z, w; };
+typedef struct vector vector_t;
 
-struct uv { float u, v; };
-typedef struct uv uv_t;
+#define OBJ2H_TYPES
+#include "obj2h_blob.h"
+#include "obj2h_zblob.h"
+#include "obj2h_morph.h"
+#include "obj2h_skin.h"
+#include "obj2h_pool.h"
+#include "obj2h_pm.h"
+#include "obj2h_impostor.h"
+#include "obj2h_shadow.h"
+#include "obj2h_bvh.h"
+#include "obj2h_collision.h"
+#include "obj2h_chunks.h"
+#include "obj2h_prt.h"
 
-static size_t nvertices = 0;
-static size_t vertices_cap = 0;
-static vec3_t* vertices = 0;
+/* growable byte buffer used to build binary outputs in memory */
+struct buf { unsigned char* data; size_t size, cap; };
+typedef struct buf buf_t;
 
 static
-int parse_vertex(char const* line)
+int buf_put(buf_t* b, void const* p, size_t size)
 {
-    vec3_t* v;
+    if (b->size + size > b->cap)
+    {
+        size_t cap = b->cap ? b->cap : 4096;
+        unsigned char* data;
 
-    v = push_back(sizeof(vec3_t), (void**)&vertices, &nvertices,
-        &vertices_cap);
-    if (!v) return 1;
+        while (cap < b->size + size) cap *= 2;
 
-    line = skip_after_space(line);
-    v->x = atof(line);
-    line = skip_after_space(line);
-    v->y = -atof(line);
-    line = skip_after_space(line);
-    v->z = atof(line);
+        data = realloc(b->data, cap);
+        if (!data) {
+            perror("realloc");
+            return 1;
+        }
+
+        b->data = data;
+        b->cap = cap;
+    }
+
+    if (p) {
+        memcpy(b->data + b->size, p, size);
+    } else {
+        memset(b->data + b->size, 0, size);
+    }
+
+    b->size += size;
 
     return 0;
 }
 
-static size_t nnormals = 0;
-static size_t normals_cap = 0;
-static vec3_t* normals = 0;
+struct bvh_box { float min[3], max[3]; };
+typedef struct bvh_box bvh_box_t;
+
+#define GLTF_MAX_JOINTS 256
+
+/* conversion state ---------------------------------------------------- */
+
+/*
+ * everything a conversion touches, so conversions don't share anything
+ * and can run on as many threads as there are contexts. options stay
+ * across obj2h_reset, the rest is the model being converted and what
+ * the passes build out of it
+ */
+struct obj2h
+{
+    obj2h_callbacks_t callbacks;
+
+    int opt_morton;
+    int opt_blob;
+    int opt_zblob;
+    int opt_bench;
+    int opt_strips;
+    int opt_icodec;
+    int opt_cache;
+    int opt_pvr;
+    int opt_draw;
+    int opt_prelight;
+    int opt_incbin;
+    int opt_morph;
+    float weld_epsilon;
+    int opt_weld;
+    char* opt_pool;
+    int opt_progressive;
+    int opt_stats;
+    int opt_uv16;
+    int opt_edges;
+    int opt_bvh;
+    int opt_impostor_views;
+    int opt_impostor_rings;
+    int opt_impostor_cell;
+    int opt_impostor_normals;
+    int opt_collision;
+    int opt_hull; /* vertex cap, 0 for none */
+    int opt_hull_given;
+    float opt_chunks; /* cell size */
+    int opt_threads; /* 0 for one per core */
+    int opt_prt; /* rays per vertex */
+    vec3_t prelight;
+
+    char name[256]; /* of the arrays */
+    size_t nmodels;
+    buf_t out;
+    int failed; /* writing the output did */
+    size_t nthreads; /* opt_threads resolved, 0 until needed */
+
+    size_t nvertices, vertices_cap;
+    vec3_t* vertices;
+
+    /* ARGB8888 per vertex, empty unless the model had colors */
+    size_t nvertex_colors, vertex_colors_cap;
+    unsigned long* vertex_colors;
+
+    size_t nnormals, normals_cap;
+    vec3_t* normals;
+
+    size_t nuvs, uvs_cap;
+    uv_t* uvs;
+
+    size_t nfaces, faces_cap;
+    face_t* faces;
+
+    size_t nmorph_frames, morph_frames_cap;
+    struct morph_frame* morph_frames;
+
+    /* gltf */
+    size_t njson, json_cap;
+    struct json* json;
+    unsigned char const* glb_bin;
+    size_t glb_bin_size;
+
+    size_t nskin, skin_cap;
+    struct skin_vertex* skin;
+    size_t njoints;
+    struct joint* joints; /* GLTF_MAX_JOINTS of them */
+    float skeleton_root[16];
+
+    size_t nanim_channels, anim_channels_cap;
+    struct anim_channel* anim_channels;
+    size_t nanim_clips, anim_clips_cap;
+    struct anim_clip* anim_clips;
+    size_t nanim_times, anim_times_cap;
+    float* anim_times;
+    size_t nanim_values, anim_values_cap;
+    float* anim_values;
+
+    size_t nstrip_corners;
+    struct corner* strip_corners;
+    size_t nstrips;
+
+    /* progressive meshes */
+    struct pm_candidate* pm_heap;
+    size_t npm_heap, pm_heap_cap;
+    struct pm_list* pm_vertex_faces;
+    unsigned char* pm_face_alive;
+    int* pm_faces; /* vertex indices as collapses go */
+    double* pm_quadrics;
+    unsigned* pm_stamps;
+    size_t pm_nbase_vertices;
+    size_t pm_nbase_faces;
+    struct pm_collapse* pm_collapses;
+    size_t npm_collapses, pm_collapses_cap;
+    size_t* pm_corners;
+    size_t npm_corners, pm_corners_cap;
+    size_t* pm_split_nfaces;
+    int* pm_appear; /* vertex indices of faces as they come back */
+    size_t* pm_removed_by; /* collapse that killed each face */
+    size_t* pm_removed; /* faces in the order they were killed */
+    size_t npm_removed;
+    unsigned char* pm_alive; /* vertices */
+    size_t npm_alive, npm_alive_faces;
+    size_t* pm_mark; /* neighbours already requeued by a collapse */
 
+    unsigned short* impostor_color;
+    unsigned short* impostor_normal;
+    vec3_t* impostor_dirs;
+    size_t impostor_width, impostor_height, impostor_cols;
+    vec3_t impostor_center;
+    float impostor_radius;
+
+    struct bvh_build* bvh_build;
+    size_t nbvh_build, bvh_build_cap;
+    bvh_box_t* bvh_face_boxes;
+    uint32_t* bvh_indices;
+    obj2h_bvh_node_t* bvh_nodes;
+    size_t nbvh_nodes;
+    bvh_box_t bvh_bounds;
+    size_t bvh_depth, bvh_leaves;
+    struct bvh_key* bvh_keys; /* scratch for sorting runs of faces */
+    float bvh_scale[3];
+
+    float* prt; /* 9 transfer coefficients per vertex */
+
+    vector_t* collision_vertices;
+    size_t ncollision_vertices;
+    face_t* collision_faces;
+    size_t ncollision_faces;
+
+    struct hull_face* hull_faces;
+    size_t nhull_faces, hull_faces_cap;
+    int* hull_next; /* outside sets as linked lists of points */
+    vector_t* hull_planes;
+    size_t nhull_planes;
+    vector_t* hull_vertices;
+    size_t nhull_vertices;
+
+    obj2h_edge_t* adj_edges;
+    size_t nadj_edges;
+
+    float uv16_offset[2];
+
+    struct pool_range* pool_ranges;
+    size_t npool_ranges, pool_ranges_cap;
+    vec3_t* pool_vertices;
+    size_t npool_vertices, pool_vertices_cap;
+    vec3_t* pool_normals;
+    size_t npool_normals, pool_normals_cap;
+    uv_t* pool_uvs;
+    size_t npool_uvs, pool_uvs_cap;
+    face_t* pool_faces;
+    size_t npool_faces, pool_faces_cap;
+    unsigned long* pool_colors;
+    size_t npool_colors, pool_colors_cap;
+};
+
+/* output -------------------------------------------------------------- */
+
+#define OUTPUT_FLUSH 65536
+
+/* hands what was written so far to the write callback, if there's one */
 static
-int parse_normal(char const* line)
+int flush_output(obj2h_t* o)
 {
-    vec3_t* n;
+    if (o->failed || !o->callbacks.write || !o->out.size) {
+        return o->failed;
+    }
 
-    n = push_back(sizeof(vec3_t), (void**)&normals, &nnormals,
-        &normals_cap);
-    if (!n) return 1;
+    if (o->callbacks.write(o->callbacks.user, o->out.data, o->out.size)) {
+        o->failed = 1;
+    }
 
-    line = skip_after_space(line);
-    n->x = atof(line);
-    line = skip_after_space(line);
-    n->y = atof(line);
-    line = skip_after_space(line);
-    n->z = atof(line);
+    o->out.size = 0;
 
-    return 0;
+    return o->failed;
 }
 
-static size_t nuvs = 0;
-static size_t uvs_cap = 0;
-static uv_t* uvs = 0;
+/*
+ * what the tool writes to stdout goes through these. a failure sticks
+ * and fails the conversion at the end, like a full disk would
+ */
+static
+void owrite(obj2h_t* o, void const* data, size_t size)
+{
+    if (o->failed) return;
+
+    if (buf_put(&o->out, data, size)) {
+        o->failed = 1;
+    } else if (o->out.size >= OUTPUT_FLUSH) {
+        flush_output(o);
+    }
+}
 
 static
-int parse_uv(char const* line)
+int oprintf(obj2h_t* o, char const* fmt, ...)
 {
-    uv_t* uv;
+    char line[256];
+    va_list ap;
+    int n;
 
-    uv = push_back(sizeof(vec3_t), (void**)&uvs, &nuvs, &uvs_cap);
-    if (!uv) return 1;
+    va_start(ap, fmt);
+    n = vsnprintf(line, sizeof(line), fmt, ap);
+    va_end(ap);
 
-    line = skip_after_space(line);
-    uv->u = atof(line);
-    line = skip_after_space(line);
-    uv->v = atof(line);
+    if (n < 0)
+    {
+        o->failed = 1;
+        return n;
+    }
 
-    return 0;
+    if ((size_t)n < sizeof(line))
+    {
+        owrite(o, line, n);
+        return n;
+    }
+
+    /* too long for the line, straight into the output instead */
+    if (o->failed || buf_put(&o->out, 0, n + 1))
+    {
+        o->failed = 1;
+        return -1;
+    }
+
+    va_start(ap, fmt);
+    vsnprintf((char*)o->out.data + o->out.size - n - 1, n + 1, fmt, ap);
+    va_end(ap);
+
+    --o->out.size;
+    if (o->out.size >= OUTPUT_FLUSH) flush_output(o);
+
+    return n;
+}
+
+static
+int oputs(obj2h_t* o, char const* s)
+{
+    owrite(o, s, strlen(s));
+    owrite(o, "\n", 1);
+    return o->failed ? EOF : 0;
+}
+
+static
+int oputc(obj2h_t* o, int c)
+{
+    char ch = (char)c;
+    owrite(o, &ch, 1);
+    return o->failed ? EOF : c;
 }
 
-static size_t faces_cap = 0;
-static size_t nfaces = 0;
-static face_t* faces = 0;
+/* the worker threads can fail at the same time */
+static pthread_mutex_t message_lock = PTHREAD_MUTEX_INITIALIZER;
 
-/* f vertex_indices/texcoord_indices/normal_indices */
+/* what the tool prints to stderr */
 static
-int parse_face(char const* line)
+void eprintf(obj2h_t* o, char const* fmt, ...)
 {
-    face_t* f;
-    size_t i;
+    char text[1024];
+    va_list ap;
 
-    f = push_back(sizeof(face_t), (void**)&faces, &nfaces, &faces_cap);
-    if (!f) return 1;
+    va_start(ap, fmt);
 
-    for (i = 0; i < 3; ++i)
+    if (o->callbacks.message)
     {
-        line = skip_after_space(line);
-        f->vertex_indices[i] = atoi(line) - 1;
+        vsnprintf(text, sizeof(text), fmt, ap);
+        pthread_mutex_lock(&message_lock);
+        o->callbacks.message(o->callbacks.user, text);
+        pthread_mutex_unlock(&message_lock);
+    }
 
-        line += strcspn(line, "/");
+    else {
+        vfprintf(stderr, fmt, ap);
+    }
 
-        if (*line == '/' && isdigit(line[1])) {
-            f->uv_indices[i] = atoi(line + 1) - 1;
-        } else {
-            f->uv_indices[i] = -1;
-        }
+    va_end(ap);
+}
 
-        ++line;
-        line += strcspn(line, "/");
+/* perror through eprintf, so embedders see allocation failures too */
+static
+void eperror(obj2h_t* o, char const* what)
+{
+    eprintf(o, "%s: %s\n", what, strerror(errno));
+}
 
-        if (*line == '/' && isdigit(line[1])) {
-            f->normal_indices[i] = atoi(line + 1) - 1;
-        } else {
-            f->normal_indices[i] = -1;
+/* threads ------------------------------------------------------------- */
+
+/*
+ * the heavy passes cut their work into chunks of a fixed number of
+ * items that the threads take in turn. chunks only depend on the size
+ * of the work, never on how many threads there are, every chunk writes
+ * its own part of the result and whatever has to be put together is put
+ * together in chunk order afterwards, so the output is the same byte
+ * for byte on one thread or on 32
+ */
+
+/* items per chunk of the passes that go item by item */
+#define PARALLEL_GRAIN 16384
+
+typedef int (*parallel_fn_t)(void* ctx, size_t first, size_t last);
+
+struct parallel
+{
+    parallel_fn_t fn;
+    void* ctx;
+    size_t n, grain;
+    size_t next; /* first item of the next chunk to take */
+    int err;
+    pthread_mutex_t lock;
+};
+
+typedef struct parallel parallel_t;
+
+static
+size_t thread_count(obj2h_t* o)
+{
+    long n;
+
+    if (o->nthreads) return o->nthreads;
+
+    n = o->opt_threads > 0 ? o->opt_threads :
+        sysconf(_SC_NPROCESSORS_ONLN);
+    o->nthreads = n > 0 ? (size_t)n : 1;
+
+    return o->nthreads;
+}
+
+static
+void* parallel_worker(void* arg)
+{
+    parallel_t* p = arg;
+
+    for (;;)
+    {
+        size_t first, last;
+        int err;
+
+        pthread_mutex_lock(&p->lock);
+        first = p->next;
+        err = p->err;
+        if (first < p->n) p->next += p->grain;
+        pthread_mutex_unlock(&p->lock);
+
+        if (err || first >= p->n) break;
+
+        last = p->n - first > p->grain ? first + p->grain : p->n;
+
+        if (p->fn(p->ctx, first, last))
+        {
+            pthread_mutex_lock(&p->lock);
+            p->err = 1;
+            pthread_mutex_unlock(&p->lock);
         }
     }
 
     return 0;
 }
 
-int main(int argc, char* argv[])
+/*
+ * calls fn on [first, last) for every chunk of grain items of [0, n),
+ * on as many threads as there are chunks to go around. non-zero if fn
+ * failed on any of them
+ */
+static
+int parallel_for(obj2h_t* o, size_t n, size_t grain, parallel_fn_t fn,
+    void* ctx)
 {
-    FILE* f;
-    char* line = 0;
-    size_t n = 0;
-    char* array_name;
+    size_t nthreads = thread_count(o);
+    size_t nchunks = (n + grain - 1) / grain;
+    pthread_t* threads;
+    parallel_t p;
+    size_t i, started = 0;
 
-    if (argc != 2)
+    if (nthreads > nchunks) nthreads = nchunks;
+
+    if (nthreads <= 1)
     {
-        fprintf(stderr, VERSION_STR "\n");
-        fprintf(stderr, "converts a .obj model into c arrays\n\n");
-        fprintf(stderr, "usage: %s model.obj > model.h\n", argv[0]);
-        return 1;
+        for (i = 0; i < n; i += grain) {
+            if (fn(ctx, i, n - i > grain ? i + grain : n)) return 1;
+        }
+
+        return 0;
     }
 
-    f = fopen(argv[1], "r");
-    if (!f) {
-        perror("fopen");
-        return 1;
+    /* without room for the handles this thread does it all */
+    threads = malloc(sizeof(pthread_t) * nthreads);
+    if (!threads) nthreads = 1;
+
+    p.fn = fn;
+    p.ctx = ctx;
+    p.n = n;
+    p.grain = grain;
+    p.next = 0;
+    p.err = 0;
+    pthread_mutex_init(&p.lock, 0);
+
+    /* this thread is one of them, and copes alone if none can start */
+    while (started < nthreads - 1 &&
+        !pthread_create(&threads[started], 0, parallel_worker, &p))
+    {
+        ++started;
+    }
+
+    parallel_worker(&p);
+
+    for (i = 0; i < started; ++i) {
+        pthread_join(threads[i], 0);
     }
 
-    while (getline(&line, &n, f) != -1)
+    pthread_mutex_destroy(&p.lock);
+    free(threads);
+
+    return p.err;
+}
+
+#define SORT_GRAIN 65536
+
+struct sort_job
+{
+    unsigned char* from;
+    unsigned char* to;
+    size_t size, width;
+    int (*cmp)(void const*, void const*);
+};
+
+typedef struct sort_job sort_job_t;
+
+static
+int sort_run(void* ctx, size_t first, size_t last)
+{
+    sort_job_t* j = ctx;
+
+    qsort(j->from + first * j->size, last - first, j->size, j->cmp);
+
+    return 0;
+}
+
+/* merges the two runs of width items in [first, last) */
+static
+int sort_merge(void* ctx, size_t first, size_t last)
+{
+    sort_job_t* j = ctx;
+    size_t mid = last - first > j->width ? first + j->width : last;
+    unsigned char const* a = j->from + first * j->size;
+    unsigned char const* a_end = j->from + mid * j->size;
+    unsigned char const* b = a_end;
+    unsigned char const* b_end = j->from + last * j->size;
+    unsigned char* out = j->to + first * j->size;
+
+    while (a < a_end && b < b_end)
     {
-        if (isalpha(line[1]))
+        if (j->cmp(b, a) < 0)
         {
-            if (!strncmp(line, "vn", 2) && parse_normal(line)) return 1;
-            if (!strncmp(line, "vt", 2) && parse_uv(line)    ) return 1;
-            continue;
+            memcpy(out, b, j->size);
+            b += j->size;
         }
 
-        switch (*line)
+        else
         {
-        case 'v': if (parse_vertex(line)) return 1; break;
-        case 'f': if (parse_face(line)  ) return 1; break;
+            memcpy(out, a, j->size);
+            a += j->size;
         }
+
+        out += j->size;
+    }
+
+    memcpy(out, a, (size_t)(a_end - a));
+    memcpy(out + (a_end - a), b, (size_t)(b_end - b));
+
+    return 0;
+}
+
+/*
+ * qsort, with runs sorted and then merged pairwise on every thread. cmp
+ * has to be a total order (only identical items compare equal) for the
+ * result not to depend on how the work was cut
+ */
+static
+int parallel_sort(obj2h_t* o, void* base, size_t n, size_t size,
+    int (*cmp)(void const*, void const*))
+{
+    sort_job_t j;
+    unsigned char* tmp;
+
+    if (n <= SORT_GRAIN || thread_count(o) <= 1)
+    {
+        qsort(base, n, size, cmp);
+        return 0;
     }
 
-    if (!feof(f)) {
-        perror("getline");
+    tmp = malloc(n * size);
+    if (!tmp) {
+        eperror(o, "malloc");
         return 1;
     }
 
-    /* use filename without extension as the base array name */
-    array_name = basename(argv[1]);
+    j.from = base;
+    j.to = tmp;
+    j.size = size;
+    j.cmp = cmp;
 
-    for (n = 0; n < strlen(array_name); ++n)
-    {
-        char* p = &array_name[n];
+    parallel_for(o, n, SORT_GRAIN, sort_run, &j);
 
-        switch (*p)
-        {
-        case '.':
-            *p = 0;
-            goto print_output;
+    for (j.width = SORT_GRAIN; j.width < n; j.width *= 2)
+    {
+        unsigned char* t = j.from;
 
-        case ' ':
-        case '\t':
-        case '-':
-            *p = '_';
-            break;
-        }
+        parallel_for(o, n, j.width * 2, sort_merge, &j);
+        j.from = j.to;
+        j.to = t;
     }
 
-print_output:
-    fprintf(stderr, "%zd vertices\n%zd normals\n%zd uvs\n%zd faces\n",
-        nvertices, nnormals, nuvs, nfaces);
+    if (j.from != base) memcpy(base, j.from, n * size);
+    free(tmp);
 
-    puts("/* this file was generated by " VERSION_STR " */\n");
-    puts("#ifndef OBJ2H_TYPES");
-    puts("#define OBJ2H_TYPES");
-    printf("struct face { int vertex_indices[3], uv_indices[3], "
-        "normal_indices[3]; };\n");
-    puts("typedef struct face face_t;");
-    puts("struct uv { float u, v; };");
-    puts("typedef struct uv uv_t;");
-    puts("#endif /* !OBJ2H_TYPES */\n");
+    return 0;
+}
 
-    printf("static vector_t %s_vertices[]\n"
-        "__attribute__((aligned(32))) = {\n", array_name);
+/* model import -------------------------------------------------------- */
 
-    for (n = 0; n < nvertices; ++n)
+/* vertices without a color of their own are white */
+static
+int fill_vertex_colors(obj2h_t* o, size_t n)
+{
+    while (o->nvertex_colors < n)
     {
-        vec3_t* v = &vertices[n];
-        printf("    { %.17g, %.17g, %.17g, 1 },\n", v->x, v->y, v->z);
+        unsigned long* c = push_back(sizeof(unsigned long),
+            (void**)&o->vertex_colors, &o->nvertex_colors,
+            &o->vertex_colors_cap);
+
+        if (!c) return 1;
+        *c = 0xFFFFFFFF;
     }
 
-    puts("};\n");
+    return 0;
+}
 
-    printf("static vector_t %s_normals[]\n"
-        "__attribute__((aligned(32))) = {\n", array_name);
+/*
+ * hands every record of the model just read to the callbacks, which can
+ * change it in place or stop the conversion
+ */
+static
+int record_callbacks(obj2h_t* o, char const* path)
+{
+    obj2h_callbacks_t const* cb = &o->callbacks;
+    size_t i;
+    int stop = 0;
 
-    for (n = 0; n < nnormals; ++n)
+    for (i = 0; cb->vertex && !stop && i < o->nvertices; ++i)
     {
-        vec3_t* v = &normals[n];
-        printf("    { %.17g, %.17g, %.17g, 0 },\n", v->x, v->y, v->z);
+        unsigned long argb = i < o->nvertex_colors ? o->vertex_colors[i] : 0;
+
+        stop = cb->vertex(cb->user, &o->vertices[i], &argb);
+        if (i < o->nvertex_colors) o->vertex_colors[i] = argb;
     }
 
-    puts("};\n");
+    for (i = 0; cb->normal && !stop && i < o->nnormals; ++i) {
+        stop = cb->normal(cb->user, &o->normals[i]);
+    }
 
-    printf("static uv_t %s_uvs[]\n"
-        "__attribute__((aligned(32))) = {\n", array_name);
+    for (i = 0; cb->uv && !stop && i < o->nuvs; ++i) {
+        stop = cb->uv(cb->user, &o->uvs[i]);
+    }
 
-    for (n = 0; n < nuvs; ++n)
-    {
-        uv_t* uv = &uvs[n];
-        printf("    { %.17g, %.17g  },\n", uv->u, uv->v);
+    for (i = 0; cb->face && !stop && i < o->nfaces; ++i) {
+        stop = cb->face(cb->user, &o->faces[i]);
     }
 
-    puts("};\n");
+    if (stop) eprintf(o, "%s: stopped by a callback\n", path);
 
-    printf("static face_t %s_faces[]\n"
-        "__attribute__((aligned(32))) = {\n", array_name);
+    return stop != 0;
+}
 
-    for (n = 0; n < nfaces; ++n)
-    {
-        face_t* f = &faces[n];
-        int* pi;
+static
+unsigned long color_channel(double x)
+{
+    x = x < 0 ? 0 : x > 1 ? 1 : x;
+    return (unsigned long)(x * 255 + 0.5);
+}
 
-        printf("    { ");
-        pi = f->vertex_indices;
-        printf("{ %d, %d, %d }, ", pi[0], pi[1], pi[2]);
-        pi = f->uv_indices;
-        printf("{ %d, %d, %d }, ", pi[0], pi[1], pi[2]);
-        pi = f->normal_indices;
-        printf("{ %d, %d, %d } ", pi[0], pi[1], pi[2]);
-        printf("},\n");
-    }
+static
+int parse_vertex(obj2h_t* o, char const* line)
+{
+    vec3_t* v;
+    double c[4];
+    int n;
 
-    puts("};\n");
+    v = push_back(sizeof(vec3_t), (void**)&o->vertices, &o->nvertices,
+        &o->vertices_cap);
+    if (!v) return 1;
 
-    return 0;
+    line = skip_after_space(line);
+    v->x = atof(line);
+    line = skip_after_space(line);
+    v->y = -atof(line);
+    line = skip_after_space(line);
+    v->z = atof(line);
+
+    /* v x y z r g b [a] is the usual extension, a lone 4th value is w */
+    for (n = 0; n < 4; ++n)
+    {
+        char* end;
+
+        line = skip_after_space(line);
+        c[n] = strtod(line, &end);
+        if (end == line) break;
+    }
+
+    if (n >= 3)
+    {
+        if (fill_vertex_colors(o, o->nvertices - 1)) return 1;
+        if (fill_vertex_colors(o, o->nvertices)) return 1;
+
+        o->vertex_colors[o->nvertices - 1] =
+            color_channel(n == 4 ? c[3] : 1) << 24 |
+            color_channel(c[0]) << 16 | color_channel(c[1]) << 8 |
+            color_channel(c[2]);
+    }
+
+    return 0;
+}
+
+static
+int parse_normal(obj2h_t* o, char const* line)
+{
+    vec3_t* n;
+
+    n = push_back(sizeof(vec3_t), (void**)&o->normals, &o->nnormals,
+        &o->normals_cap);
+    if (!n) return 1;
+
+    line = skip_after_space(line);
+    n->x = atof(line);
+    line = skip_after_space(line);
+    n->y = atof(line);
+    line = skip_after_space(line);
+    n->z = atof(line);
+
+    return 0;
+}
+
+static
+int parse_uv(obj2h_t* o, char const* line)
+{
+    uv_t* uv;
+
+    uv = push_back(sizeof(uv_t), (void**)&o->uvs, &o->nuvs, &o->uvs_cap);
+    if (!uv) return 1;
+
+    line = skip_after_space(line);
+    uv->u = atof(line);
+    line = skip_after_space(line);
+    uv->v = atof(line);
+
+    return 0;
+}
+
+/* f vertex_indices/texcoord_indices/normal_indices */
+static
+int parse_face(obj2h_t* o, char const* line)
+{
+    face_t* f;
+    size_t i;
+
+    f = push_back(sizeof(face_t), (void**)&o->faces, &o->nfaces, &o->faces_cap);
+    if (!f) return 1;
+
+    for (i = 0; i < 3; ++i)
+    {
+        line = skip_after_space(line);
+        f->vertex_indices[i] = atoi(line) - 1;
+
+        /* v, v/vt, v//vn or v/vt/vn, without leaving the corner */
+        line += strcspn(line, "/ \t\r\n");
+
+        if (*line == '/' && isdigit(line[1])) {
+            f->uv_indices[i] = atoi(line + 1) - 1;
+        } else {
+            f->uv_indices[i] = -1;
+        }
+
+        if (*line == '/') ++line;
+        line += strcspn(line, "/ \t\r\n");
+
+        if (*line == '/' && isdigit(line[1])) {
+            f->normal_indices[i] = atoi(line + 1) - 1;
+        } else {
+            f->normal_indices[i] = -1;
+        }
+    }
+
+    return 0;
+}
+
+/* parses the lines in data into o's arrays */
+static
+int parse_obj_lines(obj2h_t* o, char const* data, size_t size)
+{
+    char const* end = data + size;
+    buf_t b = { 0, 0, 0 };
+    int err = 0;
+
+    while (data < end && !err)
+    {
+        char const* eol = memchr(data, '\n', (size_t)(end - data));
+        size_t len = eol ? (size_t)(eol - data) + 1 : (size_t)(end - data);
+        char const* line;
+
+        /* the record parsers want terminated lines */
+        b.size = 0;
+        if (buf_put(&b, data, len) || buf_put(&b, "", 1)) {
+            err = 1;
+            break;
+        }
+
+        line = (char const*)b.data;
+        data += len;
+
+        if (isalpha(line[1]))
+        {
+            if (!strncmp(line, "vn", 2)) err = parse_normal(o, line);
+            if (!strncmp(line, "vt", 2)) err = parse_uv(o, line);
+            continue;
+        }
+
+        switch (*line)
+        {
+        case 'v': err = parse_vertex(o, line); break;
+        case 'f': err = parse_face(o, line); break;
+        }
+    }
+
+    free(b.data);
+
+    /* colors only started at the first vertex that had one */
+    if (!err && o->nvertex_colors) err = fill_vertex_colors(o, o->nvertices);
+
+    return err;
+}
+
+/*
+ * big files are read in chunks of OBJ_CHUNK bytes, each on a thread and
+ * into an obj2h_t of its own, then appended in file order. a chunk
+ * starts on the line after its first byte, so no line is cut, and
+ * indices don't need rebasing since obj counts them from the start of
+ * the file
+ */
+#define OBJ_CHUNK (1 << 20)
+
+struct obj_job { char const* data; size_t size; obj2h_t* parts; };
+typedef struct obj_job obj_job_t;
+
+static
+char const* obj_chunk_start(obj_job_t const* j, size_t k)
+{
+    char const* eol;
+
+    if (!k) return j->data;
+    if (k * OBJ_CHUNK >= j->size) return j->data + j->size;
+
+    eol = memchr(j->data + k * OBJ_CHUNK - 1, '\n',
+        j->size - k * OBJ_CHUNK + 1);
+
+    return eol ? eol + 1 : j->data + j->size;
+}
+
+static
+int obj_chunk(void* ctx, size_t first, size_t last)
+{
+    obj_job_t* j = ctx;
+    size_t k = first / OBJ_CHUNK;
+    char const* start = obj_chunk_start(j, k);
+
+    (void)last;
+
+    return parse_obj_lines(&j->parts[k], start,
+        (size_t)(obj_chunk_start(j, k + 1) - start));
+}
+
+static
+int parse_obj(obj2h_t* o, char const* data, size_t size)
+{
+    size_t nparts = (size + OBJ_CHUNK - 1) / OBJ_CHUNK, i;
+    obj_job_t j;
+    int err;
+
+    if (nparts <= 1 || thread_count(o) <= 1) {
+        return parse_obj_lines(o, data, size);
+    }
+
+    j.data = data;
+    j.size = size;
+    j.parts = calloc(nparts, sizeof(obj2h_t));
+
+    if (!j.parts) {
+        eperror(o, "calloc");
+        return 1;
+    }
+
+    err = parallel_for(o, size, OBJ_CHUNK, obj_chunk, &j);
+
+    for (i = 0; i < nparts; ++i)
+    {
+        obj2h_t* p = &j.parts[i];
+
+        /* white up to the part, like a colored vertex does */
+        if (!err && p->nvertex_colors)
+        {
+            err = fill_vertex_colors(o, o->nvertices) ||
+                push_many(sizeof(unsigned long), (void**)&o->vertex_colors,
+                    &o->nvertex_colors, &o->vertex_colors_cap,
+                    p->vertex_colors, p->nvertex_colors);
+        }
+
+        err = err ||
+            push_many(sizeof(vec3_t), (void**)&o->vertices, &o->nvertices,
+                &o->vertices_cap, p->vertices, p->nvertices) ||
+            push_many(sizeof(vec3_t), (void**)&o->normals, &o->nnormals,
+                &o->normals_cap, p->normals, p->nnormals) ||
+            push_many(sizeof(uv_t), (void**)&o->uvs, &o->nuvs, &o->uvs_cap,
+                p->uvs, p->nuvs) ||
+            push_many(sizeof(face_t), (void**)&o->faces, &o->nfaces,
+                &o->faces_cap, p->faces, p->nfaces);
+
+        free(p->vertices);
+        free(p->vertex_colors);
+        free(p->normals);
+        free(p->uvs);
+        free(p->faces);
+    }
+
+    free(j.parts);
+
+    if (!err && o->nvertex_colors) err = fill_vertex_colors(o, o->nvertices);
+
+    return err;
+}
+
+/* morph target frames ------------------------------------------------- */
+
+/*
+ * positions and normals of every frame after the first one, which is the
+ * base mesh. passes that renumber vertices or normals must keep these in
+ * step through morph_permute
+ */
+struct morph_frame { vec3_t* vertices; vec3_t* normals; };
+typedef struct morph_frame morph_frame_t;
+
+/*
+ * parses another frame of the animation and checks that it has the same
+ * topology as the base mesh
+ */
+static
+int morph_load_frame(obj2h_t* o, char const* path, void const* data,
+    size_t size)
+{
+    vec3_t* base_vertices = o->vertices;
+    vec3_t* base_normals = o->normals;
+    uv_t* base_uvs = o->uvs;
+    face_t* base_faces = o->faces;
+    size_t base_nvertices = o->nvertices;
+    size_t base_vertices_cap = o->vertices_cap;
+    size_t base_nnormals = o->nnormals, base_normals_cap = o->normals_cap;
+    size_t base_nuvs = o->nuvs, base_uvs_cap = o->uvs_cap;
+    size_t base_nfaces = o->nfaces, base_faces_cap = o->faces_cap;
+    unsigned long* base_colors = o->vertex_colors;
+    size_t base_ncolors = o->nvertex_colors;
+    size_t base_colors_cap = o->vertex_colors_cap;
+    morph_frame_t* frame;
+    int err;
+
+    o->vertices = 0; o->nvertices = o->vertices_cap = 0;
+    o->vertex_colors = 0; o->nvertex_colors = o->vertex_colors_cap = 0;
+    o->normals = 0; o->nnormals = o->normals_cap = 0;
+    o->uvs = 0; o->nuvs = o->uvs_cap = 0;
+    o->faces = 0; o->nfaces = o->faces_cap = 0;
+
+    err = parse_obj(o, data, size) || record_callbacks(o, path);
+
+    if (!err && (o->nvertices != base_nvertices ||
+        o->nnormals != base_nnormals || o->nuvs != base_nuvs ||
+        o->nfaces != base_nfaces ||
+        (o->nfaces &&
+        memcmp(o->faces, base_faces, o->nfaces * sizeof(face_t)))))
+    {
+        eprintf(o, "%s: topology differs from the first frame\n", path);
+        err = 1;
+    }
+
+    frame = err ? 0 : push_back(sizeof(morph_frame_t),
+        (void**)&o->morph_frames, &o->nmorph_frames, &o->morph_frames_cap);
+
+    if (frame)
+    {
+        frame->vertices = o->vertices;
+        frame->normals = o->normals;
+    }
+
+    else
+    {
+        free(o->vertices);
+        free(o->normals);
+        err = 1;
+    }
+
+    free(o->uvs);
+    free(o->faces);
+    free(o->vertex_colors); /* colors come from the first frame only */
+
+    o->vertex_colors = base_colors; o->nvertex_colors = base_ncolors;
+    o->vertex_colors_cap = base_colors_cap;
+    o->vertices = base_vertices; o->nvertices = base_nvertices;
+    o->vertices_cap = base_vertices_cap;
+    o->normals = base_normals; o->nnormals = base_nnormals;
+    o->normals_cap = base_normals_cap;
+    o->uvs = base_uvs; o->nuvs = base_nuvs; o->uvs_cap = base_uvs_cap;
+    o->faces = base_faces; o->nfaces = base_nfaces;
+    o->faces_cap = base_faces_cap;
+
+    return err;
+}
+
+/*
+ * moves item i of every frame's vertices (kind 0) or normals (kind 2)
+ * to remap[i]. items merged by welding go to the same place, the first
+ * one wins
+ */
+static
+int morph_permute(obj2h_t* o, size_t kind, size_t const* remap, size_t n)
+{
+    vec3_t* sorted;
+    size_t i, j, m = 0;
+
+    if (!o->nmorph_frames || kind == 1) return 0;
+
+    sorted = malloc(sizeof(vec3_t) * (n + 1));
+    if (!sorted) {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    for (i = 0; i < o->nmorph_frames; ++i)
+    {
+        vec3_t* items = kind ? o->morph_frames[i].normals :
+            o->morph_frames[i].vertices;
+
+        for (j = n; j-- > 0;)
+        {
+            sorted[remap[j]] = items[j];
+            if (remap[j] >= m) m = remap[j] + 1;
+        }
+
+        memcpy(items, sorted, sizeof(vec3_t) * m);
+    }
+
+    free(sorted);
+
+    return 0;
+}
+
+/* gltf import --------------------------------------------------------- */
+
+/*
+ * .glb files are a json chunk describing the scene followed by a binary
+ * chunk the accessors point into, so only the json is parsed and the
+ * vertex data is read in place. the first node with a mesh is imported
+ * (preferring skinned ones) along with its skin and every animation
+ * channel that targets one of its joints
+ *
+ * y is flipped like the obj parser does for positions, which for the
+ * rest of the data means conjugating every transform with diag(1, -1, 1).
+ * normals keep the file's y like every other importer, see
+ * print_header
+ */
+
+enum
+{
+    JSON_NULL, JSON_FALSE, JSON_TRUE, JSON_NUMBER, JSON_STRING,
+    JSON_ARRAY, JSON_OBJECT
+};
+
+#define JSON_MAX_DEPTH 64
+
+/* parsed json values, children and siblings are indices or -1 */
+struct json
+{
+    int type;
+    char const* key; /* member name inside objects, not terminated */
+    size_t key_len;
+    char const* str; /* string contents, escapes are left alone */
+    size_t str_len;
+    double number;
+    int child, next;
+};
+
+typedef struct json json_t;
+
+static
+char const* json_ws(char const* p, char const* end)
+{
+    while (p < end && isspace((unsigned char)*p)) ++p;
+    return p;
+}
+
+/* scans a string starting at the opening quote */
+static
+char const* json_string(char const* p, char const* end, char const** s,
+    size_t* len)
+{
+    *s = ++p;
+
+    while (p < end && *p != '"') {
+        p += *p == '\\' ? 2 : 1;
+    }
+
+    if (p >= end) return 0;
+    *len = (size_t)(p - *s);
+
+    return p + 1;
+}
+
+/* parses the value at p into json[*index], returns where it ends */
+static
+char const* json_value(obj2h_t* o, char const* p, char const* end, int depth,
+    int* index)
+{
+    json_t* v;
+    int last = -1;
+
+    p = json_ws(p, end);
+    if (p >= end || depth > JSON_MAX_DEPTH) return 0;
+
+    v = push_back(sizeof(json_t), (void**)&o->json, &o->njson, &o->json_cap);
+    if (!v) return 0;
+
+    memset(v, 0, sizeof(*v));
+    v->child = v->next = -1;
+    *index = (int)(o->njson - 1);
+
+    if (*p == '"')
+    {
+        v->type = JSON_STRING;
+        return json_string(p, end, &v->str, &v->str_len);
+    }
+
+    if (*p != '{' && *p != '[')
+    {
+        static char const* const words[] = { "null", "false", "true" };
+        char* num_end;
+        int i;
+
+        for (i = 0; i < 3; ++i)
+        {
+            size_t len = strlen(words[i]);
+
+            if ((size_t)(end - p) >= len && !memcmp(p, words[i], len))
+            {
+                v->type = JSON_NULL + i;
+                return p + len;
+            }
+        }
+
+        /* the json chunk is padded with spaces so strtod stops in time */
+        v->type = JSON_NUMBER;
+        v->number = strtod(p, &num_end);
+
+        return num_end == p ? 0 : num_end;
+    }
+
+    v->type = *p == '{' ? JSON_OBJECT : JSON_ARRAY;
+    p = json_ws(p + 1, end);
+
+    if (p < end && (*p == '}' || *p == ']')) {
+        return p + 1;
+    }
+
+    while (p < end)
+    {
+        char const* key = 0;
+        size_t key_len = 0;
+        int child;
+
+        if (o->json[*index].type == JSON_OBJECT)
+        {
+            p = json_ws(p, end);
+            if (p >= end || *p != '"') return 0;
+            p = json_string(p, end, &key, &key_len);
+            if (!p) return 0;
+            p = json_ws(p, end);
+            if (p >= end || *p != ':') return 0;
+            ++p;
+        }
+
+        /* json can move while parsing, only hold on to indices */
+        p = json_value(o, p, end, depth + 1, &child);
+        if (!p) return 0;
+
+        o->json[child].key = key;
+        o->json[child].key_len = key_len;
+
+        if (last < 0) {
+            o->json[*index].child = child;
+        } else {
+            o->json[last].next = child;
+        }
+
+        last = child;
+        p = json_ws(p, end);
+
+        if (p < end && *p == ',') {
+            ++p;
+        } else if (p < end && (*p == '}' || *p == ']')) {
+            return p + 1;
+        } else {
+            return 0;
+        }
+    }
+
+    return 0;
+}
+
+static
+int json_member(obj2h_t* o, int obj, char const* key)
+{
+    size_t len = strlen(key);
+    int i;
+
+    if (obj < 0 || o->json[obj].type != JSON_OBJECT) return -1;
+
+    for (i = o->json[obj].child; i >= 0; i = o->json[i].next)
+    {
+        if (o->json[i].key_len == len && !memcmp(o->json[i].key, key, len)) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static
+int json_item(obj2h_t* o, int arr, int n)
+{
+    int i;
+
+    if (arr < 0 || n < 0 || o->json[arr].type != JSON_ARRAY) return -1;
+
+    for (i = o->json[arr].child; i >= 0 && n; i = o->json[i].next) --n;
+
+    return i;
+}
+
+static
+size_t json_count(obj2h_t* o, int arr)
+{
+    size_t n = 0;
+    int i;
+
+    if (arr < 0 || o->json[arr].type != JSON_ARRAY) return 0;
+
+    for (i = o->json[arr].child; i >= 0; i = o->json[i].next) ++n;
+
+    return n;
+}
+
+static
+double json_number(obj2h_t* o, int value, double fallback)
+{
+    if (value < 0 || o->json[value].type != JSON_NUMBER) return fallback;
+    return o->json[value].number;
+}
+
+static
+int json_int(obj2h_t* o, int value, int fallback)
+{
+    double x = json_number(o, value, fallback);
+    return x >= -2147483647.0 && x <= 2147483647.0 ? (int)x : fallback;
+}
+
+static
+int json_is(obj2h_t* o, int value, char const* s)
+{
+    size_t len = strlen(s);
+
+    return value >= 0 && o->json[value].type == JSON_STRING &&
+        o->json[value].str_len == len && !memcmp(o->json[value].str, s, len);
+}
+
+/* copies a json string into a c string literal safe buffer */
+static
+void json_name(obj2h_t* o, int value, char* name, size_t size,
+    char const* fallback, size_t n)
+{
+    size_t i, len;
+
+    if (value < 0 || o->json[value].type != JSON_STRING ||
+        !o->json[value].str_len)
+    {
+        snprintf(name, size, "%s%zd", fallback, n);
+        return;
+    }
+
+    len = o->json[value].str_len < size - 1 ? o->json[value].str_len : size - 1;
+
+    for (i = 0; i < len; ++i)
+    {
+        char c = o->json[value].str[i];
+        name[i] = isalnum((unsigned char)c) || strchr(" _-.:", c) ? c : '_';
+    }
+
+    name[len] = 0;
+}
+
+/* skin data imported from gltf ---------------------------------------- */
+
+#define GLTF_ROOT 0
+
+struct skin_vertex { unsigned char joints[4], weights[4]; };
+typedef struct skin_vertex skin_vertex_t;
+
+struct joint
+{
+    char name[64];
+    int node;
+    int parent;
+    float inverse_bind[16];
+    float t[3], r[4], s[3];
+};
+
+typedef struct joint joint_t;
+
+struct anim_channel
+{
+    int joint, path, interpolation;
+    size_t nkeys, first_time, first_value;
+};
+
+typedef struct anim_channel anim_channel_t;
+
+struct anim_clip
+{
+    char name[64];
+    float duration;
+    size_t first_channel, nchannels;
+};
+
+typedef struct anim_clip anim_clip_t;
+
+/* moves skin[i] to remap[i] along with the vertices, like morph_permute */
+static
+int skin_permute(obj2h_t* o, size_t const* remap, size_t n)
+{
+    skin_vertex_t* sorted;
+    size_t i, m = 0;
+
+    if (!o->nskin) return 0;
+
+    sorted = malloc(sizeof(skin_vertex_t) * (n + 1));
+    if (!sorted) {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    for (i = n; i-- > 0;)
+    {
+        sorted[remap[i]] = o->skin[i];
+        if (remap[i] >= m) m = remap[i] + 1;
+    }
+
+    free(o->skin);
+    o->skin = sorted;
+    o->skin_cap = n + 1;
+    o->nskin = m;
+
+    return 0;
+}
+
+/* the same for vertex colors */
+static
+int colors_permute(obj2h_t* o, size_t const* remap, size_t n)
+{
+    unsigned long* sorted;
+    size_t i, m = 0;
+
+    if (!o->nvertex_colors) return 0;
+
+    sorted = malloc(sizeof(unsigned long) * (n + 1));
+    if (!sorted) {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    for (i = n; i-- > 0;)
+    {
+        sorted[remap[i]] = o->vertex_colors[i];
+        if (remap[i] >= m) m = remap[i] + 1;
+    }
+
+    free(o->vertex_colors);
+    o->vertex_colors = sorted;
+    o->vertex_colors_cap = n + 1;
+    o->nvertex_colors = m;
+
+    return 0;
+}
+
+/* all of the above for vertices (kind 0), uvs (1) or normals (2) */
+static
+int attributes_permute(obj2h_t* o, size_t kind, size_t const* remap,
+    size_t n)
+{
+    if (morph_permute(o, kind, remap, n)) return 1;
+    if (kind) return 0;
+
+    return skin_permute(o, remap, n) || colors_permute(o, remap, n);
+}
+
+static
+unsigned long read_u32(unsigned char const* p)
+{
+    return p[0] | (p[1] << 8) | ((unsigned long)p[2] << 16) |
+        ((unsigned long)p[3] << 24);
+}
+
+struct accessor
+{
+    unsigned char const* data;
+    size_t count, stride;
+    int ncomponents, component_type, normalized;
+};
+
+typedef struct accessor accessor_t;
+
+static
+size_t component_size(int component_type)
+{
+    switch (component_type)
+    {
+    case 5120: case 5121: return 1;
+    case 5122: case 5123: return 2;
+    case 5125: case 5126: return 4;
+    }
+
+    return 0;
+}
+
+/* resolves accessor index down to the binary chunk and bounds checks it */
+static
+int gltf_accessor(obj2h_t* o, int index, accessor_t* a)
+{
+    static char const* const types[] = {
+        "SCALAR", "VEC2", "VEC3", "VEC4", "MAT4"
+    };
+
+    static int const ncomponents[] = { 1, 2, 3, 4, 16 };
+
+    int acc = json_item(o, json_member(o, GLTF_ROOT, "accessors"), index);
+    int view, normalized;
+    size_t offset, length, size;
+    int i;
+
+    memset(a, 0, sizeof(*a));
+
+    if (acc < 0) return 1;
+
+    view = json_item(o, json_member(o, GLTF_ROOT, "bufferViews"),
+        json_int(o, json_member(o, acc, "bufferView"), -1));
+
+    if (view < 0 || json_member(o, acc, "sparse") >= 0 ||
+        json_int(o, json_member(o, view, "buffer"), 0) != 0)
+    {
+        eprintf(o, "gltf: accessor %d: only dense accessors into the "
+            "glb buffer are supported\n", index);
+        return 1;
+    }
+
+    for (i = 0; i < 5; ++i)
+    {
+        if (json_is(o, json_member(o, acc, "type"), types[i])) {
+            a->ncomponents = ncomponents[i];
+        }
+    }
+
+    a->component_type =
+        json_int(o, json_member(o, acc, "componentType"), 0);
+    normalized = json_member(o, acc, "normalized");
+    a->normalized = normalized >= 0 && o->json[normalized].type == JSON_TRUE;
+    a->count = json_int(o, json_member(o, acc, "count"), 0);
+
+    size = component_size(a->component_type) * a->ncomponents;
+    offset = json_int(o, json_member(o, view, "byteOffset"), 0);
+    length = json_int(o, json_member(o, view, "byteLength"), 0);
+    a->stride = json_int(o, json_member(o, view, "byteStride"), size);
+
+    if (!size || offset > o->glb_bin_size || length > o->glb_bin_size - offset)
+    {
+        eprintf(o, "gltf: accessor %d is invalid\n", index);
+        return 1;
+    }
+
+    a->data = o->glb_bin + offset;
+    offset = json_int(o, json_member(o, acc, "byteOffset"), 0);
+
+    if (a->count && (offset > length || a->stride < size ||
+        (a->count - 1) > (length - offset - size) / a->stride ||
+        size > length - offset))
+    {
+        eprintf(o, "gltf: accessor %d is out of bounds\n", index);
+        return 1;
+    }
+
+    a->data += offset;
+
+    return 0;
+}
+
+static
+float accessor_float(accessor_t const* a, size_t i, int c)
+{
+    unsigned char const* p = a->data + i * a->stride +
+        c * component_size(a->component_type);
+    unsigned u = p[0];
+    float f;
+
+    switch (a->component_type)
+    {
+    case 5120:
+        return a->normalized ? fmaxf((signed char)u / 127.0f, -1) :
+            (signed char)u;
+
+    case 5121:
+        return a->normalized ? u / 255.0f : u;
+
+    case 5122:
+        u |= p[1] << 8;
+        return a->normalized ? fmaxf((short)u / 32767.0f, -1) : (short)u;
+
+    case 5123:
+        u |= p[1] << 8;
+        return a->normalized ? u / 65535.0f : u;
+
+    case 5125:
+        return (float)(u | p[1] << 8 | p[2] << 16 | (unsigned)p[3] << 24);
+
+    default:
+        u |= p[1] << 8 | p[2] << 16 | (unsigned)p[3] << 24;
+        memcpy(&f, &u, 4);
+        return f;
+    }
+}
+
+static
+unsigned long accessor_uint(accessor_t const* a, size_t i, int c)
+{
+    unsigned char const* p = a->data + i * a->stride +
+        c * component_size(a->component_type);
+
+    switch (component_size(a->component_type))
+    {
+    case 1: return p[0];
+    case 2: return p[0] | p[1] << 8;
+    }
+
+    return p[0] | p[1] << 8 | (unsigned long)p[2] << 16 |
+        (unsigned long)p[3] << 24;
+}
+
+static
+void mat_identity16(float* m)
+{
+    int i;
+
+    for (i = 0; i < 16; ++i) m[i] = i % 5 ? 0 : 1;
+}
+
+/* conjugates m with diag(1, -1, 1, 1) */
+static
+void mat_flip_y(float* m)
+{
+    int r, c;
+
+    for (c = 0; c < 4; ++c)
+    {
+        for (r = 0; r < 4; ++r) {
+            if ((r == 1) != (c == 1)) m[c * 4 + r] = -m[c * 4 + r];
+        }
+    }
+}
+
+/*
+ * the inverse transpose of m's upper 3x3 for transforming normals, up to
+ * a positive scale since they're renormalized anyway: the cofactors,
+ * negated if m mirrors
+ */
+static
+void mat_normal(float const* m, float* n)
+{
+    float const* a[3];
+    float det;
+    int i;
+
+    a[0] = m;
+    a[1] = m + 4;
+    a[2] = m + 8;
+
+    /* column i of the result is a[i + 1] x a[i + 2] */
+    for (i = 0; i < 3; ++i)
+    {
+        float const* u = a[(i + 1) % 3];
+        float const* v = a[(i + 2) % 3];
+
+        n[i * 3 + 0] = u[1] * v[2] - u[2] * v[1];
+        n[i * 3 + 1] = u[2] * v[0] - u[0] * v[2];
+        n[i * 3 + 2] = u[0] * v[1] - u[1] * v[0];
+    }
+
+    det = a[0][0] * n[0] + a[0][1] * n[1] + a[0][2] * n[2];
+    if (det < 0) for (i = 0; i < 9; ++i) n[i] = -n[i];
+}
+
+/* inverse of obj2h_pose_matrix for matrices without shear */
+static
+void matrix_trs(float const* m, float* t, float* q, float* s)
+{
+    float r[9];
+    float trace;
+    int i;
+
+    for (i = 0; i < 3; ++i)
+    {
+        float const* col = m + i * 4;
+
+        t[i] = m[12 + i];
+        s[i] = sqrtf(col[0] * col[0] + col[1] * col[1] + col[2] * col[2]);
+        if (s[i] == 0) s[i] = 1;
+
+        r[i * 3] = col[0] / s[i];
+        r[i * 3 + 1] = col[1] / s[i];
+        r[i * 3 + 2] = col[2] / s[i];
+    }
+
+    /* r is column major, r[c * 3 + r] */
+    trace = r[0] + r[4] + r[8];
+
+    if (trace > 0)
+    {
+        float k = 0.5f / sqrtf(trace + 1);
+        q[3] = 0.25f / k;
+        q[0] = (r[5] - r[7]) * k;
+        q[1] = (r[6] - r[2]) * k;
+        q[2] = (r[1] - r[3]) * k;
+    }
+
+    else if (r[0] > r[4] && r[0] > r[8])
+    {
+        float k = 2 * sqrtf(1 + r[0] - r[4] - r[8]);
+        q[3] = (r[5] - r[7]) / k;
+        q[0] = 0.25f * k;
+        q[1] = (r[3] + r[1]) / k;
+        q[2] = (r[6] + r[2]) / k;
+    }
+
+    else if (r[4] > r[8])
+    {
+        float k = 2 * sqrtf(1 + r[4] - r[0] - r[8]);
+        q[3] = (r[6] - r[2]) / k;
+        q[0] = (r[3] + r[1]) / k;
+        q[1] = 0.25f * k;
+        q[2] = (r[7] + r[5]) / k;
+    }
+
+    else
+    {
+        float k = 2 * sqrtf(1 + r[8] - r[0] - r[4]);
+        q[3] = (r[1] - r[3]) / k;
+        q[0] = (r[6] + r[2]) / k;
+        q[1] = (r[7] + r[5]) / k;
+        q[2] = 0.25f * k;
+    }
+}
+
+static
+void gltf_node_trs(obj2h_t* o, int node, float* t, float* q, float* s)
+{
+    int matrix = json_member(o, node, "matrix");
+    int i;
+
+    if (json_count(o, matrix) == 16)
+    {
+        float m[16];
+
+        for (i = 0; i < 16; ++i) {
+            m[i] = (float)json_number(o, json_item(o, matrix, i), 0);
+        }
+
+        matrix_trs(m, t, q, s);
+        return;
+    }
+
+    for (i = 0; i < 4; ++i)
+    {
+        int v;
+
+        if (i < 3)
+        {
+            v = json_item(o, json_member(o, node, "translation"), i);
+            t[i] = (float)json_number(o, v, 0);
+            v = json_item(o, json_member(o, node, "scale"), i);
+            s[i] = (float)json_number(o, v, 1);
+        }
+
+        v = json_item(o, json_member(o, node, "rotation"), i);
+        q[i] = (float)json_number(o, v, i == 3);
+    }
+}
+
+/* finds the parent of every node, -1 for roots */
+static
+int* gltf_node_parents(obj2h_t* o, size_t nnodes)
+{
+    int nodes = json_member(o, GLTF_ROOT, "nodes");
+    int* parents = malloc(sizeof(int) * (nnodes + 1));
+    size_t i, j;
+
+    if (!parents) {
+        eperror(o, "malloc");
+        return 0;
+    }
+
+    for (i = 0; i < nnodes; ++i) parents[i] = -1;
+
+    for (i = 0; i < nnodes; ++i)
+    {
+        int children = json_member(o, json_item(o, nodes, i), "children");
+
+        for (j = 0; j < json_count(o, children); ++j)
+        {
+            size_t child = json_int(o, json_item(o, children, j), -1);
+            if (child < nnodes) parents[child] = (int)i;
+        }
+    }
+
+    return parents;
+}
+
+static
+void gltf_world(obj2h_t* o, int const* parents, int node, float* m)
+{
+    int nodes = json_member(o, GLTF_ROOT, "nodes");
+    obj2h_joint_pose_t pose;
+    float local[16], parent[16];
+
+    mat_identity16(m);
+
+    if (node < 0) return;
+
+    gltf_world(o, parents, parents[node], parent);
+    gltf_node_trs(o, json_item(o, nodes, node), pose.t, pose.r, pose.s);
+    obj2h_pose_matrix(&pose, local);
+    obj2h_mat_mul(parent, local, m);
+}
+
+/* quantizes weights to bytes that sum to 255, largest remainders first */
+static
+void quantize_weights(float const* w, unsigned char* q)
+{
+    float sum = w[0] + w[1] + w[2] + w[3];
+    float frac[4];
+    int total = 0, i;
+
+    for (i = 0; i < 4; ++i)
+    {
+        float x = sum > 0 ? w[i] / sum * 255 : (i ? 0 : 255);
+
+        q[i] = (unsigned char)x;
+        frac[i] = x - q[i];
+        total += q[i];
+    }
+
+    while (total < 255)
+    {
+        int best = 0;
+
+        for (i = 1; i < 4; ++i) {
+            if (frac[i] > frac[best]) best = i;
+        }
+
+        ++q[best];
+        frac[best] = -1;
+        ++total;
+    }
+}
+
+/* appends a triangle list primitive to the mesh */
+static
+int gltf_primitive(obj2h_t* o, int prim, float const* world, int skinned,
+    int const* joint_remap)
+{
+    int attributes = json_member(o, prim, "attributes");
+    int indices = json_member(o, prim, "indices");
+    accessor_t pos, nrm, uv, jnt, wgt, idx;
+    int has_nrm, has_uv, has_skin;
+    size_t base = o->nvertices;
+    size_t i, ntris;
+    float nm[9];
+    int c;
+
+    if (json_number(o, json_member(o, prim, "mode"), 4) != 4)
+    {
+        eprintf(o, "gltf: skipping a primitive that isn't a triangle "
+            "list\n");
+        return 0;
+    }
+
+    if (gltf_accessor(o, json_int(o, json_member(o, attributes,
+        "POSITION"), -1), &pos) || pos.ncomponents != 3)
+    {
+        return 1;
+    }
+
+    has_nrm = json_member(o, attributes, "NORMAL") >= 0;
+    has_uv = json_member(o, attributes, "TEXCOORD_0") >= 0;
+    has_skin = skinned && json_member(o, attributes, "JOINTS_0") >= 0 &&
+        json_member(o, attributes, "WEIGHTS_0") >= 0;
+
+    if (has_nrm && (gltf_accessor(o, json_int(o, json_member(o, attributes,
+        "NORMAL"), -1), &nrm) || nrm.count != pos.count ||
+        nrm.ncomponents != 3))
+    {
+        return 1;
+    }
+
+    if (has_uv && (gltf_accessor(o, json_int(o, json_member(o, attributes,
+        "TEXCOORD_0"), -1), &uv) || uv.count != pos.count ||
+        uv.ncomponents != 2))
+    {
+        return 1;
+    }
+
+    if (has_skin && (
+        gltf_accessor(o, json_int(o, json_member(o, attributes,
+            "JOINTS_0"), -1), &jnt) ||
+        gltf_accessor(o, json_int(o, json_member(o, attributes,
+            "WEIGHTS_0"), -1), &wgt) ||
+        jnt.count != pos.count || wgt.count != pos.count ||
+        jnt.ncomponents != 4 || wgt.ncomponents != 4))
+    {
+        return 1;
+    }
+
+    /* keep normals and uvs indexed like the vertices */
+    while (has_nrm && o->nnormals < base)
+    {
+        vec3_t* n = push_back(sizeof(vec3_t), (void**)&o->normals, &o->nnormals,
+            &o->normals_cap);
+        if (!n) return 1;
+        n->x = n->y = n->z = 0;
+    }
+
+    while (has_uv && o->nuvs < base)
+    {
+        uv_t* u = push_back(sizeof(uv_t), (void**)&o->uvs, &o->nuvs,
+            &o->uvs_cap);
+        if (!u) return 1;
+        u->u = u->v = 0;
+    }
+
+    mat_normal(world, nm);
+
+    for (i = 0; i < pos.count; ++i)
+    {
+        vec3_t* v = push_back(sizeof(vec3_t), (void**)&o->vertices,
+            &o->nvertices, &o->vertices_cap);
+        float p[3];
+
+        if (!v) return 1;
+
+        for (c = 0; c < 3; ++c) p[c] = accessor_float(&pos, i, c);
+
+        v->x = world[0] * p[0] + world[4] * p[1] + world[8] * p[2] +
+            world[12];
+        v->y = -(world[1] * p[0] + world[5] * p[1] + world[9] * p[2] +
+            world[13]);
+        v->z = world[2] * p[0] + world[6] * p[1] + world[10] * p[2] +
+            world[14];
+
+        if (has_nrm)
+        {
+            vec3_t* n = push_back(sizeof(vec3_t), (void**)&o->normals,
+                &o->nnormals, &o->normals_cap);
+            float len;
+
+            if (!n) return 1;
+
+            for (c = 0; c < 3; ++c) p[c] = accessor_float(&nrm, i, c);
+
+            /* y stays as in the file, like the other importers */
+            n->x = nm[0] * p[0] + nm[3] * p[1] + nm[6] * p[2];
+            n->y = nm[1] * p[0] + nm[4] * p[1] + nm[7] * p[2];
+            n->z = nm[2] * p[0] + nm[5] * p[1] + nm[8] * p[2];
+
+            len = sqrtf(n->x * n->x + n->y * n->y + n->z * n->z);
+
+            if (len > 0)
+            {
+                n->x /= len;
+                n->y /= len;
+                n->z /= len;
+            }
+        }
+
+        if (has_uv)
+        {
+            uv_t* u = push_back(sizeof(uv_t), (void**)&o->uvs, &o->nuvs,
+                &o->uvs_cap);
+            if (!u) return 1;
+
+            /* gltf's v goes down, obj's goes up */
+            u->u = accessor_float(&uv, i, 0);
+            u->v = 1 - accessor_float(&uv, i, 1);
+        }
+
+        if (skinned)
+        {
+            skin_vertex_t* s = push_back(sizeof(skin_vertex_t),
+                (void**)&o->skin, &o->nskin, &o->skin_cap);
+            float w[4] = { 1, 0, 0, 0 };
+
+            if (!s) return 1;
+            memset(s, 0, sizeof(*s));
+
+            for (c = 0; c < 4 && has_skin; ++c)
+            {
+                unsigned long j = accessor_uint(&jnt, i, c);
+
+                w[c] = accessor_float(&wgt, i, c);
+
+                if (j >= o->njoints)
+                {
+                    eprintf(o, "gltf: joint index %lu out of range\n",
+                        j);
+                    return 1;
+                }
+
+                s->joints[c] = (unsigned char)joint_remap[j];
+            }
+
+            quantize_weights(w, s->weights);
+        }
+    }
+
+    if (indices >= 0 && gltf_accessor(o, json_int(o, indices, -1), &idx))
+    {
+        return 1;
+    }
+
+    ntris = (indices >= 0 ? idx.count : pos.count) / 3;
+
+    for (i = 0; i < ntris; ++i)
+    {
+        face_t* f = push_back(sizeof(face_t), (void**)&o->faces, &o->nfaces,
+            &o->faces_cap);
+
+        if (!f) return 1;
+
+        for (c = 0; c < 3; ++c)
+        {
+            size_t v = indices >= 0 ? accessor_uint(&idx, i * 3 + c, 0) :
+                i * 3 + c;
+
+            if (v >= pos.count)
+            {
+                eprintf(o, "gltf: index %zd out of range\n", v);
+                return 1;
+            }
+
+            f->vertex_indices[c] = (int)(base + v);
+            f->uv_indices[c] = has_uv ? (int)(base + v) : -1;
+            f->normal_indices[c] = has_nrm ? (int)(base + v) : -1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * imports the skin's joints ordered so parents come first. joint_remap
+ * maps the skin's joint order to ours
+ */
+static
+int gltf_skin(obj2h_t* o, int skin_index, int const* parents, size_t nnodes,
+    int* joint_remap)
+{
+    int s = json_item(o, json_member(o, GLTF_ROOT, "skins"), skin_index);
+    int list = json_member(o, s, "joints");
+    int nodes = json_member(o, GLTF_ROOT, "nodes");
+    int depth[GLTF_MAX_JOINTS];
+    int node_joint[GLTF_MAX_JOINTS];
+    accessor_t ibm;
+    int has_ibm;
+    size_t i, j, k, n = json_count(o, list);
+    int root_parent = -2;
+
+    if (!n || n > GLTF_MAX_JOINTS)
+    {
+        eprintf(o, "gltf: skins need 1 to %d joints\n",
+            GLTF_MAX_JOINTS);
+        return 1;
+    }
+
+    has_ibm = json_member(o, s, "inverseBindMatrices") >= 0;
+
+    if (has_ibm && (gltf_accessor(o, json_int(o, json_member(o, s,
+        "inverseBindMatrices"), -1), &ibm) || ibm.ncomponents != 16 ||
+        ibm.count < n))
+    {
+        return 1;
+    }
+
+    for (i = 0; i < n; ++i)
+    {
+        node_joint[i] = json_int(o, json_item(o, list, i), -1);
+
+        if (node_joint[i] < 0 || (size_t)node_joint[i] >= nnodes)
+        {
+            eprintf(o, "gltf: invalid joint node\n");
+            return 1;
+        }
+    }
+
+    /* depth in the joint hierarchy, nodes in between are skipped over */
+    for (i = 0; i < n; ++i)
+    {
+        int p;
+
+        depth[i] = 0;
+
+        for (p = parents[node_joint[i]]; p >= 0; p = parents[p])
+        {
+            for (j = 0; j < n && node_joint[j] != p; ++j);
+            if (j < n) ++depth[i];
+        }
+    }
+
+    /* stable order by depth */
+    o->njoints = 0;
+
+    for (k = 0; o->njoints < n; ++k)
+    {
+        for (i = 0; i < n; ++i)
+        {
+            joint_t* jt = &o->joints[o->njoints];
+            int node = node_joint[i];
+            int p;
+
+            if ((size_t)depth[i] != k) continue;
+
+            jt->node = node;
+            jt->parent = -1;
+            joint_remap[i] = (int)o->njoints++;
+
+            json_name(o, json_member(o, json_item(o, nodes, node), "name"),
+                jt->name, sizeof(jt->name), "joint", i);
+
+            gltf_node_trs(o, json_item(o, nodes, node), jt->t, jt->r, jt->s);
+            jt->t[1] = -jt->t[1];
+            jt->r[0] = -jt->r[0];
+            jt->r[2] = -jt->r[2];
+
+            for (j = 0; j < 16; ++j) {
+                jt->inverse_bind[j] = has_ibm ?
+                    accessor_float(&ibm, i, (int)j) : j % 5 ? 0 : 1;
+            }
+
+            mat_flip_y(jt->inverse_bind);
+
+            for (p = parents[node]; p >= 0; p = parents[p])
+            {
+                for (j = 0; j < o->njoints - 1 && o->joints[j].node != p; ++j);
+
+                if (j < o->njoints - 1)
+                {
+                    jt->parent = (int)j;
+                    break;
+                }
+            }
+
+            if (jt->parent >= 0) continue;
+
+            /* root joints share one parent transform */
+            if (root_parent != -2 && root_parent != parents[node]) {
+                eprintf(o, "gltf: root joints have different parents, "
+                    "using the first one's\n");
+            }
+
+            if (root_parent == -2)
+            {
+                root_parent = parents[node];
+                gltf_world(o, parents, root_parent, o->skeleton_root);
+                mat_flip_y(o->skeleton_root);
+            }
+        }
+    }
+
+    return 0;
+}
+
+/* pulls in every animation channel that targets a joint */
+static
+int gltf_animations(obj2h_t* o)
+{
+    int animations = json_member(o, GLTF_ROOT, "animations");
+    size_t i, j, k, nskipped = 0;
+
+    for (i = 0; i < json_count(o, animations); ++i)
+    {
+        int anim = json_item(o, animations, i);
+        int channels = json_member(o, anim, "channels");
+        int samplers = json_member(o, anim, "samplers");
+        anim_clip_t* clip = push_back(sizeof(anim_clip_t),
+            (void**)&o->anim_clips, &o->nanim_clips, &o->anim_clips_cap);
+
+        if (!clip) return 1;
+
+        json_name(o, json_member(o, anim, "name"), clip->name,
+            sizeof(clip->name), "clip", i);
+        clip->duration = 0;
+        clip->first_channel = o->nanim_channels;
+        clip->nchannels = 0;
+
+        for (j = 0; j < json_count(o, channels); ++j)
+        {
+            int channel = json_item(o, channels, j);
+            int target = json_member(o, channel, "target");
+            int path = json_member(o, target, "path");
+            int node = json_int(o, json_member(o, target, "node"), -1);
+            int sampler = json_item(o, samplers,
+                json_int(o, json_member(o, channel, "sampler"), -1));
+            int interpolation = json_member(o, sampler, "interpolation");
+            int cubic = json_is(o, interpolation, "CUBICSPLINE");
+            anim_channel_t* c;
+            accessor_t in, out;
+            size_t joint;
+            int ncomponents;
+
+            for (joint = 0; joint < o->njoints && o->joints[joint].node != node;
+                ++joint);
+
+            if (joint == o->njoints || sampler < 0 ||
+                json_is(o, path, "weights"))
+            {
+                ++nskipped;
+                continue;
+            }
+
+            ncomponents = json_is(o, path, "rotation") ? 4 : 3;
+
+            if (gltf_accessor(o, json_int(o, json_member(o, sampler,
+                "input"), -1), &in) ||
+                gltf_accessor(o, json_int(o, json_member(o, sampler,
+                "output"), -1), &out) ||
+                in.ncomponents != 1 || out.ncomponents != ncomponents ||
+                out.count != in.count * (cubic ? 3 : 1))
+            {
+                return 1;
+            }
+
+            c = push_back(sizeof(anim_channel_t), (void**)&o->anim_channels,
+                &o->nanim_channels, &o->anim_channels_cap);
+            if (!c) return 1;
+
+            c->joint = (int)joint;
+            c->path = json_is(o, path, "translation") ? OBJ2H_ANIM_TRANSLATION :
+                json_is(o, path, "rotation") ? OBJ2H_ANIM_ROTATION :
+                OBJ2H_ANIM_SCALE;
+            c->interpolation = json_is(o, interpolation, "STEP") ?
+                OBJ2H_ANIM_STEP : OBJ2H_ANIM_LINEAR;
+            c->nkeys = in.count;
+            c->first_time = o->nanim_times;
+            c->first_value = o->nanim_values;
+            ++clip->nchannels;
+
+            for (k = 0; k < in.count; ++k)
+            {
+                float* t = push_back(sizeof(float), (void**)&o->anim_times,
+                    &o->nanim_times, &o->anim_times_cap);
+                int m;
+
+                if (!t) return 1;
+
+                *t = accessor_float(&in, k, 0);
+                clip->duration = fmaxf(clip->duration, *t);
+
+                /* cubic splines keep their values, tangents are dropped */
+                for (m = 0; m < ncomponents; ++m)
+                {
+                    float* v = push_back(sizeof(float),
+                        (void**)&o->anim_values, &o->nanim_values,
+                        &o->anim_values_cap);
+                    float x;
+
+                    if (!v) return 1;
+
+                    x = accessor_float(&out, cubic ? k * 3 + 1 : k, m);
+
+                    if ((c->path == OBJ2H_ANIM_TRANSLATION && m == 1) ||
+                        (c->path == OBJ2H_ANIM_ROTATION && m != 1 && m != 3))
+                    {
+                        x = -x;
+                    }
+
+                    *v = x;
+                }
+            }
+        }
+    }
+
+    if (nskipped) {
+        eprintf(o, "gltf: skipped %zd channels that don't animate "
+            "joints\n", nskipped);
+    }
+
+    return 0;
+}
+
+/* imports the mesh of the parsed json */
+static
+int glb_import(obj2h_t* o, char const* path)
+{
+    size_t i, nnodes;
+    int* parents;
+    int nodes, node = -1, mesh, skin_index;
+    int joint_remap[GLTF_MAX_JOINTS];
+    float world[16];
+    int err = 0;
+
+    nodes = json_member(o, GLTF_ROOT, "nodes");
+    nnodes = json_count(o, nodes);
+    parents = gltf_node_parents(o, nnodes);
+    if (!parents) return 1;
+
+    for (i = 0; i < nnodes; ++i)
+    {
+        int n = json_item(o, nodes, i);
+
+        if (json_member(o, n, "mesh") < 0) continue;
+        if (node < 0 || json_member(o, n, "skin") >= 0) node = (int)i;
+        if (json_member(o, n, "skin") >= 0) break;
+    }
+
+    if (node < 0)
+    {
+        eprintf(o, "%s: no meshes\n", path);
+        free(parents);
+        return 1;
+    }
+
+    mesh = json_item(o, json_member(o, GLTF_ROOT, "meshes"),
+        json_int(o, json_member(o, json_item(o, nodes, node), "mesh"), -1));
+    skin_index = json_int(o,
+        json_member(o, json_item(o, nodes, node), "skin"), -1);
+
+    /* skinned meshes ignore their node's transform */
+    mat_identity16(world);
+
+    if (skin_index >= 0) {
+        err = gltf_skin(o, skin_index, parents, nnodes, joint_remap);
+    } else {
+        gltf_world(o, parents, node, world);
+    }
+
+    for (i = 0; !err && i < json_count(o, json_member(o, mesh, "primitives"));
+        ++i)
+    {
+        err = gltf_primitive(o,
+            json_item(o, json_member(o, mesh, "primitives"), i),
+            world, skin_index >= 0, joint_remap);
+    }
+
+    if (!err && skin_index >= 0) {
+        err = gltf_animations(o);
+    }
+
+    if (!err && o->njoints)
+    {
+        eprintf(o, "gltf: %zd joints, %zd clips, %zd channels\n",
+            o->njoints, o->nanim_clips, o->nanim_channels);
+    }
+
+    free(parents);
+
+    return err;
+}
+
+static
+int parse_glb(obj2h_t* o, char const* path, unsigned char const* data,
+    size_t size)
+{
+    char* json;
+    unsigned long json_size;
+    int root;
+    int err;
+
+    /* header, then a json chunk and an optional binary chunk */
+    if (size < 20 || memcmp(data, "glTF", 4) || read_u32(data + 4) != 2 ||
+        memcmp(data + 16, "JSON", 4) ||
+        (json_size = read_u32(data + 12)) > (unsigned long)size - 20)
+    {
+        eprintf(o, "%s: not a gltf 2 binary file\n", path);
+        return 1;
+    }
+
+    if (json_size + 28 <= (unsigned long)size &&
+        !memcmp(data + 20 + json_size + 4, "BIN", 4))
+    {
+        o->glb_bin = data + 28 + json_size;
+        o->glb_bin_size = read_u32(data + 20 + json_size);
+
+        if (o->glb_bin_size > (unsigned long)size - 28 - json_size)
+        {
+            eprintf(o, "%s: truncated binary chunk\n", path);
+            o->glb_bin = 0;
+            return 1;
+        }
+    }
+
+    /* the json parser wants a terminated string */
+    json = malloc(json_size + 1);
+
+    if (!json) {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    memcpy(json, data + 20, json_size);
+    json[json_size] = 0;
+
+    if (!json_value(o, json, json + json_size, 0, &root) ||
+        o->json[GLTF_ROOT].type != JSON_OBJECT)
+    {
+        eprintf(o, "%s: invalid json chunk\n", path);
+        err = 1;
+    }
+
+    else {
+        err = glb_import(o, path);
+    }
+
+    /* the json points into the model, only the imported copies are kept */
+    free(o->json);
+    free(json);
+    o->json = 0;
+    o->njson = o->json_cap = 0;
+    o->glb_bin = 0;
+
+    return err;
+}
+
+/* ply and stl import -------------------------------------------------- */
+
+/*
+ * binary ply and stl files are read from a read-only mapping of the
+ * file. positions are welded with a spatial hash so stl's unshared
+ * triangle corners end up indexed, and so do the duplicates scanners
+ * like to leave behind
+ */
+
+#define WELD_MIN_BUCKETS 1024
+
+/*
+ * hashes positions into cells of epsilon size and looks for a match in
+ * the neighbouring cells. with a zero epsilon positions have to match
+ * exactly and the cell is the position itself
+ */
+struct welder
+{
+    vec3_t** items;
+    size_t* nitems;
+    size_t* cap;
+    float epsilon;
+    unsigned* buckets; /* first item of every bucket, -1 if empty */
+    size_t mask;
+    unsigned* chain;   /* next item in the same bucket */
+    unsigned* origin;  /* what incoming was when every item came in */
+    size_t chain_cap;
+
+    /*
+     * optional extra check before merging incoming with an existing
+     * item, which is passed as the incoming it came in as
+     */
+    int (*accept)(obj2h_t* o, size_t existing, size_t incoming);
+    obj2h_t* o;
+    size_t incoming;
+};
+
+typedef struct welder welder_t;
+
+static
+int weld_init(welder_t* w, obj2h_t* o, vec3_t** items, size_t* nitems,
+    size_t* cap, size_t expected, float epsilon)
+{
+    size_t nbuckets = WELD_MIN_BUCKETS;
+
+    while (nbuckets < expected) nbuckets *= 2;
+
+    memset(w, 0, sizeof(*w));
+    w->o = o;
+    w->items = items;
+    w->nitems = nitems;
+    w->cap = cap;
+    w->epsilon = epsilon;
+    w->mask = nbuckets - 1;
+    w->buckets = malloc(sizeof(unsigned) * nbuckets);
+
+    if (!w->buckets) {
+        eperror(w->o, "malloc");
+        return 1;
+    }
+
+    memset(w->buckets, 0xFF, sizeof(unsigned) * nbuckets);
+
+    return 0;
+}
+
+static
+void weld_free(welder_t* w)
+{
+    free(w->buckets);
+    free(w->chain);
+    free(w->origin);
+}
+
+static
+size_t weld_hash(welder_t const* w, long x, long y, long z)
+{
+    unsigned long h = (unsigned long)x * 73856093UL ^
+        (unsigned long)y * 19349663UL ^ (unsigned long)z * 83492791UL;
+
+    return (h ^ h >> 16) & w->mask;
+}
+
+static
+void weld_cell(welder_t const* w, vec3_t const* v, long* c)
+{
+    float const* p = &v->x;
+    int i;
+
+    for (i = 0; i < 3; ++i)
+    {
+        if (w->epsilon > 0)
+        {
+            c[i] = (long)floorf(p[i] / w->epsilon);
+        }
+
+        else
+        {
+            unsigned u;
+            memcpy(&u, &p[i], 4);
+            c[i] = (long)u;
+        }
+    }
+}
+
+/* returns the index of v's match or of v itself once added, -1 if oom */
+static
+long weld(welder_t* w, vec3_t const* v)
+{
+    vec3_t p = *v;
+    vec3_t* item;
+    long c[3];
+    int range = w->epsilon > 0;
+    int dx, dy, dz;
+    size_t h;
+    unsigned* next;
+
+    /* -0 and 0 are the same position */
+    p.x += 0.0f;
+    p.y += 0.0f;
+    p.z += 0.0f;
+
+    weld_cell(w, &p, c);
+
+    for (dx = -range; dx <= range; ++dx)
+    {
+        for (dy = -range; dy <= range; ++dy)
+        {
+            for (dz = -range; dz <= range; ++dz)
+            {
+                unsigned i = w->buckets[
+                    weld_hash(w, c[0] + dx, c[1] + dy, c[2] + dz)];
+
+                for (; i != (unsigned)-1; i = w->chain[i])
+                {
+                    vec3_t const* q = &(*w->items)[i];
+
+                    if (fabsf(q->x - p.x) <= w->epsilon &&
+                        fabsf(q->y - p.y) <= w->epsilon &&
+                        fabsf(q->z - p.z) <= w->epsilon &&
+                        (!w->accept ||
+                        w->accept(w->o, w->origin[i], w->incoming)))
+                    {
+                        return (long)i;
+                    }
+                }
+            }
+        }
+    }
+
+    item = push_back(sizeof(vec3_t), (void**)w->items, w->nitems, w->cap);
+    if (!item) return -1;
+    *item = p;
+
+    if (*w->nitems > w->chain_cap)
+    {
+        size_t cap = w->chain_cap ? w->chain_cap * 2 : 4096;
+        unsigned* chain;
+        unsigned* origin;
+
+        if (cap < *w->nitems) cap = *w->nitems;
+
+        /* whichever grows stays owned by w, so nothing leaks on failure */
+        chain = realloc(w->chain, sizeof(unsigned) * cap);
+        if (chain) w->chain = chain;
+        origin = realloc(w->origin, sizeof(unsigned) * cap);
+        if (origin) w->origin = origin;
+
+        if (!chain || !origin) {
+            eperror(w->o, "realloc");
+            return -1;
+        }
+
+        w->chain_cap = cap;
+    }
+
+    h = weld_hash(w, c[0], c[1], c[2]);
+    w->origin[*w->nitems - 1] = (unsigned)w->incoming;
+    next = &w->chain[*w->nitems - 1];
+    *next = w->buckets[h];
+    w->buckets[h] = (unsigned)(*w->nitems - 1);
+
+    return (long)(*w->nitems - 1);
+}
+
+/*
+ * whole arrays are welded through weld_run. exact welds of big arrays
+ * are split in WELD_SHARDS by a hash of the position: identical
+ * positions always land in the same shard, so welding every shard on
+ * its own, in input order, merges exactly what one welder going through
+ * all of them would. epsilon welds stay on one thread, what merges there
+ * depends on what came before
+ */
+#define WELD_SHARDS 64
+
+/* reads item i of what's being welded */
+typedef void (*weld_get_t)(void const* src, size_t i, vec3_t* v);
+
+struct weld_job
+{
+    obj2h_t* o;
+    void const* src;
+    weld_get_t get;
+    size_t n;
+    float epsilon;
+    int (*accept)(obj2h_t* o, size_t existing, size_t incoming);
+    unsigned* match;
+
+    unsigned char* shards; /* of every item */
+    size_t* counts; /* per chunk and shard, then where the chunk's go */
+    unsigned* order; /* items by shard, in input order within a shard */
+    size_t first[WELD_SHARDS + 1]; /* of every shard in order */
+};
+
+typedef struct weld_job weld_job_t;
+
+static
+void vec3_item(void const* src, size_t i, vec3_t* v)
+{
+    *v = ((vec3_t const*)src)[i];
+}
+
+static
+void uv_item(void const* src, size_t i, vec3_t* v)
+{
+    uv_t const* uv = (uv_t const*)src + i;
+
+    v->x = uv->u;
+    v->y = uv->v;
+    v->z = 0;
+}
+
+/* welds items[0] to items[count - 1], or 0 to count - 1 without items */
+static
+int weld_sequence(weld_job_t* j, unsigned const* items, size_t count,
+    size_t expected)
+{
+    vec3_t* welded = 0;
+    size_t nwelded = 0, welded_cap = 0, t;
+    welder_t w;
+    int err = 0;
+
+    if (weld_init(&w, j->o, &welded, &nwelded, &welded_cap, expected,
+        j->epsilon))
+    {
+        return 1;
+    }
+
+    w.accept = j->accept;
+
+    for (t = 0; t < count && !err; ++t)
+    {
+        size_t i = items ? items[t] : t;
+        vec3_t v;
+        long k;
+
+        j->get(j->src, i, &v);
+        w.incoming = i;
+        k = weld(&w, &v);
+
+        err = k < 0;
+        if (!err) j->match[i] = w.origin[k];
+    }
+
+    weld_free(&w);
+    free(welded);
+
+    return err;
+}
+
+/* exact matches have the same bits once -0 is 0 */
+static
+size_t weld_shard(vec3_t const* v)
+{
+    float p[3];
+    unsigned u[3];
+    unsigned long h;
+
+    p[0] = v->x + 0.0f;
+    p[1] = v->y + 0.0f;
+    p[2] = v->z + 0.0f;
+    memcpy(u, p, sizeof(u));
+
+    h = (unsigned long)u[0] * 73856093UL ^ (unsigned long)u[1] * 19349663UL ^
+        (unsigned long)u[2] * 83492791UL;
+
+    /* bits the welders' buckets don't use */
+    return (h ^ h >> 16) >> 20 & (WELD_SHARDS - 1);
+}
+
+static
+int weld_count(void* ctx, size_t first, size_t last)
+{
+    weld_job_t* j = ctx;
+    size_t* counts = &j->counts[first / PARALLEL_GRAIN * WELD_SHARDS];
+    size_t i;
+
+    for (i = first; i < last; ++i)
+    {
+        vec3_t v;
+
+        j->get(j->src, i, &v);
+        j->shards[i] = (unsigned char)weld_shard(&v);
+        ++counts[j->shards[i]];
+    }
+
+    return 0;
+}
+
+static
+int weld_scatter(void* ctx, size_t first, size_t last)
+{
+    weld_job_t* j = ctx;
+    size_t* next = &j->counts[first / PARALLEL_GRAIN * WELD_SHARDS];
+    size_t i;
+
+    for (i = first; i < last; ++i) {
+        j->order[next[j->shards[i]]++] = (unsigned)i;
+    }
+
+    return 0;
+}
+
+static
+int weld_shard_run(void* ctx, size_t first, size_t last)
+{
+    weld_job_t* j = ctx;
+    size_t s;
+
+    for (s = first; s < last; ++s)
+    {
+        size_t count = j->first[s + 1] - j->first[s];
+
+        if (weld_sequence(j, j->order + j->first[s], count, count)) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+ * welds items 0 to n - 1 of src as if they went through one welder in
+ * order: match[i] is the first item of i's cluster, i if it started
+ * one. expected sizes the welder's hash like weld_init
+ */
+static
+int weld_run(obj2h_t* o, void const* src, weld_get_t get, size_t n,
+    size_t expected, float epsilon,
+    int (*accept)(obj2h_t* o, size_t existing, size_t incoming),
+    unsigned* match)
+{
+    size_t nchunks = (n + PARALLEL_GRAIN - 1) / PARALLEL_GRAIN, c, s, at = 0;
+    weld_job_t j;
+    int err;
+
+    memset(&j, 0, sizeof(j));
+    j.o = o;
+    j.src = src;
+    j.get = get;
+    j.n = n;
+    j.epsilon = epsilon;
+    j.accept = accept;
+    j.match = match;
+
+    if (epsilon > 0 || nchunks <= 1 || thread_count(o) <= 1) {
+        return weld_sequence(&j, 0, n, expected);
+    }
+
+    j.shards = malloc(n);
+    j.counts = calloc(nchunks * WELD_SHARDS, sizeof(size_t));
+    j.order = malloc(sizeof(unsigned) * n);
+
+    err = !j.shards || !j.counts || !j.order;
+    if (err) eperror(o, "malloc");
+
+    err = err || parallel_for(o, n, PARALLEL_GRAIN, weld_count, &j);
+
+    /* shard by shard, and chunk by chunk within a shard */
+    for (s = 0; s < WELD_SHARDS && !err; ++s)
+    {
+        j.first[s] = at;
+
+        for (c = 0; c < nchunks; ++c)
+        {
+            size_t count = j.counts[c * WELD_SHARDS + s];
+
+            j.counts[c * WELD_SHARDS + s] = at;
+            at += count;
+        }
+    }
+
+    j.first[WELD_SHARDS] = n;
+
+    err = err || parallel_for(o, n, PARALLEL_GRAIN, weld_scatter, &j) ||
+        parallel_for(o, WELD_SHARDS, 1, weld_shard_run, &j);
+
+    free(j.shards);
+    free(j.counts);
+    free(j.order);
+
+    return err;
+}
+
+/*
+ * appends the first item of every cluster weld_run found to an array
+ * and turns match into where every item ended up in it
+ */
+static
+int weld_keep(void const* src, weld_get_t get, size_t n, unsigned* match,
+    vec3_t** items, size_t* nitems, size_t* cap)
+{
+    size_t i;
+
+    for (i = 0; i < n; ++i)
+    {
+        vec3_t* v;
+
+        if (match[i] != i)
+        {
+            match[i] = match[match[i]];
+            continue;
+        }
+
+        v = push_back(sizeof(vec3_t), (void**)items, nitems, cap);
+        if (!v) return 1;
+
+        /* -0 and 0 are the same position */
+        get(src, i, v);
+        v->x += 0.0f;
+        v->y += 0.0f;
+        v->z += 0.0f;
+        match[i] = (unsigned)(*nitems - 1);
+    }
+
+    return 0;
+}
+
+static
+float read_f32(unsigned char const* p)
+{
+    unsigned long u = read_u32(p);
+    unsigned u32 = (unsigned)u;
+    float f;
+
+    memcpy(&f, &u32, 4);
+
+    return f;
+}
+
+/* corner i and the facet normal of triangle i of a binary stl */
+static
+void stl_corner(void const* src, size_t i, vec3_t* v)
+{
+    unsigned char const* p = (unsigned char const*)src + 84 + i / 3 * 50 +
+        12 + i % 3 * 12;
+
+    v->x = read_f32(p);
+    v->y = -read_f32(p + 4);
+    v->z = read_f32(p + 8);
+}
+
+static
+void stl_normal(void const* src, size_t i, vec3_t* n)
+{
+    unsigned char const* p = (unsigned char const*)src + 84 + i * 50;
+
+    n->x = read_f32(p);
+    n->y = read_f32(p + 4);
+    n->z = read_f32(p + 8);
+}
+
+/*
+ * binary stl: 80 byte header, u32 triangle count, then 50 bytes per
+ * triangle (facet normal, 3 corners, u16 attribute). facet normals are
+ * welded exactly so flat regions share them
+ */
+static
+int parse_stl(obj2h_t* o, char const* path, unsigned char const* data,
+    size_t size)
+{
+    size_t ntris, i;
+    unsigned* corners;
+    unsigned* normals;
+    int err = 0, c;
+
+    ntris = size >= 84 ? read_u32(data + 80) : 0;
+
+    if (size < 84 || (size - 84) / 50 < ntris)
+    {
+        eprintf(o, "%s: not a binary stl file\n", path);
+        return 1;
+    }
+
+    if (reserve(sizeof(face_t), (void**)&o->faces, o->nfaces + ntris,
+        &o->faces_cap))
+    {
+        return 1;
+    }
+
+    corners = malloc(sizeof(unsigned) * (ntris * 3 + 1));
+    normals = malloc(sizeof(unsigned) * (ntris + 1));
+
+    if (!corners || !normals)
+    {
+        eperror(o, "malloc");
+        err = 1;
+    }
+
+    /* closed meshes have about half as many vertices as triangles */
+    err = err ||
+        weld_run(o, data, stl_corner, ntris * 3, ntris / 2, o->weld_epsilon,
+            0, corners) ||
+        weld_run(o, data, stl_normal, ntris, ntris / 4, 0, 0, normals) ||
+        weld_keep(data, stl_corner, ntris * 3, corners, &o->vertices,
+            &o->nvertices, &o->vertices_cap) ||
+        weld_keep(data, stl_normal, ntris, normals, &o->normals,
+            &o->nnormals, &o->normals_cap);
+
+    for (i = 0; i < ntris && !err; ++i)
+    {
+        face_t* f = &o->faces[o->nfaces++];
+
+        for (c = 0; c < 3; ++c)
+        {
+            f->vertex_indices[c] = (int)corners[i * 3 + c];
+            f->uv_indices[c] = -1;
+            f->normal_indices[c] = (int)normals[i];
+        }
+    }
+
+    free(corners);
+    free(normals);
+
+    if (!err) {
+        eprintf(o, "weld: %zd corners -> %zd vertices\n", ntris * 3,
+            o->nvertices);
+    }
+
+    return err;
+}
+
+enum
+{
+    PLY_INT8, PLY_UINT8, PLY_INT16, PLY_UINT16, PLY_INT32, PLY_UINT32,
+    PLY_FLOAT32, PLY_FLOAT64
+};
+
+enum
+{
+    PLY_OTHER, PLY_X, PLY_Y, PLY_Z, PLY_NX, PLY_NY, PLY_NZ, PLY_U, PLY_V,
+    PLY_INDICES
+};
+
+#define PLY_MAX_PROPERTIES 32
+#define PLY_MAX_ELEMENTS 16
+
+struct ply_property { int type, count_type, role; };
+typedef struct ply_property ply_property_t;
+
+struct ply_element
+{
+    int is_vertex, is_face;
+    size_t count, nproperties;
+    ply_property_t properties[PLY_MAX_PROPERTIES];
+};
+
+typedef struct ply_element ply_element_t;
+
+static
+int ply_type(char const* s, size_t len)
+{
+    static char const* const names[] = {
+        "char", "uchar", "short", "ushort", "int", "uint", "float",
+        "double", "int8", "uint8", "int16", "uint16", "int32", "uint32",
+        "float32", "float64"
+    };
+
+    int i;
+
+    for (i = 0; i < 16; ++i)
+    {
+        if (strlen(names[i]) == len && !memcmp(names[i], s, len)) {
+            return i % 8;
+        }
+    }
+
+    return -1;
+}
+
+static
+size_t ply_type_size(int type)
+{
+    static size_t const sizes[] = { 1, 1, 2, 2, 4, 4, 4, 8 };
+    return sizes[type];
+}
+
+static
+double ply_read(unsigned char const* p, int type, int big_endian)
+{
+    unsigned long long u = 0;
+    size_t i, size = ply_type_size(type);
+    unsigned u32;
+    double d;
+    float f;
+
+    for (i = 0; i < size; ++i) {
+        u |= (unsigned long long)p[big_endian ? size - 1 - i : i] << (i * 8);
+    }
+
+    switch (type)
+    {
+    case PLY_INT8: return (signed char)u;
+    case PLY_INT16: return (short)u;
+    case PLY_INT32: return (int)(unsigned)u;
+
+    case PLY_FLOAT32:
+        u32 = (unsigned)u;
+        memcpy(&f, &u32, 4);
+        return f;
+
+    case PLY_FLOAT64:
+        memcpy(&d, &u, 8);
+        return d;
+    }
+
+    return (double)u;
+}
+
+/* returns the next header line and moves *p past it */
+static
+char const* ply_line(char const** p, char const* end, size_t* len)
+{
+    char const* line = *p;
+    char const* eol = memchr(line, '\n', (size_t)(end - line));
+
+    if (!eol) return 0;
+
+    *len = (size_t)(eol - line);
+    if (*len && line[*len - 1] == '\r') --*len;
+    *p = eol + 1;
+
+    return line;
+}
+
+/* splits a header line into at most max words */
+static
+size_t ply_words(char const* line, size_t len, char const** words,
+    size_t* lens, size_t max)
+{
+    char const* end = line + len;
+    size_t n = 0;
+
+    while (line < end && n < max)
+    {
+        while (line < end && isspace((unsigned char)*line)) ++line;
+        if (line >= end) break;
+
+        words[n] = line;
+        while (line < end && !isspace((unsigned char)*line)) ++line;
+        lens[n] = (size_t)(line - words[n]);
+        ++n;
+    }
+
+    return n;
+}
+
+static
+int ply_word(char const* word, size_t len, char const* s)
+{
+    return strlen(s) == len && !memcmp(word, s, len);
+}
+
+static
+int ply_role(char const* name, size_t len)
+{
+    static char const* const names[] = {
+        "x", "y", "z", "nx", "ny", "nz",
+        "u", "v", "s", "t", "texture_u", "texture_v"
+    };
+
+    static int const roles[] = {
+        PLY_X, PLY_Y, PLY_Z, PLY_NX, PLY_NY, PLY_NZ,
+        PLY_U, PLY_V, PLY_U, PLY_V, PLY_U, PLY_V
+    };
+
+    int i;
+
+    for (i = 0; i < 12; ++i) {
+        if (ply_word(name, len, names[i])) return roles[i];
+    }
+
+    if (ply_word(name, len, "vertex_indices") ||
+        ply_word(name, len, "vertex_index"))
+    {
+        return PLY_INDICES;
+    }
+
+    return PLY_OTHER;
+}
+
+/*
+ * binary ply (either endianness). vertex positions are welded, normals
+ * and uvs stay per input vertex since face_t indexes them separately.
+ * polygons are triangulated as fans and other elements are skipped
+ */
+static
+int parse_ply(obj2h_t* o, char const* path, unsigned char const* data,
+    size_t size)
+{
+    ply_element_t elements[PLY_MAX_ELEMENTS];
+    size_t nelements = 0;
+    char const* p;
+    char const* end;
+    unsigned char const* q;
+    size_t i, j, k;
+    int big_endian = -1;
+    vec3_t* positions = 0;
+    unsigned* match = 0;
+    size_t nply_vertices = 0, base_normals = o->nnormals, base_uvs = o->nuvs;
+    size_t first_face = o->nfaces, expected;
+    int has_normals = 0, has_uvs = 0;
+    int err = 0;
+
+    p = (char const*)data;
+    end = p + size;
+
+    if (size < 4 || memcmp(p, "ply", 3) || !isspace((unsigned char)p[3]))
+    {
+        eprintf(o, "%s: not a ply file\n", path);
+        err = 1;
+    }
+
+    while (!err)
+    {
+        char const* words[6];
+        size_t lens[6], nwords, len;
+        char const* line = ply_line(&p, end, &len);
+
+        if (!line)
+        {
+            eprintf(o, "%s: truncated header\n", path);
+            err = 1;
+            break;
+        }
+
+        nwords = ply_words(line, len, words, lens, 6);
+        if (!nwords) continue;
+
+        if (ply_word(words[0], lens[0], "end_header")) {
+            break;
+        }
+
+        if (ply_word(words[0], lens[0], "format") && nwords >= 2)
+        {
+            if (ply_word(words[1], lens[1], "binary_little_endian")) {
+                big_endian = 0;
+            } else if (ply_word(words[1], lens[1], "binary_big_endian")) {
+                big_endian = 1;
+            }
+        }
+
+        else if (ply_word(words[0], lens[0], "element") && nwords >= 3)
+        {
+            ply_element_t* e = &elements[nelements];
+
+            if (nelements >= PLY_MAX_ELEMENTS)
+            {
+                eprintf(o, "%s: too many elements\n", path);
+                err = 1;
+                break;
+            }
+
+            memset(e, 0, sizeof(*e));
+            e->is_vertex = ply_word(words[1], lens[1], "vertex");
+            e->is_face = ply_word(words[1], lens[1], "face");
+            e->count = (size_t)strtoul(words[2], 0, 10);
+            ++nelements;
+        }
+
+        else if (ply_word(words[0], lens[0], "property") && nwords >= 3 &&
+            nelements)
+        {
+            ply_element_t* e = &elements[nelements - 1];
+            ply_property_t* prop = &e->properties[e->nproperties];
+            int list = ply_word(words[1], lens[1], "list");
+
+            if (e->nproperties >= PLY_MAX_PROPERTIES ||
+                (list && nwords < 5))
+            {
+                eprintf(o, "%s: unsupported property\n", path);
+                err = 1;
+                break;
+            }
+
+            prop->count_type = list ? ply_type(words[2], lens[2]) : -1;
+            prop->type = ply_type(words[list ? 3 : 1], lens[list ? 3 : 1]);
+            prop->role = ply_role(words[list ? 4 : 2], lens[list ? 4 : 2]);
+
+            if (prop->type < 0 || (list && (prop->count_type < 0 ||
+                prop->count_type >= PLY_FLOAT32)) ||
+                (prop->role == PLY_INDICES && prop->type >= PLY_FLOAT32))
+            {
+                eprintf(o, "%s: unknown property type\n", path);
+                err = 1;
+                break;
+            }
+
+            ++e->nproperties;
+        }
+    }
+
+    if (!err && big_endian < 0)
+    {
+        eprintf(o, "%s: only binary ply files are supported\n", path);
+        err = 1;
+    }
+
+    /* first pass sizes things up so the arrays can be reserved */
+    for (i = 0; i < nelements && !err; ++i)
+    {
+        if (elements[i].is_vertex) nply_vertices += elements[i].count;
+
+        for (j = 0; j < elements[i].nproperties; ++j)
+        {
+            int role = elements[i].properties[j].role;
+
+            if (!elements[i].is_vertex) continue;
+            has_normals |= role == PLY_NX;
+            has_uvs |= role == PLY_U;
+        }
+    }
+
+    if (!err)
+    {
+        positions = malloc(sizeof(vec3_t) * (nply_vertices + 1));
+        match = malloc(sizeof(unsigned) * (nply_vertices + 1));
+
+        if (!positions || !match) eperror(o, "malloc");
+
+        err = !positions || !match ||
+            (has_normals && reserve(sizeof(vec3_t), (void**)&o->normals,
+                o->nnormals + nply_vertices, &o->normals_cap)) ||
+            (has_uvs && reserve(sizeof(uv_t), (void**)&o->uvs,
+                o->nuvs + nply_vertices, &o->uvs_cap));
+    }
+
+    q = (unsigned char const*)p;
+    expected = nply_vertices;
+    nply_vertices = 0;
+
+    for (i = 0; i < nelements && !err; ++i)
+    {
+        ply_element_t const* e = &elements[i];
+
+        for (j = 0; j < e->count && !err; ++j)
+        {
+            vec3_t v = { 0, 0, 0 }, n = { 0, 0, 0 };
+            uv_t uv = { 0, 0 };
+
+            for (k = 0; k < e->nproperties && !err; ++k)
+            {
+                ply_property_t const* prop = &e->properties[k];
+                size_t s = ply_type_size(prop->type);
+                size_t count = 1, c;
+                double x;
+
+                if (prop->count_type >= 0)
+                {
+                    size_t cs = ply_type_size(prop->count_type);
+
+                    if ((size_t)((unsigned char const*)end - q) < cs)
+                    {
+                        eprintf(o, "%s: truncated data\n", path);
+                        err = 1;
+                        break;
+                    }
+
+                    count = (size_t)ply_read(q, prop->count_type,
+                        big_endian);
+                    q += cs;
+                }
+
+                if ((size_t)((unsigned char const*)end - q) / s < count)
+                {
+                    eprintf(o, "%s: truncated data\n", path);
+                    err = 1;
+                    break;
+                }
+
+                if (prop->role == PLY_INDICES && e->is_face)
+                {
+                    long first = 0, prev = 0;
+
+                    for (c = 0; c < count; ++c)
+                    {
+                        long vi = (long)ply_read(q + c * s, prop->type,
+                            big_endian);
+
+                        if (vi < 0 || (size_t)vi >= nply_vertices)
+                        {
+                            eprintf(o, "%s: vertex index out of "
+                                "range\n", path);
+                            err = 1;
+                            break;
+                        }
+
+                        /* fan out from the first corner */
+                        if (c >= 2)
+                        {
+                            face_t* f = push_back(sizeof(face_t),
+                                (void**)&o->faces, &o->nfaces, &o->faces_cap);
+                            long corners[3];
+                            int m;
+
+                            if (!f) {
+                                err = 1;
+                                break;
+                            }
+
+                            corners[0] = first;
+                            corners[1] = prev;
+                            corners[2] = vi;
+
+                            /* welded once all the vertices are in */
+                            for (m = 0; m < 3; ++m)
+                            {
+                                f->vertex_indices[m] = (int)corners[m];
+                                f->uv_indices[m] = has_uvs ?
+                                    (int)(base_uvs + corners[m]) : -1;
+                                f->normal_indices[m] = has_normals ?
+                                    (int)(base_normals + corners[m]) : -1;
+                            }
+                        }
+
+                        if (!c) first = vi;
+                        prev = vi;
+                    }
+                }
+
+                else if (e->is_vertex && count == 1)
+                {
+                    x = ply_read(q, prop->type, big_endian);
+
+                    switch (prop->role)
+                    {
+                    case PLY_X: v.x = (float)x; break;
+                    case PLY_Y: v.y = -(float)x; break;
+                    case PLY_Z: v.z = (float)x; break;
+                    case PLY_NX: n.x = (float)x; break;
+                    case PLY_NY: n.y = (float)x; break;
+                    case PLY_NZ: n.z = (float)x; break;
+                    case PLY_U: uv.u = (float)x; break;
+                    case PLY_V: uv.v = (float)x; break;
+                    }
+                }
+
+                q += count * s;
+            }
+
+            if (!e->is_vertex || err) continue;
+
+            /* all three were reserved up front */
+            positions[nply_vertices++] = v;
+            if (has_normals) o->normals[o->nnormals++] = n;
+            if (has_uvs) o->uvs[o->nuvs++] = uv;
+        }
+    }
+
+    err = err ||
+        weld_run(o, positions, vec3_item, nply_vertices, expected,
+            o->weld_epsilon, 0, match) ||
+        weld_keep(positions, vec3_item, nply_vertices, match, &o->vertices,
+            &o->nvertices, &o->vertices_cap);
+
+    if (!err)
+    {
+        for (i = first_face; i < o->nfaces; ++i)
+        {
+            for (k = 0; k < 3; ++k)
+            {
+                int* vi = &o->faces[i].vertex_indices[k];
+                *vi = (int)match[*vi];
+            }
+        }
+
+        eprintf(o, "weld: %zd vertices -> %zd\n", nply_vertices,
+            o->nvertices);
+    }
+
+    free(positions);
+    free(match);
+
+    return err;
+}
+
+/* spatial sorting ----------------------------------------------------- */
+
+/*
+ * 30-bit morton code, 10 bits per axis. spreads the bits of each
+ * coordinate so they are interleaved as zyxzyxzyx...
+ */
+static
+unsigned morton_spread(unsigned x)
+{
+    x &= 0x3FF;
+    x = (x | (x << 16)) & 0x030000FF;
+    x = (x | (x <<  8)) & 0x0300F00F;
+    x = (x | (x <<  4)) & 0x030C30C3;
+    x = (x | (x <<  2)) & 0x09249249;
+    return x;
+}
+
+static
+float morton_quantize(float x, float min, float extent)
+{
+    x = extent > 0 ? (x - min) / extent * 1023.0f + 0.5f : 0;
+    return x < 0 ? 0 : x > 1023 ? 1023 : x;
+}
+
+static
+unsigned morton_code(vec3_t const* p, vec3_t const* min,
+    vec3_t const* extent)
+{
+    unsigned x, y, z;
+
+    x = (unsigned)morton_quantize(p->x, min->x, extent->x);
+    y = (unsigned)morton_quantize(p->y, min->y, extent->y);
+    z = (unsigned)morton_quantize(p->z, min->z, extent->z);
+
+    return morton_spread(x) | (morton_spread(y) << 1) |
+        (morton_spread(z) << 2);
+}
+
+struct sort_key { unsigned key, index; };
+typedef struct sort_key sort_key_t;
+
+/* ties are broken by original index so the output is deterministic */
+static
+int sort_key_cmp(void const* a, void const* b)
+{
+    sort_key_t const* ka = a;
+    sort_key_t const* kb = b;
+
+    if (ka->key != kb->key) return ka->key < kb->key ? -1 : 1;
+    if (ka->index != kb->index) return ka->index < kb->index ? -1 : 1;
+    return 0;
+}
+
+struct bounds_job
+{
+    vec3_t const* v;
+    vec3_t* min; /* of every chunk */
+    vec3_t* max;
+    vec3_t center;
+    float* radius;
+};
+
+typedef struct bounds_job bounds_job_t;
+
+/*
+ * a chunk starts from its first vertex like the whole array starts from
+ * v[0]. a nan in there would stick, which only v[0]'s should, so past
+ * chunk 0 the next value replaces it
+ */
+static
+int bounds_chunk(void* ctx, size_t first, size_t last)
+{
+    bounds_job_t* j = ctx;
+    float* lo = &j->min[first / PARALLEL_GRAIN].x;
+    float* hi = &j->max[first / PARALLEL_GRAIN].x;
+    size_t i;
+    int k;
+
+    memcpy(lo, &j->v[first], sizeof(vec3_t));
+    memcpy(hi, &j->v[first], sizeof(vec3_t));
+
+    for (i = first + 1; i < last; ++i)
+    {
+        float const* p = &j->v[i].x;
+
+        for (k = 0; k < 3; ++k)
+        {
+            if (p[k] < lo[k] || (first && lo[k] != lo[k])) lo[k] = p[k];
+            if (p[k] > hi[k] || (first && hi[k] != hi[k])) hi[k] = p[k];
+        }
+    }
+
+    return 0;
+}
+
+static
+void bounds(obj2h_t* o, vec3_t const* v, size_t n, vec3_t* min,
+    vec3_t* max)
+{
+    size_t nchunks = (n + PARALLEL_GRAIN - 1) / PARALLEL_GRAIN, c;
+    bounds_job_t j;
+    int k;
+
+    if (!n)
+    {
+        min->x = min->y = min->z = 0;
+        *max = *min;
+        return;
+    }
+
+    j.v = v;
+    j.min = nchunks > 1 ? malloc(sizeof(vec3_t) * nchunks * 2) : 0;
+
+    /* one chunk, or no room for more */
+    if (!j.min)
+    {
+        j.min = min;
+        j.max = max;
+        bounds_chunk(&j, 0, n);
+        return;
+    }
+
+    j.max = j.min + nchunks;
+
+    parallel_for(o, n, PARALLEL_GRAIN, bounds_chunk, &j);
+
+    *min = j.min[0];
+    *max = j.max[0];
+
+    for (c = 1; c < nchunks; ++c)
+    {
+        float const* lo = &j.min[c].x;
+        float const* hi = &j.max[c].x;
+
+        for (k = 0; k < 3; ++k)
+        {
+            if (lo[k] < (&min->x)[k]) (&min->x)[k] = lo[k];
+            if (hi[k] > (&max->x)[k]) (&max->x)[k] = hi[k];
+        }
+    }
+
+    free(j.min);
+}
+
+static
+int sphere_chunk(void* ctx, size_t first, size_t last)
+{
+    bounds_job_t* j = ctx;
+    float* radius = &j->radius[first / PARALLEL_GRAIN];
+    size_t i;
+
+    *radius = 0;
+
+    for (i = first; i < last; ++i)
+    {
+        float dx = j->v[i].x - j->center.x;
+        float dy = j->v[i].y - j->center.y;
+        float dz = j->v[i].z - j->center.z;
+
+        *radius = fmaxf(*radius, sqrtf(dx * dx + dy * dy + dz * dz));
+    }
+
+    return 0;
+}
+
+/* sphere around the center of the bounding box */
+static
+float bounding_sphere(obj2h_t* o, vec3_t const* v, size_t n,
+    vec3_t* center)
+{
+    size_t nchunks = (n + PARALLEL_GRAIN - 1) / PARALLEL_GRAIN, c;
+    vec3_t min, max;
+    bounds_job_t j;
+    float radius = 0;
+
+    bounds(o, v, n, &min, &max);
+
+    center->x = (min.x + max.x) / 2;
+    center->y = (min.y + max.y) / 2;
+    center->z = (min.z + max.z) / 2;
+
+    j.v = v;
+    j.center = *center;
+    j.radius = nchunks > 1 ? malloc(sizeof(float) * nchunks) : 0;
+
+    if (!j.radius)
+    {
+        j.radius = &radius;
+        if (n) sphere_chunk(&j, 0, n);
+        return radius;
+    }
+
+    /* fmaxf doesn't care about the order */
+    parallel_for(o, n, PARALLEL_GRAIN, sphere_chunk, &j);
+
+    for (c = 0; c < nchunks; ++c) {
+        radius = fmaxf(radius, j.radius[c]);
+    }
+
+    free(j.radius);
+
+    return radius;
+}
+
+struct morton_job
+{
+    obj2h_t* o;
+    vec3_t min, extent;
+    sort_key_t* keys;
+    size_t const* remap;
+};
+
+typedef struct morton_job morton_job_t;
+
+static
+int morton_vertex_keys(void* ctx, size_t first, size_t last)
+{
+    morton_job_t* j = ctx;
+    size_t i;
+
+    for (i = first; i < last; ++i)
+    {
+        j->keys[i].key = morton_code(&j->o->vertices[i], &j->min,
+            &j->extent);
+        j->keys[i].index = (unsigned)i;
+    }
+
+    return 0;
+}
+
+/* remaps the faces and keys them by their centroid */
+static
+int morton_face_keys(void* ctx, size_t first, size_t last)
+{
+    morton_job_t* j = ctx;
+    obj2h_t* o = j->o;
+    size_t i, k;
+
+    for (i = first; i < last; ++i)
+    {
+        face_t* f = &o->faces[i];
+        vec3_t c = { 0, 0, 0 };
+
+        for (k = 0; k < 3; ++k)
+        {
+            int vi = f->vertex_indices[k];
+
+            if (vi < 0 || (size_t)vi >= o->nvertices) continue;
+            f->vertex_indices[k] = (int)j->remap[vi];
+            c.x += o->vertices[vi].x / 3;
+            c.y += o->vertices[vi].y / 3;
+            c.z += o->vertices[vi].z / 3;
+        }
+
+        j->keys[i].key = morton_code(&c, &j->min, &j->extent);
+        j->keys[i].index = (unsigned)i;
+    }
+
+    return 0;
+}
+
+/*
+ * reorders vertices by the morton code of their position and faces by
+ * the morton code of their centroid. face vertex indices are remapped
+ * to the new vertex order. normals and uvs are left untouched since
+ * they are indexed separately
+ */
+static
+int morton_sort(obj2h_t* o)
+{
+    vec3_t max;
+    morton_job_t j;
+    sort_key_t* keys;
+    size_t* remap;
+    vec3_t* sorted_vertices;
+    face_t* sorted_faces;
+    size_t i;
+
+    bounds(o, o->vertices, o->nvertices, &j.min, &max);
+    j.extent.x = max.x - j.min.x;
+    j.extent.y = max.y - j.min.y;
+    j.extent.z = max.z - j.min.z;
+
+    keys = malloc(sizeof(sort_key_t) *
+        (o->nvertices > o->nfaces ? o->nvertices : o->nfaces));
+    remap = malloc(sizeof(size_t) * o->nvertices);
+    sorted_vertices = malloc(sizeof(vec3_t) * o->nvertices);
+    sorted_faces = malloc(sizeof(face_t) * o->nfaces);
+
+    if ((!keys || !remap || !sorted_vertices || !sorted_faces) &&
+        (o->nvertices || o->nfaces))
+    {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    j.o = o;
+    j.keys = keys;
+    j.remap = remap;
+
+    parallel_for(o, o->nvertices, PARALLEL_GRAIN, morton_vertex_keys, &j);
+
+    if (parallel_sort(o, keys, o->nvertices, sizeof(sort_key_t),
+        sort_key_cmp))
+    {
+        return 1;
+    }
+
+    for (i = 0; i < o->nvertices; ++i)
+    {
+        sorted_vertices[i] = o->vertices[keys[i].index];
+        remap[keys[i].index] = i;
+    }
+
+    if (attributes_permute(o, 0, remap, o->nvertices)) return 1;
+
+    parallel_for(o, o->nfaces, PARALLEL_GRAIN, morton_face_keys, &j);
+
+    if (parallel_sort(o, keys, o->nfaces, sizeof(sort_key_t), sort_key_cmp))
+    {
+        return 1;
+    }
+
+    for (i = 0; i < o->nfaces; ++i) {
+        sorted_faces[i] = o->faces[keys[i].index];
+    }
+
+    free(o->vertices);
+    free(o->faces);
+    o->vertices = sorted_vertices;
+    o->vertices_cap = o->nvertices;
+    o->faces = sorted_faces;
+    o->faces_cap = o->nfaces;
+    free(remap);
+    free(keys);
+
+    return 0;
+}
+
+/* binary outputs are always little endian regardless of the host */
+static
+int buf_u32(buf_t* b, unsigned long x)
+{
+    unsigned char le[4];
+
+    le[0] = (unsigned char)(x & 0xFF);
+    le[1] = (unsigned char)((x >> 8) & 0xFF);
+    le[2] = (unsigned char)((x >> 16) & 0xFF);
+    le[3] = (unsigned char)((x >> 24) & 0xFF);
+
+    return buf_put(b, le, 4);
+}
+
+static
+int buf_u16(buf_t* b, unsigned x)
+{
+    unsigned char le[2];
+
+    le[0] = (unsigned char)(x & 0xFF);
+    le[1] = (unsigned char)((x >> 8) & 0xFF);
+
+    return buf_put(b, le, 2);
+}
+
+static
+int buf_f32(buf_t* b, float x)
+{
+    unsigned int u;
+
+    memcpy(&u, &x, 4);
+
+    return buf_u32(b, u);
+}
+
+static
+int buf_align(buf_t* b, size_t alignment)
+{
+    size_t pad = (alignment - b->size % alignment) % alignment;
+    return buf_put(b, 0, pad);
+}
+
+/* overwrites a previously written u32 at offset */
+static
+void buf_patch_u32(buf_t* b, size_t offset, unsigned long x)
+{
+    size_t size = b->size;
+
+    b->size = offset;
+    buf_u32(b, x);
+    b->size = size;
+}
+
+/*
+ * builds a relocatable blob, see obj2h_blob.h for the format.
+ * the section table is written first with zero offsets and patched as
+ * the arrays are appended
+ */
+static
+int build_blob_arrays(buf_t* b, vec3_t const* vertices, size_t nvertices,
+    vec3_t const* normals, size_t nnormals, uv_t const* uvs, size_t nuvs,
+    face_t const* faces, size_t nfaces, unsigned long const* colors,
+    size_t ncolors)
+{
+    static unsigned const types[] = {
+        OBJ2H_BLOB_VERTICES, OBJ2H_BLOB_NORMALS,
+        OBJ2H_BLOB_UVS, OBJ2H_BLOB_FACES, OBJ2H_BLOB_COLORS
+    };
+
+    size_t const counts[] = { nvertices, nnormals, nuvs, nfaces, ncolors };
+    size_t const strides[] = { 16, 16, 8, 36, 4 };
+    size_t nsections = ncolors ? 5 : 4;
+    size_t base = b->size; /* blobs can follow each other in b */
+    size_t table;
+    size_t i, j, k;
+    int err = 0;
+
+    err |= buf_put(b, OBJ2H_BLOB_MAGIC, 4);
+    err |= buf_u16(b, OBJ2H_BLOB_VERSION_MAJOR);
+    err |= buf_u16(b, OBJ2H_BLOB_VERSION_MINOR);
+    err |= buf_u32(b, 0); /* size, patched at the end */
+    err |= buf_u32(b, nsections);
+    err |= buf_u32(b, 0);
+    err |= buf_put(b, 0, 12);
+
+    table = b->size;
+
+    for (i = 0; i < nsections; ++i)
+    {
+        err |= buf_u32(b, types[i]);
+        err |= buf_u32(b, 0);
+        err |= buf_u32(b, counts[i]);
+        err |= buf_u32(b, strides[i]);
+    }
+
+    for (i = 0; i < nsections && !err; ++i)
+    {
+        err |= buf_align(b, OBJ2H_BLOB_ALIGN);
+        buf_patch_u32(b, table + i * 16 + 4, b->size - base);
+
+        for (j = 0; j < counts[i]; ++j)
+        {
+            switch (types[i])
+            {
+            case OBJ2H_BLOB_VERTICES:
+                err |= buf_f32(b, vertices[j].x);
+                err |= buf_f32(b, vertices[j].y);
+                err |= buf_f32(b, vertices[j].z);
+                err |= buf_f32(b, 1);
+                break;
+
+            case OBJ2H_BLOB_NORMALS:
+                err |= buf_f32(b, normals[j].x);
+                err |= buf_f32(b, normals[j].y);
+                err |= buf_f32(b, normals[j].z);
+                err |= buf_f32(b, 0);
+                break;
+
+            case OBJ2H_BLOB_UVS:
+                err |= buf_f32(b, uvs[j].u);
+                err |= buf_f32(b, uvs[j].v);
+                break;
+
+            case OBJ2H_BLOB_FACES:
+                for (k = 0; k < 3; ++k) {
+                    err |= buf_u32(b, (unsigned)faces[j].vertex_indices[k]);
+                }
+                for (k = 0; k < 3; ++k) {
+                    err |= buf_u32(b, (unsigned)faces[j].uv_indices[k]);
+                }
+                for (k = 0; k < 3; ++k) {
+                    err |= buf_u32(b, (unsigned)faces[j].normal_indices[k]);
+                }
+                break;
+
+            case OBJ2H_BLOB_COLORS:
+                err |= buf_u32(b, colors[j]);
+                break;
+            }
+        }
+    }
+
+    err |= buf_align(b, OBJ2H_BLOB_ALIGN);
+    if (!err) buf_patch_u32(b, base + 8, b->size - base);
+
+    return err;
+}
+
+static
+int build_blob(obj2h_t* o, buf_t* b)
+{
+    return build_blob_arrays(b, o->vertices, o->nvertices, o->normals,
+        o->nnormals, o->uvs, o->nuvs, o->faces, o->nfaces, o->vertex_colors,
+        o->nvertex_colors);
+}
+
+static
+int write_blob(obj2h_t* o)
+{
+    buf_t b = { 0, 0, 0 };
+
+    if (build_blob(o, &b)) return 1;
+
+    owrite(o, b.data, b.size);
+    free(b.data);
+
+    return 0;
+}
+
+/* compressed blobs ---------------------------------------------------- */
+
+#define ZBLOB_BLOCK_COUNT 1024
+#define LZ_HASH_BITS 12
+
+static
+unsigned zigzag(int x)
+{
+    return ((unsigned)x << 1) ^ (unsigned)(x >> 31);
+}
+
+static
+int buf_u8(buf_t* b, unsigned x)
+{
+    unsigned char c = (unsigned char)x;
+    return buf_put(b, &c, 1);
+}
+
+static
+int buf_varint(buf_t* b, unsigned x)
+{
+    int err = 0;
+
+    while (x >= 0x80)
+    {
+        err |= buf_u8(b, (x & 0x7F) | 0x80);
+        x >>= 7;
+    }
+
+    return err | buf_u8(b, x);
+}
+
+static
+int lz_put_length(buf_t* b, size_t x)
+{
+    int err = 0;
+
+    for (; x >= 255; x -= 255) err |= buf_u8(b, 255);
+
+    return err | buf_u8(b, (unsigned)x);
+}
+
+static
+int lz_put_sequence(buf_t* b, unsigned char const* lit, size_t nlit,
+    size_t off, size_t len)
+{
+    unsigned token;
+    int err = 0;
+
+    token = (nlit < 15 ? (unsigned)nlit : 15) << 4;
+    if (len) {
+        len -= OBJ2H_LZ_MIN_MATCH;
+        token |= len < 15 ? (unsigned)len : 15;
+    }
+
+    err |= buf_u8(b, token);
+    if (nlit >= 15) err |= lz_put_length(b, nlit - 15);
+    err |= buf_put(b, lit, nlit);
+
+    if (off)
+    {
+        err |= buf_u16(b, (unsigned)off);
+        if (len >= 15) err |= lz_put_length(b, len - 15);
+    }
+
+    return err;
+}
+
+static
+unsigned lz_hash(unsigned char const* p)
+{
+    unsigned x = p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned)p[3] << 24);
+    return (x * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+/*
+ * greedy lz77 with a single entry hash table, see obj2h_lz_decode for
+ * the format. favors decode speed over ratio
+ */
+static
+int lz_encode(unsigned char const* src, size_t size, buf_t* b)
+{
+    size_t table[1 << LZ_HASH_BITS];
+    size_t i = 0, anchor = 0;
+    int err = 0;
+
+    memset(table, 0xFF, sizeof(table));
+
+    while (i + OBJ2H_LZ_MIN_MATCH <= size)
+    {
+        unsigned h = lz_hash(src + i);
+        size_t cand = table[h];
+        size_t len = 0;
+
+        table[h] = i;
+
+        if (cand != (size_t)-1 && i - cand <= 0xFFFF &&
+            !memcmp(src + cand, src + i, OBJ2H_LZ_MIN_MATCH))
+        {
+            len = OBJ2H_LZ_MIN_MATCH;
+            while (i + len < size && src[cand + len] == src[i + len]) ++len;
+        }
+
+        if (!len) {
+            ++i;
+            continue;
+        }
+
+        err |= lz_put_sequence(b, src + anchor, i - anchor, i - cand, len);
+        i += len;
+        anchor = i;
+    }
+
+    /* the last sequence is always literals only, possibly empty */
+    return err | lz_put_sequence(b, src + anchor, size - anchor, 0, 0);
+}
+
+/* quantization ranges for a section, see obj2h_zblob_section_t */
+static
+void zblob_ranges(obj2h_t* o, unsigned type, obj2h_zblob_section_t* s)
+{
+    vec3_t min, max;
+    size_t i;
+
+    memset(s->bias, 0, sizeof(s->bias));
+    memset(s->scale, 0, sizeof(s->scale));
+
+    switch (type)
+    {
+    case OBJ2H_BLOB_VERTICES:
+        bounds(o, o->vertices, o->nvertices, &min, &max);
+        break;
+
+    case OBJ2H_BLOB_UVS:
+        min.x = max.x = o->nuvs ? o->uvs[0].u : 0;
+        min.y = max.y = o->nuvs ? o->uvs[0].v : 0;
+        min.z = max.z = 0;
+
+        for (i = 1; i < o->nuvs; ++i)
+        {
+            if (o->uvs[i].u < min.x) min.x = o->uvs[i].u;
+            if (o->uvs[i].v < min.y) min.y = o->uvs[i].v;
+            if (o->uvs[i].u > max.x) max.x = o->uvs[i].u;
+            if (o->uvs[i].v > max.y) max.y = o->uvs[i].v;
+        }
+        break;
+
+    default:
+        return;
+    }
+
+    s->bias[0] = min.x;
+    s->bias[1] = min.y;
+    s->bias[2] = min.z;
+    s->scale[0] = (max.x - min.x) / 65535;
+    s->scale[1] = (max.y - min.y) / 65535;
+    s->scale[2] = (max.z - min.z) / 65535;
+}
+
+static
+unsigned quantize16(float x, float bias, float scale)
+{
+    float q = scale > 0 ? (x - bias) / scale + 0.5f : 0;
+    return q < 0 ? 0 : q > 65535 ? 65535 : (unsigned)q;
+}
+
+static
+unsigned quantize_snorm8(float x)
+{
+    float q = x * 127;
+    q += q < 0 ? -0.5f : 0.5f;
+    q = q < -127 ? -127 : q > 127 ? 127 : q;
+    return (unsigned)(int)q & 0xFF;
+}
+
+/* 16-bit components as a plane of low bytes and a plane of high bytes */
+static
+int zblob_pack16(buf_t* raw, unsigned const* q, size_t n)
+{
+    unsigned prev = 0;
+    size_t i;
+    int err = 0;
+
+    for (i = 0; i < n; ++i)
+    {
+        unsigned d = zigzag((short)(q[i] - prev)) & 0xFFFF;
+        err |= buf_u8(raw, d & 0xFF);
+        prev = q[i];
+    }
+
+    prev = 0;
+
+    for (i = 0; i < n; ++i)
+    {
+        unsigned d = zigzag((short)(q[i] - prev)) & 0xFFFF;
+        err |= buf_u8(raw, d >> 8);
+        prev = q[i];
+    }
+
+    return err;
+}
+
+/* builds the pre-lz contents of one block, see obj2h_zblob.h */
+static
+int zblob_raw_block(obj2h_t* o, obj2h_zblob_section_t const* s,
+    size_t first, size_t n, buf_t* raw)
+{
+    unsigned q[ZBLOB_BLOCK_COUNT];
+    size_t i, j;
+    int err = 0;
+
+    switch (s->type)
+    {
+    case OBJ2H_BLOB_VERTICES:
+        for (j = 0; j < 3; ++j)
+        {
+            for (i = 0; i < n; ++i)
+            {
+                float const* p = &o->vertices[first + i].x;
+                q[i] = quantize16(p[j], s->bias[j], s->scale[j]);
+            }
+
+            err |= zblob_pack16(raw, q, n);
+        }
+        break;
+
+    case OBJ2H_BLOB_UVS:
+        for (j = 0; j < 2; ++j)
+        {
+            for (i = 0; i < n; ++i)
+            {
+                float const* p = &o->uvs[first + i].u;
+                q[i] = quantize16(p[j], s->bias[j], s->scale[j]);
+            }
+
+            err |= zblob_pack16(raw, q, n);
+        }
+        break;
+
+    case OBJ2H_BLOB_NORMALS:
+        for (j = 0; j < 3; ++j)
+        {
+            unsigned prev = 0;
+
+            for (i = 0; i < n; ++i)
+            {
+                float const* p = &o->normals[first + i].x;
+                unsigned x = quantize_snorm8(p[j]);
+                err |= buf_u8(raw, zigzag((signed char)(x - prev)) & 0xFF);
+                prev = x;
+            }
+        }
+        break;
+
+    case OBJ2H_BLOB_COLORS:
+        for (j = 0; j < 4; ++j)
+        {
+            unsigned prev = 0;
+
+            for (i = 0; i < n; ++i)
+            {
+                unsigned x = (o->vertex_colors[first + i] >> (j * 8)) & 0xFF;
+                err |= buf_u8(raw, zigzag((signed char)(x - prev)) & 0xFF);
+                prev = x;
+            }
+        }
+        break;
+
+    case OBJ2H_BLOB_FACES:
+    {
+        int prev[3] = { 0, 0, 0 };
+
+        for (i = 0; i < n; ++i)
+        {
+            int const* p = o->faces[first + i].vertex_indices;
+
+            /* vertex, uv and normal indices are laid out contiguously */
+            for (j = 0; j < 9; ++j)
+            {
+                int x = p[j] + 1;
+                err |= buf_varint(raw, zigzag(x - prev[j / 3]));
+                prev[j / 3] = x;
+            }
+        }
+        break;
+    }
+    }
+
+    return err;
+}
+
+static
+int build_zblob(obj2h_t* o, buf_t* b)
+{
+    static unsigned const types[] = {
+        OBJ2H_BLOB_VERTICES, OBJ2H_BLOB_NORMALS,
+        OBJ2H_BLOB_UVS, OBJ2H_BLOB_FACES, OBJ2H_BLOB_COLORS
+    };
+
+    size_t const counts[] = {
+        o->nvertices, o->nnormals, o->nuvs, o->nfaces, o->nvertex_colors
+    };
+
+    /* colors only when there are some, like in plain blobs */
+    size_t nsections = o->nvertex_colors ? 5 : 4;
+    obj2h_zblob_section_t sections[5];
+    size_t max_raw = 0, max_packed = 0;
+    buf_t raw = { 0, 0, 0 };
+    buf_t packed = { 0, 0, 0 };
+    buf_t const* out;
+    size_t i, j, k;
+    int err = 0;
+
+    err |= buf_put(b, OBJ2H_ZBLOB_MAGIC, 4);
+    err |= buf_u16(b, OBJ2H_ZBLOB_VERSION_MAJOR);
+    err |= buf_u16(b, OBJ2H_ZBLOB_VERSION_MINOR);
+    err |= buf_u32(b, 0); /* size, patched at the end */
+    err |= buf_u32(b, nsections);
+    err |= buf_u32(b, 0); /* max_raw_block, patched */
+    err |= buf_u32(b, 0); /* max_packed_block, patched */
+    err |= buf_u32(b, (o->nvertices + o->nnormals) * 16 + o->nuvs * 8 +
+        o->nfaces * 36 + o->nvertex_colors * 4);
+    err |= buf_u32(b, 0);
+
+    for (i = 0; i < nsections; ++i)
+    {
+        obj2h_zblob_section_t* s = &sections[i];
+
+        s->type = types[i];
+        s->count = counts[i];
+        s->block_count = ZBLOB_BLOCK_COUNT;
+        zblob_ranges(o, types[i], s);
+
+        err |= buf_u32(b, s->type);
+        err |= buf_u32(b, s->count);
+        err |= buf_u32(b, s->block_count);
+        err |= buf_u32(b, 0);
+        for (k = 0; k < 3; ++k) err |= buf_f32(b, s->bias[k]);
+        for (k = 0; k < 3; ++k) err |= buf_f32(b, s->scale[k]);
+    }
+
+    for (i = 0; i < nsections && !err; ++i)
+    {
+        obj2h_zblob_section_t* s = &sections[i];
+
+        for (j = 0; j < s->count && !err; j += s->block_count)
+        {
+            size_t n = s->count - j;
+            int stored;
+
+            if (n > s->block_count) n = s->block_count;
+
+            raw.size = packed.size = 0;
+            err |= zblob_raw_block(o, s, j, n, &raw);
+            err |= lz_encode(raw.data, raw.size, &packed);
+
+            stored = packed.size >= raw.size;
+            out = stored ? &raw : &packed;
+
+            err |= buf_u32(b, out->size | (stored ? OBJ2H_ZBLOB_STORED : 0));
+            err |= buf_u32(b, raw.size);
+            err |= buf_put(b, out->data, out->size);
+
+            if (raw.size > max_raw) max_raw = raw.size;
+            if (out->size > max_packed) max_packed = out->size;
+        }
+    }
+
+    free(raw.data);
+    free(packed.data);
+
+    if (!err)
+    {
+        buf_patch_u32(b, 8, b->size);
+        buf_patch_u32(b, 16, max_raw);
+        buf_patch_u32(b, 20, max_packed);
+    }
+
+    return err;
+}
+
+static
+double now()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/*
+ * decodes the compressed blob in memory for about a second and reports
+ * compression ratio against the uncompressed blob and decode speed
+ */
+static
+int bench_zblob(obj2h_t* o, buf_t const* z)
+{
+    buf_t blob = { 0, 0, 0 };
+    obj2h_mesh_t m;
+    double start, elapsed;
+    size_t raw_size, iterations = 0;
+    float maxerr = 0;
+    size_t i;
+
+    if (build_blob(o, &blob)) return 1;
+
+    if (obj2h_zblob_decode_mem(z->data, z->size, &m)) {
+        eprintf(o, "zblob: failed to decode\n");
+        return 1;
+    }
+
+    for (i = 0; i < m.nvertices; ++i)
+    {
+        float d[3];
+        size_t j;
+
+        d[0] = m.vertices[i].x - o->vertices[i].x;
+        d[1] = m.vertices[i].y - o->vertices[i].y;
+        d[2] = m.vertices[i].z - o->vertices[i].z;
+
+        for (j = 0; j < 3; ++j)
+        {
+            if (d[j] < 0) d[j] = -d[j];
+            if (d[j] > maxerr) maxerr = d[j];
+        }
+    }
+
+    if (m.nfaces != o->nfaces ||
+        memcmp(m.faces, o->faces, sizeof(face_t) * o->nfaces))
+    {
+        eprintf(o, "zblob: faces don't round trip\n");
+        return 1;
+    }
+
+    for (i = 0; i < o->nvertex_colors; ++i)
+    {
+        if (m.ncolors != o->nvertex_colors ||
+            m.colors[i] != (o->vertex_colors[i] & 0xFFFFFFFF))
+        {
+            eprintf(o, "zblob: colors don't round trip\n");
+            return 1;
+        }
+    }
+
+    obj2h_zblob_free(&m);
+
+    raw_size = (o->nvertices + o->nnormals) * sizeof(vector_t) +
+        o->nuvs * sizeof(uv_t) + o->nfaces * sizeof(face_t) +
+        o->nvertex_colors * sizeof(uint32_t);
+
+    start = now();
+
+    do {
+        obj2h_zblob_decode_mem(z->data, z->size, &m);
+        obj2h_zblob_free(&m);
+        ++iterations;
+        elapsed = now() - start;
+    } while (elapsed < 1);
+
+    eprintf(o, "zblob: %zd -> %zd bytes (%.2fx vs blob, %.2fx vs "
+        "arrays)\n", blob.size, z->size, (double)blob.size / z->size,
+        (double)raw_size / z->size);
+    eprintf(o, "zblob: max position error %g\n", maxerr);
+    eprintf(o, "zblob: decode %.1f MB/s (%zd iterations)\n",
+        raw_size * iterations / elapsed / 1e6, iterations);
+
+    free(blob.data);
+
+    return 0;
+}
+
+static
+int write_zblob(obj2h_t* o)
+{
+    buf_t b = { 0, 0, 0 };
+
+    if (build_zblob(o, &b)) return 1;
+    if (o->opt_bench && bench_zblob(o, &b)) return 1;
+
+    owrite(o, b.data, b.size);
+    free(b.data);
+
+    return 0;
+}
+
+/* vertex cache optimization ------------------------------------------- */
+
+#define CACHE_SIZE 16
+
+/*
+ * tipsify (sander, nehab, barczak 2007). fans around a vertex, then
+ * picks the next fanning vertex among the ones just emitted that are
+ * most likely to still be in a fifo cache of CACHE_SIZE entries.
+ *
+ * the pvr has no post-transform cache since vertices are transformed
+ * up front on the sh4, but the order makes the index codec's fifos hit
+ * and keeps the draw loop's reads of tbuf local
+ */
+static
+int optimize_cache(obj2h_t* o)
+{
+    size_t* offsets; /* triangles around vertex v: tris[offsets[v]..] */
+    size_t* tris;
+    int* live;
+    size_t* cache_time;
+    int* dead_end;
+    size_t ndead_end = 0;
+    int* candidates;
+    size_t ncandidates;
+    char* emitted;
+    face_t* sorted;
+    size_t nsorted = 0;
+    size_t time = CACHE_SIZE + 1;
+    size_t cursor = 0;
+    size_t i, j;
+    int fan = 0;
+
+    offsets = calloc(o->nvertices + 1, sizeof(size_t));
+    tris = malloc(sizeof(size_t) * (o->nfaces * 3 + 1));
+    live = calloc(o->nvertices + 1, sizeof(int));
+    cache_time = calloc(o->nvertices + 1, sizeof(size_t));
+    dead_end = malloc(sizeof(int) * (o->nfaces * 3 + 1));
+    candidates = malloc(sizeof(int) * (o->nfaces * 3 + 1));
+    emitted = calloc(o->nfaces + 1, 1);
+    sorted = malloc(sizeof(face_t) * (o->nfaces + 1));
+
+    if (!offsets || !tris || !live || !cache_time || !dead_end ||
+        !candidates || !emitted || !sorted)
+    {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        for (j = 0; j < 3; ++j)
+        {
+            int v = o->faces[i].vertex_indices[j];
+
+            if (v < 0 || (size_t)v >= o->nvertices) {
+                eprintf(o, "cache: face %zd has a bad vertex\n", i);
+                return 1;
+            }
+
+            ++live[v];
+        }
+    }
+
+    for (i = 0; i < o->nvertices; ++i) offsets[i + 1] = offsets[i] + live[i];
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        for (j = 0; j < 3; ++j)
+        {
+            int v = o->faces[i].vertex_indices[j];
+            tris[offsets[v] + --live[v]] = i;
+        }
+    }
+
+    for (i = 0; i < o->nvertices; ++i) {
+        live[i] = (int)(offsets[i + 1] - offsets[i]);
+    }
+
+    if (!o->nvertices) fan = -1;
+
+    while (fan >= 0)
+    {
+        int best = -1;
+        size_t best_priority = 0;
+
+        ncandidates = 0;
+
+        for (i = offsets[fan]; i < offsets[fan + 1]; ++i)
+        {
+            size_t t = tris[i];
+
+            if (emitted[t]) continue;
+
+            emitted[t] = 1;
+            sorted[nsorted++] = o->faces[t];
+
+            for (j = 0; j < 3; ++j)
+            {
+                int v = o->faces[t].vertex_indices[j];
+
+                dead_end[ndead_end++] = v;
+                candidates[ncandidates++] = v;
+                --live[v];
+
+                if (time - cache_time[v] > CACHE_SIZE) {
+                    cache_time[v] = time++;
+                }
+            }
+        }
+
+        /* prefer vertices that will still be cached after their fan */
+        for (i = 0; i < ncandidates; ++i)
+        {
+            int v = candidates[i];
+            size_t priority = 0;
+
+            if (live[v] <= 0) continue;
+
+            if (time - cache_time[v] + 2 * live[v] <= CACHE_SIZE) {
+                priority = time - cache_time[v];
+            }
+
+            if (best < 0 || priority > best_priority)
+            {
+                best = v;
+                best_priority = priority;
+            }
+        }
+
+        while (best < 0 && ndead_end)
+        {
+            int v = dead_end[--ndead_end];
+            if (live[v] > 0) best = v;
+        }
+
+        while (best < 0 && cursor < o->nvertices)
+        {
+            if (live[cursor] > 0) best = (int)cursor;
+            ++cursor;
+        }
+
+        fan = best;
+    }
+
+    /* faces with bad indices never get emitted, keep them at the end */
+    for (i = 0; i < o->nfaces; ++i) {
+        if (!emitted[i]) sorted[nsorted++] = o->faces[i];
+    }
+
+    free(o->faces);
+    o->faces = sorted;
+    o->faces_cap = o->nfaces + 1;
+
+    free(offsets);
+    free(tris);
+    free(live);
+    free(cache_time);
+    free(dead_end);
+    free(candidates);
+    free(emitted);
+
+    return 0;
+}
+
+/* triangle strips ----------------------------------------------------- */
+
+struct corner { int vertex_index, uv_index, normal_index; };
+typedef struct corner corner_t;
+
+struct edge { int a, b, face; };
+typedef struct edge edge_t;
+
+static
+int corner_cmp(void const* a, void const* b)
+{
+    corner_t const* ca = a;
+    corner_t const* cb = b;
+
+    if (ca->vertex_index != cb->vertex_index) {
+        return ca->vertex_index < cb->vertex_index ? -1 : 1;
+    }
+
+    if (ca->uv_index != cb->uv_index) {
+        return ca->uv_index < cb->uv_index ? -1 : 1;
+    }
+
+    if (ca->normal_index != cb->normal_index) {
+        return ca->normal_index < cb->normal_index ? -1 : 1;
+    }
+
+    return 0;
+}
+
+static
+int edge_cmp(void const* a, void const* b)
+{
+    edge_t const* ea = a;
+    edge_t const* eb = b;
+
+    if (ea->a != eb->a) return ea->a < eb->a ? -1 : 1;
+    if (ea->b != eb->b) return ea->b < eb->b ? -1 : 1;
+    if (ea->face != eb->face) return ea->face < eb->face ? -1 : 1;
+    return 0;
+}
+
+/* state of the stripifier, tris are corner ids in draw winding */
+struct stripifier
+{
+    size_t ntris;
+    int (*tris)[3];
+    edge_t* edges;
+    unsigned* visited; /* 1 = in a strip, otherwise the last trial id */
+    int* strip;
+};
+
+typedef struct stripifier stripifier_t;
+
+/* finds a face that isn't in a strip and has the directed edge a->b */
+static
+int strip_find(stripifier_t const* st, int a, int b, unsigned trial)
+{
+    size_t lo = 0, hi = st->ntris * 3;
+
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        edge_t const* e = &st->edges[mid];
+
+        if (e->a < a || (e->a == a && e->b < b)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    for (; lo < st->ntris * 3; ++lo)
+    {
+        edge_t const* e = &st->edges[lo];
+
+        if (e->a != a || e->b != b) break;
+        if (st->visited[e->face] != 1 && st->visited[e->face] != trial) {
+            return e->face;
+        }
+    }
+
+    return -1;
+}
+
+/*
+ * grows a strip from face f starting at the given rotation and marks
+ * the faces it uses with the trial id. returns the number of corners
+ */
+static
+size_t strip_grow(stripifier_t* st, size_t f, int rotation, unsigned trial)
+{
+    int const* t = st->tris[f];
+    size_t n = 3;
+
+    st->strip[0] = t[rotation];
+    st->strip[1] = t[(rotation + 1) % 3];
+    st->strip[2] = t[(rotation + 2) % 3];
+    st->visited[f] = trial;
+
+    while (1)
+    {
+        int p = st->strip[n - 2];
+        int q = st->strip[n - 1];
+        int const* nt;
+        int next, k;
+
+        /* odd triangles are wound backwards, so the shared edge flips */
+        if ((n - 3) % 2 == 0) {
+            next = strip_find(st, q, p, trial);
+        } else {
+            next = strip_find(st, p, q, trial);
+        }
+
+        if (next < 0) break;
+
+        /* the new corner is the one after the shared edge */
+        nt = st->tris[next];
+        for (k = 0; k < 3; ++k)
+        {
+            if ((n - 3) % 2 == 0 && nt[k] == q && nt[(k + 1) % 3] == p) {
+                break;
+            }
+
+            if ((n - 3) % 2 == 1 && nt[k] == p && nt[(k + 1) % 3] == q) {
+                break;
+            }
+        }
+
+        st->strip[n++] = nt[(k + 2) % 3];
+        st->visited[next] = trial;
+    }
+
+    return n;
+}
+
+/*
+ * greedy stripifier. faces are visited in order so whatever locality
+ * the face order has (e.g. --morton) carries over. each strip is grown
+ * from all three rotations of its first face and the longest one wins.
+ *
+ * strips only continue across faces that share the whole corner
+ * (vertex, uv and normal index), and are wound the way the demos draw
+ * faces (2-j), which compensates for the y flip in parse_vertex.
+ * vertex_index -1 terminates a strip
+ */
+static
+int build_strips(obj2h_t* o)
+{
+    stripifier_t st;
+    corner_t* unique;
+    size_t nunique = 0;
+    size_t i, j;
+    unsigned trial = 1;
+    int err = 1;
+
+    memset(&st, 0, sizeof(st));
+    st.ntris = o->nfaces;
+
+    unique = malloc(sizeof(corner_t) * (o->nfaces * 3 + 1));
+    st.tris = malloc(sizeof(st.tris[0]) * (o->nfaces + 1));
+    st.edges = malloc(sizeof(edge_t) * (o->nfaces * 3 + 1));
+    st.visited = calloc(o->nfaces + 1, sizeof(unsigned));
+    st.strip = malloc(sizeof(int) * (o->nfaces + 3));
+    o->strip_corners = malloc(sizeof(corner_t) * (o->nfaces * 4 + 1));
+
+    if (!unique || !st.tris || !st.edges || !st.visited ||
+        !st.strip || !o->strip_corners)
+    {
+        eperror(o, "malloc");
+        goto done;
+    }
+
+    /* corner ids, sorted so identical corners end up adjacent */
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        for (j = 0; j < 3; ++j)
+        {
+            corner_t* c = &unique[i * 3 + j];
+            c->vertex_index = o->faces[i].vertex_indices[j];
+            c->uv_index = o->faces[i].uv_indices[j];
+            c->normal_index = o->faces[i].normal_indices[j];
+        }
+    }
+
+    if (parallel_sort(o, unique, o->nfaces * 3, sizeof(corner_t),
+        corner_cmp))
+    {
+        goto done;
+    }
+
+    for (i = 0; i < o->nfaces * 3; ++i)
+    {
+        if (!nunique || corner_cmp(&unique[nunique - 1], &unique[i])) {
+            unique[nunique++] = unique[i];
+        }
+    }
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        for (j = 0; j < 3; ++j)
+        {
+            corner_t c;
+            corner_t* found;
+
+            c.vertex_index = o->faces[i].vertex_indices[2 - j];
+            c.uv_index = o->faces[i].uv_indices[2 - j];
+            c.normal_index = o->faces[i].normal_indices[2 - j];
+            found = bsearch(&c, unique, nunique, sizeof(corner_t),
+                corner_cmp);
+            st.tris[i][j] = (int)(found - unique);
+        }
+
+        for (j = 0; j < 3; ++j)
+        {
+            edge_t* e = &st.edges[i * 3 + j];
+            e->a = st.tris[i][j];
+            e->b = st.tris[i][(j + 1) % 3];
+            e->face = (int)i;
+        }
+    }
+
+    if (parallel_sort(o, st.edges, o->nfaces * 3, sizeof(edge_t),
+        edge_cmp))
+    {
+        goto done;
+    }
+
+    o->nstrip_corners = o->nstrips = 0;
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        size_t best = 0, n;
+        int rotation, best_rotation = 0;
+
+        if (st.visited[i] == 1) continue;
+
+        for (rotation = 0; rotation < 3; ++rotation)
+        {
+            n = strip_grow(&st, i, rotation, ++trial);
+            if (n > best) best = n, best_rotation = rotation;
+        }
+
+        /* trial ids only have to differ from 1 and the current trial */
+        if (trial > 0x7FFFFFFF) trial = 1;
+
+        n = strip_grow(&st, i, best_rotation, 1);
+
+        for (j = 0; j < n; ++j) {
+            o->strip_corners[o->nstrip_corners++] = unique[st.strip[j]];
+        }
+
+        o->strip_corners[o->nstrip_corners].vertex_index = -1;
+        o->strip_corners[o->nstrip_corners].uv_index = -1;
+        o->strip_corners[o->nstrip_corners].normal_index = -1;
+        ++o->nstrip_corners;
+        ++o->nstrips;
+    }
+
+    err = 0;
+
+done:
+    free(unique);
+    free(st.tris);
+    free(st.edges);
+    free(st.visited);
+    free(st.strip);
+
+    return err;
+}
+
+/* index codec --------------------------------------------------------- */
+
+#define OBJ2H_TYPES
+#define OBJ2H_STRIP_TYPES
+#include "obj2h_icodec.h"
+
+/* bits are appended lsb first, see obj2h_icodec_bit */
+struct bitbuf { buf_t b; unsigned bit; };
+typedef struct bitbuf bitbuf_t;
+
+static
+int bitbuf_put(bitbuf_t* bb, int x)
+{
+    if (!bb->bit && buf_u8(&bb->b, 0)) return 1;
+    if (x) bb->b.data[bb->b.size - 1] |= 1 << bb->bit;
+    bb->bit = (bb->bit + 1) % 8;
+    return 0;
+}
+
+/*
+ * huffman code lengths for the byte frequencies in freq. codes can't be
+ * longer than 15 bits, so the frequencies are halved until the tree is
+ * shallow enough
+ */
+static
+void huffman_lengths(size_t const* freq, unsigned char* lengths)
+{
+    size_t weight[511];
+    int parent[511], alive[511];
+    int i, n, nodes;
+
+    for (i = 0; i < 256; ++i) weight[i] = freq[i];
+
+    while (1)
+    {
+        int deepest = 0;
+
+        for (i = 0, n = 0; i < 256; ++i)
+        {
+            alive[i] = weight[i] > 0;
+            parent[i] = -1;
+            lengths[i] = 0;
+            n += alive[i];
+        }
+
+        if (n == 1)
+        {
+            for (i = 0; i < 256; ++i) lengths[i] = (unsigned char)alive[i];
+            return;
+        }
+
+        /* merges the two lightest nodes until one is left */
+        for (nodes = 256; n > 1; ++nodes, --n)
+        {
+            int lo[2] = { -1, -1 };
+            int k;
+
+            for (i = 0; i < nodes; ++i)
+            {
+                if (!alive[i]) continue;
+
+                if (lo[0] < 0 || weight[i] < weight[lo[0]]) {
+                    lo[1] = lo[0];
+                    lo[0] = i;
+                } else if (lo[1] < 0 || weight[i] < weight[lo[1]]) {
+                    lo[1] = i;
+                }
+            }
+
+            for (k = 0; k < 2; ++k)
+            {
+                alive[lo[k]] = 0;
+                parent[lo[k]] = nodes;
+            }
+
+            weight[nodes] = weight[lo[0]] + weight[lo[1]];
+            alive[nodes] = 1;
+            parent[nodes] = -1;
+        }
+
+        for (i = 0; i < 256; ++i)
+        {
+            int depth = 0, k;
+
+            if (!weight[i]) continue;
+            for (k = parent[i]; k >= 0; k = parent[k]) ++depth;
+            lengths[i] = (unsigned char)(depth < 16 ? depth : 0);
+            if (depth > deepest) deepest = depth;
+        }
+
+        if (deepest < 16) return;
+
+        for (i = 0; i < 256; ++i) weight[i] = (weight[i] + 1) / 2;
+    }
+}
+
+/* huffman codes a stream, see obj2h_icodec_unpack for the layout */
+static
+int icodec_pack(buf_t const* in, buf_t* out)
+{
+    bitbuf_t bb = { { 0, 0, 0 }, 0 };
+    size_t freq[256];
+    unsigned char lengths[256];
+    unsigned codes[256], counts[16], first[16];
+    unsigned code = 0;
+    size_t i;
+    int j, err = 0;
+
+    memset(freq, 0, sizeof(freq));
+    for (i = 0; i < in->size; ++i) ++freq[in->data[i]];
+    huffman_lengths(freq, lengths);
+
+    /* canonical codes like deflate's */
+    memset(counts, 0, sizeof(counts));
+    for (i = 0; i < 256; ++i) ++counts[lengths[i]];
+
+    for (j = 1; j < 16; ++j)
+    {
+        first[j] = code;
+        code = (code + counts[j]) << 1;
+    }
+
+    for (i = 0; i < 256; ++i) {
+        if (lengths[i]) codes[i] = first[lengths[i]]++;
+    }
+
+    err |= buf_u32(&bb.b, in->size);
+    for (i = 0; i < 256; ++i) err |= bitbuf_put(&bb, lengths[i] != 0);
+
+    for (i = 0; i < 256; ++i)
+    {
+        if (!lengths[i]) continue;
+        for (j = 0; j < 4; ++j) err |= bitbuf_put(&bb, (lengths[i] >> j) & 1);
+    }
+
+    for (i = 0; i < in->size && !err; ++i)
+    {
+        int len = lengths[in->data[i]];
+
+        for (j = len - 1; j >= 0; --j) {
+            err |= bitbuf_put(&bb, (codes[in->data[i]] >> j) & 1);
+        }
+    }
+
+    *out = bb.b;
+
+    return err;
+}
+
+static
+int icodec_explicit(buf_t* data, int x, int* last)
+{
+    int err = buf_varint(data, zigzag(x - *last));
+    *last = x;
+    return err;
+}
+
+/*
+ * mirrors obj2h_icodec_attributes. if bits is null this only checks
+ * whether the prediction always holds and returns non-zero if it doesn't
+ */
+static
+int icodec_attributes(int* map, size_t nvertices, int const* vtx,
+    int const* idx, size_t n, size_t group, size_t stride, bitbuf_t* bits,
+    buf_t* data)
+{
+    int next = 1, last = 0;
+    size_t i;
+    int err = 0;
+
+    for (i = 0; i < nvertices; ++i) map[i] = -1;
+
+    for (i = 0; i < n; ++i)
+    {
+        size_t c = obj2h_icodec_corner(i, group, stride);
+        int v = vtx[c];
+        int x = idx[c] + 1;
+        int predicted;
+
+        if (v < 0) continue;
+
+        predicted = map[v] >= 0 ? map[v] : next;
+
+        if (!bits)
+        {
+            if (x != predicted) return 1;
+        }
+
+        else if (x == predicted) {
+            err |= bitbuf_put(bits, 0);
+        }
+
+        else
+        {
+            err |= bitbuf_put(bits, 1);
+
+            if (map[v] >= 0) {
+                err |= bitbuf_put(bits, x != next);
+            }
+
+            if (map[v] < 0 || x != next) {
+                err |= icodec_explicit(data, x, &last);
+            }
+        }
+
+        if (x >= next) next = x + 1;
+        map[v] = x;
+    }
+
+    return err;
+}
+
+/* assembles the encoded buffer, see obj2h_icodec.h for the layout */
+static
+int icodec_finish(obj2h_t* o, unsigned type, size_t count, size_t nverts,
+    int const* vtx, int const* uv, int const* normal, size_t group,
+    size_t stride, buf_t const* codes, buf_t const* data, buf_t* out)
+{
+    buf_t packed[2] = { { 0, 0, 0 }, { 0, 0, 0 } };
+    buf_t const* streams[2];
+    int const* attrs[2];
+    unsigned modes[2], flags = 0;
+    int* map;
+    size_t i, j;
+    int err = 0;
+
+    attrs[0] = uv;
+    attrs[1] = normal;
+
+    map = malloc(sizeof(int) * (nverts ? nverts : 1));
+    if (!map) {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    for (i = 0; i < 2; ++i)
+    {
+        modes[i] = OBJ2H_ICODEC_ABSENT;
+
+        for (j = 0; j < count * group; ++j)
+        {
+            size_t c = obj2h_icodec_corner(j, group, stride);
+
+            if (vtx[c] >= 0 && attrs[i][c] >= 0)
+            {
+                modes[i] = OBJ2H_ICODEC_IMPLICIT;
+                break;
+            }
+        }
+
+        if (modes[i] == OBJ2H_ICODEC_IMPLICIT &&
+            icodec_attributes(map, nverts, vtx, attrs[i], count * group,
+                group, stride, 0, 0))
+        {
+            modes[i] = OBJ2H_ICODEC_CODED;
+        }
+    }
+
+    /* each stream is huffman coded if that makes it smaller */
+    streams[0] = codes;
+    streams[1] = data;
+
+    for (i = 0; i < 2; ++i)
+    {
+        if (!streams[i] || !streams[i]->size) continue;
+
+        err |= icodec_pack(streams[i], &packed[i]);
+
+        if (packed[i].size < streams[i]->size)
+        {
+            streams[i] = &packed[i];
+            flags |= i ? OBJ2H_ICODEC_HUFFMAN_DATA :
+                OBJ2H_ICODEC_HUFFMAN_CODES;
+        }
+    }
+
+    err |= buf_u8(out, type);
+    err |= buf_u8(out, modes[0] | (modes[1] << 2));
+    err |= buf_u16(out, flags);
+    err |= buf_u32(out, count);
+    err |= buf_u32(out, nverts);
+
+    for (i = 0; i < 2; ++i) {
+        err |= buf_u32(out, streams[i] ? streams[i]->size : 0);
+    }
+
+    for (i = 0; i < 2; ++i)
+    {
+        if (streams[i]) {
+            err |= buf_put(out, streams[i]->data, streams[i]->size);
+        }
+
+        free(packed[i].data);
+    }
+
+    for (i = 0; i < 2 && !err; ++i)
+    {
+        bitbuf_t bits = { { 0, 0, 0 }, 0 };
+        buf_t explicit_data = { 0, 0, 0 };
+
+        if (modes[i] != OBJ2H_ICODEC_CODED) continue;
+
+        err |= icodec_attributes(map, nverts, vtx, attrs[i], count * group,
+            group, stride, &bits, &explicit_data);
+        err |= buf_u32(out, bits.b.size);
+        err |= buf_u32(out, explicit_data.size);
+        err |= buf_put(out, bits.b.data, bits.b.size);
+        err |= buf_put(out, explicit_data.data, explicit_data.size);
+
+        free(bits.b.data);
+        free(explicit_data.data);
+    }
+
+    free(map);
+
+    return err;
+}
+
+static
+int fifo_find(int const* fifo, unsigned offset, int v)
+{
+    int i;
+
+    /* 1 is the most recent entry, 15 is reserved for explicit */
+    for (i = 1; i < 15; ++i) {
+        if (fifo[(offset - i) & 15] == v) return i;
+    }
+
+    return -1;
+}
+
+static
+void rotate_face(face_t* f, int rotation)
+{
+    face_t r = *f;
+    int j;
+
+    for (j = 0; j < 3; ++j)
+    {
+        f->vertex_indices[j] = r.vertex_indices[(j + rotation) % 3];
+        f->uv_indices[j] = r.uv_indices[(j + rotation) % 3];
+        f->normal_indices[j] = r.normal_indices[(j + rotation) % 3];
+    }
+}
+
+/*
+ * encodes faces with the triangle list codec, see obj2h_icodec.h.
+ * faces are rotated in place to match what the decoder will produce
+ */
+static
+int encode_faces(obj2h_t* o, face_t* fs, size_t n, buf_t* out)
+{
+    int edges[16][2], fifo[16];
+    unsigned eoff = 0, voff = 0;
+    int next = 0, last = 0;
+    size_t nverts = 0;
+    buf_t codes = { 0, 0, 0 };
+    buf_t data = { 0, 0, 0 };
+    size_t i;
+    int j, err = 0;
+
+    memset(edges, 0xFF, sizeof(edges));
+    memset(fifo, 0xFF, sizeof(fifo));
+
+    for (i = 0; i < n; ++i)
+    {
+        for (j = 0; j < 3; ++j)
+        {
+            int v = fs[i].vertex_indices[j];
+
+            if (v < 0) {
+                eprintf(o, "icodec: face %zd has no vertex index\n", i);
+                return 1;
+            }
+
+            if ((size_t)v >= nverts) nverts = v + 1;
+        }
+    }
+
+    for (i = 0; i < n && !err; ++i)
+    {
+        int* t = fs[i].vertex_indices;
+        int fe = -1, rotation = 0;
+        int a, b, c;
+
+        /* look for a shared edge, most recent first */
+        for (j = 0; j < 15 && fe < 0; ++j)
+        {
+            int const* e = edges[(eoff - 1 - j) & 15];
+            int k;
+
+            for (k = 0; k < 3; ++k)
+            {
+                if (e[0] == t[k] && e[1] == t[(k + 1) % 3])
+                {
+                    fe = j;
+                    rotation = k;
+                    break;
+                }
+            }
+        }
+
+        if (fe >= 0)
+        {
+            int fec;
+
+            rotate_face(&fs[i], rotation);
+            a = t[0];
+            b = t[1];
+            c = t[2];
+
+            if (c == next) {
+                fec = 0;
+                ++next;
+            } else if ((fec = fifo_find(fifo, voff, c)) < 0) {
+                fec = 15;
+                err |= icodec_explicit(&data, c, &last);
+            }
+
+            if (fec == 0 || fec == 15) fifo[voff++ & 15] = c;
+
+            err |= buf_u8(&codes, (fe << 4) | fec);
+        }
+
+        else
+        {
+            int fv[3];
+            unsigned aux;
+
+            /* prefer having the next vertex first */
+            if (t[1] == next) {
+                rotation = 1;
+            } else if (t[2] == next) {
+                rotation = 2;
+            }
+
+            rotate_face(&fs[i], rotation);
+
+            for (j = 0; j < 3; ++j)
+            {
+                if (t[j] == next) {
+                    fv[j] = 0;
+                    ++next;
+                } else if (j == 0) {
+                    fv[j] = 15;
+                } else if ((fv[j] = fifo_find(fifo, voff, t[j])) < 0) {
+                    fv[j] = 15;
+                }
+            }
+
+            aux = (fv[1] << 4) | fv[2];
+
+            if (fv[0] == 0)
+            {
+                for (j = 0; j < 14; ++j) {
+                    if (obj2h_icodec_aux[j] == aux) break;
+                }
+
+                if (j < 14) {
+                    err |= buf_u8(&codes, 0xF0 | j);
+                } else {
+                    err |= buf_u8(&codes, 0xFE);
+                    err |= buf_u8(&data, aux);
+                }
+            }
+
+            else
+            {
+                err |= buf_u8(&codes, 0xFF);
+                err |= buf_u8(&data, aux);
+            }
+
+            for (j = 0; j < 3; ++j) {
+                if (fv[j] == 15) err |= icodec_explicit(&data, t[j], &last);
+            }
+
+            for (j = 0; j < 3; ++j) {
+                if (fv[j] == 0 || fv[j] == 15) fifo[voff++ & 15] = t[j];
+            }
+
+            a = t[0];
+            b = t[1];
+            c = t[2];
+
+            edges[eoff & 15][0] = b;
+            edges[eoff++ & 15][1] = a;
+        }
+
+        edges[eoff & 15][0] = c;
+        edges[eoff++ & 15][1] = b;
+        edges[eoff & 15][0] = a;
+        edges[eoff++ & 15][1] = c;
+    }
+
+    err |= icodec_finish(o, OBJ2H_ICODEC_FACES, n, nverts,
+        fs->vertex_indices, fs->uv_indices, fs->normal_indices, 3,
+        sizeof(face_t) / sizeof(int), &codes, &data, out);
+
+    free(codes.data);
+    free(data.data);
+
+    return err;
+}
+
+/* encodes strip corners with the sequence codec, see obj2h_icodec.h */
+static
+int encode_strips(obj2h_t* o, corner_t const* cs, size_t n, buf_t* out)
+{
+    int last[2] = { 0, 0 };
+    size_t nverts = 0;
+    buf_t data = { 0, 0, 0 };
+    size_t i;
+    int err = 0;
+
+    for (i = 0; i < n; ++i)
+    {
+        int v = cs[i].vertex_index;
+        int k;
+
+        if (v >= 0 && (size_t)v >= nverts) nverts = v + 1;
+
+        k = abs(v - last[1]) < abs(v - last[0]);
+        err |= buf_varint(&data, (zigzag(v - last[k]) << 1) | k);
+        if (v >= 0) last[k] = v;
+    }
+
+    err |= icodec_finish(o, OBJ2H_ICODEC_STRIPS, n, nverts,
+        &cs->vertex_index, &cs->uv_index, &cs->normal_index, 1,
+        sizeof(corner_t) / sizeof(int), 0, &data, out);
+
+    free(data.data);
+
+    return err;
+}
+
+/*
+ * renumbers one kind of index by first use in face order so the index
+ * codec's "next" predictions hit. returns 1 if anything moved, -1 if
+ * out of memory
+ */
+static
+int renumber_first_use(obj2h_t* o, void* items, size_t n, size_t size,
+    size_t kind)
+{
+    size_t* remap;
+    char* sorted;
+    size_t i, next = 0;
+    int j, changed = -1;
+
+    remap = malloc(sizeof(size_t) * (n + 1));
+    sorted = malloc(size * (n + 1));
+    if (!remap || !sorted) {
+        eperror(o, "malloc");
+        goto done;
+    }
+
+    changed = 0;
+
+    memset(remap, 0xFF, sizeof(size_t) * n);
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        int* idx = o->faces[i].vertex_indices + kind * 3;
+
+        for (j = 0; j < 3; ++j)
+        {
+            if (idx[j] < 0 || (size_t)idx[j] >= n) continue;
+            if (remap[idx[j]] == (size_t)-1) remap[idx[j]] = next++;
+            if (remap[idx[j]] != (size_t)idx[j]) changed = 1;
+            idx[j] = (int)remap[idx[j]];
+        }
+    }
+
+    /* unreferenced items go last in their original order */
+    for (i = 0; i < n; ++i)
+    {
+        if (remap[i] == (size_t)-1) remap[i] = next++;
+        if (remap[i] != i) changed = 1;
+        memcpy(sorted + remap[i] * size, (char*)items + i * size, size);
+    }
+
+    if (attributes_permute(o, kind, remap, n))
+    {
+        changed = -1;
+        goto done;
+    }
+
+    if (n) memcpy(items, sorted, size * n);
+
+done:
+    free(sorted);
+    free(remap);
+
+    return changed;
+}
+
+/*
+ * the codec predicts never seen vertices and attributes with a counter,
+ * so it works best when they are numbered by first use. encoding can
+ * rotate faces which changes first use order, so this alternates
+ * between the two until nothing moves
+ */
+static
+int icodec_prepare(obj2h_t* o)
+{
+    int i, r[3], changed = 1;
+
+    for (i = 0; i < 8 && changed; ++i)
+    {
+        buf_t b = { 0, 0, 0 };
+
+        if (encode_faces(o, o->faces, o->nfaces, &b)) return 1;
+        free(b.data);
+
+        r[0] = renumber_first_use(o, o->vertices, o->nvertices,
+            sizeof(vec3_t), 0);
+        r[1] = renumber_first_use(o, o->uvs, o->nuvs, sizeof(uv_t), 1);
+        r[2] = renumber_first_use(o, o->normals, o->nnormals,
+            sizeof(vec3_t), 2);
+
+        if (r[0] < 0 || r[1] < 0 || r[2] < 0) return 1;
+        changed = r[0] | r[1] | r[2];
+    }
+
+    return 0;
+}
+
+/*
+ * decodes the encoded buffer back to make sure it round trips and
+ * reports its size
+ */
+static
+int icodec_check(obj2h_t* o, char const* what, buf_t const* b,
+    void const* expected, size_t n, size_t ntris)
+{
+    buf_t packed = { 0, 0, 0 };
+    void* decoded;
+    size_t size;
+    int err;
+
+    size = n * (expected == o->faces ? sizeof(face_t) : sizeof(corner_t));
+    decoded = malloc(size + 1);
+    if (!decoded) {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    if (expected == o->faces) {
+        err = obj2h_decode_faces(decoded, n, b->data, b->size);
+    } else {
+        err = obj2h_decode_strips(decoded, n, b->data, b->size);
+    }
+
+    if (err || memcmp(decoded, expected, size))
+    {
+        eprintf(o, "icodec: %s don't round trip\n", what);
+        free(decoded);
+        return 1;
+    }
+
+    free(decoded);
+    lz_encode(b->data, b->size, &packed);
+
+    eprintf(o, "icodec: %s %zd bytes, %.2f bits per triangle "
+        "(%.2f after lz)\n", what, b->size, b->size * 8.0 / ntris,
+        packed.size * 8.0 / ntris);
+
+    free(packed.data);
+
+    return 0;
+}
+
+/* cleanup ------------------------------------------------------------- */
+
+/*
+ * positions weld within --epsilon. normals and uvs have their own tight
+ * tolerances so hard edges and uv seams survive, and vertices only merge
+ * if they also agree in every morph frame and in their skin weights
+ */
+#define WELD_NORMAL_EPSILON 1e-3f
+#define WELD_UV_EPSILON 1e-5f
+
+static
+int weld_accept_vertex(obj2h_t* o, size_t a, size_t incoming)
+{
+    size_t i;
+
+    if (o->nskin &&
+        memcmp(&o->skin[a], &o->skin[incoming], sizeof(skin_vertex_t)))
+    {
+        return 0;
+    }
+
+    if (o->nvertex_colors &&
+        o->vertex_colors[a] != o->vertex_colors[incoming])
+    {
+        return 0;
+    }
+
+    for (i = 0; i < o->nmorph_frames; ++i)
+    {
+        vec3_t const* p = &o->morph_frames[i].vertices[a];
+        vec3_t const* q = &o->morph_frames[i].vertices[incoming];
+
+        if (fabsf(p->x - q->x) > o->weld_epsilon ||
+            fabsf(p->y - q->y) > o->weld_epsilon ||
+            fabsf(p->z - q->z) > o->weld_epsilon)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+static
+int weld_accept_normal(obj2h_t* o, size_t a, size_t incoming)
+{
+    size_t i;
+
+    for (i = 0; i < o->nmorph_frames; ++i)
+    {
+        vec3_t const* p = &o->morph_frames[i].normals[a];
+        vec3_t const* q = &o->morph_frames[i].normals[incoming];
+
+        if (fabsf(p->x - q->x) > WELD_NORMAL_EPSILON ||
+            fabsf(p->y - q->y) > WELD_NORMAL_EPSILON ||
+            fabsf(p->z - q->z) > WELD_NORMAL_EPSILON)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * welds the vertices (kind 0), uvs (1) or normals (2) and points the
+ * faces at the survivors
+ */
+static
+int weld_items(obj2h_t* o, size_t kind)
+{
+    size_t n = kind == 0 ? o->nvertices : kind == 1 ? o->nuvs : o->nnormals;
+    size_t nwelded = 0;
+    unsigned* match;
+    size_t* remap;
+    size_t i;
+    int j, err = 1;
+
+    match = malloc(sizeof(unsigned) * (n + 1));
+    remap = malloc(sizeof(size_t) * (n + 1));
+
+    if (!match || !remap) {
+        eperror(o, "malloc");
+        goto done;
+    }
+
+    if (weld_run(o, kind == 0 ? (void const*)o->vertices :
+        kind == 1 ? (void const*)o->uvs : (void const*)o->normals,
+        kind == 1 ? uv_item : vec3_item, n, n,
+        kind == 0 ? o->weld_epsilon :
+        kind == 1 ? WELD_UV_EPSILON : WELD_NORMAL_EPSILON,
+        kind == 0 ? weld_accept_vertex :
+        kind == 2 ? weld_accept_normal : 0, match))
+    {
+        goto done;
+    }
+
+    /* clusters are numbered in the order they started */
+    for (i = 0; i < n; ++i) {
+        remap[i] = match[i] == i ? nwelded++ : remap[match[i]];
+    }
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        int* idx = o->faces[i].vertex_indices + kind * 3;
+
+        for (j = 0; j < 3; ++j) {
+            if (idx[j] >= 0 && (size_t)idx[j] < n) idx[j] = (int)remap[idx[j]];
+        }
+    }
+
+    if (attributes_permute(o, kind, remap, n)) goto done;
+
+    /* the first item of every cluster is kept as is */
+    for (i = 0; i < n; ++i)
+    {
+        if (match[i] != i) continue;
+
+        switch (kind)
+        {
+        case 0: o->vertices[remap[i]] = o->vertices[i]; break;
+        case 1: o->uvs[remap[i]] = o->uvs[i]; break;
+        case 2: o->normals[remap[i]] = o->normals[i]; break;
+        }
+    }
+
+    switch (kind)
+    {
+    case 0: o->nvertices = nwelded; break;
+    case 1: o->nuvs = nwelded; break;
+    case 2: o->nnormals = nwelded; break;
+    }
+
+    err = 0;
+
+done:
+    free(match);
+    free(remap);
+
+    return err;
+}
+
+#define FACE_DEGENERATE 1
+#define FACE_DUPLICATE 2
+
+struct face_key { int v[3]; size_t index; };
+typedef struct face_key face_key_t;
+
+static
+int face_key_cmp(void const* a, void const* b)
+{
+    face_key_t const* x = a;
+    face_key_t const* y = b;
+    int i;
+
+    for (i = 0; i < 3; ++i) {
+        if (x->v[i] != y->v[i]) return x->v[i] < y->v[i] ? -1 : 1;
+    }
+
+    return x->index < y->index ? -1 : x->index > y->index;
+}
+
+struct bad_faces_job { obj2h_t* o; unsigned char* bad; face_key_t* keys; };
+typedef struct bad_faces_job bad_faces_job_t;
+
+/* the key of every face at its own index, -1 for faces without one */
+static
+int bad_faces_keys(void* ctx, size_t first, size_t last)
+{
+    bad_faces_job_t* j = ctx;
+    obj2h_t* o = j->o;
+    size_t i;
+
+    for (i = first; i < last; ++i)
+    {
+        int const* vi = o->faces[i].vertex_indices;
+        face_key_t* key = &j->keys[i];
+        vec3_t const* a;
+        vec3_t const* b;
+        vec3_t const* c;
+        vec3_t e0, e1, n;
+        int k, first_corner = 0;
+
+        key->index = (size_t)-1;
+
+        for (k = 0; k < 3; ++k) {
+            if (vi[k] < 0 || (size_t)vi[k] >= o->nvertices) break;
+        }
+
+        if (k < 3) continue;
+
+        a = &o->vertices[vi[0]];
+        b = &o->vertices[vi[1]];
+        c = &o->vertices[vi[2]];
+        e0.x = b->x - a->x; e0.y = b->y - a->y; e0.z = b->z - a->z;
+        e1.x = c->x - a->x; e1.y = c->y - a->y; e1.z = c->z - a->z;
+        n.x = e0.y * e1.z - e0.z * e1.y;
+        n.y = e0.z * e1.x - e0.x * e1.z;
+        n.z = e0.x * e1.y - e0.y * e1.x;
+
+        if (vi[0] == vi[1] || vi[1] == vi[2] || vi[0] == vi[2] ||
+            (n.x == 0 && n.y == 0 && n.z == 0))
+        {
+            j->bad[i] = FACE_DEGENERATE;
+            continue;
+        }
+
+        /* rotated so the smallest index comes first, winding is kept */
+        for (k = 1; k < 3; ++k) {
+            if (vi[k] < vi[first_corner]) first_corner = k;
+        }
+
+        for (k = 0; k < 3; ++k) {
+            key->v[k] = vi[(first_corner + k) % 3];
+        }
+
+        key->index = i;
+    }
+
+    return 0;
+}
+
+/*
+ * marks faces that repeat a vertex or have no area as degenerate, and
+ * faces using the same vertices with the same winding as an earlier one
+ * as duplicates. reversed copies are left alone, they're the back side
+ */
+static
+unsigned char* find_bad_faces(obj2h_t* o, size_t* degenerate, size_t* duplicate)
+{
+    bad_faces_job_t j;
+    size_t nkeys = 0, i;
+
+    *degenerate = *duplicate = 0;
+
+    j.o = o;
+    j.bad = calloc(o->nfaces + 1, 1);
+    j.keys = malloc(sizeof(face_key_t) * (o->nfaces + 1));
+
+    if (!j.bad || !j.keys)
+    {
+        eperror(o, "malloc");
+        free(j.bad);
+        free(j.keys);
+        return 0;
+    }
+
+    parallel_for(o, o->nfaces, PARALLEL_GRAIN, bad_faces_keys, &j);
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        if (j.bad[i]) ++*degenerate;
+        if (j.keys[i].index != (size_t)-1) j.keys[nkeys++] = j.keys[i];
+    }
+
+    if (parallel_sort(o, j.keys, nkeys, sizeof(face_key_t), face_key_cmp))
+    {
+        free(j.bad);
+        free(j.keys);
+        return 0;
+    }
+
+    for (i = 1; i < nkeys; ++i)
+    {
+        if (!memcmp(j.keys[i].v, j.keys[i - 1].v, sizeof(j.keys[i].v)))
+        {
+            j.bad[j.keys[i].index] = FACE_DUPLICATE;
+            ++*duplicate;
+        }
+    }
+
+    free(j.keys);
+
+    return j.bad;
+}
+
+/* number of distinct vertices (0), uvs (1) or normals (2) faces use */
+static
+int count_referenced(obj2h_t* o, size_t kind, size_t n, size_t* count)
+{
+    unsigned char* used = calloc(n + 1, 1);
+    size_t i;
+    int j;
+
+    if (!used) {
+        eperror(o, "calloc");
+        return 1;
+    }
+
+    *count = 0;
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        int const* idx = o->faces[i].vertex_indices + kind * 3;
+
+        for (j = 0; j < 3; ++j)
+        {
+            if (idx[j] < 0 || (size_t)idx[j] >= n || used[idx[j]]) continue;
+            used[idx[j]] = 1;
+            ++*count;
+        }
+    }
+
+    free(used);
+
+    return 0;
+}
+
+static
+size_t mesh_bytes(obj2h_t* o)
+{
+    return (o->nvertices + o->nnormals) * sizeof(vector_t) +
+        o->nuvs * sizeof(uv_t) + o->nfaces * sizeof(face_t);
+}
+
+/*
+ * welds vertices, normals and uvs, removes degenerate and duplicate
+ * faces and then whatever they leave unreferenced
+ */
+static
+int cleanup_mesh(obj2h_t* o)
+{
+    size_t before[4], before_bytes = mesh_bytes(o);
+    size_t degenerate, duplicate, i, n, kept = 0;
+    unsigned char* bad;
+
+    before[0] = o->nvertices;
+    before[1] = o->nuvs;
+    before[2] = o->nnormals;
+    before[3] = o->nfaces;
+
+    /*
+     * skinned normals are indexed like the vertices, welding them apart
+     * would break obj2h_skin_apply
+     */
+    if (o->njoints) {
+        eprintf(o, "cleanup: skinned mesh, not welding\n");
+    } else if (weld_items(o, 0) || weld_items(o, 1) || weld_items(o, 2)) {
+        return 1;
+    }
+
+    bad = find_bad_faces(o, &degenerate, &duplicate);
+    if (!bad) return 1;
+
+    for (i = 0; i < o->nfaces; ++i) {
+        if (!bad[i]) o->faces[kept++] = o->faces[i];
+    }
+
+    o->nfaces = kept;
+    free(bad);
+
+    /* unreferenced items are moved to the end and cut off */
+    if (count_referenced(o, 0, o->nvertices, &n)) return 1;
+
+    if (n < o->nvertices)
+    {
+        if (renumber_first_use(o, o->vertices, o->nvertices, sizeof(vec3_t),
+            0) < 0)
+        {
+            return 1;
+        }
+
+        o->nvertices = n;
+        if (o->nskin) o->nskin = n;
+        if (o->nvertex_colors) o->nvertex_colors = n;
+    }
+
+    if (count_referenced(o, 1, o->nuvs, &n)) return 1;
+
+    if (n < o->nuvs)
+    {
+        if (renumber_first_use(o, o->uvs, o->nuvs, sizeof(uv_t), 1) < 0) {
+            return 1;
+        }
+
+        o->nuvs = n;
+    }
+
+    if (count_referenced(o, 2, o->nnormals, &n)) return 1;
+
+    if (n < o->nnormals)
+    {
+        if (renumber_first_use(o, o->normals, o->nnormals, sizeof(vec3_t),
+            2) < 0)
+        {
+            return 1;
+        }
+
+        o->nnormals = n;
+    }
+
+    eprintf(o, "cleanup: vertices %zd -> %zd, uvs %zd -> %zd, "
+        "normals %zd -> %zd\n", before[0], o->nvertices, before[1], o->nuvs,
+        before[2], o->nnormals);
+    eprintf(o, "cleanup: faces %zd -> %zd (%zd degenerate, %zd "
+        "duplicate), %zd bytes saved\n", before[3], o->nfaces, degenerate,
+        duplicate, before_bytes - mesh_bytes(o));
+
+    return 0;
+}
+
+/* progressive meshes -------------------------------------------------- */
+
+/*
+ * half-edge collapses (u goes into v, no new positions) picked by error
+ * quadrics (garland, heckbert 1997). a collapse records the corners of
+ * the faces it keeps that referenced u, and the faces it removes are
+ * snapshotted as they were, which is how the split brings them back
+ */
+
+#define PM_BOUNDARY_WEIGHT 1000.0
+
+/*
+ * flat areas cost nothing to collapse and would otherwise let a vertex
+ * swallow its surroundings into an ever growing fan
+ */
+#define PM_MAX_FACES 24
+
+struct pm_list { size_t* items; size_t n, cap; };
+typedef struct pm_list pm_list_t;
+
+struct pm_candidate { double cost; size_t u, v; unsigned stamp; };
+typedef struct pm_candidate pm_candidate_t;
+
+struct pm_collapse { size_t u, v, first_corner, ncorners; };
+typedef struct pm_collapse pm_collapse_t;
+
+static
+int pm_list_add(pm_list_t* l, size_t x)
+{
+    size_t* p = push_back(sizeof(size_t), (void**)&l->items, &l->n, &l->cap);
+
+    if (!p) return 1;
+    *p = x;
+
+    return 0;
+}
+
+static
+void pm_quadric_plane(double* q, double a, double b, double c, double d,
+    double w)
+{
+    q[0] += w * a * a; q[1] += w * a * b; q[2] += w * a * c;
+    q[3] += w * a * d; q[4] += w * b * b; q[5] += w * b * c;
+    q[6] += w * b * d; q[7] += w * c * c; q[8] += w * c * d;
+    q[9] += w * d * d;
+}
+
+static
+double pm_quadric_error(double const* q, vec3_t const* p)
+{
+    double x = p->x, y = p->y, z = p->z;
+
+    return q[0] * x * x + 2 * q[1] * x * y + 2 * q[2] * x * z +
+        2 * q[3] * x + q[4] * y * y + 2 * q[5] * y * z + 2 * q[6] * y +
+        q[7] * z * z + 2 * q[8] * z + q[9];
+}
+
+static
+void pm_face_normal(obj2h_t* o, int const* vi, vec3_t* n)
+{
+    vec3_t const* a = &o->vertices[vi[0]];
+    vec3_t const* b = &o->vertices[vi[1]];
+    vec3_t const* c = &o->vertices[vi[2]];
+    float e0x = b->x - a->x, e0y = b->y - a->y, e0z = b->z - a->z;
+    float e1x = c->x - a->x, e1y = c->y - a->y, e1z = c->z - a->z;
+
+    n->x = e0y * e1z - e0z * e1y;
+    n->y = e0z * e1x - e0x * e1z;
+    n->z = e0x * e1y - e0y * e1x;
+}
+
+static
+void pm_heap_down(obj2h_t* o, size_t i)
+{
+    for (;;)
+    {
+        size_t l = i * 2 + 1, r = l + 1, m = i;
+        pm_candidate_t t;
+
+        if (l < o->npm_heap && o->pm_heap[l].cost < o->pm_heap[m].cost) m = l;
+        if (r < o->npm_heap && o->pm_heap[r].cost < o->pm_heap[m].cost) m = r;
+        if (m == i) break;
+
+        t = o->pm_heap[i];
+        o->pm_heap[i] = o->pm_heap[m];
+        o->pm_heap[m] = t;
+        i = m;
+    }
+}
+
+static
+int pm_heap_push(obj2h_t* o, pm_candidate_t const* c)
+{
+    pm_candidate_t* p = push_back(sizeof(pm_candidate_t), (void**)&o->pm_heap,
+        &o->npm_heap, &o->pm_heap_cap);
+    size_t i = o->npm_heap - 1;
+
+    if (!p) return 1;
+    *p = *c;
+
+    while (i && o->pm_heap[(i - 1) / 2].cost > o->pm_heap[i].cost)
+    {
+        pm_candidate_t t = o->pm_heap[i];
+        o->pm_heap[i] = o->pm_heap[(i - 1) / 2];
+        o->pm_heap[(i - 1) / 2] = t;
+        i = (i - 1) / 2;
+    }
+
+    return 0;
+}
+
+static
+pm_candidate_t pm_heap_pop(obj2h_t* o)
+{
+    pm_candidate_t top = o->pm_heap[0];
+
+    o->pm_heap[0] = o->pm_heap[--o->npm_heap];
+    pm_heap_down(o, 0);
+
+    return top;
+}
+
+/* u can go into v without flipping or squashing any face that stays */
+static
+int pm_collapse_valid(obj2h_t* o, size_t u, size_t v)
+{
+    pm_list_t const* l = &o->pm_vertex_faces[u];
+    size_t i;
+
+    if (l->n + o->pm_vertex_faces[v].n > PM_MAX_FACES) return 0;
+
+    for (i = 0; i < l->n; ++i)
+    {
+        int* vi = &o->pm_faces[l->items[i] * 3];
+        int moved[3];
+        vec3_t before, after;
+        int k, shared = 0;
+
+        if (!o->pm_face_alive[l->items[i]]) continue;
+
+        for (k = 0; k < 3; ++k)
+        {
+            moved[k] = vi[k] == (int)u ? (int)v : vi[k];
+            shared |= vi[k] == (int)v;
+        }
+
+        if (shared) continue;
+
+        pm_face_normal(o, vi, &before);
+        pm_face_normal(o, moved, &after);
+
+        /* slivers may go, but nothing may turn over or collapse */
+        if (before.x * after.x + before.y * after.y + before.z * after.z <=
+            0 && (before.x || before.y || before.z))
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/*
+ * the cheapest valid collapse of u into one of its neighbours, a cost
+ * of -1 if there's none. only reads, so vertices can go in parallel
+ */
+static
+void pm_cheapest(obj2h_t* o, size_t u, pm_candidate_t* best)
+{
+    pm_list_t const* l = &o->pm_vertex_faces[u];
+    size_t i;
+    int k, j;
+
+    best->cost = -1;
+    best->u = u;
+    best->v = u;
+
+    for (i = 0; i < l->n; ++i)
+    {
+        int const* vi = &o->pm_faces[l->items[i] * 3];
+
+        for (k = 0; k < 3; ++k)
+        {
+            size_t v = (size_t)vi[k];
+            double q[10], cost;
+
+            if (v == u) continue;
+
+            for (j = 0; j < 10; ++j) {
+                q[j] = o->pm_quadrics[u * 10 + j] + o->pm_quadrics[v * 10 + j];
+            }
+
+            cost = pm_quadric_error(q, &o->vertices[v]);
+
+            if ((best->cost < 0 || cost < best->cost) &&
+                pm_collapse_valid(o, u, v))
+            {
+                best->cost = cost;
+                best->v = v;
+            }
+        }
+    }
+}
+
+/*
+ * queues the cheapest valid collapse of u into one of its neighbours.
+ * bumping u's stamp retires whatever was queued for it before
+ */
+static
+int pm_best(obj2h_t* o, size_t u)
+{
+    pm_list_t* l = &o->pm_vertex_faces[u];
+    pm_candidate_t best;
+    size_t i, n = 0;
+
+    /* faces only ever die, so u's list can lose them for good */
+    for (i = 0; i < l->n; ++i) {
+        if (o->pm_face_alive[l->items[i]]) l->items[n++] = l->items[i];
+    }
+
+    l->n = n;
+    pm_cheapest(o, u, &best);
+    best.stamp = ++o->pm_stamps[u];
+
+    return best.cost >= 0 ? pm_heap_push(o, &best) : 0;
+}
+
+struct pm_job { obj2h_t* o; pm_candidate_t* best; };
+typedef struct pm_job pm_job_t;
+
+static
+int pm_first_candidates(void* ctx, size_t first, size_t last)
+{
+    pm_job_t* j = ctx;
+    size_t u;
+
+    for (u = first; u < last; ++u) {
+        pm_cheapest(j->o, u, &j->best[u]);
+    }
+
+    return 0;
+}
+
+/* drops retired candidates once they outnumber the live ones */
+static
+void pm_heap_compact(obj2h_t* o, unsigned char const* alive)
+{
+    size_t i, n = 0;
+
+    for (i = 0; i < o->npm_heap; ++i)
+    {
+        pm_candidate_t const* c = &o->pm_heap[i];
+
+        if (alive[c->u] && c->stamp == o->pm_stamps[c->u]) {
+            o->pm_heap[n++] = *c;
+        }
+    }
+
+    o->npm_heap = n;
+
+    for (i = n / 2; i-- > 0;) {
+        pm_heap_down(o, i);
+    }
+}
+
+/* planes through boundary edges, perpendicular to their face */
+static
+int pm_boundary_quadrics(obj2h_t* o)
+{
+    corner_t* edges = malloc(sizeof(corner_t) * (o->nfaces * 3 + 1));
+    size_t nedges = 0, i, j;
+
+    if (!edges) {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    /* vertex_index, uv_index hold the sorted edge, normal_index the face */
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        int const* vi = &o->pm_faces[i * 3];
+        int k;
+
+        if (!o->pm_face_alive[i]) continue;
+
+        for (k = 0; k < 3; ++k)
+        {
+            int a = vi[k], b = vi[(k + 1) % 3];
+
+            edges[nedges].vertex_index = a < b ? a : b;
+            edges[nedges].uv_index = a < b ? b : a;
+            edges[nedges].normal_index = (int)(i * 3 + k);
+            ++nedges;
+        }
+    }
+
+    if (parallel_sort(o, edges, nedges, sizeof(corner_t), corner_cmp))
+    {
+        free(edges);
+        return 1;
+    }
+
+    for (i = 0; i < nedges; i = j)
+    {
+        int const* vi;
+        vec3_t n, e, p;
+        vec3_t const* a;
+        vec3_t const* b;
+        float len;
+        int k;
+
+        for (j = i + 1; j < nedges &&
+            edges[j].vertex_index == edges[i].vertex_index &&
+            edges[j].uv_index == edges[i].uv_index; ++j);
+
+        if (j - i != 1) continue;
+
+        vi = &o->pm_faces[edges[i].normal_index / 3 * 3];
+        k = edges[i].normal_index % 3;
+        a = &o->vertices[vi[k]];
+        b = &o->vertices[vi[(k + 1) % 3]];
+
+        pm_face_normal(o, vi, &n);
+        e.x = b->x - a->x;
+        e.y = b->y - a->y;
+        e.z = b->z - a->z;
+
+        p.x = e.y * n.z - e.z * n.y;
+        p.y = e.z * n.x - e.x * n.z;
+        p.z = e.x * n.y - e.y * n.x;
+        len = sqrtf(p.x * p.x + p.y * p.y + p.z * p.z);
+        if (len == 0) continue;
+
+        p.x /= len;
+        p.y /= len;
+        p.z /= len;
+
+        for (k = 0; k < 2; ++k)
+        {
+            size_t x = (size_t)(k ? edges[i].uv_index : edges[i].vertex_index);
+
+            pm_quadric_plane(&o->pm_quadrics[x * 10], p.x, p.y, p.z,
+                -(p.x * a->x + p.y * a->y + p.z * a->z),
+                PM_BOUNDARY_WEIGHT * (e.x * e.x + e.y * e.y + e.z * e.z));
+        }
+    }
+
+    free(edges);
+
+    return 0;
+}
+
+/* quadrics of every vertex and the first candidates */
+static
+int pm_init(obj2h_t* o)
+{
+    pm_job_t j;
+    size_t i;
+    int k;
+
+    o->pm_vertex_faces = calloc(o->nvertices + 1, sizeof(pm_list_t));
+    o->pm_face_alive = calloc(o->nfaces + 1, 1);
+    o->pm_faces = malloc(sizeof(int) * (o->nfaces * 3 + 1));
+    o->pm_quadrics = calloc(o->nvertices * 10 + 1, sizeof(double));
+    o->pm_stamps = calloc(o->nvertices + 1, sizeof(unsigned));
+    o->pm_removed_by = malloc(sizeof(size_t) * (o->nfaces + 1));
+    o->pm_alive = malloc(o->nvertices + 1);
+    o->pm_mark = calloc(o->nvertices + 1, sizeof(size_t));
+    o->pm_removed = malloc(sizeof(size_t) * (o->nfaces + 1));
+    o->pm_appear = malloc(sizeof(int) * (o->nfaces * 3 + 1));
+
+    if (!o->pm_vertex_faces || !o->pm_face_alive || !o->pm_faces ||
+        !o->pm_quadrics || !o->pm_stamps || !o->pm_removed_by ||
+        !o->pm_alive || !o->pm_mark || !o->pm_removed || !o->pm_appear)
+    {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    memset(o->pm_alive, 1, o->nvertices);
+    o->npm_alive = o->nvertices;
+    o->npm_alive_faces = 0;
+    o->npm_removed = 0;
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        int const* vi = o->faces[i].vertex_indices;
+        vec3_t nrm;
+        float len;
+
+        for (k = 0; k < 3; ++k)
+        {
+            if (vi[k] < 0 || (size_t)vi[k] >= o->nvertices)
+            {
+                eprintf(o, "progressive: face %zd has no vertex %d\n",
+                    i, k);
+                return 1;
+            }
+
+            o->pm_faces[i * 3 + k] = vi[k];
+        }
+
+        o->pm_removed_by[i] = (size_t)-1;
+
+        /* already degenerate faces never come back */
+        if (vi[0] == vi[1] || vi[1] == vi[2] || vi[0] == vi[2])
+        {
+            memcpy(&o->pm_appear[i * 3], vi, sizeof(int) * 3);
+            o->pm_removed_by[i] = (size_t)-2;
+            continue;
+        }
+
+        o->pm_face_alive[i] = 1;
+        ++o->npm_alive_faces;
+
+        for (k = 0; k < 3; ++k) {
+            if (pm_list_add(&o->pm_vertex_faces[vi[k]], i)) return 1;
+        }
+
+        pm_face_normal(o, vi, &nrm);
+        len = sqrtf(nrm.x * nrm.x + nrm.y * nrm.y + nrm.z * nrm.z);
+        if (len == 0) continue;
+
+        /* area weighted planes */
+        for (k = 0; k < 3; ++k)
+        {
+            vec3_t const* p = &o->vertices[vi[0]];
+
+            pm_quadric_plane(&o->pm_quadrics[vi[k] * 10], nrm.x / len,
+                nrm.y / len, nrm.z / len, -(nrm.x * p->x + nrm.y * p->y +
+                nrm.z * p->z) / len, len / 2);
+        }
+    }
+
+    if (pm_boundary_quadrics(o)) return 1;
+
+    /*
+     * no face is dead yet, so this is pm_best on every vertex with the
+     * costs worked out in parallel and queued in order
+     */
+    j.o = o;
+    j.best = malloc(sizeof(pm_candidate_t) * (o->nvertices + 1));
+
+    if (!j.best) {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    parallel_for(o, o->nvertices, PARALLEL_GRAIN, pm_first_candidates, &j);
+
+    /* unused vertices can't be collapsed, they stay in the base mesh */
+    for (i = 0; i < o->nvertices; ++i)
+    {
+        j.best[i].stamp = ++o->pm_stamps[i];
+
+        if (j.best[i].cost >= 0 && pm_heap_push(o, &j.best[i]))
+        {
+            free(j.best);
+            return 1;
+        }
+    }
+
+    free(j.best);
+
+    return 0;
+}
+
+/*
+ * collapses until target faces are left or nothing more can go. with a
+ * target of 0 stray vertices are collapsed too once the faces are gone
+ */
+static
+int pm_simplify(obj2h_t* o, size_t target)
+{
+    int k;
+
+    while (o->npm_heap && (o->npm_alive_faces > target || !target))
+    {
+        pm_candidate_t c = pm_heap_pop(o);
+        pm_collapse_t* col;
+        pm_list_t* lu;
+        size_t u = c.u, v = c.v, j;
+
+        if (!o->pm_alive[u] || c.stamp != o->pm_stamps[u]) continue;
+
+        if (!o->pm_alive[v] || !pm_collapse_valid(o, u, v))
+        {
+            if (pm_best(o, u)) return 1;
+            continue;
+        }
+
+        col = push_back(sizeof(pm_collapse_t), (void**)&o->pm_collapses,
+            &o->npm_collapses, &o->pm_collapses_cap);
+        if (!col) return 1;
+
+        col->u = u;
+        col->v = v;
+        col->first_corner = o->npm_corners;
+        lu = &o->pm_vertex_faces[u];
+
+        for (j = 0; j < lu->n; ++j)
+        {
+            size_t f = lu->items[j];
+            int* vi = &o->pm_faces[f * 3];
+            int had_v = vi[0] == (int)v || vi[1] == (int)v ||
+                vi[2] == (int)v;
+
+            if (!o->pm_face_alive[f]) continue;
+
+            if (had_v)
+            {
+                memcpy(&o->pm_appear[f * 3], vi, sizeof(int) * 3);
+                o->pm_face_alive[f] = 0;
+                o->pm_removed_by[f] = o->npm_collapses - 1;
+                o->pm_removed[o->npm_removed++] = f;
+                --o->npm_alive_faces;
+                continue;
+            }
+
+            for (k = 0; k < 3; ++k)
+            {
+                size_t* p;
+
+                if (vi[k] != (int)u) continue;
+
+                p = push_back(sizeof(size_t), (void**)&o->pm_corners,
+                    &o->npm_corners, &o->pm_corners_cap);
+                if (!p) return 1;
+
+                *p = f * 3 + k;
+                vi[k] = (int)v;
+            }
+
+            if (pm_list_add(&o->pm_vertex_faces[v], f)) return 1;
+        }
+
+        col->ncorners = o->npm_corners - col->first_corner;
+
+        for (k = 0; k < 10; ++k) {
+            o->pm_quadrics[v * 10 + k] += o->pm_quadrics[u * 10 + k];
+        }
+
+        o->pm_alive[u] = 0;
+        --o->npm_alive;
+
+        free(lu->items);
+        memset(lu, 0, sizeof(*lu));
+
+        /* v's quadric and every face around it changed */
+        if (pm_best(o, v)) return 1;
+
+        for (j = 0; j < o->pm_vertex_faces[v].n; ++j)
+        {
+            size_t f = o->pm_vertex_faces[v].items[j];
+
+            if (!o->pm_face_alive[f]) continue;
+
+            for (k = 0; k < 3; ++k)
+            {
+                size_t x = (size_t)o->pm_faces[f * 3 + k];
+
+                if (x == v || o->pm_mark[x] == o->npm_collapses) continue;
+                o->pm_mark[x] = o->npm_collapses;
+                if (pm_best(o, x)) return 1;
+            }
+        }
+
+        if (o->npm_heap > o->npm_alive * 4 + 1024) {
+            pm_heap_compact(o, o->pm_alive);
+        }
+    }
+
+    return 0;
+}
+
+/* everything but what print_progressive needs */
+static
+void pm_free(obj2h_t* o)
+{
+    size_t i;
+
+    for (i = 0; o->pm_vertex_faces && i < o->nvertices; ++i) {
+        free(o->pm_vertex_faces[i].items);
+    }
+
+    free(o->pm_vertex_faces);
+    free(o->pm_face_alive);
+    free(o->pm_faces);
+    free(o->pm_quadrics);
+    free(o->pm_stamps);
+    free(o->pm_heap);
+    o->pm_vertex_faces = 0;
+    o->pm_face_alive = 0;
+    o->pm_faces = 0;
+    o->pm_quadrics = 0;
+    o->pm_stamps = 0;
+    o->pm_heap = 0;
+    o->npm_heap = o->pm_heap_cap = 0;
+    free(o->pm_removed_by);
+    free(o->pm_alive);
+    free(o->pm_mark);
+    free(o->pm_removed);
+    o->pm_removed_by = 0;
+    o->pm_alive = 0;
+    o->pm_mark = 0;
+    o->pm_removed = 0;
+}
+
+/*
+ * collapses the mesh down as far as it goes, then reorders vertices and
+ * faces so every level is a prefix and rewrites the recorded corners to
+ * the new face order
+ */
+static
+int build_progressive(obj2h_t* o)
+{
+    size_t* vertex_order;
+    size_t* face_order;
+    size_t* remap;
+    face_t* sorted;
+    vec3_t* sorted_vertices;
+    size_t i, n;
+    int k;
+
+    if (pm_init(o) || pm_simplify(o, 0)) return 1;
+
+    /* base vertices, then the collapsed ones latest first */
+    vertex_order = malloc(sizeof(size_t) * (o->nvertices + 1));
+    face_order = malloc(sizeof(size_t) * (o->nfaces + 1));
+    remap = malloc(sizeof(size_t) * (o->nfaces + o->nvertices + 1));
+    sorted = malloc(sizeof(face_t) * (o->nfaces + 1));
+    sorted_vertices = malloc(sizeof(vec3_t) * (o->nvertices + 1));
+    o->pm_split_nfaces = malloc(sizeof(size_t) * (o->npm_collapses + 1));
+
+    if (!vertex_order || !face_order || !remap || !sorted ||
+        !sorted_vertices || !o->pm_split_nfaces)
+    {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    n = 0;
+    for (i = 0; i < o->nvertices; ++i) {
+        if (o->pm_alive[i]) vertex_order[n++] = i;
+    }
+
+    o->pm_nbase_vertices = n;
+
+    for (i = o->npm_collapses; i-- > 0;) {
+        vertex_order[n++] = o->pm_collapses[i].u;
+    }
+
+    /* faces by the collapse that removed them, latest first */
+    n = 0;
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        if (o->pm_removed_by[i] == (size_t)-1)
+        {
+            memcpy(&o->pm_appear[i * 3], &o->pm_faces[i * 3], sizeof(int) * 3);
+            face_order[n++] = i;
+        }
+    }
+
+    o->pm_nbase_faces = n;
+
+    for (i = o->npm_collapses; i-- > 0;)
+    {
+        while (o->npm_removed &&
+            o->pm_removed_by[o->pm_removed[o->npm_removed - 1]] == i)
+        {
+            face_order[n++] = o->pm_removed[--o->npm_removed];
+        }
+
+        o->pm_split_nfaces[o->npm_collapses - 1 - i] = n;
+    }
+
+    for (i = 0; i < o->nfaces; ++i) {
+        if (o->pm_removed_by[i] == (size_t)-2) face_order[n++] = i;
+    }
+
+    /* vertices */
+    for (i = 0; i < o->nvertices; ++i) {
+        remap[vertex_order[i]] = i;
+    }
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        face_t* f = &sorted[i];
+
+        *f = o->faces[face_order[i]];
+
+        for (k = 0; k < 3; ++k) {
+            f->vertex_indices[k] = (int)remap[f->vertex_indices[k]];
+        }
+    }
+
+    /* snapshots go in the new face order with the new vertex indices */
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        int const* vi = &o->pm_appear[face_order[i] * 3];
+
+        for (k = 0; k < 3; ++k) {
+            o->pm_faces[i * 3 + k] = (int)remap[vi[k]];
+        }
+    }
+
+    memcpy(o->pm_appear, o->pm_faces, sizeof(int) * o->nfaces * 3);
+
+    if (attributes_permute(o, 0, remap, o->nvertices)) return 1;
+
+    for (i = 0; i < o->nvertices; ++i) {
+        sorted_vertices[i] = o->vertices[vertex_order[i]];
+    }
+
+    free(o->vertices);
+    o->vertices = sorted_vertices;
+    o->vertices_cap = o->nvertices + 1;
+
+    for (i = 0; i < o->npm_collapses; ++i) {
+        o->pm_collapses[i].v = remap[o->pm_collapses[i].v];
+    }
+
+    /* corners */
+    for (i = 0; i < o->nfaces; ++i) {
+        remap[face_order[i]] = i;
+    }
+
+    for (i = 0; i < o->npm_corners; ++i)
+    {
+        size_t c = o->pm_corners[i];
+        o->pm_corners[i] = remap[c / 3] * 3 + c % 3;
+    }
+
+    free(o->faces);
+    o->faces = sorted;
+    o->faces_cap = o->nfaces + 1;
+
+    eprintf(o, "progressive: base %zd vertices, %zd faces, %zd "
+        "splits, %zd corners\n", o->pm_nbase_vertices, o->pm_nbase_faces,
+        o->npm_collapses, o->npm_corners);
+
+    pm_free(o);
+    free(vertex_order);
+    free(face_order);
+    free(remap);
+
+    return 0;
+}
+
+static
+void print_progressive(obj2h_t* o, char const* array_name)
+{
+    size_t nused = o->npm_collapses ? o->pm_split_nfaces[o->npm_collapses - 1] :
+        o->pm_nbase_faces;
+    size_t i;
+
+    oputs(o, "#ifndef OBJ2H_PM_TYPES");
+    oputs(o, "#define OBJ2H_PM_TYPES");
+    oputs(o, "struct obj2h_pm_split");
+    oputs(o, "{");
+    oputs(o, "    uint32_t parent;   /* vertex the new one splits off from */");
+    oputs(o, "    uint32_t nfaces;   /* faces in use once this split is "
+        "applied */");
+    oputs(o, "    uint32_t first_corner, ncorners; /* into corners, face * 3 "
+        "+ corner */");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_pm_split obj2h_pm_split_t;");
+    oputs(o, "struct obj2h_pm");
+    oputs(o, "{");
+    oputs(o, "    uint32_t nbase_vertices, nbase_faces;");
+    oputs(o, "    uint32_t nsplits;");
+    oputs(o, "    obj2h_pm_split_t const* splits;");
+    oputs(o, "    uint32_t const* corners;");
+    oputs(o, "    uint32_t const* face_vertices; /* 3 per face past the base "
+        "*/");
+    oputs(o, "    face_t const* faces; /* full detail */");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_pm obj2h_pm_t;");
+    oputs(o, "#endif /* !OBJ2H_PM_TYPES */\n");
+
+    oprintf(o, "static obj2h_pm_split_t const %s_pm_splits[] = {\n",
+        array_name);
+
+    /* split s undoes collapse npm_collapses - 1 - s */
+    for (i = 0; i < o->npm_collapses; ++i)
+    {
+        pm_collapse_t const* c = &o->pm_collapses[o->npm_collapses - 1 - i];
+
+        oprintf(o, "    { %zd, %zd, %zd, %zd },\n", c->v, o->pm_split_nfaces[i],
+            c->first_corner, c->ncorners);
+    }
+
+    oputs(o, "};\n");
+
+    oprintf(o, "static uint32_t const %s_pm_corners[] = {\n", array_name);
+
+    for (i = 0; i < o->npm_corners; ++i)
+    {
+        oprintf(o, "%s%zd,", i % 12 ? " " : "    ", o->pm_corners[i]);
+        if (i % 12 == 11 || i == o->npm_corners - 1) oputs(o, "");
+    }
+
+    oputs(o, "};\n");
+
+    oprintf(o, "static uint32_t const %s_pm_face_vertices[] = {\n",
+        array_name);
+
+    for (i = o->pm_nbase_faces; i < nused; ++i)
+    {
+        int const* vi = &o->pm_appear[i * 3];
+        oprintf(o, "    %d, %d, %d,\n", vi[0], vi[1], vi[2]);
+    }
+
+    oputs(o, "};\n");
+
+    oprintf(o, "static obj2h_pm_t const %s_pm = {\n", array_name);
+    oprintf(o, "    %zd, %zd, %zd,\n", o->pm_nbase_vertices, o->pm_nbase_faces,
+        o->npm_collapses);
+    oprintf(o, "    %s_pm_splits, %s_pm_corners, %s_pm_face_vertices, "
+        "%s_faces\n", array_name, array_name, array_name, array_name);
+    oputs(o, "};\n");
+}
+
+/* impostors ----------------------------------------------------------- */
+
+/*
+ * the model is rendered with a small z-buffered rasterizer, orthographic
+ * and fitted to its bounding sphere, once per view into its own cell of
+ * the atlas. every texel is IMPOSTOR_SUPERSAMPLE^2 samples whose
+ * coverage decides alpha, so silhouettes don't crawl
+ */
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+
+#define IMPOSTOR_SUPERSAMPLE 4
+#define IMPOSTOR_AMBIENT 0.25f
+#define IMPOSTOR_MAX_SIZE 1024
+
+struct impostor_sample { float depth; vec3_t n; };
+typedef struct impostor_sample impostor_sample_t;
+
+static
+void normalize3(vec3_t* v)
+{
+    float len = sqrtf(v->x * v->x + v->y * v->y + v->z * v->z);
+
+    if (len > 0)
+    {
+        v->x /= len;
+        v->y /= len;
+        v->z /= len;
+    }
+}
+
+static
+float dot3(vec3_t const* a, vec3_t const* b)
+{
+    return a->x * b->x + a->y * b->y + a->z * b->z;
+}
+
+static
+void cross3(vec3_t const* a, vec3_t const* b, vec3_t* c)
+{
+    c->x = a->y * b->z - a->z * b->y;
+    c->y = a->z * b->x - a->x * b->z;
+    c->z = a->x * b->y - a->y * b->x;
+}
+
+struct impostor_job
+{
+    obj2h_t* o;
+    vec3_t* face_normals;
+    vec3_t* vertex_normals;
+};
+
+typedef struct impostor_job impostor_job_t;
+
+/* area weighted, 0 for faces with a missing vertex */
+static
+int impostor_face_normals(void* ctx, size_t first, size_t last)
+{
+    impostor_job_t* j = ctx;
+    obj2h_t* o = j->o;
+    size_t i;
+    int k;
+
+    for (i = first; i < last; ++i)
+    {
+        int const* vi = o->faces[i].vertex_indices;
+        vec3_t e0, e1;
+
+        memset(&j->face_normals[i], 0, sizeof(vec3_t));
+
+        for (k = 0; k < 3; ++k) {
+            if (vi[k] < 0 || (size_t)vi[k] >= o->nvertices) break;
+        }
+
+        if (k < 3) continue;
+
+        e0.x = o->vertices[vi[1]].x - o->vertices[vi[0]].x;
+        e0.y = o->vertices[vi[1]].y - o->vertices[vi[0]].y;
+        e0.z = o->vertices[vi[1]].z - o->vertices[vi[0]].z;
+        e1.x = o->vertices[vi[2]].x - o->vertices[vi[0]].x;
+        e1.y = o->vertices[vi[2]].y - o->vertices[vi[0]].y;
+        e1.z = o->vertices[vi[2]].z - o->vertices[vi[0]].z;
+        cross3(&e0, &e1, &j->face_normals[i]);
+    }
+
+    return 0;
+}
+
+static
+int impostor_normalize(void* ctx, size_t first, size_t last)
+{
+    impostor_job_t* j = ctx;
+    size_t i;
+
+    for (i = first; i < last; ++i) {
+        normalize3(&j->vertex_normals[i]);
+    }
+
+    return 0;
+}
+
+/*
+ * smooth normals from the positions, so lighting doesn't depend on
+ * whatever normals the file had or which space they were in. the y flip
+ * reverses the winding, so they point into the model. the sums go face
+ * by face on one thread, so they add up the same every time
+ */
+static
+vec3_t* smooth_normals(obj2h_t* o)
+{
+    impostor_job_t j;
+    size_t i;
+    int k;
+
+    j.o = o;
+    j.face_normals = malloc(sizeof(vec3_t) * (o->nfaces + 1));
+    j.vertex_normals = calloc(o->nvertices + 1, sizeof(vec3_t));
+
+    if (!j.face_normals || !j.vertex_normals)
+    {
+        eperror(o, "malloc");
+        free(j.face_normals);
+        free(j.vertex_normals);
+        return 0;
+    }
+
+    parallel_for(o, o->nfaces, PARALLEL_GRAIN, impostor_face_normals, &j);
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        int const* vi = o->faces[i].vertex_indices;
+        vec3_t const* fn = &j.face_normals[i];
+
+        for (k = 0; k < 3; ++k) {
+            if (vi[k] < 0 || (size_t)vi[k] >= o->nvertices) break;
+        }
+
+        if (k < 3) continue;
+
+        for (k = 0; k < 3; ++k)
+        {
+            j.vertex_normals[vi[k]].x += fn->x;
+            j.vertex_normals[vi[k]].y += fn->y;
+            j.vertex_normals[vi[k]].z += fn->z;
+        }
+    }
+
+    parallel_for(o, o->nvertices, PARALLEL_GRAIN, impostor_normalize, &j);
+    free(j.face_normals);
+
+    return j.vertex_normals;
+}
+
+/* rasterizes every face seen from dir into size^2 samples */
+static
+void impostor_rasterize(obj2h_t* o, vec3_t const* dir,
+    vec3_t const* vertex_normals, impostor_sample_t* samples, size_t size)
+{
+    vec3_t down = { 0, 1, 0 }, right, forward;
+    float scale = size / (2 * o->impostor_radius);
+    size_t i;
+    int k;
+
+    /*
+     * model up is -y, straight down views use z as their down, picked
+     * to match the views just next to them
+     */
+    if (fabsf(dir->y) > 0.999f)
+    {
+        down.y = 0;
+        down.z = dir->y > 0 ? -1 : 1;
+    }
+
+    /* +x on the right seen from +z, like the demos' camera */
+    forward.x = -dir->x;
+    forward.y = -dir->y;
+    forward.z = -dir->z;
+    cross3(&forward, &down, &right);
+    normalize3(&right);
+    cross3(&right, &forward, &down);
+
+    for (i = 0; i < size * size; ++i) {
+        samples[i].depth = INFINITY;
+    }
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        int const* vi = o->faces[i].vertex_indices;
+        float x[3], y[3], z[3], area;
+        long x0, y0, x1, y1, px, py;
+
+        for (k = 0; k < 3; ++k)
+        {
+            vec3_t p;
+
+            if (vi[k] < 0 || (size_t)vi[k] >= o->nvertices) break;
+
+            p.x = o->vertices[vi[k]].x - o->impostor_center.x;
+            p.y = o->vertices[vi[k]].y - o->impostor_center.y;
+            p.z = o->vertices[vi[k]].z - o->impostor_center.z;
+
+            x[k] = dot3(&p, &right) * scale + size / 2.0f;
+            y[k] = dot3(&p, &down) * scale + size / 2.0f;
+            z[k] = dot3(&p, &forward);
+        }
+
+        if (k < 3) continue;
+
+        area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+        if (area == 0) continue;
+
+        x0 = (long)floorf(fminf(x[0], fminf(x[1], x[2])));
+        y0 = (long)floorf(fminf(y[0], fminf(y[1], y[2])));
+        x1 = (long)ceilf(fmaxf(x[0], fmaxf(x[1], x[2])));
+        y1 = (long)ceilf(fmaxf(y[0], fmaxf(y[1], y[2])));
+        x0 = x0 < 0 ? 0 : x0;
+        y0 = y0 < 0 ? 0 : y0;
+        x1 = x1 > (long)size ? (long)size : x1;
+        y1 = y1 > (long)size ? (long)size : y1;
+
+        /* both windings are drawn, impostors have no back */
+        for (py = y0; py < y1; ++py)
+        {
+            for (px = x0; px < x1; ++px)
+            {
+                float sx = px + 0.5f, sy = py + 0.5f;
+                float w0 = ((x[1] - sx) * (y[2] - sy) -
+                    (x[2] - sx) * (y[1] - sy)) / area;
+                float w1 = ((x[2] - sx) * (y[0] - sy) -
+                    (x[0] - sx) * (y[2] - sy)) / area;
+                float w2 = 1 - w0 - w1;
+                impostor_sample_t* s = &samples[py * size + px];
+                float depth;
+
+                if (w0 < 0 || w1 < 0 || w2 < 0) continue;
+
+                depth = w0 * z[0] + w1 * z[1] + w2 * z[2];
+                if (depth >= s->depth) continue;
+
+                s->depth = depth;
+                s->n.x = w0 * vertex_normals[vi[0]].x +
+                    w1 * vertex_normals[vi[1]].x +
+                    w2 * vertex_normals[vi[2]].x;
+                s->n.y = w0 * vertex_normals[vi[0]].y +
+                    w1 * vertex_normals[vi[1]].y +
+                    w2 * vertex_normals[vi[2]].y;
+                s->n.z = w0 * vertex_normals[vi[0]].z +
+                    w1 * vertex_normals[vi[1]].z +
+                    w2 * vertex_normals[vi[2]].z;
+            }
+        }
+    }
+}
+
+/* averages the covered samples of every texel of a view into its cell */
+static
+void impostor_resolve(obj2h_t* o, size_t view, vec3_t const* dir,
+    impostor_sample_t const* samples)
+{
+    static vec3_t const light_dir = { 0.3f, -0.8f, 0.5f };
+    size_t cell = (size_t)o->opt_impostor_cell;
+    size_t size = cell * IMPOSTOR_SUPERSAMPLE;
+    size_t ox = view % o->impostor_cols * cell;
+    size_t oy = view / o->impostor_cols * cell;
+    vec3_t light = light_dir;
+    size_t tx, ty;
+    int sx, sy;
+
+    normalize3(&light);
+
+    for (ty = 0; ty < cell; ++ty)
+    {
+        for (tx = 0; tx < cell; ++tx)
+        {
+            vec3_t n = { 0, 0, 0 };
+            float lum = 0;
+            int covered = 0;
+            unsigned l;
+            size_t t = (oy + ty) * o->impostor_width + ox + tx;
+
+            for (sy = 0; sy < IMPOSTOR_SUPERSAMPLE; ++sy)
+            {
+                for (sx = 0; sx < IMPOSTOR_SUPERSAMPLE; ++sx)
+                {
+                    impostor_sample_t const* s = &samples[
+                        (ty * IMPOSTOR_SUPERSAMPLE + sy) * size +
+                        tx * IMPOSTOR_SUPERSAMPLE + sx];
+                    vec3_t sn;
+                    float d;
+
+                    if (s->depth == INFINITY) continue;
+
+                    /* whichever side faces the camera is lit */
+                    sn = s->n;
+                    normalize3(&sn);
+
+                    if (dot3(&sn, dir) < 0)
+                    {
+                        sn.x = -sn.x;
+                        sn.y = -sn.y;
+                        sn.z = -sn.z;
+                    }
+
+                    d = dot3(&sn, &light);
+                    lum += IMPOSTOR_AMBIENT +
+                        (1 - IMPOSTOR_AMBIENT) * (d < 0 ? 0 : d);
+                    n.x += sn.x;
+                    n.y += sn.y;
+                    n.z += sn.z;
+                    ++covered;
+                }
+            }
+
+            if (covered * 2 < IMPOSTOR_SUPERSAMPLE * IMPOSTOR_SUPERSAMPLE)
+            {
+                o->impostor_color[t] = 0;
+                if (o->impostor_normal) o->impostor_normal[t] = 0;
+                continue;
+            }
+
+            l = (unsigned)(lum / covered * 31 + 0.5f);
+            o->impostor_color[t] = (unsigned short)(0x8000 | l << 10 | l << 5 |
+                l);
+
+            if (o->impostor_normal)
+            {
+                normalize3(&n);
+                o->impostor_normal[t] = (unsigned short)(
+                    (unsigned)((n.x * 0.5f + 0.5f) * 31 + 0.5f) << 11 |
+                    (unsigned)((n.y * 0.5f + 0.5f) * 63 + 0.5f) << 5 |
+                    (unsigned)((n.z * 0.5f + 0.5f) * 31 + 0.5f));
+            }
+        }
+    }
+}
+
+static
+size_t next_pow2(size_t x)
+{
+    size_t p = 1;
+    while (p < x) p *= 2;
+    return p;
+}
+
+/* views are rendered on their own threads into their own atlas cells */
+static
+int impostor_views(void* ctx, size_t first, size_t last)
+{
+    impostor_job_t* j = ctx;
+    obj2h_t* o = j->o;
+    size_t size = (size_t)o->opt_impostor_cell * IMPOSTOR_SUPERSAMPLE;
+    impostor_sample_t* samples;
+    size_t i;
+
+    samples = malloc(sizeof(impostor_sample_t) * size * size);
+    if (!samples) {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    for (i = first; i < last; ++i)
+    {
+        double azimuth = 2 * M_PI * (i % o->opt_impostor_views) /
+            o->opt_impostor_views;
+        double elevation = M_PI / 2 * (i / o->opt_impostor_views) /
+            o->opt_impostor_rings;
+        vec3_t* d = &o->impostor_dirs[i];
+
+        /* up is -y */
+        d->x = (float)(sin(azimuth) * cos(elevation));
+        d->y = (float)-sin(elevation) + 0.0f;
+        d->z = (float)(cos(azimuth) * cos(elevation));
+
+        impostor_rasterize(o, d, j->vertex_normals, samples, size);
+        impostor_resolve(o, i, d, samples);
+    }
+
+    free(samples);
+
+    return 0;
+}
+
+/*
+ * renders opt_impostor_views directions per ring, rings going from the
+ * horizon up towards the top
+ */
+static
+int build_impostor(obj2h_t* o)
+{
+    size_t nviews = (size_t)o->opt_impostor_views * o->opt_impostor_rings;
+    size_t cell = (size_t)o->opt_impostor_cell;
+    impostor_job_t j;
+    size_t rows;
+    int err;
+
+    o->impostor_cols = next_pow2((size_t)ceil(sqrt((double)nviews)));
+    rows = next_pow2((nviews + o->impostor_cols - 1) / o->impostor_cols);
+    o->impostor_width = o->impostor_cols * cell;
+    o->impostor_height = rows * cell;
+
+    if (o->impostor_width > IMPOSTOR_MAX_SIZE ||
+        o->impostor_height > IMPOSTOR_MAX_SIZE)
+    {
+        eprintf(o, "impostor: a %zdx%zd atlas is too big for the "
+            "pvr, use fewer views or a smaller cell\n", o->impostor_width,
+            o->impostor_height);
+        return 1;
+    }
+
+    o->impostor_radius = bounding_sphere(o, o->vertices, o->nvertices,
+        &o->impostor_center);
+    if (o->impostor_radius <= 0) o->impostor_radius = 1;
+
+    o->impostor_color = calloc(o->impostor_width * o->impostor_height,
+        sizeof(unsigned short));
+    o->impostor_normal = o->opt_impostor_normals ? calloc(o->impostor_width *
+        o->impostor_height, sizeof(unsigned short)) : 0;
+    o->impostor_dirs = malloc(sizeof(vec3_t) * nviews);
+    j.o = o;
+    j.vertex_normals = smooth_normals(o);
+
+    if (!o->impostor_color ||
+        (o->opt_impostor_normals && !o->impostor_normal) ||
+        !o->impostor_dirs || !j.vertex_normals)
+    {
+        eperror(o, "malloc");
+        free(j.vertex_normals);
+        return 1;
+    }
+
+    err = parallel_for(o, nviews, 1, impostor_views, &j);
+    free(j.vertex_normals);
+
+    if (!err) {
+        eprintf(o, "impostor: %zd views, %zdx%zd atlas\n", nviews,
+            o->impostor_width, o->impostor_height);
+    }
+
+    return err;
+}
+
+static
+void print_texels(obj2h_t* o, unsigned short const* t, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n; ++i)
+    {
+        oprintf(o, "%s0x%04x,", i % 10 ? " " : "    ", t[i]);
+        if (i % 10 == 9 || i == n - 1) oputs(o, "");
+    }
+}
+
+static
+void print_impostor(obj2h_t* o, char const* array_name)
+{
+    size_t nviews = (size_t)o->opt_impostor_views * o->opt_impostor_rings;
+    size_t cell = (size_t)o->opt_impostor_cell;
+    size_t ntexels = o->impostor_width * o->impostor_height;
+    size_t i;
+
+    oputs(o, "#ifndef OBJ2H_IMPOSTOR_TYPES");
+    oputs(o, "#define OBJ2H_IMPOSTOR_TYPES");
+    oputs(o, "struct obj2h_impostor_view");
+    oputs(o, "{");
+    oputs(o, "    float dir[3]; /* from the model towards the camera it was "
+        "baked with */");
+    oputs(o, "    float u0, v0, u1, v1;");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_impostor_view obj2h_impostor_view_t;");
+    oputs(o, "struct obj2h_impostor");
+    oputs(o, "{");
+    oputs(o, "    uint32_t width, height; /* of the atlas */");
+    oputs(o, "    uint32_t cell;          /* size of one view in texels */");
+    oputs(o, "    float center[3], radius; /* the quad covers this sphere */");
+    oputs(o, "    uint32_t nviews;");
+    oputs(o, "    obj2h_impostor_view_t const* views;");
+    oputs(o, "    uint16_t const* color;");
+    oputs(o, "    uint16_t const* normal; /* null unless baked */");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_impostor obj2h_impostor_t;");
+    oputs(o, "#endif /* !OBJ2H_IMPOSTOR_TYPES */\n");
+
+    oprintf(o, "static obj2h_impostor_view_t const %s_impostor_views[] = {\n",
+        array_name);
+
+    for (i = 0; i < nviews; ++i)
+    {
+        vec3_t const* d = &o->impostor_dirs[i];
+        size_t x = i % o->impostor_cols * cell, y = i / o->impostor_cols * cell;
+
+        oprintf(o, "    { { %.9g, %.9g, %.9g }, %.9g, %.9g, %.9g, %.9g },\n",
+            d->x, d->y, d->z, (double)x / o->impostor_width,
+            (double)y / o->impostor_height,
+            (double)(x + cell) / o->impostor_width,
+            (double)(y + cell) / o->impostor_height);
+    }
+
+    oputs(o, "};\n");
+
+    /* ARGB1555, non twiddled */
+    oprintf(o, "static uint16_t const %s_impostor_color[]\n"
+        "__attribute__((aligned(32))) = {\n", array_name);
+    print_texels(o, o->impostor_color, ntexels);
+    oputs(o, "};\n");
+
+    if (o->impostor_normal)
+    {
+        /* RGB565 */
+        oprintf(o, "static uint16_t const %s_impostor_normal[]\n"
+            "__attribute__((aligned(32))) = {\n", array_name);
+        print_texels(o, o->impostor_normal, ntexels);
+        oputs(o, "};\n");
+    }
+
+    oprintf(o, "static obj2h_impostor_t const %s_impostor = {\n", array_name);
+    oprintf(o, "    %zd, %zd, %zd,\n", o->impostor_width, o->impostor_height,
+        cell);
+    oprintf(o, "    { %.9g, %.9g, %.9g }, %.9g,\n", o->impostor_center.x,
+        o->impostor_center.y, o->impostor_center.z, o->impostor_radius);
+    oprintf(o, "    %zd, %s_impostor_views, %s_impostor_color, ", nviews,
+        array_name, array_name);
+
+    if (o->impostor_normal) {
+        oprintf(o, "%s_impostor_normal\n", array_name);
+    } else {
+        oprintf(o, "0\n");
+    }
+
+    oputs(o, "};\n");
+}
+
+/* bvh ----------------------------------------------------------------- */
+
+#define BVH_BINS 16
+#define BVH_MAX_LEAF 8
+#define BVH_TRAVERSAL_COST 1.0f
+
+/* past this depth splits are by count, which bounds the tree's depth */
+#define BVH_SAH_DEPTH 32
+#define BVH_MAX_DEPTH (OBJ2H_BVH_STACK - 4)
+
+/* tree as built, children[0] < 0 for leaves */
+struct bvh_build
+{
+    bvh_box_t box;
+    int children[2];
+    size_t first, count;
+};
+
+typedef struct bvh_build bvh_build_t;
+
+static
+void bvh_box_empty(bvh_box_t* b)
+{
+    int i;
+
+    for (i = 0; i < 3; ++i)
+    {
+        b->min[i] = 1e30f;
+        b->max[i] = -1e30f;
+    }
+}
+
+static
+void bvh_box_grow(bvh_box_t* b, bvh_box_t const* other)
+{
+    int i;
+
+    for (i = 0; i < 3; ++i)
+    {
+        b->min[i] = other->min[i] < b->min[i] ? other->min[i] : b->min[i];
+        b->max[i] = other->max[i] > b->max[i] ? other->max[i] : b->max[i];
+    }
+}
+
+static
+float bvh_box_area(bvh_box_t const* b)
+{
+    float dx = b->max[0] - b->min[0];
+    float dy = b->max[1] - b->min[1];
+    float dz = b->max[2] - b->min[2];
+
+    if (dx < 0 || dy < 0 || dz < 0) return 0;
+
+    return 2 * (dx * dy + dy * dz + dz * dx);
+}
+
+static
+float bvh_centroid(obj2h_t* o, uint32_t face, int axis)
+{
+    bvh_box_t const* b = &o->bvh_face_boxes[face];
+    return (b->min[axis] + b->max[axis]) * 0.5f;
+}
+
+/* faces sorted along an axis, qsort has no way to pass the axis */
+struct bvh_key { float centroid; uint32_t face; };
+typedef struct bvh_key bvh_key_t;
+
+static
+int bvh_key_cmp(void const* a, void const* b)
+{
+    bvh_key_t const* ka = a;
+    bvh_key_t const* kb = b;
+
+    if (ka->centroid != kb->centroid) {
+        return ka->centroid < kb->centroid ? -1 : 1;
+    }
+
+    return ka->face < kb->face ? -1 : 1;
+}
+
+/*
+ * binned sah: centroids are dropped in BVH_BINS bins per axis and the
+ * cheapest plane between two bins wins. returns the number of faces
+ * that go left, 0 if a leaf is cheaper
+ */
+static
+size_t bvh_partition(obj2h_t* o, size_t first, size_t count,
+    bvh_box_t const* box, size_t depth)
+{
+    bvh_box_t centroids, bins[BVH_BINS], left;
+    size_t counts[BVH_BINS], i;
+    float best_cost = (float)count, cost, area = bvh_box_area(box);
+    float right_area[BVH_BINS];
+    size_t right_count[BVH_BINS];
+    int axis, best_axis = -1, best_bin = 0, b;
+    bvh_key_t* keys;
+
+    bvh_box_empty(&centroids);
+
+    for (i = first; i < first + count; ++i)
+    {
+        bvh_box_t c;
+
+        for (axis = 0; axis < 3; ++axis)
+        {
+            c.min[axis] = c.max[axis] =
+                bvh_centroid(o, o->bvh_indices[i], axis);
+        }
+
+        bvh_box_grow(&centroids, &c);
+    }
+
+    for (axis = 0; axis < 3 && depth < BVH_SAH_DEPTH && area > 0; ++axis)
+    {
+        float lo = centroids.min[axis], hi = centroids.max[axis];
+        float scale;
+        size_t left_count = 0;
+
+        if (hi <= lo) continue;
+        scale = BVH_BINS / (hi - lo);
+
+        for (b = 0; b < BVH_BINS; ++b)
+        {
+            bvh_box_empty(&bins[b]);
+            counts[b] = 0;
+        }
+
+        for (i = first; i < first + count; ++i)
+        {
+            uint32_t f = o->bvh_indices[i];
+            b = (int)((bvh_centroid(o, f, axis) - lo) * scale);
+            b = b < BVH_BINS ? b : BVH_BINS - 1;
+            bvh_box_grow(&bins[b], &o->bvh_face_boxes[f]);
+            ++counts[b];
+        }
+
+        bvh_box_empty(&left);
+
+        for (b = BVH_BINS - 1; b > 0; --b)
+        {
+            bvh_box_grow(&left, &bins[b]);
+            left_count += counts[b];
+            right_area[b] = bvh_box_area(&left);
+            right_count[b] = left_count;
+        }
+
+        bvh_box_empty(&left);
+        left_count = 0;
+
+        for (b = 0; b < BVH_BINS - 1; ++b)
+        {
+            bvh_box_grow(&left, &bins[b]);
+            left_count += counts[b];
+
+            if (!left_count || !right_count[b + 1]) continue;
+
+            cost = BVH_TRAVERSAL_COST + (bvh_box_area(&left) * left_count +
+                right_area[b + 1] * right_count[b + 1]) / area;
+
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                best_axis = axis;
+                best_bin = b;
+            }
+        }
+    }
+
+    if (best_axis < 0)
+    {
+        size_t half;
+
+        if (count <= BVH_MAX_LEAF) return 0;
+
+        /* all centroids in one spot or too deep, split the run in two */
+        half = count / 2;
+        if (depth < BVH_SAH_DEPTH) return half;
+
+        axis = 0;
+
+        for (b = 1; b < 3; ++b)
+        {
+            if (centroids.max[b] - centroids.min[b] >
+                centroids.max[axis] - centroids.min[axis])
+            {
+                axis = b;
+            }
+        }
+
+        /* sorted along the widest axis so the halves are compact */
+        keys = o->bvh_keys;
+
+        for (i = 0; i < count; ++i)
+        {
+            keys[i].face = o->bvh_indices[first + i];
+            keys[i].centroid = bvh_centroid(o, keys[i].face, axis);
+        }
+
+        qsort(keys, count, sizeof(bvh_key_t), bvh_key_cmp);
+
+        for (i = 0; i < count; ++i) {
+            o->bvh_indices[first + i] = keys[i].face;
+        }
+
+        return half;
+    }
+
+    /* the same binning as above, so both sides get what sah counted */
+    {
+        float lo = centroids.min[best_axis];
+        float scale = BVH_BINS / (centroids.max[best_axis] - lo);
+        size_t j = first + count;
+
+        i = first;
+
+        while (i < j)
+        {
+            b = (int)((bvh_centroid(o, o->bvh_indices[i], best_axis) - lo) *
+                scale);
+            b = b < BVH_BINS ? b : BVH_BINS - 1;
+
+            if (b <= best_bin) {
+                ++i;
+            } else {
+                uint32_t tmp = o->bvh_indices[i];
+                o->bvh_indices[i] = o->bvh_indices[--j];
+                o->bvh_indices[j] = tmp;
+            }
+        }
+    }
+
+    return i - first;
+}
+
+static
+int bvh_split(obj2h_t* o, size_t first, size_t count, size_t depth)
+{
+    bvh_build_t* n;
+    bvh_box_t box;
+    size_t i, nleft;
+    int index, left, right;
+
+    bvh_box_empty(&box);
+
+    for (i = first; i < first + count; ++i) {
+        bvh_box_grow(&box, &o->bvh_face_boxes[o->bvh_indices[i]]);
+    }
+
+    n = push_back(sizeof(bvh_build_t), (void**)&o->bvh_build, &o->nbvh_build,
+        &o->bvh_build_cap);
+    if (!n) return -1;
+
+    index = (int)(o->nbvh_build - 1);
+    n->box = box;
+    n->first = first;
+    n->count = count;
+    n->children[0] = n->children[1] = -1;
+
+    o->bvh_depth = depth > o->bvh_depth ? depth : o->bvh_depth;
+
+    nleft = bvh_partition(o, first, count, &box, depth);
+
+    if (!nleft)
+    {
+        ++o->bvh_leaves;
+        return index;
+    }
+
+    left = bvh_split(o, first, nleft, depth + 1);
+    right = bvh_split(o, first + nleft, count - nleft, depth + 1);
+    if (left < 0 || right < 0) return -1;
+
+    /* push_back may have moved the array */
+    o->bvh_build[index].children[0] = left;
+    o->bvh_build[index].children[1] = right;
+
+    return index;
+}
+
+/* quantizes b conservatively, the result always contains it */
+static
+void bvh_quantize(obj2h_t* o, bvh_box_t const* b, obj2h_bvh_node_t* node,
+    int child, float const* scale)
+{
+    int i;
+
+    for (i = 0; i < 3; ++i)
+    {
+        double lo = 0, hi = 0;
+
+        if (scale[i] > 0)
+        {
+            lo = floor((b->min[i] - o->bvh_bounds.min[i]) / scale[i]);
+            hi = ceil((b->max[i] - o->bvh_bounds.min[i]) / scale[i]);
+
+            /* the runtime dequantizes in float, step past its rounding */
+            while (lo > 0 && o->bvh_bounds.min[i] + (float)lo * scale[i] >
+                b->min[i])
+            {
+                --lo;
+            }
+
+            while (hi < 65535 && o->bvh_bounds.min[i] + (float)hi * scale[i] <
+                b->max[i])
+            {
+                ++hi;
+            }
+        }
+
+        lo = lo < 0 ? 0 : lo > 65535 ? 65535 : lo;
+        hi = hi < 0 ? 0 : hi > 65535 ? 65535 : hi;
+        node->bounds[child][i] = (uint16_t)lo;
+        node->bounds[child][i + 3] = (uint16_t)hi;
+    }
+}
+
+/* children of build node n are written to bvh_nodes[out] */
+static
+void bvh_flatten(obj2h_t* o, int n, size_t out, float const* scale)
+{
+    int i;
+
+    for (i = 0; i < 2; ++i)
+    {
+        bvh_build_t const* c = &o->bvh_build[o->bvh_build[n].children[i]];
+
+        bvh_quantize(o, &c->box, &o->bvh_nodes[out], i, scale);
+
+        if (c->children[0] < 0)
+        {
+            o->bvh_nodes[out].child[i] = OBJ2H_BVH_LEAF |
+                (uint32_t)c->first << 4 | (uint32_t)c->count;
+            continue;
+        }
+
+        o->bvh_nodes[out].child[i] = (uint32_t)o->nbvh_nodes;
+        bvh_flatten(o, o->bvh_build[n].children[i], o->nbvh_nodes++, scale);
+    }
+}
+
+/*
+ * builds the hierarchy over the final faces. the root's children go in
+ * node 0, so a mesh that fits in one leaf still gets a node with the
+ * second child empty
+ */
+static
+int build_bvh(obj2h_t* o)
+{
+    size_t i, ninner;
+    int root, j;
+
+    if (o->nfaces >= (size_t)1 << 27)
+    {
+        eprintf(o, "bvh: too many faces\n");
+        return 1;
+    }
+
+    if (o->opt_bvh && o->njoints) {
+        eprintf(o, "bvh: skinned mesh, built for the bind pose\n");
+    }
+
+    o->bvh_face_boxes = malloc(sizeof(bvh_box_t) * (o->nfaces + 1));
+    o->bvh_indices = malloc(sizeof(uint32_t) * (o->nfaces + 1));
+    o->bvh_keys = malloc(sizeof(bvh_key_t) * (o->nfaces + 1));
+
+    if (!o->bvh_face_boxes || !o->bvh_indices || !o->bvh_keys) {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    bvh_box_empty(&o->bvh_bounds);
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        bvh_box_t* b = &o->bvh_face_boxes[i];
+
+        bvh_box_empty(b);
+
+        for (j = 0; j < 3; ++j)
+        {
+            vec3_t const* v = &o->vertices[o->faces[i].vertex_indices[j]];
+            bvh_box_t p = { { v->x, v->y, v->z }, { v->x, v->y, v->z } };
+            bvh_box_grow(b, &p);
+        }
+
+        bvh_box_grow(&o->bvh_bounds, b);
+        o->bvh_indices[i] = (uint32_t)i;
+    }
+
+    if (!o->nfaces) return 0;
+
+    for (j = 0; j < 3; ++j)
+    {
+        o->bvh_scale[j] = (o->bvh_bounds.max[j] - o->bvh_bounds.min[j]) / 65535;
+
+        /* the top of the range has to reach max after float rounding */
+        while (o->bvh_bounds.min[j] + 65535 * o->bvh_scale[j] <
+            o->bvh_bounds.max[j])
+        {
+            o->bvh_scale[j] = nextafterf(o->bvh_scale[j], INFINITY);
+        }
+    }
+
+    root = bvh_split(o, 0, o->nfaces, 0);
+    if (root < 0) return 1;
+
+    if (o->bvh_depth > BVH_MAX_DEPTH)
+    {
+        eprintf(o, "bvh: too deep (%zd)\n", o->bvh_depth);
+        return 1;
+    }
+
+    ninner = o->nbvh_build - o->bvh_leaves;
+    o->bvh_nodes = calloc(ninner + 1, sizeof(obj2h_bvh_node_t));
+
+    if (!o->bvh_nodes) {
+        eperror(o, "calloc");
+        return 1;
+    }
+
+    o->nbvh_nodes = 1;
+
+    if (o->bvh_build[root].children[0] < 0)
+    {
+        /* a single leaf, the empty second child has nothing to test */
+        bvh_quantize(o, &o->bvh_build[root].box, &o->bvh_nodes[0], 0,
+            o->bvh_scale);
+        o->bvh_nodes[0].child[0] = OBJ2H_BVH_LEAF | (uint32_t)o->nfaces;
+        o->bvh_nodes[0].child[1] = OBJ2H_BVH_LEAF;
+    }
+
+    else {
+        bvh_flatten(o, root, 0, o->bvh_scale);
+    }
+
+    /* --prt builds one for itself */
+    if (o->opt_bvh)
+    {
+        eprintf(o, "bvh: %zd nodes, %zd leaves, %.2f faces per leaf, "
+            "depth %zd\n", o->nbvh_nodes, o->bvh_leaves,
+            (double)o->nfaces / o->bvh_leaves, o->bvh_depth);
+    }
+
+    return 0;
+}
+
+static
+void print_bvh(obj2h_t* o, char const* array_name)
+{
+    size_t i;
+    int j;
+
+    oputs(o, "#ifndef OBJ2H_BVH_TYPES");
+    oputs(o, "#define OBJ2H_BVH_TYPES");
+    oputs(o, "#define OBJ2H_BVH_LEAF 0x80000000u");
+    oputs(o, "struct obj2h_bvh_node");
+    oputs(o, "{");
+    oputs(o, "    uint16_t bounds[2][6]; /* min x, y, z, max x, y, z of each "
+        "child */");
+    oputs(o, "    uint32_t child[2]; /* node, or OBJ2H_BVH_LEAF | first << 4 | "
+        "count */");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_bvh_node obj2h_bvh_node_t;");
+    oputs(o, "struct obj2h_bvh");
+    oputs(o, "{");
+    oputs(o, "    float min[3], scale[3]; /* position = min + quantized * "
+        "scale */");
+    oputs(o, "    uint32_t nnodes;");
+    oputs(o, "    obj2h_bvh_node_t const* nodes; /* the root is nodes[0] */");
+    oputs(o, "    uint32_t const* indices; /* faces, in leaf order */");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_bvh obj2h_bvh_t;");
+    oputs(o, "#endif /* !OBJ2H_BVH_TYPES */\n");
+
+    oprintf(o, "static obj2h_bvh_node_t const %s_bvh_nodes[]\n"
+        "__attribute__((aligned(32))) = {\n", array_name);
+
+    for (i = 0; i < o->nbvh_nodes; ++i)
+    {
+        obj2h_bvh_node_t const* n = &o->bvh_nodes[i];
+
+        oprintf(o, "    { {");
+
+        for (j = 0; j < 2; ++j)
+        {
+            uint16_t const* b = n->bounds[j];
+            oprintf(o, " { %u, %u, %u, %u, %u, %u }%s", b[0], b[1], b[2], b[3],
+                b[4], b[5], j ? "" : ",");
+        }
+
+        oprintf(o, " }, { 0x%08lX, 0x%08lX } },\n", (unsigned long)n->child[0],
+            (unsigned long)n->child[1]);
+    }
+
+    oputs(o, "};\n");
+
+    oprintf(o, "static uint32_t const %s_bvh_indices[] = {\n", array_name);
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        oprintf(o, "%s%lu,", i % 12 ? " " : "    ",
+            (unsigned long)o->bvh_indices[i]);
+        if (i % 12 == 11 || i == o->nfaces - 1) oputs(o, "");
+    }
+
+    oputs(o, "};\n");
+
+    oprintf(o, "static obj2h_bvh_t const %s_bvh = {\n", array_name);
+    oprintf(o, "    { %.9g, %.9g, %.9g },\n", o->bvh_bounds.min[0],
+        o->bvh_bounds.min[1], o->bvh_bounds.min[2]);
+    oprintf(o, "    { %.9g, %.9g, %.9g },\n", o->bvh_scale[0], o->bvh_scale[1],
+        o->bvh_scale[2]);
+    oprintf(o, "    %zd,\n", o->nbvh_nodes);
+    oprintf(o, "    %s_bvh_nodes,\n", array_name);
+    oprintf(o, "    %s_bvh_indices,\n", array_name);
+    oputs(o, "};\n");
+}
+
+/* precomputed radiance transfer --------------------------------------- */
+
+/*
+ * every vertex casts the same opt_prt rays, spread evenly over the
+ * sphere on a fibonacci spiral, against the bvh. the ones above its
+ * surface that get out are weighted by their cosine with the normal and
+ * projected onto the 9 spherical harmonics of obj2h_prt.h. rays start a
+ * hair off the surface so they don't hit the faces around the vertex
+ */
+
+#define PRT_GRAIN 64
+#define PRT_OFFSET 1e-4f /* of the bounding sphere's radius */
+
+struct prt_job
+{
+    obj2h_t* o;
+    obj2h_bvh_t bvh;
+    vector_t* vertices; /* what the bvh queries read */
+    vec3_t* normals;
+    vector_t* dirs;
+    float* basis; /* 9 per direction */
+    float offset;
+    size_t* rays; /* cast and blocked, per vertex */
+};
+
+typedef struct prt_job prt_job_t;
+
+static
+int prt_vertices(void* ctx, size_t first, size_t last)
+{
+    prt_job_t* j = ctx;
+    obj2h_t* o = j->o;
+    size_t nrays = (size_t)o->opt_prt, i, k;
+    int c;
+
+    for (i = first; i < last; ++i)
+    {
+        vector_t const* v = &j->vertices[i];
+        vector_t origin = *v;
+        vec3_t n = j->normals[i];
+        double sum[9] = { 0 };
+        size_t* rays = &j->rays[i * 2];
+
+        /* smooth_normals point inwards */
+        n.x = -n.x;
+        n.y = -n.y;
+        n.z = -n.z;
+        origin.x += n.x * j->offset;
+        origin.y += n.y * j->offset;
+        origin.z += n.z * j->offset;
+        rays[0] = rays[1] = 0;
+
+        for (k = 0; k < nrays; ++k)
+        {
+            vector_t const* d = &j->dirs[k];
+            float cosine = n.x * d->x + n.y * d->y + n.z * d->z, t;
+
+            if (cosine <= 0) continue;
+
+            ++rays[0];
+
+            if (obj2h_bvh_raycast(&j->bvh, j->vertices, o->faces, &origin, d,
+                INFINITY, &t) >= 0)
+            {
+                ++rays[1];
+                continue;
+            }
+
+            for (c = 0; c < 9; ++c) {
+                sum[c] += cosine * j->basis[k * 9 + c];
+            }
+        }
+
+        for (c = 0; c < 9; ++c) {
+            o->prt[i * 9 + c] = (float)(sum[c] * 4 * M_PI / nrays);
+        }
+    }
+
+    return 0;
+}
+
+/* after build_bvh, on the final vertices and faces */
+static
+int build_prt(obj2h_t* o)
+{
+    size_t nrays = (size_t)o->opt_prt, cast = 0, blocked = 0, i;
+    prt_job_t j;
+    vec3_t center;
+    int err = 1;
+
+    if (o->njoints) {
+        eprintf(o, "prt: skinned mesh, baked in the bind pose\n");
+    }
+
+    memset(&j, 0, sizeof(j));
+    j.o = o;
+    j.offset = PRT_OFFSET * bounding_sphere(o, o->vertices, o->nvertices,
+        &center);
+    memcpy(j.bvh.min, o->bvh_bounds.min, sizeof(j.bvh.min));
+    memcpy(j.bvh.scale, o->bvh_scale, sizeof(j.bvh.scale));
+    j.bvh.nnodes = (uint32_t)o->nbvh_nodes;
+    j.bvh.nodes = o->bvh_nodes;
+    j.bvh.indices = o->bvh_indices;
+
+    o->prt = calloc(o->nvertices * 9 + 1, sizeof(float));
+    j.vertices = malloc(sizeof(vector_t) * (o->nvertices + 1));
+    j.dirs = malloc(sizeof(vector_t) * nrays);
+    j.basis = malloc(sizeof(float) * 9 * nrays);
+    j.rays = malloc(sizeof(size_t) * 2 * (o->nvertices + 1));
+    j.normals = smooth_normals(o);
+
+    if (!o->prt || !j.vertices || !j.dirs || !j.basis || !j.rays ||
+        !j.normals)
+    {
+        eperror(o, "malloc");
+        goto done;
+    }
+
+    for (i = 0; i < o->nvertices; ++i)
+    {
+        j.vertices[i].x = o->vertices[i].x;
+        j.vertices[i].y = o->vertices[i].y;
+        j.vertices[i].z = o->vertices[i].z;
+        j.vertices[i].w = 1;
+    }
+
+    for (i = 0; i < nrays; ++i)
+    {
+        double z = 1 - (2 * i + 1) / (double)nrays;
+        double r = sqrt(1 - z * z);
+        double phi = i * M_PI * (3 - sqrt(5));
+        vector_t* d = &j.dirs[i];
+
+        d->x = (float)(r * cos(phi));
+        d->y = (float)(r * sin(phi));
+        d->z = (float)z;
+        d->w = 0;
+        obj2h_prt_basis(d->x, d->y, d->z, &j.basis[i * 9]);
+    }
+
+    err = parallel_for(o, o->nvertices, PRT_GRAIN, prt_vertices, &j);
+    if (err) goto done;
+
+    for (i = 0; i < o->nvertices; ++i)
+    {
+        cast += j.rays[i * 2];
+        blocked += j.rays[i * 2 + 1];
+    }
+
+    eprintf(o, "prt: %zd rays per vertex, %.1f%% of the ones leaving the "
+        "surface blocked\n", nrays, cast ? 100.0 * blocked / cast : 0);
+
+done:
+    free(j.vertices);
+    free(j.dirs);
+    free(j.basis);
+    free(j.rays);
+    free(j.normals);
+
+    return err;
+}
+
+static
+void print_prt(obj2h_t* o, char const* array_name)
+{
+    size_t i;
+
+    oputs(o, "#ifndef OBJ2H_PRT_TYPES");
+    oputs(o, "#define OBJ2H_PRT_TYPES");
+    oputs(o, "struct obj2h_sh9 { float c[9]; };");
+    oputs(o, "typedef struct obj2h_sh9 obj2h_sh9_t;");
+    oputs(o, "#endif /* !OBJ2H_PRT_TYPES */\n");
+
+    oprintf(o, "static obj2h_sh9_t const %s_prt[]\n"
+        "__attribute__((aligned(32))) = {\n", array_name);
+
+    for (i = 0; i < o->nvertices; ++i)
+    {
+        float const* t = &o->prt[i * 9];
+
+        oprintf(o, "    { { %.9g, %.9g, %.9g, %.9g, %.9g, %.9g, %.9g, %.9g, "
+            "%.9g } },\n", t[0], t[1], t[2], t[3], t[4], t[5], t[6], t[7],
+            t[8]);
+    }
+
+    oputs(o, "};\n");
+}
+
+/* collision shapes ---------------------------------------------------- */
+
+/*
+ * --collision reuses the progressive mesh's edge collapses and stops at
+ * the face budget. --hull is quickhull (barber, dobkin, huhdanpaa 1996)
+ * on the positions, optionally stopped early once it has enough
+ * vertices, in which case the planes are pushed out over whatever it
+ * didn't get to
+ */
+
+#define HULL_EPSILON 1e-6 /* relative to the size of the model */
+#define HULL_MERGE 1e-5 /* normals closer than this are one plane */
+
+struct hull_face
+{
+    int v[3];
+    double n[3], d; /* outward plane, n.p + d > 0 is outside */
+    int outside; /* first point in front of it, -1 for none */
+    int alive;
+};
+
+typedef struct hull_face hull_face_t;
+
+/* the faces left after collapsing down to opt_collision */
+static
+int build_collision(obj2h_t* o)
+{
+    size_t* remap;
+    size_t i;
+    int k;
+
+    if (pm_init(o) || pm_simplify(o, (size_t)o->opt_collision)) return 1;
+
+    remap = malloc(sizeof(size_t) * (o->nvertices + 1));
+    o->collision_vertices = malloc(sizeof(vector_t) * (o->nvertices + 1));
+    o->collision_faces = malloc(sizeof(face_t) * (o->npm_alive_faces + 1));
+
+    if (!remap || !o->collision_vertices || !o->collision_faces)
+    {
+        eperror(o, "malloc");
+        free(remap);
+        return 1;
+    }
+
+    for (i = 0; i < o->nvertices; ++i) {
+        remap[i] = (size_t)-1;
+    }
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        face_t* f;
+
+        if (!o->pm_face_alive[i]) continue;
+
+        f = &o->collision_faces[o->ncollision_faces++];
+        memset(f, 0xFF, sizeof(*f));
+
+        for (k = 0; k < 3; ++k)
+        {
+            size_t v = (size_t)o->pm_faces[i * 3 + k];
+
+            if (remap[v] == (size_t)-1)
+            {
+                vector_t* cv = &o->collision_vertices[o->ncollision_vertices];
+
+                cv->x = o->vertices[v].x;
+                cv->y = o->vertices[v].y;
+                cv->z = o->vertices[v].z;
+                cv->w = 1;
+                remap[v] = o->ncollision_vertices++;
+            }
+
+            f->vertex_indices[k] = (int)remap[v];
+        }
+    }
+
+    eprintf(o, "collision: %zd faces, %zd vertices\n",
+        o->ncollision_faces, o->ncollision_vertices);
+
+    if (o->ncollision_faces > (size_t)o->opt_collision)
+    {
+        eprintf(o, "collision: warning, couldn't get down to %d "
+            "faces without folding the mesh over\n", o->opt_collision);
+    }
+
+    /* --progressive starts over from the full mesh */
+    pm_free(o);
+    free(o->pm_appear);
+    free(o->pm_collapses);
+    free(o->pm_corners);
+    o->pm_appear = 0;
+    o->pm_collapses = 0;
+    o->pm_corners = 0;
+    o->npm_collapses = o->pm_collapses_cap = 0;
+    o->npm_corners = o->pm_corners_cap = 0;
+    free(remap);
+
+    return 0;
+}
+
+static
+double hull_distance(obj2h_t* o, hull_face_t const* f, size_t p)
+{
+    vec3_t const* v = &o->vertices[p];
+    return f->n[0] * v->x + f->n[1] * v->y + f->n[2] * v->z + f->d;
+}
+
+/* the face a, b, c, wound outwards */
+static
+void hull_face(obj2h_t* o, hull_face_t* f, int a, int b, int c)
+{
+    vec3_t const* pa = &o->vertices[a];
+    vec3_t const* pb = &o->vertices[b];
+    vec3_t const* pc = &o->vertices[c];
+    double ux = (double)pb->x - pa->x, uy = (double)pb->y - pa->y;
+    double uz = (double)pb->z - pa->z;
+    double vx = (double)pc->x - pa->x, vy = (double)pc->y - pa->y;
+    double vz = (double)pc->z - pa->z;
+    double len;
+
+    f->v[0] = a;
+    f->v[1] = b;
+    f->v[2] = c;
+    f->n[0] = uy * vz - uz * vy;
+    f->n[1] = uz * vx - ux * vz;
+    f->n[2] = ux * vy - uy * vx;
+    len = sqrt(f->n[0] * f->n[0] + f->n[1] * f->n[1] + f->n[2] * f->n[2]);
+
+    if (len > 0)
+    {
+        f->n[0] /= len;
+        f->n[1] /= len;
+        f->n[2] /= len;
+    }
+
+    f->d = -(f->n[0] * pa->x + f->n[1] * pa->y + f->n[2] * pa->z);
+    f->outside = -1;
+    f->alive = 1;
+}
+
+static
+hull_face_t* hull_add_face(obj2h_t* o, int a, int b, int c)
+{
+    hull_face_t* f = push_back(sizeof(hull_face_t), (void**)&o->hull_faces,
+        &o->nhull_faces, &o->hull_faces_cap);
+
+    if (f) hull_face(o, f, a, b, c);
+
+    return f;
+}
+
+/* hands point p to the face among first.. it's furthest in front of */
+static
+void hull_assign(obj2h_t* o, size_t p, size_t first, double epsilon)
+{
+    double best = epsilon;
+    size_t i, face = (size_t)-1;
+
+    for (i = first; i < o->nhull_faces; ++i)
+    {
+        double d;
+
+        if (!o->hull_faces[i].alive) continue;
+
+        d = hull_distance(o, &o->hull_faces[i], p);
+
+        if (d > best)
+        {
+            best = d;
+            face = i;
+        }
+    }
+
+    if (face == (size_t)-1) return;
+
+    o->hull_next[p] = o->hull_faces[face].outside;
+    o->hull_faces[face].outside = (int)p;
+}
+
+/* the 4 points furthest apart, as a start */
+static
+int hull_simplex(obj2h_t* o, int* s, double epsilon)
+{
+    size_t i;
+    int j, k;
+    double best, len;
+    vec3_t const* a;
+    vec3_t const* b;
+    hull_face_t base;
+
+    /* most distant pair among the extremes on each axis */
+    int extremes[6] = { 0, 0, 0, 0, 0, 0 };
+
+    for (i = 0; i < o->nvertices; ++i)
+    {
+        for (j = 0; j < 3; ++j)
+        {
+            float const* p = &o->vertices[i].x;
+
+            if (p[j] < (&o->vertices[extremes[j * 2]].x)[j]) {
+                extremes[j * 2] = (int)i;
+            }
+
+            if (p[j] > (&o->vertices[extremes[j * 2 + 1]].x)[j]) {
+                extremes[j * 2 + 1] = (int)i;
+            }
+        }
+    }
+
+    best = -1;
+
+    for (j = 0; j < 6; ++j)
+    {
+        for (k = j + 1; k < 6; ++k)
+        {
+            vec3_t const* p = &o->vertices[extremes[j]];
+            vec3_t const* q = &o->vertices[extremes[k]];
+            double dx = (double)p->x - q->x, dy = (double)p->y - q->y;
+            double dz = (double)p->z - q->z;
+            double d = dx * dx + dy * dy + dz * dz;
+
+            if (d > best)
+            {
+                best = d;
+                s[0] = extremes[j];
+                s[1] = extremes[k];
+            }
+        }
+    }
+
+    if (best <= epsilon * epsilon) return 1;
+
+    /* furthest from the line */
+    a = &o->vertices[s[0]];
+    b = &o->vertices[s[1]];
+    len = best;
+    best = 0;
+
+    for (i = 0; i < o->nvertices; ++i)
+    {
+        vec3_t const* p = &o->vertices[i];
+        double ux = (double)b->x - a->x, uy = (double)b->y - a->y;
+        double uz = (double)b->z - a->z;
+        double vx = (double)p->x - a->x, vy = (double)p->y - a->y;
+        double vz = (double)p->z - a->z;
+        double cx = uy * vz - uz * vy, cy = uz * vx - ux * vz;
+        double cz = ux * vy - uy * vx;
+        double d = cx * cx + cy * cy + cz * cz;
+
+        if (d > best)
+        {
+            best = d;
+            s[2] = (int)i;
+        }
+    }
+
+    /* that's |ab|^2 times the distance squared */
+    if (best <= epsilon * epsilon * len) return 1;
+
+    /* furthest from the plane */
+    hull_face(o, &base, s[0], s[1], s[2]);
+    best = 0;
+
+    for (i = 0; i < o->nvertices; ++i)
+    {
+        double d = hull_distance(o, &base, i);
+
+        if (fabs(d) > fabs(best))
+        {
+            best = d;
+            s[3] = (int)i;
+        }
+    }
+
+    if (fabs(best) <= epsilon) return 1;
+
+    /* the base goes away from the apex */
+    if (best > 0)
+    {
+        int t = s[0];
+        s[0] = s[1];
+        s[1] = t;
+    }
+
+    return 0;
+}
+
+struct hull_edge { int a, b; };
+typedef struct hull_edge hull_edge_t;
+
+static
+int hull_edge_cmp(void const* a, void const* b)
+{
+    hull_edge_t const* ea = a;
+    hull_edge_t const* eb = b;
+
+    if (ea->a != eb->a) return ea->a < eb->a ? -1 : 1;
+    if (ea->b != eb->b) return ea->b < eb->b ? -1 : 1;
+
+    return 0;
+}
+
+static
+int build_hull(obj2h_t* o)
+{
+    hull_edge_t* edges = 0;
+    size_t nedges = 0, edges_cap = 0;
+    int* vertex_map = 0;
+    vec3_t min, max;
+    double epsilon;
+    size_t i, f;
+    int s[4] = { 0, 0, 0, 0 }, added = 4;
+
+    if (o->nvertices < 4)
+    {
+        eprintf(o, "hull: needs at least 4 vertices\n");
+        return 1;
+    }
+
+    bounds(o, o->vertices, o->nvertices, &min, &max);
+    epsilon = HULL_EPSILON * sqrt(
+        (double)(max.x - min.x) * (max.x - min.x) +
+        (double)(max.y - min.y) * (max.y - min.y) +
+        (double)(max.z - min.z) * (max.z - min.z));
+
+    if (hull_simplex(o, s, epsilon))
+    {
+        eprintf(o, "hull: the model is flat\n");
+        return 1;
+    }
+
+    o->hull_next = malloc(sizeof(int) * (o->nvertices + 1));
+
+    if (!o->hull_next || !hull_add_face(o, s[0], s[1], s[2]) ||
+        !hull_add_face(o, s[0], s[3], s[1]) ||
+        !hull_add_face(o, s[1], s[3], s[2]) ||
+        !hull_add_face(o, s[2], s[3], s[0]))
+    {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    for (i = 0; i < o->nvertices; ++i) {
+        hull_assign(o, i, 0, epsilon);
+    }
+
+    while (!o->opt_hull || added < o->opt_hull)
+    {
+        hull_face_t* top;
+        size_t first = o->nhull_faces, e;
+        double best = 0;
+        int p = -1, q;
+
+        for (f = 0; f < o->nhull_faces; ++f) {
+            if (o->hull_faces[f].alive && o->hull_faces[f].outside >= 0) break;
+        }
+
+        if (f == o->nhull_faces) break;
+
+        top = &o->hull_faces[f];
+
+        for (q = top->outside; q >= 0; q = o->hull_next[q])
+        {
+            double d = hull_distance(o, top, (size_t)q);
+
+            if (d > best)
+            {
+                best = d;
+                p = q;
+            }
+        }
+
+        /*
+         * every face p sees goes, and their edges that no other one of
+         * them shares make the horizon
+         */
+        nedges = 0;
+
+        for (f = 0; f < first; ++f)
+        {
+            hull_face_t* hf = &o->hull_faces[f];
+            int k;
+
+            if (!hf->alive || hull_distance(o, hf, (size_t)p) <= epsilon) {
+                continue;
+            }
+
+            hf->alive = 0;
+
+            for (k = 0; k < 3; ++k)
+            {
+                hull_edge_t* he = push_back(sizeof(hull_edge_t),
+                    (void**)&edges, &nedges, &edges_cap);
+
+                if (!he)
+                {
+                    eperror(o, "malloc");
+                    free(edges);
+                    return 1;
+                }
+
+                he->a = hf->v[k];
+                he->b = hf->v[(k + 1) % 3];
+            }
+        }
+
+        qsort(edges, nedges, sizeof(hull_edge_t), hull_edge_cmp);
+
+        for (e = 0; e < nedges; ++e)
+        {
+            hull_edge_t twin;
+
+            twin.a = edges[e].b;
+            twin.b = edges[e].a;
+
+            if (bsearch(&twin, edges, nedges, sizeof(hull_edge_t),
+                hull_edge_cmp))
+            {
+                continue;
+            }
+
+            if (!hull_add_face(o, edges[e].a, edges[e].b, p))
+            {
+                eperror(o, "malloc");
+                free(edges);
+                return 1;
+            }
+        }
+
+        /* orphaned points find a new face or are inside for good */
+        for (f = 0; f < first; ++f)
+        {
+            hull_face_t* hf = &o->hull_faces[f];
+            int next;
+
+            if (hf->alive || hf->outside < 0) continue;
+
+            for (q = hf->outside; q >= 0; q = next)
+            {
+                next = o->hull_next[q];
+                if (q != p) hull_assign(o, (size_t)q, first, epsilon);
+            }
+
+            hf->outside = -1;
+        }
+
+        ++added;
+    }
+
+    free(edges);
+
+    /* planes, with near parallel ones merged into the loosest */
+    o->hull_planes = malloc(sizeof(vector_t) * (o->nhull_faces + 1));
+    o->hull_vertices = malloc(sizeof(vector_t) * (o->nvertices + 1));
+    vertex_map = malloc(sizeof(int) * (o->nvertices + 1));
+
+    if (!o->hull_planes || !o->hull_vertices || !vertex_map)
+    {
+        eperror(o, "malloc");
+        free(vertex_map);
+        return 1;
+    }
+
+    for (i = 0; i < o->nvertices; ++i) {
+        vertex_map[i] = -1;
+    }
+
+    for (f = 0; f < o->nhull_faces; ++f)
+    {
+        hull_face_t* hf = &o->hull_faces[f];
+        double out = 0;
+        int k;
+
+        if (!hf->alive) continue;
+
+        /* only a capped hull can leave anything in front */
+        if (o->opt_hull)
+        {
+            for (i = 0; i < o->nvertices; ++i)
+            {
+                double d = hull_distance(o, hf, i);
+                if (d > out) out = d;
+            }
+
+            hf->d -= out;
+        }
+
+        for (k = 0; k < 3; ++k)
+        {
+            int v = hf->v[k];
+
+            if (vertex_map[v] >= 0) continue;
+
+            vertex_map[v] = (int)o->nhull_vertices;
+            o->hull_vertices[o->nhull_vertices].x = o->vertices[v].x;
+            o->hull_vertices[o->nhull_vertices].y = o->vertices[v].y;
+            o->hull_vertices[o->nhull_vertices].z = o->vertices[v].z;
+            o->hull_vertices[o->nhull_vertices].w = 1;
+            ++o->nhull_vertices;
+        }
+
+        for (i = 0; i < o->nhull_planes; ++i)
+        {
+            vector_t* pl = &o->hull_planes[i];
+            double dot = pl->x * hf->n[0] + pl->y * hf->n[1] +
+                pl->z * hf->n[2];
+
+            if (dot > 1 - HULL_MERGE) break;
+        }
+
+        if (i == o->nhull_planes)
+        {
+            o->hull_planes[i].x = (float)hf->n[0];
+            o->hull_planes[i].y = (float)hf->n[1];
+            o->hull_planes[i].z = (float)hf->n[2];
+            o->hull_planes[i].w = (float)hf->d;
+            ++o->nhull_planes;
+        }
+
+        else if (hf->d < o->hull_planes[i].w) {
+            o->hull_planes[i].w = (float)hf->d;
+        }
+    }
+
+    /* the float planes must still have every point behind them */
+    for (i = 0; i < o->nhull_planes; ++i)
+    {
+        vector_t* pl = &o->hull_planes[i];
+        size_t j;
+
+        for (j = 0; j < o->nvertices; ++j)
+        {
+            vec3_t const* v = &o->vertices[j];
+            float d = pl->x * v->x + pl->y * v->y + pl->z * v->z + pl->w;
+
+            while (d > 0)
+            {
+                pl->w = nextafterf(pl->w, -INFINITY);
+                d = pl->x * v->x + pl->y * v->y + pl->z * v->z + pl->w;
+            }
+        }
+    }
+
+    eprintf(o, "hull: %zd vertices, %zd planes%s\n", o->nhull_vertices,
+        o->nhull_planes,
+        o->opt_hull && added >= o->opt_hull ? " (capped)" : "");
+
+    free(vertex_map);
+    free(o->hull_next);
+    free(o->hull_faces);
+    o->hull_next = 0;
+    o->hull_faces = 0;
+    o->nhull_faces = o->hull_faces_cap = 0;
+
+    return 0;
+}
+
+static
+void print_vectors(obj2h_t* o, char const* array_name, char const* what,
+    vector_t const* v, size_t n)
+{
+    size_t i;
+
+    oprintf(o, "static vector_t %s_%s[]\n"
+        "__attribute__((aligned(32))) = {\n", array_name, what);
+
+    for (i = 0; i < n; ++i)
+    {
+        oprintf(o, "    { %.9g, %.9g, %.9g, %.9g },\n", v[i].x + 0.0f,
+            v[i].y + 0.0f, v[i].z + 0.0f, v[i].w + 0.0f);
+    }
+
+    oputs(o, "};\n");
+}
+
+static
+int print_collision(obj2h_t* o, char const* array_name)
+{
+    vector_t* planes = malloc(sizeof(vector_t) * (o->ncollision_faces + 1));
+    size_t i;
+
+    if (!planes)
+    {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    print_vectors(o, array_name, "collision_vertices", o->collision_vertices,
+        o->ncollision_vertices);
+
+    oprintf(o, "static face_t const %s_collision_faces[] = {\n", array_name);
+
+    for (i = 0; i < o->ncollision_faces; ++i)
+    {
+        int const* vi = o->collision_faces[i].vertex_indices;
+
+        oprintf(o, "    { { %d, %d, %d }, { -1, -1, -1 }, { -1, -1, -1 } },\n",
+            vi[0], vi[1], vi[2]);
+    }
+
+    oputs(o, "};\n");
+
+    /* the same planes as --edges, pointing out of the model like the hull's */
+    obj2h_shadow_planes(o->collision_vertices, o->collision_faces,
+        o->ncollision_faces, planes);
+    print_vectors(o, array_name, "collision_planes", planes,
+        o->ncollision_faces);
+
+    free(planes);
+
+    return 0;
+}
+
+static
+void print_hull(obj2h_t* o, char const* array_name)
+{
+    oputs(o, "#ifndef OBJ2H_HULL_TYPES");
+    oputs(o, "#define OBJ2H_HULL_TYPES");
+    oputs(o, "struct obj2h_hull");
+    oputs(o, "{");
+    oputs(o, "    uint32_t nplanes, nvertices;");
+    oputs(o, "    vector_t const* planes;");
+    oputs(o, "    vector_t const* vertices; /* for support mapping and debug "
+        "drawing */");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_hull obj2h_hull_t;");
+    oputs(o, "#endif /* !OBJ2H_HULL_TYPES */\n");
+
+    print_vectors(o, array_name, "hull_planes", o->hull_planes,
+        o->nhull_planes);
+    print_vectors(o, array_name, "hull_vertices", o->hull_vertices,
+        o->nhull_vertices);
+
+    oprintf(o, "static obj2h_hull_t const %s_hull = {\n", array_name);
+    oprintf(o, "    %zd, %zd,\n", o->nhull_planes, o->nhull_vertices);
+    oprintf(o, "    %s_hull_planes,\n", array_name);
+    oprintf(o, "    %s_hull_vertices,\n", array_name);
+    oputs(o, "};\n");
+}
+
+/* edge adjacency ------------------------------------------------------ */
+
+/* same edge, whichever face it's from */
+static
+int edge_key_cmp(edge_t const* a, edge_t const* b)
+{
+    if (a->a != b->a) return a->a < b->a ? -1 : 1;
+    if (a->b != b->b) return a->b < b->b ? -1 : 1;
+    return 0;
+}
+
+/*
+ * pairs up the faces around every edge for obj2h_shadow.h. edges with
+ * more than two faces are split into pairs, the odd one out left open
+ */
+static
+int build_edges(obj2h_t* o)
+{
+    edge_t* half = malloc(sizeof(edge_t) * (o->nfaces * 3 + 1));
+    size_t i, j, nopen = 0, nshared = 0, nhalf = 0;
+
+    o->adj_edges = malloc(sizeof(obj2h_edge_t) * (o->nfaces * 3 + 1));
+
+    if (!half || !o->adj_edges) {
+        eperror(o, "malloc");
+        free(half);
+        return 1;
+    }
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        int const* vi = o->faces[i].vertex_indices;
+
+        for (j = 0; j < 3; ++j)
+        {
+            int a = vi[j], b = vi[(j + 1) % 3];
+
+            if (a == b) continue;
+
+            half[nhalf].a = a < b ? a : b;
+            half[nhalf].b = a < b ? b : a;
+            half[nhalf].face = (int)i;
+            ++nhalf;
+        }
+    }
+
+    if (parallel_sort(o, half, nhalf, sizeof(edge_t), edge_cmp))
+    {
+        free(half);
+        return 1;
+    }
+
+    for (i = 0; i < nhalf; i = j)
+    {
+        j = i + 1;
+        while (j < nhalf && !edge_key_cmp(&half[i], &half[j])) ++j;
+
+        if (j - i > 2) ++nshared;
+
+        for (; i < j; i += 2)
+        {
+            obj2h_edge_t* e = &o->adj_edges[o->nadj_edges++];
+            int const* vi = o->faces[half[i].face].vertex_indices;
+            int forward = (vi[0] == half[i].a && vi[1] == half[i].b) ||
+                (vi[1] == half[i].a && vi[2] == half[i].b) ||
+                (vi[2] == half[i].a && vi[0] == half[i].b);
+
+            e->vertex_indices[0] = forward ? half[i].a : half[i].b;
+            e->vertex_indices[1] = forward ? half[i].b : half[i].a;
+            e->face_indices[0] = half[i].face;
+            e->face_indices[1] = i + 1 < j ? half[i + 1].face : -1;
+            nopen += i + 1 >= j;
+        }
+    }
+
+    free(half);
+
+    eprintf(o, "edges: %zd, %zd open, %zd with more than two "
+        "faces\n", o->nadj_edges, nopen, nshared);
+
+    return 0;
+}
+
+static
+int print_edges(obj2h_t* o, char const* array_name)
+{
+    vector_t* planes = malloc(sizeof(vector_t) * (o->nfaces + 1));
+    vector_t* v = malloc(sizeof(vector_t) * (o->nvertices + 1));
+    size_t i;
+
+    if (!planes || !v)
+    {
+        eperror(o, "malloc");
+        free(planes);
+        free(v);
+        return 1;
+    }
+
+    oputs(o, "#ifndef OBJ2H_EDGE_TYPES");
+    oputs(o, "#define OBJ2H_EDGE_TYPES");
+    oputs(o, "struct obj2h_edge");
+    oputs(o, "{");
+    oputs(o, "    int vertex_indices[2]; /* in the winding of the first face "
+        "*/");
+    oputs(o, "    int face_indices[2];   /* the second one is -1 on open "
+        "edges */");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_edge obj2h_edge_t;");
+    oputs(o, "#endif /* !OBJ2H_EDGE_TYPES */\n");
+
+    oprintf(o, "static obj2h_edge_t const %s_edges[] = {\n", array_name);
+
+    for (i = 0; i < o->nadj_edges; ++i)
+    {
+        obj2h_edge_t const* e = &o->adj_edges[i];
+
+        oprintf(o, "    { { %d, %d }, { %d, %d } },\n", e->vertex_indices[0],
+            e->vertex_indices[1], e->face_indices[0], e->face_indices[1]);
+    }
+
+    oputs(o, "};\n");
+
+    /* the same math as the runtime, so both agree on what's lit */
+    for (i = 0; i < o->nvertices; ++i)
+    {
+        v[i].x = o->vertices[i].x;
+        v[i].y = o->vertices[i].y;
+        v[i].z = o->vertices[i].z;
+        v[i].w = 1;
+    }
+
+    obj2h_shadow_planes(v, o->faces, o->nfaces, planes);
+
+    oprintf(o, "static vector_t %s_planes[]\n"
+        "__attribute__((aligned(32))) = {\n", array_name);
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        oprintf(o, "    { %.9g, %.9g, %.9g, %.9g },\n", planes[i].x + 0.0f,
+            planes[i].y + 0.0f, planes[i].z + 0.0f, planes[i].w + 0.0f);
+    }
+
+    oputs(o, "};\n");
+
+    free(planes);
+    free(v);
+
+    return 0;
+}
+
+/* 16-bit uvs ---------------------------------------------------------- */
+
+/*
+ * the pvr's 16-bit uvs are the top half of a float each, u in the high
+ * half of the word and v in the low one. that leaves 8 bits of mantissa
+ * so precision halves with every power of two away from 0, and uvs
+ * that repeat the texture a lot get blurry fast
+ */
+
+/* rounds to nearest even instead of truncating like the hardware would */
+static
+unsigned long uv16_half(float f)
+{
+    unsigned int u;
+
+    memcpy(&u, &f, 4);
+    u += 0x7FFF + ((u >> 16) & 1);
+
+    return u >> 16;
+}
+
+static
+float uv16_float(unsigned long h)
+{
+    unsigned int u = (unsigned int)h << 16;
+    float f;
+
+    memcpy(&f, &u, 4);
+
+    return f;
+}
+
+static
+unsigned long uv16_pack(obj2h_t* o, uv_t const* uv)
+{
+    return uv16_half(uv->u - o->uv16_offset[0]) << 16 |
+        uv16_half(uv->v - o->uv16_offset[1]);
+}
+
+/*
+ * moves the uvs back towards [0, 1] by whole repeats when they go past
+ * it, which a repeating texture doesn't see, and reports the worst
+ * rounding error on a texture opt_uv16 texels wide
+ */
+static
+void uv16_check(obj2h_t* o)
+{
+    float lo[2] = { 1e30f, 1e30f }, hi[2] = { -1e30f, -1e30f };
+    float worst = 0;
+    uv_t const* worst_uv = 0;
+    size_t i;
+    int j;
+
+    for (i = 0; i < o->nuvs; ++i)
+    {
+        float const* p = &o->uvs[i].u;
+
+        for (j = 0; j < 2; ++j)
+        {
+            lo[j] = p[j] < lo[j] ? p[j] : lo[j];
+            hi[j] = p[j] > hi[j] ? p[j] : hi[j];
+        }
+    }
+
+    /* centered on 0, where the precision is best */
+    for (j = 0; j < 2; ++j)
+    {
+        if (o->nuvs && (lo[j] < 0 || hi[j] > 1)) {
+            o->uv16_offset[j] = floorf((lo[j] + hi[j]) / 2 + 0.5f);
+        }
+    }
+
+    if (o->uv16_offset[0] || o->uv16_offset[1])
+    {
+        eprintf(o, "uv16: uvs moved by %g, %g, the texture has to "
+            "repeat\n", 0 - o->uv16_offset[0], 0 - o->uv16_offset[1]);
+    }
+
+    for (i = 0; i < o->nuvs; ++i)
+    {
+        unsigned long packed = uv16_pack(o, &o->uvs[i]);
+        float du = uv16_float(packed >> 16) + o->uv16_offset[0] -
+            o->uvs[i].u;
+        float dv = uv16_float(packed & 0xFFFF) + o->uv16_offset[1] -
+            o->uvs[i].v;
+        float err = (fabsf(du) > fabsf(dv) ? fabsf(du) : fabsf(dv)) *
+            o->opt_uv16;
+
+        if (err > worst)
+        {
+            worst = err;
+            worst_uv = &o->uvs[i];
+        }
+    }
+
+    eprintf(o, "uv16: worst error %.3g texels on a %dx%d texture\n",
+        worst, o->opt_uv16, o->opt_uv16);
+
+    if (worst > 0.5f)
+    {
+        eprintf(o, "uv16: warning: more than half a texel at "
+            "%g, %g, float uvs would look better\n", worst_uv->u,
+            worst_uv->v);
+    }
+}
+
+/* same as obj2h_pvr.h, which can't be included here as it needs kos */
+static
+void print_uv16_types(obj2h_t* o)
+{
+    oputs(o, "#ifndef OBJ2H_PVR_UV16_TYPES");
+    oputs(o, "#define OBJ2H_PVR_UV16_TYPES");
+    oputs(o, "struct obj2h_pvr_vertex_uv16");
+    oputs(o, "{");
+    oputs(o, "    uint32_t flags;");
+    oputs(o, "    float x, y, z;");
+    oputs(o, "    uint32_t uv; /* u in the high half, v in the low one */");
+    oputs(o, "    uint32_t pad;");
+    oputs(o, "    uint32_t argb, oargb;");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_pvr_vertex_uv16 obj2h_pvr_vertex_uv16_t;");
+    oputs(o, "#endif /* !OBJ2H_PVR_UV16_TYPES */\n");
+}
+
+/* pre-baked pvr streams ----------------------------------------------- */
+
+#define PRELIGHT_AMBIENT 0.01f
+
+/*
+ * bakes a directional light into a vertex color the same way the
+ * quaternion_interpolation demo lights its vertices. corners without a
+ * normal or a light are fully lit
+ */
+static
+unsigned long prelight_argb(obj2h_t* o, int normal_index)
+{
+    vec3_t const* n;
+    float dot;
+
+    if (!o->opt_prelight || normal_index < 0 ||
+        (size_t)normal_index >= o->nnormals)
+    {
+        return 0xFFFFFFFF;
+    }
+
+    n = &o->normals[normal_index];
+    dot = n->x * o->prelight.x + n->y * o->prelight.y + n->z * o->prelight.z;
+    dot = dot < 0 ? 0 : dot > 1 ? 1 : dot;
+    dot = PRELIGHT_AMBIENT + dot * (1 - PRELIGHT_AMBIENT);
+
+    return 0xFF000000 | 0x010101 * (unsigned long)(dot * 255 + 0.5f);
+}
+
+/* the color of a corner, the model's own when it has vertex colors */
+static
+unsigned long vertex_argb(obj2h_t* o, int vertex_index, int normal_index)
+{
+    if (vertex_index >= 0 && (size_t)vertex_index < o->nvertex_colors) {
+        return o->vertex_colors[vertex_index];
+    }
+
+    return prelight_argb(o, normal_index);
+}
+
+static
+void print_pvr_vertex(obj2h_t* o, int vi, int ti, int ni, int eol)
+{
+    vec3_t v = { 0, 0, 0 };
+    uv_t uv = { 0, 0 };
+
+    if (vi >= 0 && (size_t)vi < o->nvertices) v = o->vertices[vi];
+    if (ti >= 0 && (size_t)ti < o->nuvs) uv = o->uvs[ti];
+
+    if (o->opt_uv16)
+    {
+        oprintf(o, "        { %s, %.9g, %.9g, %.9g, 0x%08lX, 0, 0x%08lX, "
+            "0 },\n",
+            eol ? "PVR_CMD_VERTEX_EOL" : "PVR_CMD_VERTEX", v.x, v.y, v.z,
+            uv16_pack(o, &uv), vertex_argb(o, vi, ni));
+        return;
+    }
+
+    oprintf(o, "        { %s, %.9g, %.9g, %.9g, %.9g, %.9g, 0x%08lX, 0 },\n",
+        eol ? "PVR_CMD_VERTEX_EOL" : "PVR_CMD_VERTEX", v.x, v.y, v.z,
+        uv.u, uv.v, vertex_argb(o, vi, ni));
+}
+
+/*
+ * emits a poly header slot followed by ready to submit pvr_vertex_t's
+ * in model space, see obj2h_pvr.h. strips are used when available,
+ * otherwise every face is its own strip with the 2-j winding the demos
+ * use
+ */
+static
+void print_pvr(obj2h_t* o, char const* array_name)
+{
+    size_t i, n;
+
+    n = o->opt_strips ? o->nstrip_corners - o->nstrips : o->nfaces * 3;
+
+    if (o->opt_uv16) {
+        print_uv16_types(o);
+    }
+
+    oprintf(o, "static struct {\n"
+        "    pvr_poly_hdr_t hdr;\n"
+        "    %s vertices[%zd];\n"
+        "}\n"
+        "%s_pvr\n"
+        "__attribute__((aligned(32))) = {\n"
+        "    { 0 }, /* compiled at runtime */\n"
+        "    {\n", o->opt_uv16 ? "obj2h_pvr_vertex_uv16_t" : "pvr_vertex_t",
+        n, array_name);
+
+    if (o->opt_strips)
+    {
+        for (i = 0; i < o->nstrip_corners; ++i)
+        {
+            corner_t const* c = &o->strip_corners[i];
+
+            if (c->vertex_index < 0) continue;
+
+            print_pvr_vertex(o, c->vertex_index, c->uv_index,
+                c->normal_index, c[1].vertex_index < 0);
+        }
+    }
+
+    else
+    {
+        for (i = 0; i < o->nfaces; ++i)
+        {
+            face_t const* f = &o->faces[i];
+            int j;
+
+            for (j = 0; j < 3; ++j)
+            {
+                print_pvr_vertex(o, f->vertex_indices[2 - j],
+                    f->uv_indices[2 - j], f->normal_indices[2 - j], j == 2);
+            }
+        }
+    }
+
+    oputs(o, "    }\n};\n");
+}
+
+/*
+ * the vertex statement of print_draw. the macros it's passed to are
+ * defined right before the function and take the vertex index, the uv
+ * as constants when the model has some and the baked color
+ */
+static
+void print_draw_vertex(obj2h_t* o, int vi, int ti, int ni, int eol)
+{
+    uv_t uv = { 0, 0 };
+    char const* op = eol ? "OBJ2H_E" : "OBJ2H_V";
+
+    if (ti >= 0 && (size_t)ti < o->nuvs) uv = o->uvs[ti];
+
+    if (o->opt_uv16)
+    {
+        oprintf(o, "    %s(%d, 0x%08lX, 0x%08lX);\n", op, vi,
+            uv16_pack(o, &uv), vertex_argb(o, vi, ni));
+    }
+
+    else if (o->nuvs)
+    {
+        oprintf(o, "    %s(%d, %.9g, %.9g, 0x%08lX);\n", op, vi, uv.u, uv.v,
+            vertex_argb(o, vi, ni));
+    }
+
+    else {
+        oprintf(o, "    %s(%d, 0x%08lX);\n", op, vi, vertex_argb(o, vi, ni));
+    }
+}
+
+/*
+ * emits model_draw(t), the strips (or faces) submitted one vertex at a
+ * time with the loop unrolled at build time: no index or flag loads, no
+ * end of strip tests, every count, offset, uv and color is a constant.
+ * only the positions come from t, model_vertices transformed by the
+ * caller
+ */
+static
+void print_draw(obj2h_t* o, char const* array_name)
+{
+    char const* vertex_type = o->opt_uv16 ? "obj2h_pvr_vertex_uv16_t" :
+        "pvr_vertex_t";
+    size_t i, n;
+
+    n = o->opt_strips ? o->nstrip_corners - o->nstrips : o->nfaces * 3;
+
+    if (o->opt_uv16 && !o->opt_pvr) {
+        print_uv16_types(o);
+    }
+
+    if (o->opt_uv16)
+    {
+        oputs(o, "#define OBJ2H_DRAW(i, f, uv16, c) \\");
+        oputs(o, "    (v.flags = f, v.x = t[i].x, v.y = t[i].y, "
+            "v.z = t[i].z, v.uv = uv16, \\");
+        oputs(o, "    v.argb = c, pvr_prim(&v, sizeof(v)))");
+        oputs(o, "#define OBJ2H_V(i, uv16, c) "
+            "OBJ2H_DRAW(i, PVR_CMD_VERTEX, uv16, c)");
+        oputs(o, "#define OBJ2H_E(i, uv16, c) "
+            "OBJ2H_DRAW(i, PVR_CMD_VERTEX_EOL, uv16, c)");
+    }
+
+    else if (o->nuvs)
+    {
+        oputs(o, "#define OBJ2H_DRAW(i, f, s, w, c) \\");
+        oputs(o, "    (v.flags = f, v.x = t[i].x, v.y = t[i].y, "
+            "v.z = t[i].z, v.u = s, v.v = w, \\");
+        oputs(o, "    v.argb = c, pvr_prim(&v, sizeof(v)))");
+        oputs(o, "#define OBJ2H_V(i, s, w, c) "
+            "OBJ2H_DRAW(i, PVR_CMD_VERTEX, s, w, c)");
+        oputs(o, "#define OBJ2H_E(i, s, w, c) "
+            "OBJ2H_DRAW(i, PVR_CMD_VERTEX_EOL, s, w, c)");
+    }
+
+    else
+    {
+        oputs(o, "#define OBJ2H_DRAW(i, f, c) \\");
+        oputs(o, "    (v.flags = f, v.x = t[i].x, v.y = t[i].y, "
+            "v.z = t[i].z, v.argb = c, \\");
+        oputs(o, "    pvr_prim(&v, sizeof(v)))");
+        oputs(o, "#define OBJ2H_V(i, c) OBJ2H_DRAW(i, PVR_CMD_VERTEX, c)");
+        oputs(o, "#define OBJ2H_E(i, c) "
+            "OBJ2H_DRAW(i, PVR_CMD_VERTEX_EOL, c)");
+    }
+
+    oprintf(o, "\n/* %zd vertices, the poly header is sent by the caller */\n"
+        "static inline\n"
+        "void %s_draw(vector_t const* t)\n"
+        "{\n"
+        "    %s v;\n\n", n, array_name, vertex_type);
+
+    if (o->opt_uv16) {
+        oputs(o, "    v.pad = 0;");
+    } else if (!o->nuvs) {
+        oputs(o, "    v.u = v.v = 0;");
+    }
+
+    oputs(o, "    v.oargb = 0;\n");
+
+    if (o->opt_strips)
+    {
+        for (i = 0; i < o->nstrip_corners; ++i)
+        {
+            corner_t const* c = &o->strip_corners[i];
+
+            if (c->vertex_index < 0) continue;
+
+            print_draw_vertex(o, c->vertex_index, c->uv_index,
+                c->normal_index, c[1].vertex_index < 0);
+        }
+    }
+
+    else
+    {
+        for (i = 0; i < o->nfaces; ++i)
+        {
+            face_t const* f = &o->faces[i];
+            int j;
+
+            for (j = 0; j < 3; ++j)
+            {
+                print_draw_vertex(o, f->vertex_indices[2 - j],
+                    f->uv_indices[2 - j], f->normal_indices[2 - j], j == 2);
+            }
+        }
+    }
+
+    oputs(o, "}");
+    oputs(o, "#undef OBJ2H_E");
+    oputs(o, "#undef OBJ2H_V");
+    oputs(o, "#undef OBJ2H_DRAW\n");
+
+    eprintf(o, "draw: %zd vertices unrolled in %zd %s\n", n,
+        o->opt_strips ? o->nstrips : o->nfaces,
+        o->opt_strips ? "strips" : "faces");
+}
+
+/* morph targets ------------------------------------------------------- */
+
+#define MORPH_MAX_INDEX 65535
+
+static
+float morph_max_delta(obj2h_t* o, size_t kind)
+{
+    float max = 0;
+    size_t i, j;
+
+    for (i = 0; i < o->nmorph_frames; ++i)
+    {
+        vec3_t const* base = kind ? o->normals : o->vertices;
+        vec3_t const* frame = kind ? o->morph_frames[i].normals :
+            o->morph_frames[i].vertices;
+        size_t n = kind ? o->nnormals : o->nvertices;
+
+        for (j = 0; j < n; ++j)
+        {
+            max = fmaxf(max, fabsf(frame[j].x - base[j].x));
+            max = fmaxf(max, fabsf(frame[j].y - base[j].y));
+            max = fmaxf(max, fabsf(frame[j].z - base[j].z));
+        }
+    }
+
+    return max;
+}
+
+/*
+ * prints the deltas of every frame for vertices (kind 0) or normals
+ * (kind 2) quantized to range steps per scale, skipping items that
+ * quantize to no movement. counts are stored per frame in first and
+ * count
+ */
+static
+size_t print_morph_deltas(obj2h_t* o, size_t kind, float scale, int range,
+    size_t* first, size_t* count)
+{
+    size_t total = 0;
+    size_t i, j;
+
+    for (i = 0; i <= o->nmorph_frames; ++i)
+    {
+        vec3_t const* base = kind ? o->normals : o->vertices;
+        size_t n = kind ? o->nnormals : o->nvertices;
+
+        first[i] = total;
+        count[i] = 0;
+
+        /* the first frame is the base mesh itself */
+        if (!i) continue;
+
+        for (j = 0; j < n; ++j)
+        {
+            vec3_t const* v = kind ? &o->morph_frames[i - 1].normals[j] :
+                &o->morph_frames[i - 1].vertices[j];
+            long d[3];
+
+            d[0] = lrintf((v->x - base[j].x) / scale);
+            d[1] = lrintf((v->y - base[j].y) / scale);
+            d[2] = lrintf((v->z - base[j].z) / scale);
+
+            if (!d[0] && !d[1] && !d[2]) continue;
+
+            d[0] = d[0] > range ? range : d[0] < -range ? -range : d[0];
+            d[1] = d[1] > range ? range : d[1] < -range ? -range : d[1];
+            d[2] = d[2] > range ? range : d[2] < -range ? -range : d[2];
+
+            oprintf(o, "    { %zd, { %ld, %ld, %ld } },\n", j, d[0], d[1],
+                d[2]);
+
+            ++count[i];
+        }
+
+        total += count[i];
+    }
+
+    return total;
+}
+
+/*
+ * prints the per-frame deltas against the base mesh and the
+ * obj2h_morph_t tying them together, see obj2h_morph.h
+ */
+static
+int print_morph(obj2h_t* o, char const* array_name)
+{
+    size_t* first;
+    size_t* count;
+    size_t npositions, nmorph_normals, i;
+    float position_scale, normal_scale;
+    size_t size, full_size;
+
+    if (o->nvertices > MORPH_MAX_INDEX + 1 || o->nnormals > MORPH_MAX_INDEX + 1)
+    {
+        eprintf(o, "morph: too many vertices or normals for 16-bit "
+            "indices\n");
+        return 1;
+    }
+
+    first = malloc(sizeof(size_t) * (o->nmorph_frames + 1) * 4);
+    if (!first) {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    count = first + (o->nmorph_frames + 1) * 2;
+
+    position_scale = morph_max_delta(o, 0) / 32767;
+    normal_scale = morph_max_delta(o, 2) / 127;
+    if (position_scale <= 0) position_scale = 1;
+    if (normal_scale <= 0) normal_scale = 1;
+
+    oputs(o, "#ifndef OBJ2H_MORPH_TYPES");
+    oputs(o, "#define OBJ2H_MORPH_TYPES");
+    oputs(o, "struct obj2h_morph_position { uint16_t index; int16_t d[3]; };");
+    oputs(o, "typedef struct obj2h_morph_position obj2h_morph_position_t;");
+    oputs(o, "struct obj2h_morph_normal "
+        "{ uint16_t index; int8_t d[3]; int8_t pad; };");
+    oputs(o, "typedef struct obj2h_morph_normal obj2h_morph_normal_t;");
+    oputs(o, "struct obj2h_morph_frame");
+    oputs(o, "{");
+    oputs(o, "    uint32_t first_position, npositions;");
+    oputs(o, "    uint32_t first_normal, nnormals;");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_morph_frame obj2h_morph_frame_t;");
+    oputs(o, "struct obj2h_morph");
+    oputs(o, "{");
+    oputs(o, "    float position_scale, normal_scale;");
+    oputs(o, "    uint32_t nframes;");
+    oputs(o, "    obj2h_morph_frame_t const* frames;");
+    oputs(o, "    obj2h_morph_position_t const* positions;");
+    oputs(o, "    obj2h_morph_normal_t const* normals;");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_morph obj2h_morph_t;");
+    oputs(o, "#endif /* !OBJ2H_MORPH_TYPES */\n");
+
+    oprintf(o, "static obj2h_morph_position_t const %s_morph_positions[] = {\n",
+        array_name);
+    npositions = print_morph_deltas(o, 0, position_scale, 32767, first,
+        count);
+    oputs(o, "};\n");
+
+    oprintf(o, "static obj2h_morph_normal_t const %s_morph_normals[] = {\n",
+        array_name);
+    nmorph_normals = print_morph_deltas(o, 2, normal_scale, 127,
+        first + o->nmorph_frames + 1, count + o->nmorph_frames + 1);
+    oputs(o, "};\n");
+
+    oprintf(o, "static obj2h_morph_frame_t const %s_morph_frames[] = {\n",
+        array_name);
+
+    for (i = 0; i <= o->nmorph_frames; ++i)
+    {
+        size_t j = o->nmorph_frames + 1 + i;
+        oprintf(o, "    { %zd, %zd, %zd, %zd },\n", first[i], count[i],
+            first[j], count[j]);
+    }
+
+    oputs(o, "};\n");
+
+    oprintf(o, "static obj2h_morph_t const %s_morph = {\n", array_name);
+    oprintf(o, "    %.9g, %.9g, %zd,\n", position_scale, normal_scale,
+        o->nmorph_frames + 1);
+    oprintf(o, "    %s_morph_frames, %s_morph_positions, %s_morph_normals\n",
+        array_name, array_name, array_name);
+    oputs(o, "};\n");
+
+    size = npositions * sizeof(obj2h_morph_position_t) +
+        nmorph_normals * sizeof(obj2h_morph_normal_t) +
+        (o->nmorph_frames + 1) * sizeof(obj2h_morph_frame_t);
+    full_size = o->nmorph_frames * (o->nvertices + o->nnormals) *
+        sizeof(vector_t);
+
+    eprintf(o, "morph: %zd frames, %zd moving positions, %zd moving "
+        "normals, %zd bytes (%zd as full frames)\n", o->nmorph_frames + 1,
+        npositions, nmorph_normals, size, full_size);
+
+    free(first);
+
+    return 0;
+}
+
+/* skins and animation clips ------------------------------------------- */
+
+static
+void print_floats(obj2h_t* o, float const* f, size_t n)
+{
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        /* no -0 */
+        oprintf(o, "%s%.9g", i ? ", " : "", f[i] == 0 ? 0 : f[i]);
+    }
+}
+
+/*
+ * prints the skin imported from a .glb, see obj2h_skin.h
+ */
+static
+int print_skin(obj2h_t* o, char const* array_name)
+{
+    size_t i;
+
+    oputs(o, "#ifndef OBJ2H_SKIN_TYPES");
+    oputs(o, "#define OBJ2H_SKIN_TYPES");
+    oputs(o, "enum { OBJ2H_ANIM_TRANSLATION, OBJ2H_ANIM_ROTATION, "
+        "OBJ2H_ANIM_SCALE };");
+    oputs(o, "enum { OBJ2H_ANIM_LINEAR, OBJ2H_ANIM_STEP };");
+    oputs(o, "struct obj2h_skin_vertex { uint8_t joints[4], weights[4]; };");
+    oputs(o, "typedef struct obj2h_skin_vertex obj2h_skin_vertex_t;");
+    oputs(o, "struct obj2h_joint_pose { float t[3], r[4], s[3]; };");
+    oputs(o, "typedef struct obj2h_joint_pose obj2h_joint_pose_t;");
+    oputs(o, "struct obj2h_joint");
+    oputs(o, "{");
+    oputs(o, "    char const* name;");
+    oputs(o, "    int32_t parent; /* -1 for roots */");
+    oputs(o, "    float inverse_bind[16];");
+    oputs(o, "    obj2h_joint_pose_t rest;");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_joint obj2h_joint_t;");
+    oputs(o, "struct obj2h_skeleton");
+    oputs(o, "{");
+    oputs(o, "    uint32_t njoints;");
+    oputs(o, "    obj2h_joint_t const* joints;");
+    oputs(o, "    float root[16]; /* parent transform of the root joints */");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_skeleton obj2h_skeleton_t;");
+    oputs(o, "struct obj2h_anim_channel");
+    oputs(o, "{");
+    oputs(o, "    uint16_t joint;");
+    oputs(o, "    uint8_t path, interpolation;");
+    oputs(o, "    uint32_t nkeys;");
+    oputs(o, "    uint32_t first_time, first_value; "
+        "/* into the clip's times, values */");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_anim_channel obj2h_anim_channel_t;");
+    oputs(o, "struct obj2h_anim_clip");
+    oputs(o, "{");
+    oputs(o, "    char const* name;");
+    oputs(o, "    float duration;");
+    oputs(o, "    uint32_t nchannels;");
+    oputs(o, "    obj2h_anim_channel_t const* channels;");
+    oputs(o, "    float const* times;");
+    oputs(o, "    float const* values;");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_anim_clip obj2h_anim_clip_t;");
+    oputs(o, "#endif /* !OBJ2H_SKIN_TYPES */\n");
+
+    if (o->nskin != o->nvertices)
+    {
+        eprintf(o, "skin: %zd weights for %zd vertices\n", o->nskin,
+            o->nvertices);
+        return 1;
+    }
+
+    oprintf(o, "static obj2h_skin_vertex_t const %s_skin[]\n"
+        "__attribute__((aligned(32))) = {\n", array_name);
+
+    for (i = 0; i < o->nskin; ++i)
+    {
+        unsigned char const* j = o->skin[i].joints;
+        unsigned char const* w = o->skin[i].weights;
+
+        oprintf(o, "    { { %d, %d, %d, %d }, { %d, %d, %d, %d } },\n",
+            j[0], j[1], j[2], j[3], w[0], w[1], w[2], w[3]);
+    }
+
+    oputs(o, "};\n");
+
+    oprintf(o, "static obj2h_joint_t const %s_joints[] = {\n", array_name);
+
+    for (i = 0; i < o->njoints; ++i)
+    {
+        joint_t const* j = &o->joints[i];
+
+        oprintf(o, "    {\n        \"%s\", %d,\n        { ", j->name,
+            j->parent);
+        print_floats(o, j->inverse_bind, 16);
+        oprintf(o, " },\n        { { ");
+        print_floats(o, j->t, 3);
+        oprintf(o, " }, { ");
+        print_floats(o, j->r, 4);
+        oprintf(o, " }, { ");
+        print_floats(o, j->s, 3);
+        oputs(o, " } }\n    },");
+    }
+
+    oputs(o, "};\n");
+
+    oprintf(o, "static obj2h_skeleton_t const %s_skeleton = {\n", array_name);
+    oprintf(o, "    %zd, %s_joints,\n    { ", o->njoints, array_name);
+    print_floats(o, o->skeleton_root, 16);
+    oputs(o, " }\n};\n");
+
+    oprintf(o, "static float const %s_anim_times[] = {\n", array_name);
+
+    for (i = 0; i < o->nanim_times; ++i)
+    {
+        oprintf(o, "    ");
+        print_floats(o, &o->anim_times[i], 1);
+        oputs(o, ",");
+    }
+
+    oputs(o, "};\n");
+
+    oprintf(o, "static float const %s_anim_values[] = {\n", array_name);
+
+    for (i = 0; i < o->nanim_channels; ++i)
+    {
+        anim_channel_t const* c = &o->anim_channels[i];
+        size_t ncomponents = c->path == OBJ2H_ANIM_ROTATION ? 4 : 3;
+        size_t k;
+
+        for (k = 0; k < c->nkeys; ++k)
+        {
+            oprintf(o, "    ");
+            print_floats(o, &o->anim_values[c->first_value + k * ncomponents],
+                ncomponents);
+            oputs(o, ",");
+        }
+    }
+
+    oputs(o, "};\n");
+
+    oprintf(o, "static obj2h_anim_channel_t const %s_anim_channels[] = {\n",
+        array_name);
+
+    for (i = 0; i < o->nanim_channels; ++i)
+    {
+        anim_channel_t const* c = &o->anim_channels[i];
+
+        oprintf(o, "    { %d, %d, %d, %zd, %zd, %zd },\n", c->joint, c->path,
+            c->interpolation, c->nkeys, c->first_time, c->first_value);
+    }
+
+    oputs(o, "};\n");
+
+    oprintf(o, "static obj2h_anim_clip_t const %s_clips[] = {\n", array_name);
+
+    for (i = 0; i < o->nanim_clips; ++i)
+    {
+        anim_clip_t const* c = &o->anim_clips[i];
+
+        oprintf(o, "    { \"%s\", %.9g, %zd, &%s_anim_channels[%zd],\n"
+            "      %s_anim_times, %s_anim_values },\n", c->name,
+            c->duration, c->nchannels, array_name, c->first_channel,
+            array_name, array_name);
+    }
+
+    oputs(o, "};\n");
+
+    return 0;
+}
+
+/* incbin embedding --------------------------------------------------- */
+
+/*
+ * the arrays live in a blob next to the header and get pulled in by the
+ * assembler, so the compiler never sees the giant initializers. the .S
+ * goes through the c preprocessor so the symbols pick up the target's
+ * label prefix (sh-elf prepends an underscore)
+ */
+static
+int write_file(obj2h_t* o, char const* path, void const* data, size_t size)
+{
+    FILE* f;
+    int err;
+
+    if (o->callbacks.file) {
+        return o->callbacks.file(o->callbacks.user, path, data, size) != 0;
+    }
+
+    f = fopen(path, "wb");
+
+    if (!f) {
+        eperror(o, path);
+        return 1;
+    }
+
+    err = fwrite(data, 1, size, f) != size;
+    err |= fclose(f) != 0;
+    if (err) eperror(o, path);
+
+    return err;
+}
+
+/*
+ * writes array_name.bin and array_name.S to the current directory and
+ * prints extern declarations for the arrays they define
+ */
+static
+int print_incbin(obj2h_t* o, char const* array_name)
+{
+    static char const* const suffixes[] = {
+        "vertices", "normals", "uvs", "faces", "colors"
+    };
+
+    static char const* const types[] = {
+        "vector_t", "vector_t", "uv_t", "face_t", "uint32_t"
+    };
+
+    buf_t b = { 0, 0, 0 };
+    buf_t s = { 0, 0, 0 };
+    char path[4096];
+    char line[sizeof(path) + 64];
+    size_t i;
+    int err = 0;
+
+    if (build_blob(o, &b)) return 1;
+
+    snprintf(path, sizeof(path), "%s.bin", array_name);
+    err |= write_file(o, path, b.data, b.size);
+
+#define S(...) \
+    (snprintf(line, sizeof(line), __VA_ARGS__), \
+     err |= buf_put(&s, line, strlen(line)))
+
+    S("/* this file was generated by " VERSION_STR " */\n\n");
+    S("#define OBJ2H_CAT_(a, b) a##b\n");
+    S("#define OBJ2H_CAT(a, b) OBJ2H_CAT_(a, b)\n");
+    S("#define OBJ2H_SYM(x) OBJ2H_CAT(__USER_LABEL_PREFIX__, x)\n\n");
+    S("    .data\n\n");
+
+    /* the whole blob, for obj2h_blob_load */
+    S("    .balign 32\n");
+    S("    .global OBJ2H_SYM(%s_blob)\n", array_name);
+    S("OBJ2H_SYM(%s_blob):\n", array_name);
+    S("    .incbin \"%s\"\n\n", path);
+
+    for (i = 0; i < (o->nvertex_colors ? 5u : 4u); ++i)
+    {
+        unsigned char const* sec = b.data + 32 + i * 16;
+
+        /* faces are decoded at runtime with --icodec */
+        if (o->opt_icodec && i == 3) continue;
+
+        S("    .global OBJ2H_SYM(%s_%s)\n", array_name, suffixes[i]);
+        S("    .set OBJ2H_SYM(%s_%s), OBJ2H_SYM(%s_blob) + %lu\n",
+            array_name, suffixes[i], array_name, read_u32(sec + 4));
+    }
+
+#undef S
+
+    snprintf(path, sizeof(path), "%s.S", array_name);
+    err |= write_file(o, path, s.data, s.size);
+
+    oprintf(o, "/* defined in %s, which embeds %s.bin */\n", path, array_name);
+    oprintf(o, "extern unsigned char %s_blob[%zd];\n", array_name, b.size);
+
+    for (i = 0; i < (o->nvertex_colors ? 5u : 4u); ++i)
+    {
+        unsigned char const* sec = b.data + 32 + i * 16;
+
+        if (o->opt_icodec && i == 3) continue;
+
+        oprintf(o, "extern %s %s_%s[%lu];\n", types[i], array_name, suffixes[i],
+            read_u32(sec + 8));
+    }
+
+    oputs(o, "");
+
+    free(b.data);
+    free(s.data);
+
+    return err;
+}
+
+/* world chunks -------------------------------------------------------- */
+
+struct chunk_face { long cell[3]; size_t face; };
+typedef struct chunk_face chunk_face_t;
+
+static
+int chunk_face_cmp(void const* a, void const* b)
+{
+    chunk_face_t const* fa = a;
+    chunk_face_t const* fb = b;
+    int i;
+
+    for (i = 2; i >= 0; --i)
+    {
+        if (fa->cell[i] != fb->cell[i]) {
+            return fa->cell[i] < fb->cell[i] ? -1 : 1;
+        }
+    }
+
+    /* keep the face order within a chunk, --cache and --morton set it */
+    return fa->face < fb->face ? -1 : fa->face > fb->face;
+}
+
+/*
+ * index of item in a chunk's compacted array, which gets it the first
+ * time it's used. map holds the chunk's index + 1 per source item
+ */
+static
+int chunk_remap(int item, size_t* map, size_t* used, size_t* nused)
+{
+    if (item < 0) return -1;
+
+    if (!map[item])
+    {
+        used[*nused] = (size_t)item;
+        map[item] = ++*nused;
+    }
+
+    return (int)map[item] - 1;
+}
+
+/* the first lines of every header */
+static
+void print_banner(obj2h_t* o)
+{
+    oputs(o, "/* this file was generated by " VERSION_STR " */");
+    oputs(o, "/* vertices have y flipped (y is down), normals keep the y "
+        "the file had */\n");
+}
+
+/*
+ * writes array_name.chunks to the current directory, one blob per
+ * occupied grid cell, and prints the table that finds them
+ */
+static
+int print_chunks(obj2h_t* o, char const* array_name)
+{
+    chunk_face_t* order = malloc(sizeof(chunk_face_t) * (o->nfaces + 1));
+    size_t* maps[3];
+    size_t* used[3];
+    vec3_t* cv = malloc(sizeof(vec3_t) * (o->nvertices + 1));
+    vec3_t* cn = malloc(sizeof(vec3_t) * (o->nnormals + 1));
+    uv_t* cu = malloc(sizeof(uv_t) * (o->nuvs + 1));
+    face_t* cf = malloc(sizeof(face_t) * (o->nfaces + 1));
+    unsigned long* cc = malloc(sizeof(unsigned long) * (o->nvertices + 1));
+    buf_t pack = { 0, 0, 0 };
+    size_t const counts[3] = { o->nvertices, o->nuvs, o->nnormals };
+    vec3_t origin, max;
+    size_t i, j, nchunks = 0, largest = 0;
+    char path[4096];
+    int err = 0, k;
+
+    for (k = 0; k < 3; ++k)
+    {
+        maps[k] = calloc(counts[k] + 1, sizeof(size_t));
+        used[k] = malloc(sizeof(size_t) * (counts[k] + 1));
+    }
+
+    if (!order || !cv || !cn || !cu || !cf || !cc || !maps[0] || !maps[1] ||
+        !maps[2] || !used[0] || !used[1] || !used[2])
+    {
+        eperror(o, "malloc");
+        err = 1;
+        goto done;
+    }
+
+    bounds(o, o->vertices, o->nvertices, &origin, &max);
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        int const* vi = o->faces[i].vertex_indices;
+        float const* org = &origin.x;
+
+        for (k = 0; k < 3; ++k)
+        {
+            float c = ((&o->vertices[vi[0]].x)[k] +
+                (&o->vertices[vi[1]].x)[k] + (&o->vertices[vi[2]].x)[k]) / 3;
+
+            order[i].cell[k] = (long)floorf((c - org[k]) / o->opt_chunks);
+        }
+
+        order[i].face = i;
+    }
+
+    err = parallel_sort(o, order, o->nfaces, sizeof(chunk_face_t),
+        chunk_face_cmp);
+
+    print_banner(o);
+    oputs(o, "#ifndef OBJ2H_CHUNK_TYPES");
+    oputs(o, "#define OBJ2H_CHUNK_TYPES");
+    oputs(o, "struct obj2h_chunk");
+    oputs(o, "{");
+    oputs(o, "    float min[3], max[3]; /* bounds of the faces in it */");
+    oputs(o, "    int32_t cell[3];      /* grid coordinates */");
+    oputs(o, "    uint32_t offset, size; /* of its blob in the .chunks "
+        "file */");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_chunk obj2h_chunk_t;");
+    oputs(o, "struct obj2h_chunks");
+    oputs(o, "{");
+    oputs(o, "    float origin[3]; /* cell x covers origin + [x, x + 1) * "
+        "cell_size */");
+    oputs(o, "    float cell_size;");
+    oputs(o, "    uint32_t nchunks;");
+    oputs(o, "    obj2h_chunk_t const* table;");
+    oputs(o, "    char const* file; /* name of the .chunks file */");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_chunks obj2h_chunks_t;");
+    oputs(o, "#endif /* !OBJ2H_CHUNK_TYPES */\n");
+
+    oprintf(o, "static obj2h_chunk_t const %s_chunk_table[] = {\n", array_name);
+
+    for (i = 0; i < o->nfaces && !err; i = j)
+    {
+        size_t nused[3] = { 0, 0, 0 }, nf = 0, offset = pack.size, n;
+        vec3_t cmin, cmax;
+
+        for (j = i; j < o->nfaces; ++j)
+        {
+            face_t* f = &cf[nf];
+
+            if (memcmp(order[j].cell, order[i].cell, sizeof(order[i].cell))) {
+                break;
+            }
+
+            *f = o->faces[order[j].face];
+
+            for (k = 0; k < 3; ++k)
+            {
+                f->vertex_indices[k] = chunk_remap(f->vertex_indices[k],
+                    maps[0], used[0], &nused[0]);
+                f->uv_indices[k] = chunk_remap(f->uv_indices[k], maps[1],
+                    used[1], &nused[1]);
+                f->normal_indices[k] = chunk_remap(f->normal_indices[k],
+                    maps[2], used[2], &nused[2]);
+            }
+
+            ++nf;
+        }
+
+        for (n = 0; n < nused[0]; ++n) cv[n] = o->vertices[used[0][n]];
+        for (n = 0; n < nused[1]; ++n) cu[n] = o->uvs[used[1][n]];
+        for (n = 0; n < nused[2]; ++n) cn[n] = o->normals[used[2][n]];
+
+        for (n = 0; n < nused[0] && o->nvertex_colors; ++n) {
+            cc[n] = o->vertex_colors[used[0][n]];
+        }
+
+        /* the maps are big, only clear what this chunk set */
+        for (k = 0; k < 3; ++k)
+        {
+            for (n = 0; n < nused[k]; ++n) {
+                maps[k][used[k][n]] = 0;
+            }
+        }
+
+        err |= build_blob_arrays(&pack, cv, nused[0], cn, nused[2], cu,
+            nused[1], cf, nf, cc, o->nvertex_colors ? nused[0] : 0);
+
+        bounds(o, cv, nused[0], &cmin, &cmax);
+        oprintf(o, "    { { %.9g, %.9g, %.9g }, { %.9g, %.9g, %.9g }, "
+            "{ %ld, %ld, %ld }, %zd, %zd },\n", cmin.x, cmin.y, cmin.z,
+            cmax.x, cmax.y, cmax.z, order[i].cell[0], order[i].cell[1],
+            order[i].cell[2], offset, pack.size - offset);
+
+        if (pack.size - offset > largest) largest = pack.size - offset;
+        ++nchunks;
+    }
+
+    oputs(o, "};\n");
+
+    snprintf(path, sizeof(path), "%s.chunks", array_name);
+
+    oprintf(o, "static obj2h_chunks_t const %s_chunks = {\n", array_name);
+    oprintf(o, "    { %.9g, %.9g, %.9g }, %.9g,\n", origin.x, origin.y,
+        origin.z, o->opt_chunks);
+    oprintf(o, "    %zd,\n", nchunks);
+    oprintf(o, "    %s_chunk_table,\n", array_name);
+    oprintf(o, "    \"%s\",\n", path);
+    oputs(o, "};\n");
+
+    if (!err) err |= write_file(o, path, pack.data, pack.size);
+
+    eprintf(o, "chunks: %zd, %.1f faces each, largest %zd bytes, "
+        "%zd bytes in %s\n", nchunks, nchunks ? (double)o->nfaces / nchunks :
+        0, largest, pack.size, path);
+
+done:
+    for (k = 0; k < 3; ++k)
+    {
+        free(maps[k]);
+        free(used[k]);
+    }
+
+    free(order);
+    free(cv);
+    free(cn);
+    free(cu);
+    free(cf);
+    free(cc);
+    free(pack.data);
+
+    return err;
+}
+
+/* mesh statistics ----------------------------------------------------- */
+
+/*
+ * simulates a fifo post-transform cache of size entries over the faces
+ * in their current order. acmr is misses per triangle, atvr misses per
+ * referenced vertex (1 is optimal)
+ */
+static
+void fifo_stats(obj2h_t* o, size_t size, double* acmr, double* atvr)
+{
+    size_t* cache_time = calloc(o->nvertices + 1, sizeof(size_t));
+    size_t time = size + 1;
+    size_t misses = 0, used = 0;
+    size_t i;
+    int j;
+
+    *acmr = *atvr = 0;
+
+    if (!cache_time) {
+        eperror(o, "calloc");
+        return;
+    }
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        for (j = 0; j < 3; ++j)
+        {
+            int v = o->faces[i].vertex_indices[j];
+
+            if (v < 0 || (size_t)v >= o->nvertices) continue;
+
+            if (!cache_time[v]) ++used;
+
+            /* entries are stamped with the miss count when they enter */
+            if (!cache_time[v] || time - cache_time[v] > size)
+            {
+                cache_time[v] = time++;
+                ++misses;
+            }
+        }
+    }
+
+    if (o->nfaces) *acmr = (double)misses / o->nfaces;
+    if (used) *atvr = (double)misses / used;
+
+    free(cache_time);
+}
+
+#define STATS_PVR_VERTEX_SIZE 32
+#define STATS_PVR_HEADER_SIZE 32
+
+/*
+ * prints a json report of the mesh as it would be emitted with the
+ * other options given, for asset dashboards
+ */
+static
+int print_stats(obj2h_t* o, char const* array_name)
+{
+    static size_t const cache_sizes[] = { 8, 16, 24, 32 };
+
+    buf_t blob = { 0, 0, 0 };
+    buf_t zblob = { 0, 0, 0 };
+    buf_t icodec_faces = { 0, 0, 0 };
+    buf_t icodec_strips = { 0, 0, 0 };
+    face_t* scratch;
+    unsigned char* bad;
+    size_t degenerate, duplicate;
+    size_t strip_vertices, i;
+    vec3_t min, max, center;
+    float radius;
+    int err = 0;
+
+    /* strips are always reported, whether or not they're emitted */
+    if (!o->opt_strips && build_strips(o)) return 1;
+
+    scratch = malloc(sizeof(face_t) * (o->nfaces + 1));
+    if (!scratch) {
+        eperror(o, "malloc");
+        return 1;
+    }
+
+    /* the face encoder rotates faces, so it gets a copy */
+    memcpy(scratch, o->faces, sizeof(face_t) * o->nfaces);
+
+    err |= build_blob(o, &blob);
+    err |= build_zblob(o, &zblob);
+    err |= encode_faces(o, scratch, o->nfaces, &icodec_faces);
+    err |= encode_strips(o, o->strip_corners, o->nstrip_corners,
+        &icodec_strips);
+    free(scratch);
+
+    bad = find_bad_faces(o, &degenerate, &duplicate);
+    if (!bad) err = 1;
+    free(bad);
+
+    if (err) goto done;
+
+    bounds(o, o->vertices, o->nvertices, &min, &max);
+    radius = bounding_sphere(o, o->vertices, o->nvertices, &center);
+
+    strip_vertices = o->nstrip_corners - o->nstrips;
+
+    oprintf(o, "{\n");
+    oprintf(o, "  \"name\": \"%s\",\n", array_name);
+    oprintf(o, "  \"counts\": { \"vertices\": %zd, \"normals\": %zd, "
+        "\"uvs\": %zd, \"faces\": %zd },\n", o->nvertices, o->nnormals, o->nuvs,
+        o->nfaces);
+
+    oprintf(o, "  \"memory\": {\n");
+    oprintf(o, "    \"header\": { \"vertices\": %zd, \"normals\": %zd, "
+        "\"uvs\": %zd, \"faces\": %zd, \"strips\": %zd },\n",
+        o->nvertices * sizeof(vector_t), o->nnormals * sizeof(vector_t),
+        o->nuvs * sizeof(uv_t), o->nfaces * sizeof(face_t),
+        o->nstrip_corners * sizeof(corner_t));
+    oprintf(o, "    \"blob\": %zd,\n", blob.size);
+    oprintf(o, "    \"zblob\": %zd,\n", zblob.size);
+    oprintf(o, "    \"icodec\": { \"faces\": %zd, \"strips\": %zd },\n",
+        icodec_faces.size, icodec_strips.size);
+    oprintf(o, "    \"pvr_stream\": %zd\n", STATS_PVR_HEADER_SIZE +
+        (o->opt_strips ? strip_vertices : o->nfaces * 3) *
+        STATS_PVR_VERTEX_SIZE);
+    oprintf(o, "  },\n");
+
+    oprintf(o, "  \"vertex_cache\": [\n");
+
+    for (i = 0; i < sizeof(cache_sizes) / sizeof(*cache_sizes); ++i)
+    {
+        double acmr, atvr;
+
+        fifo_stats(o, cache_sizes[i], &acmr, &atvr);
+        oprintf(o, "    { \"fifo\": %zd, \"acmr\": %.4f, \"atvr\": %.4f }%s\n",
+            cache_sizes[i], acmr, atvr,
+            i + 1 < sizeof(cache_sizes) / sizeof(*cache_sizes) ? "," : "");
+    }
+
+    oprintf(o, "  ],\n");
+
+    oprintf(o, "  \"strips\": { \"count\": %zd, \"vertices\": %zd, "
+        "\"average_triangles\": %.4f },\n", o->nstrips, strip_vertices,
+        o->nstrips ? (double)o->nfaces / o->nstrips : 0);
+
+    oprintf(o, "  \"bounds\": {\n");
+    oprintf(o, "    \"min\": [ %.9g, %.9g, %.9g ],\n", min.x, min.y, min.z);
+    oprintf(o, "    \"max\": [ %.9g, %.9g, %.9g ],\n", max.x, max.y, max.z);
+    oprintf(o, "    \"sphere\": { \"center\": [ %.9g, %.9g, %.9g ], "
+        "\"radius\": %.9g }\n", center.x, center.y, center.z, radius);
+    oprintf(o, "  },\n");
+
+    oprintf(o, "  \"faces\": { \"degenerate\": %zd, \"duplicate\": %zd },\n",
+        degenerate, duplicate);
+
+    /*
+     * what goes through the ta every frame: a header plus 32 bytes per
+     * vertex, and the transform reads and writes every vector_t once
+     */
+    oprintf(o, "  \"per_frame\": {\n");
+    oprintf(o, "    \"pvr_bytes_lists\": %zd,\n", STATS_PVR_HEADER_SIZE +
+        o->nfaces * 3 * STATS_PVR_VERTEX_SIZE);
+    oprintf(o, "    \"pvr_bytes_strips\": %zd,\n", STATS_PVR_HEADER_SIZE +
+        strip_vertices * STATS_PVR_VERTEX_SIZE);
+    oprintf(o, "    \"transform_bytes\": %zd\n",
+        (o->nvertices + o->nnormals) * sizeof(vector_t) * 2);
+    oprintf(o, "  }\n");
+    oprintf(o, "}\n");
+
+done:
+    free(blob.data);
+    free(zblob.data);
+    free(icodec_faces.data);
+    free(icodec_strips.data);
+
+    return err;
+}
+
+/* output -------------------------------------------------------------- */
+
+static
+void print_bytes(obj2h_t* o, buf_t const* b)
+{
+    size_t n;
+
+    for (n = 0; n < b->size; ++n)
+    {
+        oprintf(o, "%s0x%02x,", n % 12 ? " " : "    ", b->data[n]);
+        if (n % 12 == 11 || n == b->size - 1) oputs(o, "");
+    }
+}
+
+/*
+ * rows of the big arrays are formatted on every thread, PRINT_BATCH
+ * chunks at a time so the text doesn't all sit in memory, and written
+ * in order
+ */
+#define PRINT_BATCH 64
+
+/* formats row i of an array at the end of b */
+typedef int (*print_row_t)(obj2h_t* o, size_t i, buf_t* b);
+
+struct print_job
+{
+    obj2h_t* o;
+    print_row_t row;
+    size_t base; /* of the batch */
+    buf_t bufs[PRINT_BATCH];
+};
+
+typedef struct print_job print_job_t;
+
+static
+int buf_printf(buf_t* b, char const* fmt, ...)
+{
+    char line[256];
+    va_list ap;
+    int n;
+
+    va_start(ap, fmt);
+    n = vsnprintf(line, sizeof(line), fmt, ap);
+    va_end(ap);
+
+    return n < 0 || (size_t)n >= sizeof(line) || buf_put(b, line, n);
+}
+
+static
+int print_chunk(void* ctx, size_t first, size_t last)
+{
+    print_job_t* j = ctx;
+    buf_t* b = &j->bufs[first / PARALLEL_GRAIN];
+    size_t i;
+
+    b->size = 0;
+
+    for (i = first; i < last; ++i) {
+        if (j->row(j->o, j->base + i, b)) return 1;
+    }
+
+    return 0;
+}
+
+static
+void print_rows(obj2h_t* o, size_t n, print_row_t row)
+{
+    print_job_t* j = calloc(1, sizeof(print_job_t));
+    size_t batch = PRINT_BATCH * PARALLEL_GRAIN, c;
+
+    if (!j)
+    {
+        eperror(o, "calloc");
+        o->failed = 1;
+        return;
+    }
+
+    j->o = o;
+    j->row = row;
+
+    for (j->base = 0; j->base < n && !o->failed; j->base += batch)
+    {
+        size_t count = n - j->base < batch ? n - j->base : batch;
+
+        if (parallel_for(o, count, PARALLEL_GRAIN, print_chunk, j))
+        {
+            o->failed = 1;
+            break;
+        }
+
+        for (c = 0; c * PARALLEL_GRAIN < count; ++c) {
+            owrite(o, j->bufs[c].data, j->bufs[c].size);
+        }
+    }
+
+    for (c = 0; c < PRINT_BATCH; ++c) {
+        free(j->bufs[c].data);
+    }
+
+    free(j);
+}
+
+static
+int print_vertex_row(obj2h_t* o, size_t i, buf_t* b)
+{
+    vec3_t const* v = &o->vertices[i];
+    return buf_printf(b, "    { %.17g, %.17g, %.17g, 1 },\n", v->x, v->y,
+        v->z);
+}
+
+static
+int print_normal_row(obj2h_t* o, size_t i, buf_t* b)
+{
+    vec3_t const* v = &o->normals[i];
+    return buf_printf(b, "    { %.17g, %.17g, %.17g, 0 },\n", v->x, v->y,
+        v->z);
+}
+
+static
+int print_uv_row(obj2h_t* o, size_t i, buf_t* b)
+{
+    uv_t const* uv = &o->uvs[i];
+    return buf_printf(b, "    { %.17g, %.17g  },\n", uv->u, uv->v);
+}
+
+static
+int print_uv16_row(obj2h_t* o, size_t i, buf_t* b)
+{
+    return buf_printf(b, "    0x%08lX,\n", uv16_pack(o, &o->uvs[i]));
+}
+
+static
+int print_color_row(obj2h_t* o, size_t i, buf_t* b)
+{
+    return buf_printf(b, "    0x%08lX,\n", o->vertex_colors[i]);
+}
+
+static
+int print_face_row(obj2h_t* o, size_t i, buf_t* b)
+{
+    face_t const* f = &o->faces[i];
+    int const* v = f->vertex_indices;
+    int const* t = f->uv_indices;
+    int const* n = f->normal_indices;
+
+    return buf_printf(b, "    { { %d, %d, %d }, { %d, %d, %d }, "
+        "{ %d, %d, %d } },\n", v[0], v[1], v[2], t[0], t[1], t[2], n[0], n[1],
+        n[2]);
+}
+
+static
+int print_header(obj2h_t* o, char const* array_name)
+{
+    size_t n;
+
+    print_banner(o);
+    oputs(o, "#ifndef OBJ2H_TYPES");
+    oputs(o, "#define OBJ2H_TYPES");
+    oprintf(o, "struct face { int vertex_indices[3], uv_indices[3], "
+        "normal_indices[3]; };\n");
+    oputs(o, "typedef struct face face_t;");
+    oputs(o, "struct uv { float u, v; };");
+    oputs(o, "typedef struct uv uv_t;");
+    oputs(o, "#endif /* !OBJ2H_TYPES */\n");
+
+    if (o->opt_strips)
+    {
+        oputs(o, "#ifndef OBJ2H_STRIP_TYPES");
+        oputs(o, "#define OBJ2H_STRIP_TYPES");
+        oputs(o, "struct corner { int vertex_index, uv_index, "
+            "normal_index; };");
+        oputs(o, "typedef struct corner corner_t;");
+        oputs(o, "#endif /* !OBJ2H_STRIP_TYPES */\n");
+    }
+
+    if (o->opt_incbin)
+    {
+        if (print_incbin(o, array_name)) return 1;
+        goto print_faces;
+    }
+
+    oprintf(o, "static vector_t %s_vertices[]\n"
+        "__attribute__((aligned(32))) = {\n", array_name);
+
+    print_rows(o, o->nvertices, print_vertex_row);
+    oputs(o, "};\n");
+
+    oprintf(o, "static vector_t %s_normals[]\n"
+        "__attribute__((aligned(32))) = {\n", array_name);
+    print_rows(o, o->nnormals, print_normal_row);
+    oputs(o, "};\n");
+
+    oprintf(o, "static uv_t %s_uvs[]\n"
+        "__attribute__((aligned(32))) = {\n", array_name);
+    print_rows(o, o->nuvs, print_uv_row);
+    oputs(o, "};\n");
+
+    if (o->opt_uv16)
+    {
+        oprintf(o, "static uint32_t %s_uvs16[]\n"
+            "__attribute__((aligned(32))) = {\n", array_name);
+        print_rows(o, o->nuvs, print_uv16_row);
+        oputs(o, "};\n");
+    }
+
+    if (o->nvertex_colors)
+    {
+        oprintf(o, "static uint32_t %s_colors[]\n"
+            "__attribute__((aligned(32))) = {\n", array_name);
+        print_rows(o, o->nvertex_colors, print_color_row);
+        oputs(o, "};\n");
+    }
+
+print_faces:
+    if (o->opt_icodec)
+    {
+        buf_t b = { 0, 0, 0 };
+
+        /* faces are decoded at runtime into a zero initialized array */
+        if (encode_faces(o, o->faces, o->nfaces, &b)) return 1;
+        if (icodec_check(o, "faces", &b, o->faces, o->nfaces, o->nfaces)) {
+            return 1;
+        }
+
+        oprintf(o, "static face_t %s_faces[%zd]\n"
+            "__attribute__((aligned(32)));\n\n", array_name, o->nfaces);
+        oprintf(o, "static unsigned char const %s_faces_encoded[] = {\n",
+            array_name);
+        print_bytes(o, &b);
+        oputs(o, "};\n");
+
+        free(b.data);
+    }
+
+    else if (!o->opt_incbin)
+    {
+        oprintf(o, "static face_t %s_faces[]\n"
+            "__attribute__((aligned(32))) = {\n", array_name);
+        print_rows(o, o->nfaces, print_face_row);
+        oputs(o, "};\n");
+    }
+
+    if (o->opt_strips && o->opt_icodec)
+    {
+        buf_t b = { 0, 0, 0 };
+
+        if (encode_strips(o, o->strip_corners, o->nstrip_corners, &b) ||
+            icodec_check(o, "strips", &b, o->strip_corners, o->nstrip_corners,
+                o->nfaces))
+        {
+            return 1;
+        }
+
+        oprintf(o, "static corner_t %s_strips[%zd]\n"
+            "__attribute__((aligned(32)));\n\n", array_name,
+            o->nstrip_corners);
+        oprintf(o, "static unsigned char const %s_strips_encoded[] = {\n",
+            array_name);
+        print_bytes(o, &b);
+        oputs(o, "};\n");
+
+        free(b.data);
+    }
+
+    else if (o->opt_strips)
+    {
+        oprintf(o, "static corner_t %s_strips[]\n"
+            "__attribute__((aligned(32))) = {\n", array_name);
+
+        for (n = 0; n < o->nstrip_corners; ++n)
+        {
+            corner_t* c = &o->strip_corners[n];
+            oprintf(o, "    { %d, %d, %d },\n", c->vertex_index, c->uv_index,
+                c->normal_index);
+        }
+
+        oputs(o, "};\n");
+    }
+
+    if (o->opt_pvr) {
+        print_pvr(o, array_name);
+    }
+
+    if (o->opt_draw) {
+        print_draw(o, array_name);
+    }
+
+    if (o->opt_morph && print_morph(o, array_name)) {
+        return 1;
+    }
+
+    if (o->njoints && print_skin(o, array_name)) {
+        return 1;
+    }
+
+    if (o->opt_progressive) {
+        print_progressive(o, array_name);
+    }
+
+    if (o->opt_impostor_views) {
+        print_impostor(o, array_name);
+    }
+
+    if (o->opt_edges && print_edges(o, array_name)) {
+        return 1;
+    }
+
+    if (o->opt_bvh) {
+        print_bvh(o, array_name);
+    }
+
+    if (o->opt_prt) {
+        print_prt(o, array_name);
+    }
+
+    if (o->opt_collision && print_collision(o, array_name)) {
+        return 1;
+    }
+
+    if (o->opt_hull_given) {
+        print_hull(o, array_name);
+    }
+
+    return 0;
+}
+
+/* shared pools -------------------------------------------------------- */
+
+struct pool_range
+{
+    char name[64];
+    size_t first_vertex, nvertices, first_normal, nnormals;
+    size_t first_uv, nuvs, first_face, nfaces;
+    vec3_t center;
+    float radius;
+};
+
+typedef struct pool_range pool_range_t;
+
+static
+int pool_append(void** pool, size_t* npool, size_t* cap, void const* items,
+    size_t n, size_t size)
+{
+    if (reserve(size, pool, *npool + n, cap)) return 1;
+
+    if (n) memcpy((char*)*pool + *npool * size, items, n * size);
+    *npool += n;
+
+    return 0;
+}
+
+/*
+ * moves the current model to the end of the pool, rebasing its indices,
+ * and empties the model arrays for the next one
+ */
+static
+int pool_add(obj2h_t* o, char const* name)
+{
+    pool_range_t* r = push_back(sizeof(pool_range_t), (void**)&o->pool_ranges,
+        &o->npool_ranges, &o->pool_ranges_cap);
+    size_t i;
+    int j;
+
+    if (!r) return 1;
+
+    /*
+     * colors go along the vertices as soon as one model has some, the
+     * ones that don't are white like uncolored vertices always are
+     */
+    if (o->nvertex_colors || o->npool_colors)
+    {
+        if (fill_vertex_colors(o, o->nvertices)) return 1;
+
+        while (o->npool_colors < o->npool_vertices)
+        {
+            unsigned long white = 0xFFFFFFFF;
+
+            if (pool_append((void**)&o->pool_colors, &o->npool_colors,
+                &o->pool_colors_cap, &white, 1, sizeof(unsigned long)))
+            {
+                return 1;
+            }
+        }
+    }
+
+    snprintf(r->name, sizeof(r->name), "%s", name);
+    r->first_vertex = o->npool_vertices;
+    r->nvertices = o->nvertices;
+    r->first_normal = o->npool_normals;
+    r->nnormals = o->nnormals;
+    r->first_uv = o->npool_uvs;
+    r->nuvs = o->nuvs;
+    r->first_face = o->npool_faces;
+    r->nfaces = o->nfaces;
+    r->radius = bounding_sphere(o, o->vertices, o->nvertices, &r->center);
+
+    for (i = 0; i < o->nfaces; ++i)
+    {
+        face_t* f = &o->faces[i];
+
+        for (j = 0; j < 3; ++j)
+        {
+            if (f->vertex_indices[j] >= 0) {
+                f->vertex_indices[j] += (int)r->first_vertex;
+            }
+
+            if (f->uv_indices[j] >= 0) {
+                f->uv_indices[j] += (int)r->first_uv;
+            }
+
+            if (f->normal_indices[j] >= 0) {
+                f->normal_indices[j] += (int)r->first_normal;
+            }
+        }
+    }
+
+    if (pool_append((void**)&o->pool_vertices, &o->npool_vertices,
+            &o->pool_vertices_cap, o->vertices, o->nvertices, sizeof(vec3_t)) ||
+        pool_append((void**)&o->pool_normals, &o->npool_normals,
+            &o->pool_normals_cap, o->normals, o->nnormals, sizeof(vec3_t)) ||
+        pool_append((void**)&o->pool_uvs, &o->npool_uvs, &o->pool_uvs_cap,
+            o->uvs, o->nuvs, sizeof(uv_t)) ||
+        pool_append((void**)&o->pool_faces, &o->npool_faces, &o->pool_faces_cap,
+            o->faces, o->nfaces, sizeof(face_t)) ||
+        pool_append((void**)&o->pool_colors, &o->npool_colors,
+            &o->pool_colors_cap, o->vertex_colors, o->nvertex_colors,
+            sizeof(unsigned long)))
+    {
+        return 1;
+    }
+
+    eprintf(o, "pool: %s, %zd vertices, %zd faces\n", r->name,
+        o->nvertices, o->nfaces);
+
+    o->nvertices = o->nnormals = o->nuvs = o->nfaces = 0;
+    o->nvertex_colors = 0;
+
+    return 0;
+}
+
+/* makes the pool the current model so the usual output code emits it */
+static
+void pool_finish(obj2h_t* o)
+{
+    free(o->vertices);
+    free(o->normals);
+    free(o->uvs);
+    free(o->faces);
+    free(o->vertex_colors);
+
+    o->vertices = o->pool_vertices;
+    o->nvertices = o->npool_vertices;
+    o->vertices_cap = o->pool_vertices_cap;
+    o->normals = o->pool_normals;
+    o->nnormals = o->npool_normals;
+    o->normals_cap = o->pool_normals_cap;
+    o->uvs = o->pool_uvs;
+    o->nuvs = o->npool_uvs;
+    o->uvs_cap = o->pool_uvs_cap;
+    o->faces = o->pool_faces;
+    o->nfaces = o->npool_faces;
+    o->faces_cap = o->pool_faces_cap;
+    o->vertex_colors = o->pool_colors;
+    o->nvertex_colors = o->npool_colors;
+    o->vertex_colors_cap = o->pool_colors_cap;
+
+    o->pool_vertices = o->pool_normals = 0;
+    o->pool_uvs = 0;
+    o->pool_faces = 0;
+    o->pool_colors = 0;
+}
+
+static
+void print_upper(obj2h_t* o, char const* s)
+{
+    for (; *s; ++s) oputc(o, toupper((unsigned char)*s));
+}
+
+static
+void print_pool(obj2h_t* o, char const* array_name)
+{
+    size_t i;
+
+    oputs(o, "#ifndef OBJ2H_POOL_TYPES");
+    oputs(o, "#define OBJ2H_POOL_TYPES");
+    oputs(o, "struct obj2h_draw_range");
+    oputs(o, "{");
+    oputs(o, "    char const* name;");
+    oputs(o, "    uint32_t first_vertex, nvertices;");
+    oputs(o, "    uint32_t first_normal, nnormals;");
+    oputs(o, "    uint32_t first_uv, nuvs;");
+    oputs(o, "    uint32_t first_face, nfaces;");
+    oputs(o, "    float center[3], radius; /* bounding sphere, model space */");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_draw_range obj2h_draw_range_t;");
+    oputs(o, "struct obj2h_pool");
+    oputs(o, "{");
+    oputs(o, "    vector_t* vertices;");
+    oputs(o, "    vector_t* normals;");
+    oputs(o, "    uv_t* uvs;");
+    oputs(o, "    face_t* faces;");
+    oputs(o, "    uint32_t* colors; /* per vertex, 0 if no model had any */");
+    oputs(o, "    uint32_t nvertices, nnormals, nuvs, nfaces;");
+    oputs(o, "    uint32_t nranges;");
+    oputs(o, "    obj2h_draw_range_t const* ranges;");
+    oputs(o, "};");
+    oputs(o, "typedef struct obj2h_pool obj2h_pool_t;");
+    oputs(o, "#endif /* !OBJ2H_POOL_TYPES */\n");
+
+    oputs(o, "enum");
+    oputs(o, "{");
+
+    for (i = 0; i < o->npool_ranges; ++i)
+    {
+        oprintf(o, "    ");
+        print_upper(o, array_name);
+        oputc(o, '_');
+        print_upper(o, o->pool_ranges[i].name);
+        oprintf(o, ",\n");
+    }
+
+    oprintf(o, "    ");
+    print_upper(o, array_name);
+    oprintf(o, "_NRANGES\n};\n\n");
+
+    oprintf(o, "static obj2h_draw_range_t const %s_ranges[] = {\n", array_name);
+
+    for (i = 0; i < o->npool_ranges; ++i)
+    {
+        pool_range_t const* r = &o->pool_ranges[i];
+
+        oprintf(o, "    { \"%s\", %zd, %zd, %zd, %zd, %zd, %zd, %zd, %zd,\n",
+            r->name, r->first_vertex, r->nvertices, r->first_normal,
+            r->nnormals, r->first_uv, r->nuvs, r->first_face, r->nfaces);
+        oprintf(o, "      { %.9g, %.9g, %.9g }, %.9g },\n", r->center.x,
+            r->center.y, r->center.z, r->radius);
+    }
+
+    oputs(o, "};\n");
+
+    oprintf(o, "static obj2h_pool_t const %s_pool = {\n", array_name);
+    oprintf(o, "    %s_vertices, %s_normals, %s_uvs, %s_faces,\n", array_name,
+        array_name, array_name, array_name);
+
+    if (o->nvertex_colors) {
+        oprintf(o, "    %s_colors,\n", array_name);
+    } else {
+        oputs(o, "    0,");
+    }
+
+    oprintf(o, "    %zd, %zd, %zd, %zd,\n", o->nvertices, o->nnormals,
+        o->nuvs, o->nfaces);
+    oprintf(o, "    %zd, %s_ranges\n", o->npool_ranges, array_name);
+    oputs(o, "};");
+}
+
+/* library interface -------------------------------------------------- */
+
+/* picks the importer by extension */
+static
+int load_model(obj2h_t* o, char const* path, void const* data, size_t size)
+{
+    char const* ext = strrchr(path, '.');
+
+    ext = ext ? ext : "";
+
+    if (!strcasecmp(ext, ".glb"))
+    {
+        if (parse_glb(o, path, data, size)) {
+            return 1;
+        }
+
+        if (o->njoints && (o->opt_blob || o->opt_zblob || o->opt_pool)) {
+            eprintf(o, "gltf: the skin only goes in single model "
+                "headers, writing the mesh alone\n");
+        }
+    }
+
+    else if (!strcasecmp(ext, ".ply")) {
+        if (parse_ply(o, path, data, size)) return 1;
+    } else if (!strcasecmp(ext, ".stl")) {
+        if (parse_stl(o, path, data, size)) return 1;
+    } else if (parse_obj(o, data, size)) {
+        return 1;
+    }
+
+    return record_callbacks(o, path);
+}
+
+/* everything between loading a model and emitting it */
+static
+int process_model(obj2h_t* o)
+{
+    if (o->opt_weld && cleanup_mesh(o)) {
+        return 1;
+    }
+
+    if (o->opt_morton && morton_sort(o)) {
+        return 1;
+    }
+
+    if (o->opt_cache && optimize_cache(o)) {
+        return 1;
+    }
+
+    return 0;
+}
+
+/* use filename without directories or extension as the base array name */
+static
+void model_name(char const* path, char* name, size_t size)
+{
+    char const* base = strrchr(path, '/');
+    size_t n;
+
+    base = base ? base + 1 : path;
+
+    for (n = 0; n + 1 < size && base[n] && base[n] != '.'; ++n)
+    {
+        switch (base[n])
+        {
+        case ' ':
+        case '\t':
+        case '-':
+            name[n] = '_';
+            break;
+
+        default:
+            name[n] = base[n];
+            break;
+        }
+    }
+
+    name[n] = 0;
+}
+
+/* the options that don't go together, checked before the first model */
+static
+int check_options(obj2h_t* o)
+{
+    if (o->opt_morph && (o->opt_blob || o->opt_zblob))
+    {
+        eprintf(o, "--morph only works with header output\n");
+        return 1;
+    }
+
+    if (o->opt_draw && (o->opt_blob || o->opt_zblob))
+    {
+        eprintf(o, "--draw only works with header output\n");
+        return 1;
+    }
+
+    /* the blob writers only store the plain arrays */
+    if ((o->opt_strips || o->opt_pvr || o->opt_icodec) &&
+        (o->opt_blob || o->opt_zblob))
+    {
+        eprintf(o, "--strips, --pvr and --icodec only work with header "
+            "output\n");
+        return 1;
+    }
+
+    /* the report replaces the output, there'd be no blob to describe */
+    if (o->opt_stats && (o->opt_blob || o->opt_zblob))
+    {
+        eprintf(o, "--stats doesn't work with --blob or --zblob\n");
+        return 1;
+    }
+
+    /* the pool's range table only covers the plain arrays */
+    if (o->opt_pool && (o->opt_morph || o->opt_blob || o->opt_zblob ||
+        o->opt_strips || o->opt_pvr || o->opt_draw || o->opt_icodec))
+    {
+        eprintf(o, "--pool doesn't work with --morph, --blob, "
+            "--zblob, --strips, --pvr, --draw or --icodec\n");
+        return 1;
+    }
+
+    /* the splits patch faces in place, in the order they're emitted */
+    if (o->opt_progressive && (o->opt_pool || o->opt_blob || o->opt_zblob ||
+        o->opt_strips || o->opt_pvr || o->opt_draw || o->opt_icodec))
+    {
+        eprintf(o, "--progressive doesn't work with --pool, --blob, "
+            "--zblob, --strips, --pvr, --draw or --icodec\n");
+        return 1;
+    }
+
+    if (o->opt_impostor_views && (o->opt_pool || o->opt_blob ||
+        o->opt_zblob))
+    {
+        eprintf(o, "--impostor doesn't work with --pool, --blob or "
+            "--zblob\n");
+        return 1;
+    }
+
+    /* levels of detail change the faces the edges point at */
+    if (o->opt_edges && (o->opt_pool || o->opt_blob || o->opt_zblob ||
+        o->opt_incbin || o->opt_progressive))
+    {
+        eprintf(o, "--edges doesn't work with --pool, --blob, --zblob, "
+            "--incbin or --progressive\n");
+        return 1;
+    }
+
+    if (o->opt_bvh && (o->opt_pool || o->opt_blob || o->opt_zblob ||
+        o->opt_incbin || o->opt_progressive || o->opt_morph))
+    {
+        eprintf(o, "--bvh doesn't work with --pool, --blob, --zblob, "
+            "--incbin, --progressive or --morph\n");
+        return 1;
+    }
+
+    /* the shadows of the first frame would be wrong for the others */
+    if (o->opt_prt && (o->opt_pool || o->opt_blob || o->opt_zblob ||
+        o->opt_morph))
+    {
+        eprintf(o, "--prt doesn't work with --pool, --blob, --zblob or "
+            "--morph\n");
+        return 1;
+    }
+
+    /* chunks are blobs of the plain arrays */
+    if (o->opt_chunks && (o->opt_pool || o->opt_blob || o->opt_zblob ||
+        o->opt_incbin || o->opt_morph || o->opt_strips || o->opt_pvr ||
+        o->opt_draw || o->opt_icodec || o->opt_uv16 || o->opt_progressive ||
+        o->opt_impostor_views || o->opt_edges || o->opt_bvh ||
+        o->opt_prt || o->opt_collision || o->opt_hull_given ||
+        o->opt_stats))
+    {
+        eprintf(o, "--chunks only works with --morton, --cache, "
+            "--weld and --epsilon\n");
+        return 1;
+    }
+
+    if ((o->opt_collision || o->opt_hull_given) && (o->opt_pool ||
+        o->opt_blob || o->opt_zblob))
+    {
+        eprintf(o, "--collision and --hull don't work with --pool, "
+            "--blob or --zblob\n");
+        return 1;
+    }
+
+    if (o->opt_uv16 && (o->opt_pool || o->opt_blob || o->opt_zblob ||
+        o->opt_incbin))
+    {
+        eprintf(o, "--uv16 doesn't work with --pool, --blob, --zblob "
+            "or --incbin\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+unsigned long obj2h_version(void)
+{
+    return OBJ2H_VERSION;
+}
+
+obj2h_t* obj2h_create(void)
+{
+    obj2h_t* o = calloc(1, sizeof(obj2h_t));
+
+    if (o) o->joints = calloc(GLTF_MAX_JOINTS, sizeof(joint_t));
+
+    if (!o || !o->joints)
+    {
+        free(o);
+        return 0;
+    }
+
+    o->opt_impostor_rings = 1;
+    o->opt_impostor_cell = 64;
+
+    return o;
+}
+
+void obj2h_reset(obj2h_t* o)
+{
+    obj2h_t keep = *o;
+    size_t i;
+
+    for (i = 0; i < o->nmorph_frames; ++i)
+    {
+        free(o->morph_frames[i].vertices);
+        free(o->morph_frames[i].normals);
+    }
+
+    pm_free(o);
+
+    free(o->vertices);
+    free(o->vertex_colors);
+    free(o->normals);
+    free(o->uvs);
+    free(o->faces);
+    free(o->morph_frames);
+    free(o->json);
+    free(o->skin);
+    free(o->anim_channels);
+    free(o->anim_clips);
+    free(o->anim_times);
+    free(o->anim_values);
+    free(o->strip_corners);
+    free(o->pm_collapses);
+    free(o->pm_corners);
+    free(o->pm_split_nfaces);
+    free(o->pm_appear);
+    free(o->impostor_color);
+    free(o->impostor_normal);
+    free(o->impostor_dirs);
+    free(o->bvh_build);
+    free(o->bvh_face_boxes);
+    free(o->bvh_indices);
+    free(o->bvh_nodes);
+    free(o->bvh_keys);
+    free(o->prt);
+    free(o->collision_vertices);
+    free(o->collision_faces);
+    free(o->hull_faces);
+    free(o->hull_next);
+    free(o->hull_planes);
+    free(o->hull_vertices);
+    free(o->adj_edges);
+    free(o->pool_ranges);
+    free(o->pool_vertices);
+    free(o->pool_normals);
+    free(o->pool_uvs);
+    free(o->pool_faces);
+    free(o->pool_colors);
+
+    /*
+     * everything but the options and callbacks, which come first in
+     * obj2h_t, and the joint table and output buffer, which are reused
+     */
+    memset(o, 0, sizeof(obj2h_t));
+    memcpy(&o->callbacks, &keep.callbacks,
+        offsetof(obj2h_t, name) - offsetof(obj2h_t, callbacks));
+    o->joints = keep.joints;
+    o->out.data = keep.out.data;
+    o->out.cap = keep.out.cap;
+}
+
+void obj2h_destroy(obj2h_t* o)
+{
+    if (!o) return;
+
+    obj2h_reset(o);
+    free(o->opt_pool);
+    free(o->joints);
+    free(o->out.data);
+    free(o);
+}
+
+void obj2h_set_callbacks(obj2h_t* o, obj2h_callbacks_t const* callbacks)
+{
+    static obj2h_callbacks_t const none;
+
+    o->callbacks = callbacks ? *callbacks : none;
+}
+
+/* "8 to 512" */
+static
+int power_of_two_in(int n, int lo, int hi)
+{
+    return n >= lo && n <= hi && !(n & (n - 1));
+}
+
+/* the options without a value, non-zero if arg is one */
+static
+int option_flag(obj2h_t* o, char const* arg)
+{
+    if (!strcmp(arg, "--morton")) {
+        o->opt_morton = 1;
+    } else if (!strcmp(arg, "--blob")) {
+        o->opt_blob = 1;
+    } else if (!strcmp(arg, "--zblob")) {
+        o->opt_zblob = 1;
+    } else if (!strcmp(arg, "--bench")) {
+        o->opt_bench = 1;
+    } else if (!strcmp(arg, "--strips")) {
+        o->opt_strips = 1;
+    } else if (!strcmp(arg, "--icodec")) {
+        o->opt_icodec = 1;
+    } else if (!strcmp(arg, "--cache")) {
+        o->opt_cache = 1;
+    } else if (!strcmp(arg, "--impostor-normals")) {
+        o->opt_impostor_normals = 1;
+    } else if (!strcmp(arg, "--progressive")) {
+        o->opt_progressive = 1;
+    } else if (!strcmp(arg, "--weld")) {
+        o->opt_weld = 1;
+    } else if (!strcmp(arg, "--stats")) {
+        o->opt_stats = 1;
+    } else if (!strcmp(arg, "--morph")) {
+        o->opt_morph = 1;
+    } else if (!strcmp(arg, "--incbin")) {
+        o->opt_incbin = 1;
+    } else if (!strcmp(arg, "--pvr")) {
+        o->opt_pvr = 1;
+    } else if (!strcmp(arg, "--draw")) {
+        o->opt_draw = 1;
+    } else if (!strcmp(arg, "--edges")) {
+        o->opt_edges = 1;
+    } else if (!strcmp(arg, "--bvh")) {
+        o->opt_bvh = 1;
+    } else {
+        return 0;
+    }
+
+    return 1;
+}
+
+/* the others, -1 if the value is wrong */
+static
+int option_value(obj2h_t* o, char const* arg, char const* value)
+{
+    if (!strcmp(arg, "--epsilon")) {
+        o->weld_epsilon = (float)atof(value);
+    }
+
+    else if (!strcmp(arg, "--pool"))
+    {
+        char* name = malloc(strlen(value) + 1);
+
+        if (!name) {
+            eperror(o, "malloc");
+            return -1;
+        }
+
+        strcpy(name, value);
+        free(o->opt_pool);
+        o->opt_pool = name;
+    }
+
+    else if (!strcmp(arg, "--impostor"))
+    {
+        int n = sscanf(value, "%dx%d", &o->opt_impostor_views,
+            &o->opt_impostor_rings);
+
+        if (n < 1 || o->opt_impostor_views < 1 || o->opt_impostor_rings < 1)
+        {
+            eprintf(o, "--impostor takes a number of views, and "
+                "optionally of rings as nxm\n");
+            return -1;
+        }
+    }
+
+    else if (!strcmp(arg, "--impostor-size"))
+    {
+        o->opt_impostor_cell = atoi(value);
+
+        if (!power_of_two_in(o->opt_impostor_cell, 8, 512))
+        {
+            eprintf(o, "--impostor-size takes a power of two from 8 to "
+                "512\n");
+            return -1;
+        }
+    }
+
+    else if (!strcmp(arg, "--chunks"))
+    {
+        o->opt_chunks = (float)atof(value);
+
+        if (!(o->opt_chunks > 0))
+        {
+            eprintf(o, "--chunks takes the size of a cell\n");
+            return -1;
+        }
+    }
+
+    else if (!strcmp(arg, "--collision"))
+    {
+        o->opt_collision = atoi(value);
+
+        if (o->opt_collision < 4)
+        {
+            eprintf(o, "--collision takes a face budget of at least 4\n");
+            return -1;
+        }
+    }
+
+    else if (!strcmp(arg, "--hull"))
+    {
+        o->opt_hull = atoi(value);
+
+        if (o->opt_hull != 0 && o->opt_hull < 4)
+        {
+            eprintf(o, "--hull takes at least 4 vertices, or 0 for no "
+                "limit\n");
+            return -1;
+        }
+
+        o->opt_hull_given = 1;
+    }
+
+    else if (!strcmp(arg, "--prt"))
+    {
+        o->opt_prt = atoi(value);
+
+        if (o->opt_prt < 16)
+        {
+            eprintf(o, "--prt takes a number of rays per vertex, at least "
+                "16\n");
+            return -1;
+        }
+    }
+
+    else if (!strcmp(arg, "--uv16"))
+    {
+        o->opt_uv16 = atoi(value);
+
+        if (!power_of_two_in(o->opt_uv16, 8, 1024))
+        {
+            eprintf(o, "--uv16 takes the texture size, a power of two "
+                "from 8 to 1024\n");
+            return -1;
+        }
+    }
+
+    else if (!strcmp(arg, "--threads"))
+    {
+        o->opt_threads = atoi(value);
+        o->nthreads = 0;
+
+        if (o->opt_threads < 0)
+        {
+            eprintf(o, "--threads takes a number of threads, 0 for one "
+                "per core\n");
+            return -1;
+        }
+    }
+
+    else if (!strcmp(arg, "--prelight"))
+    {
+        vec3_t* l = &o->prelight;
+        float len;
+
+        if (sscanf(value, "%f,%f,%f", &l->x, &l->y, &l->z) != 3)
+        {
+            eprintf(o, "--prelight takes a direction as x,y,z\n");
+            return -1;
+        }
+
+        len = sqrtf(l->x * l->x + l->y * l->y + l->z * l->z);
+
+        if (len > 0)
+        {
+            l->x /= len;
+            l->y /= len;
+            l->z /= len;
+        }
+
+        o->opt_prelight = 1;
+    }
+
+    else {
+        return 0;
+    }
+
+    return 1;
+}
+
+int obj2h_option(obj2h_t* o, int argc, char* const* argv)
+{
+    int n;
+
+    if (argc < 1) return 0;
+    if (option_flag(o, argv[0])) return 1;
+    if (argc < 2) return 0;
+
+    n = option_value(o, argv[0], argv[1]);
+
+    return n > 0 ? 2 : n;
+}
+
+int obj2h_options(obj2h_t* o, int argc, char* const* argv)
+{
+    int i, n;
+
+    for (i = 0; i < argc; i += n)
+    {
+        n = obj2h_option(o, argc - i, argv + i);
+
+        if (!n) eprintf(o, "%s: unknown option\n", argv[i]);
+        if (n <= 0) return 1;
+    }
+
+    return 0;
+}
+
+int obj2h_add(obj2h_t* o, char const* name, void const* data, size_t size)
+{
+    char const* ext = strrchr(name, '.');
+
+    if (!o->nmodels && check_options(o)) {
+        return 1;
+    }
+
+    ext = ext ? ext : "";
+
+    if (o->opt_morph && (!strcasecmp(ext, ".glb") ||
+        !strcasecmp(ext, ".ply") || !strcasecmp(ext, ".stl")))
+    {
+        eprintf(o, "--morph only takes .obj frames\n");
+        return 1;
+    }
+
+    /* --pool: every model is processed on its own, then appended */
+    if (o->opt_pool)
+    {
+        char range[64];
+
+        if (load_model(o, name, data, size)) {
+            return 1;
+        }
+
+        /* skins can't be shared, the meshes go in as they are posed */
+        o->nskin = o->njoints = 0;
+        o->nanim_channels = o->nanim_clips = 0;
+        o->nanim_times = o->nanim_values = 0;
+
+        model_name(name, range, sizeof(range));
+
+        if (process_model(o) || pool_add(o, range)) {
+            return 1;
+        }
+    }
+
+    else if (!o->nmodels)
+    {
+        if (load_model(o, name, data, size)) {
+            return 1;
+        }
+
+        model_name(name, o->name, sizeof(o->name));
+    }
+
+    else if (o->opt_morph)
+    {
+        if (morph_load_frame(o, name, data, size)) {
+            return 1;
+        }
+    }
+
+    else
+    {
+        eprintf(o, "%s: only --morph and --pool take more than one "
+            "model\n", name);
+        return 1;
+    }
+
+    ++o->nmodels;
+
+    return 0;
+}
+
+/* the builds that need the whole model, then the output */
+static
+int finish_model(obj2h_t* o)
+{
+    size_t n;
+
+    if (o->opt_pool)
+    {
+        pool_finish(o);
+        snprintf(o->name, sizeof(o->name), "%s", o->opt_pool);
+    }
+
+    else
+    {
+        if (process_model(o)) {
+            return 1;
+        }
+
+        /* before --progressive reorders everything */
+        if (o->opt_collision && build_collision(o)) {
+            return 1;
+        }
+
+        if (o->opt_hull_given && build_hull(o)) {
+            return 1;
+        }
+
+        if (o->opt_progressive && build_progressive(o)) {
+            return 1;
+        }
+
+        if (o->opt_impostor_views && build_impostor(o)) {
+            return 1;
+        }
+    }
+
+    if (o->opt_icodec && icodec_prepare(o)) {
+        return 1;
+    }
+
+    if (o->opt_strips && build_strips(o)) {
+        return 1;
+    }
+
+    if (o->opt_edges && build_edges(o)) {
+        return 1;
+    }
+
+    if ((o->opt_bvh || o->opt_prt) && build_bvh(o)) {
+        return 1;
+    }
+
+    if (o->opt_prt && build_prt(o)) {
+        return 1;
+    }
+
+    /* walk_000.obj, walk_001.obj, ... -> walk */
+    if (o->opt_morph)
+    {
+        n = strlen(o->name);
+        while (n > 1 && isdigit((unsigned char)o->name[n - 1])) --n;
+        while (n > 1 && o->name[n - 1] == '_') --n;
+        o->name[n] = 0;
+    }
+
+    eprintf(o, "%zd vertices\n%zd normals\n%zd uvs\n%zd faces\n",
+        o->nvertices, o->nnormals, o->nuvs, o->nfaces);
+
+    if (o->opt_strips)
+    {
+        eprintf(o, "%zd strips, %.2f triangles per strip\n", o->nstrips,
+            o->nstrips ? (double)o->nfaces / o->nstrips : 0);
+    }
+
+    if (o->nvertex_colors)
+    {
+        eprintf(o, "%zd vertex colors\n", o->nvertex_colors);
+
+        if (o->opt_prelight) {
+            eprintf(o, "--prelight: the model has its own colors, "
+                "using them instead\n");
+        }
+    }
+
+    if (o->opt_stats) {
+        return print_stats(o, o->name);
+    }
+
+    if (o->opt_chunks) {
+        return print_chunks(o, o->name);
+    }
+
+    if (o->opt_uv16) {
+        uv16_check(o);
+    }
+
+    if (o->opt_blob) {
+        return write_blob(o);
+    }
+
+    if (o->opt_zblob) {
+        return write_zblob(o);
+    }
+
+    if (print_header(o, o->name)) {
+        return 1;
+    }
+
+    if (o->opt_pool) {
+        print_pool(o, o->name);
+    }
+
+    return 0;
+}
+
+int obj2h_finish(obj2h_t* o)
+{
+    int err;
+
+    if (!o->nmodels)
+    {
+        eprintf(o, "no model to convert\n");
+        return 1;
+    }
+
+    err = finish_model(o);
+    err |= flush_output(o);
+
+    return err || o->failed;
+}
+
+int obj2h_convert(obj2h_t* o, char const* name, void const* data,
+    size_t size)
+{
+    return obj2h_add(o, name, data, size) || obj2h_finish(o);
+}
+
+void const* obj2h_output(obj2h_t const* o, size_t* size)
+{
+    *size = o->out.size;
+    return o->out.data;
+}
+
+/* command line ------------------------------------------------------- */
+
+#ifndef OBJ2H_NO_MAIN
+
+/* maps a whole file read-only, the mapping outlives the descriptor */
+static
+void* map_file(char const* path, size_t* size)
+{
+    struct stat st;
+    void* data;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        perror(path);
+        return 0;
+    }
+
+    if (fstat(fd, &st))
+    {
+        perror(path);
+        close(fd);
+        return 0;
+    }
+
+    /* nothing to map in empty files, the importers get 0 bytes */
+    *size = (size_t)st.st_size;
+    data = *size ? mmap(0, *size, PROT_READ, MAP_PRIVATE, fd, 0) : "";
+    close(fd);
+
+    if (data == MAP_FAILED)
+    {
+        fprintf(stderr, "%s: can't map the file\n", path);
+        return 0;
+    }
+
+    madvise(data, *size, MADV_SEQUENTIAL);
+
+    return data;
+}
+
+static
+void usage(char const* argv0)
+{
+    fprintf(stderr, VERSION_STR "\n");
+    fprintf(stderr, "converts a .obj, .glb, .ply or .stl model into c "
+        "arrays\n\n");
+    fprintf(stderr, "usage: %s [options] model.obj > model.h\n", argv0);
+    fprintf(stderr, "       %s --morph [options] frame.obj... > model.h\n",
+        argv0);
+    fprintf(stderr, "       %s --pool name [options] model.obj... > "
+        "name.h\n\n", argv0);
+    fprintf(stderr, "options:\n");
+    fprintf(stderr, "  --morton  sort vertices and triangles along a "
+        "z-order curve\n");
+    fprintf(stderr, "  --blob    write a relocatable binary blob instead "
+        "of a header,\n            see obj2h_blob.h\n");
+    fprintf(stderr, "  --zblob   write a compressed blob instead of a "
+        "header,\n            see obj2h_zblob.h\n");
+    fprintf(stderr, "  --bench   with --zblob, report compression ratio "
+        "and decode\n            speed to stderr\n");
+    fprintf(stderr, "  --cache   reorder faces for a fifo vertex cache "
+        "(tipsify)\n");
+    fprintf(stderr, "  --strips  also emit triangle strips as "
+        "name_strips\n");
+    fprintf(stderr, "  --pvr     also emit a pre-baked pvr vertex stream "
+        "as name_pvr,\n            see obj2h_pvr.h\n");
+    fprintf(stderr, "  --prelight x,y,z\n            bake a directional "
+        "light into --pvr vertex colors\n");
+    fprintf(stderr, "  --draw    also emit name_draw, the strips submitted "
+        "by unrolled\n            code\n");
+    fprintf(stderr, "  --bvh     also emit a bvh over the faces for "
+        "picking and\n            collision, see obj2h_bvh.h\n");
+    fprintf(stderr, "  --collision n\n            also emit a copy of the "
+        "mesh simplified to n faces\n            for collision, see "
+        "obj2h_collision.h\n");
+    fprintf(stderr, "  --hull n  also emit the convex hull as planes, with "
+        "at most n\n            vertices (0 for all it takes)\n");
+    fprintf(stderr, "  --edges   also emit edge adjacency and face planes "
+        "for shadow\n            volumes, see obj2h_shadow.h\n");
+    fprintf(stderr, "  --prt n   also emit per-vertex light transfer with "
+        "self-shadowing,\n            baked with n rays per vertex, see "
+        "obj2h_prt.h\n");
+    fprintf(stderr, "  --uv16 n  also emit uvs packed in the pvr's 16-bit "
+        "format, and use\n            them in --pvr streams. n is the "
+        "texture size the\n            precision is checked against\n");
+    fprintf(stderr, "  --icodec  emit faces and strips compressed with the "
+        "index codec,\n            see obj2h_icodec.h\n");
+    fprintf(stderr, "  --morph   treat every model given as a frame of a "
+        "vertex\n            animation, see obj2h_morph.h\n");
+    fprintf(stderr, "  --stats   print a json report of memory use, vertex "
+        "cache\n            efficiency, strips, bounds and pvr "
+        "bandwidth instead\n            of the header\n");
+    fprintf(stderr, "  --weld    weld vertices, normals and uvs and remove "
+        "degenerate\n            and duplicate faces\n");
+    fprintf(stderr, "  --epsilon e\n            weld positions closer "
+        "than e (default 0, exact\n            matches only)\n");
+    fprintf(stderr, "  --pool name\n            pack every model given into "
+        "one shared pool with a\n            draw range table, see "
+        "obj2h_pool.h\n");
+    fprintf(stderr, "  --impostor n[xm]\n            bake an impostor "
+        "atlas from n directions on m\n            rings, see "
+        "obj2h_impostor.h\n");
+    fprintf(stderr, "  --impostor-size n\n            texels per impostor "
+        "view (default 64)\n");
+    fprintf(stderr, "  --impostor-normals\n            also bake an "
+        "impostor normal atlas\n");
+    fprintf(stderr, "  --progressive\n            emit a progressive mesh "
+        "that can be cut at any\n            triangle budget, see "
+        "obj2h_pm.h\n");
+    fprintf(stderr, "  --chunks size\n            cut the model into a "
+        "grid of chunks streamed from\n            name.chunks, see "
+        "obj2h_chunks.h\n");
+    fprintf(stderr, "  --incbin  write name.bin and name.S to the current "
+        "directory and\n            only declare the arrays in the "
+        "header\n");
+    fprintf(stderr, "  --threads n\n            threads for the heavy "
+        "passes (default 0, one per\n            core). the output is "
+        "the same on any number\n");
+}
+
+static
+int write_stdout(void* user, void const* data, size_t size)
+{
+    (void)user;
+
+    if (fwrite(data, 1, size, stdout) != size)
+    {
+        perror("fwrite");
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    obj2h_callbacks_t callbacks = { 0 };
+    obj2h_t* o;
+    char** paths;
+    int npaths = 0, i, n = 1, err = 0;
+
+    o = obj2h_create();
+    paths = malloc(sizeof(char*) * argc);
+    err = !o || !paths;
+
+    if (err) {
+        perror("malloc");
+    }
+
+    else
+    {
+        callbacks.write = write_stdout;
+        obj2h_set_callbacks(o, &callbacks);
+    }
+
+    for (i = 1; i < argc && !err; i += n)
+    {
+        if (argv[i][0] != '-')
+        {
+            paths[npaths++] = argv[i];
+            n = 1;
+            continue;
+        }
+
+        n = obj2h_option(o, argc - i, argv + i);
+        if (!n) usage(argv[0]);
+        err = n <= 0;
+    }
+
+    if (!err && (!npaths || (npaths > 1 && !o->opt_morph && !o->opt_pool)))
+    {
+        usage(argv[0]);
+        err = 1;
+    }
+
+    for (i = 0; i < npaths && !err; ++i)
+    {
+        size_t size;
+        void* data = map_file(paths[i], &size);
+
+        if (!data) {
+            err = 1;
+            break;
+        }
+
+        err = obj2h_add(o, paths[i], data, size);
+        if (size) munmap(data, size);
+    }
+
+    err = err || obj2h_finish(o);
+
+    obj2h_destroy(o);
+    free(paths);
+
+    return err;
 }
+#endif /* !OBJ2H_NO_MAIN */
@@ -0,0 +1,164 @@
+/*
+ * obj2h as a library, for converting models in-process instead of
+ * running the tool once per file
+ *
+ * ```sh
+ * gcc -c -O2 -DOBJ2H_NO_MAIN obj2h.c -o obj2h.o
+ * ```
+ *
+ * and link with -pthread
+ *
+ * every conversion lives in its own obj2h_t, so any number of them can
+ * run at once on different threads. a context takes the same options as
+ * the command line, then the models (from memory, the name is only used
+ * for the extension, messages and the array name) and writes what the
+ * tool would have written to stdout through the write callback, or
+ * keeps it for obj2h_output
+ *
+ * ```c
+ * #include "obj2h.h"
+ *
+ * char* args[] = { "--cache", "--strips", "--pvr" };
+ * obj2h_t* o = obj2h_create();
+ *
+ * if (obj2h_options(o, 3, args) ||
+ *     obj2h_convert(o, "monkey.obj", data, size))
+ * {
+ *     fail;
+ * }
+ *
+ * header = obj2h_output(o, &header_size);
+ *
+ * obj2h_reset(o); next model with the same options and callbacks
+ *
+ * obj2h_destroy(o);
+ * ```
+ *
+ * --pool and --morph take several models: call obj2h_add for each one
+ * in order, then obj2h_finish. obj2h_convert is the two in one go
+ *
+ * callbacks are optional. messages (what the tool prints to stderr) go
+ * to stderr without one and the files --incbin and --chunks write next
+ * to the output go to the current directory. allocation failures are
+ * messages too, except growing a plain array or buffer, which has no
+ * context to report to and still uses perror. the passes running on
+ * several threads can send messages from any of them, one at a time
+ *
+ * a context runs its heavy passes on one thread per core unless told
+ * otherwise with --threads. with a context per core already, pass
+ * --threads 1
+ *
+ * obj2h_version() is the library's OBJ2H_VERSION, which a program can
+ * check against the one it was compiled with
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#ifndef OBJ2H_H
+#define OBJ2H_H
+
+#include <stddef.h>
+
+/*
+ * the version these declarations come from. generated headers carry the
+ * same numbers in their first line
+ */
+#define OBJ2H_VERSION_MAJOR 2
+#define OBJ2H_VERSION_MINOR 0
+#define OBJ2H_VERSION_PATCH 0
+
+#define OBJ2H_VERSION \
+    (OBJ2H_VERSION_MAJOR << 16 | OBJ2H_VERSION_MINOR << 8 | \
+     OBJ2H_VERSION_PATCH)
+
+/* OBJ2H_VERSION of the library linked in, to check it against this file */
+unsigned long obj2h_version(void);
+
+/*
+ * records as obj2h keeps them. positions already have y flipped like on
+ * export, normals keep the y the file had
+ */
+struct obj2h_vec3 { float x, y, z; };
+typedef struct obj2h_vec3 obj2h_vec3_t;
+
+struct obj2h_uv { float u, v; };
+typedef struct obj2h_uv obj2h_uv_t;
+
+/* 0-based, -1 when missing */
+struct obj2h_face
+{
+    int vertex_indices[3], uv_indices[3], normal_indices[3];
+};
+
+typedef struct obj2h_face obj2h_face_t;
+
+/*
+ * the record callbacks see every record of a model once it's read, in
+ * file order and before any option touches it. they can change it in
+ * place, and returning non-zero stops the conversion. argb is 0 unless
+ * the model has vertex colors
+ */
+struct obj2h_callbacks
+{
+    void* user;
+
+    int (*vertex)(void* user, obj2h_vec3_t* position, unsigned long* argb);
+    int (*normal)(void* user, obj2h_vec3_t* normal);
+    int (*uv)(void* user, obj2h_uv_t* uv);
+    int (*face)(void* user, obj2h_face_t* face);
+
+    /* the output as it's produced, non-zero stops the conversion */
+    int (*write)(void* user, void const* data, size_t size);
+
+    /* name.bin, name.S and name.chunks. non-zero fails the conversion */
+    int (*file)(void* user, char const* name, void const* data,
+        size_t size);
+
+    /* one or more lines of diagnostics */
+    void (*message)(void* user, char const* text);
+};
+
+typedef struct obj2h_callbacks obj2h_callbacks_t;
+
+typedef struct obj2h obj2h_t;
+
+/* 0 if out of memory */
+obj2h_t* obj2h_create(void);
+void obj2h_destroy(obj2h_t* o);
+
+/* drops the models and the output, keeps the options and callbacks */
+void obj2h_reset(obj2h_t* o);
+
+void obj2h_set_callbacks(obj2h_t* o, obj2h_callbacks_t const* callbacks);
+
+/*
+ * parses the option at argv[0], with its value at argv[1] if it takes
+ * one. returns how many arguments it used, 0 if argv[0] isn't an option
+ * and -1 if its value is wrong
+ */
+int obj2h_option(obj2h_t* o, int argc, char* const* argv);
+
+/* every argument must be an option. non-zero on the first that isn't */
+int obj2h_options(obj2h_t* o, int argc, char* const* argv);
+
+/*
+ * reads a .obj, .glb, .ply or .stl model from memory. data is only used
+ * during the call. the first model names the arrays
+ */
+int obj2h_add(obj2h_t* o, char const* name, void const* data, size_t size);
+
+/* processes the models added and writes the output */
+int obj2h_finish(obj2h_t* o);
+
+/* obj2h_add then obj2h_finish */
+int obj2h_convert(obj2h_t* o, char const* name, void const* data,
+    size_t size);
+
+/* what was written and not handed to a write callback */
+void const* obj2h_output(obj2h_t const* o, size_t* size);
+
+#endif /* !OBJ2H_H */
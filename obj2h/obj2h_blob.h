@@ -0,0 +1,223 @@
+/*
+ * relocatable binary mesh blobs as emitted by obj2h --blob
+ *
+ * layout (little endian, every offset is relative to the blob start):
+ *
+ * ```
+ * header    32 bytes, see obj2h_blob_header_t
+ * sections  nsections * 16 bytes, see obj2h_blob_section_t
+ * arrays    each one starts on a 32-byte boundary
+ * ```
+ *
+ * the boundaries are counted from the blob start, so the arrays are as
+ * aligned as the blob is, up to 32 bytes. blobs only have to be 16-byte
+ * aligned to load, which is all the romdisk guarantees and enough for
+ * mat_transform
+ *
+ * arrays are stored exactly as the generated headers would lay them out
+ * in memory (vector_t, uv_t, face_t) so loading is just validating the
+ * header and pointing into the blob, no parsing and no copies
+ *
+ * ```c
+ * #include "obj2h_blob.h"
+ *
+ * obj2h_mesh_t monkey;
+ *
+ * if (obj2h_blob_map("/rd/monkey.bin", &monkey)) {
+ *     ... error ...
+ * }
+ *
+ * mat_transform(monkey.vertices, tbuf, monkey.nvertices,
+ *     sizeof(vector_t));
+ * ```
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#ifndef OBJ2H_BLOB_H
+#define OBJ2H_BLOB_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define OBJ2H_BLOB_MAGIC "O2HB"
+#define OBJ2H_BLOB_VERSION_MAJOR 1
+#define OBJ2H_BLOB_VERSION_MINOR 1
+#define OBJ2H_BLOB_ALIGN 32
+#define OBJ2H_BLOB_MIN_ALIGN 16 /* of the blob itself, see above */
+
+enum obj2h_blob_section_type
+{
+    OBJ2H_BLOB_VERTICES = 1, /* vector_t, w = 1 */
+    OBJ2H_BLOB_NORMALS,      /* vector_t, w = 0 */
+    OBJ2H_BLOB_UVS,          /* uv_t */
+    OBJ2H_BLOB_FACES,        /* face_t */
+    OBJ2H_BLOB_COLORS,       /* uint32_t ARGB8888 per vertex, since 1.1 */
+};
+
+struct obj2h_blob_header
+{
+    char magic[4];
+    uint16_t version_major; /* loaders reject any other major version */
+    uint16_t version_minor; /* bumped for backwards compatible additions */
+    uint32_t size;          /* total blob size in bytes */
+    uint32_t nsections;
+    uint32_t flags;         /* reserved, 0 */
+    uint32_t reserved[3];
+};
+
+typedef struct obj2h_blob_header obj2h_blob_header_t;
+
+struct obj2h_blob_section
+{
+    uint32_t type;   /* enum obj2h_blob_section_type */
+    uint32_t offset; /* from the start of the blob, 32-byte aligned */
+    uint32_t count;  /* number of elements */
+    uint32_t stride; /* size of one element in bytes */
+};
+
+typedef struct obj2h_blob_section obj2h_blob_section_t;
+
+#ifndef OBJ2H_TYPES
+#define OBJ2H_TYPES
+struct face { int vertex_indices[3], uv_indices[3], normal_indices[3]; };
+typedef struct face face_t;
+struct uv { float u, v; };
+typedef struct uv uv_t;
+#endif /* !OBJ2H_TYPES */
+
+struct obj2h_mesh
+{
+    vector_t* vertices;
+    vector_t* normals;
+    uv_t* uvs;
+    face_t* faces;
+    uint32_t* colors; /* 0 if the model had no vertex colors */
+    size_t nvertices, nnormals, nuvs, nfaces, ncolors;
+};
+
+typedef struct obj2h_mesh obj2h_mesh_t;
+
+/*
+ * points m's arrays into the blob at data. the blob must stay alive for
+ * as long as the mesh is used. unknown section types are skipped so
+ * newer minor versions still load
+ *
+ * returns non-zero if the blob is truncated, not 16-byte aligned, has
+ * misaligned arrays or is of an unsupported version
+ */
+static inline
+int obj2h_blob_load(void* data, size_t size, obj2h_mesh_t* m)
+{
+    obj2h_blob_header_t const* h = data;
+    obj2h_blob_section_t const* s;
+    char* base = data;
+    uint32_t i;
+
+    memset(m, 0, sizeof(*m));
+
+    if ((uintptr_t)data % OBJ2H_BLOB_MIN_ALIGN || size < sizeof(*h)) {
+        return 1;
+    }
+
+    if (memcmp(h->magic, OBJ2H_BLOB_MAGIC, 4)) return 1;
+    if (h->version_major != OBJ2H_BLOB_VERSION_MAJOR) return 1;
+    if (h->size > size) return 1;
+    if (h->nsections > (h->size - sizeof(*h)) / sizeof(*s)) return 1;
+
+    s = (obj2h_blob_section_t const*)(h + 1);
+
+    for (i = 0; i < h->nsections; ++i, ++s)
+    {
+        void* p = base + s->offset;
+
+        if (s->offset % OBJ2H_BLOB_ALIGN || s->offset > h->size) return 1;
+        if (s->stride && s->count > (h->size - s->offset) / s->stride) {
+            return 1;
+        }
+
+        switch (s->type)
+        {
+        case OBJ2H_BLOB_VERTICES:
+            if (s->stride != sizeof(vector_t)) return 1;
+            m->vertices = p;
+            m->nvertices = s->count;
+            break;
+
+        case OBJ2H_BLOB_NORMALS:
+            if (s->stride != sizeof(vector_t)) return 1;
+            m->normals = p;
+            m->nnormals = s->count;
+            break;
+
+        case OBJ2H_BLOB_UVS:
+            if (s->stride != sizeof(uv_t)) return 1;
+            m->uvs = p;
+            m->nuvs = s->count;
+            break;
+
+        case OBJ2H_BLOB_FACES:
+            if (s->stride != sizeof(face_t)) return 1;
+            m->faces = p;
+            m->nfaces = s->count;
+            break;
+
+        case OBJ2H_BLOB_COLORS:
+            if (s->stride != sizeof(uint32_t)) return 1;
+            m->colors = p;
+            m->ncolors = s->count;
+            break;
+        }
+    }
+
+    return 0;
+}
+
+#ifdef _arch_dreamcast
+#include <kos.h>
+#include <malloc.h>
+
+/*
+ * maps a blob from the filesystem. on the romdisk this is zero-copy as
+ * fs_mmap returns a pointer straight into the romdisk image, other
+ * filesystems fall back to a single read into a 32-byte aligned buffer
+ * which is never freed
+ */
+static inline
+int obj2h_blob_map(char const* path, obj2h_mesh_t* m)
+{
+    file_t f;
+    void* data;
+    size_t size;
+
+    f = fs_open(path, O_RDONLY);
+    if (f == FILEHND_INVALID) return 1;
+
+    size = fs_total(f);
+    data = fs_mmap(f);
+
+    if (!data)
+    {
+        data = memalign(OBJ2H_BLOB_ALIGN, size);
+
+        if (!data || fs_read(f, data, size) != (ssize_t)size)
+        {
+            free(data);
+            fs_close(f);
+            return 1;
+        }
+    }
+
+    /* romdisk mappings stay valid after closing */
+    fs_close(f);
+
+    return obj2h_blob_load(data, size, m);
+}
+#endif /* _arch_dreamcast */
+
+#endif /* !OBJ2H_BLOB_H */
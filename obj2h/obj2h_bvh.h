@@ -0,0 +1,371 @@
+/*
+ * bounding volume hierarchies as emitted by obj2h --bvh
+ *
+ * the faces of the model are split into a binary tree by the surface
+ * area heuristic. every node is 32 bytes (one cache line) and holds the
+ * boxes of both its children, quantized to 16 bits within the bounds
+ * of the whole model, so a query tests both children at once and only
+ * walks into the ones it hits, closest first. a child is either
+ * another node or a leaf, a run of up to 15 face indices in
+ * model_bvh_indices
+ *
+ * ```c
+ * #include "model.h"
+ * #include "obj2h_bvh.h"
+ *
+ * picking, with the ray in model space:
+ *   face = obj2h_bvh_raycast(&model_bvh, model_vertices, model_faces,
+ *       &origin, &dir, 100, &t);
+ *
+ *   if (face >= 0) {
+ *       hit is origin + dir * t
+ *   }
+ *
+ * camera collision:
+ *   obj2h_bvh_push_sphere(&model_bvh, model_vertices, model_faces,
+ *       &camera_pos, 0.2f);
+ * ```
+ *
+ * faces are hit from either side. the hierarchy is built for the mesh
+ * as exported, it doesn't follow morphs or skins
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#ifndef OBJ2H_BVH_H
+#define OBJ2H_BVH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+
+#ifndef OBJ2H_BVH_TYPES
+#define OBJ2H_BVH_TYPES
+#define OBJ2H_BVH_LEAF 0x80000000u
+struct obj2h_bvh_node
+{
+    uint16_t bounds[2][6]; /* min x, y, z, max x, y, z of each child */
+    uint32_t child[2]; /* node, or OBJ2H_BVH_LEAF | first << 4 | count */
+};
+typedef struct obj2h_bvh_node obj2h_bvh_node_t;
+struct obj2h_bvh
+{
+    float min[3], scale[3]; /* position = min + quantized * scale */
+    uint32_t nnodes;
+    obj2h_bvh_node_t const* nodes; /* the root is nodes[0] */
+    uint32_t const* indices; /* faces, in leaf order */
+};
+typedef struct obj2h_bvh obj2h_bvh_t;
+#endif /* !OBJ2H_BVH_TYPES */
+
+/* deep enough for any tree obj2h builds over 2^27 faces */
+#define OBJ2H_BVH_STACK 64
+
+/*
+ * where the ray o + d * t enters the quantized box b, or -1 if it
+ * misses it or only hits it past tmax. inv_d is 1 / d, with 0 where d
+ * is 0
+ */
+static inline
+float obj2h_bvh_slab(obj2h_bvh_t const* bvh, uint16_t const* b,
+    vector_t const* o, vector_t const* inv_d, float tmax)
+{
+    float const* po = &o->x;
+    float const* pinv = &inv_d->x;
+    float tmin = 0;
+    int i;
+
+    for (i = 0; i < 3; ++i)
+    {
+        float lo = bvh->min[i] + b[i] * bvh->scale[i];
+        float hi = bvh->min[i] + b[i + 3] * bvh->scale[i];
+        float t0, t1;
+
+        /*
+         * parallel to the slab, the ray is either in it all along or
+         * never. going through infinities would make 0 * inf = nan for
+         * an origin on one of its planes
+         */
+        if (pinv[i] == 0)
+        {
+            if (po[i] < lo || po[i] > hi) return -1;
+            continue;
+        }
+
+        t0 = (lo - po[i]) * pinv[i];
+        t1 = (hi - po[i]) * pinv[i];
+
+        if (t0 > t1)
+        {
+            float tmp = t0;
+            t0 = t1;
+            t1 = tmp;
+        }
+
+        tmin = t0 > tmin ? t0 : tmin;
+        tmax = t1 < tmax ? t1 : tmax;
+        if (tmin > tmax) return -1;
+    }
+
+    return tmin;
+}
+
+/* moller-trumbore, both sides. distance along d or -1 */
+static inline
+float obj2h_bvh_triangle(vector_t const* o, vector_t const* d,
+    vector_t const* a, vector_t const* b, vector_t const* c)
+{
+    float e1x = b->x - a->x, e1y = b->y - a->y, e1z = b->z - a->z;
+    float e2x = c->x - a->x, e2y = c->y - a->y, e2z = c->z - a->z;
+    float px = d->y * e2z - d->z * e2y;
+    float py = d->z * e2x - d->x * e2z;
+    float pz = d->x * e2y - d->y * e2x;
+    float det = e1x * px + e1y * py + e1z * pz;
+    float inv, tx, ty, tz, qx, qy, qz, u, v;
+
+    if (det > -1e-12f && det < 1e-12f) return -1;
+    inv = 1 / det;
+
+    tx = o->x - a->x;
+    ty = o->y - a->y;
+    tz = o->z - a->z;
+    u = (tx * px + ty * py + tz * pz) * inv;
+    if (u < 0 || u > 1) return -1;
+
+    qx = ty * e1z - tz * e1y;
+    qy = tz * e1x - tx * e1z;
+    qz = tx * e1y - ty * e1x;
+    v = (d->x * qx + d->y * qy + d->z * qz) * inv;
+    if (v < 0 || u + v > 1) return -1;
+
+    return (e2x * qx + e2y * qy + e2z * qz) * inv;
+}
+
+/*
+ * closest face hit by the ray o + d * t with 0 <= t <= tmax, or -1.
+ * *t is set to the distance along d when something is hit. d doesn't
+ * need to be normalized, t is in units of its length
+ */
+static inline
+int obj2h_bvh_raycast(obj2h_bvh_t const* bvh, vector_t const* vertices,
+    face_t const* faces, vector_t const* o, vector_t const* d, float tmax,
+    float* t)
+{
+    uint32_t stack[OBJ2H_BVH_STACK];
+    vector_t inv_d;
+    int sp = 0, best = -1;
+
+    if (!bvh->nnodes) return -1;
+
+    /* 0 marks an axis the ray doesn't move along, see obj2h_bvh_slab */
+    inv_d.x = d->x != 0 ? 1 / d->x : 0;
+    inv_d.y = d->y != 0 ? 1 / d->y : 0;
+    inv_d.z = d->z != 0 ? 1 / d->z : 0;
+    inv_d.w = 0;
+
+    stack[sp++] = 0;
+
+    while (sp)
+    {
+        uint32_t child = stack[--sp];
+        obj2h_bvh_node_t const* n;
+        float t0, t1;
+
+        if (child & OBJ2H_BVH_LEAF)
+        {
+            uint32_t const* i = bvh->indices + ((child & ~OBJ2H_BVH_LEAF) >> 4);
+            uint32_t const* end = i + (child & 15);
+
+            for (; i < end; ++i)
+            {
+                int const* vi = faces[*i].vertex_indices;
+                float hit = obj2h_bvh_triangle(o, d, &vertices[vi[0]],
+                    &vertices[vi[1]], &vertices[vi[2]]);
+
+                if (hit >= 0 && hit <= tmax)
+                {
+                    tmax = hit;
+                    best = (int)*i;
+                }
+            }
+
+            continue;
+        }
+
+        n = &bvh->nodes[child];
+        t0 = obj2h_bvh_slab(bvh, n->bounds[0], o, &inv_d, tmax);
+        t1 = obj2h_bvh_slab(bvh, n->bounds[1], o, &inv_d, tmax);
+
+        /* the closer child goes on top so it's walked first */
+        if (t0 >= 0 && t1 >= 0 && t0 < t1)
+        {
+            stack[sp++] = n->child[1];
+            stack[sp++] = n->child[0];
+        }
+
+        else
+        {
+            if (t0 >= 0) stack[sp++] = n->child[0];
+            if (t1 >= 0) stack[sp++] = n->child[1];
+        }
+    }
+
+    if (best >= 0) *t = tmax;
+
+    return best;
+}
+
+/* closest point to p on the triangle a, b, c (ericson's) */
+static inline
+vector_t obj2h_bvh_closest(vector_t const* p, vector_t const* a,
+    vector_t const* b, vector_t const* c)
+{
+    float abx = b->x - a->x, aby = b->y - a->y, abz = b->z - a->z;
+    float acx = c->x - a->x, acy = c->y - a->y, acz = c->z - a->z;
+    float apx = p->x - a->x, apy = p->y - a->y, apz = p->z - a->z;
+    float bpx = p->x - b->x, bpy = p->y - b->y, bpz = p->z - b->z;
+    float cpx = p->x - c->x, cpy = p->y - c->y, cpz = p->z - c->z;
+    float d1 = abx * apx + aby * apy + abz * apz;
+    float d2 = acx * apx + acy * apy + acz * apz;
+    float d3 = abx * bpx + aby * bpy + abz * bpz;
+    float d4 = acx * bpx + acy * bpy + acz * bpz;
+    float d5 = abx * cpx + aby * cpy + abz * cpz;
+    float d6 = acx * cpx + acy * cpy + acz * cpz;
+    float va, vb, vc, v, w, denom;
+    vector_t r = *a;
+
+    if (d1 <= 0 && d2 <= 0) return r;
+
+    if (d3 >= 0 && d4 <= d3) return *b;
+    if (d6 >= 0 && d5 <= d6) return *c;
+
+    vc = d1 * d4 - d3 * d2;
+    vb = d5 * d2 - d1 * d6;
+    va = d3 * d6 - d5 * d4;
+
+    if (vc <= 0 && d1 >= 0 && d3 <= 0)
+    {
+        v = d1 / (d1 - d3);
+        r.x += abx * v;
+        r.y += aby * v;
+        r.z += abz * v;
+        return r;
+    }
+
+    if (vb <= 0 && d2 >= 0 && d6 <= 0)
+    {
+        w = d2 / (d2 - d6);
+        r.x += acx * w;
+        r.y += acy * w;
+        r.z += acz * w;
+        return r;
+    }
+
+    if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0)
+    {
+        w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        r = *b;
+        r.x += (c->x - b->x) * w;
+        r.y += (c->y - b->y) * w;
+        r.z += (c->z - b->z) * w;
+        return r;
+    }
+
+    denom = 1 / (va + vb + vc);
+    v = vb * denom;
+    w = vc * denom;
+    r.x += abx * v + acx * w;
+    r.y += aby * v + acy * w;
+    r.z += abz * v + acz * w;
+
+    return r;
+}
+
+/* whether the sphere c, r touches the quantized box b */
+static inline
+int obj2h_bvh_sphere_box(obj2h_bvh_t const* bvh, uint16_t const* b,
+    vector_t const* c, float r)
+{
+    float const* pc = &c->x;
+    float d = 0;
+    int i;
+
+    for (i = 0; i < 3; ++i)
+    {
+        float lo = bvh->min[i] + b[i] * bvh->scale[i];
+        float hi = bvh->min[i] + b[i + 3] * bvh->scale[i];
+
+        if (pc[i] < lo) d += (lo - pc[i]) * (lo - pc[i]);
+        else if (pc[i] > hi) d += (pc[i] - hi) * (pc[i] - hi);
+    }
+
+    return d <= r * r;
+}
+
+/*
+ * moves the sphere center, radius out of every face it overlaps, one
+ * face at a time, and returns how many faces pushed it. good enough to
+ * keep a camera out of walls
+ */
+static inline
+int obj2h_bvh_push_sphere(obj2h_bvh_t const* bvh, vector_t const* vertices,
+    face_t const* faces, vector_t* center, float radius)
+{
+    uint32_t stack[OBJ2H_BVH_STACK];
+    int sp = 0, pushed = 0, i;
+
+    if (!bvh->nnodes) return 0;
+
+    stack[sp++] = 0;
+
+    while (sp)
+    {
+        uint32_t child = stack[--sp];
+        obj2h_bvh_node_t const* n;
+
+        if (child & OBJ2H_BVH_LEAF)
+        {
+            uint32_t const* f = bvh->indices + ((child & ~OBJ2H_BVH_LEAF) >> 4);
+            uint32_t const* end = f + (child & 15);
+
+            for (; f < end; ++f)
+            {
+                int const* vi = faces[*f].vertex_indices;
+                vector_t p = obj2h_bvh_closest(center, &vertices[vi[0]],
+                    &vertices[vi[1]], &vertices[vi[2]]);
+                float dx = center->x - p.x;
+                float dy = center->y - p.y;
+                float dz = center->z - p.z;
+                float dist = sqrtf(dx * dx + dy * dy + dz * dz);
+
+                /* dead on the surface there's no direction to go */
+                if (dist >= radius || dist <= 0) continue;
+
+                dist = (radius - dist) / dist;
+                center->x += dx * dist;
+                center->y += dy * dist;
+                center->z += dz * dist;
+                ++pushed;
+            }
+
+            continue;
+        }
+
+        n = &bvh->nodes[child];
+
+        for (i = 0; i < 2; ++i)
+        {
+            if (obj2h_bvh_sphere_box(bvh, n->bounds[i], center, radius)) {
+                stack[sp++] = n->child[i];
+            }
+        }
+    }
+
+    return pushed;
+}
+
+#endif /* !OBJ2H_BVH_H */
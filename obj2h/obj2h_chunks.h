@@ -0,0 +1,192 @@
+/*
+ * streamed world chunks as emitted by obj2h --chunks
+ *
+ * a level too big to sit in memory is cut into a regular grid of cells
+ * and every cell with faces in it becomes a chunk: a regular obj2h blob
+ * (see obj2h_blob.h) with its own vertices, normals, uvs and faces,
+ * indexed from 0. the blobs are packed one after another in
+ * model.chunks and the generated header only has the table telling
+ * where each one is and what it covers, so the runtime keeps the
+ * chunks around the camera resident and reads the others when they
+ * come in range
+ *
+ * ```c
+ * #include "level.h"
+ * #include "obj2h_chunks.h"
+ *
+ * static obj2h_chunk_slot_t slots[ARRAY_LENGTH(level_chunk_table)];
+ *
+ * init:
+ *   f = fs_open("/cd/level.chunks", O_RDONLY);
+ *
+ * every frame, with the camera in level space:
+ *   obj2h_chunks_update(&level_chunks, f, slots, &camera, 60, 80, 1);
+ *
+ *   for (i = 0; i < level_chunks.nchunks; ++i) {
+ *       if (slots[i].data) draw(&slots[i].mesh);
+ *   }
+ * ```
+ *
+ * a face goes to the cell its centroid is in and isn't split, so the
+ * bounds in the table (those of the faces) can poke a little out of
+ * the cell
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#ifndef OBJ2H_CHUNKS_H
+#define OBJ2H_CHUNKS_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "obj2h_blob.h"
+
+#ifndef OBJ2H_CHUNK_TYPES
+#define OBJ2H_CHUNK_TYPES
+struct obj2h_chunk
+{
+    float min[3], max[3]; /* bounds of the faces in it */
+    int32_t cell[3];      /* grid coordinates */
+    uint32_t offset, size; /* of its blob in the .chunks file */
+};
+typedef struct obj2h_chunk obj2h_chunk_t;
+struct obj2h_chunks
+{
+    float origin[3]; /* cell x covers origin + [x, x + 1) * cell_size */
+    float cell_size;
+    uint32_t nchunks;
+    obj2h_chunk_t const* table;
+    char const* file; /* name of the .chunks file */
+};
+typedef struct obj2h_chunks obj2h_chunks_t;
+#endif /* !OBJ2H_CHUNK_TYPES */
+
+/* a resident chunk, data is 0 for the others */
+struct obj2h_chunk_slot
+{
+    void* data;
+    obj2h_mesh_t mesh;
+};
+
+typedef struct obj2h_chunk_slot obj2h_chunk_slot_t;
+
+/* squared distance from p to the bounds of c, 0 inside */
+static inline
+float obj2h_chunk_distance2(obj2h_chunk_t const* c, vector_t const* p)
+{
+    float const* pp = &p->x;
+    float d = 0;
+    int i;
+
+    for (i = 0; i < 3; ++i)
+    {
+        float lo = c->min[i] - pp[i], hi = pp[i] - c->max[i];
+
+        if (lo > 0) d += lo * lo;
+        else if (hi > 0) d += hi * hi;
+    }
+
+    return d;
+}
+
+/*
+ * the closest chunk within radius of p that isn't resident yet, or -1.
+ * also how the loads are ordered, nearest first
+ */
+static inline
+int obj2h_chunks_next(obj2h_chunks_t const* w,
+    obj2h_chunk_slot_t const* slots, vector_t const* p, float radius)
+{
+    float best = radius * radius;
+    int next = -1;
+    uint32_t i;
+
+    for (i = 0; i < w->nchunks; ++i)
+    {
+        float d;
+
+        if (slots[i].data) continue;
+
+        d = obj2h_chunk_distance2(&w->table[i], p);
+
+        if (d <= best)
+        {
+            best = d;
+            next = (int)i;
+        }
+    }
+
+    return next;
+}
+
+#ifdef _arch_dreamcast
+#include <kos.h>
+#include <malloc.h>
+
+/* reads chunk i from the open .chunks file f into its slot */
+static inline
+int obj2h_chunk_load(obj2h_chunks_t const* w, file_t f,
+    obj2h_chunk_slot_t* slots, int i)
+{
+    obj2h_chunk_t const* c = &w->table[i];
+    void* data = memalign(OBJ2H_BLOB_ALIGN, c->size);
+
+    if (!data) return 1;
+
+    if (fs_seek(f, c->offset, SEEK_SET) != (off_t)c->offset ||
+        fs_read(f, data, c->size) != (ssize_t)c->size ||
+        obj2h_blob_load(data, c->size, &slots[i].mesh))
+    {
+        free(data);
+        return 1;
+    }
+
+    slots[i].data = data;
+
+    return 0;
+}
+
+/*
+ * frees the chunks further than unload_radius from p and reads up to
+ * max_loads of the ones within load_radius, nearest first, so a frame
+ * never stalls on more than max_loads reads. unload_radius should be a
+ * bit larger than load_radius so chunks on the edge don't go back and
+ * forth. returns non-zero if a read failed
+ */
+static inline
+int obj2h_chunks_update(obj2h_chunks_t const* w, file_t f,
+    obj2h_chunk_slot_t* slots, vector_t const* p, float load_radius,
+    float unload_radius, int max_loads)
+{
+    uint32_t i;
+
+    for (i = 0; i < w->nchunks; ++i)
+    {
+        if (!slots[i].data) continue;
+
+        if (obj2h_chunk_distance2(&w->table[i], p) >
+            unload_radius * unload_radius)
+        {
+            free(slots[i].data);
+            slots[i].data = 0;
+        }
+    }
+
+    while (max_loads-- > 0)
+    {
+        int next = obj2h_chunks_next(w, slots, p, load_radius);
+
+        if (next < 0) break;
+        if (obj2h_chunk_load(w, f, slots, next)) return 1;
+    }
+
+    return 0;
+}
+#endif /* _arch_dreamcast */
+
+#endif /* !OBJ2H_CHUNKS_H */
@@ -0,0 +1,261 @@
+/*
+ * collision shapes as emitted by obj2h --collision and --hull
+ *
+ * gameplay rarely needs every triangle of the render mesh. --collision
+ * emits a decimated copy of it (model_collision_vertices, _faces and
+ * _planes, a plane per face) and --hull its convex hull as a handful of
+ * planes (model_hull). a point is inside the hull when it's behind
+ * every plane, so most queries are one loop of dot products
+ *
+ * ```c
+ * #include "model.h"
+ * #include "obj2h_collision.h"
+ *
+ * cheap test first, everything in model space:
+ *   if (obj2h_hull_distance(&model_hull, &p) < radius) {
+ *       obj2h_collision_push_sphere(model_collision_vertices,
+ *           model_collision_faces, model_collision_planes,
+ *           ARRAY_LENGTH(model_collision_faces), &p, radius);
+ *   }
+ *
+ * or against the hull alone:
+ *   obj2h_hull_push_sphere(&model_hull, &p, radius);
+ * ```
+ *
+ * planes are x, y, z = normal, w = -dot(normal, point on it), and the
+ * normals of both the hull's and the collision mesh's planes point out
+ * of the model, so a positive distance is outside, in front of the
+ * face. the collision mesh tests still take faces from either side,
+ * since meshes that aren't closed have no inside to keep things out of.
+ *
+ * hulls capped to fewer vertices than the exact one have their planes
+ * pushed out until every vertex of the model is behind them, so they
+ * stay conservative. near edges and corners of the hull the largest
+ * plane distance underestimates the real one, so spheres touch a bit
+ * early there
+ *
+ * the triangle tests come from obj2h_bvh.h
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#ifndef OBJ2H_COLLISION_H
+#define OBJ2H_COLLISION_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+
+#include "obj2h_bvh.h"
+
+#ifndef OBJ2H_HULL_TYPES
+#define OBJ2H_HULL_TYPES
+struct obj2h_hull
+{
+    uint32_t nplanes, nvertices;
+    vector_t const* planes;
+    vector_t const* vertices; /* for support mapping and debug drawing */
+};
+typedef struct obj2h_hull obj2h_hull_t;
+#endif /* !OBJ2H_HULL_TYPES */
+
+static inline
+float obj2h_plane_distance(vector_t const* plane, vector_t const* p)
+{
+    return plane->x * p->x + plane->y * p->y + plane->z * p->z + plane->w;
+}
+
+/*
+ * largest distance of p to a plane of the hull, and which plane that
+ * is. negative inside, where it's how deep p is
+ */
+static inline
+float obj2h_hull_distance_plane(obj2h_hull_t const* hull, vector_t const* p,
+    int* plane)
+{
+    float best = -INFINITY;
+    uint32_t i;
+
+    *plane = -1;
+
+    for (i = 0; i < hull->nplanes; ++i)
+    {
+        float d = obj2h_plane_distance(&hull->planes[i], p);
+
+        if (d > best)
+        {
+            best = d;
+            *plane = (int)i;
+        }
+    }
+
+    return best;
+}
+
+static inline
+float obj2h_hull_distance(obj2h_hull_t const* hull, vector_t const* p)
+{
+    int plane;
+    return obj2h_hull_distance_plane(hull, p, &plane);
+}
+
+/*
+ * moves the sphere center, radius out of the hull along the plane it's
+ * the least deep behind. returns whether it moved
+ */
+static inline
+int obj2h_hull_push_sphere(obj2h_hull_t const* hull, vector_t* center,
+    float radius)
+{
+    int plane;
+    float d = obj2h_hull_distance_plane(hull, center, &plane);
+    vector_t const* n;
+
+    if (plane < 0 || d >= radius) return 0;
+
+    n = &hull->planes[plane];
+    center->x += n->x * (radius - d);
+    center->y += n->y * (radius - d);
+    center->z += n->z * (radius - d);
+
+    return 1;
+}
+
+/*
+ * where the ray o + d * t with 0 <= t <= tmax enters the hull: returns
+ * the plane it goes through and sets *t, or -1 if it misses. rays that
+ * start inside miss too
+ */
+static inline
+int obj2h_hull_raycast(obj2h_hull_t const* hull, vector_t const* o,
+    vector_t const* d, float tmax, float* t)
+{
+    float tin = 0;
+    int plane = -1;
+    uint32_t i;
+
+    for (i = 0; i < hull->nplanes; ++i)
+    {
+        vector_t const* p = &hull->planes[i];
+        float dist = obj2h_plane_distance(p, o);
+        float speed = p->x * d->x + p->y * d->y + p->z * d->z;
+        float s;
+
+        /* parallel to the plane, in front of it or behind for good */
+        if (speed == 0)
+        {
+            if (dist > 0) return -1;
+            continue;
+        }
+
+        s = -dist / speed;
+
+        /* from inside every entering plane is behind, s <= 0 */
+        if (speed < 0)
+        {
+            if (s > tin)
+            {
+                tin = s;
+                plane = (int)i;
+            }
+        }
+
+        else if (s < tmax) {
+            tmax = s;
+        }
+
+        if (tin > tmax) return -1;
+    }
+
+    if (plane >= 0) *t = tin;
+
+    return plane;
+}
+
+/*
+ * closest face of a collision mesh hit by the ray o + d * t with
+ * 0 <= t <= tmax, or -1. faces whose plane the ray doesn't cross are
+ * skipped before the triangle test
+ */
+static inline
+int obj2h_collision_raycast(vector_t const* vertices, face_t const* faces,
+    vector_t const* planes, size_t nfaces, vector_t const* o,
+    vector_t const* d, float tmax, float* t)
+{
+    int best = -1;
+    size_t i;
+
+    for (i = 0; i < nfaces; ++i)
+    {
+        vector_t const* p = &planes[i];
+        float d0 = obj2h_plane_distance(p, o);
+        float d1 = d0 + (p->x * d->x + p->y * d->y + p->z * d->z) * tmax;
+        int const* vi;
+        float hit;
+
+        if ((d0 > 0 && d1 > 0) || (d0 < 0 && d1 < 0)) continue;
+
+        vi = faces[i].vertex_indices;
+        hit = obj2h_bvh_triangle(o, d, &vertices[vi[0]], &vertices[vi[1]],
+            &vertices[vi[2]]);
+
+        if (hit >= 0 && hit <= tmax)
+        {
+            tmax = hit;
+            best = (int)i;
+        }
+    }
+
+    if (best >= 0) *t = tmax;
+
+    return best;
+}
+
+/*
+ * moves the sphere center, radius out of every face of a collision
+ * mesh it overlaps and returns how many did. faces whose plane is
+ * further than radius are skipped before the closest point search
+ */
+static inline
+int obj2h_collision_push_sphere(vector_t const* vertices,
+    face_t const* faces, vector_t const* planes, size_t nfaces,
+    vector_t* center, float radius)
+{
+    int pushed = 0;
+    size_t i;
+
+    for (i = 0; i < nfaces; ++i)
+    {
+        float plane_dist = obj2h_plane_distance(&planes[i], center);
+        int const* vi;
+        vector_t p;
+        float dx, dy, dz, dist;
+
+        if (plane_dist >= radius || plane_dist <= -radius) continue;
+
+        vi = faces[i].vertex_indices;
+        p = obj2h_bvh_closest(center, &vertices[vi[0]], &vertices[vi[1]],
+            &vertices[vi[2]]);
+        dx = center->x - p.x;
+        dy = center->y - p.y;
+        dz = center->z - p.z;
+        dist = sqrtf(dx * dx + dy * dy + dz * dz);
+
+        /* dead on the surface there's no direction to go */
+        if (dist >= radius || dist <= 0) continue;
+
+        dist = (radius - dist) / dist;
+        center->x += dx * dist;
+        center->y += dy * dist;
+        center->z += dz * dist;
+        ++pushed;
+    }
+
+    return pushed;
+}
+
+#endif /* !OBJ2H_COLLISION_H */
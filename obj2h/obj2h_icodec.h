@@ -0,0 +1,674 @@
+/*
+ * index buffer codec for triangle lists and strips as emitted by
+ * obj2h --icodec, in the style of meshoptimizer's index codec
+ *
+ * decoding writes straight into the face_t / corner_t arrays the draw
+ * loop reads, so there's no intermediate index buffer
+ *
+ * ```c
+ * #include "monkey.h"
+ * #include "obj2h_icodec.h"
+ *
+ * obj2h_decode_faces(monkey_faces, ARRAY_LENGTH(monkey_faces),
+ *     monkey_faces_encoded, sizeof(monkey_faces_encoded));
+ *
+ * obj2h_decode_strips(monkey_strips, ARRAY_LENGTH(monkey_strips),
+ *     monkey_strips_encoded, sizeof(monkey_strips_encoded));
+ * ```
+ *
+ * # triangle lists
+ * vertex indices are coded against a fifo of the last 16 edges, a fifo
+ * of the last 16 vertices and a "next" counter that predicts the next
+ * never seen vertex. every triangle gets a code byte:
+ *
+ * - 0xXY, X < 15: the triangle shares edge X (0 being the most recent)
+ *   from the edge fifo. Y says where the third vertex comes from:
+ *   0 = next, 1-14 = vertex fifo entry Y - 1, 15 = explicit
+ * - 0xFY, Y < 14: no shared edge, the first vertex is next and the
+ *   other two are described by obj2h_icodec_aux[Y] as 0xBC where B and
+ *   C have the same meaning as Y above
+ * - 0xFE: same but the 0xBC byte is stored in the data stream
+ * - 0xFF: same but the first vertex is explicit too
+ *
+ * explicit indices are zigzag varints delta coded against the last
+ * explicit index. triangles may come out rotated, which doesn't change
+ * their winding
+ *
+ * # entropy coding
+ * the code and data streams can each be huffman coded on top of the
+ * above, the encoder does it when it makes the stream smaller. such a
+ * stream starts with a u32 of its decoded size, then bits (lsb first):
+ * 256 bits saying which byte values occur, a 4 bit code length for
+ * each of those, and the codes themselves, most significant bit first.
+ * codes are canonical like deflate's, at most 15 bits long
+ *
+ * # strips
+ * strips are a sequence of corners where vertex_index -1 ends a strip.
+ * every vertex index is a varint of (zigzag(delta) << 1 | baseline)
+ * where the delta is against one of the last two decoded indices
+ *
+ * # uv and normal indices
+ * these are coded per corner as a function of the vertex index. each
+ * vertex remembers the last attribute index it was used with and a
+ * "next" counter predicts never seen attributes. if the prediction
+ * always holds the stream is implicit and takes no space, otherwise one
+ * bit says whether the prediction holds. a vertex that was already seen
+ * and misses the prediction gets another bit, 0 = next and
+ * 1 = explicit varint. a vertex's first miss is always explicit
+ *
+ * layout (little endian):
+ *
+ * ```
+ * u8  OBJ2H_ICODEC_FACES or OBJ2H_ICODEC_STRIPS
+ * u8  attribute modes, bits 0-1 for uvs and 2-3 for normals
+ * u16 flags, OBJ2H_ICODEC_HUFFMAN_CODES and OBJ2H_ICODEC_HUFFMAN_DATA
+ * u32 number of faces or corners
+ * u32 number of vertices referenced (highest index + 1)
+ * u32 code_size, data_size
+ * code_size bytes of codes (empty for strips)
+ * data_size bytes of data
+ * uvs then normals if their mode is OBJ2H_ICODEC_CODED:
+ *   u32 bits_size, data_size
+ *   bits_size bytes of bits, lsb first
+ *   data_size bytes of explicit varints
+ * ```
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#ifndef OBJ2H_ICODEC_H
+#define OBJ2H_ICODEC_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define OBJ2H_ICODEC_FACES 0xE1
+#define OBJ2H_ICODEC_STRIPS 0xE2
+
+/* header flags, which streams are huffman coded */
+#define OBJ2H_ICODEC_HUFFMAN_CODES 1
+#define OBJ2H_ICODEC_HUFFMAN_DATA 2
+
+enum obj2h_icodec_attribute_mode
+{
+    OBJ2H_ICODEC_ABSENT,   /* every index is -1 */
+    OBJ2H_ICODEC_IMPLICIT, /* the prediction always holds */
+    OBJ2H_ICODEC_CODED,
+};
+
+#ifndef OBJ2H_TYPES
+#define OBJ2H_TYPES
+struct face { int vertex_indices[3], uv_indices[3], normal_indices[3]; };
+typedef struct face face_t;
+struct uv { float u, v; };
+typedef struct uv uv_t;
+#endif /* !OBJ2H_TYPES */
+
+#ifndef OBJ2H_STRIP_TYPES
+#define OBJ2H_STRIP_TYPES
+struct corner { int vertex_index, uv_index, normal_index; };
+typedef struct corner corner_t;
+#endif /* !OBJ2H_STRIP_TYPES */
+
+/* most common (B, C) pairs for triangles that don't share an edge */
+static uint8_t const obj2h_icodec_aux[14] = {
+    0x00, 0x76, 0x87, 0x56, 0x67, 0x78, 0xA9,
+    0x86, 0x65, 0x89, 0x68, 0x98, 0x01, 0x69,
+};
+
+struct obj2h_icodec_reader
+{
+    uint8_t const* p;
+    uint8_t const* end;
+    unsigned bit;
+};
+
+typedef struct obj2h_icodec_reader obj2h_icodec_reader_t;
+
+static inline
+int obj2h_icodec_varint(obj2h_icodec_reader_t* r, unsigned* x)
+{
+    unsigned shift = 0, b;
+
+    *x = 0;
+
+    do {
+        if (r->p >= r->end || shift > 28) return 1;
+        b = *r->p++;
+        *x |= (b & 0x7F) << shift;
+        shift += 7;
+    } while (b & 0x80);
+
+    return 0;
+}
+
+/* returns -1 past the end */
+static inline
+int obj2h_icodec_bit(obj2h_icodec_reader_t* r)
+{
+    int x;
+
+    if (r->p >= r->end) return -1;
+    x = (*r->p >> r->bit) & 1;
+    if (++r->bit == 8) r->bit = 0, ++r->p;
+
+    return x;
+}
+
+static inline
+uint32_t obj2h_icodec_u32(uint8_t const* p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline
+int obj2h_icodec_explicit(obj2h_icodec_reader_t* data, int* last)
+{
+    unsigned x;
+
+    if (obj2h_icodec_varint(data, &x)) return -1;
+    *last += (int)(x >> 1) ^ -(int)(x & 1);
+
+    return *last;
+}
+
+/* canonical code lengths, symbols sorted by length then value */
+struct obj2h_icodec_huffman
+{
+    uint16_t counts[16];
+    uint8_t symbols[256];
+};
+
+typedef struct obj2h_icodec_huffman obj2h_icodec_huffman_t;
+
+static inline
+int obj2h_icodec_huffman_table(obj2h_icodec_huffman_t* t,
+    obj2h_icodec_reader_t* r)
+{
+    uint8_t lengths[256];
+    uint16_t offsets[16];
+    int i, j, bit, left = 1;
+
+    for (i = 0; i < 256; ++i)
+    {
+        if ((bit = obj2h_icodec_bit(r)) < 0) return 1;
+        lengths[i] = (uint8_t)bit;
+    }
+
+    memset(t->counts, 0, sizeof(t->counts));
+
+    for (i = 0; i < 256; ++i)
+    {
+        unsigned len = 0;
+
+        if (!lengths[i]) continue;
+
+        for (j = 0; j < 4; ++j)
+        {
+            if ((bit = obj2h_icodec_bit(r)) < 0) return 1;
+            len |= bit << j;
+        }
+
+        if (!len) return 1;
+        lengths[i] = (uint8_t)len;
+        ++t->counts[len];
+    }
+
+    /* more codes than the lengths allow */
+    for (i = 1; i < 16; ++i)
+    {
+        left = (left << 1) - t->counts[i];
+        if (left < 0) return 1;
+    }
+
+    offsets[1] = 0;
+    for (i = 1; i < 15; ++i) offsets[i + 1] = offsets[i] + t->counts[i];
+
+    for (i = 0; i < 256; ++i) {
+        if (lengths[i]) t->symbols[offsets[lengths[i]]++] = (uint8_t)i;
+    }
+
+    return 0;
+}
+
+/* returns -1 past the end or on a code that isn't in the table */
+static inline
+int obj2h_icodec_symbol(obj2h_icodec_huffman_t const* t,
+    obj2h_icodec_reader_t* r)
+{
+    int code = 0, first = 0, index = 0;
+    int len, bit;
+
+    for (len = 1; len < 16; ++len)
+    {
+        if ((bit = obj2h_icodec_bit(r)) < 0) return -1;
+        code |= bit;
+        if (code - first < t->counts[len]) {
+            return t->symbols[index + code - first];
+        }
+
+        index += t->counts[len];
+        first = (first + t->counts[len]) << 1;
+        code <<= 1;
+    }
+
+    return -1;
+}
+
+/*
+ * decodes a huffman coded stream into a malloc'd buffer and points r at
+ * it instead, *buf is what to free
+ */
+static inline
+int obj2h_icodec_unpack(obj2h_icodec_reader_t* r, uint8_t** buf)
+{
+    obj2h_icodec_huffman_t* t;
+    uint32_t size, i;
+    int x = 0;
+
+    if (r->end - r->p < 4) return 1;
+    size = obj2h_icodec_u32(r->p);
+    r->p += 4;
+
+    /* every symbol takes at least a bit */
+    if (size / 8 > (size_t)(r->end - r->p)) return 1;
+
+    t = malloc(sizeof(*t));
+    *buf = malloc(size ? size : 1);
+    if (!t || !*buf) {
+        free(t);
+        return 1;
+    }
+
+    if (obj2h_icodec_huffman_table(t, r)) {
+        free(t);
+        return 1;
+    }
+
+    for (i = 0; i < size && x >= 0; ++i)
+    {
+        x = obj2h_icodec_symbol(t, r);
+        (*buf)[i] = (uint8_t)x;
+    }
+
+    free(t);
+    if (x < 0) return 1;
+
+    r->p = *buf;
+    r->end = *buf + size;
+    r->bit = 0;
+
+    return 0;
+}
+
+/*
+ * corners are laid out in groups of group ints, groups are stride ints
+ * apart. that's 3 and 9 for face_t and 1 and 3 for corner_t
+ */
+static inline
+size_t obj2h_icodec_corner(size_t i, size_t group, size_t stride)
+{
+    return i / group * stride + i % group;
+}
+
+/*
+ * decodes one attribute stream (uv or normal indices) in place. idx
+ * points at the first corner's attribute index, the vertex index is
+ * found at the same offset from vtx
+ */
+static inline
+int obj2h_icodec_attributes(unsigned mode, uint8_t const** p,
+    uint8_t const* end, int* map, uint32_t nvertices, int const* vtx,
+    int* idx, size_t n, size_t group, size_t stride)
+{
+    obj2h_icodec_reader_t bits = { 0, 0, 0 }, data = { 0, 0, 0 };
+    int next = 1, last = 0;
+    size_t i;
+
+    if (mode == OBJ2H_ICODEC_ABSENT)
+    {
+        for (i = 0; i < n; ++i) {
+            idx[obj2h_icodec_corner(i, group, stride)] = -1;
+        }
+
+        return 0;
+    }
+
+    if (mode == OBJ2H_ICODEC_CODED)
+    {
+        uint32_t bits_size, data_size;
+
+        if (end - *p < 8) return 1;
+        bits_size = obj2h_icodec_u32(*p);
+        data_size = obj2h_icodec_u32(*p + 4);
+        *p += 8;
+        if ((size_t)(end - *p) < bits_size ||
+            (size_t)(end - *p) - bits_size < data_size)
+        {
+            return 1;
+        }
+
+        bits.p = *p;
+        bits.end = data.p = *p + bits_size;
+        data.end = data.p + data_size;
+        *p = data.end;
+    }
+
+    else if (mode != OBJ2H_ICODEC_IMPLICIT) {
+        return 1;
+    }
+
+    for (i = 0; i < nvertices; ++i) map[i] = -1;
+
+    for (i = 0; i < n; ++i)
+    {
+        size_t c = obj2h_icodec_corner(i, group, stride);
+        int v = vtx[c];
+        int x, miss = 0;
+
+        if (v < 0)
+        {
+            idx[c] = -1;
+            continue;
+        }
+
+        if (mode == OBJ2H_ICODEC_CODED) {
+            if ((miss = obj2h_icodec_bit(&bits)) < 0) return 1;
+        }
+
+        if (!miss) {
+            x = map[v] >= 0 ? map[v] : next;
+        } else if (map[v] >= 0 && !(miss = obj2h_icodec_bit(&bits))) {
+            x = next;
+        } else if (miss < 0) {
+            return 1;
+        } else if ((x = obj2h_icodec_explicit(&data, &last)) < 0) {
+            return 1;
+        }
+
+        if (x >= next) next = x + 1;
+        map[v] = x;
+        idx[c] = x - 1;
+    }
+
+    return 0;
+}
+
+struct obj2h_icodec_header
+{
+    unsigned type, modes, flags;
+    uint32_t count, nvertices;
+    obj2h_icodec_reader_t code, data;
+    uint8_t const* attributes;
+    uint8_t const* end;
+    uint8_t* unpacked[2];
+};
+
+typedef struct obj2h_icodec_header obj2h_icodec_header_t;
+
+static inline
+void obj2h_icodec_release(obj2h_icodec_header_t* h)
+{
+    free(h->unpacked[0]);
+    free(h->unpacked[1]);
+}
+
+/* on success the header has to be released */
+static inline
+int obj2h_icodec_header(unsigned type, size_t count, uint8_t const* p,
+    size_t size, obj2h_icodec_header_t* h)
+{
+    uint32_t code_size, data_size;
+
+    h->unpacked[0] = h->unpacked[1] = 0;
+
+    if (size < 20 || p[0] != type) return 1;
+
+    h->end = p + size;
+    h->modes = p[1];
+    h->flags = p[2] | (p[3] << 8);
+    h->count = obj2h_icodec_u32(p + 4);
+    h->nvertices = obj2h_icodec_u32(p + 8);
+    code_size = obj2h_icodec_u32(p + 12);
+    data_size = obj2h_icodec_u32(p + 16);
+    p += 20;
+
+    if (h->count != count) return 1;
+    if ((size_t)(h->end - p) < code_size ||
+        (size_t)(h->end - p) - code_size < data_size)
+    {
+        return 1;
+    }
+
+    h->code.p = p;
+    h->code.end = h->data.p = p + code_size;
+    h->data.end = h->attributes = h->data.p + data_size;
+    h->code.bit = h->data.bit = 0;
+
+    if (((h->flags & OBJ2H_ICODEC_HUFFMAN_CODES) &&
+        obj2h_icodec_unpack(&h->code, &h->unpacked[0])) ||
+        ((h->flags & OBJ2H_ICODEC_HUFFMAN_DATA) &&
+        obj2h_icodec_unpack(&h->data, &h->unpacked[1])))
+    {
+        obj2h_icodec_release(h);
+        return 1;
+    }
+
+    return 0;
+}
+
+static inline
+int obj2h_icodec_decode_attributes(obj2h_icodec_header_t* h,
+    int const* vtx, int* uv, int* normal, size_t n, size_t group,
+    size_t stride)
+{
+    uint8_t const* p = h->attributes;
+    int* map;
+    int err;
+
+    map = malloc(sizeof(int) * (h->nvertices ? h->nvertices : 1));
+    if (!map) return 1;
+
+    err = obj2h_icodec_attributes(h->modes & 3, &p, h->end, map,
+        h->nvertices, vtx, uv, n, group, stride);
+
+    if (!err)
+    {
+        err = obj2h_icodec_attributes((h->modes >> 2) & 3, &p, h->end, map,
+            h->nvertices, vtx, normal, n, group, stride);
+    }
+
+    free(map);
+
+    return err || p != h->end;
+}
+
+static inline
+int obj2h_icodec_faces(obj2h_icodec_header_t* h, face_t* faces,
+    size_t nfaces)
+{
+    int edges[16][2], vertices[16];
+    unsigned eoff = 0, voff = 0;
+    int next = 0, last = 0;
+    size_t i;
+
+    memset(edges, 0, sizeof(edges));
+    memset(vertices, 0, sizeof(vertices));
+
+    for (i = 0; i < nfaces; ++i)
+    {
+        int* t = faces[i].vertex_indices;
+        unsigned code, fe, fv[3];
+        int a, b, c;
+        int j;
+
+        if (h->code.p >= h->code.end) return 1;
+        code = *h->code.p++;
+        fe = code >> 4;
+
+        if (fe < 15)
+        {
+            a = edges[(eoff - 1 - fe) & 15][0];
+            b = edges[(eoff - 1 - fe) & 15][1];
+            fv[2] = code & 15;
+
+            if (fv[2] == 0) {
+                c = next++;
+            } else if (fv[2] < 15) {
+                c = vertices[(voff - fv[2]) & 15];
+            } else if ((c = obj2h_icodec_explicit(&h->data, &last)) < 0) {
+                return 1;
+            }
+
+            if (fv[2] == 0 || fv[2] == 15) {
+                vertices[voff++ & 15] = c;
+            }
+        }
+
+        else
+        {
+            unsigned aux;
+            int abc[3];
+
+            if ((code & 15) < 14) {
+                aux = obj2h_icodec_aux[code & 15];
+            } else if (h->data.p < h->data.end) {
+                aux = *h->data.p++;
+            } else {
+                return 1;
+            }
+
+            fv[0] = (code & 15) == 15 ? 15 : 0;
+            fv[1] = aux >> 4;
+            fv[2] = aux & 15;
+
+            /* fifo lookups all refer to the state before this triangle */
+            for (j = 0; j < 3; ++j)
+            {
+                if (fv[j] == 0) {
+                    abc[j] = next++;
+                } else if (fv[j] < 15) {
+                    abc[j] = vertices[(voff - fv[j]) & 15];
+                } else if ((abc[j] = obj2h_icodec_explicit(&h->data, &last))
+                    < 0)
+                {
+                    return 1;
+                }
+            }
+
+            for (j = 0; j < 3; ++j)
+            {
+                if (fv[j] == 0 || fv[j] == 15) {
+                    vertices[voff++ & 15] = abc[j];
+                }
+            }
+
+            a = abc[0];
+            b = abc[1];
+            c = abc[2];
+
+            edges[eoff & 15][0] = b;
+            edges[eoff++ & 15][1] = a;
+        }
+
+        edges[eoff & 15][0] = c;
+        edges[eoff++ & 15][1] = b;
+        edges[eoff & 15][0] = a;
+        edges[eoff++ & 15][1] = c;
+
+        if ((uint32_t)a >= h->nvertices || (uint32_t)b >= h->nvertices ||
+            (uint32_t)c >= h->nvertices)
+        {
+            return 1;
+        }
+
+        t[0] = a;
+        t[1] = b;
+        t[2] = c;
+    }
+
+    if (h->code.p != h->code.end || h->data.p != h->data.end) return 1;
+
+    return obj2h_icodec_decode_attributes(h, faces->vertex_indices,
+        faces->uv_indices, faces->normal_indices, nfaces * 3, 3,
+        sizeof(face_t) / sizeof(int));
+}
+
+/*
+ * decodes a triangle list into nfaces faces. returns non-zero if the
+ * data is corrupt or encodes a different number of faces
+ */
+static inline
+int obj2h_decode_faces(face_t* faces, size_t nfaces, uint8_t const* data,
+    size_t size)
+{
+    obj2h_icodec_header_t h;
+    int err;
+
+    if (obj2h_icodec_header(OBJ2H_ICODEC_FACES, nfaces, data, size, &h)) {
+        return 1;
+    }
+
+    err = obj2h_icodec_faces(&h, faces, nfaces);
+    obj2h_icodec_release(&h);
+
+    return err;
+}
+
+static inline
+int obj2h_icodec_strips(obj2h_icodec_header_t* h, corner_t* strips,
+    size_t n)
+{
+    int last[2] = { 0, 0 };
+    size_t i;
+
+    for (i = 0; i < n; ++i)
+    {
+        unsigned x;
+        int v;
+
+        if (obj2h_icodec_varint(&h->data, &x)) return 1;
+
+        v = last[x & 1] + ((int)(x >> 2) ^ -(int)((x >> 1) & 1));
+        if (v < -1 || (v >= 0 && (uint32_t)v >= h->nvertices)) return 1;
+
+        /* restarts don't replace the baseline */
+        if (v >= 0) last[x & 1] = v;
+        strips[i].vertex_index = v;
+    }
+
+    if (h->data.p != h->data.end) return 1;
+
+    return obj2h_icodec_decode_attributes(h, &strips->vertex_index,
+        &strips->uv_index, &strips->normal_index, n, 1,
+        sizeof(corner_t) / sizeof(int));
+}
+
+/*
+ * decodes n corners of triangle strips. returns non-zero if the data is
+ * corrupt or encodes a different number of corners
+ */
+static inline
+int obj2h_decode_strips(corner_t* strips, size_t n, uint8_t const* data,
+    size_t size)
+{
+    obj2h_icodec_header_t h;
+    int err;
+
+    if (obj2h_icodec_header(OBJ2H_ICODEC_STRIPS, n, data, size, &h)) {
+        return 1;
+    }
+
+    err = obj2h_icodec_strips(&h, strips, n);
+    obj2h_icodec_release(&h);
+
+    return err;
+}
+
+#endif /* !OBJ2H_ICODEC_H */
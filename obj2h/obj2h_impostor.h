@@ -0,0 +1,138 @@
+/*
+ * impostors as emitted by obj2h --impostor
+ *
+ * obj2h renders the model offline from a ring (or several rings) of
+ * directions around it into one atlas, a cell per view, and the header
+ * gets the atlas plus each view's direction and uv rect. far away
+ * instances are then drawn as one screen aligned quad textured with
+ * the view closest to the camera direction
+ *
+ * the color atlas is ARGB1555, non twiddled, with alpha set where the
+ * model covers the texel, so it goes in the punch-through list. the
+ * optional normal atlas is RGB565 with model space normals mapped from
+ * [-1, 1] to [0, 1]
+ *
+ * ```c
+ * #include "tree.h"
+ * #include "obj2h_impostor.h"
+ *
+ * init:
+ *   tex = pvr_mem_malloc(sizeof(tree_impostor_color));
+ *   pvr_txr_load(tree_impostor_color, tex, sizeof(tree_impostor_color));
+ *   pvr_poly_cxt_txr(&cxt, PVR_LIST_PT_POLY, PVR_TXRFMT_ARGB1555 |
+ *       PVR_TXRFMT_NONTWIDDLED, tree_impostor.width,
+ *       tree_impostor.height, tex, PVR_FILTER_BILINEAR);
+ *   cxt.gen.culling = PVR_CULLING_NONE;
+ *
+ * draw, with the instance's center in screen space and its radius in
+ * pixels:
+ *   if (obj2h_impostor_far(&tree_impostor, pixel_radius))
+ *   {
+ *       view = obj2h_impostor_pick(&tree_impostor, to_camera.x,
+ *           to_camera.y, to_camera.z);
+ *       obj2h_impostor_quad(&tree_impostor, view, sx, sy, sz,
+ *           pixel_radius, 0xffffffff, quad);
+ *       pvr_prim(quad, sizeof(quad));
+ *   }
+ * ```
+ *
+ * to_camera is the direction from the model to the camera in model
+ * space and doesn't need to be normalized
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#ifndef OBJ2H_IMPOSTOR_H
+#define OBJ2H_IMPOSTOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef OBJ2H_IMPOSTOR_TYPES
+#define OBJ2H_IMPOSTOR_TYPES
+struct obj2h_impostor_view
+{
+    float dir[3]; /* from the model towards the camera it was baked with */
+    float u0, v0, u1, v1;
+};
+typedef struct obj2h_impostor_view obj2h_impostor_view_t;
+struct obj2h_impostor
+{
+    uint32_t width, height; /* of the atlas */
+    uint32_t cell;          /* size of one view in texels */
+    float center[3], radius; /* the quad covers this sphere */
+    uint32_t nviews;
+    obj2h_impostor_view_t const* views;
+    uint16_t const* color;
+    uint16_t const* normal; /* null unless baked */
+};
+typedef struct obj2h_impostor obj2h_impostor_t;
+#endif /* !OBJ2H_IMPOSTOR_TYPES */
+
+/* view whose direction is closest to x, y, z */
+static inline
+uint32_t obj2h_impostor_pick(obj2h_impostor_t const* imp, float x, float y,
+    float z)
+{
+    uint32_t i, best = 0;
+    float best_dot = -1e30f;
+
+    for (i = 0; i < imp->nviews; ++i)
+    {
+        float const* d = imp->views[i].dir;
+        float dot = d[0] * x + d[1] * y + d[2] * z;
+
+        if (dot > best_dot)
+        {
+            best_dot = dot;
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+/*
+ * whether the model is small enough on screen to swap for its impostor,
+ * which is once it covers no more pixels across than a cell has texels
+ */
+static inline
+int obj2h_impostor_far(obj2h_impostor_t const* imp, float pixel_radius)
+{
+    return pixel_radius * 2 <= (float)imp->cell;
+}
+
+#ifdef _arch_dreamcast
+#include <kos.h>
+
+/*
+ * fills quad with a 4 vertex strip for view, centered on sx, sy (screen
+ * space) at depth sz and pixel_radius texels wide on each side
+ */
+static inline
+void obj2h_impostor_quad(obj2h_impostor_t const* imp, uint32_t view,
+    float sx, float sy, float sz, float pixel_radius, uint32_t argb,
+    pvr_vertex_t* quad)
+{
+    obj2h_impostor_view_t const* v = &imp->views[view];
+    int i;
+
+    for (i = 0; i < 4; ++i)
+    {
+        quad[i].flags = i == 3 ? PVR_CMD_VERTEX_EOL : PVR_CMD_VERTEX;
+        quad[i].x = sx + (i & 1 ? pixel_radius : -pixel_radius);
+        quad[i].y = sy + (i & 2 ? pixel_radius : -pixel_radius);
+        quad[i].z = sz;
+        quad[i].u = i & 1 ? v->u1 : v->u0;
+        quad[i].v = i & 2 ? v->v1 : v->v0;
+        quad[i].argb = argb;
+        quad[i].oargb = 0;
+    }
+}
+#endif /* _arch_dreamcast */
+
+#endif /* !OBJ2H_IMPOSTOR_H */
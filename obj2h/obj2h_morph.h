@@ -0,0 +1,160 @@
+/*
+ * vertex animation (morph targets) as emitted by obj2h --morph
+ *
+ * an animation is the first frame's mesh, emitted as the usual arrays,
+ * plus per-frame deltas against it. only vertices and normals that
+ * actually move are stored, positions as int16 and normals as int8
+ * scaled by a per-animation factor. frames are independent of each
+ * other so any two of them can be blended
+ *
+ * ```c
+ * #include "walk.h"
+ * #include "obj2h_morph.h"
+ *
+ * static vector_t vertices[ARRAY_LENGTH(walk_vertices)]
+ * __attribute__((aligned(32)));
+ * static vector_t normals[ARRAY_LENGTH(walk_normals)]
+ * __attribute__((aligned(32)));
+ *
+ * obj2h_morph_blend(&walk_morph, walk_vertices, vertices,
+ *     ARRAY_LENGTH(walk_vertices), walk_normals, normals,
+ *     ARRAY_LENGTH(walk_normals), frame, (frame + 1) % walk_morph.nframes,
+ *     t);
+ *
+ * mat_transform(vertices, tbuf, ARRAY_LENGTH(walk_vertices),
+ *     sizeof(vector_t));
+ * ```
+ *
+ * the cost of a blend is a copy of the base arrays plus work
+ * proportional to the number of vertices that move in the two frames
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#ifndef OBJ2H_MORPH_H
+#define OBJ2H_MORPH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+#ifndef OBJ2H_MORPH_TYPES
+#define OBJ2H_MORPH_TYPES
+struct obj2h_morph_position { uint16_t index; int16_t d[3]; };
+typedef struct obj2h_morph_position obj2h_morph_position_t;
+struct obj2h_morph_normal { uint16_t index; int8_t d[3]; int8_t pad; };
+typedef struct obj2h_morph_normal obj2h_morph_normal_t;
+struct obj2h_morph_frame
+{
+    uint32_t first_position, npositions;
+    uint32_t first_normal, nnormals;
+};
+typedef struct obj2h_morph_frame obj2h_morph_frame_t;
+struct obj2h_morph
+{
+    float position_scale, normal_scale;
+    uint32_t nframes;
+    obj2h_morph_frame_t const* frames;
+    obj2h_morph_position_t const* positions;
+    obj2h_morph_normal_t const* normals;
+};
+typedef struct obj2h_morph obj2h_morph_t;
+#endif /* !OBJ2H_MORPH_TYPES */
+
+/* adds weight times frame's deltas to vertices and normals */
+static inline
+void obj2h_morph_add(obj2h_morph_t const* m, uint32_t frame, float weight,
+    vector_t* vertices, vector_t* normals)
+{
+    obj2h_morph_frame_t const* f = &m->frames[frame];
+    float s;
+    uint32_t i;
+
+    if (weight == 0) return;
+
+    s = weight * m->position_scale;
+
+    for (i = 0; i < f->npositions; ++i)
+    {
+        obj2h_morph_position_t const* p =
+            &m->positions[f->first_position + i];
+        vector_t* v = &vertices[p->index];
+
+        v->x += p->d[0] * s;
+        v->y += p->d[1] * s;
+        v->z += p->d[2] * s;
+    }
+
+    if (!normals) return;
+
+    s = weight * m->normal_scale;
+
+    for (i = 0; i < f->nnormals; ++i)
+    {
+        obj2h_morph_normal_t const* p = &m->normals[f->first_normal + i];
+        vector_t* n = &normals[p->index];
+
+        n->x += p->d[0] * s;
+        n->y += p->d[1] * s;
+        n->z += p->d[2] * s;
+    }
+}
+
+/* renormalizes the normals frame moved */
+static inline
+void obj2h_morph_renormalize(obj2h_morph_t const* m, uint32_t frame,
+    vector_t* normals)
+{
+    obj2h_morph_frame_t const* f = &m->frames[frame];
+    uint32_t i;
+
+    for (i = 0; i < f->nnormals; ++i)
+    {
+        vector_t* n = &normals[m->normals[f->first_normal + i].index];
+        float len = sqrtf(n->x * n->x + n->y * n->y + n->z * n->z);
+
+        if (len > 0)
+        {
+            len = 1.0f / len;
+            n->x *= len;
+            n->y *= len;
+            n->z *= len;
+        }
+    }
+}
+
+/*
+ * writes the blend of frames a and b at t (0 = a, 1 = b) to vertices and
+ * normals, starting from the base arrays. normals can be null to only
+ * animate positions
+ */
+static inline
+void obj2h_morph_blend(obj2h_morph_t const* m,
+    vector_t const* base_vertices, vector_t* vertices, size_t nvertices,
+    vector_t const* base_normals, vector_t* normals, size_t nnormals,
+    uint32_t a, uint32_t b, float t)
+{
+    memcpy(vertices, base_vertices, nvertices * sizeof(vector_t));
+
+    if (normals) {
+        memcpy(normals, base_normals, nnormals * sizeof(vector_t));
+    }
+
+    if (a == b) t = 0;
+
+    obj2h_morph_add(m, a, 1 - t, vertices, normals);
+    obj2h_morph_add(m, b, t, vertices, normals);
+
+    if (normals)
+    {
+        obj2h_morph_renormalize(m, a, normals);
+        obj2h_morph_renormalize(m, b, normals);
+    }
+}
+
+#endif /* !OBJ2H_MORPH_H */
@@ -0,0 +1,158 @@
+/*
+ * progressive meshes as emitted by obj2h --progressive
+ *
+ * the model is simplified offline with half-edge collapses (garland and
+ * heckbert error quadrics) and the arrays are reordered so that any
+ * level of detail is a prefix of them:
+ *
+ * - vertices: the base mesh's first, then one per vertex split
+ * - faces: the base mesh's first, then the ones each split brings back
+ *
+ * level l (0 = base, nsplits = full model) uses nbase_vertices + l
+ * vertices and obj2h_pm_nfaces(pm, l) faces. a split moves some corners
+ * of the faces already in use from its parent vertex to the new one and
+ * brings its own faces back from face_vertices, so the face indices are
+ * patched in place as the level changes instead of being rebuilt
+ *
+ * ```c
+ * #include "model.h"
+ * #include "obj2h_pm.h"
+ *
+ * static face_t faces[ARRAY_LENGTH(model_faces)];
+ * static uint32_t level;
+ *
+ * init:
+ *   level = obj2h_pm_init(&model_pm, faces);
+ *
+ * draw:
+ *   obj2h_pm_set_level(&model_pm, faces, &level,
+ *       obj2h_pm_level_for_faces(&model_pm, budget));
+ *
+ *   nvertices = model_pm.nbase_vertices + level;
+ *   nfaces = obj2h_pm_nfaces(&model_pm, level);
+ *   mat_transform(model_vertices, tbuf, nvertices, sizeof(vector_t));
+ *   ... draw faces[0] to faces[nfaces - 1] ...
+ * ```
+ *
+ * since every level only needs a prefix of the vertex array, the model
+ * can be drawn while the rest of it is still streaming in. uv and
+ * normal indices are left at full detail
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#ifndef OBJ2H_PM_H
+#define OBJ2H_PM_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifndef OBJ2H_PM_TYPES
+#define OBJ2H_PM_TYPES
+struct obj2h_pm_split
+{
+    uint32_t parent;   /* vertex the new one splits off from */
+    uint32_t nfaces;   /* faces in use once this split is applied */
+    uint32_t first_corner, ncorners; /* into corners, face * 3 + corner */
+};
+typedef struct obj2h_pm_split obj2h_pm_split_t;
+struct obj2h_pm
+{
+    uint32_t nbase_vertices, nbase_faces;
+    uint32_t nsplits;
+    obj2h_pm_split_t const* splits;
+    uint32_t const* corners;
+    uint32_t const* face_vertices; /* 3 per face past the base */
+    face_t const* faces; /* full detail */
+};
+typedef struct obj2h_pm obj2h_pm_t;
+#endif /* !OBJ2H_PM_TYPES */
+
+/* number of faces at level */
+static inline
+uint32_t obj2h_pm_nfaces(obj2h_pm_t const* pm, uint32_t level)
+{
+    return level ? pm->splits[level - 1].nfaces : pm->nbase_faces;
+}
+
+/* highest level that stays within budget faces, 0 if none does */
+static inline
+uint32_t obj2h_pm_level_for_faces(obj2h_pm_t const* pm, uint32_t budget)
+{
+    uint32_t lo = 0, hi = pm->nsplits;
+
+    while (lo < hi)
+    {
+        uint32_t mid = (lo + hi + 1) / 2;
+        if (pm->splits[mid - 1].nfaces <= budget) lo = mid; else hi = mid - 1;
+    }
+
+    return lo;
+}
+
+/*
+ * copies the full detail faces to faces, which must have room for all
+ * of them, and returns the level they're at
+ */
+static inline
+uint32_t obj2h_pm_init(obj2h_pm_t const* pm, face_t* faces)
+{
+    memcpy(faces, pm->faces,
+        obj2h_pm_nfaces(pm, pm->nsplits) * sizeof(face_t));
+
+    return pm->nsplits;
+}
+
+/*
+ * moves faces from *level to target by applying or undoing splits. the
+ * cost is proportional to the corners the splits in between touch
+ */
+static inline
+void obj2h_pm_set_level(obj2h_pm_t const* pm, face_t* faces,
+    uint32_t* level, uint32_t target)
+{
+    uint32_t i;
+
+    if (target > pm->nsplits) target = pm->nsplits;
+
+    for (; *level < target; ++*level)
+    {
+        obj2h_pm_split_t const* s = &pm->splits[*level];
+        int v = (int)(pm->nbase_vertices + *level);
+        uint32_t f = obj2h_pm_nfaces(pm, *level);
+
+        for (i = 0; i < s->ncorners; ++i)
+        {
+            uint32_t c = pm->corners[s->first_corner + i];
+            faces[c / 3].vertex_indices[c % 3] = v;
+        }
+
+        for (; f < s->nfaces; ++f)
+        {
+            uint32_t const* vi =
+                &pm->face_vertices[(f - pm->nbase_faces) * 3];
+
+            faces[f].vertex_indices[0] = (int)vi[0];
+            faces[f].vertex_indices[1] = (int)vi[1];
+            faces[f].vertex_indices[2] = (int)vi[2];
+        }
+    }
+
+    for (; *level > target; --*level)
+    {
+        obj2h_pm_split_t const* s = &pm->splits[*level - 1];
+
+        for (i = 0; i < s->ncorners; ++i)
+        {
+            uint32_t c = pm->corners[s->first_corner + i];
+            faces[c / 3].vertex_indices[c % 3] = (int)s->parent;
+        }
+    }
+}
+
+#endif /* !OBJ2H_PM_H */
@@ -0,0 +1,141 @@
+/*
+ * shared vertex pools as emitted by obj2h --pool
+ *
+ * every model given to obj2h --pool is appended to one set of arrays
+ * (scene_vertices, scene_normals, scene_uvs, scene_faces) with its
+ * indices rebased, and gets an entry in scene_ranges saying which slice
+ * of each array is its own. face indices point into the whole pool, so
+ * a scene of props that share a matrix is transformed with a single
+ * mat_transform and submitted under a single poly header
+ *
+ * ```c
+ * #include "scene.h"
+ * #include "obj2h_pool.h"
+ *
+ * static vector_t tbuf[ARRAY_LENGTH(scene_vertices)]
+ * __attribute__((aligned(32)));
+ * static uint16_t visible[SCENE_NRANGES];
+ *
+ * obj2h_pool_transform(&scene_pool, tbuf);
+ *
+ * pvr_list_begin(PVR_LIST_OP_POLY);
+ * pvr_prim(&hdr, sizeof(hdr));
+ * obj2h_pool_submit(&scene_pool, tbuf, visible, nvisible, 0xffffffff);
+ * ```
+ *
+ * props that move on their own can be transformed one range at a time
+ * with obj2h_pool_transform_range, the results land at the same offsets
+ * in tbuf so the faces still index them directly
+ *
+ * if any model had vertex colors, scene_colors has one per pool vertex
+ * (white for the models without) and shares the ranges' vertex slices
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#ifndef OBJ2H_POOL_H
+#define OBJ2H_POOL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef OBJ2H_POOL_TYPES
+#define OBJ2H_POOL_TYPES
+struct obj2h_draw_range
+{
+    char const* name;
+    uint32_t first_vertex, nvertices;
+    uint32_t first_normal, nnormals;
+    uint32_t first_uv, nuvs;
+    uint32_t first_face, nfaces;
+    float center[3], radius; /* bounding sphere, model space */
+};
+typedef struct obj2h_draw_range obj2h_draw_range_t;
+struct obj2h_pool
+{
+    vector_t* vertices;
+    vector_t* normals;
+    uv_t* uvs;
+    face_t* faces;
+    uint32_t* colors; /* per vertex, 0 if no model had any */
+    uint32_t nvertices, nnormals, nuvs, nfaces;
+    uint32_t nranges;
+    obj2h_draw_range_t const* ranges;
+};
+typedef struct obj2h_pool obj2h_pool_t;
+#endif /* !OBJ2H_POOL_TYPES */
+
+#ifdef _arch_dreamcast
+#include <kos.h>
+
+/* transforms every vertex of the pool with the current matrix */
+static inline
+void obj2h_pool_transform(obj2h_pool_t const* p, vector_t* tbuf)
+{
+    mat_transform(p->vertices, tbuf, p->nvertices, sizeof(vector_t));
+}
+
+/* transforms the vertices of one range into their slots of tbuf */
+static inline
+void obj2h_pool_transform_range(obj2h_pool_t const* p, uint32_t range,
+    vector_t* tbuf)
+{
+    obj2h_draw_range_t const* r = &p->ranges[range];
+
+    mat_transform(p->vertices + r->first_vertex, tbuf + r->first_vertex,
+        r->nvertices, sizeof(vector_t));
+}
+
+/*
+ * sends the faces of n ranges (indices into p->ranges) to the currently
+ * open list, after the caller's poly header. vertices take their color
+ * from p->colors, or argb if the pool has none. ranges that follow each
+ * other in the pool are walked as one run
+ */
+static inline
+void obj2h_pool_submit(obj2h_pool_t const* p, vector_t const* tbuf,
+    uint16_t const* ranges, size_t n, uint32_t argb)
+{
+    pvr_vertex_t pv;
+    size_t i = 0;
+
+    pv.argb = argb;
+    pv.oargb = 0;
+    pv.u = pv.v = 0;
+
+    while (i < n)
+    {
+        obj2h_draw_range_t const* r = &p->ranges[ranges[i]];
+        face_t const* f = p->faces + r->first_face;
+        face_t const* end = f + r->nfaces;
+
+        for (++i; i < n && ranges[i] == ranges[i - 1] + 1; ++i) {
+            end += p->ranges[ranges[i]].nfaces;
+        }
+
+        for (; f < end; ++f)
+        {
+            int j;
+
+            for (j = 0; j < 3; ++j)
+            {
+                int vi = f->vertex_indices[2 - j];
+                vector_t const* v = &tbuf[vi];
+
+                if (p->colors) pv.argb = p->colors[vi];
+                pv.x = v->x;
+                pv.y = v->y;
+                pv.z = v->z;
+                pv.flags = j == 2 ? PVR_CMD_VERTEX_EOL : PVR_CMD_VERTEX;
+                pvr_prim(&pv, sizeof(pv));
+            }
+        }
+    }
+}
+#endif /* _arch_dreamcast */
+
+#endif /* !OBJ2H_POOL_H */
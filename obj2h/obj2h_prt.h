@@ -0,0 +1,145 @@
+/*
+ * precomputed radiance transfer as baked by obj2h --prt
+ *
+ * every vertex has 9 spherical harmonic coefficients (the first 3
+ * bands) describing how much of the light coming from each direction
+ * reaches it. the cosine falloff and the shadows the model casts on
+ * itself are both in there. lights are projected onto the same 9
+ * functions once per frame, and lighting a vertex is then a 9-term dot
+ * product per channel, however many lights there are
+ *
+ * ```c
+ * #include "model.h"
+ * #include "obj2h_prt.h"
+ *
+ * static uint32_t colors[ARRAY_LENGTH(model_prt)];
+ * obj2h_prt_light_t light;
+ *
+ * every frame, with directions in model space pointing at the lights:
+ *   obj2h_prt_clear(&light);
+ *   obj2h_prt_ambient(&light, 0.1f, 0.1f, 0.15f);
+ *   obj2h_prt_directional(&light, &sun, 1, 0.9f, 0.8f);
+ *   obj2h_prt_shade(model_prt, ARRAY_LENGTH(model_prt), &light, colors);
+ *
+ * colors[vertex_index] is then the ARGB8888 color of a vertex
+ * ```
+ *
+ * directions are in the space of model_vertices (y down), so a rotated
+ * model needs its lights rotated back into it. only 3 bands are kept,
+ * which is what makes the shadows soft: anything sharper than that
+ * comes out blurred. light bouncing off the model isn't baked, and the
+ * transfer is for the mesh as exported, it doesn't follow morphs or
+ * skins
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#ifndef OBJ2H_PRT_H
+#define OBJ2H_PRT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#ifndef OBJ2H_PRT_TYPES
+#define OBJ2H_PRT_TYPES
+struct obj2h_sh9 { float c[9]; };
+typedef struct obj2h_sh9 obj2h_sh9_t;
+#endif /* !OBJ2H_PRT_TYPES */
+
+/* the light around the model, one set of coefficients per channel */
+struct obj2h_prt_light { obj2h_sh9_t r, g, b; };
+typedef struct obj2h_prt_light obj2h_prt_light_t;
+
+/* the 9 real spherical harmonics at the unit direction x, y, z */
+static inline
+void obj2h_prt_basis(float x, float y, float z, float* sh)
+{
+    sh[0] = 0.282094792f;
+    sh[1] = 0.488602512f * y;
+    sh[2] = 0.488602512f * z;
+    sh[3] = 0.488602512f * x;
+    sh[4] = 1.09254843f * x * y;
+    sh[5] = 1.09254843f * y * z;
+    sh[6] = 0.315391565f * (3 * z * z - 1);
+    sh[7] = 1.09254843f * x * z;
+    sh[8] = 0.546274215f * (x * x - y * y);
+}
+
+static inline
+void obj2h_prt_clear(obj2h_prt_light_t* l)
+{
+    memset(l, 0, sizeof(*l));
+}
+
+/*
+ * light coming equally from everywhere, scaled so a vertex nothing
+ * shadows gets r, g, b. 2 / sqrt(pi), the transfer of such a vertex
+ * integrates the cosine to pi
+ */
+static inline
+void obj2h_prt_ambient(obj2h_prt_light_t* l, float r, float g, float b)
+{
+    l->r.c[0] += r * 1.12837917f;
+    l->g.c[0] += g * 1.12837917f;
+    l->b.c[0] += b * 1.12837917f;
+}
+
+/*
+ * a light infinitely far in the unit direction dir, scaled so a vertex
+ * facing it and not shadowed gets about r, g, b
+ */
+static inline
+void obj2h_prt_directional(obj2h_prt_light_t* l, vector_t const* dir,
+    float r, float g, float b)
+{
+    float sh[9];
+    int i;
+
+    obj2h_prt_basis(dir->x, dir->y, dir->z, sh);
+
+    for (i = 0; i < 9; ++i)
+    {
+        l->r.c[i] += r * sh[i];
+        l->g.c[i] += g * sh[i];
+        l->b.c[i] += b * sh[i];
+    }
+}
+
+static inline
+float obj2h_prt_dot(obj2h_sh9_t const* a, obj2h_sh9_t const* b)
+{
+    return a->c[0] * b->c[0] + a->c[1] * b->c[1] + a->c[2] * b->c[2] +
+        a->c[3] * b->c[3] + a->c[4] * b->c[4] + a->c[5] * b->c[5] +
+        a->c[6] * b->c[6] + a->c[7] * b->c[7] + a->c[8] * b->c[8];
+}
+
+/* 0 to 255, the ringing of the 3 bands can go a little below 0 */
+static inline
+uint32_t obj2h_prt_channel(float x)
+{
+    x = x < 0 ? 0 : x > 1 ? 1 : x;
+    return (uint32_t)(x * 255 + 0.5f);
+}
+
+/* the ARGB8888 color of every one of the n vertices of transfer */
+static inline
+void obj2h_prt_shade(obj2h_sh9_t const* transfer, size_t n,
+    obj2h_prt_light_t const* l, uint32_t* argb)
+{
+    size_t i;
+
+    for (i = 0; i < n; ++i)
+    {
+        argb[i] = 0xFF000000 |
+            obj2h_prt_channel(obj2h_prt_dot(&transfer[i], &l->r)) << 16 |
+            obj2h_prt_channel(obj2h_prt_dot(&transfer[i], &l->g)) << 8 |
+            obj2h_prt_channel(obj2h_prt_dot(&transfer[i], &l->b));
+    }
+}
+
+#endif /* !OBJ2H_PRT_H */
@@ -0,0 +1,122 @@
+/*
+ * submits the pre-baked pvr streams emitted by obj2h --pvr
+ *
+ * a stream is a poly header slot followed by pvr_vertex_t's in model
+ * space with flags, uvs and colors already set, so drawing it is a copy
+ * plus a transform with no per-vertex branching. the header slot is
+ * filled in once at init with pvr_poly_compile so the stream can be
+ * sent to the ta in one go
+ *
+ * ```c
+ * #include "model.h"
+ * #include "obj2h_pvr.h"
+ *
+ * static pvr_vertex_t buf[ARRAY_LENGTH(model_pvr.vertices) + 1]
+ * __attribute__((aligned(32)));
+ *
+ * init:
+ *   pvr_poly_cxt_col(&cxt, PVR_LIST_OP_POLY);
+ *   pvr_poly_compile(&model_pvr.hdr, &cxt);
+ *
+ * draw:
+ *   mat_identity();
+ *   mat_perspective(...);
+ *   ...
+ *   obj2h_pvr_transform(&model_pvr, buf,
+ *       ARRAY_LENGTH(model_pvr.vertices));
+ *
+ *   pvr_list_begin(PVR_LIST_OP_POLY);
+ *   obj2h_pvr_submit(buf, ARRAY_LENGTH(model_pvr.vertices));
+ * ```
+ *
+ * if the matrix doesn't change between frames the transformed buffer
+ * can simply be replayed with obj2h_pvr_submit
+ *
+ * with --uv16 the stream is made of obj2h_pvr_vertex_uv16_t's instead,
+ * the ta's textured vertex with both uvs packed in one word as the top
+ * halves of two floats. it's the same size as a pvr_vertex_t so the
+ * functions below work on it unchanged, the poly header just has to be
+ * compiled for it:
+ *
+ * ```c
+ * static obj2h_pvr_vertex_uv16_t buf[ARRAY_LENGTH(model_pvr.vertices) + 1]
+ * __attribute__((aligned(32)));
+ *
+ * init:
+ *   pvr_poly_cxt_txr(&cxt, PVR_LIST_OP_POLY, PVR_TXRFMT_RGB565 |
+ *       PVR_TXRFMT_TWIDDLED, 64, 64, tex, PVR_FILTER_BILINEAR);
+ *   cxt.fmt.uv = PVR_UVFMT_16BIT;
+ *   pvr_poly_compile(&model_pvr.hdr, &cxt);
+ * ```
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#ifndef OBJ2H_PVR_H
+#define OBJ2H_PVR_H
+
+#include <kos.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifndef OBJ2H_PVR_UV16_TYPES
+#define OBJ2H_PVR_UV16_TYPES
+struct obj2h_pvr_vertex_uv16
+{
+    uint32_t flags;
+    float x, y, z;
+    uint32_t uv; /* u in the high half, v in the low one */
+    uint32_t pad;
+    uint32_t argb, oargb;
+};
+typedef struct obj2h_pvr_vertex_uv16 obj2h_pvr_vertex_uv16_t;
+#endif /* !OBJ2H_PVR_UV16_TYPES */
+
+/*
+ * packs u, v the way obj2h --uv16 does, rounding to the nearest 16-bit
+ * value rather than truncating
+ */
+static inline
+uint32_t obj2h_pvr_uv16(float u, float v)
+{
+    uint32_t pu, pv;
+
+    memcpy(&pu, &u, 4);
+    memcpy(&pv, &v, 4);
+    pu += 0x7FFF + ((pu >> 16) & 1);
+    pv += 0x7FFF + ((pv >> 16) & 1);
+
+    return (pu & 0xFFFF0000) | pv >> 16;
+}
+
+/*
+ * copies a stream of nvertices vertices to dst, which must have room for
+ * the header plus the vertices, then transforms and perspective divides
+ * the positions in place with the current matrix
+ */
+static inline
+void obj2h_pvr_transform(void const* stream, void* dst, size_t nvertices)
+{
+    pvr_vertex_t* v = (pvr_vertex_t*)((pvr_poly_hdr_t*)dst + 1);
+
+    memcpy(dst, stream,
+        sizeof(pvr_poly_hdr_t) + nvertices * sizeof(pvr_vertex_t));
+
+    /* only x, y, z are touched, the stride skips the rest */
+    mat_transform((vector_t*)&v->x, (vector_t*)&v->x, nvertices,
+        sizeof(pvr_vertex_t));
+}
+
+/* sends a transformed stream to the currently open list */
+static inline
+void obj2h_pvr_submit(void* stream, size_t nvertices)
+{
+    pvr_prim(stream,
+        sizeof(pvr_poly_hdr_t) + nvertices * sizeof(pvr_vertex_t));
+}
+
+#endif /* !OBJ2H_PVR_H */
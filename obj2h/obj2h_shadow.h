@@ -0,0 +1,280 @@
+/*
+ * shadow volumes from the edge adjacency emitted by obj2h --edges
+ *
+ * every edge of the mesh is listed once with the two faces that share
+ * it, and every face gets its plane, so finding the silhouette against
+ * a light is one pass over the faces (which side of its plane is the
+ * light on) and one over the edges (do its faces disagree). the faces
+ * that look away from the light, the same faces pushed away from it
+ * and a quad along every silhouette edge close a volume that the pvr
+ * can use as a modifier volume, for example to darken anything inside
+ * it with cheap shadows
+ *
+ * ```c
+ * #include "model.h"
+ * #include "obj2h_shadow.h"
+ *
+ * static uint8_t lit[ARRAY_LENGTH(model_faces)];
+ * static int silhouette[ARRAY_LENGTH(model_edges) * 2];
+ * static vector_t volume[OBJ2H_SHADOW_MAX_VERTICES(
+ *     ARRAY_LENGTH(model_faces), ARRAY_LENGTH(model_edges))]
+ * __attribute__((aligned(32)));
+ *
+ * init:
+ *   pvr_mod_compile(&mod, PVR_LIST_OP_MOD, PVR_MODIFIER_OTHER_POLY,
+ *       PVR_CULLING_NONE);
+ *   pvr_mod_compile(&mod_last, PVR_LIST_OP_MOD,
+ *       PVR_MODIFIER_INCLUDE_LAST_POLY, PVR_CULLING_NONE);
+ *
+ * draw, with light in model space:
+ *   obj2h_shadow_facing(model_planes, ARRAY_LENGTH(model_faces), &light,
+ *       lit);
+ *   n = obj2h_shadow_silhouette(model_edges, ARRAY_LENGTH(model_edges),
+ *       lit, silhouette);
+ *   n = obj2h_shadow_volume(model_vertices, model_faces,
+ *       ARRAY_LENGTH(model_faces), lit, silhouette, n, &light, 10,
+ *       volume);
+ *   mat_transform(volume, volume, n * 3, sizeof(vector_t));
+ *
+ *   pvr_list_begin(PVR_LIST_OP_MOD);
+ *   obj2h_shadow_submit(&mod, &mod_last, volume, n);
+ * ```
+ *
+ * light is a position when its w is 1 and a direction towards the light
+ * when it's 0. the planes are for the mesh as exported and their
+ * normals point out of the model. meshes that deform can recompute them
+ * every frame with obj2h_shadow_planes.
+ * faces without a neighbour on an edge (meshes that aren't closed) are
+ * handled by treating the missing face as lit, which still closes the
+ * volume
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#ifndef OBJ2H_SHADOW_H
+#define OBJ2H_SHADOW_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <math.h>
+
+#ifndef OBJ2H_EDGE_TYPES
+#define OBJ2H_EDGE_TYPES
+struct obj2h_edge
+{
+    int vertex_indices[2]; /* in the winding of the first face */
+    int face_indices[2];   /* the second one is -1 on open edges */
+};
+typedef struct obj2h_edge obj2h_edge_t;
+#endif /* !OBJ2H_EDGE_TYPES */
+
+/* room obj2h_shadow_volume needs at most, in vertices */
+#define OBJ2H_SHADOW_MAX_VERTICES(nfaces, nedges) \
+    (((nfaces) * 2 + (nedges) * 2) * 3)
+
+/*
+ * planes of the faces as x, y, z = normal, w = -dot(normal, corner).
+ * flipping y reverses the winding, so the faces obj2h writes go
+ * clockwise seen from outside and the normal is (c - a) x (b - a) to
+ * point out of the model
+ */
+static inline
+void obj2h_shadow_planes(vector_t const* vertices, face_t const* faces,
+    size_t nfaces, vector_t* planes)
+{
+    size_t i;
+
+    for (i = 0; i < nfaces; ++i)
+    {
+        vector_t const* a = &vertices[faces[i].vertex_indices[0]];
+        vector_t const* b = &vertices[faces[i].vertex_indices[1]];
+        vector_t const* c = &vertices[faces[i].vertex_indices[2]];
+        float ux = b->x - a->x, uy = b->y - a->y, uz = b->z - a->z;
+        float vx = c->x - a->x, vy = c->y - a->y, vz = c->z - a->z;
+        float nx = vy * uz - vz * uy;
+        float ny = vz * ux - vx * uz;
+        float nz = vx * uy - vy * ux;
+        float len = sqrtf(nx * nx + ny * ny + nz * nz);
+
+        if (len > 0)
+        {
+            nx /= len;
+            ny /= len;
+            nz /= len;
+        }
+
+        planes[i].x = nx;
+        planes[i].y = ny;
+        planes[i].z = nz;
+        planes[i].w = -(nx * a->x + ny * a->y + nz * a->z);
+    }
+}
+
+/*
+ * sets lit[i] for the faces with the light in front of them, on the
+ * side their outward normal points to, and returns how many there are
+ */
+static inline
+size_t obj2h_shadow_facing(vector_t const* planes, size_t nfaces,
+    vector_t const* light, uint8_t* lit)
+{
+    size_t i, n = 0;
+
+    for (i = 0; i < nfaces; ++i)
+    {
+        vector_t const* p = &planes[i];
+        float d = p->x * light->x + p->y * light->y + p->z * light->z +
+            p->w * light->w;
+
+        lit[i] = d > 0;
+        n += lit[i];
+    }
+
+    return n;
+}
+
+/*
+ * writes the edges between a lit and an unlit face to silhouette as
+ * vertex index pairs, in the winding of the lit face, and returns how
+ * many there are
+ */
+static inline
+size_t obj2h_shadow_silhouette(obj2h_edge_t const* edges, size_t nedges,
+    uint8_t const* lit, int* silhouette)
+{
+    size_t i, n = 0;
+
+    for (i = 0; i < nedges; ++i)
+    {
+        obj2h_edge_t const* e = &edges[i];
+        int lit0 = lit[e->face_indices[0]];
+        int lit1 = e->face_indices[1] < 0 || lit[e->face_indices[1]];
+
+        if (lit0 == lit1) continue;
+
+        silhouette[n * 2] = e->vertex_indices[!lit0];
+        silhouette[n * 2 + 1] = e->vertex_indices[lit0];
+        ++n;
+    }
+
+    return n;
+}
+
+/* v pushed extrude units further from the light */
+static inline
+vector_t obj2h_shadow_extrude(vector_t const* v, vector_t const* light,
+    float extrude)
+{
+    vector_t r;
+    float dx = light->w ? v->x - light->x : -light->x;
+    float dy = light->w ? v->y - light->y : -light->y;
+    float dz = light->w ? v->z - light->z : -light->z;
+    float len = sqrtf(dx * dx + dy * dy + dz * dz);
+    float s = len > 0 ? extrude / len : 0;
+
+    r.x = v->x + dx * s;
+    r.y = v->y + dy * s;
+    r.z = v->z + dz * s;
+    r.w = 1;
+
+    return r;
+}
+
+/*
+ * fills volume with the triangles of the shadow volume in model space,
+ * 3 vertices each, and returns how many triangles there are: the faces
+ * looking away from the light, the same faces extruded and two per
+ * silhouette edge. volume needs OBJ2H_SHADOW_MAX_VERTICES room
+ */
+static inline
+size_t obj2h_shadow_volume(vector_t const* vertices, face_t const* faces,
+    size_t nfaces, uint8_t const* lit, int const* silhouette,
+    size_t nsilhouette, vector_t const* light, float extrude,
+    vector_t* volume)
+{
+    vector_t* out = volume;
+    size_t i;
+    int j;
+
+    for (i = 0; i < nfaces; ++i)
+    {
+        if (lit[i]) continue;
+
+        for (j = 0; j < 3; ++j)
+        {
+            vector_t const* v = &vertices[faces[i].vertex_indices[j]];
+
+            out[j] = *v;
+            out[j].w = 1;
+            out[5 - j] = obj2h_shadow_extrude(v, light, extrude);
+        }
+
+        out += 6;
+    }
+
+    for (i = 0; i < nsilhouette; ++i)
+    {
+        vector_t const* a = &vertices[silhouette[i * 2]];
+        vector_t const* b = &vertices[silhouette[i * 2 + 1]];
+        vector_t ea = obj2h_shadow_extrude(a, light, extrude);
+        vector_t eb = obj2h_shadow_extrude(b, light, extrude);
+
+        /* a to b runs against the unlit face's edge, closing the caps */
+        out[0] = *a;
+        out[1] = *b;
+        out[2] = eb;
+        out[3] = *a;
+        out[4] = eb;
+        out[5] = ea;
+        out[0].w = out[1].w = out[3].w = 1;
+        out += 6;
+    }
+
+    return (size_t)(out - volume) / 3;
+}
+
+#ifdef _arch_dreamcast
+#include <kos.h>
+
+/*
+ * sends n transformed volume triangles to the currently open modifier
+ * list. mod is compiled with PVR_MODIFIER_OTHER_POLY and mod_last with
+ * PVR_MODIFIER_INCLUDE_LAST_POLY, which closes the volume
+ */
+static inline
+void obj2h_shadow_submit(pvr_mod_hdr_t* mod, pvr_mod_hdr_t* mod_last,
+    vector_t const* volume, size_t n)
+{
+    pvr_modifier_vol_t m;
+    size_t i;
+
+    if (!n) return;
+
+    m.flags = PVR_CMD_VERTEX_EOL;
+    m.d1 = m.d2 = m.d3 = m.d4 = m.d5 = m.d6 = 0;
+
+    pvr_prim(mod, sizeof(*mod));
+
+    for (i = 0; i < n; ++i, volume += 3)
+    {
+        if (i == n - 1) pvr_prim(mod_last, sizeof(*mod_last));
+
+        m.ax = volume[0].x;
+        m.ay = volume[0].y;
+        m.az = volume[0].z;
+        m.bx = volume[1].x;
+        m.by = volume[1].y;
+        m.bz = volume[1].z;
+        m.cx = volume[2].x;
+        m.cy = volume[2].y;
+        m.cz = volume[2].z;
+        pvr_prim(&m, sizeof(m));
+    }
+}
+#endif /* _arch_dreamcast */
+
+#endif /* !OBJ2H_SHADOW_H */
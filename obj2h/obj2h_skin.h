@@ -0,0 +1,313 @@
+/*
+ * skeletal animation for skins imported by obj2h from .glb files
+ *
+ * the generated header has, next to the usual arrays:
+ *
+ * - model_skin: joints and weights of every vertex, weights sum to 255
+ * - model_skeleton: joints ordered so parents come before children, with
+ *   their rest pose and inverse bind matrix
+ * - model_clips: animation clips, made of translation, rotation
+ *   (quaternion) and scale channels targeting joints
+ *
+ * ```c
+ * #include "model.h"
+ * #include "obj2h_skin.h"
+ *
+ * static obj2h_joint_pose_t poses[ARRAY_LENGTH(model_joints)];
+ * static float matrices[ARRAY_LENGTH(model_joints)][16];
+ * static vector_t vertices[ARRAY_LENGTH(model_vertices)]
+ * __attribute__((aligned(32)));
+ * static vector_t normals[ARRAY_LENGTH(model_normals)]
+ * __attribute__((aligned(32)));
+ *
+ * obj2h_anim_sample(&model_skeleton, &model_clips[0], time, poses);
+ * obj2h_skin_matrices(&model_skeleton, poses, matrices);
+ * obj2h_skin_apply(model_skin, matrices, model_vertices, vertices,
+ *     model_normals, normals, ARRAY_LENGTH(model_vertices));
+ * ```
+ *
+ * matrices are column major (m[column * 4 + row]) like in gltf and
+ * quaternions are x, y, z, w. everything is already in the y-down space
+ * obj2h writes positions in, normals keep the file's y and so do the
+ * skinned ones
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#ifndef OBJ2H_SKIN_H
+#define OBJ2H_SKIN_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+#ifndef OBJ2H_SKIN_TYPES
+#define OBJ2H_SKIN_TYPES
+enum { OBJ2H_ANIM_TRANSLATION, OBJ2H_ANIM_ROTATION, OBJ2H_ANIM_SCALE };
+enum { OBJ2H_ANIM_LINEAR, OBJ2H_ANIM_STEP };
+struct obj2h_skin_vertex { uint8_t joints[4], weights[4]; };
+typedef struct obj2h_skin_vertex obj2h_skin_vertex_t;
+struct obj2h_joint_pose { float t[3], r[4], s[3]; };
+typedef struct obj2h_joint_pose obj2h_joint_pose_t;
+struct obj2h_joint
+{
+    char const* name;
+    int32_t parent; /* -1 for roots */
+    float inverse_bind[16];
+    obj2h_joint_pose_t rest;
+};
+typedef struct obj2h_joint obj2h_joint_t;
+struct obj2h_skeleton
+{
+    uint32_t njoints;
+    obj2h_joint_t const* joints;
+    float root[16]; /* parent transform of the root joints */
+};
+typedef struct obj2h_skeleton obj2h_skeleton_t;
+struct obj2h_anim_channel
+{
+    uint16_t joint;
+    uint8_t path, interpolation;
+    uint32_t nkeys;
+    uint32_t first_time, first_value; /* into the clip's times, values */
+};
+typedef struct obj2h_anim_channel obj2h_anim_channel_t;
+struct obj2h_anim_clip
+{
+    char const* name;
+    float duration;
+    uint32_t nchannels;
+    obj2h_anim_channel_t const* channels;
+    float const* times;
+    float const* values;
+};
+typedef struct obj2h_anim_clip obj2h_anim_clip_t;
+#endif /* !OBJ2H_SKIN_TYPES */
+
+static inline
+void obj2h_quat_slerp(float const* a, float const* b, float t, float* c)
+{
+    float cos_ = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+    float sign = 1, scale0, scale1;
+    int i;
+
+    /* take the short way around */
+    if (cos_ < 0)
+    {
+        cos_ = -cos_;
+        sign = -1;
+    }
+
+    if (cos_ < 0.999f)
+    {
+        float angle = acosf(cos_);
+        float sin_ = sinf(angle);
+
+        scale0 = sinf((1 - t) * angle) / sin_;
+        scale1 = sinf(t * angle) / sin_;
+    }
+
+    else
+    {
+        scale0 = 1 - t;
+        scale1 = t;
+    }
+
+    for (i = 0; i < 4; ++i) {
+        c[i] = a[i] * scale0 + b[i] * scale1 * sign;
+    }
+}
+
+/* resets poses to the rest pose */
+static inline
+void obj2h_skin_rest(obj2h_skeleton_t const* s, obj2h_joint_pose_t* poses)
+{
+    uint32_t i;
+
+    for (i = 0; i < s->njoints; ++i) {
+        poses[i] = s->joints[i].rest;
+    }
+}
+
+/*
+ * samples clip at time (in seconds, clamped to the clip) into poses.
+ * joints the clip doesn't animate keep their rest pose
+ */
+static inline
+void obj2h_anim_sample(obj2h_skeleton_t const* s,
+    obj2h_anim_clip_t const* clip, float time, obj2h_joint_pose_t* poses)
+{
+    uint32_t i;
+
+    obj2h_skin_rest(s, poses);
+
+    for (i = 0; i < clip->nchannels; ++i)
+    {
+        obj2h_anim_channel_t const* c = &clip->channels[i];
+        float const* times = clip->times + c->first_time;
+        int ncomponents = c->path == OBJ2H_ANIM_ROTATION ? 4 : 3;
+        float const* a;
+        float const* b;
+        float* out;
+        uint32_t lo = 0, hi = c->nkeys - 1;
+        float t = 0;
+        int j;
+
+        if (!c->nkeys) continue;
+
+        /* last key at or before time */
+        while (lo < hi)
+        {
+            uint32_t mid = (lo + hi + 1) / 2;
+            if (times[mid] <= time) lo = mid; else hi = mid - 1;
+        }
+
+        a = clip->values + c->first_value + lo * ncomponents;
+        b = a;
+
+        if (lo + 1 < c->nkeys && time > times[lo])
+        {
+            b = a + ncomponents;
+
+            if (c->interpolation == OBJ2H_ANIM_LINEAR) {
+                t = (time - times[lo]) / (times[lo + 1] - times[lo]);
+            }
+        }
+
+        switch (c->path)
+        {
+        case OBJ2H_ANIM_TRANSLATION: out = poses[c->joint].t; break;
+        case OBJ2H_ANIM_ROTATION: out = poses[c->joint].r; break;
+        default: out = poses[c->joint].s; break;
+        }
+
+        if (c->path == OBJ2H_ANIM_ROTATION) {
+            obj2h_quat_slerp(a, b, t, out);
+        } else {
+            for (j = 0; j < 3; ++j) out[j] = a[j] + (b[j] - a[j]) * t;
+        }
+    }
+}
+
+/* m = a * b, column major */
+static inline
+void obj2h_mat_mul(float const* a, float const* b, float* m)
+{
+    int c, r;
+
+    for (c = 0; c < 4; ++c)
+    {
+        for (r = 0; r < 4; ++r)
+        {
+            m[c * 4 + r] = a[r] * b[c * 4] + a[4 + r] * b[c * 4 + 1] +
+                a[8 + r] * b[c * 4 + 2] + a[12 + r] * b[c * 4 + 3];
+        }
+    }
+}
+
+/* translation * rotation * scale */
+static inline
+void obj2h_pose_matrix(obj2h_joint_pose_t const* p, float* m)
+{
+    float x = p->r[0], y = p->r[1], z = p->r[2], w = p->r[3];
+
+    m[0] = (1 - 2 * (y * y + z * z)) * p->s[0];
+    m[1] = 2 * (x * y + w * z) * p->s[0];
+    m[2] = 2 * (x * z - w * y) * p->s[0];
+    m[3] = 0;
+
+    m[4] = 2 * (x * y - w * z) * p->s[1];
+    m[5] = (1 - 2 * (x * x + z * z)) * p->s[1];
+    m[6] = 2 * (y * z + w * x) * p->s[1];
+    m[7] = 0;
+
+    m[8] = 2 * (x * z + w * y) * p->s[2];
+    m[9] = 2 * (y * z - w * x) * p->s[2];
+    m[10] = (1 - 2 * (x * x + y * y)) * p->s[2];
+    m[11] = 0;
+
+    m[12] = p->t[0];
+    m[13] = p->t[1];
+    m[14] = p->t[2];
+    m[15] = 1;
+}
+
+/*
+ * turns poses into skinning matrices (global transform times inverse
+ * bind matrix). matrices doubles as storage for the global transforms,
+ * which is fine because parents come first
+ */
+static inline
+void obj2h_skin_matrices(obj2h_skeleton_t const* s,
+    obj2h_joint_pose_t const* poses, float (*matrices)[16])
+{
+    float local[16];
+    uint32_t i;
+
+    for (i = 0; i < s->njoints; ++i)
+    {
+        int32_t parent = s->joints[i].parent;
+
+        obj2h_pose_matrix(&poses[i], local);
+        obj2h_mat_mul(parent < 0 ? s->root : matrices[parent], local,
+            matrices[i]);
+    }
+
+    /* every global is known, now the inverse bind matrices go in */
+    for (i = 0; i < s->njoints; ++i)
+    {
+        memcpy(local, matrices[i], sizeof(local));
+        obj2h_mat_mul(local, s->joints[i].inverse_bind, matrices[i]);
+    }
+}
+
+/*
+ * linear blend skinning of n vertices (and normals, which share the
+ * vertex indices, unless null). w of the outputs is 1 and 0. normals
+ * are flipped into y down and back around the matrices
+ */
+static inline
+void obj2h_skin_apply(obj2h_skin_vertex_t const* skin,
+    float (*matrices)[16], vector_t const* vertices, vector_t* out,
+    vector_t const* normals, vector_t* out_normals, size_t n)
+{
+    size_t i;
+    int j;
+
+    for (i = 0; i < n; ++i)
+    {
+        vector_t const* v = &vertices[i];
+        vector_t p = { 0, 0, 0, 1 };
+        vector_t q = { 0, 0, 0, 0 };
+
+        for (j = 0; j < 4; ++j)
+        {
+            float const* m = matrices[skin[i].joints[j]];
+            float w = skin[i].weights[j] * (1.0f / 255);
+
+            if (!skin[i].weights[j]) continue;
+
+            p.x += w * (m[0] * v->x + m[4] * v->y + m[8] * v->z + m[12]);
+            p.y += w * (m[1] * v->x + m[5] * v->y + m[9] * v->z + m[13]);
+            p.z += w * (m[2] * v->x + m[6] * v->y + m[10] * v->z + m[14]);
+
+            if (normals)
+            {
+                vector_t const* nv = &normals[i];
+                q.x += w * (m[0] * nv->x - m[4] * nv->y + m[8] * nv->z);
+                q.y -= w * (m[1] * nv->x - m[5] * nv->y + m[9] * nv->z);
+                q.z += w * (m[2] * nv->x - m[6] * nv->y + m[10] * nv->z);
+            }
+        }
+
+        out[i] = p;
+        if (normals) out_normals[i] = q;
+    }
+}
+
+#endif /* !OBJ2H_SKIN_H */
@@ -0,0 +1,492 @@
+/*
+ * compressed mesh blobs as emitted by obj2h --zblob and a streaming
+ * decoder that's cheap enough to run on the sh4 while reading from disc
+ *
+ * attributes are quantized and delta coded, then split into blocks of
+ * up to a few thousand elements that are compressed independently with
+ * a small lz77 variant. the decoder only ever holds one block in memory
+ * on top of the output arrays, so it can decode as data comes in
+ *
+ * layout (little endian):
+ *
+ * ```
+ * header    32 bytes, see obj2h_zblob_header_t
+ * sections  nsections * 40 bytes, see obj2h_zblob_section_t
+ * blocks    for each section in order, ceil(count / block_count) times:
+ *           obj2h_zblob_block_t followed by packed_size bytes
+ * ```
+ *
+ * block contents before lz, n being the number of elements in the block.
+ * delta coding restarts at zero in every block and deltas are zigzag
+ * encoded (0, -1, 1, -2, ... -> 0, 1, 2, 3, ...)
+ *
+ * - vertices, uvs: 16-bit quantized in the section's bounds, one plane
+ *   of n low bytes and one of n high bytes per component.
+ *   value = bias + q * scale
+ * - normals: 8-bit snorm, one plane of n bytes per component
+ * - colors (since 1.1): ARGB8888, one plane of n bytes per channel from
+ *   blue to alpha
+ * - faces: index + 1 as varints (7 bits per byte, high bit = more), in
+ *   face_t order, each delta coded against the previous index of the
+ *   same kind
+ *
+ * ```c
+ * #include "obj2h_zblob.h"
+ *
+ * obj2h_mesh_t monkey;
+ *
+ * if (obj2h_zblob_load("/cd/monkey.z", &monkey)) {
+ *     ... error ...
+ * }
+ *
+ * ...
+ *
+ * obj2h_zblob_free(&monkey);
+ * ```
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#ifndef OBJ2H_ZBLOB_H
+#define OBJ2H_ZBLOB_H
+
+#include "obj2h_blob.h"
+
+#include <stdlib.h>
+#include <malloc.h>
+
+#define OBJ2H_ZBLOB_MAGIC "O2HZ"
+#define OBJ2H_ZBLOB_VERSION_MAJOR 1
+#define OBJ2H_ZBLOB_VERSION_MINOR 1
+#define OBJ2H_ZBLOB_MAX_SECTIONS 16
+
+/* set on packed_size when the block didn't compress and is stored */
+#define OBJ2H_ZBLOB_STORED 0x80000000
+
+/* lz sequences: token, literals, 16-bit offset, extra match length */
+#define OBJ2H_LZ_MIN_MATCH 4
+
+struct obj2h_zblob_header
+{
+    char magic[4];
+    uint16_t version_major;
+    uint16_t version_minor;
+    uint32_t size;             /* total size in bytes */
+    uint32_t nsections;
+    uint32_t max_raw_block;    /* largest block before lz */
+    uint32_t max_packed_block; /* largest block after lz */
+    uint32_t raw_size;         /* size of the decoded arrays */
+    uint32_t reserved;
+};
+
+typedef struct obj2h_zblob_header obj2h_zblob_header_t;
+
+struct obj2h_zblob_section
+{
+    uint32_t type;        /* same as enum obj2h_blob_section_type */
+    uint32_t count;       /* number of elements */
+    uint32_t block_count; /* elements per block */
+    uint32_t reserved;
+    float bias[3];        /* dequantization, unused for normals/faces */
+    float scale[3];
+};
+
+typedef struct obj2h_zblob_section obj2h_zblob_section_t;
+
+struct obj2h_zblob_block
+{
+    uint32_t packed_size; /* may have OBJ2H_ZBLOB_STORED set */
+    uint32_t raw_size;
+};
+
+typedef struct obj2h_zblob_block obj2h_zblob_block_t;
+
+/*
+ * decodes one lz block. returns non-zero if the data is corrupt or
+ * doesn't decode to exactly dst_size bytes
+ */
+static inline
+int obj2h_lz_decode(uint8_t const* src, size_t src_size, uint8_t* dst,
+    size_t dst_size)
+{
+    uint8_t const* src_end = src + src_size;
+    uint8_t* dst_start = dst;
+    uint8_t* dst_end = dst + dst_size;
+
+    while (src < src_end)
+    {
+        size_t lit, len, off, extra;
+        unsigned token = *src++;
+
+        lit = token >> 4;
+        if (lit == 15)
+        {
+            do {
+                if (src >= src_end) return 1;
+                extra = *src++;
+                lit += extra;
+            } while (extra == 255);
+        }
+
+        if (lit > (size_t)(src_end - src)) return 1;
+        if (lit > (size_t)(dst_end - dst)) return 1;
+        memcpy(dst, src, lit);
+        src += lit;
+        dst += lit;
+
+        if (src >= src_end) break;
+
+        if (src_end - src < 2) return 1;
+        off = src[0] | (src[1] << 8);
+        src += 2;
+
+        len = (token & 15) + OBJ2H_LZ_MIN_MATCH;
+        if ((token & 15) == 15)
+        {
+            do {
+                if (src >= src_end) return 1;
+                extra = *src++;
+                len += extra;
+            } while (extra == 255);
+        }
+
+        if (!off || off > (size_t)(dst - dst_start)) return 1;
+        if (len > (size_t)(dst_end - dst)) return 1;
+
+        /* matches can overlap their own output so copy bytewise */
+        {
+            uint8_t const* m = dst - off;
+            while (len--) *dst++ = *m++;
+        }
+    }
+
+    return dst != dst_end;
+}
+
+#ifndef OBJ2H_TYPES
+#define OBJ2H_TYPES
+struct face { int vertex_indices[3], uv_indices[3], normal_indices[3]; };
+typedef struct face face_t;
+struct uv { float u, v; };
+typedef struct uv uv_t;
+#endif /* !OBJ2H_TYPES */
+
+static inline
+int obj2h_unzigzag(unsigned x)
+{
+    return (int)(x >> 1) ^ -(int)(x & 1);
+}
+
+/* dequantizes n elements of a raw block into dst */
+static inline
+int obj2h_zblob_unpack(obj2h_zblob_section_t const* s, uint8_t const* raw,
+    size_t raw_size, size_t n, void* dst)
+{
+    size_t i, j;
+
+    switch (s->type)
+    {
+    case OBJ2H_BLOB_VERTICES:
+    case OBJ2H_BLOB_UVS:
+    {
+        size_t ncomp = s->type == OBJ2H_BLOB_UVS ? 2 : 3;
+        float* out = dst;
+        size_t stride = s->type == OBJ2H_BLOB_UVS ? 2 : 4;
+
+        if (raw_size != n * ncomp * 2) return 1;
+
+        for (j = 0; j < ncomp; ++j)
+        {
+            uint8_t const* lo = raw + n * j * 2;
+            uint8_t const* hi = lo + n;
+            unsigned q = 0;
+
+            for (i = 0; i < n; ++i)
+            {
+                q += obj2h_unzigzag(lo[i] | (hi[i] << 8));
+                q &= 0xFFFF;
+                out[i * stride + j] = s->bias[j] + q * s->scale[j];
+            }
+        }
+
+        if (stride == 4) {
+            for (i = 0; i < n; ++i) out[i * 4 + 3] = 1;
+        }
+
+        break;
+    }
+
+    case OBJ2H_BLOB_NORMALS:
+    {
+        float* out = dst;
+
+        if (raw_size != n * 3) return 1;
+
+        for (j = 0; j < 3; ++j)
+        {
+            uint8_t const* p = raw + n * j;
+            unsigned q = 0;
+
+            for (i = 0; i < n; ++i)
+            {
+                q += obj2h_unzigzag(p[i]);
+                q &= 0xFF;
+                out[i * 4 + j] = (int8_t)q * (1.0f / 127);
+            }
+        }
+
+        for (i = 0; i < n; ++i) out[i * 4 + 3] = 0;
+
+        break;
+    }
+
+    case OBJ2H_BLOB_COLORS:
+    {
+        uint32_t* out = dst;
+
+        if (raw_size != n * 4) return 1;
+
+        for (i = 0; i < n; ++i) out[i] = 0;
+
+        for (j = 0; j < 4; ++j)
+        {
+            uint8_t const* p = raw + n * j;
+            unsigned q = 0;
+
+            for (i = 0; i < n; ++i)
+            {
+                q += obj2h_unzigzag(p[i]);
+                q &= 0xFF;
+                out[i] |= (uint32_t)q << (j * 8);
+            }
+        }
+
+        break;
+    }
+
+    case OBJ2H_BLOB_FACES:
+    {
+        int* out = dst;
+        uint8_t const* end = raw + raw_size;
+        int prev[3] = { 0, 0, 0 };
+
+        for (i = 0; i < n * 9; ++i)
+        {
+            unsigned x = 0, shift = 0, b;
+
+            do {
+                if (raw >= end || shift > 28) return 1;
+                b = *raw++;
+                x |= (b & 0x7F) << shift;
+                shift += 7;
+            } while (b & 0x80);
+
+            prev[i % 9 / 3] += obj2h_unzigzag(x);
+            out[i] = prev[i % 9 / 3] - 1;
+        }
+
+        if (raw != end) return 1;
+
+        break;
+    }
+    }
+
+    return 0;
+}
+
+/* reads exactly size bytes into dst, returns non-zero on failure */
+typedef int obj2h_zblob_read_t(void* user, void* dst, size_t size);
+
+static inline
+void obj2h_zblob_free(obj2h_mesh_t* m)
+{
+    free(m->vertices);
+    free(m->normals);
+    free(m->uvs);
+    free(m->faces);
+    free(m->colors);
+    memset(m, 0, sizeof(*m));
+}
+
+/*
+ * decodes a compressed blob as it's read. output arrays are allocated
+ * 32-byte aligned and must be released with obj2h_zblob_free
+ */
+static inline
+int obj2h_zblob_decode(obj2h_zblob_read_t* read, void* user,
+    obj2h_mesh_t* m)
+{
+    obj2h_zblob_header_t h;
+    obj2h_zblob_section_t sections[OBJ2H_ZBLOB_MAX_SECTIONS];
+    uint8_t* packed = 0;
+    uint8_t* raw = 0;
+    uint32_t i, j;
+    int err = 1;
+
+    memset(m, 0, sizeof(*m));
+
+    if (read(user, &h, sizeof(h))) return 1;
+    if (memcmp(h.magic, OBJ2H_ZBLOB_MAGIC, 4)) return 1;
+    if (h.version_major != OBJ2H_ZBLOB_VERSION_MAJOR) return 1;
+    if (h.nsections > OBJ2H_ZBLOB_MAX_SECTIONS) return 1;
+    if (read(user, sections, sizeof(sections[0]) * h.nsections)) return 1;
+
+    packed = malloc(h.max_packed_block + 1);
+    raw = malloc(h.max_raw_block + 1);
+    if (!packed || !raw) goto done;
+
+    for (i = 0; i < h.nsections; ++i)
+    {
+        obj2h_zblob_section_t const* s = &sections[i];
+        char* dst = 0;
+        size_t stride = 0;
+
+        switch (s->type)
+        {
+        case OBJ2H_BLOB_VERTICES: stride = sizeof(vector_t); break;
+        case OBJ2H_BLOB_NORMALS:  stride = sizeof(vector_t); break;
+        case OBJ2H_BLOB_UVS:      stride = sizeof(uv_t);     break;
+        case OBJ2H_BLOB_FACES:    stride = sizeof(face_t);   break;
+        case OBJ2H_BLOB_COLORS:   stride = sizeof(uint32_t); break;
+        }
+
+        if (stride && s->count)
+        {
+            dst = memalign(OBJ2H_BLOB_ALIGN, stride * s->count);
+            if (!dst) goto done;
+        }
+
+        switch (s->type)
+        {
+        case OBJ2H_BLOB_VERTICES:
+            m->vertices = (vector_t*)dst;
+            m->nvertices = s->count;
+            break;
+
+        case OBJ2H_BLOB_NORMALS:
+            m->normals = (vector_t*)dst;
+            m->nnormals = s->count;
+            break;
+
+        case OBJ2H_BLOB_UVS:
+            m->uvs = (uv_t*)dst;
+            m->nuvs = s->count;
+            break;
+
+        case OBJ2H_BLOB_FACES:
+            m->faces = (face_t*)dst;
+            m->nfaces = s->count;
+            break;
+
+        case OBJ2H_BLOB_COLORS:
+            m->colors = (uint32_t*)dst;
+            m->ncolors = s->count;
+            break;
+        }
+
+        if (s->count && !s->block_count) goto done;
+
+        for (j = 0; j < s->count; j += s->block_count)
+        {
+            obj2h_zblob_block_t b;
+            size_t n = s->count - j;
+            size_t packed_size;
+
+            if (n > s->block_count) n = s->block_count;
+
+            if (read(user, &b, sizeof(b))) goto done;
+            packed_size = b.packed_size & ~OBJ2H_ZBLOB_STORED;
+
+            if (packed_size > h.max_packed_block) goto done;
+            if (b.raw_size > h.max_raw_block) goto done;
+            if (read(user, packed, packed_size)) goto done;
+
+            if (b.packed_size & OBJ2H_ZBLOB_STORED)
+            {
+                if (packed_size != b.raw_size) goto done;
+                memcpy(raw, packed, packed_size);
+            }
+
+            else if (obj2h_lz_decode(packed, packed_size, raw, b.raw_size)) {
+                goto done;
+            }
+
+            /* unknown sections are decoded and dropped */
+            if (dst && obj2h_zblob_unpack(s, raw, b.raw_size, n,
+                    dst + j * stride))
+            {
+                goto done;
+            }
+        }
+    }
+
+    err = 0;
+
+done:
+    free(packed);
+    free(raw);
+    if (err) obj2h_zblob_free(m);
+
+    return err;
+}
+
+struct obj2h_zblob_mem { uint8_t const* p; size_t left; };
+typedef struct obj2h_zblob_mem obj2h_zblob_mem_t;
+
+static inline
+int obj2h_zblob_read_mem(void* user, void* dst, size_t size)
+{
+    obj2h_zblob_mem_t* mem = user;
+
+    if (size > mem->left) return 1;
+    memcpy(dst, mem->p, size);
+    mem->p += size;
+    mem->left -= size;
+
+    return 0;
+}
+
+/* decodes a compressed blob that's already entirely in memory */
+static inline
+int obj2h_zblob_decode_mem(void const* data, size_t size, obj2h_mesh_t* m)
+{
+    obj2h_zblob_mem_t mem;
+
+    mem.p = data;
+    mem.left = size;
+
+    return obj2h_zblob_decode(obj2h_zblob_read_mem, &mem, m);
+}
+
+#ifdef _arch_dreamcast
+static inline
+int obj2h_zblob_read_file(void* user, void* dst, size_t size)
+{
+    return fs_read(*(file_t*)user, dst, size) != (ssize_t)size;
+}
+
+/*
+ * streams a compressed blob from the filesystem, decoding each block
+ * right after it's read
+ */
+static inline
+int obj2h_zblob_load(char const* path, obj2h_mesh_t* m)
+{
+    file_t f;
+    int err;
+
+    f = fs_open(path, O_RDONLY);
+    if (f == FILEHND_INVALID) return 1;
+
+    err = obj2h_zblob_decode(obj2h_zblob_read_file, &f, m);
+    fs_close(f);
+
+    return err;
+}
+#endif /* _arch_dreamcast */
+
+#endif /* !OBJ2H_ZBLOB_H */
@@ -0,0 +1,86 @@
+/*
+ * rays along an axis that start on a face of a node's box, where the
+ * slab test used to compute 0 * inf. the face is the triangle's edge,
+ * which moller-trumbore counts as a hit, so every ray has to find it
+ * with either sign of zero in its direction
+ *
+ * ```sh
+ * gcc tests/bvh_slab.c -o bvh_slab -lm && ./bvh_slab
+ * ```
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#include <stdio.h>
+
+struct vector { float x, y, z, w; };
+typedef struct vector vector_t;
+struct face { int vertex_indices[3], uv_indices[3], normal_indices[3]; };
+typedef struct face face_t;
+
+#include "../obj2h_bvh.h"
+
+static vector_t const vertices[] = {
+    { 0, 0, 1, 1 }, { 2, 0, 1, 1 }, { 0, 2, 1, 1 },
+};
+
+static face_t const faces[] = {
+    { { 0, 1, 2 }, { -1, -1, -1 }, { -1, -1, -1 } },
+};
+
+/* both children are the one face, boxed as tightly as it gets */
+static obj2h_bvh_node_t const nodes[] = {
+    {
+        { { 0, 0, 0, 2, 2, 0 }, { 0, 0, 0, 2, 2, 0 } },
+        { OBJ2H_BVH_LEAF | 0 << 4 | 1, OBJ2H_BVH_LEAF | 0 << 4 | 1 },
+    },
+};
+
+static uint32_t const indices[] = { 0 };
+
+static obj2h_bvh_t const bvh = {
+    { 0, 0, 1 }, { 1, 1, 1 }, 1, nodes, indices,
+};
+
+struct ray { vector_t o, d; int face; };
+
+static struct ray const rays[] = {
+    /* on the min y face, going up and down z */
+    { { 1, 0, 0, 1 }, { 0, 0, 1, 0 }, 0 },
+    { { 1, 0, 0, 1 }, { 0, -0.0f, 1, 0 }, 0 },
+    { { 1, 0, 2, 1 }, { -0.0f, -0.0f, -1, 0 }, 0 },
+    /* on the min x face */
+    { { 0, 1, 0, 1 }, { -0.0f, 0, 1, 0 }, 0 },
+    /* on the max x face, at a corner of the face */
+    { { 2, 0, 0, 1 }, { -0.0f, 0, 1, 0 }, 0 },
+    /* next to the box and parallel to the face, a miss */
+    { { -1, 1, 0, 1 }, { -0.0f, 0, 1, 0 }, -1 },
+};
+
+int main()
+{
+    size_t i;
+    int failed = 0;
+
+    for (i = 0; i < sizeof(rays) / sizeof(rays[0]); ++i)
+    {
+        float t = -1;
+        int face = obj2h_bvh_raycast(&bvh, vertices, faces, &rays[i].o,
+            &rays[i].d, 10, &t);
+
+        if (face != rays[i].face || (face >= 0 && t != 1))
+        {
+            printf("ray %zd: face %d at %g, expected %d at 1\n", i, face, t,
+                rays[i].face);
+            failed = 1;
+        }
+    }
+
+    if (!failed) puts("ok");
+
+    return failed;
+}
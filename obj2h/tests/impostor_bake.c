@@ -0,0 +1,95 @@
+/*
+ * bakes a model that only has a face on its +x side and checks the view
+ * from +z, which the demos' camera sees with +x on the right, has it in
+ * the right half of its cell. obj2h_impostor_quad puts u0 on the left,
+ * so a mirrored bake shows every billboard flipped
+ *
+ * ```sh
+ * gcc -DOBJ2H_NO_MAIN tests/impostor_bake.c obj2h.c -o impostor_bake \
+ *     -lm -pthread && ./impostor_bake
+ * ```
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../obj2h.h"
+
+/* the unused vertex keeps the bounding sphere centered on the origin */
+static char const model[] =
+    "v -1 0 0\n"
+    "v 0.2 -1 0\n"
+    "v 1 -1 0\n"
+    "v 1 1 0\n"
+    "f 2 3 4\n";
+
+int main()
+{
+    static char* args[] = { "--impostor", "4", "--impostor-size", "16" };
+    obj2h_t* o = obj2h_create();
+    char const* header;
+    char* text;
+    char* p;
+    size_t size, i;
+    unsigned long width, height, cell;
+    unsigned long left = 0, right = 0;
+
+    if (!o || obj2h_options(o, 4, args) ||
+        obj2h_convert(o, "model.obj", model, sizeof(model) - 1))
+    {
+        puts("conversion failed");
+        return 1;
+    }
+
+    header = obj2h_output(o, &size);
+    text = malloc(size + 1);
+    if (!text) return 1;
+    memcpy(text, header, size);
+    text[size] = 0;
+
+    p = strstr(text, "model_impostor = {");
+    if (!p || sscanf(p, "model_impostor = { %lu, %lu, %lu,", &width,
+        &height, &cell) != 3)
+    {
+        puts("no model_impostor");
+        return 1;
+    }
+
+    /* view 0 looks from +z and sits in the top left cell */
+    p = strstr(text, "model_impostor_color[]");
+    p = p ? strchr(p, '{') : 0;
+
+    for (i = 0; p && i < width * height; ++i)
+    {
+        unsigned long texel = strtoul(p + 1, &p, 16);
+
+        if (i % width < cell && i / width < cell && texel & 0x8000)
+        {
+            if (i % width < cell / 2) ++left;
+            else ++right;
+        }
+
+        p = strchr(p, ',');
+    }
+
+    free(text);
+    obj2h_destroy(o);
+
+    if (!right || left)
+    {
+        printf("view 0: %lu texels on the left, %lu on the right\n", left,
+            right);
+        return 1;
+    }
+
+    puts("ok");
+
+    return 0;
+}
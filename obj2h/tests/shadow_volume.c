@@ -0,0 +1,141 @@
+/*
+ * a tetrahedron wound counterclockwise seen from outside, the way obj
+ * files have it, with y flipped and the faces kept as obj2h writes them.
+ * lights on a known side of it have to light the faces on that side,
+ * and the volume has to come out closed with every triangle wound the
+ * same way, so every edge is crossed once in each direction
+ *
+ * ```sh
+ * gcc tests/shadow_volume.c -o shadow_volume -lm && ./shadow_volume
+ * ```
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+struct vector { float x, y, z, w; };
+typedef struct vector vector_t;
+struct face { int vertex_indices[3], uv_indices[3], normal_indices[3]; };
+typedef struct face face_t;
+
+#include "../obj2h_shadow.h"
+
+#define NFACES 4
+#define NEDGES 6
+
+/* (0, 0, 0), (1, 0, 0), (0, 1, 0), (0, 0, 1) in the file */
+static vector_t const vertices[] = {
+    { 0, 0, 0, 1 }, { 1, 0, 0, 1 }, { 0, -1, 0, 1 }, { 0, 0, 1, 1 },
+};
+
+/* the z = 0, y = 0, x = 0 and slanted faces */
+static face_t const faces[NFACES] = {
+    { { 0, 2, 1 }, { -1, -1, -1 }, { -1, -1, -1 } },
+    { { 0, 1, 3 }, { -1, -1, -1 }, { -1, -1, -1 } },
+    { { 0, 3, 2 }, { -1, -1, -1 }, { -1, -1, -1 } },
+    { { 1, 2, 3 }, { -1, -1, -1 }, { -1, -1, -1 } },
+};
+
+static obj2h_edge_t const edges[NEDGES] = {
+    { { 0, 2 }, { 0, 2 } },
+    { { 2, 1 }, { 0, 3 } },
+    { { 1, 0 }, { 0, 1 } },
+    { { 1, 3 }, { 1, 3 } },
+    { { 3, 0 }, { 1, 2 } },
+    { { 3, 2 }, { 2, 3 } },
+};
+
+struct light { vector_t l; uint8_t lit[NFACES]; };
+
+static struct light const lights[] = {
+    /* in front of the z = 0 face, as a point and as a direction */
+    { { 0.2f, -0.2f, -5, 1 }, { 1, 0, 0, 0 } },
+    { { 0, 0, -1, 0 }, { 1, 0, 0, 0 } },
+    /* out along the slanted face's normal, y flipped */
+    { { 1, -1, 1, 0 }, { 0, 0, 0, 1 } },
+    /* below the y = 0 face, which is now above it */
+    { { 0.1f, 3, 0.1f, 1 }, { 0, 1, 0, 0 } },
+};
+
+static
+int same(vector_t const* a, vector_t const* b)
+{
+    return a->x == b->x && a->y == b->y && a->z == b->z;
+}
+
+/* how many triangles have an edge going from a to b */
+static
+int directed(vector_t const* volume, size_t n, vector_t const* a,
+    vector_t const* b)
+{
+    size_t i;
+    int j, count = 0;
+
+    for (i = 0; i < n; ++i)
+    {
+        for (j = 0; j < 3; ++j)
+        {
+            count += same(&volume[i * 3 + j], a) &&
+                same(&volume[i * 3 + (j + 1) % 3], b);
+        }
+    }
+
+    return count;
+}
+
+int main()
+{
+    static vector_t volume[OBJ2H_SHADOW_MAX_VERTICES(NFACES, NEDGES)];
+    vector_t planes[NFACES];
+    uint8_t lit[NFACES];
+    int silhouette[NEDGES * 2];
+    size_t i, j, n;
+    int k, failed = 0;
+
+    obj2h_shadow_planes(vertices, faces, NFACES, planes);
+
+    for (i = 0; i < sizeof(lights) / sizeof(lights[0]); ++i)
+    {
+        obj2h_shadow_facing(planes, NFACES, &lights[i].l, lit);
+
+        if (memcmp(lit, lights[i].lit, NFACES))
+        {
+            printf("light %zd: lit %d %d %d %d, expected %d %d %d %d\n", i,
+                lit[0], lit[1], lit[2], lit[3], lights[i].lit[0],
+                lights[i].lit[1], lights[i].lit[2], lights[i].lit[3]);
+            failed = 1;
+            continue;
+        }
+
+        n = obj2h_shadow_silhouette(edges, NEDGES, lit, silhouette);
+        n = obj2h_shadow_volume(vertices, faces, NFACES, lit, silhouette,
+            n, &lights[i].l, 10, volume);
+
+        for (j = 0; j < n; ++j)
+        {
+            for (k = 0; k < 3; ++k)
+            {
+                vector_t const* a = &volume[j * 3 + k];
+                vector_t const* b = &volume[j * 3 + (k + 1) % 3];
+
+                if (directed(volume, n, a, b) != 1 ||
+                    directed(volume, n, b, a) != 1)
+                {
+                    printf("light %zd: triangle %zd isn't closed off on "
+                        "edge %d\n", i, j, k);
+                    failed = 1;
+                }
+            }
+        }
+    }
+
+    if (!failed) puts("ok");
+
+    return failed;
+}
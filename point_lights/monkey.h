@@ -1,7986 +0,0 @@
-/* this file was generated by obj2h 1.0.0 */
-
-#ifndef OBJ2H_TYPES
-#define OBJ2H_TYPES
-struct face { int vertex_indices[3], uv_indices[3], normal_indices[3]; };
-typedef struct face face_t;
-struct uv { float u, v; };
-typedef struct uv uv_t;
-#endif /* !OBJ2H_TYPES */
-
-static vector_t monkey_vertices[]
-__attribute__((aligned(32))) = {
-    { 0.47724100947380066, -0.20572899281978607, 0.67691999673843384, 1 },
-    { -0.50713402032852173, -0.20572899281978607, 0.67691999673843384, 1 },
-    { 0.54364800453186035, -0.17838600277900696, 0.58121699094772339, 1 },
-    { -0.57353997230529785, -0.17838600277900696, 0.58121699094772339, 1 },
-    { 0.42255398631095886, -0.059245001524686813, 0.60660701990127563, 1 },
-    { -0.45244601368904114, -0.059245001524686813, 0.60660701990127563, 1 },
-    { 0.39520999789237976, -0.12565100193023682, 0.69449800252914429, 1 },
-    { -0.42510199546813965, -0.12565100193023682, 0.69449800252914429, 1 },
-    { 0.2799760103225708, -0.12565100193023682, 0.71598201990127563, 1 },
-    { -0.30986800789833069, -0.12565100193023682, 0.71598201990127563, 1 },
-    { 0.25067898631095886, -0.059245001524686813, 0.63785701990127563, 1 },
-    { -0.28057101368904114, -0.059245001524686813, 0.63785701990127563, 1 },
-    { 0.12958499789237976, -0.17838600277900696, 0.65348201990127563, 1 },
-    { -0.15947699546813965, -0.17838600277900696, 0.65348201990127563, 1 },
-    { 0.19989800453186035, -0.20572899281978607, 0.72574800252914429, 1 },
-    { -0.22979000210762024, -0.20572899281978607, 0.72574800252914429, 1 },
-    { 0.19989800453186035, -0.32096400856971741, 0.72574800252914429, 1 },
-    { -0.22979000210762024, -0.32096400856971741, 0.72574800252914429, 1 },
-    { 0.12958499789237976, -0.34830799698829651, 0.65348201990127563, 1 },
-    { -0.15947699546813965, -0.34830799698829651, 0.65348201990127563, 1 },
-    { 0.25067898631095886, -0.46940100193023682, 0.63785701990127563, 1 },
-    { -0.28057101368904114, -0.46940100193023682, 0.63785701990127563, 1 },
-    { 0.2799760103225708, -0.40299499034881592, 0.71598201990127563, 1 },
-    { -0.30986800789833069, -0.40299499034881592, 0.71598201990127563, 1 },
-    { 0.39520999789237976, -0.40299499034881592, 0.69449800252914429, 1 },
-    { -0.42510199546813965, -0.40299499034881592, 0.69449800252914429, 1 },
-    { 0.42255398631095886, -0.46940100193023682, 0.60660701990127563, 1 },
-    { -0.45244601368904114, -0.46940100193023682, 0.60660701990127563, 1 },
-    { 0.54364800453186035, -0.34830799698829651, 0.58121699094772339, 1 },
-    { -0.57353997230529785, -0.34830799698829651, 0.58121699094772339, 1 },
-    { 0.47724100947380066, -0.32096400856971741, 0.67691999673843384, 1 },
-    { -0.50713402032852173, -0.32096400856971741, 0.67691999673843384, 1 },
-    { 0.44208499789237976, -0.30729201436042786, 0.72574800252914429, 1 },
-    { -0.47197699546813965, -0.30729201436042786, 0.72574800252914429, 1 },
-    { 0.38153800368309021, -0.36979201436042786, 0.73941999673843384, 1 },
-    { -0.4114300012588501, -0.36979201436042786, 0.73941999673843384, 1 },
-    { 0.2956010103225708, -0.36979201436042786, 0.75699800252914429, 1 },
-    { -0.32549300789833069, -0.36979201436042786, 0.75699800252914429, 1 },
-    { 0.23700700700283051, -0.30729201436042786, 0.76481002569198608, 1 },
-    { -0.2668989896774292, -0.30729201436042786, 0.76481002569198608, 1 },
-    { 0.23700700700283051, -0.22135399281978607, 0.76481002569198608, 1 },
-    { -0.2668989896774292, -0.22135399281978607, 0.76481002569198608, 1 },
-    { 0.2956010103225708, -0.16276100277900696, 0.75699800252914429, 1 },
-    { -0.32549300789833069, -0.16276100277900696, 0.75699800252914429, 1 },
-    { 0.38153800368309021, -0.16276100277900696, 0.73941999673843384, 1 },
-    { -0.4114300012588501, -0.16276100277900696, 0.73941999673843384, 1 },
-    { 0.44208499789237976, -0.22135399281978607, 0.72574800252914429, 1 },
-    { -0.47197699546813965, -0.22135399281978607, 0.72574800252914429, 1 },
-    { 0.40953299403190613, -0.23372399806976318, 0.75048798322677612, 1 },
-    { -0.43942499160766602, -0.23372399806976318, 0.75048798322677612, 1 },
-    { 0.36786600947380066, -0.19205799698829651, 0.76090401411056519, 1 },
-    { -0.39775899052619934, -0.19205799698829651, 0.76090401411056519, 1 },
-    { 0.30797100067138672, -0.19205799698829651, 0.77392500638961792, 1 },
-    { -0.33786299824714661, -0.19205799698829651, 0.77392500638961792, 1 },
-    { 0.26630398631095886, -0.23372399806976318, 0.77913302183151245, 1 },
-    { -0.29619601368904114, -0.23372399806976318, 0.77913302183151245, 1 },
-    { 0.26630398631095886, -0.29361999034881592, 0.77913302183151245, 1 },
-    { -0.29619601368904114, -0.29361999034881592, 0.77913302183151245, 1 },
-    { 0.30797100067138672, -0.33789101243019104, 0.77392500638961792, 1 },
-    { -0.33786299824714661, -0.33789101243019104, 0.77392500638961792, 1 },
-    { 0.36786600947380066, -0.33789101243019104, 0.76090401411056519, 1 },
-    { -0.39775899052619934, -0.33789101243019104, 0.76090401411056519, 1 },
-    { 0.40953299403190613, -0.29361999034881592, 0.75048798322677612, 1 },
-    { -0.43942499160766602, -0.29361999034881592, 0.75048798322677612, 1 },
-    { 0.070991002023220062, 0.93684899806976318, 0.55777901411056519, 1 },
-    { -0.10088399797677994, 0.93684899806976318, 0.55777901411056519, 1 },
-    { 0.21161599457263947, 0.91927099227905273, 0.54215401411056519, 1 },
-    { -0.24150900542736053, 0.91927099227905273, 0.54215401411056519, 1 },
-    { 0.28388199210166931, 0.87239599227905273, 0.54410701990127563, 1 },
-    { -0.3137739896774292, 0.87239599227905273, 0.54410701990127563, 1 },
-    { 0.29364800453186035, 0.75716102123260498, 0.56949800252914429, 1 },
-    { -0.32354000210762024, 0.75716102123260498, 0.56949800252914429, 1 },
-    { 0.26630398631095886, 0.55013000965118408, 0.59098201990127563, 1 },
-    { -0.29619601368904114, 0.55013000965118408, 0.59098201990127563, 1 },
-    { 0.2760699987411499, 0.098958000540733337, 0.60074800252914429, 1 },
-    { -0.30596199631690979, 0.098958000540733337, 0.60074800252914429, 1 },
-    { 0.50653797388076782, 0.022786000743508339, 0.54801398515701294, 1 },
-    { -0.5364300012588501, 0.022786000743508339, 0.54801398515701294, 1 },
-    { 0.6862260103225708, -0.11197900027036667, 0.50895100831985474, 1 },
-    { -0.7161179780960083, -0.11197900027036667, 0.50895100831985474, 1 },
-    { 0.77411597967147827, -0.30924499034881592, 0.53043502569198608, 1 },
-    { -0.80400902032852173, -0.30924499034881592, 0.53043502569198608, 1 },
-    { 0.73505401611328125, -0.44596400856971741, 0.60660701990127563, 1 },
-    { -0.76494598388671875, -0.44596400856971741, 0.60660701990127563, 1 },
-    { 0.56708502769470215, -0.53190100193023682, 0.66520100831985474, 1 },
-    { -0.59697699546813965, -0.53190100193023682, 0.66520100831985474, 1 },
-    { 0.37567898631095886, -0.65690100193023682, 0.71988898515701294, 1 },
-    { -0.40557101368904114, -0.65690100193023682, 0.71988898515701294, 1 },
-    { 0.23310099542140961, -0.70377600193023682, 0.75113898515701294, 1 },
-    { -0.26299300789833069, -0.70377600193023682, 0.75113898515701294, 1 },
-    { 0.11591300368309021, -0.58463597297668457, 0.75699800252914429, 1 },
-    { -0.1458050012588501, -0.58463597297668457, 0.75699800252914429, 1 },
-    { 0.026070000603795052, -0.44596400856971741, 0.74527901411056519, 1 },
-    { -0.055962000042200089, -0.44596400856971741, 0.74527901411056519, 1 },
-    { 0.16474099457263947, -0.50260400772094727, 0.76285701990127563, 1 },
-    { -0.19463400542736053, -0.50260400772094727, 0.76285701990127563, 1 },
-    { 0.25849100947380066, -0.57096397876739502, 0.75309199094772339, 1 },
-    { -0.28838399052619934, -0.57096397876739502, 0.75309199094772339, 1 },
-    { 0.36200699210166931, -0.54557299613952637, 0.72965401411056519, 1 },
-    { -0.3918989896774292, -0.54557299613952637, 0.72965401411056519, 1 },
-    { 0.52411597967147827, -0.46354201436042786, 0.68277901411056519, 1 },
-    { -0.55400902032852173, -0.46354201436042786, 0.68277901411056519, 1 },
-    { 0.65302300453186035, -0.38541701436042786, 0.63004499673843384, 1 },
-    { -0.68291497230529785, -0.38541701436042786, 0.63004499673843384, 1 },
-    { 0.66864800453186035, -0.28580799698829651, 0.59488898515701294, 1 },
-    { -0.69853997230529785, -0.28580799698829651, 0.59488898515701294, 1 },
-    { 0.60028797388076782, -0.14713600277900696, 0.59293502569198608, 1 },
-    { -0.6301800012588501, -0.14713600277900696, 0.59293502569198608, 1 },
-    { 0.45575699210166931, -0.041666999459266663, 0.62418502569198608, 1 },
-    { -0.4856489896774292, -0.041666999459266663, 0.62418502569198608, 1 },
-    { 0.2604449987411499, -0.010417000390589237, 0.68863898515701294, 1 },
-    { -0.29033699631690979, -0.010417000390589237, 0.68863898515701294, 1 },
-    { 0.1081010028719902, -0.065104000270366669, 0.71402901411056519, 1 },
-    { -0.13799299299716949, -0.065104000270366669, 0.71402901411056519, 1 },
-    { 0.082709997892379761, -0.39518299698829651, 0.75699800252914429, 1 },
-    { -0.11260200291872025, -0.39518299698829651, 0.75699800252914429, 1 },
-    { 0.049506999552249908, -0.28971400856971741, 0.73356002569198608, 1 },
-    { -0.079398997128009796, -0.28971400856971741, 0.73356002569198608, 1 },
-    { 0.059273000806570053, -0.17252600193023682, 0.70621699094772339, 1 },
-    { -0.089165002107620239, -0.17252600193023682, 0.70621699094772339, 1 },
-    { 0.041694998741149902, 0.89192700386047363, 0.62027901411056519, 1 },
-    { -0.07158699631690979, 0.89192700386047363, 0.62027901411056519, 1 },
-    { 0.12958499789237976, 0.8704419732093811, 0.62418502569198608, 1 },
-    { -0.15947699546813965, 0.8704419732093811, 0.62418502569198608, 1 },
-    { 0.1666949987411499, 0.80208301544189453, 0.64176398515701294, 1 },
-    { -0.19658699631690979, 0.80208301544189453, 0.64176398515701294, 1 },
-    { 0.14911599457263947, 0.55013000965118408, 0.67691999673843384, 1 },
-    { -0.17900900542736053, 0.55013000965118408, 0.67691999673843384, 1 },
-    { 0.17060099542140961, 0.71223902702331543, 0.66129499673843384, 1 },
-    { -0.20049299299716949, 0.71223902702331543, 0.66129499673843384, 1 },
-    { 0.026070000603795052, 0.35677099227905273, 0.70231002569198608, 1 },
-    { -0.055962000042200089, 0.35677099227905273, 0.70231002569198608, 1 },
-    { 0.033881999552249908, 0.54427099227905273, 0.69840401411056519, 1 },
-    { -0.063773997128009796, 0.54427099227905273, 0.69840401411056519, 1 },
-    { 0.041694998741149902, 0.69270801544189453, 0.69059199094772339, 1 },
-    { -0.07158699631690979, 0.69270801544189453, 0.69059199094772339, 1 },
-    { 0.094429001212120056, 0.23372399806976318, 0.72379499673843384, 1 },
-    { -0.12432099878787994, 0.23372399806976318, 0.72379499673843384, 1 },
-    { 0.10224100202322006, 0.16341100633144379, 0.72379499673843384, 1 },
-    { -0.13213400542736053, 0.16341100633144379, 0.72379499673843384, 1 },
-    { 0.047554001212120056, 0.11653599888086319, 0.71793502569198608, 1 },
-    { -0.077445998787879944, 0.11653599888086319, 0.71793502569198608, 1 },
-    { -0.0051799998618662357, 0.14192700386047363, 0.72379499673843384, 1 },
-    { -0.024712000042200089, 0.14192700386047363, 0.72379499673843384, 1 },
-    { 0.029975999146699905, 0.28255200386047363, 0.71793502569198608, 1 },
-    { -0.059868000447750092, 0.28255200386047363, 0.71793502569198608, 1 },
-    { 0.028023000806570053, 0.26302099227905273, 0.74918502569198608, 1 },
-    { -0.057914998382329941, 0.26302099227905273, 0.74918502569198608, 1 },
-    { 0.0065379999577999115, 0.14583300054073334, 0.76090401411056519, 1 },
-    { -0.036430001258850098, 0.14583300054073334, 0.76090401411056519, 1 },
-    { 0.057319998741149902, 0.12044200301170349, 0.75309199094772339, 1 },
-    { -0.08721199631690979, 0.12044200301170349, 0.75309199094772339, 1 },
-    { 0.096381999552249908, 0.16536399722099304, 0.76090401411056519, 1 },
-    { -0.12627400457859039, 0.16536399722099304, 0.76090401411056519, 1 },
-    { 0.088569998741149902, 0.22395800054073334, 0.75895100831985474, 1 },
-    { -0.11846199631690979, 0.22395800054073334, 0.75895100831985474, 1 },
-    { 0.047554001212120056, 0.16341100633144379, 0.77652901411056519, 1 },
-    { -0.077445998787879944, 0.16341100633144379, 0.77652901411056519, 1 },
-    { 0.031929001212120056, 0.22200499475002289, 0.77262300252914429, 1 },
-    { -0.061820998787879944, 0.22200499475002289, 0.77262300252914429, 1 },
-    { 0.041694998741149902, 0.065755002200603485, 0.71207600831985474, 1 },
-    { -0.07158699631690979, 0.065755002200603485, 0.71207600831985474, 1 },
-    { 0.11395999789237976, 0.15950499475002289, 0.71012300252914429, 1 },
-    { -0.14385199546813965, 0.15950499475002289, 0.71012300252914429, 1 },
-    { 0.1237260028719902, 0.24739600718021393, 0.68473201990127563, 1 },
-    { -0.15361799299716949, 0.24739600718021393, 0.68473201990127563, 1 },
-    { 0.1237260028719902, 0.35286399722099304, 0.68473201990127563, 1 },
-    { -0.15361799299716949, 0.35286399722099304, 0.68473201990127563, 1 },
-    { 0.22528800368309021, 0.35677099227905273, 0.59293502569198608, 1 },
-    { -0.2551800012588501, 0.35677099227905273, 0.59293502569198608, 1 },
-    { 0.19403800368309021, 0.25911399722099304, 0.58902901411056519, 1 },
-    { -0.2239300012588501, 0.25911399722099304, 0.58902901411056519, 1 },
-    { 0.1666949987411499, 0.17512999475002289, 0.61637300252914429, 1 },
-    { -0.19658699631690979, 0.17512999475002289, 0.61637300252914429, 1 },
-    { 0.035835001617670059, 0.7298169732093811, 0.68473201990127563, 1 },
-    { -0.065727002918720245, 0.7298169732093811, 0.68473201990127563, 1 },
-    { 0.088569998741149902, 0.75911402702331543, 0.67691999673843384, 1 },
-    { -0.11846199631690979, 0.75911402702331543, 0.67691999673843384, 1 },
-    { 0.065131999552249908, 0.83138000965118408, 0.65738898515701294, 1 },
-    { -0.095023997128009796, 0.83138000965118408, 0.65738898515701294, 1 },
-    { 0.012397999875247478, 0.85872399806976318, 0.64566999673843384, 1 },
-    { -0.042289998382329941, 0.85872399806976318, 0.64566999673843384, 1 },
-    { 0.008491000160574913, 0.84309899806976318, 0.61637300252914429, 1 },
-    { -0.038384001702070236, 0.84309899806976318, 0.61637300252914429, 1 },
-    { 0.055365998297929764, 0.81770801544189453, 0.62418502569198608, 1 },
-    { -0.085258997976779938, 0.81770801544189453, 0.62418502569198608, 1 },
-    { 0.078804001212120056, 0.7610669732093811, 0.64176398515701294, 1 },
-    { -0.10869599878787994, 0.7610669732093811, 0.64176398515701294, 1 },
-    { 0.031929001212120056, 0.74153602123260498, 0.64762300252914429, 1 },
-    { -0.061820998787879944, 0.74153602123260498, 0.64762300252914429, 1 },
-    { 0.02020999975502491, 0.79036402702331543, 0.60270100831985474, 1 },
-    { -0.050101999193429947, 0.79036402702331543, 0.60270100831985474, 1 },
-    { 0.063179001212120056, 0.78450500965118408, 0.60205000638961792, 1 },
-    { -0.093070998787879944, 0.78450500965118408, 0.60205000638961792, 1 },
-    { 0.14911599457263947, -0.20182299613952637, 0.72184199094772339, 1 },
-    { -0.17900900542736053, -0.20182299613952637, 0.72184199094772339, 1 },
-    { 0.13739800453186035, -0.27799499034881592, 0.72770100831985474, 1 },
-    { -0.16729000210762024, -0.27799499034881592, 0.72770100831985474, 1 },
-    { 0.15497599542140961, -0.36783900856971741, 0.73160701990127563, 1 },
-    { -0.18486799299716949, -0.36783900856971741, 0.73160701990127563, 1 },
-    { 0.18036599457263947, -0.14518299698829651, 0.71793502569198608, 1 },
-    { -0.21025900542736053, -0.14518299698829651, 0.71793502569198608, 1 },
-    { 0.2799760103225708, -0.090494997799396515, 0.69840401411056519, 1 },
-    { -0.30986800789833069, -0.090494997799396515, 0.69840401411056519, 1 },
-    { 0.41474100947380066, -0.080729000270366669, 0.66520100831985474, 1 },
-    { -0.44463399052619934, -0.080729000270366669, 0.66520100831985474, 1 },
-    { 0.52802300453186035, -0.15690100193023682, 0.63590401411056519, 1 },
-    { -0.55791497230529785, -0.15690100193023682, 0.63590401411056519, 1 },
-    { 0.5924760103225708, -0.26236999034881592, 0.62223201990127563, 1 },
-    { -0.6223679780960083, -0.26236999034881592, 0.62223201990127563, 1 },
-    { 0.58271002769470215, -0.34830799698829651, 0.63004499673843384, 1 },
-    { -0.61260199546813965, -0.34830799698829651, 0.63004499673843384, 1 },
-    { 0.48895999789237976, -0.41080799698829651, 0.66910701990127563, 1 },
-    { -0.51885199546813965, -0.41080799698829651, 0.66910701990127563, 1 },
-    { 0.36395999789237976, -0.45572900772094727, 0.70426398515701294, 1 },
-    { -0.39385199546813965, -0.45572900772094727, 0.70426398515701294, 1 },
-    { 0.28192898631095886, -0.46940100193023682, 0.71402901411056519, 1 },
-    { -0.31182101368904114, -0.46940100193023682, 0.71402901411056519, 1 },
-    { 0.20966300368309021, -0.44010400772094727, 0.72770100831985474, 1 },
-    { -0.2395550012588501, -0.44010400772094727, 0.72770100831985474, 1 },
-    { 0.23505400121212006, -0.40885400772094727, 0.72574800252914429, 1 },
-    { -0.26494601368904114, -0.40885400772094727, 0.72574800252914429, 1 },
-    { 0.2916949987411499, -0.43424499034881592, 0.71793502569198608, 1 },
-    { -0.32158699631690979, -0.43424499034881592, 0.71793502569198608, 1 },
-    { 0.36200699210166931, -0.42643299698829651, 0.71402901411056519, 1 },
-    { -0.3918989896774292, -0.42643299698829651, 0.71402901411056519, 1 },
-    { 0.4674760103225708, -0.38932299613952637, 0.68082600831985474, 1 },
-    { -0.49736800789833069, -0.38932299613952637, 0.68082600831985474, 1 },
-    { 0.54364800453186035, -0.33463600277900696, 0.63981002569198608, 1 },
-    { -0.57353997230529785, -0.33463600277900696, 0.63981002569198608, 1 },
-    { 0.55146002769470215, -0.26432299613952637, 0.63395100831985474, 1 },
-    { -0.58135199546813965, -0.26432299613952637, 0.63395100831985474, 1 },
-    { 0.50067901611328125, -0.17643299698829651, 0.64957600831985474, 1 },
-    { -0.53057098388671875, -0.17643299698829651, 0.64957600831985474, 1 },
-    { 0.40692898631095886, -0.11197900027036667, 0.67887300252914429, 1 },
-    { -0.43682101368904114, -0.11197900027036667, 0.67887300252914429, 1 },
-    { 0.28974100947380066, -0.11588600277900696, 0.70816999673843384, 1 },
-    { -0.31963399052619934, -0.11588600277900696, 0.70816999673843384, 1 },
-    { 0.19989800453186035, -0.16080799698829651, 0.72184199094772339, 1 },
-    { -0.22979000210762024, -0.16080799698829651, 0.72184199094772339, 1 },
-    { 0.19013200700283051, -0.35221400856971741, 0.72574800252914429, 1 },
-    { -0.22002400457859039, -0.35221400856971741, 0.72574800252914429, 1 },
-    { 0.17060099542140961, -0.27994799613952637, 0.72379499673843384, 1 },
-    { -0.20049299299716949, -0.27994799613952637, 0.72379499673843384, 1 },
-    { 0.17450700700283051, -0.21354199945926666, 0.71988898515701294, 1 },
-    { -0.20439900457859039, -0.21354199945926666, 0.71988898515701294, 1 },
-    { 0.028023000806570053, -0.46744799613952637, 0.63199800252914429, 1 },
-    { -0.057914998382329941, -0.46744799613952637, 0.63199800252914429, 1 },
-    { 0.11591300368309021, -0.60416698455810547, 0.63981002569198608, 1 },
-    { -0.1458050012588501, -0.60416698455810547, 0.63981002569198608, 1 },
-    { 0.23700700700283051, -0.72721397876739502, 0.63199800252914429, 1 },
-    { -0.2668989896774292, -0.72721397876739502, 0.63199800252914429, 1 },
-    { 0.39325699210166931, -0.67057299613952637, 0.59879499673843384, 1 },
-    { -0.4231489896774292, -0.67057299613952637, 0.59879499673843384, 1 },
-    { 0.5768510103225708, -0.54361999034881592, 0.54606002569198608, 1 },
-    { -0.6067429780960083, -0.54361999034881592, 0.54606002569198608, 1 },
-    { 0.74677300453186035, -0.46354201436042786, 0.4991849958896637, 1 },
-    { -0.77666497230529785, -0.46354201436042786, 0.4991849958896637, 1 },
-    { 0.7995070219039917, -0.30729201436042786, 0.42496699094772339, 1 },
-    { -0.8293989896774292, -0.30729201436042786, 0.42496699094772339, 1 },
-    { 0.69403797388076782, -0.088541999459266663, 0.39957600831985474, 1 },
-    { -0.7239300012588501, -0.088541999459266663, 0.39957600831985474, 1 },
-    { 0.51239800453186035, 0.048177000135183334, 0.44449800252914429, 1 },
-    { -0.54228997230529785, 0.048177000135183334, 0.44449800252914429, 1 },
-    { 0.061225999146699905, 0.48177099227905273, 0.26090401411056519, 1 },
-    { -0.091118000447750092, 0.48177099227905273, 0.26090401411056519, 1 },
-    { 0.051460001617670059, 0.64778602123260498, 0.30387300252914429, 1 },
-    { -0.081352002918720245, 0.64778602123260498, 0.30387300252914429, 1 },
-    { 0.061225999146699905, 0.85091102123260498, 0.3585599958896637, 1 },
-    { -0.091118000447750092, 0.85091102123260498, 0.3585599958896637, 1 },
-    { 0.070991002023220062, 0.9485669732093811, 0.46402901411056519, 1 },
-    { -0.10088399797677994, 0.9485669732093811, 0.46402901411056519, 1 },
-    { 0.23505400121212006, 0.92317700386047363, 0.43473199009895325, 1 },
-    { -0.26494601368904114, 0.92317700386047363, 0.43473199009895325, 1 },
-    { 0.31317898631095886, 0.84505200386047363, 0.41520100831985474, 1 },
-    { -0.34307101368904114, 0.84505200386047363, 0.41520100831985474, 1 },
-    { 0.29950699210166931, 0.67903602123260498, 0.42496699094772339, 1 },
-    { -0.3293989896774292, 0.67903602123260498, 0.42496699094772339, 1 },
-    { 0.18622599542140961, 0.60677099227905273, 0.33121699094772339, 1 },
-    { -0.21611799299716949, 0.60677099227905273, 0.33121699094772339, 1 },
-    { 0.21552300453186035, 0.81184899806976318, 0.35270100831985474, 1 },
-    { -0.24541500210762024, 0.81184899806976318, 0.35270100831985474, 1 },
-    { 0.1823199987411499, 0.43098899722099304, 0.30973199009895325, 1 },
-    { -0.21221199631690979, 0.43098899722099304, 0.30973199009895325, 1 },
-    { 0.27216300368309021, 0.47591099143028259, 0.44059199094772339, 1 },
-    { -0.3020550012588501, 0.47591099143028259, 0.44059199094772339, 1 },
-    { 0.21552300453186035, 0.24739600718021393, 0.45816999673843384, 1 },
-    { -0.24541500210762024, 0.24739600718021393, 0.45816999673843384, 1 },
-    { 0.24091300368309021, 0.32552099227905273, 0.44645100831985474, 1 },
-    { -0.2708050012588501, 0.32552099227905273, 0.44645100831985474, 1 },
-    { 0.1979449987411499, 0.18880200386047363, 0.47770100831985474, 1 },
-    { -0.22783699631690979, 0.18880200386047363, 0.47770100831985474, 1 },
-    { 0.30536600947380066, 0.12825499475002289, 0.47184199094772339, 1 },
-    { -0.33525899052619934, 0.12825499475002289, 0.47184199094772339, 1 },
-    { 0.15497599542140961, 0.034504998475313187, -0.71956497430801392, 1 },
-    { -0.18486799299716949, 0.034504998475313187, -0.71956497430801392, 1 },
-    { 0.14520999789237976, 0.23958300054073334, -0.50081497430801392, 1 },
-    { -0.17510199546813965, 0.23958300054073334, -0.50081497430801392, 1 },
-    { 0.11200699955224991, 0.36653599143028259, -0.11018999665975571, 1 },
-    { -0.14189900457859039, 0.36653599143028259, -0.11018999665975571, 1 },
-    { 0.082709997892379761, 0.41731700301170349, 0.17887300252914429, 1 },
-    { -0.11260200291872025, 0.41731700301170349, 0.17887300252914429, 1 },
-    { 0.19599099457263947, 0.33919200301170349, 0.27066999673843384, 1 },
-    { -0.22588400542736053, 0.33919200301170349, 0.27066999673843384, 1 },
-    { 0.72528797388076782, -0.10807300359010696, 0.18473200500011444, 1 },
-    { -0.7551800012588501, -0.10807300359010696, 0.18473200500011444, 1 },
-    { 0.18427300453186035, -0.30143299698829651, -0.80550199747085571, 1 },
-    { -0.21416500210762024, -0.30143299698829651, -0.80550199747085571, 1 },
-    { 0.21161599457263947, -0.93619799613952637, 0.049966998398303986, 1 },
-    { -0.24150900542736053, -0.93619799613952637, 0.049966998398303986, 1 },
-    { 0.21161599457263947, -0.94010400772094727, -0.3133150041103363, 1 },
-    { -0.24150900542736053, -0.94010400772094727, -0.3133150041103363, 1 },
-    { 0.2135699987411499, -0.71158897876739502, -0.66487699747085571, 1 },
-    { -0.24346199631690979, -0.71158897876739502, -0.66487699747085571, 1 },
-    { 0.69403797388076782, -0.44986999034881592, 0.34879499673843384, 1 },
-    { -0.7239300012588501, -0.44986999034881592, 0.34879499673843384, 1 },
-    { 0.68427300453186035, -0.5514330267906189, 0.1554349958896637, 1 },
-    { -0.71416497230529785, -0.5514330267906189, 0.1554349958896637, 1 },
-    { 0.70380401611328125, -0.67838597297668457, -0.076985999941825867, 1 },
-    { -0.73369598388671875, -0.67838597297668457, -0.076985999941825867, 1 },
-    { 0.70380401611328125, -0.66666698455810547, -0.32308000326156616, 1 },
-    { -0.73369598388671875, -0.66666698455810547, -0.32308000326156616, 1 },
-    { 0.69208502769470215, -0.47330799698829651, -0.50081497430801392, 1 },
-    { -0.72197699546813965, -0.47330799698829651, -0.50081497430801392, 1 },
-    { 0.52802300453186035, -0.5983080267906189, -0.57308000326156616, 1 },
-    { -0.55791497230529785, -0.5983080267906189, -0.57308000326156616, 1 },
-    { 0.53192901611328125, -0.82682299613952637, -0.31722098588943481, 1 },
-    { -0.56182098388671875, -0.82682299613952637, -0.31722098588943481, 1 },
-    { 0.53192901611328125, -0.82877600193023682, -0.037923999130725861, 1 },
-    { -0.56182098388671875, -0.82877600193023682, -0.037923999130725861, 1 },
-    { 0.53192901611328125, -0.65299499034881592, 0.20621700584888458, 1 },
-    { -0.56182098388671875, -0.65299499034881592, 0.20621700584888458, 1 },
-    { 0.5495070219039917, -0.51627600193023682, 0.39566999673843384, 1 },
-    { -0.5793989896774292, -0.51627600193023682, 0.39566999673843384, 1 },
-    { 0.2135699987411499, -0.73111999034881592, 0.33707600831985474, 1 },
-    { -0.24346199631690979, -0.73111999034881592, 0.33707600831985474, 1 },
-    { 0.26630398631095886, -0.61197900772094727, 0.54996699094772339, 1 },
-    { -0.29619601368904114, -0.61197900772094727, 0.54996699094772339, 1 },
-    { 0.24872599542140961, -0.54752600193023682, 0.49723199009895325, 1 },
-    { -0.27861800789833069, -0.54752600193023682, 0.49723199009895325, 1 },
-    { 0.021511999890208244, -0.49934899806976318, 0.54996699094772339, 1 },
-    { -0.051403999328613281, -0.49934899806976318, 0.54996699094772339, 1 },
-    { 0.77216297388076782, -0.32291701436042786, 0.26285699009895325, 1 },
-    { -0.8020550012588501, -0.32291701436042786, 0.26285699009895325, 1 },
-    { 0.79364800453186035, -0.40104201436042786, 0.073403999209403992, 1 },
-    { -0.82353997230529785, -0.40104201436042786, 0.073403999209403992, 1 },
-    { 0.80341297388076782, -0.47721400856971741, -0.10433000326156616, 1 },
-    { -0.8333050012588501, -0.47721400856971741, -0.10433000326156616, 1 },
-    { 0.78192901611328125, -0.45768299698829651, -0.32308000326156616, 1 },
-    { -0.81182098388671875, -0.45768299698829651, -0.32308000326156616, 1 },
-    { 0.32099100947380066, 0.24739600718021393, -0.084798999130725861, 1 },
-    { -0.35088399052619934, 0.24739600718021393, -0.084798999130725861, 1 },
-    { 0.5260699987411499, 0.11458300054073334, -0.082846000790596008, 1 },
-    { -0.55596202611923218, 0.11458300054073334, -0.082846000790596008, 1 },
-    { 0.5299760103225708, 0.057941999286413193, 0.23160700500011444, 1 },
-    { -0.5598679780960083, 0.057941999286413193, 0.23160700500011444, 1 },
-    { 0.30341300368309021, 0.17317700386047363, 0.33512300252914429, 1 },
-    { -0.3333050012588501, 0.17317700386047363, 0.33512300252914429, 1 },
-    { 0.26370000839233398, 0.26106700301170349, 0.20361299812793732, 1 },
-    { -0.29359200596809387, 0.26106700301170349, 0.20361299812793732, 1 },
-    { 0.26890799403190613, 0.14387999475002289, 0.43538299202919006, 1 },
-    { -0.29879999160766602, 0.14387999475002289, 0.43538299202919006, 1 },
-    { 0.61396002769470215, -0.17252600193023682, -0.54378300905227661, 1 },
-    { -0.64385199546813965, -0.17252600193023682, -0.54378300905227661, 1 },
-    { 0.45966300368309021, -0.23112000524997711, -0.66878300905227661, 1 },
-    { -0.4895550012588501, -0.23112000524997711, -0.66878300905227661, 1 },
-    { 0.52216297388076782, 0.05598900094628334, -0.38167399168014526, 1 },
-    { -0.5520550012588501, 0.05598900094628334, -0.38167399168014526, 1 },
-    { 0.3737260103225708, 0.13802100718021393, -0.43440800905227661, 1 },
-    { -0.40361800789833069, 0.13802100718021393, -0.43440800905227661, 1 },
-    { 0.37307500839233398, 0.0032550001051276922, -0.62711697816848755, 1 },
-    { -0.40296700596809387, 0.0032550001051276922, -0.62711697816848755, 1 },
-    { 0.9479449987411499, -0.43424499034881592, -0.30745500326156616, 1 },
-    { -0.97783702611923218, -0.43424499034881592, -0.30745500326156616, 1 },
-    { 1.1002880334854126, -0.47916701436042786, -0.39729899168014526, 1 },
-    { -1.1301800012588501, -0.47916701436042786, -0.39729899168014526, 1 },
-    { 1.2448199987411499, -0.40885499119758606, -0.4539400041103363, 1 },
-    { -1.2747119665145874, -0.40885499119758606, -0.4539400041103363, 1 },
-    { 1.2623980045318604, -0.20572899281978607, -0.45979899168014526, 1 },
-    { -1.2922899723052979, -0.20572899281978607, -0.45979899168014526, 1 },
-    { 1.1256790161132812, -0.018230000510811806, -0.41097098588943481, 1 },
-    { -1.1555709838867188, -0.018230000510811806, -0.41097098588943481, 1 },
-    { 0.90302300453186035, 0.067708000540733337, -0.2664400041103363, 1 },
-    { -0.93291497230529785, 0.067708000540733337, -0.2664400041103363, 1 },
-    { 0.93036597967147827, 0.013020999729633331, -0.2976900041103363, 1 },
-    { -0.96025902032852173, 0.013020999729633331, -0.2976900041103363, 1 },
-    { 1.1022419929504395, -0.05338599905371666, -0.42464300990104675, 1 },
-    { -1.1321330070495605, -0.05338599905371666, -0.42464300990104675, 1 },
-    { 1.2096630334854126, -0.19791699945926666, -0.4695650041103363, 1 },
-    { -1.2395550012588501, -0.19791699945926666, -0.4695650041103363, 1 },
-    { 1.1998980045318604, -0.35416701436042786, -0.46370500326156616, 1 },
-    { -1.2297899723052979, -0.35416701436042786, -0.46370500326156616, 1 },
-    { 1.0846630334854126, -0.40885499119758606, -0.41292399168014526, 1 },
-    { -1.1145550012588501, -0.40885499119758606, -0.41292399168014526, 1 },
-    { 0.96161597967147827, -0.37565100193023682, -0.33284598588943481, 1 },
-    { -0.99150902032852173, -0.37565100193023682, -0.33284598588943481, 1 },
-    { 0.67841297388076782, 0.028645999729633331, -0.12776799499988556, 1 },
-    { -0.7083050012588501, 0.028645999729633331, -0.12776799499988556, 1 },
-    { 0.7135699987411499, 0.06966099888086319, -0.19222100079059601, 1 },
-    { -0.74346202611923218, 0.06966099888086319, -0.19222100079059601, 1 },
-    { 0.77802300453186035, -0.14713600277900696, -0.041829999536275864, 1 },
-    { -0.80791497230529785, -0.14713600277900696, -0.041829999536275864, 1 },
-    { 0.8541949987411499, -0.36588600277900696, -0.26058000326156616, 1 },
-    { -0.88408702611923218, -0.36588600277900696, -0.26058000326156616, 1 },
-    { 0.7956010103225708, 0.013020999729633331, -0.24104900658130646, 1 },
-    { -0.8254929780960083, 0.013020999729633331, -0.24104900658130646, 1 },
-    { 0.75849097967147827, -0.024088999256491661, -0.27034598588943481, 1 },
-    { -0.78838402032852173, -0.024088999256491661, -0.27034598588943481, 1 },
-    { 0.77021002769470215, -0.078776001930236816, -0.29573601484298706, 1 },
-    { -0.80010199546813965, -0.078776001930236816, -0.29573601484298706, 1 },
-    { 0.76239800453186035, -0.14713600277900696, -0.28011101484298706, 1 },
-    { -0.79228997230529785, -0.14713600277900696, -0.28011101484298706, 1 },
-    { 0.8268510103225708, -0.24674500524997711, -0.28401800990104675, 1 },
-    { -0.8567429780960083, -0.24674500524997711, -0.28401800990104675, 1 },
-    { 0.8854449987411499, -0.31901100277900696, -0.28987699747085571, 1 },
-    { -0.91533702611923218, -0.31901100277900696, -0.28987699747085571, 1 },
-    { 0.8151320219039917, -0.30533900856971741, -0.21175199747085571, 1 },
-    { -0.8450239896774292, -0.30533900856971741, -0.21175199747085571, 1 },
-    { 0.7604449987411499, -0.16080799698829651, -0.1726900041103363, 1 },
-    { -0.79033702611923218, -0.16080799698829651, -0.1726900041103363, 1 },
-    { 0.70640802383422852, -0.025390999391674995, -0.18701200187206268, 1 },
-    { -0.73629999160766602, -0.025390999391674995, -0.18701200187206268, 1 },
-    { 0.9049760103225708, -0.28776100277900696, -0.34847098588943481, 1 },
-    { -0.9348679780960083, -0.28776100277900696, -0.34847098588943481, 1 },
-    { 0.85028797388076782, -0.22526100277900696, -0.33870500326156616, 1 },
-    { -0.8801800012588501, -0.22526100277900696, -0.33870500326156616, 1 },
-    { 0.78583502769470215, -0.15299500524997711, -0.34065800905227661, 1 },
-    { -0.81572699546813965, -0.15299500524997711, -0.34065800905227661, 1 },
-    { 0.77802300453186035, -0.10807300359010696, -0.34065800905227661, 1 },
-    { -0.80791497230529785, -0.10807300359010696, -0.34065800905227661, 1 },
-    { 0.82099097967147827, -0.069011002779006958, -0.34065800905227661, 1 },
-    { -0.85088402032852173, -0.069011002779006958, -0.34065800905227661, 1 },
-    { 0.8151320219039917, -0.020183000713586807, -0.34065800905227661, 1 },
-    { -0.8450239896774292, -0.020183000713586807, -0.34065800905227661, 1 },
-    { 0.83271002769470215, -0.002604000037536025, -0.31136101484298706, 1 },
-    { -0.86260199546813965, -0.002604000037536025, -0.31136101484298706, 1 },
-    { 0.97528797388076782, -0.33658900856971741, -0.39534598588943481, 1 },
-    { -1.0051800012588501, -0.33658900856971741, -0.39534598588943481, 1 },
-    { 1.0905230045318604, -0.36393299698829651, -0.46761101484298706, 1 },
-    { -1.1204149723052979, -0.36393299698829651, -0.46761101484298706, 1 },
-    { 1.1979449987411499, -0.31901100277900696, -0.50862699747085571, 1 },
-    { -1.2278369665145874, -0.31901100277900696, -0.50862699747085571, 1 },
-    { 1.2077100276947021, -0.18815100193023682, -0.51058000326156616, 1 },
-    { -1.2376019954681396, -0.18815100193023682, -0.51058000326156616, 1 },
-    { 1.1061480045318604, -0.065104000270366669, -0.47347098588943481, 1 },
-    { -1.1360399723052979, -0.065104000270366669, -0.47347098588943481, 1 },
-    { 0.9479449987411499, -0.010417000390589237, -0.3601900041103363, 1 },
-    { -0.97783702611923218, -0.010417000390589237, -0.3601900041103363, 1 },
-    { 0.8620070219039917, -0.08658900111913681, -0.36995500326156616, 1 },
-    { -0.8918989896774292, -0.08658900111913681, -0.36995500326156616, 1 },
-    { 0.9323199987411499, -0.13737000524997711, -0.38948601484298706, 1 },
-    { -0.96221202611923218, -0.13737000524997711, -0.38948601484298706, 1 },
-    { 0.99286597967147827, -0.19987000524997711, -0.41292399168014526, 1 },
-    { -1.0227580070495605, -0.19987000524997711, -0.41292399168014526, 1 },
-    { 1.0514600276947021, -0.24674500524997711, -0.42854899168014526, 1 },
-    { -1.0813519954681396, -0.24674500524997711, -0.42854899168014526, 1 },
-    { 1.0084919929504395, -0.30143299698829651, -0.42464300990104675, 1 },
-    { -1.0383830070495605, -0.30143299698829651, -0.42464300990104675, 1 },
-    { 0.9401320219039917, -0.25260400772094727, -0.3914400041103363, 1 },
-    { -0.9700239896774292, -0.25260400772094727, -0.3914400041103363, 1 },
-    { 0.88153797388076782, -0.19205799698829651, -0.37386101484298706, 1 },
-    { -0.9114300012588501, -0.19205799698829651, -0.37386101484298706, 1 },
-    { 0.81708502769470215, -0.13346399366855621, -0.36604899168014526, 1 },
-    { -0.84697699546813965, -0.13346399366855621, -0.36604899168014526, 1 },
-    { 0.85614800453186035, -0.031900998204946518, -0.35433000326156616, 1 },
-    { -0.88603997230529785, -0.031900998204946518, -0.35433000326156616, 1 },
-    { 0.9518510103225708, -0.063151001930236816, -0.3914400041103363, 1 },
-    { -0.9817429780960083, -0.063151001930236816, -0.3914400041103363, 1 },
-    { 1.0631790161132812, -0.11979199945926666, -0.45784598588943481, 1 },
-    { -1.0930709838867188, -0.11979199945926666, -0.45784598588943481, 1 },
-    { 1.1432570219039917, -0.20182299613952637, -0.48128300905227661, 1 },
-    { -1.1731489896774292, -0.20182299613952637, -0.48128300905227661, 1 },
-    { 1.1452100276947021, -0.28776100277900696, -0.48323601484298706, 1 },
-    { -1.1751019954681396, -0.28776100277900696, -0.48323601484298706, 1 },
-    { 1.0892210006713867, -0.33528700470924377, -0.47347098588943481, 1 },
-    { -1.1191129684448242, -0.33528700470924377, -0.47347098588943481, 1 },
-    { 0.89521002769470215, 0.093098998069763184, -0.36214300990104675, 1 },
-    { -0.92510199546813965, 0.093098998069763184, -0.36214300990104675, 1 },
-    { 1.1530230045318604, -0.00065100000938400626, -0.48909598588943481, 1 },
-    { -1.1829149723052979, -0.00065100000938400626, -0.48909598588943481, 1 },
-    { 1.3131790161132812, -0.20182299613952637, -0.51448601484298706, 1 },
-    { -1.3430709838867188, -0.20182299613952637, -0.51448601484298706, 1 },
-    { 1.2858350276947021, -0.41861999034881592, -0.51643997430801392, 1 },
-    { -1.3157269954681396, -0.41861999034881592, -0.51643997430801392, 1 },
-    { 1.1178669929504395, -0.49283900856971741, -0.4851900041103363, 1 },
-    { -1.1477580070495605, -0.49283900856971741, -0.4851900041103363, 1 },
-    { 0.93427300453186035, -0.44596400856971741, -0.39729899168014526, 1 },
-    { -0.96416497230529785, -0.44596400856971741, -0.39729899168014526, 1 },
-    { 0.91278797388076782, -0.17252600193023682, -0.46565800905227661, 1 },
-    { -0.9426800012588501, -0.17252600193023682, -0.46565800905227661, 1 },
-    { 1.1413040161132812, -0.23893299698829651, -0.55745500326156616, 1 },
-    { -1.1711959838867188, -0.23893299698829651, -0.55745500326156616, 1 },
-    { 1.294950008392334, -0.29361999034881592, -0.56982499361038208, 1 },
-    { -1.3248419761657715, -0.29361999034881592, -0.56982499361038208, 1 },
-    { 0.82099097967147827, -0.36588600277900696, -0.35823601484298706, 1 },
-    { -0.85088402032852173, -0.36588600277900696, -0.35823601484298706, 1 },
-    { 0.75067901611328125, -0.14908899366855621, -0.4383150041103363, 1 },
-    { -0.78057098388671875, -0.14908899366855621, -0.4383150041103363, 1 },
-    { 0.68427300453186035, 0.079426996409893036, -0.30550199747085571, 1 },
-    { -0.71416497230529785, 0.079426996409893036, -0.30550199747085571, 1 },
-    { 0.44892099499702454, -0.21842500567436218, 0.70963501930236816, 1 },
-    { 0.44501501321792603, -0.15738999843597412, 0.68424397706985474, 1 },
-    { 0.5133739709854126, -0.19010399281978607, 0.63248598575592041, 1 },
-    { 0.48895999789237976, -0.26285800337791443, 0.67399001121520996, 1 },
-    { -0.47490701079368591, -0.15738999843597412, 0.68424397706985474, 1 },
-    { -0.47881299257278442, -0.21842500567436218, 0.70963501930236816, 1 },
-    { -0.51885199546813965, -0.26285800337791443, 0.67399001121520996, 1 },
-    { -0.54326599836349487, -0.19010399281978607, 0.63248598575592041, 1 },
-    { 0.49579599499702454, -0.10660800337791443, 0.59147101640701294, 1 },
-    { 0.57099097967147827, -0.16862000524997711, 0.52652901411056519, 1 },
-    { 0.5612260103225708, -0.26285800337791443, 0.57731002569198608, 1 },
-    { -0.52568799257278442, -0.10660800337791443, 0.59147101640701294, 1 },
-    { -0.5911179780960083, -0.26285800337791443, 0.57731002569198608, 1 },
-    { -0.60088402032852173, -0.16862000524997711, 0.52652901411056519, 1 },
-    { 0.40985900163650513, -0.087564997375011444, 0.65494698286056519, 1 },
-    { 0.33661600947380066, -0.041666999459266663, 0.62320899963378906, 1 },
-    { 0.43427300453186035, -0.035808000713586807, 0.55387300252914429, 1 },
-    { -0.36650899052619934, -0.041666999459266663, 0.62320899963378906, 1 },
-    { -0.43975099921226501, -0.087564997375011444, 0.65494698286056519, 1 },
-    { -0.46416500210762024, -0.035808000713586807, 0.55387300252914429, 1 },
-    { 0.38398000597953796, -0.1564130038022995, 0.72330701351165771, 1 },
-    { 0.33710500597953796, -0.11393299698829651, 0.70572799444198608, 1 },
-    { -0.36699700355529785, -0.11393299698829651, 0.70572799444198608, 1 },
-    { -0.41387200355529785, -0.1564130038022995, 0.72330701351165771, 1 },
-    { 0.29267099499702454, -0.1564130038022995, 0.74088501930236816, 1 },
-    { 0.23163600265979767, -0.15738999843597412, 0.72330701351165771, 1 },
-    { 0.26386299729347229, -0.087564997375011444, 0.68180298805236816, 1 },
-    { -0.26152798533439636, -0.15738999843597412, 0.72330701351165771, 1 },
-    { -0.32256299257278442, -0.1564130038022995, 0.74088501930236816, 1 },
-    { -0.29375499486923218, -0.087564997375011444, 0.68180298805236816, 1 },
-    { 0.17743700742721558, -0.10660800337791443, 0.64859998226165771, 1 },
-    { 0.23895999789237976, -0.035808000713586807, 0.58902901411056519, 1 },
-    { -0.20732900500297546, -0.10660800337791443, 0.64859998226165771, 1 },
-    { -0.26885199546813965, -0.035808000713586807, 0.58902901411056519, 1 },
-    { 0.16083499789237976, -0.19010399281978607, 0.69401001930236816, 1 },
-    { 0.11200699955224991, -0.26285800337791443, 0.65445899963378906, 1 },
-    { 0.10224100202322006, -0.16862000524997711, 0.60856002569198608, 1 },
-    { -0.14189900457859039, -0.26285800337791443, 0.65445899963378906, 1 },
-    { -0.19072699546813965, -0.19010399281978607, 0.69401001930236816, 1 },
-    { -0.13213400542736053, -0.16862000524997711, 0.60856002569198608, 1 },
-    { 0.23065899312496185, -0.21842500567436218, 0.74918502569198608, 1 },
-    { 0.18817900121212006, -0.26285800337791443, 0.72574800252914429, 1 },
-    { -0.21807099878787994, -0.26285800337791443, 0.72574800252914429, 1 },
-    { -0.26055198907852173, -0.21842500567436218, 0.74918502569198608, 1 },
-    { 0.23065899312496185, -0.30973300337791443, 0.74918502569198608, 1 },
-    { 0.23163600265979767, -0.37076899409294128, 0.72330701351165771, 1 },
-    { 0.16083499789237976, -0.33561199903488159, 0.69401001930236816, 1 },
-    { -0.26152798533439636, -0.37076899409294128, 0.72330701351165771, 1 },
-    { -0.26055198907852173, -0.30973300337791443, 0.74918502569198608, 1 },
-    { -0.19072699546813965, -0.33561199903488159, 0.69401001930236816, 1 },
-    { 0.17743700742721558, -0.42155000567436218, 0.64859998226165771, 1 },
-    { 0.10224100202322006, -0.36002600193023682, 0.60856002569198608, 1 },
-    { -0.20732900500297546, -0.42155000567436218, 0.64859998226165771, 1 },
-    { -0.13213400542736053, -0.36002600193023682, 0.60856002569198608, 1 },
-    { 0.26386299729347229, -0.43912801146507263, 0.68180298805236816, 1 },
-    { 0.33661600947380066, -0.48697900772094727, 0.62320899963378906, 1 },
-    { 0.23895999789237976, -0.49674499034881592, 0.58902901411056519, 1 },
-    { -0.36650899052619934, -0.48697900772094727, 0.62320899963378906, 1 },
-    { -0.29375499486923218, -0.43912801146507263, 0.68180298805236816, 1 },
-    { -0.26885199546813965, -0.49674499034881592, 0.58902901411056519, 1 },
-    { 0.29267099499702454, -0.37516298890113831, 0.74088501930236816, 1 },
-    { 0.33710500597953796, -0.41471400856971741, 0.70572799444198608, 1 },
-    { -0.36699700355529785, -0.41471400856971741, 0.70572799444198608, 1 },
-    { -0.32256299257278442, -0.37516298890113831, 0.74088501930236816, 1 },
-    { 0.38398000597953796, -0.37516298890113831, 0.72330701351165771, 1 },
-    { 0.44501501321792603, -0.37076899409294128, 0.68424397706985474, 1 },
-    { 0.40985900163650513, -0.43912801146507263, 0.65494698286056519, 1 },
-    { -0.47490701079368591, -0.37076899409294128, 0.68424397706985474, 1 },
-    { -0.41387200355529785, -0.37516298890113831, 0.72330701351165771, 1 },
-    { -0.43975099921226501, -0.43912801146507263, 0.65494698286056519, 1 },
-    { 0.49579599499702454, -0.42155000567436218, 0.59147101640701294, 1 },
-    { 0.43427300453186035, -0.49674499034881592, 0.55387300252914429, 1 },
-    { -0.52568799257278442, -0.42155000567436218, 0.59147101640701294, 1 },
-    { -0.46416500210762024, -0.49674499034881592, 0.55387300252914429, 1 },
-    { 0.5133739709854126, -0.33561199903488159, 0.63248598575592041, 1 },
-    { 0.57099097967147827, -0.36002600193023682, 0.52652901411056519, 1 },
-    { -0.54326599836349487, -0.33561199903488159, 0.63248598575592041, 1 },
-    { -0.60088402032852173, -0.36002600193023682, 0.52652901411056519, 1 },
-    { 0.44892099499702454, -0.30973300337791443, 0.70963501930236816, 1 },
-    { -0.47881299257278442, -0.30973300337791443, 0.70963501930236816, 1 },
-    { 0.41913598775863647, -0.34537801146507263, 0.73111897706985474, 1 },
-    { 0.4359000027179718, -0.3048509955406189, 0.73583900928497314, 1 },
-    { 0.44989800453186035, -0.26334699988365173, 0.72379499673843384, 1 },
-    { -0.44902798533439636, -0.34537801146507263, 0.73111897706985474, 1 },
-    { -0.47979000210762024, -0.26334699988365173, 0.72379499673843384, 1 },
-    { -0.46579200029373169, -0.3048509955406189, 0.73583900928497314, 1 },
-    { 0.33759298920631409, -0.37858098745346069, 0.74869698286056519, 1 },
-    { 0.37909701466560364, -0.36474600434303284, 0.74967402219772339, 1 },
-    { -0.36748498678207397, -0.37858098745346069, 0.74869698286056519, 1 },
-    { -0.40898901224136353, -0.36474600434303284, 0.74967402219772339, 1 },
-    { 0.2604449987411499, -0.34537801146507263, 0.76285701990127563, 1 },
-    { 0.29771700501441956, -0.36474600434303284, 0.76708900928497314, 1 },
-    { -0.29033699631690979, -0.34537801146507263, 0.76285701990127563, 1 },
-    { -0.32760900259017944, -0.36474600434303284, 0.76708900928497314, 1 },
-    { 0.22821800410747528, -0.26334699988365173, 0.76481002569198608, 1 },
-    { 0.24140200018882751, -0.3048509955406189, 0.77425098419189453, 1 },
-    { -0.25810998678207397, -0.26334699988365173, 0.76481002569198608, 1 },
-    { -0.2712939977645874, -0.3048509955406189, 0.77425098419189453, 1 },
-    { 0.2604449987411499, -0.18619799613952637, 0.76285701990127563, 1 },
-    { 0.24140200018882751, -0.22347000241279602, 0.77425098419189453, 1 },
-    { -0.29033699631690979, -0.18619799613952637, 0.76285701990127563, 1 },
-    { -0.2712939977645874, -0.22347000241279602, 0.77425098419189453, 1 },
-    { 0.33759298920631409, -0.15397199988365173, 0.74869698286056519, 1 },
-    { 0.29771700501441956, -0.16715499758720398, 0.76708900928497314, 1 },
-    { -0.36748498678207397, -0.15397199988365173, 0.74869698286056519, 1 },
-    { -0.32760900259017944, -0.16715499758720398, 0.76708900928497314, 1 },
-    { 0.41913598775863647, -0.18619799613952637, 0.73111897706985474, 1 },
-    { 0.37909701466560364, -0.16715499758720398, 0.74967402219772339, 1 },
-    { -0.44902798533439636, -0.18619799613952637, 0.73111897706985474, 1 },
-    { -0.40898901224136353, -0.16715499758720398, 0.74967402219772339, 1 },
-    { 0.4359000027179718, -0.22347000241279602, 0.73583900928497314, 1 },
-    { -0.46579200029373169, -0.22347000241279602, 0.73583900928497314, 1 },
-    { 0.38609600067138672, -0.21614600718021393, 0.75830000638961792, 1 },
-    { 0.40432500839233398, -0.26302099227905273, 0.75374299287796021, 1 },
-    { -0.41598799824714661, -0.21614600718021393, 0.75830000638961792, 1 },
-    { -0.43421700596809387, -0.26302099227905273, 0.75374299287796021, 1 },
-    { 0.33726799488067627, -0.19596399366855621, 0.77001899480819702, 1 },
-    { -0.36715999245643616, -0.19596399366855621, 0.77001899480819702, 1 },
-    { 0.29039299488067627, -0.21614600718021393, 0.77848201990127563, 1 },
-    { -0.32028499245643616, -0.21614600718021393, 0.77848201990127563, 1 },
-    { 0.27020999789237976, -0.26302099227905273, 0.77978402376174927, 1 },
-    { -0.30010199546813965, -0.26302099227905273, 0.77978402376174927, 1 },
-    { 0.29039299488067627, -0.3125, 0.77848201990127563, 1 },
-    { -0.32028499245643616, -0.3125, 0.77848201990127563, 1 },
-    { 0.33726799488067627, -0.33333399891853333, 0.77001899480819702, 1 },
-    { -0.36715999245643616, -0.33333399891853333, 0.77001899480819702, 1 },
-    { 0.38609600067138672, -0.3125, 0.75830000638961792, 1 },
-    { -0.41598799824714661, -0.3125, 0.75830000638961792, 1 },
-    { 0.14911599457263947, 0.92854797840118408, 0.54996699094772339, 1 },
-    { 0.061714000999927521, 0.91585302352905273, 0.59098201990127563, 1 },
-    { -0.014945999719202518, 0.94075500965118408, 0.56168502569198608, 1 },
-    { 0.072944998741149902, 0.94954401254653931, 0.51676398515701294, 1 },
-    { -0.091605998575687408, 0.91585302352905273, 0.59098201990127563, 1 },
-    { -0.17900900542736053, 0.92854797840118408, 0.54996699094772339, 1 },
-    { -0.10283699631690979, 0.94954401254653931, 0.51676398515701294, 1 },
-    { 0.25702700018882751, 0.90266901254653931, 0.53873598575592041, 1 },
-    { 0.17743700742721558, 0.8982740044593811, 0.58609902858734131, 1 },
-    { 0.23114800453186035, 0.92903602123260498, 0.49186098575592041, 1 },
-    { -0.20732900500297546, 0.8982740044593811, 0.58609902858734131, 1 },
-    { -0.2869189977645874, 0.90266901254653931, 0.53873598575592041, 1 },
-    { -0.26104000210762024, 0.92903602123260498, 0.49186098575592041, 1 },
-    { 0.29511299729347229, 0.82503199577331543, 0.55533802509307861, 1 },
-    { 0.23017099499702454, 0.84212201833724976, 0.59879499673843384, 1 },
-    { 0.31562000513076782, 0.87825500965118408, 0.48160699009895325, 1 },
-    { -0.26006299257278442, 0.84212201833724976, 0.59879499673843384, 1 },
-    { -0.32500499486923218, 0.82503199577331543, 0.55533802509307861, 1 },
-    { -0.34551200270652771, 0.87825500965118408, 0.48160699009895325, 1 },
-    { 0.28290599584579468, 0.66634100675582886, 0.58268100023269653, 1 },
-    { 0.23749500513076782, 0.73811799287796021, 0.62369698286056519, 1 },
-    { 0.32050299644470215, 0.7454419732093811, 0.50211501121520996, 1 },
-    { -0.26738700270652771, 0.73811799287796021, 0.62369698286056519, 1 },
-    { -0.31279799342155457, 0.66634100675582886, 0.58268100023269653, 1 },
-    { -0.35039499402046204, 0.7454419732093811, 0.50211501121520996, 1 },
-    { 0.24628399312496185, 0.43733701109886169, 0.59439998865127563, 1 },
-    { 0.21161599457263947, 0.55208301544189453, 0.64469301700592041, 1 },
-    { 0.29315900802612305, 0.52962201833724976, 0.52115797996520996, 1 },
-    { -0.24150900542736053, 0.55208301544189453, 0.64469301700592041, 1 },
-    { -0.27617698907852173, 0.43733701109886169, 0.59439998865127563, 1 },
-    { -0.32305198907852173, 0.52962201833724976, 0.52115797996520996, 1 },
-    { 0.29804199934005737, 0.12874299287796021, 0.51969301700592041, 1 },
-    { 0.39716300368309021, 0.067220002412796021, 0.56607997417449951, 1 },
-    { 0.25751501321792603, 0.049153000116348267, 0.67154902219772339, 1 },
-    { 0.18524900078773499, 0.13069599866867065, 0.62613898515701294, 1 },
-    { -0.4270550012588501, 0.067220002412796021, 0.56607997417449951, 1 },
-    { -0.32793399691581726, 0.12874299287796021, 0.51969301700592041, 1 },
-    { -0.21514099836349487, 0.13069599866867065, 0.62613898515701294, 1 },
-    { -0.28740701079368591, 0.049153000116348267, 0.67154902219772339, 1 },
-    { 0.51483899354934692, 0.052570998668670654, 0.49381399154663086, 1 },
-    { 0.60321801900863647, -0.036295998841524124, 0.53336501121520996, 1 },
-    { 0.48700699210166931, -0.01676500029861927, 0.59537702798843384, 1 },
-    { -0.63310998678207397, -0.036295998841524124, 0.53336501121520996, 1 },
-    { -0.5447310209274292, 0.052570998668670654, 0.49381399154663086, 1 },
-    { -0.5168989896774292, -0.01676500029861927, 0.59537702798843384, 1 },
-    { 0.70282697677612305, -0.087564997375011444, 0.45133399963378906, 1 },
-    { 0.74628400802612305, -0.2032880038022995, 0.499673992395401, 1 },
-    { 0.65009301900863647, -0.13932299613952637, 0.56022101640701294, 1 },
-    { -0.77617698907852173, -0.2032880038022995, 0.499673992395401, 1 },
-    { -0.73271900415420532, -0.087564997375011444, 0.45133399963378906, 1 },
-    { -0.67998498678207397, -0.13932299613952637, 0.56022101640701294, 1 },
-    { 0.80780798196792603, -0.30875700712203979, 0.4767250120639801, 1 },
-    { 0.77021002769470215, -0.40006500482559204, 0.57486897706985474, 1 },
-    { 0.72040599584579468, -0.30338600277900696, 0.57389199733734131, 1 },
-    { -0.80010199546813965, -0.40006500482559204, 0.57486897706985474, 1 },
-    { -0.8377000093460083, -0.30875700712203979, 0.4767250120639801, 1 },
-    { -0.75029802322387695, -0.30338600277900696, 0.57389199733734131, 1 },
-    { 0.75556200742721558, -0.46598300337791443, 0.55924397706985474, 1 },
-    { 0.66767102479934692, -0.47916701436042786, 0.63395100831985474, 1 },
-    { 0.69696801900863647, -0.41520199179649353, 0.63297498226165771, 1 },
-    { -0.69756299257278442, -0.47916701436042786, 0.63395100831985474, 1 },
-    { -0.78545397520065308, -0.46598300337791443, 0.55924397706985474, 1 },
-    { -0.72685998678207397, -0.41520199179649353, 0.63297498226165771, 1 },
-    { 0.57929199934005737, -0.55045598745346069, 0.60904902219772339, 1 },
-    { 0.46064001321792603, -0.59440100193023682, 0.69547498226165771, 1 },
-    { 0.54657697677612305, -0.49918600916862488, 0.69596302509307861, 1 },
-    { -0.49053201079368591, -0.59440100193023682, 0.69547498226165771, 1 },
-    { -0.60918402671813965, -0.55045598745346069, 0.60904902219772339, 1 },
-    { -0.57646900415420532, -0.49918600916862488, 0.69596302509307861, 1 },
-    { 0.38788598775863647, -0.68180400133132935, 0.66324800252914429, 1 },
-    { 0.3029249906539917, -0.69986999034881592, 0.73844301700592041, 1 },
-    { 0.36444801092147827, -0.60758501291275024, 0.74869698286056519, 1 },
-    { -0.33281698822975159, -0.69986999034881592, 0.73844301700592041, 1 },
-    { -0.41777798533439636, -0.68180400133132935, 0.66324800252914429, 1 },
-    { -0.39434099197387695, -0.60758501291275024, 0.74869698286056519, 1 },
-    { 0.2291949987411499, -0.73697900772094727, 0.69693899154663086, 1 },
-    { 0.16962400078773499, -0.66617900133132935, 0.75748598575592041, 1 },
-    { 0.2443310022354126, -0.64322900772094727, 0.77604097127914429, 1 },
-    { -0.19951599836349487, -0.66617900133132935, 0.75748598575592041, 1 },
-    { -0.25908699631690979, -0.73697900772094727, 0.69693899154663086, 1 },
-    { -0.27422299981117249, -0.64322900772094727, 0.77604097127914429, 1 },
-    { 0.10517100244760513, -0.61002600193023682, 0.70426398515701294, 1 },
-    { 0.06903800368309021, -0.49821001291275024, 0.75211501121520996, 1 },
-    { 0.13886299729347229, -0.54361999034881592, 0.78189998865127563, 1 },
-    { -0.098930001258850098, -0.49821001291275024, 0.75211501121520996, 1 },
-    { -0.13506299257278442, -0.61002600193023682, 0.70426398515701294, 1 },
-    { -0.16875499486923218, -0.54361999034881592, 0.78189998865127563, 1 },
-    { 0.021674999967217445, -0.46891298890113831, 0.69547498226165771, 1 },
-    { -0.014945999719202518, -0.42838600277900696, 0.74137300252914429, 1 },
-    { 0.045113001018762589, -0.41569000482559204, 0.76969301700592041, 1 },
-    { -0.051566999405622482, -0.46891298890113831, 0.69547498226165771, 1 },
-    { -0.075005002319812775, -0.41569000482559204, 0.76969301700592041, 1 },
-    { 0.18964399397373199, -0.46647199988365173, 0.73356002569198608, 1 },
-    { 0.21161599457263947, -0.54996800422668457, 0.75943899154663086, 1 },
-    { 0.12079600244760513, -0.4454759955406189, 0.76236897706985474, 1 },
-    { -0.24150900542736053, -0.54996800422668457, 0.75943899154663086, 1 },
-    { -0.21953600645065308, -0.46647199988365173, 0.73356002569198608, 1 },
-    { -0.15068799257278442, -0.4454759955406189, 0.76236897706985474, 1 },
-    { 0.27216300368309021, -0.50651097297668457, 0.71988898515701294, 1 },
-    { 0.30780801177024841, -0.56852197647094727, 0.74332600831985474, 1 },
-    { -0.3377000093460083, -0.56852197647094727, 0.74332600831985474, 1 },
-    { -0.3020550012588501, -0.50651097297668457, 0.71988898515701294, 1 },
-    { 0.43085500597953796, -0.50846397876739502, 0.71012300252914429, 1 },
-    { 0.36347201466560364, -0.48893299698829651, 0.70182198286056519, 1 },
-    { -0.46074700355529785, -0.50846397876739502, 0.71012300252914429, 1 },
-    { -0.39336401224136353, -0.48893299698829651, 0.70182198286056519, 1 },
-    { 0.60907697677612305, -0.41959699988365173, 0.65397101640701294, 1 },
-    { 0.50360900163650513, -0.43180400133132935, 0.66178297996520996, 1 },
-    { -0.63896900415420532, -0.41959699988365173, 0.65397101640701294, 1 },
-    { -0.5335010290145874, -0.43180400133132935, 0.66178297996520996, 1 },
-    { 0.66864800453186035, -0.34586599469184875, 0.61051398515701294, 1 },
-    { 0.6120070219039917, -0.36149099469184875, 0.62125599384307861, 1 },
-    { -0.69853997230529785, -0.34586599469184875, 0.61051398515701294, 1 },
-    { -0.6418989896774292, -0.36149099469184875, 0.62125599384307861, 1 },
-    { 0.64765197038650513, -0.21598300337791443, 0.58756399154663086, 1 },
-    { 0.62421399354934692, -0.26822900772094727, 0.60660701990127563, 1 },
-    { -0.6775439977645874, -0.21598300337791443, 0.58756399154663086, 1 },
-    { -0.6541060209274292, -0.26822900772094727, 0.60660701990127563, 1 },
-    { 0.5338820219039917, -0.08658900111913681, 0.60660701990127563, 1 },
-    { 0.55390197038650513, -0.1486009955406189, 0.61539602279663086, 1 },
-    { -0.5637739896774292, -0.08658900111913681, 0.60660701990127563, 1 },
-    { -0.5837939977645874, -0.1486009955406189, 0.61539602279663086, 1 },
-    { 0.36493700742721558, -0.015300000086426735, 0.65006399154663086, 1 },
-    { 0.42694801092147827, -0.060221999883651733, 0.64420497417449951, 1 },
-    { -0.39482900500297546, -0.015300000086426735, 0.65006399154663086, 1 },
-    { -0.45684099197387695, -0.060221999883651733, 0.64420497417449951, 1 },
-    { 0.1666949987411499, -0.027018999680876732, 0.71744698286056519, 1 },
-    { 0.27216300368309021, -0.062662996351718903, 0.68619698286056519, 1 },
-    { -0.19658699631690979, -0.027018999680876732, 0.71744698286056519, 1 },
-    { -0.3020550012588501, -0.062662996351718903, 0.68619698286056519, 1 },
-    { 0.15644100308418274, -0.1212569996714592, 0.70914602279663086, 1 },
-    { 0.075386002659797668, -0.11637400090694427, 0.70231002569198608, 1 },
-    { 0.061225999146699905, 0.0037430000957101583, 0.71939998865127563, 1 },
-    { -0.10527800023555756, -0.11637400090694427, 0.70231002569198608, 1 },
-    { -0.18633300065994263, -0.1212569996714592, 0.70914602279663086, 1 },
-    { -0.091118000447750092, 0.0037430000957101583, 0.71939998865127563, 1 },
-    { 0.056830998510122299, -0.34537801146507263, 0.74723201990127563, 1 },
-    { 0.12421400099992752, -0.38053399324417114, 0.73502498865127563, 1 },
-    { -0.15410600602626801, -0.38053399324417114, 0.73502498865127563, 1 },
-    { -0.086722999811172485, -0.34537801146507263, 0.74723201990127563, 1 },
-    { -0.014945999719202518, -0.29557299613952637, 0.74137300252914429, 1 },
-    { 0.052925001829862595, -0.23112000524997711, 0.71891200542449951, 1 },
-    { 0.1037060022354126, -0.28092500567436218, 0.72428297996520996, 1 },
-    { -0.13359799981117249, -0.28092500567436218, 0.72428297996520996, 1 },
-    { -0.082817003130912781, -0.23112000524997711, 0.71891200542449951, 1 },
-    { 0.11884299665689468, -0.1915690004825592, 0.71207600831985474, 1 },
-    { -0.014945999719202518, -0.16080799698829651, 0.70426398515701294, 1 },
-    { -0.14873500168323517, -0.1915690004825592, 0.71207600831985474, 1 },
-    { 0.021674999967217445, 0.87093102931976318, 0.64029902219772339, 1 },
-    { -0.014945999719202518, 0.89485597610473633, 0.62027901411056519, 1 },
-    { 0.09198799729347229, 0.88362598419189453, 0.62125599384307861, 1 },
-    { -0.051566999405622482, 0.87093102931976318, 0.64029902219772339, 1 },
-    { -0.12188000231981277, 0.88362598419189453, 0.62125599384307861, 1 },
-    { 0.086127996444702148, 0.84505200386047363, 0.65006399154663086, 1 },
-    { 0.15448799729347229, 0.84553998708724976, 0.63053297996520996, 1 },
-    { -0.11602000147104263, 0.84505200386047363, 0.65006399154663086, 1 },
-    { -0.18437999486923218, 0.84553998708724976, 0.63053297996520996, 1 },
-    { 0.11298400163650513, 0.76888000965118408, 0.66910701990127563, 1 },
-    { 0.17060099542140961, 0.75325500965118408, 0.65348201990127563, 1 },
-    { -0.14287599921226501, 0.76888000965118408, 0.66910701990127563, 1 },
-    { -0.20049299299716949, 0.75325500965118408, 0.65348201990127563, 1 },
-    { 0.13300299644470215, 0.43831399083137512, 0.68375599384307861, 1 },
-    { 0.087104998528957367, 0.54671198129653931, 0.69303297996520996, 1 },
-    { 0.16425299644470215, 0.65315699577331543, 0.66813099384307861, 1 },
-    { -0.11699700355529785, 0.54671198129653931, 0.69303297996520996, 1 },
-    { -0.16289499402046204, 0.43831399083137512, 0.68375599384307861, 1 },
-    { -0.19414499402046204, 0.65315699577331543, 0.66813099384307861, 1 },
-    { 0.10224100202322006, 0.69270801544189453, 0.68326699733734131, 1 },
-    { -0.13213400542736053, 0.69270801544189453, 0.68326699733734131, 1 },
-    { 0.028023000806570053, 0.30403599143028259, 0.70426398515701294, 1 },
-    { -0.014945999719202518, 0.36165300011634827, 0.70231002569198608, 1 },
-    { 0.027046000584959984, 0.43782499432563782, 0.70328700542449951, 1 },
-    { 0.070991002023220062, 0.35091099143028259, 0.69791597127914429, 1 },
-    { -0.057914998382329941, 0.30403599143028259, 0.70426398515701294, 1 },
-    { -0.10088399797677994, 0.35091099143028259, 0.69791597127914429, 1 },
-    { -0.056938000023365021, 0.43782499432563782, 0.70328700542449951, 1 },
-    { -0.014945999719202518, 0.54329401254653931, 0.69840401411056519, 1 },
-    { 0.040718000382184982, 0.64095002412796021, 0.69254499673843384, 1 },
-    { -0.070610001683235168, 0.64095002412796021, 0.69254499673843384, 1 },
-    { 0.039253000169992447, 0.71663397550582886, 0.68912702798843384, 1 },
-    { -0.014945999719202518, 0.69759100675582886, 0.69059199094772339, 1 },
-    { -0.069145001471042633, 0.71663397550582886, 0.68912702798843384, 1 },
-    { 0.10614799708127975, 0.20247399806976318, 0.72672498226165771, 1 },
-    { 0.094916999340057373, 0.22932900488376617, 0.74332600831985474, 1 },
-    { 0.068549998104572296, 0.25960299372673035, 0.71939998865127563, 1 },
-    { 0.099799998104572296, 0.23909500241279602, 0.70328700542449951, 1 },
-    { -0.12480899691581726, 0.22932900488376617, 0.74332600831985474, 1 },
-    { -0.13604000210762024, 0.20247399806976318, 0.72672498226165771, 1 },
-    { -0.12969200313091278, 0.23909500241279602, 0.70328700542449951, 1 },
-    { -0.098442003130912781, 0.25960299372673035, 0.71939998865127563, 1 },
-    { 0.082709997892379761, 0.13020800054073334, 0.71939998865127563, 1 },
-    { 0.10272999852895737, 0.16194599866867065, 0.74381399154663086, 1 },
-    { 0.10321799665689468, 0.16438800096511841, 0.70963501930236816, 1 },
-    { -0.13262200355529785, 0.16194599866867065, 0.74381399154663086, 1 },
-    { -0.11260200291872025, 0.13020800054073334, 0.71939998865127563, 1 },
-    { -0.13311000168323517, 0.16438800096511841, 0.70963501930236816, 1 },
-    { 0.012885999865829945, 0.1209309995174408, 0.71939998865127563, 1 },
-    { 0.055854998528957367, 0.11360599845647812, 0.73649001121520996, 1 },
-    { 0.040229998528957367, 0.10774700343608856, 0.70670497417449951, 1 },
-    { -0.085747003555297852, 0.11360599845647812, 0.73649001121520996, 1 },
-    { -0.042778000235557556, 0.1209309995174408, 0.71939998865127563, 1 },
-    { -0.070122003555297852, 0.10774700343608856, 0.70670497417449951, 1 },
-    { -0.014945999719202518, 0.15657499432563782, 0.72672498226165771, 1 },
-    { 0.0026320000179111958, 0.13997399806976318, 0.74381399154663086, 1 },
-    { -0.014945999719202518, 0.14485600590705872, 0.71305298805236816, 1 },
-    { -0.032524000853300095, 0.13997399806976318, 0.74381399154663086, 1 },
-    { 0.030463999137282372, 0.27473899722099304, 0.73551398515701294, 1 },
-    { -0.014945999719202518, 0.29329401254653931, 0.71793502569198608, 1 },
-    { -0.060355998575687408, 0.27473899722099304, 0.73551398515701294, 1 },
-    { 0.064644001424312592, 0.24251300096511841, 0.75162702798843384, 1 },
-    { 0.027046000584959984, 0.2459309995174408, 0.76090401411056519, 1 },
-    { -0.014945999719202518, 0.27376300096511841, 0.74918502569198608, 1 },
-    { -0.094535999000072479, 0.24251300096511841, 0.75162702798843384, 1 },
-    { -0.056938000023365021, 0.2459309995174408, 0.76090401411056519, 1 },
-    { -0.014945999719202518, 0.16048100590705872, 0.76481002569198608, 1 },
-    { 0.017768999561667442, 0.15511000156402588, 0.77262300252914429, 1 },
-    { 0.029975999146699905, 0.1248370036482811, 0.75504499673843384, 1 },
-    { -0.047660999000072479, 0.15511000156402588, 0.77262300252914429, 1 },
-    { -0.059868000447750092, 0.1248370036482811, 0.75504499673843384, 1 },
-    { 0.053902000188827515, 0.13704399764537811, 0.76676398515701294, 1 },
-    { 0.081734001636505127, 0.13362599909305573, 0.75504499673843384, 1 },
-    { -0.083793997764587402, 0.13704399764537811, 0.76676398515701294, 1 },
-    { -0.11162599921226501, 0.13362599909305573, 0.75504499673843384, 1 },
-    { 0.079291999340057373, 0.1678059995174408, 0.77262300252914429, 1 },
-    { 0.099311999976634979, 0.20052100718021393, 0.76432198286056519, 1 },
-    { -0.10918399691581726, 0.1678059995174408, 0.77262300252914429, 1 },
-    { -0.12920400500297546, 0.20052100718021393, 0.76432198286056519, 1 },
-    { 0.069527000188827515, 0.22054000198841095, 0.76920497417449951, 1 },
-    { -0.099418997764587402, 0.22054000198841095, 0.76920497417449951, 1 },
-    { 0.039740998297929764, 0.19368499517440796, 0.77945899963378906, 1 },
-    { -0.069633997976779938, 0.19368499517440796, 0.77945899963378906, 1 },
-    { -0.014945999719202518, 0.22395800054073334, 0.77262300252914429, 1 },
-    { 0.088081002235412598, 0.10872399806976318, 0.72232997417449951, 1 },
-    { -0.014945999719202518, 0.046224001795053482, 0.70133399963378906, 1 },
-    { -0.11797299981117249, 0.10872399806976318, 0.72232997417449951, 1 },
-    { 0.12421400099992752, 0.20882099866867065, 0.69205701351165771, 1 },
-    { 0.1349560022354126, 0.15950499475002289, 0.69059199094772339, 1 },
-    { -0.15410600602626801, 0.20882099866867065, 0.69205701351165771, 1 },
-    { -0.16484799981117249, 0.15950499475002289, 0.69059199094772339, 1 },
-    { 0.12079600244760513, 0.29036399722099304, 0.68375599384307861, 1 },
-    { 0.15790599584579468, 0.25520798563957214, 0.65201699733734131, 1 },
-    { -0.15068799257278442, 0.29036399722099304, 0.68375599384307861, 1 },
-    { -0.18779799342155457, 0.25520798563957214, 0.65201699733734131, 1 },
-    { 0.17743700742721558, 0.35677099227905273, 0.65299397706985474, 1 },
-    { -0.20732900500297546, 0.35677099227905273, 0.65299397706985474, 1 },
-    { 0.25165599584579468, 0.34798100590705872, 0.51920497417449951, 1 },
-    { 0.20673400163650513, 0.30013000965118408, 0.59000599384307861, 1 },
-    { -0.23662599921226501, 0.30013000965118408, 0.59000599384307861, 1 },
-    { -0.28154799342155457, 0.34798100590705872, 0.51920497417449951, 1 },
-    { 0.21796399354934692, 0.25716099143028259, 0.51725202798843384, 1 },
-    { 0.1823199987411499, 0.22151699662208557, 0.59586501121520996, 1 },
-    { -0.21221199631690979, 0.22151699662208557, 0.59586501121520996, 1 },
-    { -0.24785600602626801, 0.25716099143028259, 0.51725202798843384, 1 },
-    { 0.19306200742721558, 0.19026699662208557, 0.53092402219772339, 1 },
-    { -0.22295400500297546, 0.19026699662208557, 0.53092402219772339, 1 },
-    { -0.014945999719202518, 0.73958301544189453, 0.68375599384307861, 1 },
-    { 0.032905999571084976, 0.73665297031402588, 0.67252498865127563, 1 },
-    { 0.07440900057554245, 0.72737598419189453, 0.68375599384307861, 1 },
-    { -0.10430199652910233, 0.72737598419189453, 0.68375599384307861, 1 },
-    { -0.062798000872135162, 0.73665297031402588, 0.67252498865127563, 1 },
-    { 0.081244997680187225, 0.76057898998260498, 0.66715401411056519, 1 },
-    { 0.083686999976634979, 0.80159497261047363, 0.66715401411056519, 1 },
-    { -0.11357899755239487, 0.80159497261047363, 0.66715401411056519, 1 },
-    { -0.11113700270652771, 0.76057898998260498, 0.66715401411056519, 1 },
-    { 0.057808000594377518, 0.82405602931976318, 0.64811098575592041, 1 },
-    { 0.039253000169992447, 0.84993499517440796, 0.64957600831985474, 1 },
-    { -0.069145001471042633, 0.84993499517440796, 0.64957600831985474, 1 },
-    { -0.087700001895427704, 0.82405602931976318, 0.64811098575592041, 1 },
-    { 0.0094680003821849823, 0.85091102123260498, 0.63736897706985474, 1 },
-    { -0.014945999719202518, 0.86067700386047363, 0.64469301700592041, 1 },
-    { -0.039360001683235168, 0.85091102123260498, 0.63736897706985474, 1 },
-    { 0.031929001212120056, 0.83479797840118408, 0.61832600831985474, 1 },
-    { 0.011420999653637409, 0.82600897550582886, 0.59928297996520996, 1 },
-    { -0.014945999719202518, 0.84505200386047363, 0.61637300252914429, 1 },
-    { -0.061820998787879944, 0.83479797840118408, 0.61832600831985474, 1 },
-    { -0.041313000023365021, 0.82600897550582886, 0.59928297996520996, 1 },
-    { 0.072944998741149902, 0.79280602931976318, 0.63248598575592041, 1 },
-    { 0.057319998741149902, 0.80647802352905273, 0.60302698612213135, 1 },
-    { -0.10283699631690979, 0.79280602931976318, 0.63248598575592041, 1 },
-    { -0.08721199631690979, 0.80647802352905273, 0.60302698612213135, 1 },
-    { 0.067084997892379761, 0.73860698938369751, 0.64811098575592041, 1 },
-    { 0.074897997081279755, 0.76692700386047363, 0.61523401737213135, 1 },
-    { -0.096977002918720245, 0.73860698938369751, 0.64811098575592041, 1 },
-    { -0.10479000210762024, 0.76692700386047363, 0.61523401737213135, 1 },
-    { -0.014945999719202518, 0.74934899806976318, 0.64566999673843384, 1 },
-    { 0.028999000787734985, 0.75569599866867065, 0.62076699733734131, 1 },
-    { -0.058890998363494873, 0.75569599866867065, 0.62076699733734131, 1 },
-    { -0.014945999719202518, 0.79524701833724976, 0.60172402858734131, 1 },
-    { 0.048530999571084976, 0.78401702642440796, 0.60351502895355225, 1 },
-    { -0.078423000872135162, 0.78401702642440796, 0.60351502895355225, 1 },
-    { 0.16278800368309021, -0.17106099426746368, 0.71891200542449951, 1 },
-    { 0.16327700018882751, -0.20768299698829651, 0.72721302509307861, 1 },
-    { 0.14032700657844543, -0.23746800422668457, 0.72526001930236816, 1 },
-    { -0.1926800012588501, -0.17106099426746368, 0.71891200542449951, 1 },
-    { -0.17021900415420532, -0.23746800422668457, 0.72526001930236816, 1 },
-    { -0.1931689977645874, -0.20768299698829651, 0.72721302509307861, 1 },
-    { 0.15741699934005737, -0.27848300337791443, 0.73160701990127563, 1 },
-    { 0.14179199934005737, -0.32194000482559204, 0.72965401411056519, 1 },
-    { -0.17168399691581726, -0.32194000482559204, 0.72965401411056519, 1 },
-    { -0.18730899691581726, -0.27848300337791443, 0.73160701990127563, 1 },
-    { 0.17645999789237976, -0.35807299613952637, 0.73307198286056519, 1 },
-    { 0.17743700742721558, -0.40934300422668457, 0.73160701990127563, 1 },
-    { -0.20732900500297546, -0.40934300422668457, 0.73160701990127563, 1 },
-    { -0.20635199546813965, -0.35807299613952637, 0.73307198286056519, 1 },
-    { 0.21503399312496185, -0.11979199945926666, 0.71305298805236816, 1 },
-    { 0.19110900163650513, -0.15299500524997711, 0.72672498226165771, 1 },
-    { -0.24492700397968292, -0.11979199945926666, 0.71305298805236816, 1 },
-    { -0.22100099921226501, -0.15299500524997711, 0.72672498226165771, 1 },
-    { 0.3537060022354126, -0.072429001331329346, 0.68033802509307861, 1 },
-    { 0.28534701466560364, -0.10465499758720398, 0.71061098575592041, 1 },
-    { -0.38359799981117249, -0.072429001331329346, 0.68033802509307861, 1 },
-    { -0.31523901224136353, -0.10465499758720398, 0.71061098575592041, 1 },
-    { 0.47040599584579468, -0.11051499843597412, 0.65104097127914429, 1 },
-    { 0.41083499789237976, -0.09928400069475174, 0.67936098575592041, 1 },
-    { -0.50029802322387695, -0.11051499843597412, 0.65104097127914429, 1 },
-    { -0.44072699546813965, -0.09928400069475174, 0.67936098575592041, 1 },
-    { 0.57343298196792603, -0.21061199903488159, 0.62467402219772339, 1 },
-    { 0.5133739709854126, -0.16764399409294128, 0.64908802509307861, 1 },
-    { -0.6033250093460083, -0.21061199903488159, 0.62467402219772339, 1 },
-    { -0.54326599836349487, -0.16764399409294128, 0.64908802509307861, 1 },
-    { 0.59296399354934692, -0.30924499034881592, 0.62516200542449951, 1 },
-    { 0.56952697038650513, -0.26285800337791443, 0.63395100831985474, 1 },
-    { -0.6228560209274292, -0.30924499034881592, 0.62516200542449951, 1 },
-    { -0.5994189977645874, -0.26285800337791443, 0.63395100831985474, 1 },
-    { 0.55146002769470215, -0.38151100277900696, 0.64274001121520996, 1 },
-    { 0.5612260103225708, -0.34098300337791443, 0.64127498865127563, 1 },
-    { -0.58135199546813965, -0.38151100277900696, 0.64274001121520996, 1 },
-    { -0.5911179780960083, -0.34098300337791443, 0.64127498865127563, 1 },
-    { 0.41864800453186035, -0.43571001291275024, 0.69449800252914429, 1 },
-    { 0.47773000597953796, -0.39762398600578308, 0.68277901411056519, 1 },
-    { -0.44854000210762024, -0.43571001291275024, 0.69449800252914429, 1 },
-    { -0.50762200355529785, -0.39762398600578308, 0.68277901411056519, 1 },
-    { 0.32001501321792603, -0.46793600916862488, 0.70768201351165771, 1 },
-    { 0.36347201466560364, -0.43766298890113831, 0.71549397706985474, 1 },
-    { -0.34990701079368591, -0.46793600916862488, 0.70768201351165771, 1 },
-    { -0.39336401224136353, -0.43766298890113831, 0.71549397706985474, 1 },
-    { 0.24628399312496185, -0.46012398600578308, 0.72135299444198608, 1 },
-    { 0.28827700018882751, -0.44889399409294128, 0.71891200542449951, 1 },
-    { -0.27617698907852173, -0.46012398600578308, 0.72135299444198608, 1 },
-    { -0.3181689977645874, -0.44889399409294128, 0.71891200542449951, 1 },
-    { 0.22480000555515289, -0.42155000567436218, 0.73014199733734131, 1 },
-    { -0.25469198822975159, -0.42155000567436218, 0.73014199733734131, 1 },
-    { 0.21015200018882751, -0.38395199179649353, 0.72574800252914429, 1 },
-    { 0.24286599457263947, -0.39908900856971741, 0.71793502569198608, 1 },
-    { 0.26288598775863647, -0.4259440004825592, 0.72379499673843384, 1 },
-    { -0.2400439977645874, -0.38395199179649353, 0.72574800252914429, 1 },
-    { -0.29277798533439636, -0.4259440004825592, 0.72379499673843384, 1 },
-    { -0.27275899052619934, -0.39908900856971741, 0.71793502569198608, 1 },
-    { 0.29364800453186035, -0.42252600193023682, 0.71402901411056519, 1 },
-    { 0.32392099499702454, -0.43424499034881592, 0.71305298805236816, 1 },
-    { -0.35381299257278442, -0.43424499034881592, 0.71305298805236816, 1 },
-    { -0.32354000210762024, -0.42252600193023682, 0.71402901411056519, 1 },
-    { 0.36005398631095886, -0.41861999034881592, 0.70621699094772339, 1 },
-    { 0.40888199210166931, -0.41129601001739502, 0.70768201351165771, 1 },
-    { -0.4387739896774292, -0.41129601001739502, 0.70768201351165771, 1 },
-    { -0.38994601368904114, -0.41861999034881592, 0.70621699094772339, 1 },
-    { 0.45770999789237976, -0.38346400856971741, 0.67106002569198608, 1 },
-    { 0.51874500513076782, -0.36295598745346069, 0.65201699733734131, 1 },
-    { -0.54863697290420532, -0.36295598745346069, 0.65201699733734131, 1 },
-    { -0.48760199546813965, -0.38346400856971741, 0.67106002569198608, 1 },
-    { 0.52802300453186035, -0.32877600193023682, 0.63199800252914429, 1 },
-    { 0.55146002769470215, -0.30240899324417114, 0.63639199733734131, 1 },
-    { -0.58135199546813965, -0.30240899324417114, 0.63639199733734131, 1 },
-    { -0.55791497230529785, -0.32877600193023682, 0.63199800252914429, 1 },
-    { 0.53583502769470215, -0.26627600193023682, 0.62809199094772339, 1 },
-    { 0.53681200742721558, -0.22184300422668457, 0.63688099384307861, 1 },
-    { -0.56670397520065308, -0.22184300422668457, 0.63688099384307861, 1 },
-    { -0.56572699546813965, -0.26627600193023682, 0.62809199094772339, 1 },
-    { 0.48895999789237976, -0.18424500524997711, 0.64371699094772339, 1 },
-    { 0.45380398631095886, -0.13688200712203979, 0.66568899154663086, 1 },
-    { -0.48369601368904114, -0.13688200712203979, 0.66568899154663086, 1 },
-    { -0.51885199546813965, -0.18424500524997711, 0.64371699094772339, 1 },
-    { 0.40302300453186035, -0.12174499779939651, 0.67106002569198608, 1 },
-    { 0.3541949987411499, -0.10416699945926666, 0.69205701351165771, 1 },
-    { -0.38408699631690979, -0.10416699945926666, 0.69205701351165771, 1 },
-    { -0.43291500210762024, -0.12174499779939651, 0.67106002569198608, 1 },
-    { 0.29364800453186035, -0.12565100193023682, 0.69840401411056519, 1 },
-    { 0.23212400078773499, -0.13785800337791443, 0.72037702798843384, 1 },
-    { -0.26201599836349487, -0.13785800337791443, 0.72037702798843384, 1 },
-    { -0.32354000210762024, -0.12565100193023682, 0.69840401411056519, 1 },
-    { 0.20770999789237976, -0.16862000524997711, 0.71012300252914429, 1 },
-    { 0.18378399312496185, -0.18570999801158905, 0.71939998865127563, 1 },
-    { -0.21367700397968292, -0.18570999801158905, 0.71939998865127563, 1 },
-    { -0.23760199546813965, -0.16862000524997711, 0.71012300252914429, 1 },
-    { 0.17645999789237976, -0.3165690004825592, 0.72526001930236816, 1 },
-    { 0.19989800453186035, -0.34830799698829651, 0.71402901411056519, 1 },
-    { -0.20635199546813965, -0.3165690004825592, 0.72526001930236816, 1 },
-    { -0.22979000210762024, -0.34830799698829651, 0.71402901411056519, 1 },
-    { 0.17060099542140961, -0.24479199945926666, 0.72184199094772339, 1 },
-    { 0.18036599457263947, -0.28190100193023682, 0.71012300252914429, 1 },
-    { -0.20049299299716949, -0.24479199945926666, 0.72184199094772339, 1 },
-    { -0.21025900542736053, -0.28190100193023682, 0.71012300252914429, 1 },
-    { 0.18427300453186035, -0.21940100193023682, 0.70621699094772339, 1 },
-    { -0.21416500210762024, -0.21940100193023682, 0.70621699094772339, 1 },
-    { 0.071479998528957367, -0.51627600193023682, 0.63590401411056519, 1 },
-    { 0.032253999263048172, -0.46858799457550049, 0.57633399963378906, 1 },
-    { -0.014945999719202518, -0.45280000567436218, 0.63004499673843384, 1 },
-    { -0.10137200355529785, -0.51627600193023682, 0.63590401411056519, 1 },
-    { -0.062146998941898346, -0.46858799457550049, 0.57633399963378906, 1 },
-    { 0.16864800453186035, -0.68863999843597412, 0.63981002569198608, 1 },
-    { 0.16425299644470215, -0.59537798166275024, 0.58219301700592041, 1 },
-    { -0.19854000210762024, -0.68863999843597412, 0.63981002569198608, 1 },
-    { -0.19414499402046204, -0.59537798166275024, 0.58219301700592041, 1 },
-    { 0.31415599584579468, -0.72086602449417114, 0.61783802509307861, 1 },
-    { 0.25116699934005737, -0.68278002738952637, 0.57633399963378906, 1 },
-    { -0.34404799342155457, -0.72086602449417114, 0.61783802509307861, 1 },
-    { -0.28105899691581726, -0.68278002738952637, 0.57633399963378906, 1 },
-    { 0.4791949987411499, -0.60270202159881592, 0.57486897706985474, 1 },
-    { 0.36249500513076782, -0.64127600193023682, 0.55240797996520996, 1 },
-    { -0.50908702611923218, -0.60270202159881592, 0.57486897706985474, 1 },
-    { -0.39238700270652771, -0.64127600193023682, 0.55240797996520996, 1 },
-    { 0.67108899354934692, -0.49625700712203979, 0.51871699094772339, 1 },
-    { 0.5651320219039917, -0.52701902389526367, 0.47525998950004578, 1 },
-    { -0.7009810209274292, -0.49625700712203979, 0.51871699094772339, 1 },
-    { -0.5950239896774292, -0.52701902389526367, 0.47525998950004578, 1 },
-    { 0.79315900802612305, -0.41178399324417114, 0.47281798720359802, 1 },
-    { 0.72187000513076782, -0.45328798890113831, 0.42838498950004578, 1 },
-    { -0.82305198907852173, -0.41178399324417114, 0.47281798720359802, 1 },
-    { -0.75176197290420532, -0.45328798890113831, 0.42838498950004578, 1 },
-    { 0.76630401611328125, -0.18717500567436218, 0.38932201266288757, 1 },
-    { 0.77802300453186035, -0.31022199988365173, 0.359048992395401, 1 },
-    { -0.79619598388671875, -0.18717500567436218, 0.38932201266288757, 1 },
-    { -0.80791497230529785, -0.31022199988365173, 0.359048992395401, 1 },
-    { 0.60272997617721558, -0.010417000390589237, 0.42740800976753235, 1 },
-    { 0.69110900163650513, -0.10026100277900696, 0.32145100831985474, 1 },
-    { -0.63262200355529785, -0.010417000390589237, 0.42740800976753235, 1 },
-    { -0.7210010290145874, -0.10026100277900696, 0.32145100831985474, 1 },
-    { 0.41571798920631409, 0.092610001564025879, 0.45719298720359802, 1 },
-    { 0.51288598775863647, 0.039875999093055725, 0.36783799529075623, 1 },
-    { -0.44560998678207397, 0.092610001564025879, 0.45719298720359802, 1 },
-    { -0.54277801513671875, 0.039875999093055725, 0.36783799529075623, 1 },
-    { -0.014945999719202518, 0.49446600675582886, 0.25895100831985474, 1 },
-    { 0.073432996869087219, 0.43928998708724976, 0.22281800210475922, 1 },
-    { 0.12958499789237976, 0.45638000965118408, 0.27506399154663086, 1 },
-    { 0.051947999745607376, 0.54964202642440796, 0.28922399878501892, 1 },
-    { -0.1033250018954277, 0.43928998708724976, 0.22281800210475922, 1 },
-    { -0.08184099942445755, 0.54964202642440796, 0.28922399878501892, 1 },
-    { -0.15947699546813965, 0.45638000965118408, 0.27506399154663086, 1 },
-    { -0.014945999719202518, 0.65755200386047363, 0.2960599958896637, 1 },
-    { 0.11835499852895737, 0.62776702642440796, 0.31852099299430847, 1 },
-    { 0.055854998528957367, 0.75520801544189453, 0.32145100831985474, 1 },
-    { -0.085747003555297852, 0.75520801544189453, 0.32145100831985474, 1 },
-    { -0.14824700355529785, 0.62776702642440796, 0.31852099299430847, 1 },
-    { -0.014945999719202518, 0.86067700386047363, 0.3585599958896637, 1 },
-    { 0.13788600265979767, 0.83138000965118408, 0.35709598660469055, 1 },
-    { 0.066596999764442444, 0.92024701833724976, 0.40836501121520996, 1 },
-    { -0.096488997340202332, 0.92024701833724976, 0.40836501121520996, 1 },
-    { -0.16777800023555756, 0.83138000965118408, 0.35709598660469055, 1 },
-    { -0.014945999719202518, 0.95442700386047363, 0.46988898515701294, 1 },
-    { 0.15497599542140961, 0.93636000156402588, 0.45084598660469055, 1 },
-    { -0.18486799299716949, 0.93636000156402588, 0.45084598660469055, 1 },
-    { 0.22821800410747528, 0.88850897550582886, 0.38395100831985474, 1 },
-    { 0.29364800453186035, 0.89680999517440796, 0.4210599958896637, 1 },
-    { -0.32354000210762024, 0.89680999517440796, 0.4210599958896637, 1 },
-    { -0.25810998678207397, 0.88850897550582886, 0.38395100831985474, 1 },
-    { 0.27899900078773499, 0.81038397550582886, 0.36539599299430847, 1 },
-    { 0.30976098775863647, 0.77132099866867065, 0.41666600108146667, 1 },
-    { -0.33965298533439636, 0.77132099866867065, 0.41666600108146667, 1 },
-    { -0.30889099836349487, 0.81038397550582886, 0.36539599299430847, 1 },
-    { 0.24872599542140961, 0.61409497261047363, 0.36051398515701294, 1 },
-    { 0.28583499789237976, 0.57747399806976318, 0.43473199009895325, 1 },
-    { -0.31572699546813965, 0.57747399806976318, 0.43473199009895325, 1 },
-    { -0.27861800789833069, 0.61409497261047363, 0.36051398515701294, 1 },
-    { 0.20038600265979767, 0.71175098419189453, 0.33658799529075623, 1 },
-    { 0.17841300368309021, 0.50911402702331543, 0.32584598660469055, 1 },
-    { -0.23027800023555756, 0.71175098419189453, 0.33658799529075623, 1 },
-    { -0.2083050012588501, 0.50911402702331543, 0.32584598660469055, 1 },
-    { 0.22724099457263947, 0.4295240044593811, 0.36490800976753235, 1 },
-    { 0.19062000513076782, 0.37386000156402588, 0.28922399878501892, 1 },
-    { -0.25713399052619934, 0.4295240044593811, 0.36490800976753235, 1 },
-    { -0.22051200270652771, 0.37386000156402588, 0.28922399878501892, 1 },
-    { 0.25751501321792603, 0.38753199577331543, 0.44400998950004578, 1 },
-    { -0.28740701079368591, 0.38753199577331543, 0.44400998950004578, 1 },
-    { 0.22577700018882751, 0.28157499432563782, 0.45035699009895325, 1 },
-    { 0.22968299686908722, 0.22200499475002289, 0.40104100108146667, 1 },
-    { 0.20722199976444244, 0.21809899806976318, 0.4679349958896637, 1 },
-    { -0.2595750093460083, 0.22200499475002289, 0.40104100108146667, 1 },
-    { -0.2556689977645874, 0.28157499432563782, 0.45035699009895325, 1 },
-    { -0.23711399734020233, 0.21809899806976318, 0.4679349958896637, 1 },
-    { 0.21503399312496185, 0.31428998708724976, 0.36637300252914429, 1 },
-    { -0.24492700397968292, 0.31428998708724976, 0.36637300252914429, 1 },
-    { 0.21275599300861359, 0.17268800735473633, 0.44856700301170349, 1 },
-    { 0.21991699934005737, 0.15901699662208557, 0.48111900687217712, 1 },
-    { -0.24980899691581726, 0.15901699662208557, 0.48111900687217712, 1 },
-    { -0.24264800548553467, 0.17268800735473633, 0.44856700301170349, 1 },
-    { 0.29625201225280762, 0.12434899806976318, 0.44710201025009155, 1 },
-    { -0.3261440098285675, 0.12434899806976318, 0.44710201025009155, 1 },
-    { 0.16132299602031708, -0.10807300359010696, -0.77620500326156616, 1 },
-    { 0.29446199536323547, 0.022786000743508339, -0.65934300422668457, 1 },
-    { 0.15351100265979767, 0.14436799287796021, -0.62972098588943481, 1 },
-    { -0.014945999719202518, 0.03841099888086319, -0.75667399168014526, 1 },
-    { -0.32435399293899536, 0.022786000743508339, -0.65934300422668457, 1 },
-    { -0.19121600687503815, -0.10807300359010696, -0.77620500326156616, 1 },
-    { -0.18340300023555756, 0.14436799287796021, -0.62972098588943481, 1 },
-    { 0.28241699934005737, 0.19954399764537811, -0.45686900615692139, 1 },
-    { 0.13105000555515289, 0.31526699662208557, -0.3289400041103363, 1 },
-    { -0.014945999719202518, 0.25423100590705872, -0.52815800905227661, 1 },
-    { -0.31230899691581726, 0.19954399764537811, -0.45686900615692139, 1 },
-    { -0.16094200313091278, 0.31526699662208557, -0.3289400041103363, 1 },
-    { 0.22773000597953796, 0.31917300820350647, -0.096028998494148254, 1 },
-    { 0.093941003084182739, 0.39876300096511841, 0.083169996738433838, 1 },
-    { -0.014945999719202518, 0.38411399722099304, -0.11800199747085571, 1 },
-    { -0.25762200355529785, 0.31917300820350647, -0.096028998494148254, 1 },
-    { -0.12383300065994263, 0.39876300096511841, 0.083169996738433838, 1 },
-    { 0.15985900163650513, 0.38020798563957214, 0.19596299529075623, 1 },
-    { -0.014945999719202518, 0.43489599227905273, 0.18473200500011444, 1 },
-    { -0.18975099921226501, 0.38020798563957214, 0.19596299529075623, 1 },
-    { 0.21487200260162354, 0.30794200301170349, 0.24511599540710449, 1 },
-    { -0.24476400017738342, 0.30794200301170349, 0.24511599540710449, 1 },
-    { 0.64032697677612305, -0.010905000381171703, 0.20328700542449951, 1 },
-    { 0.76483899354934692, -0.12076900154352188, 0.045083999633789062, 1 },
-    { 0.77314001321792603, -0.21744799613952637, 0.19742800295352936, 1 },
-    { -0.67021900415420532, -0.010905000381171703, 0.20328700542449951, 1 },
-    { -0.80303198099136353, -0.21744799613952637, 0.19742800295352936, 1 },
-    { -0.7947310209274292, -0.12076900154352188, 0.045083999633789062, 1 },
-    { 0.20722199976444244, -0.51334702968597412, -0.77815800905227661, 1 },
-    { 0.35273000597953796, -0.26627600193023682, -0.73225998878479004, 1 },
-    { -0.014945999719202518, -0.31901100277900696, -0.84456497430801392, 1 },
-    { -0.38262200355529785, -0.26627600193023682, -0.73225998878479004, 1 },
-    { -0.23711399734020233, -0.51334702968597412, -0.77815800905227661, 1 },
-    { 0.21210500597953796, -0.86442101001739502, 0.20572799444198608, 1 },
-    { 0.4049760103225708, -0.89664697647094727, 0.022135000675916672, 1 },
-    { 0.21161599457263947, -0.9576830267906189, -0.12483800202608109, 1 },
-    { -0.014945999719202518, -0.94889402389526367, 0.055826000869274139, 1 },
-    { -0.43486800789833069, -0.89664697647094727, 0.022135000675916672, 1 },
-    { -0.24199700355529785, -0.86442101001739502, 0.20572799444198608, 1 },
-    { -0.24150900542736053, -0.9576830267906189, -0.12483800202608109, 1 },
-    { 0.4049760103225708, -0.90104198455810547, -0.29280701279640198, 1 },
-    { 0.21210500597953796, -0.86442101001739502, -0.49886101484298706, 1 },
-    { -0.014945999719202518, -0.95084702968597412, -0.33479899168014526, 1 },
-    { -0.43486800789833069, -0.90104198455810547, -0.29280701279640198, 1 },
-    { -0.24199700355529785, -0.86442101001739502, -0.49886101484298706, 1 },
-    { 0.40644100308418274, -0.66373699903488159, -0.60286498069763184, 1 },
-    { -0.014945999719202518, -0.73111999034881592, -0.70393902063369751, 1 },
-    { -0.43633300065994263, -0.66373699903488159, -0.60286498069763184, 1 },
-    { 0.73993700742721558, -0.40641298890113831, 0.33024001121520996, 1 },
-    { 0.67694801092147827, -0.47526100277900696, 0.25846299529075623, 1 },
-    { 0.63153797388076782, -0.47819000482559204, 0.35758399963378906, 1 },
-    { -0.76982897520065308, -0.40641298890113831, 0.33024001121520996, 1 },
-    { -0.6614300012588501, -0.47819000482559204, 0.35758399963378906, 1 },
-    { -0.70684099197387695, -0.47526100277900696, 0.25846299529075623, 1 },
-    { 0.74286597967147827, -0.49039700627326965, 0.15055300295352936, 1 },
-    { 0.69892102479934692, -0.63395202159881592, 0.042642999440431595, 1 },
-    { 0.61493700742721558, -0.60026097297668457, 0.15250599384307861, 1 },
-    { -0.77275902032852173, -0.49039700627326965, 0.15055300295352936, 1 },
-    { -0.64482897520065308, -0.60026097297668457, 0.15250599384307861, 1 },
-    { -0.72881299257278442, -0.63395202159881592, 0.042642999440431595, 1 },
-    { 0.7677689790725708, -0.59391301870346069, -0.065268002450466156, 1 },
-    { 0.70380401611328125, -0.68815100193023682, -0.20003299415111542, 1 },
-    { 0.62177300453186035, -0.75016301870346069, -0.085775002837181091, 1 },
-    { -0.79766100645065308, -0.59391301870346069, -0.065268002450466156, 1 },
-    { -0.65166497230529785, -0.75016301870346069, -0.085775002837181091, 1 },
-    { -0.73369598388671875, -0.68815100193023682, -0.20003299415111542, 1 },
-    { 0.76239800453186035, -0.58024102449417114, -0.30257201194763184, 1 },
-    { 0.7008739709854126, -0.59977197647094727, -0.42903700470924377, 1 },
-    { 0.62177300453186035, -0.74088597297668457, -0.34212300181388855, 1 },
-    { -0.79228997230529785, -0.58024102449417114, -0.30257201194763184, 1 },
-    { -0.65166497230529785, -0.74088597297668457, -0.34212300181388855, 1 },
-    { -0.73076599836349487, -0.59977197647094727, -0.42903700470924377, 1 },
-    { 0.6666949987411499, -0.31998699903488159, -0.53890001773834229, 1 },
-    { 0.6120070219039917, -0.52994799613952637, -0.54817801713943481, 1 },
-    { 0.75360900163650513, -0.44401100277900696, -0.42708399891853333, 1 },
-    { -0.6418989896774292, -0.52994799613952637, -0.54817801713943481, 1 },
-    { -0.69658702611923218, -0.31998699903488159, -0.53890001773834229, 1 },
-    { -0.7835010290145874, -0.44401100277900696, -0.42708399891853333, 1 },
-    { 0.53095197677612305, -0.75309300422668457, -0.45149800181388855, 1 },
-    { 0.50897997617721558, -0.40885499119758606, -0.65462297201156616, 1 },
-    { -0.56084400415420532, -0.75309300422668457, -0.45149800181388855, 1 },
-    { -0.53887200355529785, -0.40885499119758606, -0.65462297201156616, 1 },
-    { 0.53192901611328125, -0.84391301870346069, -0.17708399891853333, 1 },
-    { -0.56182098388671875, -0.84391301870346069, -0.17708399891853333, 1 },
-    { 0.53192901611328125, -0.76920598745346069, 0.092446997761726379, 1 },
-    { -0.56182098388671875, -0.76920598745346069, 0.092446997761726379, 1 },
-    { 0.40741699934005737, -0.69986999034881592, 0.27994701266288757, 1 },
-    { 0.53632301092147827, -0.54654997587203979, 0.30631399154663086, 1 },
-    { -0.56621599197387695, -0.54654997587203979, 0.30631399154663086, 1 },
-    { -0.43730899691581726, -0.69986999034881592, 0.27994701266288757, 1 },
-    { 0.42841300368309021, -0.54557299613952637, 0.44742798805236816, 1 },
-    { -0.4583050012588501, -0.54557299613952637, 0.44742798805236816, 1 },
-    { 0.22333499789237976, -0.60319000482559204, 0.4366849958896637, 1 },
-    { -0.014945999719202518, -0.74283897876739502, 0.36149001121520996, 1 },
-    { -0.25322699546813965, -0.60319000482559204, 0.4366849958896637, 1 },
-    { 0.26972201466560364, -0.55387401580810547, 0.53092402219772339, 1 },
-    { -0.29961401224136353, -0.55387401580810547, 0.53092402219772339, 1 },
-    { 0.087430000305175781, -0.52962297201156616, 0.53482997417449951, 1 },
-    { -0.11732199788093567, -0.52962297201156616, 0.53482997417449951, 1 },
-    { -0.014945999719202518, -0.50390702486038208, 0.54606002569198608, 1 },
-    { 0.77851098775863647, -0.35123699903488159, 0.1598300039768219, 1 },
-    { -0.80840301513671875, -0.35123699903488159, 0.1598300039768219, 1 },
-    { 0.81317901611328125, -0.28580799698829651, -0.012044999748468399, 1 },
-    { 0.80585497617721558, -0.45035800337791443, -0.010091999545693398, 1 },
-    { -0.83574700355529785, -0.45035800337791443, -0.010091999545693398, 1 },
-    { -0.84307098388671875, -0.28580799698829651, -0.012044999748468399, 1 },
-    { 0.81708502769470215, -0.36783900856971741, -0.16341200470924377, 1 },
-    { 0.79315900802612305, -0.48014399409294128, -0.20882199704647064, 1 },
-    { -0.82305198907852173, -0.48014399409294128, -0.20882199704647064, 1 },
-    { -0.84697699546813965, -0.36783900856971741, -0.16341200470924377, 1 },
-    { 0.7916949987411499, -0.36442101001739502, -0.35237699747085571, 1 },
-    { -0.82158702611923218, -0.36442101001739502, -0.35237699747085571, 1 },
-    { 0.34784701466560364, 0.21321600675582886, -0.27083399891853333, 1 },
-    { 0.41327700018882751, 0.17219999432563782, -0.079428002238273621, 1 },
-    { 0.29299700260162354, 0.2576490044593811, 0.085937000811100006, 1 },
-    { -0.37773901224136353, 0.21321600675582886, -0.27083399891853333, 1 },
-    { -0.32288900017738342, 0.2576490044593811, 0.085937000811100006, 1 },
-    { -0.4431689977645874, 0.17219999432563782, -0.079428002238273621, 1 },
-    { 0.5416949987411499, 0.087728001177310944, 0.069986000657081604, 1 },
-    { 0.5104449987411499, 0.11263000220060349, -0.23177200555801392, 1 },
-    { 0.62567901611328125, 0.068685002624988556, -0.097983002662658691, 1 },
-    { -0.57158702611923218, 0.087728001177310944, 0.069986000657081604, 1 },
-    { -0.65557098388671875, 0.068685002624988556, -0.097983002662658691, 1 },
-    { -0.54033702611923218, 0.11263000220060349, -0.23177200555801392, 1 },
-    { 0.41181200742721558, 0.11409500241279602, 0.27408799529075623, 1 },
-    { -0.44170400500297546, 0.11409500241279602, 0.27408799529075623, 1 },
-    { 0.29771700501441956, 0.14925099909305573, 0.40511000156402588, 1 },
-    { 0.29055500030517578, 0.21175099909305573, 0.2573229968547821, 1 },
-    { -0.32760900259017944, 0.14925099909305573, 0.40511000156402588, 1 },
-    { -0.32044699788093567, 0.21175099909305573, 0.2573229968547821, 1 },
-    { 0.68720197677612305, -0.15494799613952637, -0.48421299457550049, 1 },
-    { 0.55780798196792603, -0.043131999671459198, -0.49739700555801392, 1 },
-    { 0.53632301092147827, -0.19889399409294128, -0.60823601484298706, 1 },
-    { -0.5877000093460083, -0.043131999671459198, -0.49739700555801392, 1 },
-    { -0.71709400415420532, -0.15494799613952637, -0.48421299457550049, 1 },
-    { -0.56621599197387695, -0.19889399409294128, -0.60823601484298706, 1 },
-    { 0.40579000115394592, -0.08658900111913681, -0.6486009955406189, 1 },
-    { -0.43568199872970581, -0.08658900111913681, -0.6486009955406189, 1 },
-    { 0.44501501321792603, 0.081380002200603485, -0.41536501049995422, 1 },
-    { 0.60272997617721558, 0.05696599930524826, -0.34212300181388855, 1 },
-    { -0.47490701079368591, 0.081380002200603485, -0.41536501049995422, 1 },
-    { -0.63262200355529785, 0.05696599930524826, -0.34212300181388855, 1 },
-    { 0.38625800609588623, 0.056478001177310944, -0.55875700712203979, 1 },
-    { -0.41615000367164612, 0.056478001177310944, -0.55875700712203979, 1 },
-    { 0.94159698486328125, -0.45084699988365173, -0.33479899168014526, 1 },
-    { 0.89618700742721558, -0.40152999758720398, -0.27718201279640198, 1 },
-    { 0.95429199934005737, -0.40592500567436218, -0.3089199960231781, 1 },
-    { 1.0143510103225708, -0.4611009955406189, -0.34847098588943481, 1 },
-    { -0.92607897520065308, -0.40152999758720398, -0.27718201279640198, 1 },
-    { -0.97148901224136353, -0.45084699988365173, -0.33479899168014526, 1 },
-    { -1.0442429780960083, -0.4611009955406189, -0.34847098588943481, 1 },
-    { -0.98418402671813965, -0.40592500567436218, -0.3089199960231781, 1 },
-    { 1.0895459651947021, -0.44498699903488159, -0.39436900615692139, 1 },
-    { 1.1842730045318604, -0.46842500567436218, -0.437826007604599, 1 },
-    { 1.1115189790725708, -0.49918699264526367, -0.42610698938369751, 1 },
-    { -1.1194380521774292, -0.44498699903488159, -0.39436900615692139, 1 },
-    { -1.1414109468460083, -0.49918699264526367, -0.42610698938369751, 1 },
-    { -1.2141649723052979, -0.46842500567436218, -0.437826007604599, 1 },
-    { 1.2169879674911499, -0.38248699903488159, -0.45052200555801392, 1 },
-    { 1.2736279964447021, -0.31608098745346069, -0.45735800266265869, 1 },
-    { 1.2716749906539917, -0.42399099469184875, -0.47542399168014526, 1 },
-    { -1.246880054473877, -0.38248699903488159, -0.45052200555801392, 1 },
-    { -1.3015669584274292, -0.42399099469184875, -0.47542399168014526, 1 },
-    { -1.3035199642181396, -0.31608098745346069, -0.45735800266265869, 1 },
-    { 1.2296830415725708, -0.20280000567436218, -0.45735800266265869, 1 },
-    { 1.2125929594039917, -0.09928400069475174, -0.44856798648834229, 1 },
-    { 1.2946239709854126, -0.20572899281978607, -0.47835400700569153, 1 },
-    { -1.2595750093460083, -0.20280000567436218, -0.45735800266265869, 1 },
-    { -1.3245160579681396, -0.20572899281978607, -0.47835400700569153, 1 },
-    { -1.2424850463867188, -0.09928400069475174, -0.44856798648834229, 1 },
-    { 1.1100540161132812, -0.03776099905371666, -0.40852901339530945, 1 },
-    { 1.0172810554504395, 0.037434998899698257, -0.34944701194763184, 1 },
-    { 1.1422810554504395, -0.0030930000357329845, -0.43636101484298706, 1 },
-    { -1.1399459838867188, -0.03776099905371666, -0.40852901339530945, 1 },
-    { -1.172173023223877, -0.0030930000357329845, -0.43636101484298706, 1 },
-    { -1.047173023223877, 0.037434998899698257, -0.34944701194763184, 1 },
-    { 0.91571801900863647, 0.037434998899698257, -0.27229899168014526, 1 },
-    { 0.79706597328186035, 0.076985001564025879, -0.20101000368595123, 1 },
-    { 0.89521002769470215, 0.090657003223896027, -0.29231798648834229, 1 },
-    { -0.94560998678207397, 0.037434998899698257, -0.27229899168014526, 1 },
-    { -0.92510199546813965, 0.090657003223896027, -0.29231798648834229, 1 },
-    { -0.82695800065994263, 0.076985001564025879, -0.20101000368595123, 1 },
-    { 1.0182570219039917, -0.010417000390589237, -0.37044298648834229, 1 },
-    { 0.94257301092147827, -0.0035810000263154507, -0.33089300990104675, 1 },
-    { 0.85175299644470215, 0.019856000319123268, -0.2425139993429184, 1 },
-    { -0.97246599197387695, -0.0035810000263154507, -0.33089300990104675, 1 },
-    { -1.0481489896774292, -0.010417000390589237, -0.37044298648834229, 1 },
-    { -0.88164502382278442, 0.019856000319123268, -0.2425139993429184, 1 },
-    { 1.1701129674911499, -0.11588600277900696, -0.45833399891853333, 1 },
-    { 1.1012649536132812, -0.063151001930236816, -0.4495449960231781, 1 },
-    { -1.1311570405960083, -0.063151001930236816, -0.4495449960231781, 1 },
-    { -1.200005054473877, -0.11588600277900696, -0.45833399891853333, 1 },
-    { 1.2199170589447021, -0.28287801146507263, -0.46810001134872437, 1 },
-    { 1.2023390531539917, -0.19254599511623383, -0.48958399891853333, 1 },
-    { -1.2322310209274292, -0.19254599511623383, -0.48958399891853333, 1 },
-    { -1.2498090267181396, -0.28287801146507263, -0.46810001134872437, 1 },
-    { 1.1535110473632812, -0.40006500482559204, -0.44808000326156616, 1 },
-    { 1.1935499906539917, -0.33072999119758606, -0.48567798733711243, 1 },
-    { -1.2234419584274292, -0.33072999119758606, -0.48567798733711243, 1 },
-    { -1.1834030151367188, -0.40006500482559204, -0.44808000326156616, 1 },
-    { 1.0138629674911499, -0.39567101001739502, -0.37044298648834229, 1 },
-    { 1.0851520299911499, -0.3790690004825592, -0.44124400615692139, 1 },
-    { -1.1150439977645874, -0.3790690004825592, -0.44124400615692139, 1 },
-    { -1.043755054473877, -0.39567101001739502, -0.37044298648834229, 1 },
-    { 0.92108899354934692, -0.34977200627326965, -0.3045249879360199, 1 },
-    { 0.96894097328186035, -0.35026100277900696, -0.36604899168014526, 1 },
-    { -0.9509810209274292, -0.34977200627326965, -0.3045249879360199, 1 },
-    { -0.99883300065994263, -0.35026100277900696, -0.36604899168014526, 1 },
-    { 0.66864800453186035, 0.051594998687505722, -0.18587300181388855, 1 },
-    { 0.70006000995635986, -0.0034179999493062496, -0.16113400459289551, 1 },
-    { 0.72187000513076782, -0.027994999662041664, -0.064291000366210938, 1 },
-    { -0.69853997230529785, 0.051594998687505722, -0.18587300181388855, 1 },
-    { -0.75176197290420532, -0.027994999662041664, -0.064291000366210938, 1 },
-    { -0.72995299100875854, -0.0034179999493062496, -0.16113400459289551, 1 },
-    { 0.68378400802612305, 0.093587003648281097, -0.21858799457550049, 1 },
-    { 0.75653797388076782, 0.03401700034737587, -0.20638099312782288, 1 },
-    { -0.71367698907852173, 0.093587003648281097, -0.21858799457550049, 1 },
-    { -0.7864300012588501, 0.03401700034737587, -0.20638099312782288, 1 },
-    { 0.77362799644470215, -0.16715499758720398, -0.10481800138950348, 1 },
-    { -0.80352002382278442, -0.16715499758720398, -0.10481800138950348, 1 },
-    { 0.8258739709854126, -0.3321940004825592, -0.24348999559879303, 1 },
-    { 0.86884301900863647, -0.34342500567436218, -0.26692798733711243, 1 },
-    { 0.83905798196792603, -0.37662801146507263, -0.28597098588943481, 1 },
-    { -0.89873498678207397, -0.34342500567436218, -0.26692798733711243, 1 },
-    { -0.85576599836349487, -0.3321940004825592, -0.24348999559879303, 1 },
-    { -0.8689500093460083, -0.37662801146507263, -0.28597098588943481, 1 },
-    { 0.82343298196792603, 0.0022780001163482666, -0.28108799457550049, 1 },
-    { 0.76386302709579468, -0.0030930000357329845, -0.26106798648834229, 1 },
-    { -0.8533250093460083, 0.0022780001163482666, -0.28108799457550049, 1 },
-    { -0.79375499486923218, -0.0030930000357329845, -0.26106798648834229, 1 },
-    { 0.76532697677612305, -0.049479000270366669, -0.27864700555801392, 1 },
-    { 0.71812701225280762, -0.026367999613285065, -0.22607499361038208, 1 },
-    { 0.79999500513076782, -0.02115900069475174, -0.31136101484298706, 1 },
-    { -0.74801898002624512, -0.026367999613285065, -0.22607499361038208, 1 },
-    { -0.79521900415420532, -0.049479000270366669, -0.27864700555801392, 1 },
-    { -0.82988697290420532, -0.02115900069475174, -0.31136101484298706, 1 },
-    { 0.7448199987411499, -0.099771998822689056, -0.28108799457550049, 1 },
-    { 0.80634301900863647, -0.072429001331329346, -0.31770899891853333, 1 },
-    { 0.77411597967147827, -0.10172600299119949, -0.31770899891853333, 1 },
-    { -0.77471202611923218, -0.099771998822689056, -0.28108799457550049, 1 },
-    { -0.80400902032852173, -0.10172600299119949, -0.31770899891853333, 1 },
-    { -0.83623498678207397, -0.072429001331329346, -0.31770899891853333, 1 },
-    { 0.79804199934005737, -0.20231199264526367, -0.28401800990104675, 1 },
-    { 0.7521439790725708, -0.14762400090694427, -0.23470099270343781, 1 },
-    { 0.77802300453186035, -0.15152999758720398, -0.31380298733711243, 1 },
-    { -0.78203600645065308, -0.14762400090694427, -0.23470099270343781, 1 },
-    { -0.82793402671813965, -0.20231199264526367, -0.28401800990104675, 1 },
-    { -0.80791497230529785, -0.15152999758720398, -0.31380298733711243, 1 },
-    { 0.81317901611328125, -0.27115899324417114, -0.25130298733711243, 1 },
-    { 0.84345197677612305, -0.23160800337791443, -0.31233799457550049, 1 },
-    { 0.8541949987411499, -0.28434300422668457, -0.28450599312782288, 1 },
-    { -0.84307098388671875, -0.27115899324417114, -0.25130298733711243, 1 },
-    { -0.88408702611923218, -0.28434300422668457, -0.28450599312782288, 1 },
-    { -0.87334400415420532, -0.23160800337791443, -0.31233799457550049, 1 },
-    { 0.89911597967147827, -0.29850301146507263, -0.3201499879360199, 1 },
-    { -0.92900902032852173, -0.29850301146507263, -0.3201499879360199, 1 },
-    { 0.80048400163650513, -0.25748699903488159, -0.18245500326156616, 1 },
-    { -0.8303760290145874, -0.25748699903488159, -0.18245500326156616, 1 },
-    { 0.72056800127029419, -0.066407002508640289, -0.17626999318599701, 1 },
-    { -0.75046002864837646, -0.066407002508640289, -0.17626999318599701, 1 },
-    { 0.87665599584579468, -0.25748699903488159, -0.3401699960231781, 1 },
-    { 0.91474097967147827, -0.27604201436042786, -0.37288498878479004, 1 },
-    { 0.93720197677612305, -0.31461599469184875, -0.36604899168014526, 1 },
-    { -0.90654802322387695, -0.25748699903488159, -0.3401699960231781, 1 },
-    { -0.96709400415420532, -0.31461599469184875, -0.36604899168014526, 1 },
-    { -0.94463402032852173, -0.27604201436042786, -0.37288498878479004, 1 },
-    { 0.82147997617721558, -0.19059300422668457, -0.3401699960231781, 1 },
-    { 0.85907697677612305, -0.21598300337791443, -0.3601900041103363, 1 },
-    { -0.85137200355529785, -0.19059300422668457, -0.3401699960231781, 1 },
-    { -0.88896900415420532, -0.21598300337791443, -0.3601900041103363, 1 },
-    { 0.7643510103225708, -0.12223300337791443, -0.34065800905227661, 1 },
-    { 0.7956010103225708, -0.14811199903488159, -0.35872501134872437, 1 },
-    { -0.7942429780960083, -0.12223300337791443, -0.34065800905227661, 1 },
-    { -0.8254929780960083, -0.14811199903488159, -0.35872501134872437, 1 },
-    { 0.80439001321792603, -0.095377996563911438, -0.34065800905227661, 1 },
-    { 0.78974097967147827, -0.1134440004825592, -0.35872501134872437, 1 },
-    { -0.83428198099136353, -0.095377996563911438, -0.34065800905227661, 1 },
-    { -0.81963402032852173, -0.1134440004825592, -0.35872501134872437, 1 },
-    { 0.82538598775863647, -0.040201999247074127, -0.34065800905227661, 1 },
-    { 0.83319801092147827, -0.072429001331329346, -0.359701007604599, 1 },
-    { -0.85527801513671875, -0.040201999247074127, -0.34065800905227661, 1 },
-    { -0.86309099197387695, -0.072429001331329346, -0.359701007604599, 1 },
-    { 0.81073802709579468, -0.0079760001972317696, -0.33333399891853333, 1 },
-    { 0.82636302709579468, -0.023112000897526741, -0.3557949960231781, 1 },
-    { -0.84062999486923218, -0.0079760001972317696, -0.33333399891853333, 1 },
-    { -0.85625499486923218, -0.023112000897526741, -0.3557949960231781, 1 },
-    { 0.87909698486328125, -0.0035810000263154507, -0.3089199960231781, 1 },
-    { 0.8385699987411499, -0.010905000381171703, -0.33479899168014526, 1 },
-    { -0.90898901224136353, -0.0035810000263154507, -0.3089199960231781, 1 },
-    { -0.86846202611923218, -0.010905000381171703, -0.33479899168014526, 1 },
-    { 0.9865189790725708, -0.32389399409294128, -0.41634199023246765, 1 },
-    { 1.0246050357818604, -0.35319000482559204, -0.43099001049995422, 1 },
-    { -1.0544970035552979, -0.35319000482559204, -0.43099001049995422, 1 },
-    { -1.0164109468460083, -0.32389399409294128, -0.41634199023246765, 1 },
-    { 1.0941040515899658, -0.35286501049995422, -0.48177200555801392, 1 },
-    { 1.1544879674911499, -0.35660800337791443, -0.4964199960231781, 1 },
-    { -1.184380054473877, -0.35660800337791443, -0.4964199960231781, 1 },
-    { -1.1239960193634033, -0.35286501049995422, -0.48177200555801392, 1 },
-    { 1.1896439790725708, -0.30826899409294128, -0.51399797201156616, 1 },
-    { 1.2169879674911499, -0.25992900133132935, -0.51106798648834229, 1 },
-    { -1.246880054473877, -0.25992900133132935, -0.51106798648834229, 1 },
-    { -1.2195359468460083, -0.30826899409294128, -0.51399797201156616, 1 },
-    { 1.1974560022354126, -0.18961599469184875, -0.51399797201156616, 1 },
-    { 1.1706010103225708, -0.11832699924707413, -0.50032597780227661, 1 },
-    { -1.2004929780960083, -0.11832699924707413, -0.50032597780227661, 1 },
-    { -1.2273479700088501, -0.18961599469184875, -0.51399797201156616, 1 },
-    { 1.0993119478225708, -0.077799998223781586, -0.48128300905227661, 1 },
-    { 1.027534008026123, -0.028971999883651733, -0.42757201194763184, 1 },
-    { -1.0574259757995605, -0.028971999883651733, -0.42757201194763184, 1 },
-    { -1.1292040348052979, -0.077799998223781586, -0.48128300905227661, 1 },
-    { 0.94989800453186035, -0.024576999247074127, -0.38167399168014526, 1 },
-    { -0.97978997230529785, -0.024576999247074127, -0.38167399168014526, 1 },
-    { 0.8693310022354126, -0.059245001524686813, -0.3670249879360199, 1 },
-    { 0.89814001321792603, -0.10904999822378159, -0.37776800990104675, 1 },
-    { 0.84198802709579468, -0.11197900027036667, -0.36800199747085571, 1 },
-    { -0.89922302961349487, -0.059245001524686813, -0.3670249879360199, 1 },
-    { -0.87187999486923218, -0.11197900027036667, -0.36800199747085571, 1 },
-    { -0.92803198099136353, -0.10904999822378159, -0.37776800990104675, 1 },
-    { 0.9479449987411499, -0.10709699988365173, -0.39290401339530945, 1 },
-    { 0.96405798196792603, -0.16862000524997711, -0.40218201279640198, 1 },
-    { 0.9088820219039917, -0.16276100277900696, -0.3826499879360199, 1 },
-    { -0.97783702611923218, -0.10709699988365173, -0.39290401339530945, 1 },
-    { -0.9387739896774292, -0.16276100277900696, -0.3826499879360199, 1 },
-    { -0.9939500093460083, -0.16862000524997711, -0.40218201279640198, 1 },
-    { 1.0202100276947021, -0.16813200712203979, -0.42708399891853333, 1 },
-    { 1.0211869478225708, -0.22721399366855621, -0.42171299457550049, 1 },
-    { 0.96991699934005737, -0.22477200627326965, -0.40462300181388855, 1 },
-    { -1.0501019954681396, -0.16813200712203979, -0.42708399891853333, 1 },
-    { -0.99980902671813965, -0.22477200627326965, -0.40462300181388855, 1 },
-    { -1.0510790348052979, -0.22721399366855621, -0.42171299457550049, 1 },
-    { 1.0822219848632812, -0.22184300422668457, -0.44270899891853333, 1 },
-    { 1.0905230045318604, -0.26481199264526367, -0.4451499879360199, 1 },
-    { 1.0329060554504395, -0.27408900856971741, -0.42659598588943481, 1 },
-    { -1.1121139526367188, -0.22184300422668457, -0.44270899891853333, 1 },
-    { -1.062798023223877, -0.27408900856971741, -0.42659598588943481, 1 },
-    { -1.1204149723052979, -0.26481199264526367, -0.4451499879360199, 1 },
-    { 0.97187000513076782, -0.27946001291275024, -0.40560001134872437, 1 },
-    { 1.0482050180435181, -0.31966200470924377, -0.44759199023246765, 1 },
-    { -1.0017620325088501, -0.27946001291275024, -0.40560001134872437, 1 },
-    { -1.0780969858169556, -0.31966200470924377, -0.44759199023246765, 1 },
-    { 0.91083502769470215, -0.2228190004825592, -0.38118600845336914, 1 },
-    { -0.94072699546813965, -0.2228190004825592, -0.38118600845336914, 1 },
-    { 0.85077697038650513, -0.16178399324417114, -0.36897900700569153, 1 },
-    { -0.8806689977645874, -0.16178399324417114, -0.36897900700569153, 1 },
-    { 0.89960497617721558, -0.045572999864816666, -0.35872501134872437, 1 },
-    { -0.92949700355529785, -0.045572999864816666, -0.35872501134872437, 1 },
-    { 1.0080029964447021, -0.087076999247074127, -0.43147900700569153, 1 },
-    { -1.0378949642181396, -0.087076999247074127, -0.43147900700569153, 1 },
-    { 1.1105420589447021, -0.15885399281978607, -0.47347098588943481, 1 },
-    { -1.1404340267181396, -0.15885399281978607, -0.47347098588943481, 1 },
-    { 1.1564409732818604, -0.24576899409294128, -0.48372501134872437, 1 },
-    { -1.1863329410552979, -0.24576899409294128, -0.48372501134872437, 1 },
-    { 1.1194939613342285, -0.3201499879360199, -0.47981798648834229, 1 },
-    { -1.1493860483169556, -0.3201499879360199, -0.47981798648834229, 1 },
-    { 0.77802300453186035, 0.099445998668670654, -0.30208399891853333, 1 },
-    { 0.90155798196792603, 0.022786000743508339, -0.4339199960231781, 1 },
-    { 1.0241169929504395, 0.059895999729633331, -0.43977901339530945, 1 },
-    { -0.80791497230529785, 0.099445998668670654, -0.30208399891853333, 1 },
-    { -1.0540080070495605, 0.059895999729633331, -0.43977901339530945, 1 },
-    { -0.9314500093460083, 0.022786000743508339, -0.4339199960231781, 1 },
-    { 1.1539989709854126, -0.062174998223781586, -0.53938901424407959, 1 },
-    { 1.2575149536132812, -0.088054001331329346, -0.51302200555801392, 1 },
-    { -1.2874070405960083, -0.088054001331329346, -0.51302200555801392, 1 },
-    { -1.1838910579681396, -0.062174998223781586, -0.53938901424407959, 1 },
-    { 1.3144810199737549, -0.22184300422668457, -0.55078202486038208, 1 },
-    { 1.3219679594039917, -0.31949898600578308, -0.51009202003479004, 1 },
-    { -1.3518600463867188, -0.31949898600578308, -0.51009202003479004, 1 },
-    { -1.3443729877471924, -0.22184300422668457, -0.55078202486038208, 1 },
-    { 1.2920199632644653, -0.37955799698829651, -0.55517697334289551, 1 },
-    { 1.2145459651947021, -0.48209699988365173, -0.51448601484298706, 1 },
-    { -1.2444380521774292, -0.48209699988365173, -0.51448601484298706, 1 },
-    { -1.3219120502471924, -0.37955799698829651, -0.55517697334289551, 1 },
-    { 1.1256790161132812, -0.41959699988365173, -0.54036498069763184, 1 },
-    { 1.0172810554504395, -0.47330799698829651, -0.44173198938369751, 1 },
-    { -1.047173023223877, -0.47330799698829651, -0.44173198938369751, 1 },
-    { -1.1555709838867188, -0.41959699988365173, -0.54036498069763184, 1 },
-    { 0.92499500513076782, -0.36979201436042786, -0.45442798733711243, 1 },
-    { 0.86884301900863647, -0.4103190004825592, -0.36507201194763184, 1 },
-    { -0.89873498678207397, -0.4103190004825592, -0.36507201194763184, 1 },
-    { -0.95488697290420532, -0.36979201436042786, -0.45442798733711243, 1 },
-    { 1.0216749906539917, -0.20084699988365173, -0.52181100845336914, 1 },
-    { 0.82050299644470215, -0.15494799613952637, -0.42561900615692139, 1 },
-    { -1.0515669584274292, -0.20084699988365173, -0.52181100845336914, 1 },
-    { -0.85039502382278442, -0.15494799613952637, -0.42561900615692139, 1 },
-    { 1.2422150373458862, -0.27408900856971741, -0.57324302196502686, 1 },
-    { -1.2721079587936401, -0.27408900856971741, -0.57324302196502686, 1 },
-    { 0.79364800453186035, -0.3009440004825592, -0.42610800266265869, 1 },
-    { -0.82353997230529785, -0.3009440004825592, -0.42610800266265869, 1 },
-    { 0.70868700742721558, 0.0056960000656545162, -0.39729899168014526, 1 },
-    { -0.73857897520065308, 0.0056960000656545162, -0.39729899168014526, 1 },
-    { 0.42389699816703796, -0.18094900250434875, 0.71525001525878906, 1 },
-    { -0.45378899574279785, -0.18094900250434875, 0.71525001525878906, 1 },
-    { 0.47235900163650513, -0.12833699584007263, 0.64176398515701294, 1 },
-    { -0.5022510290145874, -0.12833699584007263, 0.64176398515701294, 1 },
-    { 0.51728099584579468, -0.088541999459266663, 0.53727102279663086, 1 },
-    { -0.54717302322387695, -0.088541999459266663, 0.53727102279663086, 1 },
-    { 0.33661600947380066, -0.016276000067591667, 0.57242798805236816, 1 },
-    { -0.36650899052619934, -0.016276000067591667, 0.57242798805236816, 1 },
-    { 0.33673900365829468, -0.072429001331329346, 0.66922897100448608, 1 },
-    { -0.36663100123405457, -0.072429001331329346, 0.66922897100448608, 1 },
-    { 0.33747100830078125, -0.14737999439239502, 0.73233997821807861, 1 },
-    { -0.36736300587654114, -0.14737999439239502, 0.73233997821807861, 1 },
-    { 0.25519600510597229, -0.18094900250434875, 0.74711000919342041, 1 },
-    { -0.28508800268173218, -0.18094900250434875, 0.74711000919342041, 1 },
-    { 0.20172899961471558, -0.12833699584007263, 0.69071400165557861, 1 },
-    { -0.23162099719047546, -0.12833699584007263, 0.69071400165557861, 1 },
-    { 0.15595200657844543, -0.088541999459266663, 0.60172498226165771, 1 },
-    { -0.18584400415420532, -0.088541999459266663, 0.60172498226165771, 1 },
-    { 0.082709997892379761, -0.26334699988365173, 0.61051398515701294, 1 },
-    { -0.11260200291872025, -0.26334699988365173, 0.61051398515701294, 1 },
-    { 0.14569799602031708, -0.26261401176452637, 0.69425398111343384, 1 },
-    { -0.17559100687503815, -0.26261401176452637, 0.69425398111343384, 1 },
-    { 0.22162599861621857, -0.26322498917579651, 0.74918502569198608, 1 },
-    { -0.25151801109313965, -0.26322498917579651, 0.74918502569198608, 1 },
-    { 0.25519600510597229, -0.34977200627326965, 0.74711000919342041, 1 },
-    { -0.28508800268173218, -0.34977200627326965, 0.74711000919342041, 1 },
-    { 0.20172899961471558, -0.39811199903488159, 0.69071400165557861, 1 },
-    { -0.23162099719047546, -0.39811199903488159, 0.69071400165557861, 1 },
-    { 0.15595200657844543, -0.44303399324417114, 0.60172498226165771, 1 },
-    { -0.18584400415420532, -0.44303399324417114, 0.60172498226165771, 1 },
-    { 0.33661600947380066, -0.51627600193023682, 0.57242798805236816, 1 },
-    { -0.36650899052619934, -0.51627600193023682, 0.57242798805236816, 1 },
-    { 0.33673900365829468, -0.45426499843597412, 0.66922897100448608, 1 },
-    { -0.36663100123405457, -0.45426499843597412, 0.66922897100448608, 1 },
-    { 0.33747100830078125, -0.38419601321220398, 0.73233997821807861, 1 },
-    { -0.36736300587654114, -0.38419601321220398, 0.73233997821807861, 1 },
-    { 0.42389699816703796, -0.34977200627326965, 0.71525001525878906, 1 },
-    { -0.45378899574279785, -0.34977200627326965, 0.71525001525878906, 1 },
-    { 0.47235900163650513, -0.39811199903488159, 0.64176398515701294, 1 },
-    { -0.5022510290145874, -0.39811199903488159, 0.64176398515701294, 1 },
-    { 0.51728099584579468, -0.44303399324417114, 0.53727102279663086, 1 },
-    { -0.54717302322387695, -0.44303399324417114, 0.53727102279663086, 1 },
-    { 0.59052300453186035, -0.26334699988365173, 0.52262300252914429, 1 },
-    { -0.62041497230529785, -0.26334699988365173, 0.52262300252914429, 1 },
-    { 0.52851098775863647, -0.26261401176452637, 0.62882399559020996, 1 },
-    { -0.55840301513671875, -0.26261401176452637, 0.62882399559020996, 1 },
-    { 0.45770999789237976, -0.26322498917579651, 0.70743697881698608, 1 },
-    { -0.48760199546813965, -0.26322498917579651, 0.70743697881698608, 1 },
-    { 0.44045799970626831, -0.26326501369476318, 0.73518800735473633, 1 },
-    { -0.4703499972820282, -0.26326501369476318, 0.73518800735473633, 1 },
-    { 0.41258499026298523, -0.33911201357841492, 0.74206501245498657, 1 },
-    { -0.44247698783874512, -0.33911201357841492, 0.74206501245498657, 1 },
-    { 0.33751198649406433, -0.37068700790405273, 0.75964301824569702, 1 },
-    { -0.36740401387214661, -0.37068700790405273, 0.75964301824569702, 1 },
-    { 0.26597800850868225, -0.33911201357841492, 0.77262300252914429, 1 },
-    { -0.29587098956108093, -0.33911201357841492, 0.77262300252914429, 1 },
-    { 0.23529799282550812, -0.26326501369476318, 0.77441298961639404, 1 },
-    { -0.2651900053024292, -0.26326501369476318, 0.77441298961639404, 1 },
-    { 0.26597800850868225, -0.1917320042848587, 0.77262300252914429, 1 },
-    { -0.29587098956108093, -0.1917320042848587, 0.77262300252914429, 1 },
-    { 0.33702298998832703, -0.26298001408576965, 0.77864497900009155, 1 },
-    { -0.36691498756408691, -0.26298001408576965, 0.77864497900009155, 1 },
-    { 0.33751198649406433, -0.16105200350284576, 0.75964301824569702, 1 },
-    { -0.36740401387214661, -0.16105200350284576, 0.75964301824569702, 1 },
-    { 0.41258499026298523, -0.1917320042848587, 0.74206501245498657, 1 },
-    { -0.44247698783874512, -0.1917320042848587, 0.74206501245498657, 1 },
-    { -0.014945999719202518, -0.45304399728775024, 0.69303297996520996, 1 },
-    { -0.014945999719202518, -0.37261301279067993, 0.76589500904083252, 1 },
-    { -0.014945999719202518, 0.64095002412796021, 0.69254499673843384, 1 },
-    { -0.014945999719202518, 0.28597000241279602, 0.73551398515701294, 1 },
-    { -0.014945999719202518, 0.15511000156402588, 0.74747598171234131, 1 },
-    { -0.014945999719202518, 0.74495398998260498, 0.67081600427627563, 1 },
-    { -0.014945999719202518, -0.4592289924621582, 0.57389199733734131, 1 },
-    { -0.014945999719202518, -0.58673399686813354, 0.50309199094772339, 1 },
-    { -0.014945999719202518, -0.87589597702026367, -0.53450602293014526, 1 },
-    { -0.014945999719202518, -0.53824901580810547, -0.81624400615692139, 1 },
-    { -0.014945999719202518, -0.1134440004825592, -0.81575602293014526, 1 },
-    { -0.014945999719202518, 0.33211201429367065, -0.34847098588943481, 1 },
-    { 0.21198299527168274, 0.15706400573253632, 0.53373098373413086, 1 },
-    { -0.24187499284744263, 0.15706400573253632, 0.53373098373413086, 1 },
-    { 0.27375000715255737, 0.42317700386047363, 0.52189099788665771, 1 },
-    { -0.30364200472831726, 0.42317700386047363, 0.52189099788665771, 1 },
-    { 0.30902901291847229, 0.64461201429367065, 0.51517701148986816, 1 },
-    { -0.33892101049423218, 0.64461201429367065, 0.51517701148986816, 1 },
-    { 0.32392099499702454, 0.82552099227905273, 0.48868700861930847, 1 },
-    { -0.35381299257278442, 0.82552099227905273, 0.48868700861930847, 1 },
-    { 0.28742200136184692, 0.91048097610473633, 0.48221799731254578, 1 },
-    { -0.31731399893760681, 0.91048097610473633, 0.48221799731254578, 1 },
-    { 0.15644100308418274, 0.94002199172973633, 0.50516700744628906, 1 },
-    { -0.18633300065994263, 0.94002199172973633, 0.50516700744628906, 1 },
-    { -0.014945999719202518, 0.95393800735473633, 0.52213501930236816, 1 },
-    { 0.41205599904060364, 0.096761003136634827, 0.50199300050735474, 1 },
-    { -0.44194799661636353, 0.096761003136634827, 0.50199300050735474, 1 },
-    { 0.61041998863220215, -0.0076089999638497829, 0.48148500919342041, 1 },
-    { -0.64031201601028442, -0.0076089999638497829, 0.48148500919342041, 1 },
-    { 0.77448302507400513, -0.18778499960899353, 0.43814998865127563, 1 },
-    { -0.80437499284744263, -0.18778499960899353, 0.43814998865127563, 1 },
-    { 0.80182600021362305, -0.41373699903488159, 0.52958101034164429, 1 },
-    { -0.83171898126602173, -0.41373699903488159, 0.52958101034164429, 1 },
-    { 0.67829102277755737, -0.50004100799560547, 0.58072799444198608, 1 },
-    { -0.70818299055099487, -0.50004100799560547, 0.58072799444198608, 1 },
-    { 0.47650900483131409, -0.61259001493453979, 0.63846802711486816, 1 },
-    { -0.50640100240707397, -0.61259001493453979, 0.63846802711486816, 1 },
-    { 0.30744200944900513, -0.7319750189781189, 0.68290102481842041, 1 },
-    { -0.33733400702476501, -0.7319750189781189, 0.68290102481842041, 1 },
-    { 0.15961499512195587, -0.69645202159881592, 0.70438599586486816, 1 },
-    { -0.18950699269771576, -0.69645202159881592, 0.70438599586486816, 1 },
-    { 0.060860000550746918, -0.52006101608276367, 0.70011299848556519, 1 },
-    { -0.090751998126506805, -0.52006101608276367, 0.70011299848556519, 1 },
-    { 0.15204599499702454, -0.42740899324417114, 0.73685598373413086, 1 },
-    { -0.18193799257278442, -0.42740899324417114, 0.73685598373413086, 1 },
-    { 0.10761299729347229, -0.33024099469184875, 0.73014199733734131, 1 },
-    { -0.13750499486923218, -0.33024099469184875, 0.73014199733734131, 1 },
-    { 0.19782300293445587, -0.091715998947620392, 0.70487397909164429, 1 },
-    { -0.22771500051021576, -0.091715998947620392, 0.70487397909164429, 1 },
-    { 0.35626998543739319, -0.047648001462221146, 0.66276001930236816, 1 },
-    { -0.38616201281547546, -0.047648001462221146, 0.66276001930236816, 1 },
-    { 0.49066901206970215, -0.095499999821186066, 0.62894600629806519, 1 },
-    { -0.52056097984313965, -0.095499999821186066, 0.62894600629806519, 1 },
-    { 0.60297399759292603, -0.20951400697231293, 0.60685098171234131, 1 },
-    { -0.6328660249710083, -0.20951400697231293, 0.60685098171234131, 1 },
-    { 0.62482398748397827, -0.32035300135612488, 0.61222302913665771, 1 },
-    { -0.65471702814102173, -0.32035300135612488, 0.61222302913665771, 1 },
-    { 0.5751420259475708, -0.3968920111656189, 0.63675898313522339, 1 },
-    { -0.6050339937210083, -0.3968920111656189, 0.63675898313522339, 1 },
-    { 0.42414098978042603, -0.46342000365257263, 0.68668502569198608, 1 },
-    { -0.45403298735618591, -0.46342000365257263, 0.68668502569198608, 1 },
-    { 0.23151400685310364, -0.49406000971794128, 0.72721302509307861, 1 },
-    { -0.26140600442886353, -0.49406000971794128, 0.72721302509307861, 1 },
-    { -0.014945999719202518, 0.72615498304367065, 0.68888300657272339, 1 },
-    { 0.097553998231887817, 0.71700501441955566, 0.68262302875518799, 1 },
-    { -0.12744599580764771, 0.71700501441955566, 0.68262302875518799, 1 },
-    { 0.1067579984664917, 0.81526702642440796, 0.65848702192306519, 1 },
-    { -0.13664999604225159, 0.81526702642440796, 0.65848702192306519, 1 },
-    { 0.056099001318216324, 0.86226397752761841, 0.64396101236343384, 1 },
-    { -0.08599100261926651, 0.86226397752761841, 0.64396101236343384, 1 },
-    { -0.014945999719202518, 0.87312799692153931, 0.63907802104949951, 1 },
-    { -0.014945999719202518, 0.14290300011634827, 0.72477102279663086, 1 },
-    { -0.014945999719202518, 0.11425799876451492, 0.70361298322677612, 1 },
-    { 0.081123001873493195, 0.12825499475002289, 0.71012300252914429, 1 },
-    { -0.11101499944925308, 0.12825499475002289, 0.71012300252914429, 1 },
-    { 0.10871099680662155, 0.20503699779510498, 0.70682698488235474, 1 },
-    { -0.13860300183296204, 0.20503699779510498, 0.70682698488235474, 1 },
-    { 0.074584998190402985, 0.27966099977493286, 0.70020097494125366, 1 },
-    { -0.10447700321674347, 0.27966099977493286, 0.70020097494125366, 1 },
-    { 0.37885299324989319, 0.023397000506520271, 0.62394100427627563, 1 },
-    { -0.40874499082565308, 0.023397000506520271, 0.62394100427627563, 1 },
-    { 0.5785599946975708, -0.071085996925830841, 0.57706600427627563, 1 },
-    { -0.60845202207565308, -0.071085996925830841, 0.57706600427627563, 1 },
-    { 0.69843298196792603, -0.21793599426746368, 0.55558198690414429, 1 },
-    { -0.7283250093460083, -0.21793599426746368, 0.55558198690414429, 1 },
-    { 0.71894097328186035, -0.37577301263809204, 0.60355597734451294, 1 },
-    { -0.74883300065994263, -0.37577301263809204, 0.60355597734451294, 1 },
-    { 0.6432570219039917, -0.44767299294471741, 0.66337001323699951, 1 },
-    { -0.6731489896774292, -0.44767299294471741, 0.66337001323699951, 1 },
-    { 0.44196298718452454, -0.55680400133132935, 0.72599202394485474, 1 },
-    { -0.47185501456260681, -0.55680400133132935, 0.72599202394485474, 1 },
-    { 0.30243700742721558, -0.64017802476882935, 0.76505500078201294, 1 },
-    { -0.33232900500297546, -0.64017802476882935, 0.76505500078201294, 1 },
-    { 0.18988800048828125, -0.61246800422668457, 0.78165602684020996, 1 },
-    { -0.21977999806404114, -0.61246800422668457, 0.78165602684020996, 1 },
-    { 0.09076700359582901, -0.46769198775291443, 0.77762800455093384, 1 },
-    { -0.1206590011715889, -0.46769198775291443, 0.77762800455093384, 1 },
-    { 0.12746900320053101, 0.076117001473903656, 0.73290902376174927, 1 },
-    { -0.15736100077629089, 0.076117001473903656, 0.73290902376174927, 1 },
-    { 0.19330599904060364, 0.43928998708724976, 0.65165102481842041, 1 },
-    { -0.22319799661636353, 0.43928998708724976, 0.65165102481842041, 1 },
-    { 0.22785200178623199, 0.66255700588226318, 0.63456100225448608, 1 },
-    { -0.25774401426315308, 0.66255700588226318, 0.63456100225448608, 1 },
-    { 0.23883800208568573, 0.79317200183868408, 0.61185598373413086, 1 },
-    { -0.26873001456260681, 0.79317200183868408, 0.61185598373413086, 1 },
-    { 0.21015200018882751, 0.87910902500152588, 0.58878499269485474, 1 },
-    { -0.2400439977645874, 0.87910902500152588, 0.58878499269485474, 1 },
-    { 0.12897500395774841, 0.90779602527618408, 0.58780801296234131, 1 },
-    { -0.1588670015335083, 0.90779602527618408, 0.58780801296234131, 1 },
-    { -0.014945999719202518, 0.91951501369476318, 0.59293502569198608, 1 },
-    { -0.014945999719202518, -0.061740998178720474, 0.6950410008430481, 1 },
-    { -0.014945999719202518, -0.22965499758720398, 0.72135299444198608, 1 },
-    { 0.31501001119613647, -0.5045580267906189, 0.71146601438522339, 1 },
-    { -0.34490200877189636, -0.5045580267906189, 0.71146601438522339, 1 },
-    { 0.13458999991416931, -0.15372799336910248, 0.70841401815414429, 1 },
-    { -0.1644819974899292, -0.15372799336910248, 0.70841401815414429, 1 },
-    { 0.10871099680662155, -0.23417200148105621, 0.71805799007415771, 1 },
-    { -0.13860300183296204, -0.23417200148105621, 0.71805799007415771, 1 },
-    { 0.099434003233909607, 0.64400202035903931, 0.68644100427627563, 1 },
-    { -0.12932600080966949, 0.64400202035903931, 0.68644100427627563, 1 },
-    { 0.074530996382236481, 0.43697100877761841, 0.69840401411056519, 1 },
-    { -0.10442399978637695, 0.43697100877761841, 0.69840401411056519, 1 },
-    { -0.014945999719202518, 0.43880200386047363, 0.70328700542449951, 1 },
-    { -0.014945999719202518, 0.31282499432563782, 0.70426398515701294, 1 },
-    { 0.069282002747058868, 0.25215598940849304, 0.73746699094772339, 1 },
-    { -0.099174998700618744, 0.25215598940849304, 0.73746699094772339, 1 },
-    { 0.10639200359582901, 0.20100900530815125, 0.74735397100448608, 1 },
-    { -0.1362839937210083, 0.20100900530815125, 0.74735397100448608, 1 },
-    { 0.085395999252796173, 0.12764500081539154, 0.73832100629806519, 1 },
-    { -0.11528799682855606, 0.12764500081539154, 0.73832100629806519, 1 },
-    { 0.024726999923586845, 0.11824499815702438, 0.73832100629806519, 1 },
-    { -0.054618999361991882, 0.11824499815702438, 0.73832100629806519, 1 },
-    { -0.014945999719202518, 0.18218299746513367, 0.77956700325012207, 1 },
-    { 0.032797001302242279, 0.13758699595928192, 0.76524502038955688, 1 },
-    { -0.062688998878002167, 0.13758699595928192, 0.76524502038955688, 1 },
-    { 0.073161996901035309, 0.14496499300003052, 0.76524502038955688, 1 },
-    { -0.10305400192737579, 0.14496499300003052, 0.76524502038955688, 1 },
-    { 0.079048000276088715, 0.19881199300289154, 0.77567499876022339, 1 },
-    { -0.1089399978518486, 0.19881199300289154, 0.77567499876022339, 1 },
-    { 0.055149000138044357, 0.23632800579071045, 0.76068699359893799, 1 },
-    { -0.085041999816894531, 0.23632800579071045, 0.76068699359893799, 1 },
-    { -0.014945999719202518, 0.25398701429367065, 0.76090401411056519, 1 },
-    { 0.23151400685310364, 0.29549100995063782, 0.51651901006698608, 1 },
-    { -0.26140600442886353, 0.29549100995063782, 0.51651901006698608, 1 },
-    { 0.14972700178623199, 0.21419200301170349, 0.66190499067306519, 1 },
-    { -0.17961899936199188, 0.21419200301170349, 0.66190499067306519, 1 },
-    { 0.16523000597953796, 0.29768899083137512, 0.65201699733734131, 1 },
-    { -0.19512200355529785, 0.29768899083137512, 0.65201699733734131, 1 },
-    { 0.2066120058298111, 0.22481299936771393, 0.52189099788665771, 1 },
-    { -0.23650400340557098, 0.22481299936771393, 0.52189099788665771, 1 },
-    { -0.014945999719202518, 0.85286402702331543, 0.63712501525878906, 1 },
-    { 0.033760000020265579, 0.84224402904510498, 0.64029902219772339, 1 },
-    { -0.063652001321315765, 0.84224402904510498, 0.64029902219772339, 1 },
-    { 0.075630001723766327, 0.79671198129653931, 0.65799897909164429, 1 },
-    { -0.10552199929952621, 0.79671198129653931, 0.65799897909164429, 1 },
-    { 0.068916000425815582, 0.73433399200439453, 0.67289102077484131, 1 },
-    { -0.09880799800157547, 0.73433399200439453, 0.67289102077484131, 1 },
-    { -0.014945999719202518, 0.76277601718902588, 0.61905801296234131, 1 },
-    { 0.062447000294923782, 0.75142401456832886, 0.62109297513961792, 1 },
-    { -0.092339001595973969, 0.75142401456832886, 0.62109297513961792, 1 },
-    { 0.069255001842975616, 0.7890620231628418, 0.61499899625778198, 1 },
-    { -0.099146999418735504, 0.7890620231628418, 0.61499899625778198, 1 },
-    { 0.036079000681638718, 0.8184400200843811, 0.60046297311782837, 1 },
-    { -0.065971001982688904, 0.8184400200843811, 0.60046297311782837, 1 },
-    { -0.014945999719202518, 0.82869398593902588, 0.59903901815414429, 1 },
-    { 0.15766100585460663, -0.24100799858570099, 0.73001998662948608, 1 },
-    { -0.18755300343036652, -0.24100799858570099, 0.73001998662948608, 1 },
-    { 0.17438499629497528, -0.17838600277900696, 0.72538197040557861, 1 },
-    { -0.20427699387073517, -0.17838600277900696, 0.72538197040557861, 1 },
-    { 0.3229449987411499, -0.44803899526596069, 0.71415102481842041, 1 },
-    { -0.35283699631690979, -0.44803899526596069, 0.71415102481842041, 1 },
-    { 0.25653800368309021, -0.44010400772094727, 0.72562599182128906, 1 },
-    { -0.2864300012588501, -0.44010400772094727, 0.72562599182128906, 1 },
-    { 0.41376501321792603, -0.42008501291275024, 0.70951300859451294, 1 },
-    { -0.44365701079368591, -0.42008501291275024, 0.70951300859451294, 1 },
-    { 0.53400397300720215, -0.37101298570632935, 0.65384900569915771, 1 },
-    { -0.56389600038528442, -0.37101298570632935, 0.65384900569915771, 1 },
-    { 0.56964898109436035, -0.30558300018310547, 0.63724702596664429, 1 },
-    { -0.59954100847244263, -0.30558300018310547, 0.63724702596664429, 1 },
-    { 0.55329102277755737, -0.2158609926700592, 0.63626998662948608, 1 },
-    { -0.58318299055099487, -0.2158609926700592, 0.63626998662948608, 1 },
-    { 0.4618610143661499, -0.12613999843597412, 0.66568899154663086, 1 },
-    { -0.49175301194190979, -0.12613999843597412, 0.66568899154663086, 1 },
-    { 0.35407298803329468, -0.090861000120639801, 0.69327700138092041, 1 },
-    { -0.38396498560905457, -0.090861000120639801, 0.69327700138092041, 1 },
-    { 0.22443400323390961, -0.12919099628925323, 0.72416102886199951, 1 },
-    { -0.2543259859085083, -0.12919099628925323, 0.72416102886199951, 1 },
-    { 0.16339899599552155, -0.31815600395202637, 0.73246198892593384, 1 },
-    { -0.19329099357128143, -0.31815600395202637, 0.73246198892593384, 1 },
-    { 0.19684599339962006, -0.39396199584007263, 0.73258399963378906, 1 },
-    { -0.22673800587654114, -0.39396199584007263, 0.73258399963378906, 1 },
-    { 0.22040599584579468, -0.37662801146507263, 0.71500599384307861, 1 },
-    { -0.25029799342155457, -0.37662801146507263, 0.71500599384307861, 1 },
-    { 0.18524900078773499, -0.31608098745346069, 0.71305298805236816, 1 },
-    { -0.21514099836349487, -0.31608098745346069, 0.71305298805236816, 1 },
-    { 0.23895999789237976, -0.14615899324417114, 0.70914602279663086, 1 },
-    { -0.26885199546813965, -0.14615899324417114, 0.70914602279663086, 1 },
-    { 0.3541949987411499, -0.11490900069475174, 0.68375599384307861, 1 },
-    { -0.38408699631690979, -0.11490900069475174, 0.68375599384307861, 1 },
-    { 0.44599100947380066, -0.14518299698829651, 0.65836501121520996, 1 },
-    { -0.47588399052619934, -0.14518299698829651, 0.65836501121520996, 1 },
-    { 0.52216297388076782, -0.22819000482559204, 0.63199800252914429, 1 },
-    { -0.5520550012588501, -0.22819000482559204, 0.63199800252914429, 1 },
-    { 0.53583502769470215, -0.29947900772094727, 0.62906801700592041, 1 },
-    { -0.56572699546813965, -0.29947900772094727, 0.62906801700592041, 1 },
-    { 0.50458502769470215, -0.35611999034881592, 0.64371699094772339, 1 },
-    { -0.53447699546813965, -0.35611999034881592, 0.64371699094772339, 1 },
-    { 0.40399900078773499, -0.40592500567436218, 0.69742798805236816, 1 },
-    { -0.43389099836349487, -0.40592500567436218, 0.69742798805236816, 1 },
-    { 0.26728099584579468, -0.41471400856971741, 0.71891200542449951, 1 },
-    { -0.29717299342155457, -0.41471400856971741, 0.71891200542449951, 1 },
-    { 0.32392099499702454, -0.42350301146507263, 0.70816999673843384, 1 },
-    { -0.35381299257278442, -0.42350301146507263, 0.70816999673843384, 1 },
-    { 0.19208499789237976, -0.19303399324417114, 0.70719301700592041, 1 },
-    { -0.22197699546813965, -0.19303399324417114, 0.70719301700592041, 1 },
-    { 0.18134300410747528, -0.24869799613952637, 0.70719301700592041, 1 },
-    { -0.21123500168323517, -0.24869799613952637, 0.70719301700592041, 1 },
-    { 0.11057499796152115, -0.50942701101303101, 0.56910699605941772, 1 },
-    { -0.14046700298786163, -0.50942701101303101, 0.56910699605941772, 1 },
-    { 0.19078299403190613, -0.65820300579071045, 0.59684199094772339, 1 },
-    { -0.22067500650882721, -0.65820300579071045, 0.59684199094772339, 1 },
-    { 0.31274500489234924, -0.68554699420928955, 0.5783960223197937, 1 },
-    { -0.34263700246810913, -0.68554699420928955, 0.5783960223197937, 1 },
-    { 0.44317901134490967, -0.5736200213432312, 0.51379501819610596, 1 },
-    { -0.47307100892066956, -0.5736200213432312, 0.51379501819610596, 1 },
-    { 0.65314501523971558, -0.4836840033531189, 0.44523000717163086, 1 },
-    { -0.68303698301315308, -0.4836840033531189, 0.44523000717163086, 1 },
-    { 0.76544898748397827, -0.4055590033531189, 0.405923992395401, 1 },
-    { -0.79534202814102173, -0.4055590033531189, 0.405923992395401, 1 },
-    { 0.75482898950576782, -0.19816100597381592, 0.32010799646377563, 1 },
-    { -0.7847210168838501, -0.19816100597381592, 0.32010799646377563, 1 },
-    { 0.6045609712600708, -0.019816000014543533, 0.34378999471664429, 1 },
-    { -0.63445299863815308, -0.019816000014543533, 0.34378999471664429, 1 },
-    { 0.40172100067138672, 0.090599000453948975, 0.40546101331710815, 1 },
-    { -0.43161299824714661, 0.090599000453948975, 0.40546101331710815, 1 },
-    { -0.014945999719202518, -0.87638401985168457, 0.22013300657272339, 1 },
-    { -0.014945999719202518, -0.97037798166275024, -0.12972100079059601, 1 },
-    { -0.014945999719202518, 0.15486599504947662, -0.66243600845336914, 1 },
-    { -0.014945999719202518, 0.41634100675582886, 0.085611000657081604, 1 },
-    { -0.014945999719202518, 0.92805999517440796, 0.41275998950004578, 1 },
-    { -0.014945999719202518, 0.76595002412796021, 0.31656798720359802, 1 },
-    { -0.014945999719202518, 0.55916297435760498, 0.28189998865127563, 1 },
-    { -0.014945999719202518, 0.45564699172973633, 0.22672399878501892, 1 },
-    { 0.79975098371505737, -0.24625700712203979, 0.07035200297832489, 1 },
-    { -0.82964301109313965, -0.24625700712203979, 0.07035200297832489, 1 },
-    { 0.82138198614120483, -0.3211199939250946, -0.093626998364925385, 1 },
-    { -0.85127401351928711, -0.3211199939250946, -0.093626998364925385, 1 },
-    { 0.74786698818206787, -0.30307298898696899, -0.46253299713134766, 1 },
-    { -0.77775901556015015, -0.30307298898696899, -0.46253299713134766, 1 },
-    { 0.39374500513076782, -0.46232101321220398, -0.70918899774551392, 1 },
-    { -0.42363700270652771, -0.46232101321220398, -0.70918899774551392, 1 },
-    { 0.68536597490310669, 0.012316999956965446, 0.029029000550508499, 1 },
-    { -0.71525901556015015, 0.012316999956965446, 0.029029000550508499, 1 },
-    { 0.60114800930023193, 0.08934900164604187, -0.21175199747085571, 1 },
-    { -0.63103997707366943, 0.08934900164604187, -0.21175199747085571, 1 },
-    { 0.63483399152755737, -0.025310000404715538, -0.44429600238800049, 1 },
-    { -0.66472601890563965, -0.025310000404715538, -0.44429600238800049, 1 },
-    { 0.31057500839233398, -0.097331002354621887, -0.70475298166275024, 1 },
-    { -0.34046700596809387, -0.097331002354621887, -0.70475298166275024, 1 },
-    { 0.2217479944229126, 0.36092099547386169, 0.36502999067306519, 1 },
-    { -0.25163999199867249, 0.36092099547386169, 0.36502999067306519, 1 },
-    { 0.14691899716854095, 0.40657499432563782, 0.23551400005817413, 1 },
-    { -0.17681099474430084, 0.40657499432563782, 0.23551400005817413, 1 },
-    { 0.26459500193595886, 0.71565699577331543, 0.35929301381111145, 1 },
-    { -0.29448699951171875, 0.71565699577331543, 0.35929301381111145, 1 },
-    { 0.23505400121212006, 0.51546198129653931, 0.36405399441719055, 1 },
-    { -0.26494601368904114, 0.51546198129653931, 0.36405399441719055, 1 },
-    { 0.27107799053192139, 0.8669700026512146, 0.38655498623847961, 1 },
-    { -0.30096998810768127, 0.8669700026512146, 0.38655498623847961, 1 },
-    { 0.12738800048828125, 0.73360198736190796, 0.33011800050735474, 1 },
-    { -0.15727999806404114, 0.73360198736190796, 0.33011800050735474, 1 },
-    { 0.11701200157403946, 0.52998799085617065, 0.30570399761199951, 1 },
-    { -0.14690400660037994, 0.52998799085617065, 0.30570399761199951, 1 },
-    { 0.14777399599552155, 0.90450000762939453, 0.39786699414253235, 1 },
-    { -0.17766599357128143, 0.90450000762939453, 0.39786699414253235, 1 },
-    { 0.22088700532913208, 0.26458299160003662, 0.36103400588035583, 1 },
-    { -0.25077900290489197, 0.26458299160003662, 0.36103400588035583, 1 },
-    { 0.22423000633716583, 0.19502699375152588, 0.43025600910186768, 1 },
-    { -0.25412198901176453, 0.19502699375152588, 0.43025600910186768, 1 },
-    { 0.23816500604152679, 0.15147499740123749, 0.4580250084400177, 1 },
-    { -0.26805698871612549, 0.15147499740123749, 0.4580250084400177, 1 },
-    { 0.19768400490283966, 0.34911400079727173, 0.11204999685287476, 1 },
-    { -0.22757600247859955, 0.34911400079727173, 0.11204999685287476, 1 },
-    { 0.25824698805809021, 0.27290800213813782, -0.29488199949264526, 1 },
-    { -0.2881389856338501, 0.27290800213813782, -0.29488199949264526, 1 },
-    { 0.29592600464820862, 0.11189699918031693, -0.57926499843597412, 1 },
-    { -0.32581800222396851, 0.11189699918031693, -0.57926499843597412, 1 },
-    { 0.40534201264381409, -0.82511401176452637, -0.45137599110603333, 1 },
-    { -0.43523401021957397, -0.82511401176452637, -0.45137599110603333, 1 },
-    { 0.4049760103225708, -0.91654497385025024, -0.13301700353622437, 1 },
-    { -0.43486800789833069, -0.91654497385025024, -0.13301700353622437, 1 },
-    { 0.40558600425720215, -0.82865399122238159, 0.16300399601459503, 1 },
-    { -0.43547800183296204, -0.82865399122238159, 0.16300399601459503, 1 },
-    { 0.41388699412345886, -0.58170598745346069, 0.37430799007415771, 1 },
-    { -0.44377899169921875, -0.58170598745346069, 0.37430799007415771, 1 },
-    { 0.72846198081970215, -0.42960599064826965, 0.24527899920940399, 1 },
-    { -0.75835400819778442, -0.42960599064826965, 0.24527899920940399, 1 },
-    { 0.61566901206970215, -0.50773102045059204, 0.25895100831985474, 1 },
-    { -0.64556097984313965, -0.50773102045059204, 0.25895100831985474, 1 },
-    { 0.62006402015686035, -0.69974797964096069, 0.037760000675916672, 1 },
-    { -0.64995598793029785, -0.69974797964096069, 0.037760000675916672, 1 },
-    { 0.76276397705078125, -0.55607098340988159, 0.046792998909950256, 1 },
-    { -0.79265600442886353, -0.55607098340988159, 0.046792998909950256, 1 },
-    { 0.7652050256729126, -0.60245800018310547, -0.18269899487495422, 1 },
-    { -0.7950969934463501, -0.60245800018310547, -0.18269899487495422, 1 },
-    { 0.62177300453186035, -0.76078301668167114, -0.21382699906826019, 1 },
-    { -0.65166497230529785, -0.76078301668167114, -0.21382699906826019, 1 },
-    { 0.6193310022354126, -0.67057299613952637, -0.45784598588943481, 1 },
-    { -0.64922302961349487, -0.67057299613952637, -0.45784598588943481, 1 },
-    { 0.74330097436904907, -0.54427099227905273, -0.38753300905227661, 1 },
-    { -0.77319300174713135, -0.54427099227905273, -0.38753300905227661, 1 },
-    { 0.58820301294326782, -0.35929399728775024, -0.60201102495193481, 1 },
-    { -0.61809498071670532, -0.35929399728775024, -0.60201102495193481, 1 },
-    { 0.46705898642539978, -0.03971400111913681, -0.566569983959198, 1 },
-    { -0.49695101380348206, -0.03971400111913681, -0.566569983959198, 1 },
-    { 0.80981999635696411, -0.36783900856971741, -0.24909600615501404, 1 },
-    { -0.83971202373504639, -0.36783900856971741, -0.24909600615501404, 1 },
-    { 0.39080899953842163, 0.16145800054073334, 0.11501900106668472, 1 },
-    { -0.42070099711418152, 0.16145800054073334, 0.11501900106668472, 1 },
-    { 0.42389699816703796, 0.15388999879360199, -0.25154700875282288, 1 },
-    { -0.45378899574279785, 0.15388999879360199, -0.25154700875282288, 1 },
-    { 0.88300299644470215, -0.41569000482559204, -0.30257201194763184, 1 },
-    { -0.91289502382278442, -0.41569000482559204, -0.30257201194763184, 1 },
-    { 0.77838897705078125, 0.10091099888086319, -0.22530199587345123, 1 },
-    { -0.80828100442886353, 0.10091099888086319, -0.22530199587345123, 1 },
-    { 1.0209430456161499, 0.057698000222444534, -0.37691301107406616, 1 },
-    { -1.0508350133895874, 0.057698000222444534, -0.37691301107406616, 1 },
-    { 1.2399369478225708, -0.091104999184608459, -0.47029700875282288, 1 },
-    { -1.2698290348052979, -0.091104999184608459, -0.47029700875282288, 1 },
-    { 1.3054889440536499, -0.32425999641418457, -0.4751800000667572, 1 },
-    { -1.335381031036377, -0.32425999641418457, -0.4751800000667572, 1 },
-    { 1.2035599946975708, -0.48795598745346069, -0.46407100558280945, 1 },
-    { -1.2334519624710083, -0.48795598745346069, -0.46407100558280945, 1 },
-    { 1.017035961151123, -0.47953298687934875, -0.37764599919319153, 1 },
-    { -1.0469280481338501, -0.47953298687934875, -0.37764599919319153, 1 },
-    { 1.0122760534286499, -0.42936199903488159, -0.34810501337051392, 1 },
-    { -1.0421680212020874, -0.42936199903488159, -0.34810501337051392, 1 },
-    { 1.1648639440536499, -0.43522199988365173, -0.43331000208854675, 1 },
-    { -1.194756031036377, -0.43522199988365173, -0.43331000208854675, 1 },
-    { 1.2404249906539917, -0.30045598745346069, -0.45540401339530945, 1 },
-    { -1.2703169584274292, -0.30045598745346069, -0.45540401339530945, 1 },
-    { 1.1858600378036499, -0.10880599915981293, -0.44539499282836914, 1 },
-    { -1.2157520055770874, -0.10880599915981293, -0.44539499282836914, 1 },
-    { 1.0155719518661499, 0.010823000222444534, -0.34981399774551392, 1 },
-    { -1.045464038848877, 0.010823000222444534, -0.34981399774551392, 1 },
-    { 0.8246539831161499, 0.044392999261617661, -0.21236200630664825, 1 },
-    { -0.85454601049423218, 0.044392999261617661, -0.21236200630664825, 1 },
-    { 0.90876001119613647, -0.37662801146507263, -0.28060001134872437, 1 },
-    { -0.93865197896957397, -0.37662801146507263, -0.28060001134872437, 1 },
-    { 0.93122100830078125, -0.32706698775291443, -0.33699598908424377, 1 },
-    { -0.96111297607421875, -0.32706698775291443, -0.33699598908424377, 1 },
-    { 0.8720170259475708, 0.0037430000957101583, -0.27889099717140198, 1 },
-    { -0.9019089937210083, 0.0037430000957101583, -0.27889099717140198, 1 },
-    { 1.0230180025100708, -0.024333000183105469, -0.4001069962978363, 1 },
-    { -1.0529099702835083, -0.024333000183105469, -0.4001069962978363, 1 },
-    { 1.1651079654693604, -0.11942599713802338, -0.47933000326156616, 1 },
-    { -1.1950000524520874, -0.11942599713802338, -0.47933000326156616, 1 },
-    { 1.2121050357818604, -0.26786300539970398, -0.48885199427604675, 1 },
-    { -1.2419970035552979, -0.26786300539970398, -0.48885199427604675, 1 },
-    { 1.1500929594039917, -0.37113499641418457, -0.47237199544906616, 1 },
-    { -1.1799850463867188, -0.37113499641418457, -0.47237199544906616, 1 },
-    { 1.0182570219039917, -0.36771699786186218, -0.40242600440979004, 1 },
-    { -1.0481489896774292, -0.36771699786186218, -0.40242600440979004, 1 },
-    { 0.8363720178604126, -0.30777999758720398, -0.25984799861907959, 1 },
-    { -0.8662639856338501, -0.30777999758720398, -0.25984799861907959, 1 },
-    { 0.81391102075576782, -0.1937669962644577, -0.31416898965835571, 1 },
-    { -0.84380298852920532, -0.1937669962644577, -0.31416898965835571, 1 },
-    { 0.75751501321792603, -0.11686199903488159, -0.31404700875282288, 1 },
-    { -0.78740698099136353, -0.11686199903488159, -0.31404700875282288, 1 },
-    { 0.79668599367141724, -0.091362997889518738, -0.32524999976158142, 1 },
-    { -0.82657802104949951, -0.091362997889518738, -0.32524999976158142, 1 },
-    { 0.80866199731826782, -0.04276600107550621, -0.31343701481819153, 1 },
-    { -0.8385540246963501, -0.04276600107550621, -0.31343701481819153, 1 },
-    { 0.79877501726150513, -0.0065109999850392342, -0.3033050000667572, 1 },
-    { -0.82866698503494263, -0.0065109999850392342, -0.3033050000667572, 1 },
-    { 0.72422999143600464, -0.052246000617742538, -0.12207099795341492, 1 },
-    { -0.75412201881408691, -0.052246000617742538, -0.12207099795341492, 1 },
-    { 0.71258002519607544, 0.0072650001384317875, -0.21201199293136597, 1 },
-    { -0.74247199296951294, 0.0072650001384317875, -0.21201199293136597, 1 },
-    { 0.72336101531982422, -0.068594001233577728, -0.23576200008392334, 1 },
-    { -0.75325298309326172, -0.068594001233577728, -0.23576200008392334, 1 },
-    { 0.7886430025100708, -0.22172099351882935, -0.2425139993429184, 1 },
-    { -0.8185349702835083, -0.22172099351882935, -0.2425139993429184, 1 },
-    { 0.87055200338363647, -0.26615399122238159, -0.312826007604599, 1 },
-    { -0.90044397115707397, -0.26615399122238159, -0.312826007604599, 1 },
-    { 0.88568902015686035, -0.24686700105667114, -0.36385199427604675, 1 },
-    { -0.91558098793029785, -0.24686700105667114, -0.36385199427604675, 1 },
-    { 0.82207697629928589, -0.01258699968457222, -0.34326198697090149, 1 },
-    { -0.85196900367736816, -0.01258699968457222, -0.34326198697090149, 1 },
-    { 0.8380810022354126, -0.044718999415636063, -0.35896900296211243, 1 },
-    { -0.86797302961349487, -0.044718999415636063, -0.35896900296211243, 1 },
-    { 0.81574201583862305, -0.098062999546527863, -0.35921299457550049, 1 },
-    { -0.84563499689102173, -0.098062999546527863, -0.35921299457550049, 1 },
-    { 0.7797589898109436, -0.12673600018024445, -0.35389599204063416, 1 },
-    { -0.80965101718902588, -0.12673600018024445, -0.35389599204063416, 1 },
-    { 0.83051300048828125, -0.18314599990844727, -0.35933500528335571, 1 },
-    { -0.86040502786636353, -0.18314599990844727, -0.35933500528335571, 1 },
-    { 1.0341670513153076, -0.34090200066566467, -0.44856798648834229, 1 },
-    { -1.0640590190887451, -0.34090200066566467, -0.44856798648834229, 1 },
-    { 1.1498899459838867, -0.34383198618888855, -0.50423300266265869, 1 },
-    { -1.1797820329666138, -0.34383198618888855, -0.50423300266265869, 1 },
-    { 1.2074660062789917, -0.25419101119041443, -0.51570701599121094, 1 },
-    { -1.2373579740524292, -0.25419101119041443, -0.51570701599121094, 1 },
-    { 1.1609569787979126, -0.12675000727176666, -0.50410997867584229, 1 },
-    { -1.1908489465713501, -0.12675000727176666, -0.50410997867584229, 1 },
-    { 1.0248490571975708, -0.043497998267412186, -0.44173300266265869, 1 },
-    { -1.0547410249710083, -0.043497998267412186, -0.44173300266265869, 1 },
-    { 0.88446801900863647, -0.015544000081717968, -0.33479899168014526, 1 },
-    { -0.91435998678207397, -0.015544000081717968, -0.33479899168014526, 1 },
-    { 0.94782298803329468, -0.30216500163078308, -0.38960900902748108, 1 },
-    { -0.97771501541137695, -0.30216500163078308, -0.38960900902748108, 1 },
-    { 0.87555700540542603, -0.13444000482559204, -0.37361699342727661, 1 },
-    { -0.90544897317886353, -0.13444000482559204, -0.37361699342727661, 1 },
-    { 0.9092479944229126, -0.080973997712135315, -0.37496000528335571, 1 },
-    { -0.93914002180099487, -0.080973997712135315, -0.37496000528335571, 1 },
-    { 0.98505401611328125, -0.13651600480079651, -0.41292399168014526, 1 },
-    { -1.0149459838867188, -0.13651600480079651, -0.41292399168014526, 1 },
-    { 0.94074201583862305, -0.19388900697231293, -0.39351499080657959, 1 },
-    { -0.97063499689102173, -0.19388900697231293, -0.39351499080657959, 1 },
-    { 0.9995800256729126, -0.25248199701309204, -0.4157319962978363, 1 },
-    { -1.0294719934463501, -0.25248199701309204, -0.4157319962978363, 1 },
-    { 1.0528030395507812, -0.19791699945926666, -0.43660598993301392, 1 },
-    { -1.0826950073242188, -0.19791699945926666, -0.43660598993301392, 1 },
-    { 1.1085350513458252, -0.24370700120925903, -0.45480799674987793, 1 },
-    { -1.1384270191192627, -0.24370700120925903, -0.45480799674987793, 1 },
-    { 1.0721310377120972, -0.29488199949264526, -0.4452730119228363, 1 },
-    { -1.1020230054855347, -0.29488199949264526, -0.4452730119228363, 1 },
-    { 1.0178910493850708, -0.39591500163078308, -0.50252401828765869, 1 },
-    { -1.0477830171585083, -0.39591500163078308, -0.50252401828765869, 1 },
-    { 1.2248810529708862, -0.42081698775291443, -0.56042599678039551, 1 },
-    { -1.2547739744186401, -0.42081698775291443, -0.56042599678039551, 1 },
-    { 1.313323974609375, -0.30772599577903748, -0.540382981300354, 1 },
-    { -1.3432159423828125, -0.30772599577903748, -0.540382981300354, 1 },
-    { 1.2600380182266235, -0.13431799411773682, -0.5546879768371582, 1 },
-    { -1.289929986000061, -0.13431799411773682, -0.5546879768371582, 1 },
-    { 1.0249710083007812, -0.0087080001831054688, -0.50056999921798706, 1 },
-    { -1.0548629760742188, -0.0087080001831054688, -0.50056999921798706, 1 },
-    { 0.79303699731826782, 0.028767999261617661, -0.3844819962978363, 1 },
-    { -0.8229290246963501, 0.028767999261617661, -0.3844819962978363, 1 },
-    { 0.8494340181350708, -0.33890798687934875, -0.42073601484298706, 1 },
-    { -0.8793259859085083, -0.33890798687934875, -0.42073601484298706, 1 },
-};
-
-static vector_t monkey_normals[]
-__attribute__((aligned(32))) = {
-    { 0.70262801647186279, -0.22882799804210663, 0.67372697591781616, 0 },
-    { 0.74453002214431763, -0.0009459999855607748, 0.66756200790405273, 0 },
-    { 0.82174098491668701, -0.0019529999699443579, 0.56981098651885986, 0 },
-    { 0.77666598558425903, -0.26319199800491333, 0.57228302955627441, 0 },
-    { 0.6286810040473938, -0.51557999849319458, 0.58214098215103149, 0 },
-    { 0.57304602861404419, -0.43525499105453491, 0.69435697793960571, 0 },
-    { 0.61803001165390015, -0.5025789737701416, 0.60448002815246582, 0 },
-    { 0.7595750093460083, -0.2643510103225708, 0.59422600269317627, 0 },
-    { 0.80608499050140381, -0.0010069999843835831, 0.59178400039672852, 0 },
-    { -0.70262801647186279, -0.22882799804210663, 0.67372697591781616, 0 },
-    { -0.7595750093460083, -0.2643510103225708, 0.59422600269317627, 0 },
-    { -0.61803001165390015, -0.5025789737701416, 0.60448002815246582, 0 },
-    { -0.57304602861404419, -0.43525499105453491, 0.69435697793960571, 0 },
-    { -0.6286810040473938, -0.51557999849319458, 0.58214098215103149, 0 },
-    { -0.77666598558425903, -0.26319199800491333, 0.57228302955627441, 0 },
-    { -0.82174098491668701, -0.0019529999699443579, 0.56981098651885986, 0 },
-    { -0.74453002214431763, -0.0009459999855607748, 0.66756200790405273, 0 },
-    { -0.80608499050140381, -0.0010069999843835831, 0.59178400039672852, 0 },
-    { 0.81395900249481201, -0.29874598979949951, 0.49815401434898376, 0 },
-    { 0.8652610182762146, -0.0013729999773204327, 0.5012969970703125, 0 },
-    { 0.65654498338699341, -0.56965899467468262, 0.49436900019645691, 0 },
-    { 0.67876201868057251, -0.57298499345779419, 0.45930400490760803, 0 },
-    { 0.83193498849868774, -0.29905098676681519, 0.46733000874519348, 0 },
-    { 0.88146597146987915, -0.00048799999058246613, 0.47224301099777222, 0 },
-    { -0.81395900249481201, -0.29874598979949951, 0.49815401434898376, 0 },
-    { -0.83193498849868774, -0.29905098676681519, 0.46733000874519348, 0 },
-    { -0.67876201868057251, -0.57298499345779419, 0.45930400490760803, 0 },
-    { -0.65654498338699341, -0.56965899467468262, 0.49436900019645691, 0 },
-    { -0.8652610182762146, -0.0013729999773204327, 0.5012969970703125, 0 },
-    { -0.88146597146987915, -0.00048799999058246613, 0.47224301099777222, 0 },
-    { 0.40626201033592224, -0.7709280252456665, 0.49049299955368042, 0 },
-    { 0.39521500468254089, -0.67622900009155273, 0.62166202068328857, 0 },
-    { 0.11233899742364883, -0.75515002012252808, 0.64580202102661133, 0 },
-    { 0.086733996868133545, -0.86187297105789185, 0.4995880126953125, 0 },
-    { 0.09775099903345108, -0.88842397928237915, 0.44846901297569275, 0 },
-    { 0.42594701051712036, -0.78664499521255493, 0.44691300392150879, 0 },
-    { -0.40626201033592224, -0.7709280252456665, 0.49049299955368042, 0 },
-    { -0.42594701051712036, -0.78664499521255493, 0.44691300392150879, 0 },
-    { -0.09775099903345108, -0.88842397928237915, 0.44846901297569275, 0 },
-    { -0.086733996868133545, -0.86187297105789185, 0.4995880126953125, 0 },
-    { -0.11233899742364883, -0.75515002012252808, 0.64580202102661133, 0 },
-    { -0.39521500468254089, -0.67622900009155273, 0.62166202068328857, 0 },
-    { 0.37583500146865845, -0.57875299453735352, 0.72368502616882324, 0 },
-    { 0.39854100346565247, -0.70058298110961914, 0.59187597036361694, 0 },
-    { 0.11697699874639511, -0.78386801481246948, 0.60975998640060425, 0 },
-    { 0.13660100102424622, -0.64116299152374268, 0.75511997938156128, 0 },
-    { -0.37583500146865845, -0.57875299453735352, 0.72368502616882324, 0 },
-    { -0.13660100102424622, -0.64116299152374268, 0.75511997938156128, 0 },
-    { -0.11697699874639511, -0.78386801481246948, 0.60975998640060425, 0 },
-    { -0.39854100346565247, -0.70058298110961914, 0.59187597036361694, 0 },
-    { -0.12643800675868988, -0.61375802755355835, 0.77925997972488403, 0 },
-    { -0.19919399917125702, -0.75124400854110718, 0.62923097610473633, 0 },
-    { -0.49375900626182556, -0.57853901386260986, 0.64919000864028931, 0 },
-    { -0.37354698777198792, -0.47065600752830505, 0.79931002855300903, 0 },
-    { -0.4608910083770752, -0.54835700988769531, 0.69774502515792847, 0 },
-    { -0.19080199301242828, -0.716513991355896, 0.67094898223876953, 0 },
-    { 0.12643800675868988, -0.61375802755355835, 0.77925997972488403, 0 },
-    { 0.19080199301242828, -0.716513991355896, 0.67094898223876953, 0 },
-    { 0.4608910083770752, -0.54835700988769531, 0.69774502515792847, 0 },
-    { 0.37354698777198792, -0.47065600752830505, 0.79931002855300903, 0 },
-    { 0.49375900626182556, -0.57853901386260986, 0.64919000864028931, 0 },
-    { 0.19919399917125702, -0.75124400854110718, 0.62923097610473633, 0 },
-    { -0.25055700540542603, -0.81511902809143066, 0.52223300933837891, 0 },
-    { -0.54481601715087891, -0.626118004322052, 0.55775600671768188, 0 },
-    { -0.56309700012207031, -0.65120398998260498, 0.5087130069732666, 0 },
-    { -0.25623300671577454, -0.84487402439117432, 0.4695580005645752, 0 },
-    { 0.25055700540542603, -0.81511902809143066, 0.52223300933837891, 0 },
-    { 0.25623300671577454, -0.84487402439117432, 0.4695580005645752, 0 },
-    { 0.56309700012207031, -0.65120398998260498, 0.5087130069732666, 0 },
-    { 0.54481601715087891, -0.626118004322052, 0.55775600671768188, 0 },
-    { -0.74004298448562622, -0.33265200257301331, 0.58449000120162964, 0 },
-    { -0.63792800903320312, -0.28717899322509766, 0.71452999114990234, 0 },
-    { -0.69392997026443481, -0.0011289999820291996, 0.72002297639846802, 0 },
-    { -0.80297201871871948, -0.0015559999737888575, 0.59596502780914307, 0 },
-    { -0.83324700593948364, -0.00039699999615550041, 0.55284297466278076, 0 },
-    { -0.7674180269241333, -0.3469339907169342, 0.53913998603820801, 0 },
-    { 0.74004298448562622, -0.33265200257301331, 0.58449000120162964, 0 },
-    { 0.7674180269241333, -0.3469339907169342, 0.53913998603820801, 0 },
-    { 0.83324700593948364, -0.00039699999615550041, 0.55284297466278076, 0 },
-    { 0.80297201871871948, -0.0015559999737888575, 0.59596502780914307, 0 },
-    { 0.69392997026443481, -0.0011289999820291996, 0.72002297639846802, 0 },
-    { 0.63792800903320312, -0.28717899322509766, 0.71452999114990234, 0 },
-    { -0.53770601749420166, -0.24271400272846222, 0.80742800235748291, 0 },
-    { -0.69585299491882324, -0.30478799343109131, 0.65025800466537476, 0 },
-    { -0.76195597648620605, -0.002440999960526824, 0.64760297536849976, 0 },
-    { -0.58806097507476807, -0.00097699998877942562, 0.80880200862884521, 0 },
-    { 0.53770601749420166, -0.24271400272846222, 0.80742800235748291, 0 },
-    { 0.58806097507476807, -0.00097699998877942562, 0.80880200862884521, 0 },
-    { 0.76195597648620605, -0.002440999960526824, 0.64760297536849976, 0 },
-    { 0.69585299491882324, -0.30478799343109131, 0.65025800466537476, 0 },
-    { -0.54603701829910278, 0.23996700346469879, 0.80260598659515381, 0 },
-    { -0.70931100845336914, 0.29545000195503235, 0.639972984790802, 0 },
-    { -0.52079802751541138, 0.57921099662780762, 0.62709397077560425, 0 },
-    { -0.3913080096244812, 0.47669899463653564, 0.78713297843933105, 0 },
-    { -0.46452200412750244, 0.54228299856185913, 0.70006400346755981, 0 },
-    { -0.63933199644088745, 0.28196099400520325, 0.71532297134399414, 0 },
-    { 0.54603701829910278, 0.23996700346469879, 0.80260598659515381, 0 },
-    { 0.63933199644088745, 0.28196099400520325, 0.71532297134399414, 0 },
-    { 0.46452200412750244, 0.54228299856185913, 0.70006400346755981, 0 },
-    { 0.3913080096244812, 0.47669899463653564, 0.78713297843933105, 0 },
-    { 0.52079802751541138, 0.57921099662780762, 0.62709397077560425, 0 },
-    { 0.70931100845336914, 0.29545000195503235, 0.639972984790802, 0 },
-    { -0.7368999719619751, 0.3238619863986969, 0.59334099292755127, 0 },
-    { -0.53831601142883301, 0.60991197824478149, 0.58152997493743896, 0 },
-    { -0.54924201965332031, 0.63640201091766357, 0.54151999950408936, 0 },
-    { -0.76140600442886353, 0.34089198708534241, 0.55137801170349121, 0 },
-    { 0.7368999719619751, 0.3238619863986969, 0.59334099292755127, 0 },
-    { 0.76140600442886353, 0.34089198708534241, 0.55137801170349121, 0 },
-    { 0.54924201965332031, 0.63640201091766357, 0.54151999950408936, 0 },
-    { 0.53831601142883301, 0.60991197824478149, 0.58152997493743896, 0 },
-    { -0.24015000462532043, 0.79461002349853516, 0.55757302045822144, 0 },
-    { -0.19193099439144135, 0.71337002515792847, 0.67394000291824341, 0 },
-    { 0.1134679988026619, 0.7521899938583374, 0.64906799793243408, 0 },
-    { 0.09372200071811676, 0.83812999725341797, 0.53730899095535278, 0 },
-    { 0.10593000054359436, 0.85946202278137207, 0.5000460147857666, 0 },
-    { -0.23944799602031708, 0.82097798585891724, 0.5182960033416748, 0 },
-    { 0.24015000462532043, 0.79461002349853516, 0.55757302045822144, 0 },
-    { 0.23944799602031708, 0.82097798585891724, 0.5182960033416748, 0 },
-    { -0.10593000054359436, 0.85946202278137207, 0.5000460147857666, 0 },
-    { -0.09372200071811676, 0.83812999725341797, 0.53730899095535278, 0 },
-    { -0.1134679988026619, 0.7521899938583374, 0.64906799793243408, 0 },
-    { 0.19193099439144135, 0.71337002515792847, 0.67394000291824341, 0 },
-    { -0.14105699956417084, 0.63460201025009155, 0.75981897115707397, 0 },
-    { -0.22067900002002716, 0.77324700355529785, 0.59440898895263672, 0 },
-    { 0.10922600328922272, 0.81398999691009521, 0.57045197486877441, 0 },
-    { 0.13263300061225891, 0.66655498743057251, 0.73351198434829712, 0 },
-    { 0.14105699956417084, 0.63460201025009155, 0.75981897115707397, 0 },
-    { -0.13263300061225891, 0.66655498743057251, 0.73351198434829712, 0 },
-    { -0.10922600328922272, 0.81398999691009521, 0.57045197486877441, 0 },
-    { 0.22067900002002716, 0.77324700355529785, 0.59440898895263672, 0 },
-    { 0.38239699602127075, 0.59810197353363037, 0.70427602529525757, 0 },
-    { 0.40644600987434387, 0.72307497262954712, 0.55848902463912964, 0 },
-    { 0.64607697725296021, 0.5174109935760498, 0.56108301877975464, 0 },
-    { 0.58449000120162964, 0.44038200378417969, 0.68144798278808594, 0 },
-    { 0.6212959885597229, 0.49626100063323975, 0.60634201765060425, 0 },
-    { 0.39750400185585022, 0.67229199409484863, 0.62446999549865723, 0 },
-    { -0.38239699602127075, 0.59810197353363037, 0.70427602529525757, 0 },
-    { -0.39750400185585022, 0.67229199409484863, 0.62446999549865723, 0 },
-    { -0.6212959885597229, 0.49626100063323975, 0.60634201765060425, 0 },
-    { -0.58449000120162964, 0.44038200378417969, 0.68144798278808594, 0 },
-    { -0.64607697725296021, 0.5174109935760498, 0.56108301877975464, 0 },
-    { -0.40644600987434387, 0.72307497262954712, 0.55848902463912964, 0 },
-    { 0.40720799565315247, 0.74880200624465942, 0.52290397882461548, 0 },
-    { 0.65559899806976318, 0.55244600772857666, 0.51472502946853638, 0 },
-    { 0.67351299524307251, 0.55735999345779419, 0.48548799753189087, 0 },
-    { 0.42381098866462708, 0.76165002584457397, 0.49012699723243713, 0 },
-    { -0.40720799565315247, 0.74880200624465942, 0.52290397882461548, 0 },
-    { -0.42381098866462708, 0.76165002584457397, 0.49012699723243713, 0 },
-    { -0.67351299524307251, 0.55735999345779419, 0.48548799753189087, 0 },
-    { -0.65559899806976318, 0.55244600772857666, 0.51472502946853638, 0 },
-    { 0.81249397993087769, 0.29029199481010437, 0.50547802448272705, 0 },
-    { 0.76079601049423218, 0.2595599889755249, 0.59477502107620239, 0 },
-    { 0.82866901159286499, 0.29319098591804504, 0.47675999999046326, 0 },
-    { -0.81249397993087769, 0.29029199481010437, 0.50547802448272705, 0 },
-    { -0.82866901159286499, 0.29319098591804504, 0.47675999999046326, 0 },
-    { -0.76079601049423218, 0.2595599889755249, 0.59477502107620239, 0 },
-    { 0.70851802825927734, 0.22617299854755402, 0.66844701766967773, 0 },
-    { 0.78594297170639038, 0.25577598810195923, 0.56288301944732666, 0 },
-    { -0.70851802825927734, 0.22617299854755402, 0.66844701766967773, 0 },
-    { -0.78594297170639038, 0.25577598810195923, 0.56288301944732666, 0 },
-    { 0.82418298721313477, 0.27140098810195923, 0.49699398875236511, 0 },
-    { 0.8638569712638855, -0.0021059999708086252, 0.50367701053619385, 0 },
-    { 0.67589300870895386, 0.56361597776412964, 0.47483700513839722, 0 },
-    { 0.54878401756286621, 0.36149200797080994, 0.75374597311019897, 0 },
-    { 0.645160973072052, 0.17624400556087494, 0.743399977684021, 0 },
-    { 0.66096997261047363, -0.0017089999746531248, 0.7503889799118042, 0 },
-    { -0.82418298721313477, 0.27140098810195923, 0.49699398875236511, 0 },
-    { -0.645160973072052, 0.17624400556087494, 0.743399977684021, 0 },
-    { -0.54878401756286621, 0.36149200797080994, 0.75374597311019897, 0 },
-    { -0.67589300870895386, 0.56361597776412964, 0.47483700513839722, 0 },
-    { -0.8638569712638855, -0.0021059999708086252, 0.50367701053619385, 0 },
-    { -0.66096997261047363, -0.0017089999746531248, 0.7503889799118042, 0 },
-    { 0.41401401162147522, 0.79256600141525269, 0.44764500856399536, 0 },
-    { 0.078982003033161163, 0.89892297983169556, 0.4308600127696991, 0 },
-    { 0.15189099311828613, 0.61357498168945312, 0.77486497163772583, 0 },
-    { 0.38029098510742188, 0.54118502140045166, 0.7499619722366333, 0 },
-    { -0.41401401162147522, 0.79256600141525269, 0.44764500856399536, 0 },
-    { -0.38029098510742188, 0.54118502140045166, 0.7499619722366333, 0 },
-    { -0.15189099311828613, 0.61357498168945312, 0.77486497163772583, 0 },
-    { -0.078982003033161163, 0.89892297983169556, 0.4308600127696991, 0 },
-    { -0.27970200777053833, 0.84511899948120117, 0.45551899075508118, 0 },
-    { -0.6042969822883606, 0.63536500930786133, 0.48069700598716736, 0 },
-    { -0.35651698708534241, 0.42796099185943604, 0.83047002553939819, 0 },
-    { -0.12399700284004211, 0.58980101346969604, 0.79793697595596313, 0 },
-    { 0.27970200777053833, 0.84511899948120117, 0.45551899075508118, 0 },
-    { 0.12399700284004211, 0.58980101346969604, 0.79793697595596313, 0 },
-    { 0.35651698708534241, 0.42796099185943604, 0.83047002553939819, 0 },
-    { 0.6042969822883606, 0.63536500930786133, 0.48069700598716736, 0 },
-    { -0.81389802694320679, 0.33463498950004578, 0.47492900490760803, 0 },
-    { -0.88790601491928101, -0.0026859999634325504, 0.45994400978088379, 0 },
-    { -0.58198797702789307, -0.0025939999613910913, 0.81316602230072021, 0 },
-    { -0.53138798475265503, 0.22516599297523499, 0.81664502620697021, 0 },
-    { 0.81389802694320679, 0.33463498950004578, 0.47492900490760803, 0 },
-    { 0.53138798475265503, 0.22516599297523499, 0.81664502620697021, 0 },
-    { 0.58198797702789307, -0.0025939999613910913, 0.81316602230072021, 0 },
-    { 0.88790601491928101, -0.0026859999634325504, 0.45994400978088379, 0 },
-    { -0.80727601051330566, -0.34949800372123718, 0.47550898790359497, 0 },
-    { -0.58995300531387329, -0.64897602796554565, 0.48036101460456848, 0 },
-    { -0.35428899526596069, -0.45252799987792969, 0.81832301616668701, 0 },
-    { -0.53245598077774048, -0.24228599667549133, 0.81099897623062134, 0 },
-    { 0.80727601051330566, -0.34949800372123718, 0.47550898790359497, 0 },
-    { 0.53245598077774048, -0.24228599667549133, 0.81099897623062134, 0 },
-    { 0.35428899526596069, -0.45252799987792969, 0.81832301616668701, 0 },
-    { 0.58995300531387329, -0.64897602796554565, 0.48036101460456848, 0 },
-    { -0.27381199598312378, -0.84676700830459595, 0.45603799819946289, 0 },
-    { 0.080293998122215271, -0.89733600616455078, 0.4339430034160614, 0 },
-    { 0.14661100506782532, -0.64159101247787476, 0.75286102294921875, 0 },
-    { -0.12979499995708466, -0.6138489842414856, 0.7786489725112915, 0 },
-    { 0.27381199598312378, -0.84676700830459595, 0.45603799819946289, 0 },
-    { 0.12979499995708466, -0.6138489842414856, 0.7786489725112915, 0 },
-    { -0.14661100506782532, -0.64159101247787476, 0.75286102294921875, 0 },
-    { -0.080293998122215271, -0.89733600616455078, 0.4339430034160614, 0 },
-    { 0.41038200259208679, -0.79195499420166016, 0.45207101106643677, 0 },
-    { 0.66399097442626953, -0.57319897413253784, 0.48008701205253601, 0 },
-    { 0.54637300968170166, -0.3852660059928894, 0.74364501237869263, 0 },
-    { 0.37986400723457336, -0.56593501567840576, 0.73168098926544189, 0 },
-    { -0.41038200259208679, -0.79195499420166016, 0.45207101106643677, 0 },
-    { -0.37986400723457336, -0.56593501567840576, 0.73168098926544189, 0 },
-    { -0.54637300968170166, -0.3852660059928894, 0.74364501237869263, 0 },
-    { -0.66399097442626953, -0.57319897413253784, 0.48008701205253601, 0 },
-    { 0.81862801313400269, -0.28339499235153198, 0.49946600198745728, 0 },
-    { 0.646107017993927, -0.19089299440383911, 0.73897498846054077, 0 },
-    { -0.81862801313400269, -0.28339499235153198, 0.49946600198745728, 0 },
-    { -0.646107017993927, -0.19089299440383911, 0.73897498846054077, 0 },
-    { 0.41465499997138977, -0.075259000062942505, 0.90682697296142578, 0 },
-    { 0.39930400252342224, -0.0009459999855607748, 0.91680699586868286, 0 },
-    { 0.19092400372028351, -0.0026249999646097422, 0.98156702518463135, 0 },
-    { 0.35334300994873047, -0.12625500559806824, 0.92690801620483398, 0 },
-    { -0.41465499997138977, -0.075259000062942505, 0.90682697296142578, 0 },
-    { -0.39930400252342224, -0.0009459999855607748, 0.91680699586868286, 0 },
-    { -0.35334300994873047, -0.12625500559806824, 0.92690801620483398, 0 },
-    { -0.19092400372028351, -0.0026249999646097422, 0.98156702518463135, 0 },
-    { 0.30219399929046631, -0.20706799626350403, 0.93044799566268921, 0 },
-    { 0.20178799331188202, -0.1978210061788559, 0.95922702550888062, 0 },
-    { -0.30219399929046631, -0.20706799626350403, 0.93044799566268921, 0 },
-    { -0.20178799331188202, -0.1978210061788559, 0.95922702550888062, 0 },
-    { 0.080476999282836914, -0.21552200615406036, 0.97314399480819702, 0 },
-    { 0.0086669996380805969, -0.12463799864053726, 0.992156982421875, 0 },
-    { -0.080476999282836914, -0.21552200615406036, 0.97314399480819702, 0 },
-    { -0.0086669996380805969, -0.12463799864053726, 0.992156982421875, 0 },
-    { -0.086824998259544373, -0.06381399929523468, 0.99417102336883545, 0 },
-    { -0.067965000867843628, -0.00048799999058246613, 0.99768102169036865, 0 },
-    { 0.086824998259544373, -0.06381399929523468, 0.99417102336883545, 0 },
-    { 0.067965000867843628, -0.00048799999058246613, 0.99768102169036865, 0 },
-    { -0.086001001298427582, 0.058077000081539154, 0.99459797143936157, 0 },
-    { 0.0099189998582005501, 0.11706899851560593, 0.9930419921875, 0 },
-    { 0.086001001298427582, 0.058077000081539154, 0.99459797143936157, 0 },
-    { -0.0099189998582005501, 0.11706899851560593, 0.9930419921875, 0 },
-    { 0.08267500251531601, 0.20340600609779358, 0.97558498382568359, 0 },
-    { 0.20246000587940216, 0.18536899983882904, 0.96157699823379517, 0 },
-    { -0.08267500251531601, 0.20340600609779358, 0.97558498382568359, 0 },
-    { -0.20246000587940216, 0.18536899983882904, 0.96157699823379517, 0 },
-    { 0.30130898952484131, 0.19547100365161896, 0.93325597047805786, 0 },
-    { 0.35264098644256592, 0.1186859980225563, 0.92818999290466309, 0 },
-    { -0.30130898952484131, 0.19547100365161896, 0.93325597047805786, 0 },
-    { -0.35264098644256592, 0.1186859980225563, 0.92818999290466309, 0 },
-    { 0.41410601139068604, 0.06924699991941452, 0.90755897760391235, 0 },
-    { -0.41410601139068604, 0.06924699991941452, 0.90755897760391235, 0 },
-    { 0.1012599989771843, -0.89876997470855713, 0.4265269935131073, 0 },
-    { 0.097354002296924591, -0.98544299602508545, 0.13934800028800964, 0 },
-    { 0.14859500527381897, -0.9830319881439209, 0.10745599865913391, 0 },
-    { 0.16376200318336487, -0.89593201875686646, 0.41285398602485657, 0 },
-    { 0.15533900260925293, -0.76894402503967285, 0.62010598182678223, 0 },
-    { 0.091342002153396606, -0.78835397958755493, 0.60838598012924194, 0 },
-    { 0, -0.79366397857666016, 0.60832500457763672, 0 },
-    { 0, -0.89977699518203735, 0.43632298707962036, 0 },
-    { 0, -0.98745697736740112, 0.1578110009431839, 0 },
-    { -0.1012599989771843, -0.89876997470855713, 0.4265269935131073, 0 },
-    { -0.091342002153396606, -0.78835397958755493, 0.60838598012924194, 0 },
-    { -0.15533900260925293, -0.76894402503967285, 0.62010598182678223, 0 },
-    { -0.16376200318336487, -0.89593201875686646, 0.41285398602485657, 0 },
-    { -0.14859500527381897, -0.9830319881439209, 0.10745599865913391, 0 },
-    { -0.097354002296924591, -0.98544299602508545, 0.13934800028800964, 0 },
-    { 0.2691119909286499, -0.85625797510147095, 0.44084000587463379, 0 },
-    { 0.26175698637962341, -0.96023398637771606, 0.096773996949195862, 0 },
-    { 0.59660601615905762, -0.79482400417327881, 0.11078199744224548, 0 },
-    { 0.47279301285743713, -0.71571999788284302, 0.51396197080612183, 0 },
-    { 0.37904000282287598, -0.55177497863769531, 0.74285101890563965, 0 },
-    { 0.24957999587059021, -0.70110201835632324, 0.66792798042297363, 0 },
-    { -0.2691119909286499, -0.85625797510147095, 0.44084000587463379, 0 },
-    { -0.24957999587059021, -0.70110201835632324, 0.66792798042297363, 0 },
-    { -0.37904000282287598, -0.55177497863769531, 0.74285101890563965, 0 },
-    { -0.47279301285743713, -0.71571999788284302, 0.51396197080612183, 0 },
-    { -0.59660601615905762, -0.79482400417327881, 0.11078199744224548, 0 },
-    { -0.26175698637962341, -0.96023398637771606, 0.096773996949195862, 0 },
-    { 0.68761301040649414, -0.43864300847053528, 0.57857000827789307, 0 },
-    { 0.91100800037384033, -0.39280399680137634, 0.12552300095558167, 0 },
-    { 0.98879998922348022, -0.070467002689838409, 0.13153499364852905, 0 },
-    { 0.78765201568603516, -0.19608099758625031, 0.58406299352645874, 0 },
-    { 0.53276199102401733, -0.22211399674415588, 0.81655299663543701, 0 },
-    { 0.47312799096107483, -0.36722901463508606, 0.80077499151229858, 0 },
-    { -0.68761301040649414, -0.43864300847053528, 0.57857000827789307, 0 },
-    { -0.47312799096107483, -0.36722901463508606, 0.80077499151229858, 0 },
-    { -0.53276199102401733, -0.22211399674415588, 0.81655299663543701, 0 },
-    { -0.78765201568603516, -0.19608099758625031, 0.58406299352645874, 0 },
-    { -0.98879998922348022, -0.070467002689838409, 0.13153499364852905, 0 },
-    { -0.91100800037384033, -0.39280399680137634, 0.12552300095558167, 0 },
-    { 0.81990998983383179, -0.04513699933886528, 0.57066601514816284, 0 },
-    { 0.99096602201461792, 0.060823000967502594, 0.11935800313949585, 0 },
-    { 0.98571699857711792, 0.11508499830961227, 0.12274499982595444, 0 },
-    { 0.82244300842285156, 0.042573001235723495, 0.56721699237823486, 0 },
-    { 0.58299499750137329, -0.012939999811351299, 0.81234198808670044, 0 },
-    { 0.56981098651885986, -0.10086400061845779, 0.81554597616195679, 0 },
-    { -0.81990998983383179, -0.04513699933886528, 0.57066601514816284, 0 },
-    { -0.56981098651885986, -0.10086400061845779, 0.81554597616195679, 0 },
-    { -0.58299499750137329, -0.012939999811351299, 0.81234198808670044, 0 },
-    { -0.82244300842285156, 0.042573001235723495, 0.56721699237823486, 0 },
-    { -0.98571699857711792, 0.11508499830961227, 0.12274499982595444, 0 },
-    { -0.99096602201461792, 0.060823000967502594, 0.11935800313949585, 0 },
-    { 0.82360297441482544, 0.097567997872829437, 0.55867201089859009, 0 },
-    { 0.98104798793792725, 0.14816699922084808, 0.12460699677467346, 0 },
-    { 0.96636897325515747, 0.21558299660682678, 0.14004899561405182, 0 },
-    { 0.82903498411178589, 0.16757699847221375, 0.53346401453018188, 0 },
-    { 0.61268997192382812, 0.085603997111320496, 0.7856680154800415, 0 },
-    { 0.59047198295593262, 0.034791000187397003, 0.80629897117614746, 0 },
-    { -0.82360297441482544, 0.097567997872829437, 0.55867201089859009, 0 },
-    { -0.59047198295593262, 0.034791000187397003, 0.80629897117614746, 0 },
-    { -0.61268997192382812, 0.085603997111320496, 0.7856680154800415, 0 },
-    { -0.82903498411178589, 0.16757699847221375, 0.53346401453018188, 0 },
-    { -0.96636897325515747, 0.21558299660682678, 0.14004899561405182, 0 },
-    { -0.98104798793792725, 0.14816699922084808, 0.12460699677467346, 0 },
-    { 0.37604901194572449, -0.77639102935791016, 0.50572198629379272, 0 },
-    { 0.63948500156402588, -0.57878398895263672, 0.50599700212478638, 0 },
-    { 0.63118398189544678, -0.73152899742126465, 0.25772899389266968, 0 },
-    { 0.33570399880409241, -0.91476202011108398, 0.22470800578594208, 0 },
-    { 0.35938599705696106, -0.91042798757553101, 0.20480999350547791, 0 },
-    { 0.36985400319099426, -0.7553030252456665, 0.54097098112106323, 0 },
-    { 0.38331198692321777, -0.55375802516937256, 0.73915797472000122, 0 },
-    { 0.40586599707603455, -0.47886601090431213, 0.77837502956390381, 0 },
-    { 0.22244900465011597, -0.20154400169849396, 0.95385599136352539, 0 },
-    { -0.37604901194572449, -0.77639102935791016, 0.50572198629379272, 0 },
-    { -0.40586599707603455, -0.47886601090431213, 0.77837502956390381, 0 },
-    { -0.38331198692321777, -0.55375802516937256, 0.73915797472000122, 0 },
-    { -0.36985400319099426, -0.7553030252456665, 0.54097098112106323, 0 },
-    { -0.35938599705696106, -0.91042798757553101, 0.20480999350547791, 0 },
-    { -0.33570399880409241, -0.91476202011108398, 0.22470800578594208, 0 },
-    { -0.63118398189544678, -0.73152899742126465, 0.25772899389266968, 0 },
-    { -0.63948500156402588, -0.57878398895263672, 0.50599700212478638, 0 },
-    { -0.22244900465011597, -0.20154400169849396, 0.95385599136352539, 0 },
-    { 0.44358700513839722, -0.68895500898361206, 0.57316797971725464, 0 },
-    { 0.47465398907661438, -0.8574180006980896, 0.19879800081253052, 0 },
-    { 0.60930198431015015, -0.77056199312210083, 0.18692600727081299, 0 },
-    { 0.57054400444030762, -0.58909898996353149, 0.57219201326370239, 0 },
-    { 0.49415600299835205, -0.43180599808692932, 0.75454002618789673, 0 },
-    { 0.41425800323486328, -0.52424699068069458, 0.74397999048233032, 0 },
-    { -0.44358700513839722, -0.68895500898361206, 0.57316797971725464, 0 },
-    { -0.41425800323486328, -0.52424699068069458, 0.74397999048233032, 0 },
-    { -0.49415600299835205, -0.43180599808692932, 0.75454002618789673, 0 },
-    { -0.57054400444030762, -0.58909898996353149, 0.57219201326370239, 0 },
-    { -0.60930198431015015, -0.77056199312210083, 0.18692600727081299, 0 },
-    { -0.47465398907661438, -0.8574180006980896, 0.19879800081253052, 0 },
-    { 0.68334001302719116, -0.47990399599075317, 0.55015701055526733, 0 },
-    { 0.7486799955368042, -0.64626002311706543, 0.14752599596977234, 0 },
-    { 0.89577901363372803, -0.42747300863265991, 0.12167699635028839, 0 },
-    { 0.73232197761535645, -0.39161399006843567, 0.55702400207519531, 0 },
-    { 0.58482599258422852, -0.32068800926208496, 0.74504798650741577, 0 },
-    { 0.56965899467468262, -0.35444200038909912, 0.74150800704956055, 0 },
-    { -0.68334001302719116, -0.47990399599075317, 0.55015701055526733, 0 },
-    { -0.56965899467468262, -0.35444200038909912, 0.74150800704956055, 0 },
-    { -0.58482599258422852, -0.32068800926208496, 0.74504798650741577, 0 },
-    { -0.73232197761535645, -0.39161399006843567, 0.55702400207519531, 0 },
-    { -0.89577901363372803, -0.42747300863265991, 0.12167699635028839, 0 },
-    { -0.7486799955368042, -0.64626002311706543, 0.14752599596977234, 0 },
-    { 0.73726600408554077, -0.30478799343109131, 0.60289299488067627, 0 },
-    { 0.97540199756622314, -0.15161600708961487, 0.15985600650310516, 0 },
-    { 0.93496501445770264, 0.28318101167678833, 0.21356900036334991, 0 },
-    { 0.74629998207092285, -0.055360998958349228, 0.66325902938842773, 0 },
-    { 0.48771598935127258, -0.29334399104118347, 0.82219898700714111, 0 },
-    { 0.53425699472427368, -0.31232601404190063, 0.78548502922058105, 0 },
-    { -0.73726600408554077, -0.30478799343109131, 0.60289299488067627, 0 },
-    { -0.53425699472427368, -0.31232601404190063, 0.78548502922058105, 0 },
-    { -0.48771598935127258, -0.29334399104118347, 0.82219898700714111, 0 },
-    { -0.74629998207092285, -0.055360998958349228, 0.66325902938842773, 0 },
-    { -0.93496501445770264, 0.28318101167678833, 0.21356900036334991, 0 },
-    { -0.97540199756622314, -0.15161600708961487, 0.15985600650310516, 0 },
-    { 0.63982099294662476, 0.326090008020401, 0.69588297605514526, 0 },
-    { 0.65965801477432251, 0.71578097343444824, 0.22904099524021149, 0 },
-    { 0.47221300005912781, 0.86529099941253662, 0.16800400614738464, 0 },
-    { 0.52775698900222778, 0.54853999614715576, 0.64848798513412476, 0 },
-    { 0.35309898853302002, -0.046693000942468643, 0.93441599607467651, 0 },
-    { 0.43876498937606812, -0.15424099564552307, 0.88524997234344482, 0 },
-    { -0.63982099294662476, 0.326090008020401, 0.69588297605514526, 0 },
-    { -0.43876498937606812, -0.15424099564552307, 0.88524997234344482, 0 },
-    { -0.35309898853302002, -0.046693000942468643, 0.93441599607467651, 0 },
-    { -0.52775698900222778, 0.54853999614715576, 0.64848798513412476, 0 },
-    { -0.47221300005912781, 0.86529099941253662, 0.16800400614738464, 0 },
-    { -0.65965801477432251, 0.71578097343444824, 0.22904099524021149, 0 },
-    { 0.51860100030899048, 0.60280197858810425, 0.60631102323532104, 0 },
-    { 0.51277202367782593, 0.84682798385620117, 0.14117899537086487, 0 },
-    { 0.58894598484039307, 0.79354202747344971, 0.15283699333667755, 0 },
-    { 0.55119502544403076, 0.56389099359512329, 0.61494797468185425, 0 },
-    { 0.30500200390815735, 0.028565000742673874, 0.95190298557281494, 0 },
-    { 0.30878600478172302, 0.016784999519586563, 0.95095700025558472, 0 },
-    { -0.51860100030899048, 0.60280197858810425, 0.60631102323532104, 0 },
-    { -0.30878600478172302, 0.016784999519586563, 0.95095700025558472, 0 },
-    { -0.30500200390815735, 0.028565000742673874, 0.95190298557281494, 0 },
-    { -0.55119502544403076, 0.56389099359512329, 0.61494797468185425, 0 },
-    { -0.58894598484039307, 0.79354202747344971, 0.15283699333667755, 0 },
-    { -0.51277202367782593, 0.84682798385620117, 0.14117899537086487, 0 },
-    { 0.53529500961303711, 0.55461299419403076, 0.6370130181312561, 0 },
-    { 0.58851897716522217, 0.79048997163772583, 0.16943900287151337, 0 },
-    { 0.31485900282859802, 0.93218797445297241, 0.17841100692749023, 0 },
-    { 0.33188900351524353, 0.64265900850296021, 0.69051200151443481, 0 },
-    { 0.25861400365829468, 0.10269500315189362, 0.9604790210723877, 0 },
-    { 0.30860298871994019, 0.051515001803636551, 0.94976699352264404, 0 },
-    { -0.53529500961303711, 0.55461299419403076, 0.6370130181312561, 0 },
-    { -0.30860298871994019, 0.051515001803636551, 0.94976699352264404, 0 },
-    { -0.25861400365829468, 0.10269500315189362, 0.9604790210723877, 0 },
-    { -0.33188900351524353, 0.64265900850296021, 0.69051200151443481, 0 },
-    { -0.31485900282859802, 0.93218797445297241, 0.17841100692749023, 0 },
-    { -0.58851897716522217, 0.79048997163772583, 0.16943900287151337, 0 },
-    { -0.072085000574588776, 0.67024701833724976, 0.73860901594161987, 0 },
-    { -0.204352006316185, 0.96117997169494629, 0.18524700403213501, 0 },
-    { -0.66911798715591431, 0.72637099027633667, 0.15689599514007568, 0 },
-    { -0.46708598732948303, 0.52180498838424683, 0.71376699209213257, 0 },
-    { -0.048372000455856323, 0.074312999844551086, 0.99603301286697388, 0 },
-    { 0.10733400285243988, 0.12237899750471115, 0.98663300275802612, 0 },
-    { 0.072085000574588776, 0.67024701833724976, 0.73860901594161987, 0 },
-    { -0.10733400285243988, 0.12237899750471115, 0.98663300275802612, 0 },
-    { 0.048372000455856323, 0.074312999844551086, 0.99603301286697388, 0 },
-    { 0.46708598732948303, 0.52180498838424683, 0.71376699209213257, 0 },
-    { 0.66911798715591431, 0.72637099027633667, 0.15689599514007568, 0 },
-    { 0.204352006316185, 0.96117997169494629, 0.18524700403213501, 0 },
-    { -0.66182398796081543, 0.37955901026725769, 0.64644300937652588, 0 },
-    { -0.86285001039505005, 0.49394199252128601, 0.10708899796009064, 0 },
-    { -0.84200602769851685, 0.52992302179336548, 0.10071100294589996, 0 },
-    { -0.67735797166824341, 0.40336298942565918, 0.61516201496124268, 0 },
-    { -0.12768900394439697, 0.0012819999828934669, 0.9917910099029541, 0 },
-    { -0.10312200337648392, 0.022492000833153725, 0.9943850040435791, 0 },
-    { 0.66182398796081543, 0.37955901026725769, 0.64644300937652588, 0 },
-    { 0.10312200337648392, 0.022492000833153725, 0.9943850040435791, 0 },
-    { 0.12768900394439697, 0.0012819999828934669, 0.9917910099029541, 0 },
-    { 0.67735797166824341, 0.40336298942565918, 0.61516201496124268, 0 },
-    { 0.84200602769851685, 0.52992302179336548, 0.10071100294589996, 0 },
-    { 0.86285001039505005, 0.49394199252128601, 0.10708899796009064, 0 },
-    { -0.50883501768112183, 0.55119502544403076, 0.66121399402618408, 0 },
-    { -0.60722702741622925, 0.77779501676559448, 0.16211399435997009, 0 },
-    { 0, 0.97564601898193359, 0.21930600702762604, 0 },
-    { 0, 0.66679900884628296, 0.7452319860458374, 0 },
-    { 0, -0.060488000512123108, 0.99813801050186157, 0 },
-    { -0.11007999628782272, 0.026825999841094017, 0.99352997541427612, 0 },
-    { 0.50883501768112183, 0.55119502544403076, 0.66121399402618408, 0 },
-    { 0.11007999628782272, 0.026825999841094017, 0.99352997541427612, 0 },
-    { 0.60722702741622925, 0.77779501676559448, 0.16211399435997009, 0 },
-    { 0.36112600564956665, -0.29725000262260437, 0.88384699821472168, 0 },
-    { 0.33951801061630249, -0.30704700946807861, 0.88903498649597168, 0 },
-    { 0.30231600999832153, -0.2282480001449585, 0.92544299364089966, 0 },
-    { 0.32227501273155212, -0.23221500217914581, 0.91769200563430786, 0 },
-    { 0.28665998578071594, -0.24747499823570251, 0.92550402879714966, 0 },
-    { 0.30448299646377563, -0.30320098996162415, 0.90295100212097168, 0 },
-    { -0.36112600564956665, -0.29725000262260437, 0.88384699821472168, 0 },
-    { -0.30448299646377563, -0.30320098996162415, 0.90295100212097168, 0 },
-    { -0.28665998578071594, -0.24747499823570251, 0.92550402879714966, 0 },
-    { -0.32227501273155212, -0.23221500217914581, 0.91769200563430786, 0 },
-    { -0.30231600999832153, -0.2282480001449585, 0.92544299364089966, 0 },
-    { -0.33951801061630249, -0.30704700946807861, 0.88903498649597168, 0 },
-    { 0.21372100710868835, -0.32602900266647339, 0.92086499929428101, 0 },
-    { 0.20966200530529022, -0.27176699042320251, 0.93923801183700562, 0 },
-    { 0.12213499844074249, -0.26816600561141968, 0.95556497573852539, 0 },
-    { 0.12448500096797943, -0.34986400604248047, 0.92846500873565674, 0 },
-    { -0.21372100710868835, -0.32602900266647339, 0.92086499929428101, 0 },
-    { -0.12448500096797943, -0.34986400604248047, 0.92846500873565674, 0 },
-    { -0.12213499844074249, -0.26816600561141968, 0.95556497573852539, 0 },
-    { -0.20966200530529022, -0.27176699042320251, 0.93923801183700562, 0 },
-    { 0.064576998353004456, -0.37241700291633606, 0.92577898502349854, 0 },
-    { 0.10818800330162048, -0.2139350026845932, 0.97082400321960449, 0 },
-    { 0.18012000620365143, -0.18399600684642792, 0.96627700328826904, 0 },
-    { 0.055727001279592514, -0.40751400589942932, 0.91146600246429443, 0 },
-    { -0.064576998353004456, -0.37241700291633606, 0.92577898502349854, 0 },
-    { -0.055727001279592514, -0.40751400589942932, 0.91146600246429443, 0 },
-    { -0.18012000620365143, -0.18399600684642792, 0.96627700328826904, 0 },
-    { -0.10818800330162048, -0.2139350026845932, 0.97082400321960449, 0 },
-    { 0.053040999919176102, -0.46156200766563416, 0.88549500703811646, 0 },
-    { 0.19208300113677979, -0.27191999554634094, 0.94292998313903809, 0 },
-    { 0.15277600288391113, -0.33445200324058533, 0.92992901802062988, 0 },
-    { 0.071841001510620117, -0.47190800309181213, 0.8786889910697937, 0 },
-    { -0.053040999919176102, -0.46156200766563416, 0.88549500703811646, 0 },
-    { -0.071841001510620117, -0.47190800309181213, 0.8786889910697937, 0 },
-    { -0.15277600288391113, -0.33445200324058533, 0.92992901802062988, 0 },
-    { -0.19208300113677979, -0.27191999554634094, 0.94292998313903809, 0 },
-    { 0.1604049950838089, -0.41276299953460693, 0.89657300710678101, 0 },
-    { 0.17578700184822083, -0.26422899961471558, 0.94827097654342651, 0 },
-    { 0.27649798989295959, -0.15949000418186188, 0.94766098260879517, 0 },
-    { 0.25965100526809692, -0.30530700087547302, 0.91616600751876831, 0 },
-    { -0.1604049950838089, -0.41276299953460693, 0.89657300710678101, 0 },
-    { -0.25965100526809692, -0.30530700087547302, 0.91616600751876831, 0 },
-    { -0.27649798989295959, -0.15949000418186188, 0.94766098260879517, 0 },
-    { -0.17578700184822083, -0.26422899961471558, 0.94827097654342651, 0 },
-    { 0.3708609938621521, -0.23645700514316559, 0.89806801080703735, 0 },
-    { 0.37815499305725098, -0.14682500064373016, 0.91399902105331421, 0 },
-    { 0.44264000654220581, -0.20047600567340851, 0.87398898601531982, 0 },
-    { 0.44785898923873901, -0.23456500470638275, 0.86275798082351685, 0 },
-    { -0.3708609938621521, -0.23645700514316559, 0.89806801080703735, 0 },
-    { -0.44785898923873901, -0.23456500470638275, 0.86275798082351685, 0 },
-    { -0.44264000654220581, -0.20047600567340851, 0.87398898601531982, 0 },
-    { -0.37815499305725098, -0.14682500064373016, 0.91399902105331421, 0 },
-    { 0.45225399732589722, -0.26413801312446594, 0.85186302661895752, 0 },
-    { 0.45948699116706848, -0.28183799982070923, 0.84224998950958252, 0 },
-    { 0.43812400102615356, -0.36744299530982971, 0.82033801078796387, 0 },
-    { 0.41795098781585693, -0.32840999960899353, 0.8470110297203064, 0 },
-    { -0.45225399732589722, -0.26413801312446594, 0.85186302661895752, 0 },
-    { -0.41795098781585693, -0.32840999960899353, 0.8470110297203064, 0 },
-    { -0.43812400102615356, -0.36744299530982971, 0.82033801078796387, 0 },
-    { -0.45948699116706848, -0.28183799982070923, 0.84224998950958252, 0 },
-    { 0.37723898887634277, -0.38315999507904053, 0.84310400485992432, 0 },
-    { 0.36530700325965881, -0.41984298825263977, 0.83080500364303589, 0 },
-    { 0.27539899945259094, -0.36451300978660583, 0.88952302932739258, 0 },
-    { 0.34894898533821106, -0.31855198740959167, 0.8813139796257019, 0 },
-    { -0.37723898887634277, -0.38315999507904053, 0.84310400485992432, 0 },
-    { -0.34894898533821106, -0.31855198740959167, 0.8813139796257019, 0 },
-    { -0.27539899945259094, -0.36451300978660583, 0.88952302932739258, 0 },
-    { -0.36530700325965881, -0.41984298825263977, 0.83080500364303589, 0 },
-    { 0.33848100900650024, -0.13617399334907532, 0.93105900287628174, 0 },
-    { 0.20416900515556335, -0.23941799998283386, 0.94918698072433472, 0 },
-    { 0.09485200047492981, -0.11639799922704697, 0.9886469841003418, 0 },
-    { 0.17734299600124359, 0.033417999744415283, 0.983551025390625, 0 },
-    { -0.33848100900650024, -0.13617399334907532, 0.93105900287628174, 0 },
-    { -0.17734299600124359, 0.033417999744415283, 0.983551025390625, 0 },
-    { -0.09485200047492981, -0.11639799922704697, 0.9886469841003418, 0 },
-    { -0.20416900515556335, -0.23941799998283386, 0.94918698072433472, 0 },
-    { -0.055268999189138412, 0.12283699959516525, 0.9908750057220459, 0 },
-    { -0.074312999844551086, -0.043030999600887299, 0.99627697467803955, 0 },
-    { -0.14795400202274323, -0.087099999189376831, 0.98513698577880859, 0 },
-    { -0.079256996512413025, 0.017029000446200371, 0.99670398235321045, 0 },
-    { 0, 0.041016999632120132, 0.9991459846496582, 0 },
-    { -0.15842199325561523, 0.075227998197078705, 0.98449701070785522, 0 },
-    { 0.055268999189138412, 0.12283699959516525, 0.9908750057220459, 0 },
-    { 0.15842199325561523, 0.075227998197078705, 0.98449701070785522, 0 },
-    { 0.079256996512413025, 0.017029000446200371, 0.99670398235321045, 0 },
-    { 0.14795400202274323, -0.087099999189376831, 0.98513698577880859, 0 },
-    { 0.074312999844551086, -0.043030999600887299, 0.99627697467803955, 0 },
-    { 0.25946798920631409, -0.29102501273155212, 0.92083501815795898, 0 },
-    { 0.22687500715255737, -0.20285700261592865, 0.95254397392272949, 0 },
-    { 0.18604099750518799, -0.25916299223899841, 0.94772201776504517, 0 },
-    { 0.12915399670600891, -0.16208399832248688, 0.9782710075378418, 0 },
-    { -0.25946798920631409, -0.29102501273155212, 0.92083501815795898, 0 },
-    { -0.18604099750518799, -0.25916299223899841, 0.94772201776504517, 0 },
-    { -0.22687500715255737, -0.20285700261592865, 0.95254397392272949, 0 },
-    { -0.12915399670600891, -0.16208399832248688, 0.9782710075378418, 0 },
-    { 0.11581800132989883, -0.23636600375175476, 0.96472102403640747, 0 },
-    { 0.020539000630378723, -0.1478009968996048, 0.98876899480819702, 0 },
-    { 0, -0.27515500783920288, 0.96136397123336792, 0 },
-    { 0, -0.24637599289417267, 0.9691460132598877, 0 },
-    { 0.040773000568151474, -0.21594899892807007, 0.97552400827407837, 0 },
-    { -0.07531999796628952, -0.16467800736427307, 0.9834589958190918, 0 },
-    { -0.11581800132989883, -0.23636600375175476, 0.96472102403640747, 0 },
-    { -0.040773000568151474, -0.21594899892807007, 0.97552400827407837, 0 },
-    { -0.020539000630378723, -0.1478009968996048, 0.98876899480819702, 0 },
-    { 0.07531999796628952, -0.16467800736427307, 0.9834589958190918, 0 },
-    { -0.014709999784827232, -0.14670200645923615, 0.98904401063919067, 0 },
-    { 0, -0.14975400269031525, 0.9887080192565918, 0 },
-    { -0.12686499953269958, -0.16122899949550629, 0.9786980152130127, 0 },
-    { 0.014709999784827232, -0.14670200645923615, 0.98904401063919067, 0 },
-    { 0.12686499953269958, -0.16122899949550629, 0.9786980152130127, 0 },
-    { 0.070284001529216766, -0.70201700925827026, 0.70863997936248779, 0 },
-    { 0.13446499407291412, -0.66417402029037476, 0.73534297943115234, 0 },
-    { 0.071474000811576843, -0.52858102321624756, 0.84582000970840454, 0 },
-    { 0.026520999148488045, -0.54701399803161621, 0.83666497468948364, 0 },
-    { 0, -0.54899698495864868, 0.83581000566482544, 0 },
-    { 0, -0.71043998003005981, 0.70372599363327026, 0 },
-    { -0.070284001529216766, -0.70201700925827026, 0.70863997936248779, 0 },
-    { -0.026520999148488045, -0.54701399803161621, 0.83666497468948364, 0 },
-    { -0.071474000811576843, -0.52858102321624756, 0.84582000970840454, 0 },
-    { -0.13446499407291412, -0.66417402029037476, 0.73534297943115234, 0 },
-    { 0.21762700378894806, -0.57197797298431396, 0.79082602262496948, 0 },
-    { 0.31137999892234802, -0.41831699013710022, 0.85323601961135864, 0 },
-    { 0.22971299290657043, -0.33436098694801331, 0.91399902105331421, 0 },
-    { 0.14499300718307495, -0.45857098698616028, 0.87673598527908325, 0 },
-    { -0.21762700378894806, -0.57197797298431396, 0.79082602262496948, 0 },
-    { -0.14499300718307495, -0.45857098698616028, 0.87673598527908325, 0 },
-    { -0.22971299290657043, -0.33436098694801331, 0.91399902105331421, 0 },
-    { -0.31137999892234802, -0.41831699013710022, 0.85323601961135864, 0 },
-    { 0.35309898853302002, -0.28418800234794617, 0.8913540244102478, 0 },
-    { 0.36237698793411255, -0.19422000646591187, 0.91155701875686646, 0 },
-    { 0.2039249986410141, -0.1395920068025589, 0.96896302700042725, 0 },
-    { 0.26249000430107117, -0.22354799509048462, 0.93865799903869629, 0 },
-    { -0.35309898853302002, -0.28418800234794617, 0.8913540244102478, 0 },
-    { -0.26249000430107117, -0.22354799509048462, 0.93865799903869629, 0 },
-    { -0.2039249986410141, -0.1395920068025589, 0.96896302700042725, 0 },
-    { -0.36237698793411255, -0.19422000646591187, 0.91155701875686646, 0 },
-    { 0.36014899611473083, -0.013427999801933765, 0.93276798725128174, 0 },
-    { 0.36277401447296143, 0.017914000898599625, 0.93169999122619629, 0 },
-    { 0.17093400657176971, -0.0082090003415942192, 0.9852290153503418, 0 },
-    { 0.17590899765491486, -0.038148000836372375, 0.98364198207855225, 0 },
-    { 0.18793299794197083, -0.050172001123428345, 0.98089498281478882, 0 },
-    { 0.36881598830223083, -0.043062001466751099, 0.92849498987197876, 0 },
-    { -0.36014899611473083, -0.013427999801933765, 0.93276798725128174, 0 },
-    { -0.36881598830223083, -0.043062001466751099, 0.92849498987197876, 0 },
-    { -0.18793299794197083, -0.050172001123428345, 0.98089498281478882, 0 },
-    { -0.17590899765491486, -0.038148000836372375, 0.98364198207855225, 0 },
-    { -0.17093400657176971, -0.0082090003415942192, 0.9852290153503418, 0 },
-    { -0.36277401447296143, 0.017914000898599625, 0.93169999122619629, 0 },
-    { 0.37186801433563232, -0.1082490012049675, 0.92193400859832764, 0 },
-    { 0.20407700538635254, -0.07849399745464325, 0.97576802968978882, 0 },
-    { -0.37186801433563232, -0.1082490012049675, 0.92193400859832764, 0 },
-    { -0.20407700538635254, -0.07849399745464325, 0.97576802968978882, 0 },
-    { 0.05163700133562088, -0.013306000269949436, 0.99856597185134888, 0 },
-    { 0.18198199570178986, -0.0070799998939037323, 0.98324501514434814, 0 },
-    { 0.3687250018119812, -0.29459500312805176, 0.88158798217773438, 0 },
-    { 0.13711999356746674, -0.29297798871994019, 0.94622600078582764, 0 },
-    { 0, -0.27814599871635437, 0.96050900220870972, 0 },
-    { 0, -0.011169999837875366, 0.9999079704284668, 0 },
-    { 0, -0.017364999279379845, 0.99984699487686157, 0 },
-    { 0.04889100044965744, -0.015168000012636185, 0.9986879825592041, 0 },
-    { -0.05163700133562088, -0.013306000269949436, 0.99856597185134888, 0 },
-    { -0.04889100044965744, -0.015168000012636185, 0.9986879825592041, 0 },
-    { -0.13711999356746674, -0.29297798871994019, 0.94622600078582764, 0 },
-    { -0.3687250018119812, -0.29459500312805176, 0.88158798217773438, 0 },
-    { -0.18198199570178986, -0.0070799998939037323, 0.98324501514434814, 0 },
-    { 0.049775999039411545, -0.0495930016040802, 0.99749702215194702, 0 },
-    { 0.053468000143766403, -0.049196001142263412, 0.997344970703125, 0 },
-    { 0, -0.053132999688386917, 0.99856597185134888, 0 },
-    { 0, -0.048096999526023865, 0.99883997440338135, 0 },
-    { -0.049775999039411545, -0.0495930016040802, 0.99749702215194702, 0 },
-    { -0.053468000143766403, -0.049196001142263412, 0.997344970703125, 0 },
-    { 0.060334999114274979, -0.050629999488592148, 0.99688702821731567, 0 },
-    { 0, -0.048982001841068268, 0.99877899885177612, 0 },
-    { 0, -0.21909199655056, 0.9756770133972168, 0 },
-    { 0.061586000025272369, -0.16037499904632568, 0.98510700464248657, 0 },
-    { -0.060334999114274979, -0.050629999488592148, 0.99688702821731567, 0 },
-    { -0.061586000025272369, -0.16037499904632568, 0.98510700464248657, 0 },
-    { 0.81008297204971313, -0.52064597606658936, 0.26947799324989319, 0 },
-    { 0.65913897752761841, -0.32850098609924316, 0.67644298076629639, 0 },
-    { 0.80687898397445679, -0.15399600565433502, 0.57023799419403076, 0 },
-    { 0.98928797245025635, -0.11963299661874771, 0.083438001573085785, 0 },
-    { 0.96536099910736084, -0.14471900463104248, 0.21701699495315552, 0 },
-    { 0.7595139741897583, -0.57701301574707031, 0.30024099349975586, 0 },
-    { 0.50682097673416138, -0.7530750036239624, 0.41947698593139648, 0 },
-    { 0.54442000389099121, -0.68645298480987549, 0.48200899362564087, 0 },
-    { -0.81008297204971313, -0.52064597606658936, 0.26947799324989319, 0 },
-    { -0.54442000389099121, -0.68645298480987549, 0.48200899362564087, 0 },
-    { -0.50682097673416138, -0.7530750036239624, 0.41947698593139648, 0 },
-    { -0.7595139741897583, -0.57701301574707031, 0.30024099349975586, 0 },
-    { -0.96536099910736084, -0.14471900463104248, 0.21701699495315552, 0 },
-    { -0.98928797245025635, -0.11963299661874771, 0.083438001573085785, 0 },
-    { -0.80687898397445679, -0.15399600565433502, 0.57023799419403076, 0 },
-    { -0.65913897752761841, -0.32850098609924316, 0.67644298076629639, 0 },
-    { 0.95211601257324219, 0.30533799529075623, -0.015045999549329281, 0 },
-    { 0.71178299188613892, 0.053468000143766403, 0.70030802488327026, 0 },
-    { 0.18829900026321411, 0.32792100310325623, 0.92571800947189331, 0 },
-    { 0.68999302387237549, 0.72295302152633667, -0.034791000187397003, 0 },
-    { 0.67714500427246094, 0.73094898462295532, 0.084475003182888031, 0 },
-    { 0.94030600786209106, 0.30274400115013123, 0.15533900260925293, 0 },
-    { -0.95211601257324219, 0.30533799529075623, -0.015045999549329281, 0 },
-    { -0.94030600786209106, 0.30274400115013123, 0.15533900260925293, 0 },
-    { -0.67714500427246094, 0.73094898462295532, 0.084475003182888031, 0 },
-    { -0.68999302387237549, 0.72295302152633667, -0.034791000187397003, 0 },
-    { -0.18829900026321411, 0.32792100310325623, 0.92571800947189331, 0 },
-    { -0.71178299188613892, 0.053468000143766403, 0.70030802488327026, 0 },
-    { 0.1512800008058548, 0.97598201036453247, 0.15665200352668762, 0 },
-    { -0.13934800028800964, 0.33771800994873047, 0.93084502220153809, 0 },
-    { 0, 0.30713799595832825, 0.95162802934646606, 0 },
-    { -0.38190901279449463, 0.79424399137496948, 0.47251799702644348, 0 },
-    { -0.3621630072593689, 0.90459901094436646, 0.2247689962387085, 0 },
-    { 0.1691029965877533, 0.98147499561309814, 0.089754998683929443, 0 },
-    { -0.1512800008058548, 0.97598201036453247, 0.15665200352668762, 0 },
-    { -0.1691029965877533, 0.98147499561309814, 0.089754998683929443, 0 },
-    { 0.3621630072593689, 0.90459901094436646, 0.2247689962387085, 0 },
-    { 0.38190901279449463, 0.79424399137496948, 0.47251799702644348, 0 },
-    { 0.13934800028800964, 0.33771800994873047, 0.93084502220153809, 0 },
-    { -0.56288301944732666, 0.66249597072601318, 0.49415600299835205, 0 },
-    { 0, 0.56413501501083374, 0.82567799091339111, 0 },
-    { 0, 0.75923901796340942, 0.65077698230743408, 0 },
-    { 0, 0.95117002725601196, 0.30857300758361816, 0 },
-    { 0, 0.96035599708557129, 0.2787260115146637, 0 },
-    { -0.6303899884223938, 0.72402101755142212, 0.27991598844528198, 0 },
-    { 0.56288301944732666, 0.66249597072601318, 0.49415600299835205, 0 },
-    { 0.6303899884223938, 0.72402101755142212, 0.27991598844528198, 0 },
-    { 0.3013400137424469, -0.73271900415420532, 0.61012601852416992, 0 },
-    { 0, -0.75255602598190308, 0.65849798917770386, 0 },
-    { 0.31937599182128906, -0.80449801683425903, 0.50074797868728638, 0 },
-    { 0, -0.85015398263931274, 0.5265049934387207, 0 },
-    { -0.3013400137424469, -0.73271900415420532, 0.61012601852416992, 0 },
-    { -0.31937599182128906, -0.80449801683425903, 0.50074797868728638, 0 },
-    { 0.23017099499702454, -0.64509999752044678, 0.72856801748275757, 0 },
-    { 0, -0.65758198499679565, 0.75334900617599487, 0 },
-    { 0.34629398584365845, -0.66945397853851318, 0.65715497732162476, 0 },
-    { 0.20795300602912903, -0.56697297096252441, 0.79702097177505493, 0 },
-    { 0.13492199778556824, -0.5039520263671875, 0.85311400890350342, 0 },
-    { 0, -0.47636300325393677, 0.8792080283164978, 0 },
-    { -0.23017099499702454, -0.64509999752044678, 0.72856801748275757, 0 },
-    { -0.13492199778556824, -0.5039520263671875, 0.85311400890350342, 0 },
-    { -0.20795300602912903, -0.56697297096252441, 0.79702097177505493, 0 },
-    { -0.34629398584365845, -0.66945397853851318, 0.65715497732162476, 0 },
-    { -0.4308910071849823, 0.67976897954940796, 0.59346300363540649, 0 },
-    { 0, 0.72807997465133667, 0.68547600507736206, 0 },
-    { 0, 0.13800500333309174, 0.9904170036315918, 0 },
-    { -0.14920499920845032, 0.40778800845146179, 0.90078401565551758, 0 },
-    { -0.14294900000095367, 0.52699398994445801, 0.83773297071456909, 0 },
-    { -0.27600899338722229, 0.75945299863815308, 0.58906799554824829, 0 },
-    { 0.4308910071849823, 0.67976897954940796, 0.59346300363540649, 0 },
-    { 0.27600899338722229, 0.75945299863815308, 0.58906799554824829, 0 },
-    { 0.14294900000095367, 0.52699398994445801, 0.83773297071456909, 0 },
-    { 0.14920499920845032, 0.40778800845146179, 0.90078401565551758, 0 },
-    { 0.1478009968996048, 0.80419301986694336, 0.57564002275466919, 0 },
-    { 0.089754998683929443, 0.49452200531959534, 0.86449801921844482, 0 },
-    { 0.31614100933074951, 0.41703501343727112, 0.85210698843002319, 0 },
-    { 0.54744100570678711, 0.60365599393844604, 0.57951599359512329, 0 },
-    { -0.1478009968996048, 0.80419301986694336, 0.57564002275466919, 0 },
-    { -0.54744100570678711, 0.60365599393844604, 0.57951599359512329, 0 },
-    { -0.31614100933074951, 0.41703501343727112, 0.85210698843002319, 0 },
-    { -0.089754998683929443, 0.49452200531959534, 0.86449801921844482, 0 },
-    { 0.73815101385116577, 0.26664000749588013, 0.61967802047729492, 0 },
-    { 0.34107500314712524, 0.21320199966430664, 0.91552501916885376, 0 },
-    { 0.3082059919834137, -0.13229799270629883, 0.94204497337341309, 0 },
-    { 0.73296302556991577, -0.15771999955177307, 0.66170197725296021, 0 },
-    { -0.73815101385116577, 0.26664000749588013, 0.61967802047729492, 0 },
-    { -0.73296302556991577, -0.15771999955177307, 0.66170197725296021, 0 },
-    { -0.3082059919834137, -0.13229799270629883, 0.94204497337341309, 0 },
-    { -0.34107500314712524, 0.21320199966430664, 0.91552501916885376, 0 },
-    { 0.54188698530197144, -0.54799002408981323, 0.63716500997543335, 0 },
-    { 0.22605100274085999, -0.45649600028991699, 0.86049997806549072, 0 },
-    { -0.54188698530197144, -0.54799002408981323, 0.63716500997543335, 0 },
-    { -0.22605100274085999, -0.45649600028991699, 0.86049997806549072, 0 },
-    { 0.062928996980190277, 0.23493100702762604, 0.96993899345397949, 0 },
-    { 0.0434579998254776, -0.059755001217126846, 0.99725300073623657, 0 },
-    { -0.062928996980190277, 0.23493100702762604, 0.96993899345397949, 0 },
-    { -0.0434579998254776, -0.059755001217126846, 0.99725300073623657, 0 },
-    { 0.057711001485586166, -0.34473699331283569, 0.93691802024841309, 0 },
-    { 0, -0.30094298720359802, 0.95361202955245972, 0 },
-    { -0.057711001485586166, -0.34473699331283569, 0.93691802024841309, 0 },
-    { -0.21777999401092529, -0.04513699933886528, 0.97494399547576904, 0 },
-    { 0, 0.0030519999563694, 0.9999690055847168, 0 },
-    { -0.11062999814748764, -0.20798400044441223, 0.97183102369308472, 0 },
-    { 0.21777999401092529, -0.04513699933886528, 0.97494399547576904, 0 },
-    { 0.11062999814748764, -0.20798400044441223, 0.97183102369308472, 0 },
-    { 0.29639598727226257, -0.23932600021362305, 0.92455798387527466, 0 },
-    { 0.64665699005126953, -0.13974399864673615, 0.74984002113342285, 0 },
-    { 0.82946300506591797, 0.0045779999345541, 0.55848902463912964, 0 },
-    { 0.72811102867126465, -0.19602000713348389, 0.65678900480270386, 0 },
-    { -0.29639598727226257, -0.23932600021362305, 0.92455798387527466, 0 },
-    { -0.72811102867126465, -0.19602000713348389, 0.65678900480270386, 0 },
-    { -0.82946300506591797, 0.0045779999345541, 0.55848902463912964, 0 },
-    { -0.64665699005126953, -0.13974399864673615, 0.74984002113342285, 0 },
-    { 0.59300500154495239, -0.10800500214099884, 0.79787600040435791, 0 },
-    { 0.47016799449920654, -0.018890999257564545, 0.88235098123550415, 0 },
-    { 0.71318697929382324, 0.13980500400066376, 0.68687999248504639, 0 },
-    { 0.78469198942184448, 0.079256996512413025, 0.6147649884223938, 0 },
-    { -0.59300500154495239, -0.10800500214099884, 0.79787600040435791, 0 },
-    { -0.78469198942184448, 0.079256996512413025, 0.6147649884223938, 0 },
-    { -0.71318697929382324, 0.13980500400066376, 0.68687999248504639, 0 },
-    { -0.47016799449920654, -0.018890999257564545, 0.88235098123550415, 0 },
-    { 0.39368900656700134, 0.037415999919176102, 0.91845500469207764, 0 },
-    { 0.6535230278968811, 0.13797399401664734, 0.74419397115707397, 0 },
-    { -0.39368900656700134, 0.037415999919176102, 0.91845500469207764, 0 },
-    { -0.6535230278968811, 0.13797399401664734, 0.74419397115707397, 0 },
-    { 0.83678698539733887, 0.2473829984664917, 0.48838800191879272, 0 },
-    { 0.94030600786209106, 0.30311000347137451, 0.15466800332069397, 0 },
-    { 0.93188297748565674, 0.32767701148986816, 0.15549199283123016, 0 },
-    { 0.85772299766540527, 0.26908200979232788, 0.43803200125694275, 0 },
-    { -0.83678698539733887, 0.2473829984664917, 0.48838800191879272, 0 },
-    { -0.85772299766540527, 0.26908200979232788, 0.43803200125694275, 0 },
-    { -0.93188297748565674, 0.32767701148986816, 0.15549199283123016, 0 },
-    { -0.94030600786209106, 0.30311000347137451, 0.15466800332069397, 0 },
-    { 0.88970601558685303, 0.22806499898433685, 0.39539799094200134, 0 },
-    { 0.94222801923751831, 0.29587700963020325, 0.15692600607872009, 0 },
-    { 0.94503599405288696, 0.28086200356483459, 0.16730199754238129, 0 },
-    { 0.91589099168777466, 0.18231800198554993, 0.35755500197410583, 0 },
-    { -0.88970601558685303, 0.22806499898433685, 0.39539799094200134, 0 },
-    { -0.91589099168777466, 0.18231800198554993, 0.35755500197410583, 0 },
-    { -0.94503599405288696, 0.28086200356483459, 0.16730199754238129, 0 },
-    { -0.94222801923751831, 0.29587700963020325, 0.15692600607872009, 0 },
-    { 0.90328699350357056, -0.13119900226593018, 0.40842899680137634, 0 },
-    { 0.96804702281951904, -0.10675399750471115, 0.22687500715255737, 0 },
-    { -0.90328699350357056, -0.13119900226593018, 0.40842899680137634, 0 },
-    { -0.96804702281951904, -0.10675399750471115, 0.22687500715255737, 0 },
-    { 0.086397998034954071, -0.62480497360229492, 0.77596402168273926, 0 },
-    { -0.029145000502467155, -0.39973101019859314, 0.91613501310348511, 0 },
-    { 0, -0.70152902603149414, 0.71260702610015869, 0 },
-    { 0, -0.95492398738861084, 0.29676198959350586, 0 },
-    { 0.11447499692440033, -0.94058001041412354, 0.31965100765228271, 0 },
-    { -0.38587599992752075, -0.80465102195739746, 0.45121601223945618, 0 },
-    { -0.086397998034954071, -0.62480497360229492, 0.77596402168273926, 0 },
-    { -0.11447499692440033, -0.94058001041412354, 0.31965100765228271, 0 },
-    { 0.029145000502467155, -0.39973101019859314, 0.91613501310348511, 0 },
-    { 0.38587599992752075, -0.80465102195739746, 0.45121601223945618, 0 },
-    { -0.23511500656604767, -0.26322200894355774, 0.93560600280761719, 0 },
-    { -0.26831901073455811, -0.15286700427532196, 0.95110899209976196, 0 },
-    { -0.88222897052764893, -0.22937700152397156, 0.41111499071121216, 0 },
-    { -0.87197500467300415, 0.19400599598884583, 0.44938498735427856, 0 },
-    { 0.23511500656604767, -0.26322200894355774, 0.93560600280761719, 0 },
-    { 0.88222897052764893, -0.22937700152397156, 0.41111499071121216, 0 },
-    { 0.26831901073455811, -0.15286700427532196, 0.95110899209976196, 0 },
-    { 0.87197500467300415, 0.19400599598884583, 0.44938498735427856, 0 },
-    { -0.27878698706626892, -0.087435998022556305, 0.95635902881622314, 0 },
-    { -0.23502300679683685, 0.025390999391674995, 0.97164797782897949, 0 },
-    { -0.71068501472473145, 0.48542699217796326, 0.5091400146484375, 0 },
-    { -0.47160300612449646, 0.70107102394104004, 0.5348060131072998, 0 },
-    { 0.27878698706626892, -0.087435998022556305, 0.95635902881622314, 0 },
-    { 0.71068501472473145, 0.48542699217796326, 0.5091400146484375, 0 },
-    { 0.23502300679683685, 0.025390999391674995, 0.97164797782897949, 0 },
-    { 0.47160300612449646, 0.70107102394104004, 0.5348060131072998, 0 },
-    { -0.11771000176668167, 0.11874800175428391, 0.98589998483657837, 0 },
-    { 0, 0.15726199746131897, 0.98754799365997314, 0 },
-    { -0.20319199562072754, 0.81298297643661499, 0.54563999176025391, 0 },
-    { 0, 0.83745801448822021, 0.54646402597427368, 0 },
-    { 0.11771000176668167, 0.11874800175428391, 0.98589998483657837, 0 },
-    { 0.20319199562072754, 0.81298297643661499, 0.54563999176025391, 0 },
-    { -0.19034400582313538, 0.83590197563171387, 0.5147860050201416, 0 },
-    { 0, 0.84850597381591797, 0.5291600227355957, 0 },
-    { -0.44178599119186401, 0.78209799528121948, 0.43943598866462708, 0 },
-    { -0.28327301144599915, 0.40342399477958679, 0.8700219988822937, 0 },
-    { -0.11773999780416489, 0.37733098864555359, 0.91854602098464966, 0 },
-    { 0, 0.37400400638580322, 0.92739599943161011, 0 },
-    { 0.19034400582313538, 0.83590197563171387, 0.5147860050201416, 0 },
-    { 0.11773999780416489, 0.37733098864555359, 0.91854602098464966, 0 },
-    { 0.28327301144599915, 0.40342399477958679, 0.8700219988822937, 0 },
-    { 0.44178599119186401, 0.78209799528121948, 0.43943598866462708, 0 },
-    { -0.71718502044677734, 0.63270998001098633, 0.29206201434135437, 0 },
-    { -0.92632800340652466, 0.33399501442909241, 0.17422999441623688, 0 },
-    { -0.89904499053955078, 0.30295699834823608, 0.31601899862289429, 0 },
-    { -0.55024898052215576, 0.37531700730323792, 0.74584197998046875, 0 },
-    { 0.71718502044677734, 0.63270998001098633, 0.29206201434135437, 0 },
-    { 0.55024898052215576, 0.37531700730323792, 0.74584197998046875, 0 },
-    { 0.89904499053955078, 0.30295699834823608, 0.31601899862289429, 0 },
-    { 0.92632800340652466, 0.33399501442909241, 0.17422999441623688, 0 },
-    { -0.95370298624038696, -0.22485999763011932, 0.19959099590778351, 0 },
-    { -0.43644499778747559, -0.8534809947013855, 0.28464600443840027, 0 },
-    { -0.26337501406669617, -0.73369598388671875, 0.62630099058151245, 0 },
-    { -0.7487720251083374, -0.27329298853874207, 0.60380899906158447, 0 },
-    { 0.95370298624038696, -0.22485999763011932, 0.19959099590778351, 0 },
-    { 0.7487720251083374, -0.27329298853874207, 0.60380899906158447, 0 },
-    { 0.26337501406669617, -0.73369598388671875, 0.62630099058151245, 0 },
-    { 0.43644499778747559, -0.8534809947013855, 0.28464600443840027, 0 },
-    { 0.11249099671840668, -0.94390702247619629, 0.3104340136051178, 0 },
-    { 0, -0.94482302665710449, 0.32755500078201294, 0 },
-    { 0, -0.69472301006317139, 0.71922999620437622, 0 },
-    { 0.08804599940776825, -0.72002297639846802, 0.68831402063369751, 0 },
-    { -0.11249099671840668, -0.94390702247619629, 0.3104340136051178, 0 },
-    { -0.08804599940776825, -0.72002297639846802, 0.68831402063369751, 0 },
-    { 0.018798999488353729, -0.28272300958633423, 0.95898300409317017, 0 },
-    { 0, -0.26728099584579468, 0.96359097957611084, 0 },
-    { 0.0018619999755173922, -0.29755499958992004, 0.95468002557754517, 0 },
-    { -0.018798999488353729, -0.28272300958633423, 0.95898300409317017, 0 },
-    { -0.0018619999755173922, -0.29755499958992004, 0.95468002557754517, 0 },
-    { -0.46589601039886475, -0.095766998827457428, 0.87960398197174072, 0 },
-    { 0.46589601039886475, -0.095766998827457428, 0.87960398197174072, 0 },
-    { -0.26160499453544617, -0.17877699434757233, 0.94845402240753174, 0 },
-    { -0.21713900566101074, -0.12289799749851227, 0.96835201978683472, 0 },
-    { -0.29850199818611145, -0.20703800022602081, 0.93166899681091309, 0 },
-    { -0.013152999803423882, -0.028687000274658203, 0.99948102235794067, 0 },
-    { 0.092990003526210785, -0.056795001029968262, 0.99401801824569702, 0 },
-    { 0.13827900588512421, -0.059999000281095505, 0.98855602741241455, 0 },
-    { 0.26160499453544617, -0.17877699434757233, 0.94845402240753174, 0 },
-    { -0.092990003526210785, -0.056795001029968262, 0.99401801824569702, 0 },
-    { 0.013152999803423882, -0.028687000274658203, 0.99948102235794067, 0 },
-    { 0.29850199818611145, -0.20703800022602081, 0.93166899681091309, 0 },
-    { 0.21713900566101074, -0.12289799749851227, 0.96835201978683472, 0 },
-    { -0.13827900588512421, -0.059999000281095505, 0.98855602741241455, 0 },
-    { -0.14835000038146973, -0.068086996674537659, 0.9865720272064209, 0 },
-    { -0.067994996905326843, -0.045350998640060425, 0.99664300680160522, 0 },
-    { 0.15594999492168427, -0.054352998733520508, 0.98623597621917725, 0 },
-    { 0.16205300390720367, -0.069796003401279449, 0.9842829704284668, 0 },
-    { 0.14835000038146973, -0.068086996674537659, 0.9865720272064209, 0 },
-    { -0.15594999492168427, -0.054352998733520508, 0.98623597621917725, 0 },
-    { 0.067994996905326843, -0.045350998640060425, 0.99664300680160522, 0 },
-    { -0.16205300390720367, -0.069796003401279449, 0.9842829704284668, 0 },
-    { 0.0055240001529455185, -0.036653000861406326, 0.99929797649383545, 0 },
-    { 0.069430001080036163, -0.011597000062465668, 0.99749702215194702, 0 },
-    { 0.15369099378585815, -0.082429997622966766, 0.98464900255203247, 0 },
-    { 0.1317480057477951, -0.059999000281095505, 0.98944097757339478, 0 },
-    { -0.0055240001529455185, -0.036653000861406326, 0.99929797649383545, 0 },
-    { -0.15369099378585815, -0.082429997622966766, 0.98464900255203247, 0 },
-    { -0.069430001080036163, -0.011597000062465668, 0.99749702215194702, 0 },
-    { -0.1317480057477951, -0.059999000281095505, 0.98944097757339478, 0 },
-    { -0.25312098860740662, -0.30143100023269653, 0.91924798488616943, 0 },
-    { -0.10818800330162048, -0.46140900254249573, 0.88051998615264893, 0 },
-    { 0.010406999848783016, -0.25449401140213013, 0.96700900793075562, 0 },
-    { -0.081483997404575348, -0.12530900537967682, 0.988739013671875, 0 },
-    { 0.25312098860740662, -0.30143100023269653, 0.91924798488616943, 0 },
-    { 0.081483997404575348, -0.12530900537967682, 0.988739013671875, 0 },
-    { -0.010406999848783016, -0.25449401140213013, 0.96700900793075562, 0 },
-    { 0.10818800330162048, -0.46140900254249573, 0.88051998615264893, 0 },
-    { 0.037567999213933945, -0.53465402126312256, 0.84420299530029297, 0 },
-    { 0.18634599447250366, -0.55406397581100464, 0.81133502721786499, 0 },
-    { 0.20944899320602417, -0.29926401376724243, 0.93087601661682129, 0 },
-    { 0.1174049973487854, -0.3074130117893219, 0.94427299499511719, 0 },
-    { -0.037567999213933945, -0.53465402126312256, 0.84420299530029297, 0 },
-    { -0.1174049973487854, -0.3074130117893219, 0.94427299499511719, 0 },
-    { -0.20944899320602417, -0.29926401376724243, 0.93087601661682129, 0 },
-    { -0.18634599447250366, -0.55406397581100464, 0.81133502721786499, 0 },
-    { 0.3603929877281189, -0.52659702301025391, 0.76989001035690308, 0 },
-    { 0.47941499948501587, -0.43726900219917297, 0.7608569860458374, 0 },
-    { 0.36570298671722412, -0.16159600019454956, 0.91656202077865601, 0 },
-    { 0.31147199869155884, -0.24680300056934357, 0.91759997606277466, 0 },
-    { -0.3603929877281189, -0.52659702301025391, 0.76989001035690308, 0 },
-    { -0.31147199869155884, -0.24680300056934357, 0.91759997606277466, 0 },
-    { -0.36570298671722412, -0.16159600019454956, 0.91656202077865601, 0 },
-    { -0.47941499948501587, -0.43726900219917297, 0.7608569860458374, 0 },
-    { 0.50926202535629272, -0.32062700390815735, 0.79863899946212769, 0 },
-    { 0.49116501212120056, -0.2030089944601059, 0.84707200527191162, 0 },
-    { 0.31086200475692749, -0.056795001029968262, 0.94872897863388062, 0 },
-    { 0.35770699381828308, -0.085299000144004822, 0.92989897727966309, 0 },
-    { -0.50926202535629272, -0.32062700390815735, 0.79863899946212769, 0 },
-    { -0.35770699381828308, -0.085299000144004822, 0.92989897727966309, 0 },
-    { -0.31086200475692749, -0.056795001029968262, 0.94872897863388062, 0 },
-    { -0.49116501212120056, -0.2030089944601059, 0.84707200527191162, 0 },
-    { 0.46024999022483826, -0.10998900234699249, 0.8809170126914978, 0 },
-    { 0.42503100633621216, -0.052094999700784683, 0.90365302562713623, 0 },
-    { 0.2421640008687973, -0.060823000967502594, 0.96832197904586792, 0 },
-    { 0.26368001103401184, -0.061097998172044754, 0.96264499425888062, 0 },
-    { -0.46024999022483826, -0.10998900234699249, 0.8809170126914978, 0 },
-    { -0.26368001103401184, -0.061097998172044754, 0.96264499425888062, 0 },
-    { -0.2421640008687973, -0.060823000967502594, 0.96832197904586792, 0 },
-    { -0.42503100633621216, -0.052094999700784683, 0.90365302562713623, 0 },
-    { 0.38773798942565918, -0.025879999622702599, 0.92138397693634033, 0 },
-    { 0.40147098898887634, 0.034669000655412674, 0.91518902778625488, 0 },
-    { 0.34610998630523682, -0.079378999769687653, 0.93481200933456421, 0 },
-    { 0.28330299258232117, -0.067721001803874969, 0.95660299062728882, 0 },
-    { -0.38773798942565918, -0.025879999622702599, 0.92138397693634033, 0 },
-    { -0.28330299258232117, -0.067721001803874969, 0.95660299062728882, 0 },
-    { -0.34610998630523682, -0.079378999769687653, 0.93481200933456421, 0 },
-    { -0.40147098898887634, 0.034669000655412674, 0.91518902778625488, 0 },
-    { 0.42844900488853455, 0.20395499467849731, 0.88021498918533325, 0 },
-    { 0.36347499489784241, 0.3404650092124939, 0.86712199449539185, 0 },
-    { 0.29868501424789429, 0.11355900019407272, 0.94753897190093994, 0 },
-    { 0.39368900656700134, -0.024261999875307083, 0.91891199350357056, 0 },
-    { -0.42844900488853455, 0.20395499467849731, 0.88021498918533325, 0 },
-    { -0.39368900656700134, -0.024261999875307083, 0.91891199350357056, 0 },
-    { -0.29868501424789429, 0.11355900019407272, 0.94753897190093994, 0 },
-    { -0.36347499489784241, 0.3404650092124939, 0.86712199449539185, 0 },
-    { 0.21939800679683685, 0.28653800487518311, 0.93258500099182129, 0 },
-    { 0.1530500054359436, 0.14267399907112122, 0.9778439998626709, 0 },
-    { 0.1073950007557869, 0.1721549928188324, 0.97918599843978882, 0 },
-    { 0.12811699509620667, 0.19849200546741486, 0.9716789722442627, 0 },
-    { -0.21939800679683685, 0.28653800487518311, 0.93258500099182129, 0 },
-    { -0.12811699509620667, 0.19849200546741486, 0.9716789722442627, 0 },
-    { -0.1073950007557869, 0.1721549928188324, 0.97918599843978882, 0 },
-    { -0.1530500054359436, 0.14267399907112122, 0.9778439998626709, 0 },
-    { 0.17066000401973724, 0.080355003476142883, 0.98202502727508545, 0 },
-    { 0.15225699543952942, 0.064943000674247742, 0.98617500066757202, 0 },
-    { 0.13721099495887756, 0.094607003033161163, 0.98599201440811157, 0 },
-    { 0.16037499904632568, 0.14130100607872009, 0.97686702013015747, 0 },
-    { -0.17066000401973724, 0.080355003476142883, 0.98202502727508545, 0 },
-    { -0.16037499904632568, 0.14130100607872009, 0.97686702013015747, 0 },
-    { -0.13721099495887756, 0.094607003033161163, 0.98599201440811157, 0 },
-    { -0.15225699543952942, 0.064943000674247742, 0.98617500066757202, 0 },
-    { 0.11310199648141861, 0.030426999554038048, 0.99310302734375, 0 },
-    { 0.11380399763584137, 0.0065609999001026154, 0.9934689998626709, 0 },
-    { -0.11310199648141861, 0.030426999554038048, 0.99310302734375, 0 },
-    { -0.11380399763584137, 0.0065609999001026154, 0.9934689998626709, 0 },
-    { 0.27060800790786743, -0.28424900770187378, 0.91973602771759033, 0 },
-    { 0.22605100274085999, -0.19193099439144135, 0.95498502254486084, 0 },
-    { 0.39735099673271179, -0.31431001424789429, 0.86211699247360229, 0 },
-    { 0.48811298608779907, -0.42655700445175171, 0.76140600442886353, 0 },
-    { 0.33094298839569092, -0.41901901364326477, 0.84548497200012207, 0 },
-    { 0.26029199361801147, -0.33466601371765137, 0.9056670069694519, 0 },
-    { -0.27060800790786743, -0.28424900770187378, 0.91973602771759033, 0 },
-    { -0.33094298839569092, -0.41901901364326477, 0.84548497200012207, 0 },
-    { -0.48811298608779907, -0.42655700445175171, 0.76140600442886353, 0 },
-    { -0.39735099673271179, -0.31431001424789429, 0.86211699247360229, 0 },
-    { -0.22605100274085999, -0.19193099439144135, 0.95498502254486084, 0 },
-    { -0.26029199361801147, -0.33466601371765137, 0.9056670069694519, 0 },
-    { 0.1951960027217865, -0.16559299826622009, 0.96667397022247314, 0 },
-    { 0.04278700053691864, -0.25958999991416931, 0.96475100517272949, 0 },
-    { 0.21155400574207306, -0.31583601236343384, 0.92489397525787354, 0 },
-    { 0.032898999750614166, -0.46479699015617371, 0.8847619891166687, 0 },
-    { -0.1951960027217865, -0.16559299826622009, 0.96667397022247314, 0 },
-    { -0.21155400574207306, -0.31583601236343384, 0.92489397525787354, 0 },
-    { -0.04278700053691864, -0.25958999991416931, 0.96475100517272949, 0 },
-    { -0.032898999750614166, -0.46479699015617371, 0.8847619891166687, 0 },
-    { -0.048921000212430954, -0.41200000047683716, 0.90984797477722168, 0 },
-    { 0.027650000527501106, -0.57060497999191284, 0.82073402404785156, 0 },
-    { -0.1117589995265007, -0.67781597375869751, 0.72664600610733032, 0 },
-    { -0.10769999772310257, -0.81118202209472656, 0.57475501298904419, 0 },
-    { 0.048921000212430954, -0.41200000047683716, 0.90984797477722168, 0 },
-    { 0.1117589995265007, -0.67781597375869751, 0.72664600610733032, 0 },
-    { -0.027650000527501106, -0.57060497999191284, 0.82073402404785156, 0 },
-    { 0.10769999772310257, -0.81118202209472656, 0.57475501298904419, 0 },
-    { 0.084536001086235046, -0.64458101987838745, 0.75981897115707397, 0 },
-    { 0.0089419996365904808, -0.54982101917266846, 0.83520001173019409, 0 },
-    { -0.073183000087738037, -0.81197500228881836, 0.57905799150466919, 0 },
-    { -0.13364100456237793, -0.67604601383209229, 0.72460097074508667, 0 },
-    { -0.084536001086235046, -0.64458101987838745, 0.75981897115707397, 0 },
-    { 0.073183000087738037, -0.81197500228881836, 0.57905799150466919, 0 },
-    { -0.0089419996365904808, -0.54982101917266846, 0.83520001173019409, 0 },
-    { 0.13364100456237793, -0.67604601383209229, 0.72460097074508667, 0 },
-    { -0.12677399814128876, -0.30143100023269653, 0.94500601291656494, 0 },
-    { -0.19724099338054657, -0.1087070032954216, 0.97427302598953247, 0 },
-    { -0.30368998646736145, -0.37257000803947449, 0.8768879771232605, 0 },
-    { -0.38666999340057373, -0.11438299715518951, 0.91506701707839966, 0 },
-    { 0.12677399814128876, -0.30143100023269653, 0.94500601291656494, 0 },
-    { 0.30368998646736145, -0.37257000803947449, 0.8768879771232605, 0 },
-    { 0.19724099338054657, -0.1087070032954216, 0.97427302598953247, 0 },
-    { 0.38666999340057373, -0.11438299715518951, 0.91506701707839966, 0 },
-    { -0.15311099588871002, 0.025513000786304474, 0.98785400390625, 0 },
-    { -0.060823000967502594, 0.19092400372028351, 0.97970497608184814, 0 },
-    { -0.33753499388694763, 0.070559002459049225, 0.93862700462341309, 0 },
-    { -0.22641700506210327, 0.28330299258232117, 0.93188297748565674, 0 },
-    { 0.15311099588871002, 0.025513000786304474, 0.98785400390625, 0 },
-    { 0.33753499388694763, 0.070559002459049225, 0.93862700462341309, 0 },
-    { 0.060823000967502594, 0.19092400372028351, 0.97970497608184814, 0 },
-    { 0.22641700506210327, 0.28330299258232117, 0.93188297748565674, 0 },
-    { 0.0059509999118745327, 0.30423900485038757, 0.95257401466369629, 0 },
-    { 0.045166999101638794, 0.35111498832702637, 0.93520897626876831, 0 },
-    { -0.16077199578285217, 0.4460889995098114, 0.8803979754447937, 0 },
-    { -0.12530900537967682, 0.55513197183609009, 0.82222998142242432, 0 },
-    { -0.0059509999118745327, 0.30423900485038757, 0.95257401466369629, 0 },
-    { 0.16077199578285217, 0.4460889995098114, 0.8803979754447937, 0 },
-    { -0.045166999101638794, 0.35111498832702637, 0.93520897626876831, 0 },
-    { 0.12530900537967682, 0.55513197183609009, 0.82222998142242432, 0 },
-    { 0.1278730034828186, 0.35462498664855957, 0.92620599269866943, 0 },
-    { 0.23633499443531036, 0.34540799260139465, 0.90816998481750488, 0 },
-    { -0.00076299998909235001, 0.6169009804725647, 0.78701102733612061, 0 },
-    { 0.19226700067520142, 0.6174200177192688, 0.76274901628494263, 0 },
-    { -0.1278730034828186, 0.35462498664855957, 0.92620599269866943, 0 },
-    { 0.00076299998909235001, 0.6169009804725647, 0.78701102733612061, 0 },
-    { -0.23633499443531036, 0.34540799260139465, 0.90816998481750488, 0 },
-    { -0.19226700067520142, 0.6174200177192688, 0.76274901628494263, 0 },
-    { 0.30893900990486145, 0.35850098729133606, 0.8809170126914978, 0 },
-    { 0.33536800742149353, 0.38212200999259949, 0.86107999086380005, 0 },
-    { 0.32639500498771667, 0.6013370156288147, 0.72926998138427734, 0 },
-    { 0.40208101272583008, 0.59144902229309082, 0.69890397787094116, 0 },
-    { -0.30893900990486145, 0.35850098729133606, 0.8809170126914978, 0 },
-    { -0.32639500498771667, 0.6013370156288147, 0.72926998138427734, 0 },
-    { -0.33536800742149353, 0.38212200999259949, 0.86107999086380005, 0 },
-    { -0.40208101272583008, 0.59144902229309082, 0.69890397787094116, 0 },
-    { 0.38905000686645508, 0.38425898551940918, 0.83721399307250977, 0 },
-    { 0.53489798307418823, 0.27997699379920959, 0.79714298248291016, 0 },
-    { 0.51594597101211548, 0.5143589973449707, 0.68495702743530273, 0 },
-    { 0.67656499147415161, 0.33030200004577637, 0.65813201665878296, 0 },
-    { -0.38905000686645508, 0.38425898551940918, 0.83721399307250977, 0 },
-    { -0.51594597101211548, 0.5143589973449707, 0.68495702743530273, 0 },
-    { -0.53489798307418823, 0.27997699379920959, 0.79714298248291016, 0 },
-    { -0.67656499147415161, 0.33030200004577637, 0.65813201665878296, 0 },
-    { 0.52760398387908936, -0.273048996925354, 0.80437600612640381, 0 },
-    { 0.62227201461791992, -0.18613199889659882, 0.76030802726745605, 0 },
-    { 0.76506900787353516, -0.24106599390506744, 0.59706401824951172, 0 },
-    { 0.64815199375152588, -0.36088100075721741, 0.67052197456359863, 0 },
-    { -0.52760398387908936, -0.273048996925354, 0.80437600612640381, 0 },
-    { -0.64815199375152588, -0.36088100075721741, 0.67052197456359863, 0 },
-    { -0.76506900787353516, -0.24106599390506744, 0.59706401824951172, 0 },
-    { -0.62227201461791992, -0.18613199889659882, 0.76030802726745605, 0 },
-    { 0.66878300905227661, -0.082887999713420868, 0.73879200220108032, 0 },
-    { 0.67635101079940796, 0.0021059999708086252, 0.73656398057937622, 0 },
-    { 0.80684798955917358, 0.01196299958974123, 0.59062498807907104, 0 },
-    { 0.81115102767944336, -0.097079001367092133, 0.57670801877975464, 0 },
-    { -0.66878300905227661, -0.082887999713420868, 0.73879200220108032, 0 },
-    { -0.81115102767944336, -0.097079001367092133, 0.57670801877975464, 0 },
-    { -0.80684798955917358, 0.01196299958974123, 0.59062498807907104, 0 },
-    { -0.67635101079940796, 0.0021059999708086252, 0.73656398057937622, 0 },
-    { 0.64409297704696655, 0.11426100134849548, 0.75634002685546875, 0 },
-    { 0.77462100982666016, 0.13791300356388092, 0.61714500188827515, 0 },
-    { -0.64409297704696655, 0.11426100134849548, 0.75634002685546875, 0 },
-    { -0.77462100982666016, 0.13791300356388092, 0.61714500188827515, 0 },
-    { -0.50508099794387817, 0.85851597785949707, -0.088289998471736908, 0 },
-    { 0, 0.99987798929214478, 0.013855000026524067, 0 },
-    { -0.74626898765563965, 0.60530400276184082, -0.27686399221420288, 0 },
-    { -0.4973599910736084, 0.86309397220611572, -0.087497003376483917, 0 },
-    { -0.35111498832702637, 0.87115097045898438, 0.34318101406097412, 0 },
-    { 0, 0.8787500262260437, 0.47721800208091736, 0 },
-    { 0.50508099794387817, 0.85851597785949707, -0.088289998471736908, 0 },
-    { 0.35111498832702637, 0.87115097045898438, 0.34318101406097412, 0 },
-    { 0.4973599910736084, 0.86309397220611572, -0.087497003376483917, 0 },
-    { 0.74626898765563965, 0.60530400276184082, -0.27686399221420288, 0 },
-    { -0.79174202680587769, 0.47239598631858826, -0.38721901178359985, 0 },
-    { -0.64409297704696655, 0.64836597442626953, -0.40583500266075134, 0 },
-    { -0.50035101175308228, 0.45243701338768005, -0.73815101385116577, 0 },
-    { -0.5113379955291748, 0.37794101238250732, -0.77178299427032471, 0 },
-    { 0.79174202680587769, 0.47239598631858826, -0.38721901178359985, 0 },
-    { 0.5113379955291748, 0.37794101238250732, -0.77178299427032471, 0 },
-    { 0.50035101175308228, 0.45243701338768005, -0.73815101385116577, 0 },
-    { 0.64409297704696655, 0.64836597442626953, -0.40583500266075134, 0 },
-    { -0.24402600526809692, 0.87997102737426758, -0.40748301148414612, 0 },
-    { 0.23270399868488312, 0.89043897390365601, -0.39106398820877075, 0 },
-    { 0.082521997392177582, 0.62852901220321655, -0.77337002754211426, 0 },
-    { -0.22638599574565887, 0.55134701728820801, -0.80294197797775269, 0 },
-    { 0.24402600526809692, 0.87997102737426758, -0.40748301148414612, 0 },
-    { 0.22638599574565887, 0.55134701728820801, -0.80294197797775269, 0 },
-    { -0.082521997392177582, 0.62852901220321655, -0.77337002754211426, 0 },
-    { -0.23270399868488312, 0.89043897390365601, -0.39106398820877075, 0 },
-    { 0.46775698661804199, 0.80126297473907471, -0.372996985912323, 0 },
-    { 0.44093099236488342, 0.83959501981735229, -0.31717899441719055, 0 },
-    { 0.15506500005722046, 0.85409098863601685, -0.49644500017166138, 0 },
-    { 0.12073100358247757, 0.56343299150466919, -0.81725502014160156, 0 },
-    { -0.46775698661804199, 0.80126297473907471, -0.372996985912323, 0 },
-    { -0.12073100358247757, 0.56343299150466919, -0.81725502014160156, 0 },
-    { -0.15506500005722046, 0.85409098863601685, -0.49644500017166138, 0 },
-    { -0.44093099236488342, 0.83959501981735229, -0.31717899441719055, 0 },
-    { 0.39146101474761963, 0.89132398366928101, -0.22861400246620178, 0 },
-    { 0.37543898820877075, 0.90966498851776123, -0.17743499577045441, 0 },
-    { 0.36182698607444763, 0.90902400016784668, -0.20664100348949432, 0 },
-    { 0.30311000347137451, 0.91079401969909668, -0.28022098541259766, 0 },
-    { -0.39146101474761963, 0.89132398366928101, -0.22861400246620178, 0 },
-    { -0.30311000347137451, 0.91079401969909668, -0.28022098541259766, 0 },
-    { -0.36182698607444763, 0.90902400016784668, -0.20664100348949432, 0 },
-    { -0.37543898820877075, 0.90966498851776123, -0.17743499577045441, 0 },
-    { 0.52888602018356323, 0.82552599906921387, -0.19687500596046448, 0 },
-    { 0.8530840277671814, 0.46073800325393677, -0.24472799897193909, 0 },
-    { 0.80718398094177246, 0.51835697889328003, -0.28232699632644653, 0 },
-    { 0.50193798542022705, 0.82888299226760864, -0.24689500033855438, 0 },
-    { -0.52888602018356323, 0.82552599906921387, -0.19687500596046448, 0 },
-    { -0.50193798542022705, 0.82888299226760864, -0.24689500033855438, 0 },
-    { -0.80718398094177246, 0.51835697889328003, -0.28232699632644653, 0 },
-    { -0.8530840277671814, 0.46073800325393677, -0.24472799897193909, 0 },
-    { 0.97137397527694702, 0.0023189999628812075, -0.23740300536155701, 0 },
-    { 0.89837300777435303, -0.39896801114082336, -0.18353800475597382, 0 },
-    { 0.93755900859832764, -0.3443399965763092, -0.048463001847267151, 0 },
-    { 0.98065102100372314, 0.075594000518321991, -0.18051700294017792, 0 },
-    { -0.97137397527694702, 0.0023189999628812075, -0.23740300536155701, 0 },
-    { -0.98065102100372314, 0.075594000518321991, -0.18051700294017792, 0 },
-    { -0.93755900859832764, -0.3443399965763092, -0.048463001847267151, 0 },
-    { -0.89837300777435303, -0.39896801114082336, -0.18353800475597382, 0 },
-    { 0.71907699108123779, -0.68233299255371094, -0.13144299387931824, 0 },
-    { 0.57826501131057739, -0.80892401933670044, -0.10593000054359436, 0 },
-    { 0.62138700485229492, -0.78203701972961426, 0.04748699814081192, 0 },
-    { 0.77810001373291016, -0.6277959942817688, 0.020263999700546265, 0 },
-    { -0.71907699108123779, -0.68233299255371094, -0.13144299387931824, 0 },
-    { -0.77810001373291016, -0.6277959942817688, 0.020263999700546265, 0 },
-    { -0.62138700485229492, -0.78203701972961426, 0.04748699814081192, 0 },
-    { -0.57826501131057739, -0.80892401933670044, -0.10593000054359436, 0 },
-    { 0.45985299348831177, -0.88247299194335938, -0.098819002509117126, 0 },
-    { 0.3426310122013092, -0.93493497371673584, -0.091922000050544739, 0 },
-    { 0.42219299077987671, -0.90438598394393921, 0.061524998396635056, 0 },
-    { 0.49626100063323975, -0.86684799194335938, 0.047669999301433563, 0 },
-    { -0.45985299348831177, -0.88247299194335938, -0.098819002509117126, 0 },
-    { -0.49626100063323975, -0.86684799194335938, 0.047669999301433563, 0 },
-    { -0.42219299077987671, -0.90438598394393921, 0.061524998396635056, 0 },
-    { -0.3426310122013092, -0.93493497371673584, -0.091922000050544739, 0 },
-    { 0.23877699673175812, -0.53483700752258301, -0.81047999858856201, 0 },
-    { 0.20929600298404694, -0.25946798920631409, -0.94277799129486084, 0 },
-    { 0, -0.25064900517463684, -0.96804702281951904, 0 },
-    { 0, -0.51139897108078003, -0.85930997133255005, 0 },
-    { 0, -0.78679800033569336, -0.61717599630355835, 0 },
-    { 0.28513398766517639, -0.78420400619506836, -0.55107301473617554, 0 },
-    { 0.64503902196884155, -0.63331997394561768, -0.42747300863265991, 0 },
-    { 0.50462400913238525, -0.48087999224662781, -0.71697098016738892, 0 },
-    { 0.34055599570274353, -0.23615199327468872, -0.91006201505661011, 0 },
-    { -0.23877699673175812, -0.53483700752258301, -0.81047999858856201, 0 },
-    { -0.50462400913238525, -0.48087999224662781, -0.71697098016738892, 0 },
-    { -0.64503902196884155, -0.63331997394561768, -0.42747300863265991, 0 },
-    { -0.28513398766517639, -0.78420400619506836, -0.55107301473617554, 0 },
-    { -0.20929600298404694, -0.25946798920631409, -0.94277799129486084, 0 },
-    { -0.34055599570274353, -0.23615199327468872, -0.91006201505661011, 0 },
-    { 0.17572599649429321, -0.14145299792289734, -0.97421199083328247, 0 },
-    { 0.13083299994468689, -0.24842099845409393, -0.95974600315093994, 0 },
-    { 0, -0.28663000464439392, -0.95800697803497314, 0 },
-    { 0, -0.15945899486541748, -0.98718202114105225, 0 },
-    { 0.22043499350547791, -0.098757997155189514, -0.97036701440811157, 0 },
-    { 0.13873699307441711, -0.1725820004940033, -0.9751579761505127, 0 },
-    { -0.17572599649429321, -0.14145299792289734, -0.97421199083328247, 0 },
-    { -0.22043499350547791, -0.098757997155189514, -0.97036701440811157, 0 },
-    { -0.13083299994468689, -0.24842099845409393, -0.95974600315093994, 0 },
-    { -0.13873699307441711, -0.1725820004940033, -0.9751579761505127, 0 },
-    { 0.077180996537208557, -0.46320998668670654, -0.88283902406692505, 0 },
-    { 0.057893998920917511, -0.75405102968215942, -0.65422499179840088, 0 },
-    { 0, -0.78228098154067993, -0.62288302183151245, 0 },
-    { 0, -0.50492900609970093, -0.86315500736236572, 0 },
-    { 0.062501996755599976, -0.37238699197769165, -0.92596197128295898, 0 },
-    { 0.046326998621225357, -0.69496798515319824, -0.71752101182937622, 0 },
-    { -0.077180996537208557, -0.46320998668670654, -0.88283902406692505, 0 },
-    { -0.062501996755599976, -0.37238699197769165, -0.92596197128295898, 0 },
-    { -0.057893998920917511, -0.75405102968215942, -0.65422499179840088, 0 },
-    { -0.046326998621225357, -0.69496798515319824, -0.71752101182937622, 0 },
-    { 0.07879900187253952, -0.96652102470397949, -0.24411800503730774, 0 },
-    { 0.10119900107383728, -0.94991898536682129, -0.29554098844528198, 0 },
-    { 0, -0.97631800174713135, -0.21625399589538574, 0 },
-    { -0.07879900187253952, -0.96652102470397949, -0.24411800503730774, 0 },
-    { -0.10119900107383728, -0.94991898536682129, -0.29554098844528198, 0 },
-    { 0.21143199503421783, -0.91152697801589966, -0.35270199179649353, 0 },
-    { 0.60441899299621582, -0.67732799053192139, -0.41938498616218567, 0 },
-    { 0.13467800617218018, -0.6143379807472229, -0.77742898464202881, 0 },
-    { 0.40852099657058716, -0.46800100803375244, -0.78359299898147583, 0 },
-    { -0.21143199503421783, -0.91152697801589966, -0.35270199179649353, 0 },
-    { -0.13467800617218018, -0.6143379807472229, -0.77742898464202881, 0 },
-    { -0.60441899299621582, -0.67732799053192139, -0.41938498616218567, 0 },
-    { -0.40852099657058716, -0.46800100803375244, -0.78359299898147583, 0 },
-    { 0.88555598258972168, -0.20441299676895142, -0.41706600785255432, 0 },
-    { 0.93063098192214966, 0.0773639976978302, -0.35764598846435547, 0 },
-    { 0.55577301979064941, -0.13507500290870667, -0.82027602195739746, 0 },
-    { 0.61113297939300537, 0.051667999476194382, -0.78981900215148926, 0 },
-    { -0.88555598258972168, -0.20441299676895142, -0.41706600785255432, 0 },
-    { -0.55577301979064941, -0.13507500290870667, -0.82027602195739746, 0 },
-    { -0.93063098192214966, 0.0773639976978302, -0.35764598846435547, 0 },
-    { -0.61113297939300537, 0.051667999476194382, -0.78981900215148926, 0 },
-    { 0.92941099405288696, 0.13690599799156189, -0.34266200661659241, 0 },
-    { 0.93285900354385376, 0.14279599487781525, -0.33066800236701965, 0 },
-    { 0.66826397180557251, 0.097811996936798096, -0.73744899034500122, 0 },
-    { 0.74105000495910645, 0.065981000661849976, -0.66814202070236206, 0 },
-    { -0.92941099405288696, 0.13690599799156189, -0.34266200661659241, 0 },
-    { -0.66826397180557251, 0.097811996936798096, -0.73744899034500122, 0 },
-    { -0.93285900354385376, 0.14279599487781525, -0.33066800236701965, 0 },
-    { -0.74105000495910645, 0.065981000661849976, -0.66814202070236206, 0 },
-    { 0.33439099788665771, -0.01510700024664402, -0.94228899478912354, 0 },
-    { 0.22479900717735291, -0.069185003638267517, -0.97192299365997314, 0 },
-    { 0.51182597875595093, -0.11233899742364883, -0.85167998075485229, 0 },
-    { -0.33439099788665771, -0.01510700024664402, -0.94228899478912354, 0 },
-    { -0.51182597875595093, -0.11233899742364883, -0.85167998075485229, 0 },
-    { -0.22479900717735291, -0.069185003638267517, -0.97192299365997314, 0 },
-    { 0.13806599378585815, -0.25766798853874207, -0.95629799365997314, 0 },
-    { -0.13806599378585815, -0.25766798853874207, -0.95629799365997314, 0 },
-    { 0.73445802927017212, -0.24222500622272491, -0.63393098115921021, 0 },
-    { 0.88650202751159668, -0.27027198672294617, -0.37549999356269836, 0 },
-    { 0.92898297309875488, 0.054781001061201096, -0.36597800254821777, 0 },
-    { 0.84450799226760864, 0.023956999182701111, -0.53495901823043823, 0 },
-    { -0.73445802927017212, -0.24222500622272491, -0.63393098115921021, 0 },
-    { -0.84450799226760864, 0.023956999182701111, -0.53495901823043823, 0 },
-    { -0.92898297309875488, 0.054781001061201096, -0.36597800254821777, 0 },
-    { -0.88650202751159668, -0.27027198672294617, -0.37549999356269836, 0 },
-    { 0.94216698408126831, 0.14365099370479584, -0.30271300673484802, 0 },
-    { 0.95165902376174927, 0.19934700429439545, -0.23355799913406372, 0 },
-    { -0.94216698408126831, 0.14365099370479584, -0.30271300673484802, 0 },
-    { -0.95165902376174927, 0.19934700429439545, -0.23355799913406372, 0 },
-    { 0.983551025390625, 0.1495710015296936, 0.10116899758577347, 0 },
-    { 0.98294001817703247, 0.18045599758625031, -0.034912999719381332, 0 },
-    { 0.94106900691986084, -0.32770800590515137, 0.083406999707221985, 0 },
-    { 0.8934599757194519, -0.35584598779678345, 0.27399501204490662, 0 },
-    { 0.81005299091339111, -0.28894901275634766, 0.51017802953720093, 0 },
-    { 0.95705997943878174, 0.18277500569820404, 0.22489100694656372, 0 },
-    { -0.983551025390625, 0.1495710015296936, 0.10116899758577347, 0 },
-    { -0.95705997943878174, 0.18277500569820404, 0.22489100694656372, 0 },
-    { -0.81005299091339111, -0.28894901275634766, 0.51017802953720093, 0 },
-    { -0.8934599757194519, -0.35584598779678345, 0.27399501204490662, 0 },
-    { -0.94106900691986084, -0.32770800590515137, 0.083406999707221985, 0 },
-    { -0.98294001817703247, 0.18045599758625031, -0.034912999719381332, 0 },
-    { 0.96053999662399292, 0.23752599954605103, -0.14465799927711487, 0 },
-    { 0.98284900188446045, -0.017487000674009323, -0.18341599404811859, 0 },
-    { -0.96053999662399292, 0.23752599954605103, -0.14465799927711487, 0 },
-    { -0.98284900188446045, -0.017487000674009323, -0.18341599404811859, 0 },
-    { 0.96340799331665039, -0.15054799616336823, 0.22165599465370178, 0 },
-    { 0.61226201057434082, -0.78716397285461426, 0.074006997048854828, 0 },
-    { 0.76928001642227173, -0.44734001159667969, 0.4560990035533905, 0 },
-    { 0.48805201053619385, -0.86370402574539185, 0.12561400234699249, 0 },
-    { -0.96340799331665039, -0.15054799616336823, 0.22165599465370178, 0 },
-    { -0.76928001642227173, -0.44734001159667969, 0.4560990035533905, 0 },
-    { -0.61226201057434082, -0.78716397285461426, 0.074006997048854828, 0 },
-    { -0.48805201053619385, -0.86370402574539185, 0.12561400234699249, 0 },
-    { 0.30628401041030884, -0.94952201843261719, -0.067414999008178711, 0 },
-    { 0.38502201437950134, -0.91225898265838623, 0.1395609974861145, 0 },
-    { -0.30628401041030884, -0.94952201843261719, -0.067414999008178711, 0 },
-    { -0.38502201437950134, -0.91225898265838623, 0.1395609974861145, 0 },
-    { 0.28675198554992676, -0.49323999881744385, -0.82125300168991089, 0 },
-    { 0, -0.49928298592567444, -0.86642098426818848, 0 },
-    { 0, -0.25815600156784058, -0.96609401702880859, 0 },
-    { 0.28879699110984802, -0.27131000161170959, -0.91811901330947876, 0 },
-    { 0.41206100583076477, -0.29972198605537415, -0.8604390025138855, 0 },
-    { 0.41837799549102783, -0.49659699201583862, -0.7604600191116333, 0 },
-    { 0.45222300291061401, -0.68596500158309937, -0.56999397277832031, 0 },
-    { 0.27692499756813049, -0.70546597242355347, -0.65236401557922363, 0 },
-    { 0, -0.71977901458740234, -0.69417399168014526, 0 },
-    { -0.28675198554992676, -0.49323999881744385, -0.82125300168991089, 0 },
-    { -0.27692499756813049, -0.70546597242355347, -0.65236401557922363, 0 },
-    { -0.45222300291061401, -0.68596500158309937, -0.56999397277832031, 0 },
-    { -0.41837799549102783, -0.49659699201583862, -0.7604600191116333, 0 },
-    { -0.41206100583076477, -0.29972198605537415, -0.8604390025138855, 0 },
-    { -0.28879699110984802, -0.27131000161170959, -0.91811901330947876, 0 },
-    { 0.26837998628616333, -0.84279900789260864, -0.46647500991821289, 0 },
-    { 0, -0.86461997032165527, -0.50239598751068115, 0 },
-    { 0.47615000605583191, -0.78872001171112061, -0.3887450098991394, 0 },
-    { 0.48225298523902893, -0.84933000802993774, -0.21454499661922455, 0 },
-    { 0.26084199547767639, -0.92248302698135376, -0.28446298837661743, 0 },
-    { 0, -0.94973599910736084, -0.31299799680709839, 0 },
-    { -0.26837998628616333, -0.84279900789260864, -0.46647500991821289, 0 },
-    { -0.26084199547767639, -0.92248302698135376, -0.28446298837661743, 0 },
-    { -0.48225298523902893, -0.84933000802993774, -0.21454499661922455, 0 },
-    { -0.47615000605583191, -0.78872001171112061, -0.3887450098991394, 0 },
-    { 0.27262198925018311, -0.94897300004959106, -0.15832999348640442, 0 },
-    { 0, -0.98239099979400635, -0.18668200075626373, 0 },
-    { 0.5139319896697998, -0.85403001308441162, -0.080385997891426086, 0 },
-    { 0.59987199306488037, -0.80007302761077881, -0.0045469999313354492, 0 },
-    { 0.29874598979949951, -0.94473099708557129, -0.13477000594139099, 0 },
-    { 0, -0.9860529899597168, -0.16626499593257904, 0 },
-    { -0.27262198925018311, -0.94897300004959106, -0.15832999348640442, 0 },
-    { -0.29874598979949951, -0.94473099708557129, -0.13477000594139099, 0 },
-    { -0.59987199306488037, -0.80007302761077881, -0.0045469999313354492, 0 },
-    { -0.5139319896697998, -0.85403001308441162, -0.080385997891426086, 0 },
-    { 0.31498199701309204, -0.91088598966598511, -0.26654899120330811, 0 },
-    { 0, -0.94827097654342651, -0.31742298603057861, 0 },
-    { 0.65575098991394043, -0.74102002382278442, -0.14444400370121002, 0 },
-    { -0.31498199701309204, -0.91088598966598511, -0.26654899120330811, 0 },
-    { -0.65575098991394043, -0.74102002382278442, -0.14444400370121002, 0 },
-    { 0.91689801216125488, -0.38245800137519836, -0.11407800018787384, 0 },
-    { 0.81005299091339111, -0.57829499244689941, 0.096652001142501831, 0 },
-    { -0.91689801216125488, -0.38245800137519836, -0.11407800018787384, 0 },
-    { -0.81005299091339111, -0.57829499244689941, 0.096652001142501831, 0 },
-    { 0.83754998445510864, -0.51441997289657593, 0.18390500545501709, 0 },
-    { 0.96282798051834106, -0.23645700514316559, 0.1304669976234436, 0 },
-    { 0.65691101551055908, -0.72453999519348145, 0.20856299996376038, 0 },
-    { 0.69295299053192139, -0.70549601316452026, 0.14835000038146973, 0 },
-    { 0.89703100919723511, -0.42298701405525208, 0.12799499928951263, 0 },
-    { 0.97848397493362427, -0.15454599261283875, 0.13647900521755219, 0 },
-    { -0.83754998445510864, -0.51441997289657593, 0.18390500545501709, 0 },
-    { -0.89703100919723511, -0.42298701405525208, 0.12799499928951263, 0 },
-    { -0.69295299053192139, -0.70549601316452026, 0.14835000038146973, 0 },
-    { -0.65691101551055908, -0.72453999519348145, 0.20856299996376038, 0 },
-    { -0.96282798051834106, -0.23645700514316559, 0.1304669976234436, 0 },
-    { -0.97848397493362427, -0.15454599261283875, 0.13647900521755219, 0 },
-    { 0.28855198621749878, -0.043244998902082443, -0.95644998550415039, 0 },
-    { 0, -0.011048000305891037, -0.9999079704284668, 0 },
-    { 0, 0.31998699903488159, -0.94741702079772949, 0 },
-    { 0.29599899053573608, 0.28382200002670288, -0.91201502084732056, 0 },
-    { 0.43415600061416626, 0.2147890031337738, -0.8748440146446228, 0 },
-    { 0.42069798707962036, -0.10751699656248093, -0.90078401565551758, 0 },
-    { -0.28855198621749878, -0.043244998902082443, -0.95644998550415039, 0 },
-    { -0.42069798707962036, -0.10751699656248093, -0.90078401565551758, 0 },
-    { -0.43415600061416626, 0.2147890031337738, -0.8748440146446228, 0 },
-    { -0.29599899053573608, 0.28382200002670288, -0.91201502084732056, 0 },
-    { 0.14712999761104584, 0.95068198442459106, 0.27295801043510437, 0 },
-    { 0, 0.96322500705718994, 0.26862400770187378, 0 },
-    { 0, 0.82460999488830566, 0.56566101312637329, 0 },
-    { 0.17767900228500366, 0.80468201637268066, 0.56645399332046509, 0 },
-    { 0.42261999845504761, 0.73400098085403442, 0.53157097101211548, 0 },
-    { 0.38770699501037598, 0.88418197631835938, 0.26053699851036072, 0 },
-    { 0.35682201385498047, 0.93398797512054443, 0.016968000680208206, 0 },
-    { 0.13330499827861786, 0.99093598127365112, 0.015533999539911747, 0 },
-    { 0, 0.99993902444839478, 0.010834000073373318, 0 },
-    { -0.14712999761104584, 0.95068198442459106, 0.27295801043510437, 0 },
-    { -0.13330499827861786, 0.99093598127365112, 0.015533999539911747, 0 },
-    { -0.35682201385498047, 0.93398797512054443, 0.016968000680208206, 0 },
-    { -0.38770699501037598, 0.88418197631835938, 0.26053699851036072, 0 },
-    { -0.42261999845504761, 0.73400098085403442, 0.53157097101211548, 0 },
-    { -0.17767900228500366, 0.80468201637268066, 0.56645399332046509, 0 },
-    { 0.151310995221138, 0.95962399244308472, -0.23706799745559692, 0 },
-    { 0, 0.97122102975845337, -0.23804399371147156, 0 },
-    { 0.34455400705337524, 0.90890198945999146, -0.23484000563621521, 0 },
-    { 0.35993498563766479, 0.76705199480056763, -0.53105300664901733, 0 },
-    { 0.21137100458145142, 0.82326698303222656, -0.52678000926971436, 0 },
-    { 0, 0.8470110297203064, -0.53150999546051025, 0 },
-    { -0.151310995221138, 0.95962399244308472, -0.23706799745559692, 0 },
-    { -0.21137100458145142, 0.82326698303222656, -0.52678000926971436, 0 },
-    { -0.35993498563766479, 0.76705199480056763, -0.53105300664901733, 0 },
-    { -0.34455400705337524, 0.90890198945999146, -0.23484000563621521, 0 },
-    { 0.27356800436973572, 0.59337097406387329, -0.7569810152053833, 0 },
-    { 0, 0.62800997495651245, -0.7781909704208374, 0 },
-    { 0.40430900454521179, 0.52702397108078003, -0.74745899438858032, 0 },
-    { -0.27356800436973572, 0.59337097406387329, -0.7569810152053833, 0 },
-    { -0.40430900454521179, 0.52702397108078003, -0.74745899438858032, 0 },
-    { 0.55195802450180054, 0.83275902271270752, -0.042328998446464539, 0 },
-    { 0.43513301014900208, 0.9000210165977478, 0.024720000103116035, 0 },
-    { 0.83007299900054932, 0.55351400375366211, -0.067567996680736542, 0 },
-    { 0.82784497737884521, 0.51271098852157593, 0.22742399573326111, 0 },
-    { 0.57026898860931396, 0.74984002113342285, 0.33533701300621033, 0 },
-    { 0.51896697282791138, 0.7522510290145874, 0.40589600801467896, 0 },
-    { -0.55195802450180054, 0.83275902271270752, -0.042328998446464539, 0 },
-    { -0.57026898860931396, 0.74984002113342285, 0.33533701300621033, 0 },
-    { -0.82784497737884521, 0.51271098852157593, 0.22742399573326111, 0 },
-    { -0.83007299900054932, 0.55351400375366211, -0.067567996680736542, 0 },
-    { -0.43513301014900208, 0.9000210165977478, 0.024720000103116035, 0 },
-    { -0.51896697282791138, 0.7522510290145874, 0.40589600801467896, 0 },
-    { 0.55262899398803711, 0.63747102022171021, 0.53682100772857666, 0 },
-    { 0.56996399164199829, 0.61195701360702515, 0.54826498031616211, 0 },
-    { 0.80681800842285156, 0.42768600583076477, 0.40751400589942932, 0 },
-    { 0.83608502149581909, 0.44773700833320618, 0.3169650137424469, 0 },
-    { 0.62947499752044678, 0.65874201059341431, 0.41200000047683716, 0 },
-    { 0.64101099967956543, 0.65361499786376953, 0.40226399898529053, 0 },
-    { -0.55262899398803711, 0.63747102022171021, 0.53682100772857666, 0 },
-    { -0.62947499752044678, 0.65874201059341431, 0.41200000047683716, 0 },
-    { -0.83608502149581909, 0.44773700833320618, 0.3169650137424469, 0 },
-    { -0.80681800842285156, 0.42768600583076477, 0.40751400589942932, 0 },
-    { -0.56996399164199829, 0.61195701360702515, 0.54826498031616211, 0 },
-    { -0.64101099967956543, 0.65361499786376953, 0.40226399898529053, 0 },
-    { 0.70809000730514526, 0.68654400110244751, 0.16492199897766113, 0 },
-    { 0.67064398527145386, 0.72319698333740234, 0.16492199897766113, 0 },
-    { 0.87908601760864258, 0.46494901180267334, 0.10483100265264511, 0 },
-    { 0.90160799026489258, 0.42991399765014648, -0.047242999076843262, 0 },
-    { 0.74275898933410645, 0.66872197389602661, -0.03296000137925148, 0 },
-    { 0.67162102460861206, 0.74007397890090942, -0.034058999270200729, 0 },
-    { -0.70809000730514526, 0.68654400110244751, 0.16492199897766113, 0 },
-    { -0.74275898933410645, 0.66872197389602661, -0.03296000137925148, 0 },
-    { -0.90160799026489258, 0.42991399765014648, -0.047242999076843262, 0 },
-    { -0.87908601760864258, 0.46494901180267334, 0.10483100265264511, 0 },
-    { -0.67064398527145386, 0.72319698333740234, 0.16492199897766113, 0 },
-    { -0.67162102460861206, 0.74007397890090942, -0.034058999270200729, 0 },
-    { 0.75634002685546875, 0.60582298040390015, -0.24680300056934357, 0 },
-    { 0.65034902095794678, 0.70622897148132324, -0.27964100241661072, 0 },
-    { 0.90942102670669556, 0.36539798974990845, -0.19846199452877045, 0 },
-    { 0.87139499187469482, 0.30021101236343384, -0.38792100548744202, 0 },
-    { 0.73711401224136353, 0.43943598866462708, -0.51332098245620728, 0 },
-    { 0.59950602054595947, 0.55464297533035278, -0.57698297500610352, 0 },
-    { -0.75634002685546875, 0.60582298040390015, -0.24680300056934357, 0 },
-    { -0.73711401224136353, 0.43943598866462708, -0.51332098245620728, 0 },
-    { -0.87139499187469482, 0.30021101236343384, -0.38792100548744202, 0 },
-    { -0.90942102670669556, 0.36539798974990845, -0.19846199452877045, 0 },
-    { -0.65034902095794678, 0.70622897148132324, -0.27964100241661072, 0 },
-    { -0.59950602054595947, 0.55464297533035278, -0.57698297500610352, 0 },
-    { 0.70042997598648071, 0.20789200067520142, -0.68273001909255981, 0 },
-    { 0.86355197429656982, 0.16305999457836151, -0.47709599137306213, 0 },
-    { 0.68639200925827026, 0.052278000861406326, -0.72533297538757324, 0 },
-    { 0.64589399099349976, -0.041200000792741776, -0.76226097345352173, 0 },
-    { 0.58146899938583374, 0.013855000026524067, -0.81344002485275269, 0 },
-    { 0.58192700147628784, 0.30500200390815735, -0.75383800268173218, 0 },
-    { -0.70042997598648071, 0.20789200067520142, -0.68273001909255981, 0 },
-    { -0.58192700147628784, 0.30500200390815735, -0.75383800268173218, 0 },
-    { -0.58146899938583374, 0.013855000026524067, -0.81344002485275269, 0 },
-    { -0.64589399099349976, -0.041200000792741776, -0.76226097345352173, 0 },
-    { -0.68639200925827026, 0.052278000861406326, -0.72533297538757324, 0 },
-    { -0.86355197429656982, 0.16305999457836151, -0.47709599137306213, 0 },
-    { 0.48753300309181213, 0.42973101139068604, -0.7600020170211792, 0 },
-    { 0.51493901014328003, 0.11865600198507309, -0.84893298149108887, 0 },
-    { 0.49439999461174011, 0.66792798042297363, -0.55623000860214233, 0 },
-    { -0.48753300309181213, 0.42973101139068604, -0.7600020170211792, 0 },
-    { -0.49439999461174011, 0.66792798042297363, -0.55623000860214233, 0 },
-    { -0.51493901014328003, 0.11865600198507309, -0.84893298149108887, 0 },
-    { 0.54600697755813599, 0.79784500598907471, -0.25553101301193237, 0 },
-    { 0.58705401420593262, 0.80950301885604858, -0.0072019998915493488, 0 },
-    { -0.54600697755813599, 0.79784500598907471, -0.25553101301193237, 0 },
-    { -0.58705401420593262, 0.80950301885604858, -0.0072019998915493488, 0 },
-    { 0.61751198768615723, 0.75988000631332397, 0.20306999981403351, 0 },
-    { 0.63621902465820312, 0.63508999347686768, 0.43800199031829834, 0 },
-    { -0.61751198768615723, 0.75988000631332397, 0.20306999981403351, 0 },
-    { -0.63621902465820312, 0.63508999347686768, 0.43800199031829834, 0 },
-    { 0.61540597677230835, 0.55262899398803711, 0.56199800968170166, 0 },
-    { 0.4334850013256073, 0.60411399602890015, 0.66863000392913818, 0 },
-    { 0.37098300457000732, 0.74578100442886353, 0.55326998233795166, 0 },
-    { 0.53840798139572144, 0.7296370267868042, 0.42155200242996216, 0 },
-    { -0.61540597677230835, 0.55262899398803711, 0.56199800968170166, 0 },
-    { -0.53840798139572144, 0.7296370267868042, 0.42155200242996216, 0 },
-    { -0.37098300457000732, 0.74578100442886353, 0.55326998233795166, 0 },
-    { -0.4334850013256073, 0.60411399602890015, 0.66863000392913818, 0 },
-    { 0.37656798958778381, 0.92626702785491943, 0.014100000262260437, 0 },
-    { 0.18240900337696075, 0.98187202215194702, 0.051424000412225723, 0 },
-    { -0.37656798958778381, 0.92626702785491943, 0.014100000262260437, 0 },
-    { -0.18240900337696075, 0.98187202215194702, 0.051424000412225723, 0 },
-    { 0.20905199646949768, 0.6577649712562561, 0.72359400987625122, 0 },
-    { 0, 0.68251597881317139, 0.7308269739151001, 0 },
-    { 0, 0.6108890175819397, 0.79168099164962769, 0 },
-    { 0.19376200437545776, 0.70070499181747437, 0.68660497665405273, 0 },
-    { -0.20905199646949768, 0.6577649712562561, 0.72359400987625122, 0 },
-    { -0.19376200437545776, 0.70070499181747437, 0.68660497665405273, 0 },
-    { -0.20795300602912903, 0.34113600850105286, -0.91668397188186646, 0 },
-    { -0.19855299592018127, 0.77574998140335083, -0.59892600774765015, 0 },
-    { 0.20795300602912903, 0.34113600850105286, -0.91668397188186646, 0 },
-    { 0.19855299592018127, 0.77574998140335083, -0.59892600774765015, 0 },
-    { 0.028169000521302223, 0.93655198812484741, 0.34931498765945435, 0 },
-    { -0.045198000967502594, 0.74138599634170532, 0.66951501369476318, 0 },
-    { -0.028169000521302223, 0.93655198812484741, 0.34931498765945435, 0 },
-    { 0.045198000967502594, 0.74138599634170532, 0.66951501369476318, 0 },
-    { -0.10321400314569473, 0.56584399938583374, 0.81798797845840454, 0 },
-    { 0, 0.51573199033737183, 0.85671597719192505, 0 },
-    { 0.10321400314569473, 0.56584399938583374, 0.81798797845840454, 0 },
-    { 0.9886469841003418, 0.14365099370479584, 0.043428000062704086, 0 },
-    { 0.96938997507095337, 0.15073099732398987, 0.19363999366760254, 0 },
-    { -0.9886469841003418, 0.14365099370479584, 0.043428000062704086, 0 },
-    { -0.96938997507095337, 0.15073099732398987, 0.19363999366760254, 0 },
-    { 0.96114999055862427, 0.14197200536727905, 0.23667100071907043, 0 },
-    { 0.99108898639678955, -0.11206399649381638, 0.071687996387481689, 0 },
-    { 0.9960939884185791, -0.087862998247146606, 0.0059819999150931835, 0 },
-    { 0.97293001413345337, 0.17850300669670105, 0.14670200645923615, 0 },
-    { -0.96114999055862427, 0.14197200536727905, 0.23667100071907043, 0 },
-    { -0.97293001413345337, 0.17850300669670105, 0.14670200645923615, 0 },
-    { -0.9960939884185791, -0.087862998247146606, 0.0059819999150931835, 0 },
-    { -0.99108898639678955, -0.11206399649381638, 0.071687996387481689, 0 },
-    { 0.97674500942230225, 0.21436199545860291, 0.00054899998940527439, 0 },
-    { 0.997344970703125, 0.067721001803874969, -0.026520999148488045, 0 },
-    { 0.86291098594665527, 0.48158198595046997, 0.15298900008201599, 0 },
-    { 0.97427302598953247, 0.20593899488449097, -0.091463997960090637, 0 },
-    { -0.97674500942230225, 0.21436199545860291, 0.00054899998940527439, 0 },
-    { -0.97427302598953247, 0.20593899488449097, -0.091463997960090637, 0 },
-    { -0.86291098594665527, 0.48158198595046997, 0.15298900008201599, 0 },
-    { -0.997344970703125, 0.067721001803874969, -0.026520999148488045, 0 },
-    { 0.95895302295684814, 0.17929600179195404, -0.21964199841022491, 0 },
-    { 0.65968799591064453, 0.63106197118759155, -0.40806299448013306, 0 },
-    { -0.95895302295684814, 0.17929600179195404, -0.21964199841022491, 0 },
-    { -0.65968799591064453, 0.63106197118759155, -0.40806299448013306, 0 },
-    { 0.63450998067855835, -0.77288097143173218, -0.0025939999613910913, 0 },
-    { 0.67747998237609863, -0.72798901796340942, 0.10492300242185593, 0 },
-    { 0.61189597845077515, -0.77510899305343628, -0.15723100304603577, 0 },
-    { 0.55223202705383301, -0.81719398498535156, -0.16486099362373352, 0 },
-    { 0.55452102422714233, -0.83181297779083252, 0.023713000118732452, 0 },
-    { 0.57414501905441284, -0.80382698774337769, 0.15549199283123016, 0 },
-    { -0.63450998067855835, -0.77288097143173218, -0.0025939999613910913, 0 },
-    { -0.55452102422714233, -0.83181297779083252, 0.023713000118732452, 0 },
-    { -0.55223202705383301, -0.81719398498535156, -0.16486099362373352, 0 },
-    { -0.61189597845077515, -0.77510899305343628, -0.15723100304603577, 0 },
-    { -0.67747998237609863, -0.72798901796340942, 0.10492300242185593, 0 },
-    { -0.57414501905441284, -0.80382698774337769, 0.15549199283123016, 0 },
-    { 0.43156200647354126, -0.90066200494766235, 0.050020001828670502, 0 },
-    { 0.51451200246810913, -0.85372501611709595, 0.079957999289035797, 0 },
-    { 0.48457300662994385, -0.85937100648880005, 0.16309100389480591, 0 },
-    { 0.3726620078086853, -0.91286998987197876, -0.16666199266910553, 0 },
-    { 0.22064900398254395, -0.97531098127365112, -0.0088809998705983162, 0 },
-    { -0.43156200647354126, -0.90066200494766235, 0.050020001828670502, 0 },
-    { -0.3726620078086853, -0.91286998987197876, -0.16666199266910553, 0 },
-    { -0.48457300662994385, -0.85937100648880005, 0.16309100389480591, 0 },
-    { -0.51451200246810913, -0.85372501611709595, 0.079957999289035797, 0 },
-    { -0.22064900398254395, -0.97531098127365112, -0.0088809998705983162, 0 },
-    { 0.5108489990234375, -0.83733600378036499, 0.19455499947071075, 0 },
-    { 0.5174720287322998, -0.83236199617385864, 0.19840100407600403, 0 },
-    { -0.5108489990234375, -0.83733600378036499, 0.19455499947071075, 0 },
-    { -0.5174720287322998, -0.83236199617385864, 0.19840100407600403, 0 },
-    { 0.6361280083656311, -0.72328901290893555, 0.26862400770187378, 0 },
-    { 0.53196799755096436, -0.73009401559829712, 0.42887699604034424, 0 },
-    { 0.69188499450683594, -0.69051200151443481, 0.21079100668430328, 0 },
-    { -0.6361280083656311, -0.72328901290893555, 0.26862400770187378, 0 },
-    { -0.69188499450683594, -0.69051200151443481, 0.21079100668430328, 0 },
-    { -0.53196799755096436, -0.73009401559829712, 0.42887699604034424, 0 },
-    { 0.71993201971054077, -0.67180401086807251, 0.17413899302482605, 0 },
-    { -0.71993201971054077, -0.67180401086807251, 0.17413899302482605, 0 },
-    { 0.4799950122833252, -0.70098000764846802, 0.52742099761962891, 0 },
-    { -0.4799950122833252, -0.70098000764846802, 0.52742099761962891, 0 },
-    { 0.55369699001312256, -0.31626299023628235, -0.77028697729110718, 0 },
-    { 0.53886497020721436, -0.29013898968696594, -0.79079598188400269, 0 },
-    { 0.33094298839569092, -0.6138799786567688, -0.71663600206375122, 0 },
-    { 0.43989399075508118, -0.60844802856445312, -0.66048198938369751, 0 },
-    { 0.56868201494216919, -0.53382998704910278, -0.62578201293945312, 0 },
-    { 0.55519300699234009, -0.28031298518180847, -0.78304398059844971, 0 },
-    { -0.55369699001312256, -0.31626299023628235, -0.77028697729110718, 0 },
-    { -0.55519300699234009, -0.28031298518180847, -0.78304398059844971, 0 },
-    { -0.56868201494216919, -0.53382998704910278, -0.62578201293945312, 0 },
-    { -0.43989399075508118, -0.60844802856445312, -0.66048198938369751, 0 },
-    { -0.33094298839569092, -0.6138799786567688, -0.71663600206375122, 0 },
-    { -0.53886497020721436, -0.29013898968696594, -0.79079598188400269, 0 },
-    { 0.50624102354049683, -0.19330400228500366, -0.84041899442672729, 0 },
-    { 0.51332098245620728, -0.36548998951911926, -0.77645200490951538, 0 },
-    { -0.50624102354049683, -0.19330400228500366, -0.84041899442672729, 0 },
-    { -0.51332098245620728, -0.36548998951911926, -0.77645200490951538, 0 },
-    { 0.35209199786186218, -0.82924902439117432, -0.43397301435470581, 0 },
-    { 0.12408799678087234, -0.8878139853477478, -0.44312900304794312, 0 },
-    { 0.56065601110458374, -0.74071502685546875, -0.37006700038909912, 0 },
-    { -0.35209199786186218, -0.82924902439117432, -0.43397301435470581, 0 },
-    { -0.56065601110458374, -0.74071502685546875, -0.37006700038909912, 0 },
-    { -0.12408799678087234, -0.8878139853477478, -0.44312900304794312, 0 },
-    { 0.6129639744758606, -0.71773397922515869, -0.33030200004577637, 0 },
-    { 0.59166198968887329, -0.62550699710845947, -0.50856000185012817, 0 },
-    { -0.6129639744758606, -0.71773397922515869, -0.33030200004577637, 0 },
-    { -0.59166198968887329, -0.62550699710845947, -0.50856000185012817, 0 },
-    { 0.5217139720916748, -0.48704499006271362, -0.70039999485015869, 0 },
-    { -0.5217139720916748, -0.48704499006271362, -0.70039999485015869, 0 },
-    { 0.20947900414466858, 0.53413498401641846, 0.81899499893188477, 0 },
-    { 0.30948799848556519, 0.49757400155067444, 0.81029701232910156, 0 },
-    { -0.12863600254058838, 0.95867800712585449, 0.25367000699043274, 0 },
-    { -0.27787101268768311, 0.92034697532653809, 0.27512401342391968, 0 },
-    { -0.45185700058937073, 0.83068299293518066, 0.32517498731613159, 0 },
-    { 0.052919000387191772, 0.48799100518226624, 0.87121200561523438, 0 },
-    { 0.51936399936676025, -0.14352899789810181, 0.84237200021743774, 0 },
-    { 0.58580297231674194, -0.1456339955329895, 0.79723501205444336, 0 },
-    { 0.56517201662063599, -0.21280600130558014, 0.79702097177505493, 0 },
-    { -0.20947900414466858, 0.53413498401641846, 0.81899499893188477, 0 },
-    { -0.58580297231674194, -0.1456339955329895, 0.79723501205444336, 0 },
-    { -0.51936399936676025, -0.14352899789810181, 0.84237200021743774, 0 },
-    { -0.052919000387191772, 0.48799100518226624, 0.87121200561523438, 0 },
-    { 0.45185700058937073, 0.83068299293518066, 0.32517498731613159, 0 },
-    { 0.27787101268768311, 0.92034697532653809, 0.27512401342391968, 0 },
-    { 0.12863600254058838, 0.95867800712585449, 0.25367000699043274, 0 },
-    { -0.30948799848556519, 0.49757400155067444, 0.81029701232910156, 0 },
-    { -0.56517201662063599, -0.21280600130558014, 0.79702097177505493, 0 },
-    { 0.36863300204277039, 0.42673999071121216, 0.82580000162124634, 0 },
-    { 0.08874800056219101, 0.95437502861022949, 0.28501200675964355, 0 },
-    { 0.47483700513839722, -0.2539139986038208, 0.84261602163314819, 0 },
-    { 0.28601899743080139, -0.22788199782371521, 0.93069201707839966, 0 },
-    { 0.41624200344085693, 0.31312000751495361, 0.85363298654556274, 0 },
-    { 0.43217301368713379, 0.83248400688171387, 0.34662899374961853, 0 },
-    { -0.36863300204277039, 0.42673999071121216, 0.82580000162124634, 0 },
-    { -0.41624200344085693, 0.31312000751495361, 0.85363298654556274, 0 },
-    { -0.28601899743080139, -0.22788199782371521, 0.93069201707839966, 0 },
-    { -0.47483700513839722, -0.2539139986038208, 0.84261602163314819, 0 },
-    { -0.08874800056219101, 0.95437502861022949, 0.28501200675964355, 0 },
-    { -0.43217301368713379, 0.83248400688171387, 0.34662899374961853, 0 },
-    { 0.38489899039268494, 0.14239899814128876, 0.91189301013946533, 0 },
-    { 0.71925997734069824, 0.47242701053619385, 0.50932300090789795, 0 },
-    { 0.015687000006437302, -0.15820799767971039, 0.98727399110794067, 0 },
-    { -0.15881800651550293, -0.063173003494739532, 0.985260009765625, 0 },
-    { 0.33094298839569092, 0.0094299996271729469, 0.94357097148895264, 0 },
-    { 0.7629929780960083, 0.1056860014796257, 0.63768398761749268, 0 },
-    { -0.38489899039268494, 0.14239899814128876, 0.91189301013946533, 0 },
-    { -0.33094298839569092, 0.0094299996271729469, 0.94357097148895264, 0 },
-    { 0.15881800651550293, -0.063173003494739532, 0.985260009765625, 0 },
-    { -0.015687000006437302, -0.15820799767971039, 0.98727399110794067, 0 },
-    { -0.71925997734069824, 0.47242701053619385, 0.50932300090789795, 0 },
-    { -0.7629929780960083, 0.1056860014796257, 0.63768398761749268, 0 },
-    { 0.33591699600219727, -0.072847999632358551, 0.93905502557754517, 0 },
-    { 0.73589301109313965, -0.19205300509929657, 0.64925098419189453, 0 },
-    { -0.2099979966878891, 0.093935996294021606, 0.97314399480819702, 0 },
-    { -0.082521997392177582, 0.33097299933433533, 0.94000101089477539, 0 },
-    { 0.41438001394271851, -0.11313199996948242, 0.9030119776725769, 0 },
-    { 0.69911801815032959, -0.4512769877910614, 0.55458199977874756, 0 },
-    { -0.33591699600219727, -0.072847999632358551, 0.93905502557754517, 0 },
-    { -0.41438001394271851, -0.11313199996948242, 0.9030119776725769, 0 },
-    { 0.082521997392177582, 0.33097299933433533, 0.94000101089477539, 0 },
-    { 0.2099979966878891, 0.093935996294021606, 0.97314399480819702, 0 },
-    { -0.73589301109313965, -0.19205300509929657, 0.64925098419189453, 0 },
-    { -0.69911801815032959, -0.4512769877910614, 0.55458199977874756, 0 },
-    { 0.52091997861862183, -0.19736300408840179, 0.83043897151947021, 0 },
-    { 0.60591399669647217, -0.67668700218200684, 0.41822600364685059, 0 },
-    { 0.18253099918365479, 0.44068700075149536, 0.87887197732925415, 0 },
-    { 0.45322999358177185, 0.33762601017951965, 0.82494598627090454, 0 },
-    { 0.59291398525238037, -0.34171599149703979, 0.72914797067642212, 0 },
-    { 0.47321999073028564, -0.82491499185562134, 0.3091219961643219, 0 },
-    { -0.52091997861862183, -0.19736300408840179, 0.83043897151947021, 0 },
-    { -0.59291398525238037, -0.34171599149703979, 0.72914797067642212, 0 },
-    { -0.45322999358177185, 0.33762601017951965, 0.82494598627090454, 0 },
-    { -0.18253099918365479, 0.44068700075149536, 0.87887197732925415, 0 },
-    { -0.60591399669647217, -0.67668700218200684, 0.41822600364685059, 0 },
-    { -0.47321999073028564, -0.82491499185562134, 0.3091219961643219, 0 },
-    { 0.53978097438812256, -0.44795098900794983, 0.71269899606704712, 0 },
-    { 0.31833899021148682, -0.90505701303482056, 0.28196099400520325, 0 },
-    { 0.54869198799133301, 0.20230700075626373, 0.81115102767944336, 0 },
-    { 0.35865399241447449, 0.32651799917221069, 0.87447702884674072, 0 },
-    { 0.26517501473426819, -0.35288599133491516, 0.89727497100830078, 0 },
-    { 0.067537002265453339, -0.93438500165939331, 0.34977298974990845, 0 },
-    { -0.53978097438812256, -0.44795098900794983, 0.71269899606704712, 0 },
-    { -0.26517501473426819, -0.35288599133491516, 0.89727497100830078, 0 },
-    { -0.35865399241447449, 0.32651799917221069, 0.87447702884674072, 0 },
-    { -0.54869198799133301, 0.20230700075626373, 0.81115102767944336, 0 },
-    { -0.31833899021148682, -0.90505701303482056, 0.28196099400520325, 0 },
-    { -0.067537002265453339, -0.93438500165939331, 0.34977298974990845, 0 },
-    { 0.36362800002098083, 0.68346202373504639, 0.63292300701141357, 0 },
-    { 0.12723200023174286, 0.79552602767944336, 0.59236401319503784, 0 },
-    { -0.15097500383853912, 0.94982802867889404, 0.27381199598312378, 0 },
-    { 0.12430199980735779, 0.92284899950027466, 0.36448299884796143, 0 },
-    { 0.14892999827861786, 0.91393798589706421, 0.37745299935340881, 0 },
-    { 0.28891900181770325, 0.72243398427963257, 0.62813198566436768, 0 },
-    { -0.36362800002098083, 0.68346202373504639, 0.63292300701141357, 0 },
-    { -0.28891900181770325, 0.72243398427963257, 0.62813198566436768, 0 },
-    { -0.14892999827861786, 0.91393798589706421, 0.37745299935340881, 0 },
-    { -0.12430199980735779, 0.92284899950027466, 0.36448299884796143, 0 },
-    { 0.15097500383853912, 0.94982802867889404, 0.27381199598312378, 0 },
-    { -0.12723200023174286, 0.79552602767944336, 0.59236401319503784, 0 },
-    { -0.23444299399852753, 0.79924899339675903, 0.55336201190948486, 0 },
-    { -0.57429701089859009, 0.6104310154914856, 0.54545700550079346, 0 },
-    { -0.7795950174331665, 0.62593501806259155, 0.019867999479174614, 0 },
-    { -0.48649600148200989, 0.86049997806549072, 0.15100599825382233, 0 },
-    { 0.23444299399852753, 0.79924899339675903, 0.55336201190948486, 0 },
-    { 0.48649600148200989, 0.86049997806549072, 0.15100599825382233, 0 },
-    { 0.7795950174331665, 0.62593501806259155, 0.019867999479174614, 0 },
-    { 0.57429701089859009, 0.6104310154914856, 0.54545700550079346, 0 },
-    { -0.76989001035690308, 0.26386299729347229, 0.58104199171066284, 0 },
-    { -0.70461100339889526, -0.087862998247146606, 0.70409297943115234, 0 },
-    { -0.99029499292373657, -0.073579996824264526, 0.11773999780416489, 0 },
-    { -0.95263499021530151, 0.30359798669815063, -0.01648000068962574, 0 },
-    { 0.76989001035690308, 0.26386299729347229, 0.58104199171066284, 0 },
-    { 0.95263499021530151, 0.30359798669815063, -0.01648000068962574, 0 },
-    { 0.99029499292373657, -0.073579996824264526, 0.11773999780416489, 0 },
-    { 0.70461100339889526, -0.087862998247146606, 0.70409297943115234, 0 },
-    { -0.38776800036430359, -0.37684300541877747, 0.84115099906921387, 0 },
-    { 0.10028400272130966, -0.52864199876785278, 0.84285998344421387, 0 },
-    { -0.09482099860906601, -0.75722497701644897, 0.64616799354553223, 0 },
-    { -0.7387310266494751, -0.52546799182891846, 0.42207100987434387, 0 },
-    { 0.38776800036430359, -0.37684300541877747, 0.84115099906921387, 0 },
-    { 0.7387310266494751, -0.52546799182891846, 0.42207100987434387, 0 },
-    { 0.09482099860906601, -0.75722497701644897, 0.64616799354553223, 0 },
-    { -0.10028400272130966, -0.52864199876785278, 0.84285998344421387, 0 },
-    { 0.42243701219558716, -0.54237502813339233, 0.72615700960159302, 0 },
-    { 0.56941401958465576, -0.5030670166015625, 0.65010499954223633, 0 },
-    { 0.52919101715087891, -0.65361499786376953, 0.54100197553634644, 0 },
-    { 0.34604901075363159, -0.71852797269821167, 0.60325902700424194, 0 },
-    { -0.42243701219558716, -0.54237502813339233, 0.72615700960159302, 0 },
-    { -0.34604901075363159, -0.71852797269821167, 0.60325902700424194, 0 },
-    { -0.52919101715087891, -0.65361499786376953, 0.54100197553634644, 0 },
-    { -0.56941401958465576, -0.5030670166015625, 0.65010499954223633, 0 },
-    { 0.65440797805786133, -0.43858098983764648, 0.61589401960372925, 0 },
-    { 0.65227198600769043, -0.40461400151252747, 0.640919029712677, 0 },
-    { 0.69560801982879639, -0.53157097101211548, 0.48326098918914795, 0 },
-    { 0.64778602123260498, -0.57850897312164307, 0.49562099575996399, 0 },
-    { -0.65440797805786133, -0.43858098983764648, 0.61589401960372925, 0 },
-    { -0.64778602123260498, -0.57850897312164307, 0.49562099575996399, 0 },
-    { -0.69560801982879639, -0.53157097101211548, 0.48326098918914795, 0 },
-    { -0.65227198600769043, -0.40461400151252747, 0.640919029712677, 0 },
-    { 0.7360759973526001, -0.67391002178192139, 0.063051000237464905, 0 },
-    { 0.84496599435806274, -0.53453201055526733, -0.016541000455617905, 0 },
-    { 0.46598699688911438, -0.65981000661849976, 0.58946502208709717, 0 },
-    { 0.71907699108123779, 0.18454499542713165, 0.66994202136993408, 0 },
-    { 0.9056059718132019, -0.42033100128173828, 0.056154001504182816, 0 },
-    { 0.9065520167350769, -0.40345498919487, -0.1239050030708313, 0 },
-    { -0.7360759973526001, -0.67391002178192139, 0.063051000237464905, 0 },
-    { -0.9056059718132019, -0.42033100128173828, 0.056154001504182816, 0 },
-    { -0.71907699108123779, 0.18454499542713165, 0.66994202136993408, 0 },
-    { -0.46598699688911438, -0.65981000661849976, 0.58946502208709717, 0 },
-    { -0.84496599435806274, -0.53453201055526733, -0.016541000455617905, 0 },
-    { -0.9065520167350769, -0.40345498919487, -0.1239050030708313, 0 },
-    { 0.072939001023769379, -0.28064799308776855, 0.95702999830245972, 0 },
-    { -0.086459003388881683, -0.93530100584030151, 0.34308901429176331, 0 },
-    { 0.18070000410079956, 0.50614899396896362, 0.84328699111938477, 0 },
-    { -0.072939001023769379, -0.28064799308776855, 0.95702999830245972, 0 },
-    { -0.18070000410079956, 0.50614899396896362, 0.84328699111938477, 0 },
-    { 0.086459003388881683, -0.93530100584030151, 0.34308901429176331, 0 },
-    { 0.93707102537155151, -0.34760600328445435, -0.032166998833417892, 0 },
-    { 0.93707102537155151, -0.33313998579978943, -0.10431200265884399, 0 },
-    { -0.93707102537155151, -0.34760600328445435, -0.032166998833417892, 0 },
-    { -0.93707102537155151, -0.33313998579978943, -0.10431200265884399, 0 },
-    { 0.19675299525260925, 0.37507200241088867, 0.90584999322891235, 0 },
-    { -0.32105499505996704, 0.8934599757194519, 0.31397399306297302, 0 },
-    { 0.83815997838973999, 0.062501996755599976, 0.54179501533508301, 0 },
-    { 0.69258701801300049, -0.28745400905609131, 0.66154998540878296, 0 },
-    { 0.5004119873046875, -0.21210399270057678, 0.83938097953796387, 0 },
-    { -0.19675299525260925, 0.37507200241088867, 0.90584999322891235, 0 },
-    { -0.5004119873046875, -0.21210399270057678, 0.83938097953796387, 0 },
-    { -0.69258701801300049, -0.28745400905609131, 0.66154998540878296, 0 },
-    { -0.83815997838973999, 0.062501996755599976, 0.54179501533508301, 0 },
-    { 0.32105499505996704, 0.8934599757194519, 0.31397399306297302, 0 },
-    { 0.17023199796676636, 0.84011399745941162, 0.51496899127960205, 0 },
-    { 0.10138200223445892, 0.95495498180389404, 0.27881699800491333, 0 },
-    { 0.5165259838104248, 0.73461097478866577, 0.43992400169372559, 0 },
-    { 0.48249799013137817, 0.64204800128936768, 0.59575200080871582, 0 },
-    { -0.17023199796676636, 0.84011399745941162, 0.51496899127960205, 0 },
-    { -0.48249799013137817, 0.64204800128936768, 0.59575200080871582, 0 },
-    { -0.5165259838104248, 0.73461097478866577, 0.43992400169372559, 0 },
-    { -0.10138200223445892, 0.95495498180389404, 0.27881699800491333, 0 },
-    { 0.70137602090835571, 0.17615300416946411, 0.69066399335861206, 0 },
-    { 0.80800801515579224, 0.00030499999411404133, 0.58912897109985352, 0 },
-    { 0.76628899574279785, -0.015838999301195145, 0.64226198196411133, 0 },
-    { 0.69045102596282959, 0.1374250054359436, 0.71016597747802734, 0 },
-    { 0.93047899007797241, -0.14322300255298615, 0.33713799715042114, 0 },
-    { 0.87929898500442505, 0.032074999064207077, 0.47511199116706848, 0 },
-    { -0.70137602090835571, 0.17615300416946411, 0.69066399335861206, 0 },
-    { -0.87929898500442505, 0.032074999064207077, 0.47511199116706848, 0 },
-    { -0.93047899007797241, -0.14322300255298615, 0.33713799715042114, 0 },
-    { -0.69045102596282959, 0.1374250054359436, 0.71016597747802734, 0 },
-    { -0.76628899574279785, -0.015838999301195145, 0.64226198196411133, 0 },
-    { -0.80800801515579224, 0.00030499999411404133, 0.58912897109985352, 0 },
-    { 0.63457101583480835, 0.39085099101066589, 0.66670697927474976, 0 },
-    { 0.59804099798202515, 0.63100099563598633, 0.49409499764442444, 0 },
-    { 0.92348998785018921, 0.029298000037670135, 0.38242700695991516, 0 },
-    { 0.89550501108169556, 0.0038759999442845583, 0.44502100348472595, 0 },
-    { 0.69774502515792847, 0.36133900284767151, 0.61848801374435425, 0 },
-    { 0.56736999750137329, 0.64622902870178223, 0.51029998064041138, 0 },
-    { -0.63457101583480835, 0.39085099101066589, 0.66670697927474976, 0 },
-    { -0.69774502515792847, 0.36133900284767151, 0.61848801374435425, 0 },
-    { -0.89550501108169556, 0.0038759999442845583, 0.44502100348472595, 0 },
-    { -0.92348998785018921, 0.029298000037670135, 0.38242700695991516, 0 },
-    { -0.59804099798202515, 0.63100099563598633, 0.49409499764442444, 0 },
-    { -0.56736999750137329, 0.64622902870178223, 0.51029998064041138, 0 },
-    { 0.85927897691726685, -0.42860201001167297, 0.279121994972229, 0 },
-    { 0.79900497198104858, -0.53794997930526733, 0.2686539888381958, 0 },
-    { 0.72426497936248779, -0.57435798645019531, 0.38148099184036255, 0 },
-    { 0.76873099803924561, -0.47184699773788452, 0.4316839873790741, 0 },
-    { 0.88506698608398438, -0.40861201286315918, 0.22275499999523163, 0 },
-    { 0.91268700361251831, -0.39054501056671143, 0.119998998939991, 0 },
-    { -0.85927897691726685, -0.42860201001167297, 0.279121994972229, 0 },
-    { -0.91268700361251831, -0.39054501056671143, 0.119998998939991, 0 },
-    { -0.88506698608398438, -0.40861201286315918, 0.22275499999523163, 0 },
-    { -0.76873099803924561, -0.47184699773788452, 0.4316839873790741, 0 },
-    { -0.72426497936248779, -0.57435798645019531, 0.38148099184036255, 0 },
-    { -0.79900497198104858, -0.53794997930526733, 0.2686539888381958, 0 },
-    { 0.69069498777389526, -0.43061599135398865, 0.58091998100280762, 0 },
-    { 0.61864101886749268, -0.4082770049571991, 0.67119401693344116, 0 },
-    { 0.84579002857208252, -0.35026100277900696, 0.40238699316978455, 0 },
-    { 0.69872099161148071, -0.53898698091506958, 0.47035101056098938, 0 },
-    { 0.68926101922988892, -0.52122598886489868, 0.50315898656845093, 0 },
-    { -0.69069498777389526, -0.43061599135398865, 0.58091998100280762, 0 },
-    { -0.69872099161148071, -0.53898698091506958, 0.47035101056098938, 0 },
-    { -0.84579002857208252, -0.35026100277900696, 0.40238699316978455, 0 },
-    { -0.61864101886749268, -0.4082770049571991, 0.67119401693344116, 0 },
-    { -0.68926101922988892, -0.52122598886489868, 0.50315898656845093, 0 },
-    { 0.60753202438354492, -0.40528601408004761, 0.68309599161148071, 0 },
-    { 0.69420498609542847, -0.5200049877166748, 0.49763500690460205, 0 },
-    { -0.60753202438354492, -0.40528601408004761, 0.68309599161148071, 0 },
-    { -0.69420498609542847, -0.5200049877166748, 0.49763500690460205, 0 },
-    { 0.98205500841140747, -0.14758799970149994, 0.11728300154209137, 0 },
-    { 0.95272701978683472, -0.30375099182128906, 0.0021059999708086252, 0 },
-    { -0.98205500841140747, -0.14758799970149994, 0.11728300154209137, 0 },
-    { -0.95272701978683472, -0.30375099182128906, 0.0021059999708086252, 0 },
-    { 0.92632800340652466, -0.37269198894500732, -0.054414998739957809, 0 },
-    { 0.94198399782180786, -0.33256000280380249, -0.044923000037670135, 0 },
-    { -0.92632800340652466, -0.37269198894500732, -0.054414998739957809, 0 },
-    { -0.94198399782180786, -0.33256000280380249, -0.044923000037670135, 0 },
-    { 0.97756898403167725, -0.18292799592018127, 0.10406800359487534, 0 },
-    { -0.97756898403167725, -0.18292799592018127, 0.10406800359487534, 0 },
-    { 0.70799899101257324, -0.54951602220535278, 0.44352498650550842, 0 },
-    { 0.69087797403335571, -0.54481601715087891, 0.47517299652099609, 0 },
-    { 0.71477401256561279, -0.55522298812866211, 0.42518401145935059, 0 },
-    { 0.58488702774047852, -0.37592700123786926, 0.71868002414703369, 0 },
-    { 0.60963797569274902, -0.3469339907169342, 0.71269899606704712, 0 },
-    { 0.61934298276901245, -0.28110599517822266, 0.7330549955368042, 0 },
-    { -0.70799899101257324, -0.54951602220535278, 0.44352498650550842, 0 },
-    { -0.60963797569274902, -0.3469339907169342, 0.71269899606704712, 0 },
-    { -0.58488702774047852, -0.37592700123786926, 0.71868002414703369, 0 },
-    { -0.71477401256561279, -0.55522298812866211, 0.42518401145935059, 0 },
-    { -0.69087797403335571, -0.54481601715087891, 0.47517299652099609, 0 },
-    { -0.61934298276901245, -0.28110599517822266, 0.7330549955368042, 0 },
-    { 0.70580202341079712, -0.57203900814056396, 0.4178290069103241, 0 },
-    { 0.68724602460861206, -0.60731798410415649, 0.39854100346565247, 0 },
-    { 0.4756610095500946, -0.40800198912620544, 0.77925997972488403, 0 },
-    { 0.53602701425552368, -0.39213201403617859, 0.74758100509643555, 0 },
-    { -0.70580202341079712, -0.57203900814056396, 0.4178290069103241, 0 },
-    { -0.53602701425552368, -0.39213201403617859, 0.74758100509643555, 0 },
-    { -0.4756610095500946, -0.40800198912620544, 0.77925997972488403, 0 },
-    { -0.68724602460861206, -0.60731798410415649, 0.39854100346565247, 0 },
-    { 0.73058301210403442, -0.57042098045349121, 0.3752250075340271, 0 },
-    { 0.88537198305130005, 0.034120000898838043, 0.46357598900794983, 0 },
-    { 0.6195870041847229, -0.055605001747608185, 0.78292202949523926, 0 },
-    { 0.49729898571968079, -0.34843000769615173, 0.79448801279067993, 0 },
-    { -0.73058301210403442, -0.57042098045349121, 0.3752250075340271, 0 },
-    { -0.49729898571968079, -0.34843000769615173, 0.79448801279067993, 0 },
-    { -0.6195870041847229, -0.055605001747608185, 0.78292202949523926, 0 },
-    { -0.88537198305130005, 0.034120000898838043, 0.46357598900794983, 0 },
-    { 0.57026898860931396, 0.67943400144577026, 0.46162301301956177, 0 },
-    { 0.59041100740432739, 0.66716498136520386, 0.45414599776268005, 0 },
-    { 0.42207100987434387, 0.39078998565673828, 0.81798797845840454, 0 },
-    { 0.42884600162506104, 0.39945700764656067, 0.81020498275756836, 0 },
-    { -0.57026898860931396, 0.67943400144577026, 0.46162301301956177, 0 },
-    { -0.42884600162506104, 0.39945700764656067, 0.81020498275756836, 0 },
-    { -0.42207100987434387, 0.39078998565673828, 0.81798797845840454, 0 },
-    { -0.59041100740432739, 0.66716498136520386, 0.45414599776268005, 0 },
-    { 0.79561799764633179, 0.29981398582458496, 0.52635300159454346, 0 },
-    { 0.83925902843475342, -0.14047700166702271, 0.52522397041320801, 0 },
-    { 0.42616000771522522, 0.14133100211620331, 0.8935210108757019, 0 },
-    { 0.51231402158737183, 0.21814599633216858, 0.83062201738357544, 0 },
-    { -0.79561799764633179, 0.29981398582458496, 0.52635300159454346, 0 },
-    { -0.51231402158737183, 0.21814599633216858, 0.83062201738357544, 0 },
-    { -0.42616000771522522, 0.14133100211620331, 0.8935210108757019, 0 },
-    { -0.83925902843475342, -0.14047700166702271, 0.52522397041320801, 0 },
-    { 0.81167000532150269, -0.029968999326229095, 0.58329999446868896, 0 },
-    { 0.56993299722671509, 0.67162102460861206, 0.47331199049949646, 0 },
-    { 0.19614200294017792, 0.75115197896957397, 0.63029897212982178, 0 },
-    { 0.40104401111602783, 0.30323201417922974, 0.86440598964691162, 0 },
-    { -0.81167000532150269, -0.029968999326229095, 0.58329999446868896, 0 },
-    { -0.40104401111602783, 0.30323201417922974, 0.86440598964691162, 0 },
-    { -0.19614200294017792, 0.75115197896957397, 0.63029897212982178, 0 },
-    { -0.56993299722671509, 0.67162102460861206, 0.47331199049949646, 0 },
-    { 0.020385999232530594, 0.96984797716140747, 0.24274399876594543, 0 },
-    { 0.047304000705480576, 0.95178097486495972, 0.30307900905609131, 0 },
-    { 0.11560399830341339, 0.78118199110031128, 0.6134529709815979, 0 },
-    { -0.12747600674629211, 0.86944198608398438, 0.47724801301956177, 0 },
-    { -0.020385999232530594, 0.96984797716140747, 0.24274399876594543, 0 },
-    { 0.12747600674629211, 0.86944198608398438, 0.47724801301956177, 0 },
-    { -0.11560399830341339, 0.78118199110031128, 0.6134529709815979, 0 },
-    { -0.047304000705480576, 0.95178097486495972, 0.30307900905609131, 0 },
-    { 0.63841700553894043, -0.56422597169876099, 0.5234839916229248, 0 },
-    { 0.52250701189041138, -0.63463199138641357, 0.56935298442840576, 0 },
-    { 0.59318798780441284, -0.20071999728679657, 0.77962601184844971, 0 },
-    { 0.52717697620391846, -0.18585799634456635, 0.82915699481964111, 0 },
-    { -0.63841700553894043, -0.56422597169876099, 0.5234839916229248, 0 },
-    { -0.59318798780441284, -0.20071999728679657, 0.77962601184844971, 0 },
-    { -0.52250701189041138, -0.63463199138641357, 0.56935298442840576, 0 },
-    { -0.52717697620391846, -0.18585799634456635, 0.82915699481964111, 0 },
-    { 0.31104499101638794, -0.73812097311019897, 0.59862101078033447, 0 },
-    { -0.18137100338935852, -0.7564929723739624, 0.6282849907875061, 0 },
-    { 0.39960899949073792, -0.22736300528049469, 0.88802802562713623, 0 },
-    { 0.22159500420093536, -0.20822800695896149, 0.95263499021530151, 0 },
-    { -0.31104499101638794, -0.73812097311019897, 0.59862101078033447, 0 },
-    { -0.39960899949073792, -0.22736300528049469, 0.88802802562713623, 0 },
-    { 0.18137100338935852, -0.7564929723739624, 0.6282849907875061, 0 },
-    { -0.22159500420093536, -0.20822800695896149, 0.95263499021530151, 0 },
-    { -0.68276000022888184, -0.47337299585342407, 0.55653601884841919, 0 },
-    { -0.89236098527908325, -0.070894002914428711, 0.44569200277328491, 0 },
-    { 0.053925998508930206, -0.077455997467041016, 0.99551397562026978, 0 },
-    { 0.0085450001060962677, 0.006622999906539917, 0.99993902444839478, 0 },
-    { 0.68276000022888184, -0.47337299585342407, 0.55653601884841919, 0 },
-    { -0.053925998508930206, -0.077455997467041016, 0.99551397562026978, 0 },
-    { 0.89236098527908325, -0.070894002914428711, 0.44569200277328491, 0 },
-    { -0.0085450001060962677, 0.006622999906539917, 0.99993902444839478, 0 },
-    { -0.8461260199546814, 0.29664000868797302, 0.44273200631141663, 0 },
-    { -0.63020700216293335, 0.62117397785186768, 0.46577298641204834, 0 },
-    { 0.063662000000476837, 0.051056999713182449, 0.99664300680160522, 0 },
-    { 0.14233799278736115, 0.14392499625682831, 0.97927802801132202, 0 },
-    { 0.8461260199546814, 0.29664000868797302, 0.44273200631141663, 0 },
-    { -0.063662000000476837, 0.051056999713182449, 0.99664300680160522, 0 },
-    { 0.63020700216293335, 0.62117397785186768, 0.46577298641204834, 0 },
-    { -0.14233799278736115, 0.14392499625682831, 0.97927802801132202, 0 },
-    { -0.33030200004577637, 0.83080500364303589, 0.4478900134563446, 0 },
-    { -0.041535999625921249, 0.91073298454284668, 0.41084000468254089, 0 },
-    { 0.25037398934364319, 0.26056700944900513, 0.93240100145339966, 0 },
-    { 0.38074898719787598, 0.39204099774360657, 0.83742797374725342, 0 },
-    { 0.33030200004577637, 0.83080500364303589, 0.4478900134563446, 0 },
-    { -0.25037398934364319, 0.26056700944900513, 0.93240100145339966, 0 },
-    { 0.041535999625921249, 0.91073298454284668, 0.41084000468254089, 0 },
-    { -0.38074898719787598, 0.39204099774360657, 0.83742797374725342, 0 },
-    { 0.11529900133609772, 0.92272698879241943, 0.36771801114082336, 0 },
-    { 0.43388199806213379, 0.5282750129699707, 0.72982001304626465, 0 },
-    { -0.11529900133609772, 0.92272698879241943, 0.36771801114082336, 0 },
-    { -0.43388199806213379, 0.5282750129699707, 0.72982001304626465, 0 },
-    { 0.19006900489330292, 0.10602100193500519, 0.97601199150085449, 0 },
-    { 0.18497300148010254, 0.080081000924110413, 0.97946101427078247, 0 },
-    { 0.071474000811576843, 0.27552101016044617, 0.95861697196960449, 0 },
-    { 0.25620299577713013, 0.1895810067653656, 0.94784402847290039, 0 },
-    { 0.22308999300003052, 0.083559997379779816, 0.97119098901748657, 0 },
-    { 0.20071999728679657, 0.0097049996256828308, 0.9795830249786377, 0 },
-    { -0.19006900489330292, 0.10602100193500519, 0.97601199150085449, 0 },
-    { -0.22308999300003052, 0.083559997379779816, 0.97119098901748657, 0 },
-    { -0.25620299577713013, 0.1895810067653656, 0.94784402847290039, 0 },
-    { -0.071474000811576843, 0.27552101016044617, 0.95861697196960449, 0 },
-    { -0.18497300148010254, 0.080081000924110413, 0.97946101427078247, 0 },
-    { -0.20071999728679657, 0.0097049996256828308, 0.9795830249786377, 0 },
-    { 0.33072900772094727, 0.049164999276399612, 0.94241201877593994, 0 },
-    { 0.28702700138092041, 0.00015300000086426735, 0.95788401365280151, 0 },
-    { 0.42698401212692261, 0.070040002465248108, 0.90151697397232056, 0 },
-    { 0.45872399210929871, -0.036988001316785812, 0.8877829909324646, 0 },
-    { 0.37379100918769836, -0.0010679999832063913, 0.92748802900314331, 0 },
-    { 0.3421739935874939, -0.0097350003197789192, 0.93957298994064331, 0 },
-    { -0.33072900772094727, 0.049164999276399612, 0.94241201877593994, 0 },
-    { -0.37379100918769836, -0.0010679999832063913, 0.92748802900314331, 0 },
-    { -0.45872399210929871, -0.036988001316785812, 0.8877829909324646, 0 },
-    { -0.42698401212692261, 0.070040002465248108, 0.90151697397232056, 0 },
-    { -0.28702700138092041, 0.00015300000086426735, 0.95788401365280151, 0 },
-    { -0.3421739935874939, -0.0097350003197789192, 0.93957298994064331, 0 },
-    { 0.35813501477241516, -0.030853999778628349, 0.93313401937484741, 0 },
-    { 0.35383200645446777, -0.002440999960526824, 0.93527001142501831, 0 },
-    { 0.42109400033950806, -0.11038500070571899, 0.90023499727249146, 0 },
-    { 0.38575398921966553, -0.16071000695228577, 0.90847498178482056, 0 },
-    { 0.30881699919700623, -0.040497999638319016, 0.95025497674942017, 0 },
-    { 0.31971201300621033, 0.044679000973701477, 0.94643998146057129, 0 },
-    { -0.35813501477241516, -0.030853999778628349, 0.93313401937484741, 0 },
-    { -0.30881699919700623, -0.040497999638319016, 0.95025497674942017, 0 },
-    { -0.38575398921966553, -0.16071000695228577, 0.90847498178482056, 0 },
-    { -0.42109400033950806, -0.11038500070571899, 0.90023499727249146, 0 },
-    { -0.35383200645446777, -0.002440999960526824, 0.93527001142501831, 0 },
-    { -0.31971201300621033, 0.044679000973701477, 0.94643998146057129, 0 },
-    { 0.3195900022983551, 0.01052900031208992, 0.94747799634933472, 0 },
-    { 0.30744299292564392, 0.16589899361133575, 0.93697899580001831, 0 },
-    { 0.41776800155639648, -0.13544100522994995, 0.89837300777435303, 0 },
-    { 0.49659699201583862, -0.014313000254333019, 0.8678550124168396, 0 },
-    { 0.43287500739097595, 0.1317179948091507, 0.8917509913444519, 0 },
-    { 0.37427899241447449, 0.30207198858261108, 0.87670499086380005, 0 },
-    { -0.3195900022983551, 0.01052900031208992, 0.94747799634933472, 0 },
-    { -0.43287500739097595, 0.1317179948091507, 0.8917509913444519, 0 },
-    { -0.49659699201583862, -0.014313000254333019, 0.8678550124168396, 0 },
-    { -0.41776800155639648, -0.13544100522994995, 0.89837300777435303, 0 },
-    { -0.30744299292564392, 0.16589899361133575, 0.93697899580001831, 0 },
-    { -0.37427899241447449, 0.30207198858261108, 0.87670499086380005, 0 },
-    { 0.40467500686645508, 0.17535899579524994, 0.89745801687240601, 0 },
-    { 0.3899959921836853, 0.31107500195503235, 0.86666500568389893, 0 },
-    { 0.43559101223945618, 0.013337000273168087, 0.9000210165977478, 0 },
-    { -0.40467500686645508, 0.17535899579524994, 0.89745801687240601, 0 },
-    { -0.43559101223945618, 0.013337000273168087, 0.9000210165977478, 0 },
-    { -0.3899959921836853, 0.31107500195503235, 0.86666500568389893, 0 },
-    { 0.43125700950622559, -0.077638998627662659, 0.89886200428009033, 0 },
-    { 0.38676100969314575, -0.10760799795389175, 0.91585999727249146, 0 },
-    { -0.43125700950622559, -0.077638998627662659, 0.89886200428009033, 0 },
-    { -0.38676100969314575, -0.10760799795389175, 0.91585999727249146, 0 },
-    { 0.31095299124717712, -0.11136200278997421, 0.94384598731994629, 0 },
-    { 0.22156399488449097, -0.1012599989771843, 0.96984797716140747, 0 },
-    { -0.31095299124717712, -0.11136200278997421, 0.94384598731994629, 0 },
-    { -0.22156399488449097, -0.1012599989771843, 0.96984797716140747, 0 },
-    { 0.209539994597435, -0.015351000241935253, 0.97766000032424927, 0 },
-    { -0.209539994597435, -0.015351000241935253, 0.97766000032424927, 0 },
-    { -0.088899999856948853, 0.54893600940704346, 0.83111101388931274, 0 },
-    { 0.22891899943351746, 0.39371898770332336, 0.89025497436523438, 0 },
-    { 0.088899999856948853, 0.54893600940704346, 0.83111101388931274, 0 },
-    { -0.22891899943351746, 0.39371898770332336, 0.89025497436523438, 0 },
-    { 0.51429802179336548, 0.13315199315547943, 0.84719401597976685, 0 },
-    { 0.52034097909927368, -0.017181999981403351, 0.85375499725341797, 0 },
-    { -0.51429802179336548, 0.13315199315547943, 0.84719401597976685, 0 },
-    { -0.52034097909927368, -0.017181999981403351, 0.85375499725341797, 0 },
-    { 0.45438998937606812, -0.12268400192260742, 0.88229000568389893, 0 },
-    { 0.44141998887062073, -0.17703799903392792, 0.87963497638702393, 0 },
-    { -0.45438998937606812, -0.12268400192260742, 0.88229000568389893, 0 },
-    { -0.44141998887062073, -0.17703799903392792, 0.87963497638702393, 0 },
-    { 0.48408499360084534, -0.14203299582004547, 0.86339902877807617, 0 },
-    { 0.52073699235916138, 0.011443999595940113, 0.85360300540924072, 0 },
-    { -0.48408499360084534, -0.14203299582004547, 0.86339902877807617, 0 },
-    { -0.52073699235916138, 0.011443999595940113, 0.85360300540924072, 0 },
-    { 0.4921410083770752, 0.20157499611377716, 0.84682798385620117, 0 },
-    { 0.423444002866745, 0.32493099570274353, 0.84563702344894409, 0 },
-    { -0.4921410083770752, 0.20157499611377716, 0.84682798385620117, 0 },
-    { -0.423444002866745, 0.32493099570274353, 0.84563702344894409, 0 },
-    { 0.39262101054191589, 0.35901999473571777, 0.84670597314834595, 0 },
-    { -0.39262101054191589, 0.35901999473571777, 0.84670597314834595, 0 },
-    { -0.026398999616503716, -0.93523997068405151, -0.35297700762748718, 0 },
-    { 0.13721099495887756, -0.90896302461624146, -0.39356699585914612, 0 },
-    { -0.098085999488830566, -0.94363200664520264, -0.3160800039768219, 0 },
-    { -0.18393500149250031, -0.53257900476455688, -0.82613599300384521, 0 },
-    { -0.34421798586845398, -0.43494999408721924, -0.83205699920654297, 0 },
-    { -0.22464700043201447, -0.41370901465415955, -0.88222897052764893, 0 },
-    { 0.026398999616503716, -0.93523997068405151, -0.35297700762748718, 0 },
-    { 0.34421798586845398, -0.43494999408721924, -0.83202600479125977, 0 },
-    { 0.18393500149250031, -0.53257900476455688, -0.82613599300384521, 0 },
-    { 0.098085999488830566, -0.94363200664520264, -0.3160800039768219, 0 },
-    { -0.13721099495887756, -0.90896302461624146, -0.39356699585914612, 0 },
-    { 0.22464700043201447, -0.41370901465415955, -0.88222897052764893, 0 },
-    { 0.42442101240158081, -0.83773297071456909, -0.34357699751853943, 0 },
-    { 0.73491597175598145, -0.65327900648117065, -0.18185999989509583, 0 },
-    { 0.031709000468254089, -0.41282400488853455, -0.91024500131607056, 0 },
-    { 0.4230479896068573, -0.38688299059867859, -0.81932997703552246, 0 },
-    { -0.42442101240158081, -0.83773297071456909, -0.34357699751853943, 0 },
-    { -0.031709000468254089, -0.41282400488853455, -0.91024500131607056, 0 },
-    { -0.73491597175598145, -0.65327900648117065, -0.18185999989509583, 0 },
-    { -0.4230479896068573, -0.38691401481628418, -0.81932997703552246, 0 },
-    { 0.95263499021530151, -0.29361900687217712, 0.078890003263950348, 0 },
-    { 0.98425197601318359, 0.13492199778556824, 0.11413899809122086, 0 },
-    { 0.76012498140335083, -0.17203299701213837, -0.6265450119972229, 0 },
-    { 0.93108898401260376, 0.10498400032520294, -0.34931498765945435, 0 },
-    { -0.95263499021530151, -0.29361900687217712, 0.078890003263950348, 0 },
-    { -0.76012498140335083, -0.17203299701213837, -0.6265450119972229, 0 },
-    { -0.98425197601318359, 0.13492199778556824, 0.11413899809122086, 0 },
-    { -0.93108898401260376, 0.10498400032520294, -0.34928399324417114, 0 },
-    { 0.79979902505874634, 0.57487702369689941, -0.17264300584793091, 0 },
-    { 0.29477798938751221, 0.85262602567672729, -0.43137899041175842, 0 },
-    { 0.62031900882720947, 0.32200101017951965, -0.71517097949981689, 0 },
-    { 0.097323998808860779, 0.41627201437950134, -0.90398901700973511, 0 },
-    { -0.79979902505874634, 0.57487702369689941, -0.17264300584793091, 0 },
-    { -0.62031900882720947, 0.32200101017951965, -0.71517097949981689, 0 },
-    { -0.29477798938751221, 0.85262602567672729, -0.43137899041175842, 0 },
-    { -0.097323998808860779, 0.41627201437950134, -0.90398901700973511, 0 },
-    { -0.18753600120544434, 0.85985898971557617, -0.4747759997844696, 0 },
-    { -0.40543800592422485, 0.80703097581863403, -0.42927300930023193, 0 },
-    { -0.27787101268768311, 0.34159401059150696, -0.8978239893913269, 0 },
-    { -0.43925300240516663, 0.32062700390815735, -0.83916699886322021, 0 },
-    { 0.18753600120544434, 0.85985898971557617, -0.4747759997844696, 0 },
-    { 0.27787101268768311, 0.34159401059150696, -0.8978239893913269, 0 },
-    { 0.40543800592422485, 0.80703097581863403, -0.42927300930023193, 0 },
-    { 0.43925300240516663, 0.32062700390815735, -0.83916699886322021, 0 },
-    { -0.50535601377487183, 0.78994101285934448, -0.34720900654792786, 0 },
-    { -0.59730798006057739, 0.7617110013961792, -0.25095400214195251, 0 },
-    { -0.51533597707748413, 0.34055599570274353, -0.78640097379684448, 0 },
-    { -0.45625200867652893, 0.4143500030040741, -0.78746902942657471, 0 },
-    { 0.50535601377487183, 0.78994101285934448, -0.34720900654792786, 0 },
-    { 0.51533597707748413, 0.34055599570274353, -0.78640097379684448, 0 },
-    { 0.59730798006057739, 0.7617110013961792, -0.25095400214195251, 0 },
-    { 0.45625200867652893, 0.4143500030040741, -0.78746902942657471, 0 },
-    { -0.43449199199676514, -0.022065000608563423, -0.90038800239562988, 0 },
-    { -0.3708299994468689, -0.02035599946975708, -0.92846500873565674, 0 },
-    { -0.14246000349521637, -0.078218996524810791, -0.98669397830963135, 0 },
-    { 0.43449199199676514, -0.022065000608563423, -0.90038800239562988, 0 },
-    { 0.14246000349521637, -0.078218996524810791, -0.98669397830963135, 0 },
-    { 0.3708299994468689, -0.02035599946975708, -0.92846500873565674, 0 },
-    { -0.21033400297164917, -0.024171000346541405, -0.97732502222061157, 0 },
-    { 0.006409000139683485, -0.019348999485373497, -0.99978601932525635, 0 },
-    { 0.21033400297164917, -0.024171000346541405, -0.97732502222061157, 0 },
-    { -0.006409000139683485, -0.019348999485373497, -0.99978601932525635, 0 },
-    { 0.48365700244903564, 0.054659001529216766, -0.87353098392486572, 0 },
-    { -0.48365700244903564, 0.054659001529216766, -0.87353098392486572, 0 },
-    { -0.3500170111656189, 0.87249398231506348, -0.34092199802398682, 0 },
-    { 0.21366000175476074, 0.35895898938179016, -0.90853601694107056, 0 },
-    { 0.3500170111656189, 0.87249398231506348, -0.34092199802398682, 0 },
-    { -0.21366000175476074, 0.35895898938179016, -0.90853601694107056, 0 },
-    { 0.34843000769615173, -0.20306999981403351, -0.91506701707839966, 0 },
-    { 0.12198200076818466, -0.59596502780914307, -0.79366397857666016, 0 },
-    { -0.34843000769615173, -0.20306999981403351, -0.91506701707839966, 0 },
-    { -0.12198200076818466, -0.59596502780914307, -0.79366397857666016, 0 },
-    { -0.093080997467041016, -0.91805797815322876, -0.38529598712921143, 0 },
-    { 0.093080997467041016, -0.91805797815322876, -0.38529598712921143, 0 },
-};
-
-static uv_t monkey_uvs[]
-__attribute__((aligned(32))) = {
-};
-
-static face_t monkey_faces[]
-__attribute__((aligned(32))) = {
-    { { 0, 503, 1551 }, { -1, -1, -1 }, { 0, 1, 2 } },
-    { { 0, 1551, 500 }, { -1, -1, -1 }, { 0, 2, 3 } },
-    { { 0, 500, 1505 }, { -1, -1, -1 }, { 0, 3, 4 } },
-    { { 0, 1505, 501 }, { -1, -1, -1 }, { 0, 4, 5 } },
-    { { 0, 501, 1507 }, { -1, -1, -1 }, { 0, 5, 6 } },
-    { { 0, 1507, 502 }, { -1, -1, -1 }, { 0, 6, 7 } },
-    { { 0, 502, 1549 }, { -1, -1, -1 }, { 0, 7, 8 } },
-    { { 0, 1549, 503 }, { -1, -1, -1 }, { 0, 8, 1 } },
-    { { 1, 507, 1508 }, { -1, -1, -1 }, { 9, 10, 11 } },
-    { { 1, 1508, 504 }, { -1, -1, -1 }, { 9, 11, 12 } },
-    { { 1, 504, 1506 }, { -1, -1, -1 }, { 9, 12, 13 } },
-    { { 1, 1506, 505 }, { -1, -1, -1 }, { 9, 13, 14 } },
-    { { 1, 505, 1552 }, { -1, -1, -1 }, { 9, 14, 15 } },
-    { { 1, 1552, 506 }, { -1, -1, -1 }, { 9, 15, 16 } },
-    { { 1, 506, 1550 }, { -1, -1, -1 }, { 9, 16, 17 } },
-    { { 1, 1550, 507 }, { -1, -1, -1 }, { 9, 17, 10 } },
-    { { 2, 510, 1549 }, { -1, -1, -1 }, { 18, 19, 8 } },
-    { { 2, 1549, 502 }, { -1, -1, -1 }, { 18, 8, 7 } },
-    { { 2, 502, 1507 }, { -1, -1, -1 }, { 18, 7, 6 } },
-    { { 2, 1507, 508 }, { -1, -1, -1 }, { 18, 6, 20 } },
-    { { 2, 508, 1509 }, { -1, -1, -1 }, { 18, 20, 21 } },
-    { { 2, 1509, 509 }, { -1, -1, -1 }, { 18, 21, 22 } },
-    { { 2, 509, 1547 }, { -1, -1, -1 }, { 18, 22, 23 } },
-    { { 2, 1547, 510 }, { -1, -1, -1 }, { 18, 23, 19 } },
-    { { 3, 513, 1510 }, { -1, -1, -1 }, { 24, 25, 26 } },
-    { { 3, 1510, 511 }, { -1, -1, -1 }, { 24, 26, 27 } },
-    { { 3, 511, 1508 }, { -1, -1, -1 }, { 24, 27, 11 } },
-    { { 3, 1508, 507 }, { -1, -1, -1 }, { 24, 11, 10 } },
-    { { 3, 507, 1550 }, { -1, -1, -1 }, { 24, 10, 17 } },
-    { { 3, 1550, 512 }, { -1, -1, -1 }, { 24, 17, 28 } },
-    { { 3, 512, 1548 }, { -1, -1, -1 }, { 24, 28, 29 } },
-    { { 3, 1548, 513 }, { -1, -1, -1 }, { 24, 29, 25 } },
-    { { 4, 508, 1507 }, { -1, -1, -1 }, { 30, 20, 6 } },
-    { { 4, 1507, 514 }, { -1, -1, -1 }, { 30, 6, 31 } },
-    { { 4, 514, 1513 }, { -1, -1, -1 }, { 30, 31, 32 } },
-    { { 4, 1513, 515 }, { -1, -1, -1 }, { 30, 32, 33 } },
-    { { 4, 515, 1511 }, { -1, -1, -1 }, { 30, 33, 34 } },
-    { { 4, 1511, 516 }, { -1, -1, -1 }, { 30, 34, 35 } },
-    { { 4, 516, 1509 }, { -1, -1, -1 }, { 30, 35, 21 } },
-    { { 4, 1509, 508 }, { -1, -1, -1 }, { 30, 21, 20 } },
-    { { 5, 519, 1512 }, { -1, -1, -1 }, { 36, 37, 38 } },
-    { { 5, 1512, 517 }, { -1, -1, -1 }, { 36, 38, 39 } },
-    { { 5, 517, 1514 }, { -1, -1, -1 }, { 36, 39, 40 } },
-    { { 5, 1514, 518 }, { -1, -1, -1 }, { 36, 40, 41 } },
-    { { 5, 518, 1508 }, { -1, -1, -1 }, { 36, 41, 11 } },
-    { { 5, 1508, 511 }, { -1, -1, -1 }, { 36, 11, 27 } },
-    { { 5, 511, 1510 }, { -1, -1, -1 }, { 36, 27, 26 } },
-    { { 5, 1510, 519 }, { -1, -1, -1 }, { 36, 26, 37 } },
-    { { 6, 501, 1505 }, { -1, -1, -1 }, { 42, 5, 4 } },
-    { { 6, 1505, 520 }, { -1, -1, -1 }, { 42, 4, 43 } },
-    { { 6, 520, 1515 }, { -1, -1, -1 }, { 42, 43, 44 } },
-    { { 6, 1515, 521 }, { -1, -1, -1 }, { 42, 44, 45 } },
-    { { 6, 521, 1513 }, { -1, -1, -1 }, { 42, 45, 32 } },
-    { { 6, 1513, 514 }, { -1, -1, -1 }, { 42, 32, 31 } },
-    { { 6, 514, 1507 }, { -1, -1, -1 }, { 42, 31, 6 } },
-    { { 6, 1507, 501 }, { -1, -1, -1 }, { 42, 6, 5 } },
-    { { 7, 518, 1514 }, { -1, -1, -1 }, { 46, 41, 40 } },
-    { { 7, 1514, 522 }, { -1, -1, -1 }, { 46, 40, 47 } },
-    { { 7, 522, 1516 }, { -1, -1, -1 }, { 46, 47, 48 } },
-    { { 7, 1516, 523 }, { -1, -1, -1 }, { 46, 48, 49 } },
-    { { 7, 523, 1506 }, { -1, -1, -1 }, { 46, 49, 13 } },
-    { { 7, 1506, 504 }, { -1, -1, -1 }, { 46, 13, 12 } },
-    { { 7, 504, 1508 }, { -1, -1, -1 }, { 46, 12, 11 } },
-    { { 7, 1508, 518 }, { -1, -1, -1 }, { 46, 11, 41 } },
-    { { 8, 521, 1515 }, { -1, -1, -1 }, { 50, 45, 44 } },
-    { { 8, 1515, 524 }, { -1, -1, -1 }, { 50, 44, 51 } },
-    { { 8, 524, 1517 }, { -1, -1, -1 }, { 50, 51, 52 } },
-    { { 8, 1517, 525 }, { -1, -1, -1 }, { 50, 52, 53 } },
-    { { 8, 525, 1519 }, { -1, -1, -1 }, { 50, 53, 54 } },
-    { { 8, 1519, 526 }, { -1, -1, -1 }, { 50, 54, 55 } },
-    { { 8, 526, 1513 }, { -1, -1, -1 }, { 50, 55, 32 } },
-    { { 8, 1513, 521 }, { -1, -1, -1 }, { 50, 32, 45 } },
-    { { 9, 529, 1520 }, { -1, -1, -1 }, { 56, 57, 58 } },
-    { { 9, 1520, 527 }, { -1, -1, -1 }, { 56, 58, 59 } },
-    { { 9, 527, 1518 }, { -1, -1, -1 }, { 56, 59, 60 } },
-    { { 9, 1518, 528 }, { -1, -1, -1 }, { 56, 60, 61 } },
-    { { 9, 528, 1516 }, { -1, -1, -1 }, { 56, 61, 48 } },
-    { { 9, 1516, 522 }, { -1, -1, -1 }, { 56, 48, 47 } },
-    { { 9, 522, 1514 }, { -1, -1, -1 }, { 56, 47, 40 } },
-    { { 9, 1514, 529 }, { -1, -1, -1 }, { 56, 40, 57 } },
-    { { 10, 515, 1513 }, { -1, -1, -1 }, { 62, 33, 32 } },
-    { { 10, 1513, 526 }, { -1, -1, -1 }, { 62, 32, 55 } },
-    { { 10, 526, 1519 }, { -1, -1, -1 }, { 62, 55, 54 } },
-    { { 10, 1519, 530 }, { -1, -1, -1 }, { 62, 54, 63 } },
-    { { 10, 530, 1521 }, { -1, -1, -1 }, { 62, 63, 64 } },
-    { { 10, 1521, 531 }, { -1, -1, -1 }, { 62, 64, 65 } },
-    { { 10, 531, 1511 }, { -1, -1, -1 }, { 62, 65, 34 } },
-    { { 10, 1511, 515 }, { -1, -1, -1 }, { 62, 34, 33 } },
-    { { 11, 533, 1522 }, { -1, -1, -1 }, { 66, 67, 68 } },
-    { { 11, 1522, 532 }, { -1, -1, -1 }, { 66, 68, 69 } },
-    { { 11, 532, 1520 }, { -1, -1, -1 }, { 66, 69, 58 } },
-    { { 11, 1520, 529 }, { -1, -1, -1 }, { 66, 58, 57 } },
-    { { 11, 529, 1514 }, { -1, -1, -1 }, { 66, 57, 40 } },
-    { { 11, 1514, 517 }, { -1, -1, -1 }, { 66, 40, 39 } },
-    { { 11, 517, 1512 }, { -1, -1, -1 }, { 66, 39, 38 } },
-    { { 11, 1512, 533 }, { -1, -1, -1 }, { 66, 38, 67 } },
-    { { 12, 530, 1519 }, { -1, -1, -1 }, { 70, 63, 54 } },
-    { { 12, 1519, 534 }, { -1, -1, -1 }, { 70, 54, 71 } },
-    { { 12, 534, 1525 }, { -1, -1, -1 }, { 70, 71, 72 } },
-    { { 12, 1525, 535 }, { -1, -1, -1 }, { 70, 72, 73 } },
-    { { 12, 535, 1523 }, { -1, -1, -1 }, { 70, 73, 74 } },
-    { { 12, 1523, 536 }, { -1, -1, -1 }, { 70, 74, 75 } },
-    { { 12, 536, 1521 }, { -1, -1, -1 }, { 70, 75, 64 } },
-    { { 12, 1521, 530 }, { -1, -1, -1 }, { 70, 64, 63 } },
-    { { 13, 539, 1524 }, { -1, -1, -1 }, { 76, 77, 78 } },
-    { { 13, 1524, 537 }, { -1, -1, -1 }, { 76, 78, 79 } },
-    { { 13, 537, 1526 }, { -1, -1, -1 }, { 76, 79, 80 } },
-    { { 13, 1526, 538 }, { -1, -1, -1 }, { 76, 80, 81 } },
-    { { 13, 538, 1520 }, { -1, -1, -1 }, { 76, 81, 58 } },
-    { { 13, 1520, 532 }, { -1, -1, -1 }, { 76, 58, 69 } },
-    { { 13, 532, 1522 }, { -1, -1, -1 }, { 76, 69, 68 } },
-    { { 13, 1522, 539 }, { -1, -1, -1 }, { 76, 68, 77 } },
-    { { 14, 525, 1517 }, { -1, -1, -1 }, { 82, 53, 52 } },
-    { { 14, 1517, 540 }, { -1, -1, -1 }, { 82, 52, 83 } },
-    { { 14, 540, 1527 }, { -1, -1, -1 }, { 82, 83, 84 } },
-    { { 14, 1527, 541 }, { -1, -1, -1 }, { 82, 84, 85 } },
-    { { 14, 541, 1525 }, { -1, -1, -1 }, { 82, 85, 72 } },
-    { { 14, 1525, 534 }, { -1, -1, -1 }, { 82, 72, 71 } },
-    { { 14, 534, 1519 }, { -1, -1, -1 }, { 82, 71, 54 } },
-    { { 14, 1519, 525 }, { -1, -1, -1 }, { 82, 54, 53 } },
-    { { 15, 538, 1526 }, { -1, -1, -1 }, { 86, 81, 80 } },
-    { { 15, 1526, 542 }, { -1, -1, -1 }, { 86, 80, 87 } },
-    { { 15, 542, 1528 }, { -1, -1, -1 }, { 86, 87, 88 } },
-    { { 15, 1528, 543 }, { -1, -1, -1 }, { 86, 88, 89 } },
-    { { 15, 543, 1518 }, { -1, -1, -1 }, { 86, 89, 60 } },
-    { { 15, 1518, 527 }, { -1, -1, -1 }, { 86, 60, 59 } },
-    { { 15, 527, 1520 }, { -1, -1, -1 }, { 86, 59, 58 } },
-    { { 15, 1520, 538 }, { -1, -1, -1 }, { 86, 58, 81 } },
-    { { 16, 541, 1527 }, { -1, -1, -1 }, { 90, 85, 84 } },
-    { { 16, 1527, 544 }, { -1, -1, -1 }, { 90, 84, 91 } },
-    { { 16, 544, 1529 }, { -1, -1, -1 }, { 90, 91, 92 } },
-    { { 16, 1529, 545 }, { -1, -1, -1 }, { 90, 92, 93 } },
-    { { 16, 545, 1531 }, { -1, -1, -1 }, { 90, 93, 94 } },
-    { { 16, 1531, 546 }, { -1, -1, -1 }, { 90, 94, 95 } },
-    { { 16, 546, 1525 }, { -1, -1, -1 }, { 90, 95, 72 } },
-    { { 16, 1525, 541 }, { -1, -1, -1 }, { 90, 72, 85 } },
-    { { 17, 549, 1532 }, { -1, -1, -1 }, { 96, 97, 98 } },
-    { { 17, 1532, 547 }, { -1, -1, -1 }, { 96, 98, 99 } },
-    { { 17, 547, 1530 }, { -1, -1, -1 }, { 96, 99, 100 } },
-    { { 17, 1530, 548 }, { -1, -1, -1 }, { 96, 100, 101 } },
-    { { 17, 548, 1528 }, { -1, -1, -1 }, { 96, 101, 88 } },
-    { { 17, 1528, 542 }, { -1, -1, -1 }, { 96, 88, 87 } },
-    { { 17, 542, 1526 }, { -1, -1, -1 }, { 96, 87, 80 } },
-    { { 17, 1526, 549 }, { -1, -1, -1 }, { 96, 80, 97 } },
-    { { 18, 535, 1525 }, { -1, -1, -1 }, { 102, 73, 72 } },
-    { { 18, 1525, 546 }, { -1, -1, -1 }, { 102, 72, 95 } },
-    { { 18, 546, 1531 }, { -1, -1, -1 }, { 102, 95, 94 } },
-    { { 18, 1531, 550 }, { -1, -1, -1 }, { 102, 94, 103 } },
-    { { 18, 550, 1533 }, { -1, -1, -1 }, { 102, 103, 104 } },
-    { { 18, 1533, 551 }, { -1, -1, -1 }, { 102, 104, 105 } },
-    { { 18, 551, 1523 }, { -1, -1, -1 }, { 102, 105, 74 } },
-    { { 18, 1523, 535 }, { -1, -1, -1 }, { 102, 74, 73 } },
-    { { 19, 553, 1534 }, { -1, -1, -1 }, { 106, 107, 108 } },
-    { { 19, 1534, 552 }, { -1, -1, -1 }, { 106, 108, 109 } },
-    { { 19, 552, 1532 }, { -1, -1, -1 }, { 106, 109, 98 } },
-    { { 19, 1532, 549 }, { -1, -1, -1 }, { 106, 98, 97 } },
-    { { 19, 549, 1526 }, { -1, -1, -1 }, { 106, 97, 80 } },
-    { { 19, 1526, 537 }, { -1, -1, -1 }, { 106, 80, 79 } },
-    { { 19, 537, 1524 }, { -1, -1, -1 }, { 106, 79, 78 } },
-    { { 19, 1524, 553 }, { -1, -1, -1 }, { 106, 78, 107 } },
-    { { 20, 550, 1531 }, { -1, -1, -1 }, { 110, 103, 94 } },
-    { { 20, 1531, 554 }, { -1, -1, -1 }, { 110, 94, 111 } },
-    { { 20, 554, 1537 }, { -1, -1, -1 }, { 110, 111, 112 } },
-    { { 20, 1537, 555 }, { -1, -1, -1 }, { 110, 112, 113 } },
-    { { 20, 555, 1535 }, { -1, -1, -1 }, { 110, 113, 114 } },
-    { { 20, 1535, 556 }, { -1, -1, -1 }, { 110, 114, 115 } },
-    { { 20, 556, 1533 }, { -1, -1, -1 }, { 110, 115, 104 } },
-    { { 20, 1533, 550 }, { -1, -1, -1 }, { 110, 104, 103 } },
-    { { 21, 559, 1536 }, { -1, -1, -1 }, { 116, 117, 118 } },
-    { { 21, 1536, 557 }, { -1, -1, -1 }, { 116, 118, 119 } },
-    { { 21, 557, 1538 }, { -1, -1, -1 }, { 116, 119, 120 } },
-    { { 21, 1538, 558 }, { -1, -1, -1 }, { 116, 120, 121 } },
-    { { 21, 558, 1532 }, { -1, -1, -1 }, { 116, 121, 98 } },
-    { { 21, 1532, 552 }, { -1, -1, -1 }, { 116, 98, 109 } },
-    { { 21, 552, 1534 }, { -1, -1, -1 }, { 116, 109, 108 } },
-    { { 21, 1534, 559 }, { -1, -1, -1 }, { 116, 108, 117 } },
-    { { 22, 545, 1529 }, { -1, -1, -1 }, { 122, 93, 92 } },
-    { { 22, 1529, 560 }, { -1, -1, -1 }, { 122, 92, 123 } },
-    { { 22, 560, 1539 }, { -1, -1, -1 }, { 122, 123, 124 } },
-    { { 22, 1539, 561 }, { -1, -1, -1 }, { 122, 124, 125 } },
-    { { 22, 561, 1537 }, { -1, -1, -1 }, { 122, 125, 112 } },
-    { { 22, 1537, 554 }, { -1, -1, -1 }, { 122, 112, 111 } },
-    { { 22, 554, 1531 }, { -1, -1, -1 }, { 122, 111, 94 } },
-    { { 22, 1531, 545 }, { -1, -1, -1 }, { 122, 94, 93 } },
-    { { 23, 558, 1538 }, { -1, -1, -1 }, { 126, 121, 120 } },
-    { { 23, 1538, 562 }, { -1, -1, -1 }, { 126, 120, 127 } },
-    { { 23, 562, 1540 }, { -1, -1, -1 }, { 126, 127, 128 } },
-    { { 23, 1540, 563 }, { -1, -1, -1 }, { 126, 128, 129 } },
-    { { 23, 563, 1530 }, { -1, -1, -1 }, { 126, 129, 100 } },
-    { { 23, 1530, 547 }, { -1, -1, -1 }, { 126, 100, 99 } },
-    { { 23, 547, 1532 }, { -1, -1, -1 }, { 126, 99, 98 } },
-    { { 23, 1532, 558 }, { -1, -1, -1 }, { 126, 98, 121 } },
-    { { 24, 561, 1539 }, { -1, -1, -1 }, { 130, 125, 124 } },
-    { { 24, 1539, 564 }, { -1, -1, -1 }, { 130, 124, 131 } },
-    { { 24, 564, 1541 }, { -1, -1, -1 }, { 130, 131, 132 } },
-    { { 24, 1541, 565 }, { -1, -1, -1 }, { 130, 132, 133 } },
-    { { 24, 565, 1543 }, { -1, -1, -1 }, { 130, 133, 134 } },
-    { { 24, 1543, 566 }, { -1, -1, -1 }, { 130, 134, 135 } },
-    { { 24, 566, 1537 }, { -1, -1, -1 }, { 130, 135, 112 } },
-    { { 24, 1537, 561 }, { -1, -1, -1 }, { 130, 112, 125 } },
-    { { 25, 569, 1544 }, { -1, -1, -1 }, { 136, 137, 138 } },
-    { { 25, 1544, 567 }, { -1, -1, -1 }, { 136, 138, 139 } },
-    { { 25, 567, 1542 }, { -1, -1, -1 }, { 136, 139, 140 } },
-    { { 25, 1542, 568 }, { -1, -1, -1 }, { 136, 140, 141 } },
-    { { 25, 568, 1540 }, { -1, -1, -1 }, { 136, 141, 128 } },
-    { { 25, 1540, 562 }, { -1, -1, -1 }, { 136, 128, 127 } },
-    { { 25, 562, 1538 }, { -1, -1, -1 }, { 136, 127, 120 } },
-    { { 25, 1538, 569 }, { -1, -1, -1 }, { 136, 120, 137 } },
-    { { 26, 555, 1537 }, { -1, -1, -1 }, { 142, 113, 112 } },
-    { { 26, 1537, 566 }, { -1, -1, -1 }, { 142, 112, 135 } },
-    { { 26, 566, 1543 }, { -1, -1, -1 }, { 142, 135, 134 } },
-    { { 26, 1543, 570 }, { -1, -1, -1 }, { 142, 134, 143 } },
-    { { 26, 570, 1545 }, { -1, -1, -1 }, { 142, 143, 144 } },
-    { { 26, 1545, 571 }, { -1, -1, -1 }, { 142, 144, 145 } },
-    { { 26, 571, 1535 }, { -1, -1, -1 }, { 142, 145, 114 } },
-    { { 26, 1535, 555 }, { -1, -1, -1 }, { 142, 114, 113 } },
-    { { 27, 573, 1546 }, { -1, -1, -1 }, { 146, 147, 148 } },
-    { { 27, 1546, 572 }, { -1, -1, -1 }, { 146, 148, 149 } },
-    { { 27, 572, 1544 }, { -1, -1, -1 }, { 146, 149, 138 } },
-    { { 27, 1544, 569 }, { -1, -1, -1 }, { 146, 138, 137 } },
-    { { 27, 569, 1538 }, { -1, -1, -1 }, { 146, 137, 120 } },
-    { { 27, 1538, 557 }, { -1, -1, -1 }, { 146, 120, 119 } },
-    { { 27, 557, 1536 }, { -1, -1, -1 }, { 146, 119, 118 } },
-    { { 27, 1536, 573 }, { -1, -1, -1 }, { 146, 118, 147 } },
-    { { 28, 570, 1543 }, { -1, -1, -1 }, { 150, 143, 134 } },
-    { { 28, 1543, 574 }, { -1, -1, -1 }, { 150, 134, 151 } },
-    { { 28, 574, 1549 }, { -1, -1, -1 }, { 150, 151, 8 } },
-    { { 28, 1549, 510 }, { -1, -1, -1 }, { 150, 8, 19 } },
-    { { 28, 510, 1547 }, { -1, -1, -1 }, { 150, 19, 23 } },
-    { { 28, 1547, 575 }, { -1, -1, -1 }, { 150, 23, 152 } },
-    { { 28, 575, 1545 }, { -1, -1, -1 }, { 150, 152, 144 } },
-    { { 28, 1545, 570 }, { -1, -1, -1 }, { 150, 144, 143 } },
-    { { 29, 577, 1548 }, { -1, -1, -1 }, { 153, 154, 29 } },
-    { { 29, 1548, 512 }, { -1, -1, -1 }, { 153, 29, 28 } },
-    { { 29, 512, 1550 }, { -1, -1, -1 }, { 153, 28, 17 } },
-    { { 29, 1550, 576 }, { -1, -1, -1 }, { 153, 17, 155 } },
-    { { 29, 576, 1544 }, { -1, -1, -1 }, { 153, 155, 138 } },
-    { { 29, 1544, 572 }, { -1, -1, -1 }, { 153, 138, 149 } },
-    { { 29, 572, 1546 }, { -1, -1, -1 }, { 153, 149, 148 } },
-    { { 29, 1546, 577 }, { -1, -1, -1 }, { 153, 148, 154 } },
-    { { 30, 565, 1541 }, { -1, -1, -1 }, { 156, 133, 132 } },
-    { { 30, 1541, 578 }, { -1, -1, -1 }, { 156, 132, 157 } },
-    { { 30, 578, 1551 }, { -1, -1, -1 }, { 156, 157, 2 } },
-    { { 30, 1551, 503 }, { -1, -1, -1 }, { 156, 2, 1 } },
-    { { 30, 503, 1549 }, { -1, -1, -1 }, { 156, 1, 8 } },
-    { { 30, 1549, 574 }, { -1, -1, -1 }, { 156, 8, 151 } },
-    { { 30, 574, 1543 }, { -1, -1, -1 }, { 156, 151, 134 } },
-    { { 30, 1543, 565 }, { -1, -1, -1 }, { 156, 134, 133 } },
-    { { 31, 576, 1550 }, { -1, -1, -1 }, { 158, 155, 17 } },
-    { { 31, 1550, 506 }, { -1, -1, -1 }, { 158, 17, 16 } },
-    { { 31, 506, 1552 }, { -1, -1, -1 }, { 158, 16, 15 } },
-    { { 31, 1552, 579 }, { -1, -1, -1 }, { 158, 15, 159 } },
-    { { 31, 579, 1542 }, { -1, -1, -1 }, { 158, 159, 140 } },
-    { { 31, 1542, 567 }, { -1, -1, -1 }, { 158, 140, 139 } },
-    { { 31, 567, 1544 }, { -1, -1, -1 }, { 158, 139, 138 } },
-    { { 31, 1544, 576 }, { -1, -1, -1 }, { 158, 138, 155 } },
-    { { 32, 582, 1551 }, { -1, -1, -1 }, { 160, 161, 2 } },
-    { { 32, 1551, 578 }, { -1, -1, -1 }, { 160, 2, 157 } },
-    { { 32, 578, 1541 }, { -1, -1, -1 }, { 160, 157, 132 } },
-    { { 32, 1541, 580 }, { -1, -1, -1 }, { 160, 132, 162 } },
-    { { 32, 580, 1555 }, { -1, -1, -1 }, { 160, 162, 163 } },
-    { { 32, 1555, 581 }, { -1, -1, -1 }, { 160, 163, 164 } },
-    { { 32, 581, 1553 }, { -1, -1, -1 }, { 160, 164, 165 } },
-    { { 32, 1553, 582 }, { -1, -1, -1 }, { 160, 165, 161 } },
-    { { 33, 585, 1556 }, { -1, -1, -1 }, { 166, 167, 168 } },
-    { { 33, 1556, 583 }, { -1, -1, -1 }, { 166, 168, 169 } },
-    { { 33, 583, 1542 }, { -1, -1, -1 }, { 166, 169, 140 } },
-    { { 33, 1542, 579 }, { -1, -1, -1 }, { 166, 140, 159 } },
-    { { 33, 579, 1552 }, { -1, -1, -1 }, { 166, 159, 15 } },
-    { { 33, 1552, 584 }, { -1, -1, -1 }, { 166, 15, 170 } },
-    { { 33, 584, 1554 }, { -1, -1, -1 }, { 166, 170, 171 } },
-    { { 33, 1554, 585 }, { -1, -1, -1 }, { 166, 171, 167 } },
-    { { 34, 580, 1541 }, { -1, -1, -1 }, { 172, 162, 132 } },
-    { { 34, 1541, 564 }, { -1, -1, -1 }, { 172, 132, 131 } },
-    { { 34, 564, 1539 }, { -1, -1, -1 }, { 172, 131, 124 } },
-    { { 34, 1539, 586 }, { -1, -1, -1 }, { 172, 124, 173 } },
-    { { 34, 586, 1557 }, { -1, -1, -1 }, { 172, 173, 174 } },
-    { { 34, 1557, 587 }, { -1, -1, -1 }, { 172, 174, 175 } },
-    { { 34, 587, 1555 }, { -1, -1, -1 }, { 172, 175, 163 } },
-    { { 34, 1555, 580 }, { -1, -1, -1 }, { 172, 163, 162 } },
-    { { 35, 589, 1558 }, { -1, -1, -1 }, { 176, 177, 178 } },
-    { { 35, 1558, 588 }, { -1, -1, -1 }, { 176, 178, 179 } },
-    { { 35, 588, 1540 }, { -1, -1, -1 }, { 176, 179, 128 } },
-    { { 35, 1540, 568 }, { -1, -1, -1 }, { 176, 128, 141 } },
-    { { 35, 568, 1542 }, { -1, -1, -1 }, { 176, 141, 140 } },
-    { { 35, 1542, 583 }, { -1, -1, -1 }, { 176, 140, 169 } },
-    { { 35, 583, 1556 }, { -1, -1, -1 }, { 176, 169, 168 } },
-    { { 35, 1556, 589 }, { -1, -1, -1 }, { 176, 168, 177 } },
-    { { 36, 586, 1539 }, { -1, -1, -1 }, { 180, 173, 124 } },
-    { { 36, 1539, 560 }, { -1, -1, -1 }, { 180, 124, 123 } },
-    { { 36, 560, 1529 }, { -1, -1, -1 }, { 180, 123, 92 } },
-    { { 36, 1529, 590 }, { -1, -1, -1 }, { 180, 92, 181 } },
-    { { 36, 590, 1559 }, { -1, -1, -1 }, { 180, 181, 182 } },
-    { { 36, 1559, 591 }, { -1, -1, -1 }, { 180, 182, 183 } },
-    { { 36, 591, 1557 }, { -1, -1, -1 }, { 180, 183, 174 } },
-    { { 36, 1557, 586 }, { -1, -1, -1 }, { 180, 174, 173 } },
-    { { 37, 593, 1560 }, { -1, -1, -1 }, { 184, 185, 186 } },
-    { { 37, 1560, 592 }, { -1, -1, -1 }, { 184, 186, 187 } },
-    { { 37, 592, 1530 }, { -1, -1, -1 }, { 184, 187, 100 } },
-    { { 37, 1530, 563 }, { -1, -1, -1 }, { 184, 100, 129 } },
-    { { 37, 563, 1540 }, { -1, -1, -1 }, { 184, 129, 128 } },
-    { { 37, 1540, 588 }, { -1, -1, -1 }, { 184, 128, 179 } },
-    { { 37, 588, 1558 }, { -1, -1, -1 }, { 184, 179, 178 } },
-    { { 37, 1558, 593 }, { -1, -1, -1 }, { 184, 178, 185 } },
-    { { 38, 590, 1529 }, { -1, -1, -1 }, { 188, 181, 92 } },
-    { { 38, 1529, 544 }, { -1, -1, -1 }, { 188, 92, 91 } },
-    { { 38, 544, 1527 }, { -1, -1, -1 }, { 188, 91, 84 } },
-    { { 38, 1527, 594 }, { -1, -1, -1 }, { 188, 84, 189 } },
-    { { 38, 594, 1561 }, { -1, -1, -1 }, { 188, 189, 190 } },
-    { { 38, 1561, 595 }, { -1, -1, -1 }, { 188, 190, 191 } },
-    { { 38, 595, 1559 }, { -1, -1, -1 }, { 188, 191, 182 } },
-    { { 38, 1559, 590 }, { -1, -1, -1 }, { 188, 182, 181 } },
-    { { 39, 597, 1562 }, { -1, -1, -1 }, { 192, 193, 194 } },
-    { { 39, 1562, 596 }, { -1, -1, -1 }, { 192, 194, 195 } },
-    { { 39, 596, 1528 }, { -1, -1, -1 }, { 192, 195, 88 } },
-    { { 39, 1528, 548 }, { -1, -1, -1 }, { 192, 88, 101 } },
-    { { 39, 548, 1530 }, { -1, -1, -1 }, { 192, 101, 100 } },
-    { { 39, 1530, 592 }, { -1, -1, -1 }, { 192, 100, 187 } },
-    { { 39, 592, 1560 }, { -1, -1, -1 }, { 192, 187, 186 } },
-    { { 39, 1560, 597 }, { -1, -1, -1 }, { 192, 186, 193 } },
-    { { 40, 594, 1527 }, { -1, -1, -1 }, { 196, 189, 84 } },
-    { { 40, 1527, 540 }, { -1, -1, -1 }, { 196, 84, 83 } },
-    { { 40, 540, 1517 }, { -1, -1, -1 }, { 196, 83, 52 } },
-    { { 40, 1517, 598 }, { -1, -1, -1 }, { 196, 52, 197 } },
-    { { 40, 598, 1563 }, { -1, -1, -1 }, { 196, 197, 198 } },
-    { { 40, 1563, 599 }, { -1, -1, -1 }, { 196, 198, 199 } },
-    { { 40, 599, 1561 }, { -1, -1, -1 }, { 196, 199, 190 } },
-    { { 40, 1561, 594 }, { -1, -1, -1 }, { 196, 190, 189 } },
-    { { 41, 601, 1564 }, { -1, -1, -1 }, { 200, 201, 202 } },
-    { { 41, 1564, 600 }, { -1, -1, -1 }, { 200, 202, 203 } },
-    { { 41, 600, 1518 }, { -1, -1, -1 }, { 200, 203, 60 } },
-    { { 41, 1518, 543 }, { -1, -1, -1 }, { 200, 60, 89 } },
-    { { 41, 543, 1528 }, { -1, -1, -1 }, { 200, 89, 88 } },
-    { { 41, 1528, 596 }, { -1, -1, -1 }, { 200, 88, 195 } },
-    { { 41, 596, 1562 }, { -1, -1, -1 }, { 200, 195, 194 } },
-    { { 41, 1562, 601 }, { -1, -1, -1 }, { 200, 194, 201 } },
-    { { 42, 598, 1517 }, { -1, -1, -1 }, { 204, 197, 52 } },
-    { { 42, 1517, 524 }, { -1, -1, -1 }, { 204, 52, 51 } },
-    { { 42, 524, 1515 }, { -1, -1, -1 }, { 204, 51, 44 } },
-    { { 42, 1515, 602 }, { -1, -1, -1 }, { 204, 44, 205 } },
-    { { 42, 602, 1567 }, { -1, -1, -1 }, { 204, 205, 206 } },
-    { { 42, 1567, 603 }, { -1, -1, -1 }, { 204, 206, 207 } },
-    { { 42, 603, 1563 }, { -1, -1, -1 }, { 204, 207, 198 } },
-    { { 42, 1563, 598 }, { -1, -1, -1 }, { 204, 198, 197 } },
-    { { 43, 605, 1568 }, { -1, -1, -1 }, { 208, 209, 210 } },
-    { { 43, 1568, 604 }, { -1, -1, -1 }, { 208, 210, 211 } },
-    { { 43, 604, 1516 }, { -1, -1, -1 }, { 208, 211, 48 } },
-    { { 43, 1516, 528 }, { -1, -1, -1 }, { 208, 48, 61 } },
-    { { 43, 528, 1518 }, { -1, -1, -1 }, { 208, 61, 60 } },
-    { { 43, 1518, 600 }, { -1, -1, -1 }, { 208, 60, 203 } },
-    { { 43, 600, 1564 }, { -1, -1, -1 }, { 208, 203, 202 } },
-    { { 43, 1564, 605 }, { -1, -1, -1 }, { 208, 202, 209 } },
-    { { 44, 602, 1515 }, { -1, -1, -1 }, { 212, 205, 44 } },
-    { { 44, 1515, 520 }, { -1, -1, -1 }, { 212, 44, 43 } },
-    { { 44, 520, 1505 }, { -1, -1, -1 }, { 212, 43, 4 } },
-    { { 44, 1505, 606 }, { -1, -1, -1 }, { 212, 4, 213 } },
-    { { 44, 606, 1569 }, { -1, -1, -1 }, { 212, 213, 214 } },
-    { { 44, 1569, 607 }, { -1, -1, -1 }, { 212, 214, 215 } },
-    { { 44, 607, 1567 }, { -1, -1, -1 }, { 212, 215, 206 } },
-    { { 44, 1567, 602 }, { -1, -1, -1 }, { 212, 206, 205 } },
-    { { 45, 609, 1570 }, { -1, -1, -1 }, { 216, 217, 218 } },
-    { { 45, 1570, 608 }, { -1, -1, -1 }, { 216, 218, 219 } },
-    { { 45, 608, 1506 }, { -1, -1, -1 }, { 216, 219, 13 } },
-    { { 45, 1506, 523 }, { -1, -1, -1 }, { 216, 13, 49 } },
-    { { 45, 523, 1516 }, { -1, -1, -1 }, { 216, 49, 48 } },
-    { { 45, 1516, 604 }, { -1, -1, -1 }, { 216, 48, 211 } },
-    { { 45, 604, 1568 }, { -1, -1, -1 }, { 216, 211, 210 } },
-    { { 45, 1568, 609 }, { -1, -1, -1 }, { 216, 210, 217 } },
-    { { 46, 606, 1505 }, { -1, -1, -1 }, { 220, 213, 4 } },
-    { { 46, 1505, 500 }, { -1, -1, -1 }, { 220, 4, 3 } },
-    { { 46, 500, 1551 }, { -1, -1, -1 }, { 220, 3, 2 } },
-    { { 46, 1551, 582 }, { -1, -1, -1 }, { 220, 2, 161 } },
-    { { 46, 582, 1553 }, { -1, -1, -1 }, { 220, 161, 165 } },
-    { { 46, 1553, 610 }, { -1, -1, -1 }, { 220, 165, 221 } },
-    { { 46, 610, 1569 }, { -1, -1, -1 }, { 220, 221, 214 } },
-    { { 46, 1569, 606 }, { -1, -1, -1 }, { 220, 214, 213 } },
-    { { 47, 611, 1554 }, { -1, -1, -1 }, { 222, 223, 171 } },
-    { { 47, 1554, 584 }, { -1, -1, -1 }, { 222, 171, 170 } },
-    { { 47, 584, 1552 }, { -1, -1, -1 }, { 222, 170, 15 } },
-    { { 47, 1552, 505 }, { -1, -1, -1 }, { 222, 15, 14 } },
-    { { 47, 505, 1506 }, { -1, -1, -1 }, { 222, 14, 13 } },
-    { { 47, 1506, 608 }, { -1, -1, -1 }, { 222, 13, 219 } },
-    { { 47, 608, 1570 }, { -1, -1, -1 }, { 222, 219, 218 } },
-    { { 47, 1570, 611 }, { -1, -1, -1 }, { 222, 218, 223 } },
-    { { 48, 613, 1565 }, { -1, -1, -1 }, { 224, 225, 226 } },
-    { { 48, 1565, 612 }, { -1, -1, -1 }, { 224, 226, 227 } },
-    { { 48, 612, 1569 }, { -1, -1, -1 }, { 224, 227, 214 } },
-    { { 48, 1569, 610 }, { -1, -1, -1 }, { 224, 214, 221 } },
-    { { 48, 610, 1553 }, { -1, -1, -1 }, { 224, 221, 165 } },
-    { { 48, 1553, 613 }, { -1, -1, -1 }, { 224, 165, 225 } },
-    { { 49, 615, 1554 }, { -1, -1, -1 }, { 228, 229, 171 } },
-    { { 49, 1554, 611 }, { -1, -1, -1 }, { 228, 171, 223 } },
-    { { 49, 611, 1570 }, { -1, -1, -1 }, { 228, 223, 218 } },
-    { { 49, 1570, 614 }, { -1, -1, -1 }, { 228, 218, 230 } },
-    { { 49, 614, 1566 }, { -1, -1, -1 }, { 228, 230, 231 } },
-    { { 49, 1566, 615 }, { -1, -1, -1 }, { 228, 231, 229 } },
-    { { 50, 616, 1567 }, { -1, -1, -1 }, { 232, 233, 206 } },
-    { { 50, 1567, 607 }, { -1, -1, -1 }, { 232, 206, 215 } },
-    { { 50, 607, 1569 }, { -1, -1, -1 }, { 232, 215, 214 } },
-    { { 50, 1569, 612 }, { -1, -1, -1 }, { 232, 214, 227 } },
-    { { 50, 612, 1565 }, { -1, -1, -1 }, { 232, 227, 226 } },
-    { { 50, 1565, 616 }, { -1, -1, -1 }, { 232, 226, 233 } },
-    { { 51, 617, 1566 }, { -1, -1, -1 }, { 234, 235, 231 } },
-    { { 51, 1566, 614 }, { -1, -1, -1 }, { 234, 231, 230 } },
-    { { 51, 614, 1570 }, { -1, -1, -1 }, { 234, 230, 218 } },
-    { { 51, 1570, 609 }, { -1, -1, -1 }, { 234, 218, 217 } },
-    { { 51, 609, 1568 }, { -1, -1, -1 }, { 234, 217, 210 } },
-    { { 51, 1568, 617 }, { -1, -1, -1 }, { 234, 210, 235 } },
-    { { 52, 616, 1565 }, { -1, -1, -1 }, { 236, 233, 226 } },
-    { { 52, 1565, 618 }, { -1, -1, -1 }, { 236, 226, 237 } },
-    { { 52, 618, 1563 }, { -1, -1, -1 }, { 236, 237, 198 } },
-    { { 52, 1563, 603 }, { -1, -1, -1 }, { 236, 198, 207 } },
-    { { 52, 603, 1567 }, { -1, -1, -1 }, { 236, 207, 206 } },
-    { { 52, 1567, 616 }, { -1, -1, -1 }, { 236, 206, 233 } },
-    { { 53, 617, 1568 }, { -1, -1, -1 }, { 238, 235, 210 } },
-    { { 53, 1568, 605 }, { -1, -1, -1 }, { 238, 210, 209 } },
-    { { 53, 605, 1564 }, { -1, -1, -1 }, { 238, 209, 202 } },
-    { { 53, 1564, 619 }, { -1, -1, -1 }, { 238, 202, 239 } },
-    { { 53, 619, 1566 }, { -1, -1, -1 }, { 238, 239, 231 } },
-    { { 53, 1566, 617 }, { -1, -1, -1 }, { 238, 231, 235 } },
-    { { 54, 618, 1565 }, { -1, -1, -1 }, { 240, 237, 226 } },
-    { { 54, 1565, 620 }, { -1, -1, -1 }, { 240, 226, 241 } },
-    { { 54, 620, 1561 }, { -1, -1, -1 }, { 240, 241, 190 } },
-    { { 54, 1561, 599 }, { -1, -1, -1 }, { 240, 190, 199 } },
-    { { 54, 599, 1563 }, { -1, -1, -1 }, { 240, 199, 198 } },
-    { { 54, 1563, 618 }, { -1, -1, -1 }, { 240, 198, 237 } },
-    { { 55, 619, 1564 }, { -1, -1, -1 }, { 242, 239, 202 } },
-    { { 55, 1564, 601 }, { -1, -1, -1 }, { 242, 202, 201 } },
-    { { 55, 601, 1562 }, { -1, -1, -1 }, { 242, 201, 194 } },
-    { { 55, 1562, 621 }, { -1, -1, -1 }, { 242, 194, 243 } },
-    { { 55, 621, 1566 }, { -1, -1, -1 }, { 242, 243, 231 } },
-    { { 55, 1566, 619 }, { -1, -1, -1 }, { 242, 231, 239 } },
-    { { 56, 620, 1565 }, { -1, -1, -1 }, { 244, 241, 226 } },
-    { { 56, 1565, 622 }, { -1, -1, -1 }, { 244, 226, 245 } },
-    { { 56, 622, 1559 }, { -1, -1, -1 }, { 244, 245, 182 } },
-    { { 56, 1559, 595 }, { -1, -1, -1 }, { 244, 182, 191 } },
-    { { 56, 595, 1561 }, { -1, -1, -1 }, { 244, 191, 190 } },
-    { { 56, 1561, 620 }, { -1, -1, -1 }, { 244, 190, 241 } },
-    { { 57, 621, 1562 }, { -1, -1, -1 }, { 246, 243, 194 } },
-    { { 57, 1562, 597 }, { -1, -1, -1 }, { 246, 194, 193 } },
-    { { 57, 597, 1560 }, { -1, -1, -1 }, { 246, 193, 186 } },
-    { { 57, 1560, 623 }, { -1, -1, -1 }, { 246, 186, 247 } },
-    { { 57, 623, 1566 }, { -1, -1, -1 }, { 246, 247, 231 } },
-    { { 57, 1566, 621 }, { -1, -1, -1 }, { 246, 231, 243 } },
-    { { 58, 622, 1565 }, { -1, -1, -1 }, { 248, 245, 226 } },
-    { { 58, 1565, 624 }, { -1, -1, -1 }, { 248, 226, 249 } },
-    { { 58, 624, 1557 }, { -1, -1, -1 }, { 248, 249, 174 } },
-    { { 58, 1557, 591 }, { -1, -1, -1 }, { 248, 174, 183 } },
-    { { 58, 591, 1559 }, { -1, -1, -1 }, { 248, 183, 182 } },
-    { { 58, 1559, 622 }, { -1, -1, -1 }, { 248, 182, 245 } },
-    { { 59, 623, 1560 }, { -1, -1, -1 }, { 250, 247, 186 } },
-    { { 59, 1560, 593 }, { -1, -1, -1 }, { 250, 186, 185 } },
-    { { 59, 593, 1558 }, { -1, -1, -1 }, { 250, 185, 178 } },
-    { { 59, 1558, 625 }, { -1, -1, -1 }, { 250, 178, 251 } },
-    { { 59, 625, 1566 }, { -1, -1, -1 }, { 250, 251, 231 } },
-    { { 59, 1566, 623 }, { -1, -1, -1 }, { 250, 231, 247 } },
-    { { 60, 624, 1565 }, { -1, -1, -1 }, { 252, 249, 226 } },
-    { { 60, 1565, 626 }, { -1, -1, -1 }, { 252, 226, 253 } },
-    { { 60, 626, 1555 }, { -1, -1, -1 }, { 252, 253, 163 } },
-    { { 60, 1555, 587 }, { -1, -1, -1 }, { 252, 163, 175 } },
-    { { 60, 587, 1557 }, { -1, -1, -1 }, { 252, 175, 174 } },
-    { { 60, 1557, 624 }, { -1, -1, -1 }, { 252, 174, 249 } },
-    { { 61, 625, 1558 }, { -1, -1, -1 }, { 254, 251, 178 } },
-    { { 61, 1558, 589 }, { -1, -1, -1 }, { 254, 178, 177 } },
-    { { 61, 589, 1556 }, { -1, -1, -1 }, { 254, 177, 168 } },
-    { { 61, 1556, 627 }, { -1, -1, -1 }, { 254, 168, 255 } },
-    { { 61, 627, 1566 }, { -1, -1, -1 }, { 254, 255, 231 } },
-    { { 61, 1566, 625 }, { -1, -1, -1 }, { 254, 231, 251 } },
-    { { 62, 626, 1565 }, { -1, -1, -1 }, { 256, 253, 226 } },
-    { { 62, 1565, 613 }, { -1, -1, -1 }, { 256, 226, 225 } },
-    { { 62, 613, 1553 }, { -1, -1, -1 }, { 256, 225, 165 } },
-    { { 62, 1553, 581 }, { -1, -1, -1 }, { 256, 165, 164 } },
-    { { 62, 581, 1555 }, { -1, -1, -1 }, { 256, 164, 163 } },
-    { { 62, 1555, 626 }, { -1, -1, -1 }, { 256, 163, 253 } },
-    { { 63, 627, 1556 }, { -1, -1, -1 }, { 257, 255, 168 } },
-    { { 63, 1556, 585 }, { -1, -1, -1 }, { 257, 168, 167 } },
-    { { 63, 585, 1554 }, { -1, -1, -1 }, { 257, 167, 171 } },
-    { { 63, 1554, 615 }, { -1, -1, -1 }, { 257, 171, 229 } },
-    { { 63, 615, 1566 }, { -1, -1, -1 }, { 257, 229, 231 } },
-    { { 63, 1566, 627 }, { -1, -1, -1 }, { 257, 231, 255 } },
-    { { 64, 631, 1593 }, { -1, -1, -1 }, { 258, 259, 260 } },
-    { { 64, 1593, 628 }, { -1, -1, -1 }, { 258, 260, 261 } },
-    { { 64, 628, 1678 }, { -1, -1, -1 }, { 258, 261, 262 } },
-    { { 64, 1678, 629 }, { -1, -1, -1 }, { 258, 262, 263 } },
-    { { 64, 629, 1680 }, { -1, -1, -1 }, { 258, 263, 264 } },
-    { { 64, 1680, 630 }, { -1, -1, -1 }, { 258, 264, 265 } },
-    { { 64, 630, 1595 }, { -1, -1, -1 }, { 258, 265, 266 } },
-    { { 64, 1595, 631 }, { -1, -1, -1 }, { 258, 266, 259 } },
-    { { 65, 630, 1680 }, { -1, -1, -1 }, { 267, 265, 264 } },
-    { { 65, 1680, 632 }, { -1, -1, -1 }, { 267, 264, 268 } },
-    { { 65, 632, 1679 }, { -1, -1, -1 }, { 267, 268, 269 } },
-    { { 65, 1679, 633 }, { -1, -1, -1 }, { 267, 269, 270 } },
-    { { 65, 633, 1594 }, { -1, -1, -1 }, { 267, 270, 271 } },
-    { { 65, 1594, 634 }, { -1, -1, -1 }, { 267, 271, 272 } },
-    { { 65, 634, 1595 }, { -1, -1, -1 }, { 267, 272, 266 } },
-    { { 65, 1595, 630 }, { -1, -1, -1 }, { 267, 266, 265 } },
-    { { 66, 637, 1591 }, { -1, -1, -1 }, { 273, 274, 275 } },
-    { { 66, 1591, 635 }, { -1, -1, -1 }, { 273, 275, 276 } },
-    { { 66, 635, 1676 }, { -1, -1, -1 }, { 273, 276, 277 } },
-    { { 66, 1676, 636 }, { -1, -1, -1 }, { 273, 277, 278 } },
-    { { 66, 636, 1678 }, { -1, -1, -1 }, { 273, 278, 262 } },
-    { { 66, 1678, 628 }, { -1, -1, -1 }, { 273, 262, 261 } },
-    { { 66, 628, 1593 }, { -1, -1, -1 }, { 273, 261, 260 } },
-    { { 66, 1593, 637 }, { -1, -1, -1 }, { 273, 260, 274 } },
-    { { 67, 633, 1679 }, { -1, -1, -1 }, { 279, 270, 269 } },
-    { { 67, 1679, 638 }, { -1, -1, -1 }, { 279, 269, 280 } },
-    { { 67, 638, 1677 }, { -1, -1, -1 }, { 279, 280, 281 } },
-    { { 67, 1677, 639 }, { -1, -1, -1 }, { 279, 281, 282 } },
-    { { 67, 639, 1592 }, { -1, -1, -1 }, { 279, 282, 283 } },
-    { { 67, 1592, 640 }, { -1, -1, -1 }, { 279, 283, 284 } },
-    { { 67, 640, 1594 }, { -1, -1, -1 }, { 279, 284, 271 } },
-    { { 67, 1594, 633 }, { -1, -1, -1 }, { 279, 271, 270 } },
-    { { 68, 643, 1589 }, { -1, -1, -1 }, { 285, 286, 287 } },
-    { { 68, 1589, 641 }, { -1, -1, -1 }, { 285, 287, 288 } },
-    { { 68, 641, 1674 }, { -1, -1, -1 }, { 285, 288, 289 } },
-    { { 68, 1674, 642 }, { -1, -1, -1 }, { 285, 289, 290 } },
-    { { 68, 642, 1676 }, { -1, -1, -1 }, { 285, 290, 277 } },
-    { { 68, 1676, 635 }, { -1, -1, -1 }, { 285, 277, 276 } },
-    { { 68, 635, 1591 }, { -1, -1, -1 }, { 285, 276, 275 } },
-    { { 68, 1591, 643 }, { -1, -1, -1 }, { 285, 275, 286 } },
-    { { 69, 639, 1677 }, { -1, -1, -1 }, { 291, 282, 281 } },
-    { { 69, 1677, 644 }, { -1, -1, -1 }, { 291, 281, 292 } },
-    { { 69, 644, 1675 }, { -1, -1, -1 }, { 291, 292, 293 } },
-    { { 69, 1675, 645 }, { -1, -1, -1 }, { 291, 293, 294 } },
-    { { 69, 645, 1590 }, { -1, -1, -1 }, { 291, 294, 295 } },
-    { { 69, 1590, 646 }, { -1, -1, -1 }, { 291, 295, 296 } },
-    { { 69, 646, 1592 }, { -1, -1, -1 }, { 291, 296, 283 } },
-    { { 69, 1592, 639 }, { -1, -1, -1 }, { 291, 283, 282 } },
-    { { 70, 649, 1587 }, { -1, -1, -1 }, { 297, 298, 299 } },
-    { { 70, 1587, 647 }, { -1, -1, -1 }, { 297, 299, 300 } },
-    { { 70, 647, 1672 }, { -1, -1, -1 }, { 297, 300, 301 } },
-    { { 70, 1672, 648 }, { -1, -1, -1 }, { 297, 301, 302 } },
-    { { 70, 648, 1674 }, { -1, -1, -1 }, { 297, 302, 289 } },
-    { { 70, 1674, 641 }, { -1, -1, -1 }, { 297, 289, 288 } },
-    { { 70, 641, 1589 }, { -1, -1, -1 }, { 297, 288, 287 } },
-    { { 70, 1589, 649 }, { -1, -1, -1 }, { 297, 287, 298 } },
-    { { 71, 645, 1675 }, { -1, -1, -1 }, { 303, 294, 293 } },
-    { { 71, 1675, 650 }, { -1, -1, -1 }, { 303, 293, 304 } },
-    { { 71, 650, 1673 }, { -1, -1, -1 }, { 303, 304, 305 } },
-    { { 71, 1673, 651 }, { -1, -1, -1 }, { 303, 305, 306 } },
-    { { 71, 651, 1588 }, { -1, -1, -1 }, { 303, 306, 307 } },
-    { { 71, 1588, 652 }, { -1, -1, -1 }, { 303, 307, 308 } },
-    { { 71, 652, 1590 }, { -1, -1, -1 }, { 303, 308, 295 } },
-    { { 71, 1590, 645 }, { -1, -1, -1 }, { 303, 295, 294 } },
-    { { 72, 655, 1585 }, { -1, -1, -1 }, { 309, 310, 311 } },
-    { { 72, 1585, 653 }, { -1, -1, -1 }, { 309, 311, 312 } },
-    { { 72, 653, 1670 }, { -1, -1, -1 }, { 309, 312, 313 } },
-    { { 72, 1670, 654 }, { -1, -1, -1 }, { 309, 313, 314 } },
-    { { 72, 654, 1672 }, { -1, -1, -1 }, { 309, 314, 301 } },
-    { { 72, 1672, 647 }, { -1, -1, -1 }, { 309, 301, 300 } },
-    { { 72, 647, 1587 }, { -1, -1, -1 }, { 309, 300, 299 } },
-    { { 72, 1587, 655 }, { -1, -1, -1 }, { 309, 299, 310 } },
-    { { 73, 651, 1673 }, { -1, -1, -1 }, { 315, 306, 305 } },
-    { { 73, 1673, 656 }, { -1, -1, -1 }, { 315, 305, 316 } },
-    { { 73, 656, 1671 }, { -1, -1, -1 }, { 315, 316, 317 } },
-    { { 73, 1671, 657 }, { -1, -1, -1 }, { 315, 317, 318 } },
-    { { 73, 657, 1586 }, { -1, -1, -1 }, { 315, 318, 319 } },
-    { { 73, 1586, 658 }, { -1, -1, -1 }, { 315, 319, 320 } },
-    { { 73, 658, 1588 }, { -1, -1, -1 }, { 315, 320, 307 } },
-    { { 73, 1588, 651 }, { -1, -1, -1 }, { 315, 307, 306 } },
-    { { 74, 662, 1583 }, { -1, -1, -1 }, { 321, 322, 323 } },
-    { { 74, 1583, 659 }, { -1, -1, -1 }, { 321, 323, 324 } },
-    { { 74, 659, 1596 }, { -1, -1, -1 }, { 321, 324, 325 } },
-    { { 74, 1596, 660 }, { -1, -1, -1 }, { 321, 325, 326 } },
-    { { 74, 660, 1650 }, { -1, -1, -1 }, { 321, 326, 327 } },
-    { { 74, 1650, 661 }, { -1, -1, -1 }, { 321, 327, 328 } },
-    { { 74, 661, 1668 }, { -1, -1, -1 }, { 321, 328, 329 } },
-    { { 74, 1668, 662 }, { -1, -1, -1 }, { 321, 329, 322 } },
-    { { 75, 666, 1651 }, { -1, -1, -1 }, { 330, 331, 332 } },
-    { { 75, 1651, 663 }, { -1, -1, -1 }, { 330, 332, 333 } },
-    { { 75, 663, 1597 }, { -1, -1, -1 }, { 330, 333, 334 } },
-    { { 75, 1597, 664 }, { -1, -1, -1 }, { 330, 334, 335 } },
-    { { 75, 664, 1584 }, { -1, -1, -1 }, { 330, 335, 336 } },
-    { { 75, 1584, 665 }, { -1, -1, -1 }, { 330, 336, 337 } },
-    { { 75, 665, 1669 }, { -1, -1, -1 }, { 330, 337, 338 } },
-    { { 75, 1669, 666 }, { -1, -1, -1 }, { 330, 338, 331 } },
-    { { 76, 660, 1596 }, { -1, -1, -1 }, { 339, 326, 325 } },
-    { { 76, 1596, 667 }, { -1, -1, -1 }, { 339, 325, 340 } },
-    { { 76, 667, 1598 }, { -1, -1, -1 }, { 339, 340, 341 } },
-    { { 76, 1598, 668 }, { -1, -1, -1 }, { 339, 341, 342 } },
-    { { 76, 668, 1652 }, { -1, -1, -1 }, { 339, 342, 343 } },
-    { { 76, 1652, 669 }, { -1, -1, -1 }, { 339, 343, 344 } },
-    { { 76, 669, 1650 }, { -1, -1, -1 }, { 339, 344, 327 } },
-    { { 76, 1650, 660 }, { -1, -1, -1 }, { 339, 327, 326 } },
-    { { 77, 672, 1653 }, { -1, -1, -1 }, { 345, 346, 347 } },
-    { { 77, 1653, 670 }, { -1, -1, -1 }, { 345, 347, 348 } },
-    { { 77, 670, 1599 }, { -1, -1, -1 }, { 345, 348, 349 } },
-    { { 77, 1599, 671 }, { -1, -1, -1 }, { 345, 349, 350 } },
-    { { 77, 671, 1597 }, { -1, -1, -1 }, { 345, 350, 334 } },
-    { { 77, 1597, 663 }, { -1, -1, -1 }, { 345, 334, 333 } },
-    { { 77, 663, 1651 }, { -1, -1, -1 }, { 345, 333, 332 } },
-    { { 77, 1651, 672 }, { -1, -1, -1 }, { 345, 332, 346 } },
-    { { 78, 668, 1598 }, { -1, -1, -1 }, { 351, 342, 341 } },
-    { { 78, 1598, 673 }, { -1, -1, -1 }, { 351, 341, 352 } },
-    { { 78, 673, 1600 }, { -1, -1, -1 }, { 351, 352, 353 } },
-    { { 78, 1600, 674 }, { -1, -1, -1 }, { 351, 353, 354 } },
-    { { 78, 674, 1654 }, { -1, -1, -1 }, { 351, 354, 355 } },
-    { { 78, 1654, 675 }, { -1, -1, -1 }, { 351, 355, 356 } },
-    { { 78, 675, 1652 }, { -1, -1, -1 }, { 351, 356, 343 } },
-    { { 78, 1652, 668 }, { -1, -1, -1 }, { 351, 343, 342 } },
-    { { 79, 678, 1655 }, { -1, -1, -1 }, { 357, 358, 359 } },
-    { { 79, 1655, 676 }, { -1, -1, -1 }, { 357, 359, 360 } },
-    { { 79, 676, 1601 }, { -1, -1, -1 }, { 357, 360, 361 } },
-    { { 79, 1601, 677 }, { -1, -1, -1 }, { 357, 361, 362 } },
-    { { 79, 677, 1599 }, { -1, -1, -1 }, { 357, 362, 349 } },
-    { { 79, 1599, 670 }, { -1, -1, -1 }, { 357, 349, 348 } },
-    { { 79, 670, 1653 }, { -1, -1, -1 }, { 357, 348, 347 } },
-    { { 79, 1653, 678 }, { -1, -1, -1 }, { 357, 347, 358 } },
-    { { 80, 674, 1600 }, { -1, -1, -1 }, { 363, 354, 353 } },
-    { { 80, 1600, 679 }, { -1, -1, -1 }, { 363, 353, 364 } },
-    { { 80, 679, 1602 }, { -1, -1, -1 }, { 363, 364, 365 } },
-    { { 80, 1602, 680 }, { -1, -1, -1 }, { 363, 365, 366 } },
-    { { 80, 680, 1656 }, { -1, -1, -1 }, { 363, 366, 367 } },
-    { { 80, 1656, 681 }, { -1, -1, -1 }, { 363, 367, 368 } },
-    { { 80, 681, 1654 }, { -1, -1, -1 }, { 363, 368, 355 } },
-    { { 80, 1654, 674 }, { -1, -1, -1 }, { 363, 355, 354 } },
-    { { 81, 684, 1657 }, { -1, -1, -1 }, { 369, 370, 371 } },
-    { { 81, 1657, 682 }, { -1, -1, -1 }, { 369, 371, 372 } },
-    { { 81, 682, 1603 }, { -1, -1, -1 }, { 369, 372, 373 } },
-    { { 81, 1603, 683 }, { -1, -1, -1 }, { 369, 373, 374 } },
-    { { 81, 683, 1601 }, { -1, -1, -1 }, { 369, 374, 361 } },
-    { { 81, 1601, 676 }, { -1, -1, -1 }, { 369, 361, 360 } },
-    { { 81, 676, 1655 }, { -1, -1, -1 }, { 369, 360, 359 } },
-    { { 81, 1655, 684 }, { -1, -1, -1 }, { 369, 359, 370 } },
-    { { 82, 680, 1602 }, { -1, -1, -1 }, { 375, 366, 365 } },
-    { { 82, 1602, 685 }, { -1, -1, -1 }, { 375, 365, 376 } },
-    { { 82, 685, 1604 }, { -1, -1, -1 }, { 375, 376, 377 } },
-    { { 82, 1604, 686 }, { -1, -1, -1 }, { 375, 377, 378 } },
-    { { 82, 686, 1658 }, { -1, -1, -1 }, { 375, 378, 379 } },
-    { { 82, 1658, 687 }, { -1, -1, -1 }, { 375, 379, 380 } },
-    { { 82, 687, 1656 }, { -1, -1, -1 }, { 375, 380, 367 } },
-    { { 82, 1656, 680 }, { -1, -1, -1 }, { 375, 367, 366 } },
-    { { 83, 690, 1659 }, { -1, -1, -1 }, { 381, 382, 383 } },
-    { { 83, 1659, 688 }, { -1, -1, -1 }, { 381, 383, 384 } },
-    { { 83, 688, 1605 }, { -1, -1, -1 }, { 381, 384, 385 } },
-    { { 83, 1605, 689 }, { -1, -1, -1 }, { 381, 385, 386 } },
-    { { 83, 689, 1603 }, { -1, -1, -1 }, { 381, 386, 373 } },
-    { { 83, 1603, 682 }, { -1, -1, -1 }, { 381, 373, 372 } },
-    { { 83, 682, 1657 }, { -1, -1, -1 }, { 381, 372, 371 } },
-    { { 83, 1657, 690 }, { -1, -1, -1 }, { 381, 371, 382 } },
-    { { 84, 686, 1604 }, { -1, -1, -1 }, { 387, 378, 377 } },
-    { { 84, 1604, 691 }, { -1, -1, -1 }, { 387, 377, 388 } },
-    { { 84, 691, 1606 }, { -1, -1, -1 }, { 387, 388, 389 } },
-    { { 84, 1606, 692 }, { -1, -1, -1 }, { 387, 389, 390 } },
-    { { 84, 692, 1660 }, { -1, -1, -1 }, { 387, 390, 391 } },
-    { { 84, 1660, 693 }, { -1, -1, -1 }, { 387, 391, 392 } },
-    { { 84, 693, 1658 }, { -1, -1, -1 }, { 387, 392, 379 } },
-    { { 84, 1658, 686 }, { -1, -1, -1 }, { 387, 379, 378 } },
-    { { 85, 696, 1661 }, { -1, -1, -1 }, { 393, 394, 395 } },
-    { { 85, 1661, 694 }, { -1, -1, -1 }, { 393, 395, 396 } },
-    { { 85, 694, 1607 }, { -1, -1, -1 }, { 393, 396, 397 } },
-    { { 85, 1607, 695 }, { -1, -1, -1 }, { 393, 397, 398 } },
-    { { 85, 695, 1605 }, { -1, -1, -1 }, { 393, 398, 385 } },
-    { { 85, 1605, 688 }, { -1, -1, -1 }, { 393, 385, 384 } },
-    { { 85, 688, 1659 }, { -1, -1, -1 }, { 393, 384, 383 } },
-    { { 85, 1659, 696 }, { -1, -1, -1 }, { 393, 383, 394 } },
-    { { 86, 692, 1606 }, { -1, -1, -1 }, { 399, 390, 389 } },
-    { { 86, 1606, 697 }, { -1, -1, -1 }, { 399, 389, 400 } },
-    { { 86, 697, 1608 }, { -1, -1, -1 }, { 399, 400, 401 } },
-    { { 86, 1608, 698 }, { -1, -1, -1 }, { 399, 401, 402 } },
-    { { 86, 698, 1662 }, { -1, -1, -1 }, { 399, 402, 403 } },
-    { { 86, 1662, 699 }, { -1, -1, -1 }, { 399, 403, 404 } },
-    { { 86, 699, 1660 }, { -1, -1, -1 }, { 399, 404, 391 } },
-    { { 86, 1660, 692 }, { -1, -1, -1 }, { 399, 391, 390 } },
-    { { 87, 702, 1663 }, { -1, -1, -1 }, { 405, 406, 407 } },
-    { { 87, 1663, 700 }, { -1, -1, -1 }, { 405, 407, 408 } },
-    { { 87, 700, 1609 }, { -1, -1, -1 }, { 405, 408, 409 } },
-    { { 87, 1609, 701 }, { -1, -1, -1 }, { 405, 409, 410 } },
-    { { 87, 701, 1607 }, { -1, -1, -1 }, { 405, 410, 397 } },
-    { { 87, 1607, 694 }, { -1, -1, -1 }, { 405, 397, 396 } },
-    { { 87, 694, 1661 }, { -1, -1, -1 }, { 405, 396, 395 } },
-    { { 87, 1661, 702 }, { -1, -1, -1 }, { 405, 395, 406 } },
-    { { 88, 698, 1608 }, { -1, -1, -1 }, { 411, 402, 401 } },
-    { { 88, 1608, 703 }, { -1, -1, -1 }, { 411, 401, 412 } },
-    { { 88, 703, 1610 }, { -1, -1, -1 }, { 411, 412, 413 } },
-    { { 88, 1610, 704 }, { -1, -1, -1 }, { 411, 413, 414 } },
-    { { 88, 704, 1664 }, { -1, -1, -1 }, { 411, 414, 415 } },
-    { { 88, 1664, 705 }, { -1, -1, -1 }, { 411, 415, 416 } },
-    { { 88, 705, 1662 }, { -1, -1, -1 }, { 411, 416, 403 } },
-    { { 88, 1662, 698 }, { -1, -1, -1 }, { 411, 403, 402 } },
-    { { 89, 708, 1665 }, { -1, -1, -1 }, { 417, 418, 419 } },
-    { { 89, 1665, 706 }, { -1, -1, -1 }, { 417, 419, 420 } },
-    { { 89, 706, 1611 }, { -1, -1, -1 }, { 417, 420, 421 } },
-    { { 89, 1611, 707 }, { -1, -1, -1 }, { 417, 421, 422 } },
-    { { 89, 707, 1609 }, { -1, -1, -1 }, { 417, 422, 409 } },
-    { { 89, 1609, 700 }, { -1, -1, -1 }, { 417, 409, 408 } },
-    { { 89, 700, 1663 }, { -1, -1, -1 }, { 417, 408, 407 } },
-    { { 89, 1663, 708 }, { -1, -1, -1 }, { 417, 407, 418 } },
-    { { 90, 704, 1610 }, { -1, -1, -1 }, { 423, 414, 413 } },
-    { { 90, 1610, 709 }, { -1, -1, -1 }, { 423, 413, 424 } },
-    { { 90, 709, 1612 }, { -1, -1, -1 }, { 423, 424, 425 } },
-    { { 90, 1612, 710 }, { -1, -1, -1 }, { 423, 425, 426 } },
-    { { 90, 710, 1666 }, { -1, -1, -1 }, { 423, 426, 427 } },
-    { { 90, 1666, 711 }, { -1, -1, -1 }, { 423, 427, 428 } },
-    { { 90, 711, 1664 }, { -1, -1, -1 }, { 423, 428, 415 } },
-    { { 90, 1664, 704 }, { -1, -1, -1 }, { 423, 415, 414 } },
-    { { 91, 714, 1667 }, { -1, -1, -1 }, { 429, 430, 431 } },
-    { { 91, 1667, 712 }, { -1, -1, -1 }, { 429, 431, 432 } },
-    { { 91, 712, 1613 }, { -1, -1, -1 }, { 429, 432, 433 } },
-    { { 91, 1613, 713 }, { -1, -1, -1 }, { 429, 433, 434 } },
-    { { 91, 713, 1611 }, { -1, -1, -1 }, { 429, 434, 421 } },
-    { { 91, 1611, 706 }, { -1, -1, -1 }, { 429, 421, 420 } },
-    { { 91, 706, 1665 }, { -1, -1, -1 }, { 429, 420, 419 } },
-    { { 91, 1665, 714 }, { -1, -1, -1 }, { 429, 419, 430 } },
-    { { 92, 710, 1612 }, { -1, -1, -1 }, { 435, 426, 425 } },
-    { { 92, 1612, 715 }, { -1, -1, -1 }, { 435, 425, 436 } },
-    { { 92, 715, 1571 }, { -1, -1, -1 }, { 435, 436, 437 } },
-    { { 92, 1571, 716 }, { -1, -1, -1 }, { 435, 437, 438 } },
-    { { 92, 716, 1572 }, { -1, -1, -1 }, { 435, 438, 439 } },
-    { { 92, 1572, 717 }, { -1, -1, -1 }, { 435, 439, 440 } },
-    { { 92, 717, 1666 }, { -1, -1, -1 }, { 435, 440, 427 } },
-    { { 92, 1666, 710 }, { -1, -1, -1 }, { 435, 427, 426 } },
-    { { 93, 719, 1572 }, { -1, -1, -1 }, { 441, 442, 439 } },
-    { { 93, 1572, 716 }, { -1, -1, -1 }, { 441, 439, 438 } },
-    { { 93, 716, 1571 }, { -1, -1, -1 }, { 441, 438, 437 } },
-    { { 93, 1571, 718 }, { -1, -1, -1 }, { 441, 437, 443 } },
-    { { 93, 718, 1613 }, { -1, -1, -1 }, { 441, 443, 433 } },
-    { { 93, 1613, 712 }, { -1, -1, -1 }, { 441, 433, 432 } },
-    { { 93, 712, 1667 }, { -1, -1, -1 }, { 441, 432, 431 } },
-    { { 93, 1667, 719 }, { -1, -1, -1 }, { 441, 431, 442 } },
-    { { 94, 722, 1614 }, { -1, -1, -1 }, { 444, 445, 446 } },
-    { { 94, 1614, 720 }, { -1, -1, -1 }, { 444, 446, 447 } },
-    { { 94, 720, 1632 }, { -1, -1, -1 }, { 444, 447, 448 } },
-    { { 94, 1632, 721 }, { -1, -1, -1 }, { 444, 448, 449 } },
-    { { 94, 721, 1664 }, { -1, -1, -1 }, { 444, 449, 415 } },
-    { { 94, 1664, 711 }, { -1, -1, -1 }, { 444, 415, 428 } },
-    { { 94, 711, 1666 }, { -1, -1, -1 }, { 444, 428, 427 } },
-    { { 94, 1666, 722 }, { -1, -1, -1 }, { 444, 427, 445 } },
-    { { 95, 714, 1665 }, { -1, -1, -1 }, { 450, 430, 419 } },
-    { { 95, 1665, 723 }, { -1, -1, -1 }, { 450, 419, 451 } },
-    { { 95, 723, 1633 }, { -1, -1, -1 }, { 450, 451, 452 } },
-    { { 95, 1633, 724 }, { -1, -1, -1 }, { 450, 452, 453 } },
-    { { 95, 724, 1615 }, { -1, -1, -1 }, { 450, 453, 454 } },
-    { { 95, 1615, 725 }, { -1, -1, -1 }, { 450, 454, 455 } },
-    { { 95, 725, 1667 }, { -1, -1, -1 }, { 450, 455, 431 } },
-    { { 95, 1667, 714 }, { -1, -1, -1 }, { 450, 431, 430 } },
-    { { 96, 721, 1632 }, { -1, -1, -1 }, { 456, 449, 448 } },
-    { { 96, 1632, 726 }, { -1, -1, -1 }, { 456, 448, 457 } },
-    { { 96, 726, 1683 }, { -1, -1, -1 }, { 456, 457, 458 } },
-    { { 96, 1683, 727 }, { -1, -1, -1 }, { 456, 458, 459 } },
-    { { 96, 727, 1662 }, { -1, -1, -1 }, { 456, 459, 403 } },
-    { { 96, 1662, 705 }, { -1, -1, -1 }, { 456, 403, 416 } },
-    { { 96, 705, 1664 }, { -1, -1, -1 }, { 456, 416, 415 } },
-    { { 96, 1664, 721 }, { -1, -1, -1 }, { 456, 415, 449 } },
-    { { 97, 708, 1663 }, { -1, -1, -1 }, { 460, 418, 407 } },
-    { { 97, 1663, 728 }, { -1, -1, -1 }, { 460, 407, 461 } },
-    { { 97, 728, 1684 }, { -1, -1, -1 }, { 460, 461, 462 } },
-    { { 97, 1684, 729 }, { -1, -1, -1 }, { 460, 462, 463 } },
-    { { 97, 729, 1633 }, { -1, -1, -1 }, { 460, 463, 452 } },
-    { { 97, 1633, 723 }, { -1, -1, -1 }, { 460, 452, 451 } },
-    { { 97, 723, 1665 }, { -1, -1, -1 }, { 460, 451, 419 } },
-    { { 97, 1665, 708 }, { -1, -1, -1 }, { 460, 419, 418 } },
-    { { 98, 731, 1630 }, { -1, -1, -1 }, { 464, 465, 466 } },
-    { { 98, 1630, 730 }, { -1, -1, -1 }, { 464, 466, 467 } },
-    { { 98, 730, 1660 }, { -1, -1, -1 }, { 464, 467, 391 } },
-    { { 98, 1660, 699 }, { -1, -1, -1 }, { 464, 391, 404 } },
-    { { 98, 699, 1662 }, { -1, -1, -1 }, { 464, 404, 403 } },
-    { { 98, 1662, 727 }, { -1, -1, -1 }, { 464, 403, 459 } },
-    { { 98, 727, 1683 }, { -1, -1, -1 }, { 464, 459, 458 } },
-    { { 98, 1683, 731 }, { -1, -1, -1 }, { 464, 458, 465 } },
-    { { 99, 728, 1663 }, { -1, -1, -1 }, { 468, 461, 407 } },
-    { { 99, 1663, 702 }, { -1, -1, -1 }, { 468, 407, 406 } },
-    { { 99, 702, 1661 }, { -1, -1, -1 }, { 468, 406, 395 } },
-    { { 99, 1661, 732 }, { -1, -1, -1 }, { 468, 395, 469 } },
-    { { 99, 732, 1631 }, { -1, -1, -1 }, { 468, 469, 470 } },
-    { { 99, 1631, 733 }, { -1, -1, -1 }, { 468, 470, 471 } },
-    { { 99, 733, 1684 }, { -1, -1, -1 }, { 468, 471, 462 } },
-    { { 99, 1684, 728 }, { -1, -1, -1 }, { 468, 462, 461 } },
-    { { 100, 735, 1628 }, { -1, -1, -1 }, { 472, 473, 474 } },
-    { { 100, 1628, 734 }, { -1, -1, -1 }, { 472, 474, 475 } },
-    { { 100, 734, 1658 }, { -1, -1, -1 }, { 472, 475, 379 } },
-    { { 100, 1658, 693 }, { -1, -1, -1 }, { 472, 379, 392 } },
-    { { 100, 693, 1660 }, { -1, -1, -1 }, { 472, 392, 391 } },
-    { { 100, 1660, 730 }, { -1, -1, -1 }, { 472, 391, 467 } },
-    { { 100, 730, 1630 }, { -1, -1, -1 }, { 472, 467, 466 } },
-    { { 100, 1630, 735 }, { -1, -1, -1 }, { 472, 466, 473 } },
-    { { 101, 732, 1661 }, { -1, -1, -1 }, { 476, 469, 395 } },
-    { { 101, 1661, 696 }, { -1, -1, -1 }, { 476, 395, 394 } },
-    { { 101, 696, 1659 }, { -1, -1, -1 }, { 476, 394, 383 } },
-    { { 101, 1659, 736 }, { -1, -1, -1 }, { 476, 383, 477 } },
-    { { 101, 736, 1629 }, { -1, -1, -1 }, { 476, 477, 478 } },
-    { { 101, 1629, 737 }, { -1, -1, -1 }, { 476, 478, 479 } },
-    { { 101, 737, 1631 }, { -1, -1, -1 }, { 476, 479, 470 } },
-    { { 101, 1631, 732 }, { -1, -1, -1 }, { 476, 470, 469 } },
-    { { 102, 739, 1626 }, { -1, -1, -1 }, { 480, 481, 482 } },
-    { { 102, 1626, 738 }, { -1, -1, -1 }, { 480, 482, 483 } },
-    { { 102, 738, 1656 }, { -1, -1, -1 }, { 480, 483, 367 } },
-    { { 102, 1656, 687 }, { -1, -1, -1 }, { 480, 367, 380 } },
-    { { 102, 687, 1658 }, { -1, -1, -1 }, { 480, 380, 379 } },
-    { { 102, 1658, 734 }, { -1, -1, -1 }, { 480, 379, 475 } },
-    { { 102, 734, 1628 }, { -1, -1, -1 }, { 480, 475, 474 } },
-    { { 102, 1628, 739 }, { -1, -1, -1 }, { 480, 474, 481 } },
-    { { 103, 736, 1659 }, { -1, -1, -1 }, { 484, 477, 383 } },
-    { { 103, 1659, 690 }, { -1, -1, -1 }, { 484, 383, 382 } },
-    { { 103, 690, 1657 }, { -1, -1, -1 }, { 484, 382, 371 } },
-    { { 103, 1657, 740 }, { -1, -1, -1 }, { 484, 371, 485 } },
-    { { 103, 740, 1627 }, { -1, -1, -1 }, { 484, 485, 486 } },
-    { { 103, 1627, 741 }, { -1, -1, -1 }, { 484, 486, 487 } },
-    { { 103, 741, 1629 }, { -1, -1, -1 }, { 484, 487, 478 } },
-    { { 103, 1629, 736 }, { -1, -1, -1 }, { 484, 478, 477 } },
-    { { 104, 743, 1624 }, { -1, -1, -1 }, { 488, 489, 490 } },
-    { { 104, 1624, 742 }, { -1, -1, -1 }, { 488, 490, 491 } },
-    { { 104, 742, 1654 }, { -1, -1, -1 }, { 488, 491, 355 } },
-    { { 104, 1654, 681 }, { -1, -1, -1 }, { 488, 355, 368 } },
-    { { 104, 681, 1656 }, { -1, -1, -1 }, { 488, 368, 367 } },
-    { { 104, 1656, 738 }, { -1, -1, -1 }, { 488, 367, 483 } },
-    { { 104, 738, 1626 }, { -1, -1, -1 }, { 488, 483, 482 } },
-    { { 104, 1626, 743 }, { -1, -1, -1 }, { 488, 482, 489 } },
-    { { 105, 740, 1657 }, { -1, -1, -1 }, { 492, 485, 371 } },
-    { { 105, 1657, 684 }, { -1, -1, -1 }, { 492, 371, 370 } },
-    { { 105, 684, 1655 }, { -1, -1, -1 }, { 492, 370, 359 } },
-    { { 105, 1655, 744 }, { -1, -1, -1 }, { 492, 359, 493 } },
-    { { 105, 744, 1625 }, { -1, -1, -1 }, { 492, 493, 494 } },
-    { { 105, 1625, 745 }, { -1, -1, -1 }, { 492, 494, 495 } },
-    { { 105, 745, 1627 }, { -1, -1, -1 }, { 492, 495, 486 } },
-    { { 105, 1627, 740 }, { -1, -1, -1 }, { 492, 486, 485 } },
-    { { 106, 747, 1622 }, { -1, -1, -1 }, { 496, 497, 498 } },
-    { { 106, 1622, 746 }, { -1, -1, -1 }, { 496, 498, 499 } },
-    { { 106, 746, 1652 }, { -1, -1, -1 }, { 496, 499, 343 } },
-    { { 106, 1652, 675 }, { -1, -1, -1 }, { 496, 343, 356 } },
-    { { 106, 675, 1654 }, { -1, -1, -1 }, { 496, 356, 355 } },
-    { { 106, 1654, 742 }, { -1, -1, -1 }, { 496, 355, 491 } },
-    { { 106, 742, 1624 }, { -1, -1, -1 }, { 496, 491, 490 } },
-    { { 106, 1624, 747 }, { -1, -1, -1 }, { 496, 490, 497 } },
-    { { 107, 744, 1655 }, { -1, -1, -1 }, { 500, 493, 359 } },
-    { { 107, 1655, 678 }, { -1, -1, -1 }, { 500, 359, 358 } },
-    { { 107, 678, 1653 }, { -1, -1, -1 }, { 500, 358, 347 } },
-    { { 107, 1653, 748 }, { -1, -1, -1 }, { 500, 347, 501 } },
-    { { 107, 748, 1623 }, { -1, -1, -1 }, { 500, 501, 502 } },
-    { { 107, 1623, 749 }, { -1, -1, -1 }, { 500, 502, 503 } },
-    { { 107, 749, 1625 }, { -1, -1, -1 }, { 500, 503, 494 } },
-    { { 107, 1625, 744 }, { -1, -1, -1 }, { 500, 494, 493 } },
-    { { 108, 751, 1620 }, { -1, -1, -1 }, { 504, 505, 506 } },
-    { { 108, 1620, 750 }, { -1, -1, -1 }, { 504, 506, 507 } },
-    { { 108, 750, 1650 }, { -1, -1, -1 }, { 504, 507, 327 } },
-    { { 108, 1650, 669 }, { -1, -1, -1 }, { 504, 327, 344 } },
-    { { 108, 669, 1652 }, { -1, -1, -1 }, { 504, 344, 343 } },
-    { { 108, 1652, 746 }, { -1, -1, -1 }, { 504, 343, 499 } },
-    { { 108, 746, 1622 }, { -1, -1, -1 }, { 504, 499, 498 } },
-    { { 108, 1622, 751 }, { -1, -1, -1 }, { 504, 498, 505 } },
-    { { 109, 748, 1653 }, { -1, -1, -1 }, { 508, 501, 347 } },
-    { { 109, 1653, 672 }, { -1, -1, -1 }, { 508, 347, 346 } },
-    { { 109, 672, 1651 }, { -1, -1, -1 }, { 508, 346, 332 } },
-    { { 109, 1651, 752 }, { -1, -1, -1 }, { 508, 332, 509 } },
-    { { 109, 752, 1621 }, { -1, -1, -1 }, { 508, 509, 510 } },
-    { { 109, 1621, 753 }, { -1, -1, -1 }, { 508, 510, 511 } },
-    { { 109, 753, 1623 }, { -1, -1, -1 }, { 508, 511, 502 } },
-    { { 109, 1623, 748 }, { -1, -1, -1 }, { 508, 502, 501 } },
-    { { 110, 755, 1618 }, { -1, -1, -1 }, { 512, 513, 514 } },
-    { { 110, 1618, 754 }, { -1, -1, -1 }, { 512, 514, 515 } },
-    { { 110, 754, 1668 }, { -1, -1, -1 }, { 512, 515, 329 } },
-    { { 110, 1668, 661 }, { -1, -1, -1 }, { 512, 329, 328 } },
-    { { 110, 661, 1650 }, { -1, -1, -1 }, { 512, 328, 327 } },
-    { { 110, 1650, 750 }, { -1, -1, -1 }, { 512, 327, 507 } },
-    { { 110, 750, 1620 }, { -1, -1, -1 }, { 512, 507, 506 } },
-    { { 110, 1620, 755 }, { -1, -1, -1 }, { 512, 506, 513 } },
-    { { 111, 752, 1651 }, { -1, -1, -1 }, { 516, 509, 332 } },
-    { { 111, 1651, 666 }, { -1, -1, -1 }, { 516, 332, 331 } },
-    { { 111, 666, 1669 }, { -1, -1, -1 }, { 516, 331, 338 } },
-    { { 111, 1669, 756 }, { -1, -1, -1 }, { 516, 338, 517 } },
-    { { 111, 756, 1619 }, { -1, -1, -1 }, { 516, 517, 518 } },
-    { { 111, 1619, 757 }, { -1, -1, -1 }, { 516, 518, 519 } },
-    { { 111, 757, 1621 }, { -1, -1, -1 }, { 516, 519, 510 } },
-    { { 111, 1621, 752 }, { -1, -1, -1 }, { 516, 510, 509 } },
-    { { 112, 754, 1618 }, { -1, -1, -1 }, { 520, 515, 514 } },
-    { { 112, 1618, 758 }, { -1, -1, -1 }, { 520, 514, 521 } },
-    { { 112, 758, 1685 }, { -1, -1, -1 }, { 520, 521, 522 } },
-    { { 112, 1685, 759 }, { -1, -1, -1 }, { 520, 522, 523 } },
-    { { 112, 759, 1681 }, { -1, -1, -1 }, { 520, 523, 524 } },
-    { { 112, 1681, 760 }, { -1, -1, -1 }, { 520, 524, 525 } },
-    { { 112, 760, 1668 }, { -1, -1, -1 }, { 520, 525, 329 } },
-    { { 112, 1668, 754 }, { -1, -1, -1 }, { 520, 329, 515 } },
-    { { 113, 763, 1681 }, { -1, -1, -1 }, { 526, 527, 524 } },
-    { { 113, 1681, 761 }, { -1, -1, -1 }, { 526, 524, 528 } },
-    { { 113, 761, 1686 }, { -1, -1, -1 }, { 526, 528, 529 } },
-    { { 113, 1686, 762 }, { -1, -1, -1 }, { 526, 529, 530 } },
-    { { 113, 762, 1619 }, { -1, -1, -1 }, { 526, 530, 518 } },
-    { { 113, 1619, 756 }, { -1, -1, -1 }, { 526, 518, 517 } },
-    { { 113, 756, 1669 }, { -1, -1, -1 }, { 526, 517, 338 } },
-    { { 113, 1669, 763 }, { -1, -1, -1 }, { 526, 338, 527 } },
-    { { 114, 765, 1614 }, { -1, -1, -1 }, { 531, 532, 446 } },
-    { { 114, 1614, 722 }, { -1, -1, -1 }, { 531, 446, 445 } },
-    { { 114, 722, 1666 }, { -1, -1, -1 }, { 531, 445, 427 } },
-    { { 114, 1666, 717 }, { -1, -1, -1 }, { 531, 427, 440 } },
-    { { 114, 717, 1572 }, { -1, -1, -1 }, { 531, 440, 439 } },
-    { { 114, 1572, 764 }, { -1, -1, -1 }, { 531, 439, 533 } },
-    { { 114, 764, 1616 }, { -1, -1, -1 }, { 531, 533, 534 } },
-    { { 114, 1616, 765 }, { -1, -1, -1 }, { 531, 534, 532 } },
-    { { 115, 767, 1572 }, { -1, -1, -1 }, { 535, 536, 439 } },
-    { { 115, 1572, 719 }, { -1, -1, -1 }, { 535, 439, 442 } },
-    { { 115, 719, 1667 }, { -1, -1, -1 }, { 535, 442, 431 } },
-    { { 115, 1667, 725 }, { -1, -1, -1 }, { 535, 431, 455 } },
-    { { 115, 725, 1615 }, { -1, -1, -1 }, { 535, 455, 454 } },
-    { { 115, 1615, 766 }, { -1, -1, -1 }, { 535, 454, 537 } },
-    { { 115, 766, 1617 }, { -1, -1, -1 }, { 535, 537, 538 } },
-    { { 115, 1617, 767 }, { -1, -1, -1 }, { 535, 538, 536 } },
-    { { 116, 770, 1616 }, { -1, -1, -1 }, { 539, 540, 534 } },
-    { { 116, 1616, 764 }, { -1, -1, -1 }, { 539, 534, 533 } },
-    { { 116, 764, 1572 }, { -1, -1, -1 }, { 539, 533, 439 } },
-    { { 116, 1572, 768 }, { -1, -1, -1 }, { 539, 439, 541 } },
-    { { 116, 768, 1682 }, { -1, -1, -1 }, { 539, 541, 542 } },
-    { { 116, 1682, 769 }, { -1, -1, -1 }, { 539, 542, 543 } },
-    { { 116, 769, 1687 }, { -1, -1, -1 }, { 539, 543, 544 } },
-    { { 116, 1687, 770 }, { -1, -1, -1 }, { 539, 544, 540 } },
-    { { 117, 772, 1682 }, { -1, -1, -1 }, { 545, 546, 542 } },
-    { { 117, 1682, 768 }, { -1, -1, -1 }, { 545, 542, 541 } },
-    { { 117, 768, 1572 }, { -1, -1, -1 }, { 545, 541, 439 } },
-    { { 117, 1572, 767 }, { -1, -1, -1 }, { 545, 439, 536 } },
-    { { 117, 767, 1617 }, { -1, -1, -1 }, { 545, 536, 538 } },
-    { { 117, 1617, 771 }, { -1, -1, -1 }, { 545, 538, 547 } },
-    { { 117, 771, 1688 }, { -1, -1, -1 }, { 545, 547, 548 } },
-    { { 117, 1688, 772 }, { -1, -1, -1 }, { 545, 548, 546 } },
-    { { 118, 774, 1681 }, { -1, -1, -1 }, { 549, 550, 524 } },
-    { { 118, 1681, 759 }, { -1, -1, -1 }, { 549, 524, 523 } },
-    { { 118, 759, 1685 }, { -1, -1, -1 }, { 549, 523, 522 } },
-    { { 118, 1685, 773 }, { -1, -1, -1 }, { 549, 522, 551 } },
-    { { 118, 773, 1687 }, { -1, -1, -1 }, { 549, 551, 544 } },
-    { { 118, 1687, 769 }, { -1, -1, -1 }, { 549, 544, 543 } },
-    { { 118, 769, 1682 }, { -1, -1, -1 }, { 549, 543, 542 } },
-    { { 118, 1682, 774 }, { -1, -1, -1 }, { 549, 542, 550 } },
-    { { 119, 772, 1688 }, { -1, -1, -1 }, { 552, 546, 548 } },
-    { { 119, 1688, 775 }, { -1, -1, -1 }, { 552, 548, 553 } },
-    { { 119, 775, 1686 }, { -1, -1, -1 }, { 552, 553, 529 } },
-    { { 119, 1686, 761 }, { -1, -1, -1 }, { 552, 529, 528 } },
-    { { 119, 761, 1681 }, { -1, -1, -1 }, { 552, 528, 524 } },
-    { { 119, 1681, 774 }, { -1, -1, -1 }, { 552, 524, 550 } },
-    { { 119, 774, 1682 }, { -1, -1, -1 }, { 552, 550, 542 } },
-    { { 119, 1682, 772 }, { -1, -1, -1 }, { 552, 542, 546 } },
-    { { 120, 778, 1639 }, { -1, -1, -1 }, { 554, 555, 556 } },
-    { { 120, 1639, 776 }, { -1, -1, -1 }, { 554, 556, 557 } },
-    { { 120, 776, 1641 }, { -1, -1, -1 }, { 554, 557, 558 } },
-    { { 120, 1641, 777 }, { -1, -1, -1 }, { 554, 558, 559 } },
-    { { 120, 777, 1680 }, { -1, -1, -1 }, { 554, 559, 264 } },
-    { { 120, 1680, 629 }, { -1, -1, -1 }, { 554, 264, 263 } },
-    { { 120, 629, 1678 }, { -1, -1, -1 }, { 554, 263, 262 } },
-    { { 120, 1678, 778 }, { -1, -1, -1 }, { 554, 262, 555 } },
-    { { 121, 632, 1680 }, { -1, -1, -1 }, { 560, 268, 264 } },
-    { { 121, 1680, 777 }, { -1, -1, -1 }, { 560, 264, 559 } },
-    { { 121, 777, 1641 }, { -1, -1, -1 }, { 560, 559, 558 } },
-    { { 121, 1641, 779 }, { -1, -1, -1 }, { 560, 558, 561 } },
-    { { 121, 779, 1640 }, { -1, -1, -1 }, { 560, 561, 562 } },
-    { { 121, 1640, 780 }, { -1, -1, -1 }, { 560, 562, 563 } },
-    { { 121, 780, 1679 }, { -1, -1, -1 }, { 560, 563, 269 } },
-    { { 121, 1679, 632 }, { -1, -1, -1 }, { 560, 269, 268 } },
-    { { 122, 782, 1637 }, { -1, -1, -1 }, { 564, 565, 566 } },
-    { { 122, 1637, 781 }, { -1, -1, -1 }, { 564, 566, 567 } },
-    { { 122, 781, 1639 }, { -1, -1, -1 }, { 564, 567, 556 } },
-    { { 122, 1639, 778 }, { -1, -1, -1 }, { 564, 556, 555 } },
-    { { 122, 778, 1678 }, { -1, -1, -1 }, { 564, 555, 262 } },
-    { { 122, 1678, 636 }, { -1, -1, -1 }, { 564, 262, 278 } },
-    { { 122, 636, 1676 }, { -1, -1, -1 }, { 564, 278, 277 } },
-    { { 122, 1676, 782 }, { -1, -1, -1 }, { 564, 277, 565 } },
-    { { 123, 638, 1679 }, { -1, -1, -1 }, { 568, 280, 269 } },
-    { { 123, 1679, 780 }, { -1, -1, -1 }, { 568, 269, 563 } },
-    { { 123, 780, 1640 }, { -1, -1, -1 }, { 568, 563, 562 } },
-    { { 123, 1640, 783 }, { -1, -1, -1 }, { 568, 562, 569 } },
-    { { 123, 783, 1638 }, { -1, -1, -1 }, { 568, 569, 570 } },
-    { { 123, 1638, 784 }, { -1, -1, -1 }, { 568, 570, 571 } },
-    { { 123, 784, 1677 }, { -1, -1, -1 }, { 568, 571, 281 } },
-    { { 123, 1677, 638 }, { -1, -1, -1 }, { 568, 281, 280 } },
-    { { 124, 786, 1635 }, { -1, -1, -1 }, { 572, 573, 574 } },
-    { { 124, 1635, 785 }, { -1, -1, -1 }, { 572, 574, 575 } },
-    { { 124, 785, 1637 }, { -1, -1, -1 }, { 572, 575, 566 } },
-    { { 124, 1637, 782 }, { -1, -1, -1 }, { 572, 566, 565 } },
-    { { 124, 782, 1676 }, { -1, -1, -1 }, { 572, 565, 277 } },
-    { { 124, 1676, 642 }, { -1, -1, -1 }, { 572, 277, 290 } },
-    { { 124, 642, 1674 }, { -1, -1, -1 }, { 572, 290, 289 } },
-    { { 124, 1674, 786 }, { -1, -1, -1 }, { 572, 289, 573 } },
-    { { 125, 644, 1677 }, { -1, -1, -1 }, { 576, 292, 281 } },
-    { { 125, 1677, 784 }, { -1, -1, -1 }, { 576, 281, 571 } },
-    { { 125, 784, 1638 }, { -1, -1, -1 }, { 576, 571, 570 } },
-    { { 125, 1638, 787 }, { -1, -1, -1 }, { 576, 570, 577 } },
-    { { 125, 787, 1636 }, { -1, -1, -1 }, { 576, 577, 578 } },
-    { { 125, 1636, 788 }, { -1, -1, -1 }, { 576, 578, 579 } },
-    { { 125, 788, 1675 }, { -1, -1, -1 }, { 576, 579, 293 } },
-    { { 125, 1675, 644 }, { -1, -1, -1 }, { 576, 293, 292 } },
-    { { 126, 654, 1670 }, { -1, -1, -1 }, { 580, 314, 313 } },
-    { { 126, 1670, 789 }, { -1, -1, -1 }, { 580, 313, 581 } },
-    { { 126, 789, 1691 }, { -1, -1, -1 }, { 580, 581, 582 } },
-    { { 126, 1691, 790 }, { -1, -1, -1 }, { 580, 582, 583 } },
-    { { 126, 790, 1689 }, { -1, -1, -1 }, { 580, 583, 584 } },
-    { { 126, 1689, 791 }, { -1, -1, -1 }, { 580, 584, 585 } },
-    { { 126, 791, 1672 }, { -1, -1, -1 }, { 580, 585, 301 } },
-    { { 126, 1672, 654 }, { -1, -1, -1 }, { 580, 301, 314 } },
-    { { 127, 794, 1690 }, { -1, -1, -1 }, { 586, 587, 588 } },
-    { { 127, 1690, 792 }, { -1, -1, -1 }, { 586, 588, 589 } },
-    { { 127, 792, 1692 }, { -1, -1, -1 }, { 586, 589, 590 } },
-    { { 127, 1692, 793 }, { -1, -1, -1 }, { 586, 590, 591 } },
-    { { 127, 793, 1671 }, { -1, -1, -1 }, { 586, 591, 317 } },
-    { { 127, 1671, 656 }, { -1, -1, -1 }, { 586, 317, 316 } },
-    { { 127, 656, 1673 }, { -1, -1, -1 }, { 586, 316, 305 } },
-    { { 127, 1673, 794 }, { -1, -1, -1 }, { 586, 305, 587 } },
-    { { 128, 795, 1635 }, { -1, -1, -1 }, { 592, 593, 574 } },
-    { { 128, 1635, 786 }, { -1, -1, -1 }, { 592, 574, 573 } },
-    { { 128, 786, 1674 }, { -1, -1, -1 }, { 592, 573, 289 } },
-    { { 128, 1674, 648 }, { -1, -1, -1 }, { 592, 289, 302 } },
-    { { 128, 648, 1672 }, { -1, -1, -1 }, { 592, 302, 301 } },
-    { { 128, 1672, 791 }, { -1, -1, -1 }, { 592, 301, 585 } },
-    { { 128, 791, 1689 }, { -1, -1, -1 }, { 592, 585, 584 } },
-    { { 128, 1689, 795 }, { -1, -1, -1 }, { 592, 584, 593 } },
-    { { 129, 794, 1673 }, { -1, -1, -1 }, { 594, 587, 305 } },
-    { { 129, 1673, 650 }, { -1, -1, -1 }, { 594, 305, 304 } },
-    { { 129, 650, 1675 }, { -1, -1, -1 }, { 594, 304, 293 } },
-    { { 129, 1675, 788 }, { -1, -1, -1 }, { 594, 293, 579 } },
-    { { 129, 788, 1636 }, { -1, -1, -1 }, { 594, 579, 578 } },
-    { { 129, 1636, 796 }, { -1, -1, -1 }, { 594, 578, 595 } },
-    { { 129, 796, 1690 }, { -1, -1, -1 }, { 594, 595, 588 } },
-    { { 129, 1690, 794 }, { -1, -1, -1 }, { 594, 588, 587 } },
-    { { 130, 800, 1648 }, { -1, -1, -1 }, { 596, 597, 598 } },
-    { { 130, 1648, 797 }, { -1, -1, -1 }, { 596, 598, 599 } },
-    { { 130, 797, 1694 }, { -1, -1, -1 }, { 596, 599, 600 } },
-    { { 130, 1694, 798 }, { -1, -1, -1 }, { 596, 600, 601 } },
-    { { 130, 798, 1693 }, { -1, -1, -1 }, { 596, 601, 602 } },
-    { { 130, 1693, 799 }, { -1, -1, -1 }, { 596, 602, 603 } },
-    { { 130, 799, 1691 }, { -1, -1, -1 }, { 596, 603, 582 } },
-    { { 130, 1691, 800 }, { -1, -1, -1 }, { 596, 582, 597 } },
-    { { 131, 803, 1693 }, { -1, -1, -1 }, { 604, 605, 602 } },
-    { { 131, 1693, 798 }, { -1, -1, -1 }, { 604, 602, 601 } },
-    { { 131, 798, 1694 }, { -1, -1, -1 }, { 604, 601, 600 } },
-    { { 131, 1694, 801 }, { -1, -1, -1 }, { 604, 600, 606 } },
-    { { 131, 801, 1649 }, { -1, -1, -1 }, { 604, 606, 607 } },
-    { { 131, 1649, 802 }, { -1, -1, -1 }, { 604, 607, 608 } },
-    { { 131, 802, 1692 }, { -1, -1, -1 }, { 604, 608, 590 } },
-    { { 131, 1692, 803 }, { -1, -1, -1 }, { 604, 590, 605 } },
-    { { 132, 805, 1689 }, { -1, -1, -1 }, { 609, 610, 584 } },
-    { { 132, 1689, 790 }, { -1, -1, -1 }, { 609, 584, 583 } },
-    { { 132, 790, 1691 }, { -1, -1, -1 }, { 609, 583, 582 } },
-    { { 132, 1691, 799 }, { -1, -1, -1 }, { 609, 582, 603 } },
-    { { 132, 799, 1693 }, { -1, -1, -1 }, { 609, 603, 602 } },
-    { { 132, 1693, 804 }, { -1, -1, -1 }, { 609, 602, 611 } },
-    { { 132, 804, 1573 }, { -1, -1, -1 }, { 609, 611, 612 } },
-    { { 132, 1573, 805 }, { -1, -1, -1 }, { 609, 612, 610 } },
-    { { 133, 804, 1693 }, { -1, -1, -1 }, { 613, 611, 602 } },
-    { { 133, 1693, 803 }, { -1, -1, -1 }, { 613, 602, 605 } },
-    { { 133, 803, 1692 }, { -1, -1, -1 }, { 613, 605, 590 } },
-    { { 133, 1692, 792 }, { -1, -1, -1 }, { 613, 590, 589 } },
-    { { 133, 792, 1690 }, { -1, -1, -1 }, { 613, 589, 588 } },
-    { { 133, 1690, 806 }, { -1, -1, -1 }, { 613, 588, 614 } },
-    { { 133, 806, 1573 }, { -1, -1, -1 }, { 613, 614, 612 } },
-    { { 133, 1573, 804 }, { -1, -1, -1 }, { 613, 612, 611 } },
-    { { 134, 808, 1634 }, { -1, -1, -1 }, { 615, 616, 617 } },
-    { { 134, 1634, 807 }, { -1, -1, -1 }, { 615, 617, 618 } },
-    { { 134, 807, 1635 }, { -1, -1, -1 }, { 615, 618, 574 } },
-    { { 134, 1635, 795 }, { -1, -1, -1 }, { 615, 574, 593 } },
-    { { 134, 795, 1689 }, { -1, -1, -1 }, { 615, 593, 584 } },
-    { { 134, 1689, 805 }, { -1, -1, -1 }, { 615, 584, 610 } },
-    { { 134, 805, 1573 }, { -1, -1, -1 }, { 615, 610, 612 } },
-    { { 134, 1573, 808 }, { -1, -1, -1 }, { 615, 612, 616 } },
-    { { 135, 806, 1690 }, { -1, -1, -1 }, { 619, 614, 588 } },
-    { { 135, 1690, 796 }, { -1, -1, -1 }, { 619, 588, 595 } },
-    { { 135, 796, 1636 }, { -1, -1, -1 }, { 619, 595, 578 } },
-    { { 135, 1636, 809 }, { -1, -1, -1 }, { 619, 578, 620 } },
-    { { 135, 809, 1634 }, { -1, -1, -1 }, { 619, 620, 617 } },
-    { { 135, 1634, 808 }, { -1, -1, -1 }, { 619, 617, 616 } },
-    { { 135, 808, 1573 }, { -1, -1, -1 }, { 619, 616, 612 } },
-    { { 135, 1573, 806 }, { -1, -1, -1 }, { 619, 612, 614 } },
-    { { 136, 813, 1646 }, { -1, -1, -1 }, { 621, 622, 623 } },
-    { { 136, 1646, 810 }, { -1, -1, -1 }, { 621, 623, 624 } },
-    { { 136, 810, 1697 }, { -1, -1, -1 }, { 621, 624, 625 } },
-    { { 136, 1697, 811 }, { -1, -1, -1 }, { 621, 625, 626 } },
-    { { 136, 811, 1695 }, { -1, -1, -1 }, { 621, 626, 627 } },
-    { { 136, 1695, 812 }, { -1, -1, -1 }, { 621, 627, 628 } },
-    { { 136, 812, 1648 }, { -1, -1, -1 }, { 621, 628, 598 } },
-    { { 136, 1648, 813 }, { -1, -1, -1 }, { 621, 598, 622 } },
-    { { 137, 817, 1696 }, { -1, -1, -1 }, { 629, 630, 631 } },
-    { { 137, 1696, 814 }, { -1, -1, -1 }, { 629, 631, 632 } },
-    { { 137, 814, 1698 }, { -1, -1, -1 }, { 629, 632, 633 } },
-    { { 137, 1698, 815 }, { -1, -1, -1 }, { 629, 633, 634 } },
-    { { 137, 815, 1647 }, { -1, -1, -1 }, { 629, 634, 635 } },
-    { { 137, 1647, 816 }, { -1, -1, -1 }, { 629, 635, 636 } },
-    { { 137, 816, 1649 }, { -1, -1, -1 }, { 629, 636, 607 } },
-    { { 137, 1649, 817 }, { -1, -1, -1 }, { 629, 607, 630 } },
-    { { 138, 820, 1644 }, { -1, -1, -1 }, { 637, 638, 639 } },
-    { { 138, 1644, 818 }, { -1, -1, -1 }, { 637, 639, 640 } },
-    { { 138, 818, 1699 }, { -1, -1, -1 }, { 637, 640, 641 } },
-    { { 138, 1699, 819 }, { -1, -1, -1 }, { 637, 641, 642 } },
-    { { 138, 819, 1697 }, { -1, -1, -1 }, { 637, 642, 625 } },
-    { { 138, 1697, 810 }, { -1, -1, -1 }, { 637, 625, 624 } },
-    { { 138, 810, 1646 }, { -1, -1, -1 }, { 637, 624, 623 } },
-    { { 138, 1646, 820 }, { -1, -1, -1 }, { 637, 623, 638 } },
-    { { 139, 815, 1698 }, { -1, -1, -1 }, { 643, 634, 633 } },
-    { { 139, 1698, 821 }, { -1, -1, -1 }, { 643, 633, 644 } },
-    { { 139, 821, 1700 }, { -1, -1, -1 }, { 643, 644, 645 } },
-    { { 139, 1700, 822 }, { -1, -1, -1 }, { 643, 645, 646 } },
-    { { 139, 822, 1645 }, { -1, -1, -1 }, { 643, 646, 647 } },
-    { { 139, 1645, 823 }, { -1, -1, -1 }, { 643, 647, 648 } },
-    { { 139, 823, 1647 }, { -1, -1, -1 }, { 643, 648, 635 } },
-    { { 139, 1647, 815 }, { -1, -1, -1 }, { 643, 635, 634 } },
-    { { 140, 826, 1643 }, { -1, -1, -1 }, { 649, 650, 651 } },
-    { { 140, 1643, 824 }, { -1, -1, -1 }, { 649, 651, 652 } },
-    { { 140, 824, 1701 }, { -1, -1, -1 }, { 649, 652, 653 } },
-    { { 140, 1701, 825 }, { -1, -1, -1 }, { 649, 653, 654 } },
-    { { 140, 825, 1699 }, { -1, -1, -1 }, { 649, 654, 641 } },
-    { { 140, 1699, 818 }, { -1, -1, -1 }, { 649, 641, 640 } },
-    { { 140, 818, 1644 }, { -1, -1, -1 }, { 649, 640, 639 } },
-    { { 140, 1644, 826 }, { -1, -1, -1 }, { 649, 639, 650 } },
-    { { 141, 822, 1700 }, { -1, -1, -1 }, { 655, 646, 645 } },
-    { { 141, 1700, 827 }, { -1, -1, -1 }, { 655, 645, 656 } },
-    { { 141, 827, 1702 }, { -1, -1, -1 }, { 655, 656, 657 } },
-    { { 141, 1702, 828 }, { -1, -1, -1 }, { 655, 657, 658 } },
-    { { 141, 828, 1643 }, { -1, -1, -1 }, { 655, 658, 651 } },
-    { { 141, 1643, 829 }, { -1, -1, -1 }, { 655, 651, 659 } },
-    { { 141, 829, 1645 }, { -1, -1, -1 }, { 655, 659, 647 } },
-    { { 141, 1645, 822 }, { -1, -1, -1 }, { 655, 647, 646 } },
-    { { 142, 832, 1642 }, { -1, -1, -1 }, { 660, 661, 662 } },
-    { { 142, 1642, 830 }, { -1, -1, -1 }, { 660, 662, 663 } },
-    { { 142, 830, 1575 }, { -1, -1, -1 }, { 660, 663, 664 } },
-    { { 142, 1575, 831 }, { -1, -1, -1 }, { 660, 664, 665 } },
-    { { 142, 831, 1701 }, { -1, -1, -1 }, { 660, 665, 653 } },
-    { { 142, 1701, 824 }, { -1, -1, -1 }, { 660, 653, 652 } },
-    { { 142, 824, 1643 }, { -1, -1, -1 }, { 660, 652, 651 } },
-    { { 142, 1643, 832 }, { -1, -1, -1 }, { 660, 651, 661 } },
-    { { 143, 828, 1702 }, { -1, -1, -1 }, { 666, 658, 657 } },
-    { { 143, 1702, 833 }, { -1, -1, -1 }, { 666, 657, 667 } },
-    { { 143, 833, 1575 }, { -1, -1, -1 }, { 666, 667, 664 } },
-    { { 143, 1575, 830 }, { -1, -1, -1 }, { 666, 664, 663 } },
-    { { 143, 830, 1642 }, { -1, -1, -1 }, { 666, 663, 662 } },
-    { { 143, 1642, 832 }, { -1, -1, -1 }, { 666, 662, 661 } },
-    { { 143, 832, 1643 }, { -1, -1, -1 }, { 666, 661, 651 } },
-    { { 143, 1643, 828 }, { -1, -1, -1 }, { 666, 651, 658 } },
-    { { 144, 835, 1694 }, { -1, -1, -1 }, { 668, 669, 600 } },
-    { { 144, 1694, 797 }, { -1, -1, -1 }, { 668, 600, 599 } },
-    { { 144, 797, 1648 }, { -1, -1, -1 }, { 668, 599, 598 } },
-    { { 144, 1648, 812 }, { -1, -1, -1 }, { 668, 598, 628 } },
-    { { 144, 812, 1695 }, { -1, -1, -1 }, { 668, 628, 627 } },
-    { { 144, 1695, 834 }, { -1, -1, -1 }, { 668, 627, 670 } },
-    { { 144, 834, 1574 }, { -1, -1, -1 }, { 668, 670, 671 } },
-    { { 144, 1574, 835 }, { -1, -1, -1 }, { 668, 671, 669 } },
-    { { 145, 836, 1696 }, { -1, -1, -1 }, { 672, 673, 631 } },
-    { { 145, 1696, 817 }, { -1, -1, -1 }, { 672, 631, 630 } },
-    { { 145, 817, 1649 }, { -1, -1, -1 }, { 672, 630, 607 } },
-    { { 145, 1649, 801 }, { -1, -1, -1 }, { 672, 607, 606 } },
-    { { 145, 801, 1694 }, { -1, -1, -1 }, { 672, 606, 600 } },
-    { { 145, 1694, 835 }, { -1, -1, -1 }, { 672, 600, 669 } },
-    { { 145, 835, 1574 }, { -1, -1, -1 }, { 672, 669, 671 } },
-    { { 145, 1574, 836 }, { -1, -1, -1 }, { 672, 671, 673 } },
-    { { 146, 839, 1574 }, { -1, -1, -1 }, { 674, 675, 671 } },
-    { { 146, 1574, 834 }, { -1, -1, -1 }, { 674, 671, 670 } },
-    { { 146, 834, 1695 }, { -1, -1, -1 }, { 674, 670, 627 } },
-    { { 146, 1695, 837 }, { -1, -1, -1 }, { 674, 627, 676 } },
-    { { 146, 837, 1710 }, { -1, -1, -1 }, { 674, 676, 677 } },
-    { { 146, 1710, 838 }, { -1, -1, -1 }, { 674, 677, 678 } },
-    { { 146, 838, 1712 }, { -1, -1, -1 }, { 674, 678, 679 } },
-    { { 146, 1712, 839 }, { -1, -1, -1 }, { 674, 679, 675 } },
-    { { 147, 841, 1711 }, { -1, -1, -1 }, { 680, 681, 682 } },
-    { { 147, 1711, 840 }, { -1, -1, -1 }, { 680, 682, 683 } },
-    { { 147, 840, 1696 }, { -1, -1, -1 }, { 680, 683, 631 } },
-    { { 147, 1696, 836 }, { -1, -1, -1 }, { 680, 631, 673 } },
-    { { 147, 836, 1574 }, { -1, -1, -1 }, { 680, 673, 671 } },
-    { { 147, 1574, 839 }, { -1, -1, -1 }, { 680, 671, 675 } },
-    { { 147, 839, 1712 }, { -1, -1, -1 }, { 680, 675, 679 } },
-    { { 147, 1712, 841 }, { -1, -1, -1 }, { 680, 679, 681 } },
-    { { 148, 831, 1575 }, { -1, -1, -1 }, { 684, 665, 664 } },
-    { { 148, 1575, 842 }, { -1, -1, -1 }, { 684, 664, 685 } },
-    { { 148, 842, 1703 }, { -1, -1, -1 }, { 684, 685, 686 } },
-    { { 148, 1703, 843 }, { -1, -1, -1 }, { 684, 686, 687 } },
-    { { 148, 843, 1704 }, { -1, -1, -1 }, { 684, 687, 688 } },
-    { { 148, 1704, 844 }, { -1, -1, -1 }, { 684, 688, 689 } },
-    { { 148, 844, 1701 }, { -1, -1, -1 }, { 684, 689, 653 } },
-    { { 148, 1701, 831 }, { -1, -1, -1 }, { 684, 653, 665 } },
-    { { 149, 846, 1705 }, { -1, -1, -1 }, { 690, 691, 692 } },
-    { { 149, 1705, 845 }, { -1, -1, -1 }, { 690, 692, 693 } },
-    { { 149, 845, 1703 }, { -1, -1, -1 }, { 690, 693, 686 } },
-    { { 149, 1703, 842 }, { -1, -1, -1 }, { 690, 686, 685 } },
-    { { 149, 842, 1575 }, { -1, -1, -1 }, { 690, 685, 664 } },
-    { { 149, 1575, 833 }, { -1, -1, -1 }, { 690, 664, 667 } },
-    { { 149, 833, 1702 }, { -1, -1, -1 }, { 690, 667, 657 } },
-    { { 149, 1702, 846 }, { -1, -1, -1 }, { 690, 657, 691 } },
-    { { 150, 825, 1701 }, { -1, -1, -1 }, { 694, 654, 653 } },
-    { { 150, 1701, 844 }, { -1, -1, -1 }, { 694, 653, 689 } },
-    { { 150, 844, 1704 }, { -1, -1, -1 }, { 694, 689, 688 } },
-    { { 150, 1704, 847 }, { -1, -1, -1 }, { 694, 688, 695 } },
-    { { 150, 847, 1706 }, { -1, -1, -1 }, { 694, 695, 696 } },
-    { { 150, 1706, 848 }, { -1, -1, -1 }, { 694, 696, 697 } },
-    { { 150, 848, 1699 }, { -1, -1, -1 }, { 694, 697, 641 } },
-    { { 150, 1699, 825 }, { -1, -1, -1 }, { 694, 641, 654 } },
-    { { 151, 850, 1707 }, { -1, -1, -1 }, { 698, 699, 700 } },
-    { { 151, 1707, 849 }, { -1, -1, -1 }, { 698, 700, 701 } },
-    { { 151, 849, 1705 }, { -1, -1, -1 }, { 698, 701, 692 } },
-    { { 151, 1705, 846 }, { -1, -1, -1 }, { 698, 692, 691 } },
-    { { 151, 846, 1702 }, { -1, -1, -1 }, { 698, 691, 657 } },
-    { { 151, 1702, 827 }, { -1, -1, -1 }, { 698, 657, 656 } },
-    { { 151, 827, 1700 }, { -1, -1, -1 }, { 698, 656, 645 } },
-    { { 151, 1700, 850 }, { -1, -1, -1 }, { 698, 645, 699 } },
-    { { 152, 819, 1699 }, { -1, -1, -1 }, { 702, 642, 641 } },
-    { { 152, 1699, 848 }, { -1, -1, -1 }, { 702, 641, 697 } },
-    { { 152, 848, 1706 }, { -1, -1, -1 }, { 702, 697, 696 } },
-    { { 152, 1706, 851 }, { -1, -1, -1 }, { 702, 696, 703 } },
-    { { 152, 851, 1708 }, { -1, -1, -1 }, { 702, 703, 704 } },
-    { { 152, 1708, 852 }, { -1, -1, -1 }, { 702, 704, 705 } },
-    { { 152, 852, 1697 }, { -1, -1, -1 }, { 702, 705, 625 } },
-    { { 152, 1697, 819 }, { -1, -1, -1 }, { 702, 625, 642 } },
-    { { 153, 854, 1709 }, { -1, -1, -1 }, { 706, 707, 708 } },
-    { { 153, 1709, 853 }, { -1, -1, -1 }, { 706, 708, 709 } },
-    { { 153, 853, 1707 }, { -1, -1, -1 }, { 706, 709, 700 } },
-    { { 153, 1707, 850 }, { -1, -1, -1 }, { 706, 700, 699 } },
-    { { 153, 850, 1700 }, { -1, -1, -1 }, { 706, 699, 645 } },
-    { { 153, 1700, 821 }, { -1, -1, -1 }, { 706, 645, 644 } },
-    { { 153, 821, 1698 }, { -1, -1, -1 }, { 706, 644, 633 } },
-    { { 153, 1698, 854 }, { -1, -1, -1 }, { 706, 633, 707 } },
-    { { 154, 811, 1697 }, { -1, -1, -1 }, { 710, 626, 625 } },
-    { { 154, 1697, 852 }, { -1, -1, -1 }, { 710, 625, 705 } },
-    { { 154, 852, 1708 }, { -1, -1, -1 }, { 710, 705, 704 } },
-    { { 154, 1708, 855 }, { -1, -1, -1 }, { 710, 704, 711 } },
-    { { 154, 855, 1710 }, { -1, -1, -1 }, { 710, 711, 677 } },
-    { { 154, 1710, 837 }, { -1, -1, -1 }, { 710, 677, 676 } },
-    { { 154, 837, 1695 }, { -1, -1, -1 }, { 710, 676, 627 } },
-    { { 154, 1695, 811 }, { -1, -1, -1 }, { 710, 627, 626 } },
-    { { 155, 840, 1711 }, { -1, -1, -1 }, { 712, 683, 682 } },
-    { { 155, 1711, 856 }, { -1, -1, -1 }, { 712, 682, 713 } },
-    { { 155, 856, 1709 }, { -1, -1, -1 }, { 712, 713, 708 } },
-    { { 155, 1709, 854 }, { -1, -1, -1 }, { 712, 708, 707 } },
-    { { 155, 854, 1698 }, { -1, -1, -1 }, { 712, 707, 633 } },
-    { { 155, 1698, 814 }, { -1, -1, -1 }, { 712, 633, 632 } },
-    { { 155, 814, 1696 }, { -1, -1, -1 }, { 712, 632, 631 } },
-    { { 155, 1696, 840 }, { -1, -1, -1 }, { 712, 631, 683 } },
-    { { 156, 843, 1703 }, { -1, -1, -1 }, { 714, 687, 686 } },
-    { { 156, 1703, 857 }, { -1, -1, -1 }, { 714, 686, 715 } },
-    { { 156, 857, 1708 }, { -1, -1, -1 }, { 714, 715, 704 } },
-    { { 156, 1708, 851 }, { -1, -1, -1 }, { 714, 704, 703 } },
-    { { 156, 851, 1706 }, { -1, -1, -1 }, { 714, 703, 696 } },
-    { { 156, 1706, 847 }, { -1, -1, -1 }, { 714, 696, 695 } },
-    { { 156, 847, 1704 }, { -1, -1, -1 }, { 714, 695, 688 } },
-    { { 156, 1704, 843 }, { -1, -1, -1 }, { 714, 688, 687 } },
-    { { 157, 849, 1707 }, { -1, -1, -1 }, { 716, 701, 700 } },
-    { { 157, 1707, 853 }, { -1, -1, -1 }, { 716, 700, 709 } },
-    { { 157, 853, 1709 }, { -1, -1, -1 }, { 716, 709, 708 } },
-    { { 157, 1709, 858 }, { -1, -1, -1 }, { 716, 708, 717 } },
-    { { 157, 858, 1703 }, { -1, -1, -1 }, { 716, 717, 686 } },
-    { { 157, 1703, 845 }, { -1, -1, -1 }, { 716, 686, 693 } },
-    { { 157, 845, 1705 }, { -1, -1, -1 }, { 716, 693, 692 } },
-    { { 157, 1705, 849 }, { -1, -1, -1 }, { 716, 692, 701 } },
-    { { 158, 857, 1703 }, { -1, -1, -1 }, { 718, 715, 686 } },
-    { { 158, 1703, 859 }, { -1, -1, -1 }, { 718, 686, 719 } },
-    { { 158, 859, 1712 }, { -1, -1, -1 }, { 718, 719, 679 } },
-    { { 158, 1712, 838 }, { -1, -1, -1 }, { 718, 679, 678 } },
-    { { 158, 838, 1710 }, { -1, -1, -1 }, { 718, 678, 677 } },
-    { { 158, 1710, 855 }, { -1, -1, -1 }, { 718, 677, 711 } },
-    { { 158, 855, 1708 }, { -1, -1, -1 }, { 718, 711, 704 } },
-    { { 158, 1708, 857 }, { -1, -1, -1 }, { 718, 704, 715 } },
-    { { 159, 856, 1711 }, { -1, -1, -1 }, { 720, 713, 682 } },
-    { { 159, 1711, 841 }, { -1, -1, -1 }, { 720, 682, 681 } },
-    { { 159, 841, 1712 }, { -1, -1, -1 }, { 720, 681, 679 } },
-    { { 159, 1712, 859 }, { -1, -1, -1 }, { 720, 679, 719 } },
-    { { 159, 859, 1703 }, { -1, -1, -1 }, { 720, 719, 686 } },
-    { { 159, 1703, 858 }, { -1, -1, -1 }, { 720, 686, 717 } },
-    { { 159, 858, 1709 }, { -1, -1, -1 }, { 720, 717, 708 } },
-    { { 159, 1709, 856 }, { -1, -1, -1 }, { 720, 708, 713 } },
-    { { 160, 861, 1643 }, { -1, -1, -1 }, { 721, 722, 651 } },
-    { { 160, 1643, 826 }, { -1, -1, -1 }, { 721, 651, 650 } },
-    { { 160, 826, 1644 }, { -1, -1, -1 }, { 721, 650, 639 } },
-    { { 160, 1644, 860 }, { -1, -1, -1 }, { 721, 639, 723 } },
-    { { 160, 860, 1668 }, { -1, -1, -1 }, { 721, 723, 329 } },
-    { { 160, 1668, 760 }, { -1, -1, -1 }, { 721, 329, 525 } },
-    { { 160, 760, 1681 }, { -1, -1, -1 }, { 721, 525, 524 } },
-    { { 160, 1681, 861 }, { -1, -1, -1 }, { 721, 524, 722 } },
-    { { 161, 763, 1669 }, { -1, -1, -1 }, { 724, 527, 338 } },
-    { { 161, 1669, 862 }, { -1, -1, -1 }, { 724, 338, 725 } },
-    { { 161, 862, 1645 }, { -1, -1, -1 }, { 724, 725, 647 } },
-    { { 161, 1645, 829 }, { -1, -1, -1 }, { 724, 647, 659 } },
-    { { 161, 829, 1643 }, { -1, -1, -1 }, { 724, 659, 651 } },
-    { { 161, 1643, 861 }, { -1, -1, -1 }, { 724, 651, 722 } },
-    { { 161, 861, 1681 }, { -1, -1, -1 }, { 724, 722, 524 } },
-    { { 161, 1681, 763 }, { -1, -1, -1 }, { 724, 524, 527 } },
-    { { 162, 860, 1644 }, { -1, -1, -1 }, { 726, 723, 639 } },
-    { { 162, 1644, 820 }, { -1, -1, -1 }, { 726, 639, 638 } },
-    { { 162, 820, 1646 }, { -1, -1, -1 }, { 726, 638, 623 } },
-    { { 162, 1646, 863 }, { -1, -1, -1 }, { 726, 623, 727 } },
-    { { 162, 863, 1715 }, { -1, -1, -1 }, { 726, 727, 728 } },
-    { { 162, 1715, 864 }, { -1, -1, -1 }, { 726, 728, 729 } },
-    { { 162, 864, 1668 }, { -1, -1, -1 }, { 726, 729, 329 } },
-    { { 162, 1668, 860 }, { -1, -1, -1 }, { 726, 329, 723 } },
-    { { 163, 866, 1716 }, { -1, -1, -1 }, { 730, 731, 732 } },
-    { { 163, 1716, 865 }, { -1, -1, -1 }, { 730, 732, 733 } },
-    { { 163, 865, 1647 }, { -1, -1, -1 }, { 730, 733, 635 } },
-    { { 163, 1647, 823 }, { -1, -1, -1 }, { 730, 635, 648 } },
-    { { 163, 823, 1645 }, { -1, -1, -1 }, { 730, 648, 647 } },
-    { { 163, 1645, 862 }, { -1, -1, -1 }, { 730, 647, 725 } },
-    { { 163, 862, 1669 }, { -1, -1, -1 }, { 730, 725, 338 } },
-    { { 163, 1669, 866 }, { -1, -1, -1 }, { 730, 338, 731 } },
-    { { 164, 863, 1646 }, { -1, -1, -1 }, { 734, 727, 623 } },
-    { { 164, 1646, 813 }, { -1, -1, -1 }, { 734, 623, 622 } },
-    { { 164, 813, 1648 }, { -1, -1, -1 }, { 734, 622, 598 } },
-    { { 164, 1648, 867 }, { -1, -1, -1 }, { 734, 598, 735 } },
-    { { 164, 867, 1717 }, { -1, -1, -1 }, { 734, 735, 736 } },
-    { { 164, 1717, 868 }, { -1, -1, -1 }, { 734, 736, 737 } },
-    { { 164, 868, 1715 }, { -1, -1, -1 }, { 734, 737, 728 } },
-    { { 164, 1715, 863 }, { -1, -1, -1 }, { 734, 728, 727 } },
-    { { 165, 870, 1718 }, { -1, -1, -1 }, { 738, 739, 740 } },
-    { { 165, 1718, 869 }, { -1, -1, -1 }, { 738, 740, 741 } },
-    { { 165, 869, 1649 }, { -1, -1, -1 }, { 738, 741, 607 } },
-    { { 165, 1649, 816 }, { -1, -1, -1 }, { 738, 607, 636 } },
-    { { 165, 816, 1647 }, { -1, -1, -1 }, { 738, 636, 635 } },
-    { { 165, 1647, 865 }, { -1, -1, -1 }, { 738, 635, 733 } },
-    { { 165, 865, 1716 }, { -1, -1, -1 }, { 738, 733, 732 } },
-    { { 165, 1716, 870 }, { -1, -1, -1 }, { 738, 732, 739 } },
-    { { 166, 867, 1648 }, { -1, -1, -1 }, { 742, 735, 598 } },
-    { { 166, 1648, 800 }, { -1, -1, -1 }, { 742, 598, 597 } },
-    { { 166, 800, 1691 }, { -1, -1, -1 }, { 742, 597, 582 } },
-    { { 166, 1691, 789 }, { -1, -1, -1 }, { 742, 582, 581 } },
-    { { 166, 789, 1670 }, { -1, -1, -1 }, { 742, 581, 313 } },
-    { { 166, 1670, 871 }, { -1, -1, -1 }, { 742, 313, 743 } },
-    { { 166, 871, 1717 }, { -1, -1, -1 }, { 742, 743, 736 } },
-    { { 166, 1717, 867 }, { -1, -1, -1 }, { 742, 736, 735 } },
-    { { 167, 872, 1671 }, { -1, -1, -1 }, { 744, 745, 317 } },
-    { { 167, 1671, 793 }, { -1, -1, -1 }, { 744, 317, 591 } },
-    { { 167, 793, 1692 }, { -1, -1, -1 }, { 744, 591, 590 } },
-    { { 167, 1692, 802 }, { -1, -1, -1 }, { 744, 590, 608 } },
-    { { 167, 802, 1649 }, { -1, -1, -1 }, { 744, 608, 607 } },
-    { { 167, 1649, 869 }, { -1, -1, -1 }, { 744, 607, 741 } },
-    { { 167, 869, 1718 }, { -1, -1, -1 }, { 744, 741, 740 } },
-    { { 167, 1718, 872 }, { -1, -1, -1 }, { 744, 740, 745 } },
-    { { 168, 653, 1585 }, { -1, -1, -1 }, { 746, 312, 311 } },
-    { { 168, 1585, 873 }, { -1, -1, -1 }, { 746, 311, 747 } },
-    { { 168, 873, 1713 }, { -1, -1, -1 }, { 746, 747, 748 } },
-    { { 168, 1713, 874 }, { -1, -1, -1 }, { 746, 748, 749 } },
-    { { 168, 874, 1717 }, { -1, -1, -1 }, { 746, 749, 736 } },
-    { { 168, 1717, 871 }, { -1, -1, -1 }, { 746, 736, 743 } },
-    { { 168, 871, 1670 }, { -1, -1, -1 }, { 746, 743, 313 } },
-    { { 168, 1670, 653 }, { -1, -1, -1 }, { 746, 313, 312 } },
-    { { 169, 872, 1718 }, { -1, -1, -1 }, { 750, 745, 740 } },
-    { { 169, 1718, 875 }, { -1, -1, -1 }, { 750, 740, 751 } },
-    { { 169, 875, 1714 }, { -1, -1, -1 }, { 750, 751, 752 } },
-    { { 169, 1714, 876 }, { -1, -1, -1 }, { 750, 752, 753 } },
-    { { 169, 876, 1586 }, { -1, -1, -1 }, { 750, 753, 319 } },
-    { { 169, 1586, 657 }, { -1, -1, -1 }, { 750, 319, 318 } },
-    { { 169, 657, 1671 }, { -1, -1, -1 }, { 750, 318, 317 } },
-    { { 169, 1671, 872 }, { -1, -1, -1 }, { 750, 317, 745 } },
-    { { 170, 874, 1713 }, { -1, -1, -1 }, { 754, 749, 748 } },
-    { { 170, 1713, 877 }, { -1, -1, -1 }, { 754, 748, 755 } },
-    { { 170, 877, 1719 }, { -1, -1, -1 }, { 754, 755, 756 } },
-    { { 170, 1719, 878 }, { -1, -1, -1 }, { 754, 756, 757 } },
-    { { 170, 878, 1715 }, { -1, -1, -1 }, { 754, 757, 728 } },
-    { { 170, 1715, 868 }, { -1, -1, -1 }, { 754, 728, 737 } },
-    { { 170, 868, 1717 }, { -1, -1, -1 }, { 754, 737, 736 } },
-    { { 170, 1717, 874 }, { -1, -1, -1 }, { 754, 736, 749 } },
-    { { 171, 870, 1716 }, { -1, -1, -1 }, { 758, 739, 732 } },
-    { { 171, 1716, 879 }, { -1, -1, -1 }, { 758, 732, 759 } },
-    { { 171, 879, 1720 }, { -1, -1, -1 }, { 758, 759, 760 } },
-    { { 171, 1720, 880 }, { -1, -1, -1 }, { 758, 760, 761 } },
-    { { 171, 880, 1714 }, { -1, -1, -1 }, { 758, 761, 752 } },
-    { { 171, 1714, 875 }, { -1, -1, -1 }, { 758, 752, 751 } },
-    { { 171, 875, 1718 }, { -1, -1, -1 }, { 758, 751, 740 } },
-    { { 171, 1718, 870 }, { -1, -1, -1 }, { 758, 740, 739 } },
-    { { 172, 881, 1583 }, { -1, -1, -1 }, { 762, 763, 323 } },
-    { { 172, 1583, 662 }, { -1, -1, -1 }, { 762, 323, 322 } },
-    { { 172, 662, 1668 }, { -1, -1, -1 }, { 762, 322, 329 } },
-    { { 172, 1668, 864 }, { -1, -1, -1 }, { 762, 329, 729 } },
-    { { 172, 864, 1715 }, { -1, -1, -1 }, { 762, 729, 728 } },
-    { { 172, 1715, 878 }, { -1, -1, -1 }, { 762, 728, 757 } },
-    { { 172, 878, 1719 }, { -1, -1, -1 }, { 762, 757, 756 } },
-    { { 172, 1719, 881 }, { -1, -1, -1 }, { 762, 756, 763 } },
-    { { 173, 879, 1716 }, { -1, -1, -1 }, { 764, 759, 732 } },
-    { { 173, 1716, 866 }, { -1, -1, -1 }, { 764, 732, 731 } },
-    { { 173, 866, 1669 }, { -1, -1, -1 }, { 764, 731, 338 } },
-    { { 173, 1669, 665 }, { -1, -1, -1 }, { 764, 338, 337 } },
-    { { 173, 665, 1584 }, { -1, -1, -1 }, { 764, 337, 336 } },
-    { { 173, 1584, 882 }, { -1, -1, -1 }, { 764, 336, 765 } },
-    { { 173, 882, 1720 }, { -1, -1, -1 }, { 764, 765, 760 } },
-    { { 173, 1720, 879 }, { -1, -1, -1 }, { 764, 760, 759 } },
-    { { 174, 885, 1635 }, { -1, -1, -1 }, { 766, 767, 574 } },
-    { { 174, 1635, 807 }, { -1, -1, -1 }, { 766, 574, 618 } },
-    { { 174, 807, 1634 }, { -1, -1, -1 }, { 766, 618, 617 } },
-    { { 174, 1634, 883 }, { -1, -1, -1 }, { 766, 617, 768 } },
-    { { 174, 883, 1576 }, { -1, -1, -1 }, { 766, 768, 769 } },
-    { { 174, 1576, 884 }, { -1, -1, -1 }, { 766, 769, 770 } },
-    { { 174, 884, 1726 }, { -1, -1, -1 }, { 766, 770, 771 } },
-    { { 174, 1726, 885 }, { -1, -1, -1 }, { 766, 771, 767 } },
-    { { 175, 887, 1576 }, { -1, -1, -1 }, { 772, 773, 769 } },
-    { { 175, 1576, 883 }, { -1, -1, -1 }, { 772, 769, 768 } },
-    { { 175, 883, 1634 }, { -1, -1, -1 }, { 772, 768, 617 } },
-    { { 175, 1634, 809 }, { -1, -1, -1 }, { 772, 617, 620 } },
-    { { 175, 809, 1636 }, { -1, -1, -1 }, { 772, 620, 578 } },
-    { { 175, 1636, 886 }, { -1, -1, -1 }, { 772, 578, 774 } },
-    { { 175, 886, 1727 }, { -1, -1, -1 }, { 772, 774, 775 } },
-    { { 175, 1727, 887 }, { -1, -1, -1 }, { 772, 775, 773 } },
-    { { 176, 889, 1637 }, { -1, -1, -1 }, { 776, 777, 566 } },
-    { { 176, 1637, 785 }, { -1, -1, -1 }, { 776, 566, 575 } },
-    { { 176, 785, 1635 }, { -1, -1, -1 }, { 776, 575, 574 } },
-    { { 176, 1635, 885 }, { -1, -1, -1 }, { 776, 574, 767 } },
-    { { 176, 885, 1726 }, { -1, -1, -1 }, { 776, 767, 771 } },
-    { { 176, 1726, 888 }, { -1, -1, -1 }, { 776, 771, 778 } },
-    { { 176, 888, 1724 }, { -1, -1, -1 }, { 776, 778, 779 } },
-    { { 176, 1724, 889 }, { -1, -1, -1 }, { 776, 779, 777 } },
-    { { 177, 891, 1727 }, { -1, -1, -1 }, { 780, 781, 775 } },
-    { { 177, 1727, 886 }, { -1, -1, -1 }, { 780, 775, 774 } },
-    { { 177, 886, 1636 }, { -1, -1, -1 }, { 780, 774, 578 } },
-    { { 177, 1636, 787 }, { -1, -1, -1 }, { 780, 578, 577 } },
-    { { 177, 787, 1638 }, { -1, -1, -1 }, { 780, 577, 570 } },
-    { { 177, 1638, 890 }, { -1, -1, -1 }, { 780, 570, 782 } },
-    { { 177, 890, 1725 }, { -1, -1, -1 }, { 780, 782, 783 } },
-    { { 177, 1725, 891 }, { -1, -1, -1 }, { 780, 783, 781 } },
-    { { 178, 893, 1639 }, { -1, -1, -1 }, { 784, 785, 556 } },
-    { { 178, 1639, 781 }, { -1, -1, -1 }, { 784, 556, 567 } },
-    { { 178, 781, 1637 }, { -1, -1, -1 }, { 784, 567, 566 } },
-    { { 178, 1637, 889 }, { -1, -1, -1 }, { 784, 566, 777 } },
-    { { 178, 889, 1724 }, { -1, -1, -1 }, { 784, 777, 779 } },
-    { { 178, 1724, 892 }, { -1, -1, -1 }, { 784, 779, 786 } },
-    { { 178, 892, 1722 }, { -1, -1, -1 }, { 784, 786, 787 } },
-    { { 178, 1722, 893 }, { -1, -1, -1 }, { 784, 787, 785 } },
-    { { 179, 895, 1725 }, { -1, -1, -1 }, { 788, 789, 783 } },
-    { { 179, 1725, 890 }, { -1, -1, -1 }, { 788, 783, 782 } },
-    { { 179, 890, 1638 }, { -1, -1, -1 }, { 788, 782, 570 } },
-    { { 179, 1638, 783 }, { -1, -1, -1 }, { 788, 570, 569 } },
-    { { 179, 783, 1640 }, { -1, -1, -1 }, { 788, 569, 562 } },
-    { { 179, 1640, 894 }, { -1, -1, -1 }, { 788, 562, 790 } },
-    { { 179, 894, 1723 }, { -1, -1, -1 }, { 788, 790, 791 } },
-    { { 179, 1723, 895 }, { -1, -1, -1 }, { 788, 791, 789 } },
-    { { 180, 897, 1641 }, { -1, -1, -1 }, { 792, 793, 558 } },
-    { { 180, 1641, 776 }, { -1, -1, -1 }, { 792, 558, 557 } },
-    { { 180, 776, 1639 }, { -1, -1, -1 }, { 792, 557, 556 } },
-    { { 180, 1639, 893 }, { -1, -1, -1 }, { 792, 556, 785 } },
-    { { 180, 893, 1722 }, { -1, -1, -1 }, { 792, 785, 787 } },
-    { { 180, 1722, 896 }, { -1, -1, -1 }, { 792, 787, 794 } },
-    { { 180, 896, 1721 }, { -1, -1, -1 }, { 792, 794, 795 } },
-    { { 180, 1721, 897 }, { -1, -1, -1 }, { 792, 795, 793 } },
-    { { 181, 898, 1723 }, { -1, -1, -1 }, { 796, 797, 791 } },
-    { { 181, 1723, 894 }, { -1, -1, -1 }, { 796, 791, 790 } },
-    { { 181, 894, 1640 }, { -1, -1, -1 }, { 796, 790, 562 } },
-    { { 181, 1640, 779 }, { -1, -1, -1 }, { 796, 562, 561 } },
-    { { 181, 779, 1641 }, { -1, -1, -1 }, { 796, 561, 558 } },
-    { { 181, 1641, 897 }, { -1, -1, -1 }, { 796, 558, 793 } },
-    { { 181, 897, 1721 }, { -1, -1, -1 }, { 796, 793, 795 } },
-    { { 181, 1721, 898 }, { -1, -1, -1 }, { 796, 795, 797 } },
-    { { 182, 901, 1721 }, { -1, -1, -1 }, { 798, 799, 795 } },
-    { { 182, 1721, 896 }, { -1, -1, -1 }, { 798, 795, 794 } },
-    { { 182, 896, 1722 }, { -1, -1, -1 }, { 798, 794, 787 } },
-    { { 182, 1722, 899 }, { -1, -1, -1 }, { 798, 787, 800 } },
-    { { 182, 899, 1733 }, { -1, -1, -1 }, { 798, 800, 801 } },
-    { { 182, 1733, 900 }, { -1, -1, -1 }, { 798, 801, 802 } },
-    { { 182, 900, 1735 }, { -1, -1, -1 }, { 798, 802, 803 } },
-    { { 182, 1735, 901 }, { -1, -1, -1 }, { 798, 803, 799 } },
-    { { 183, 903, 1734 }, { -1, -1, -1 }, { 804, 805, 806 } },
-    { { 183, 1734, 902 }, { -1, -1, -1 }, { 804, 806, 807 } },
-    { { 183, 902, 1723 }, { -1, -1, -1 }, { 804, 807, 791 } },
-    { { 183, 1723, 898 }, { -1, -1, -1 }, { 804, 791, 797 } },
-    { { 183, 898, 1721 }, { -1, -1, -1 }, { 804, 797, 795 } },
-    { { 183, 1721, 901 }, { -1, -1, -1 }, { 804, 795, 799 } },
-    { { 183, 901, 1735 }, { -1, -1, -1 }, { 804, 799, 803 } },
-    { { 183, 1735, 903 }, { -1, -1, -1 }, { 804, 803, 805 } },
-    { { 184, 899, 1722 }, { -1, -1, -1 }, { 808, 800, 787 } },
-    { { 184, 1722, 892 }, { -1, -1, -1 }, { 808, 787, 786 } },
-    { { 184, 892, 1724 }, { -1, -1, -1 }, { 808, 786, 779 } },
-    { { 184, 1724, 904 }, { -1, -1, -1 }, { 808, 779, 809 } },
-    { { 184, 904, 1731 }, { -1, -1, -1 }, { 808, 809, 810 } },
-    { { 184, 1731, 905 }, { -1, -1, -1 }, { 808, 810, 811 } },
-    { { 184, 905, 1733 }, { -1, -1, -1 }, { 808, 811, 801 } },
-    { { 184, 1733, 899 }, { -1, -1, -1 }, { 808, 801, 800 } },
-    { { 185, 907, 1732 }, { -1, -1, -1 }, { 812, 813, 814 } },
-    { { 185, 1732, 906 }, { -1, -1, -1 }, { 812, 814, 815 } },
-    { { 185, 906, 1725 }, { -1, -1, -1 }, { 812, 815, 783 } },
-    { { 185, 1725, 895 }, { -1, -1, -1 }, { 812, 783, 789 } },
-    { { 185, 895, 1723 }, { -1, -1, -1 }, { 812, 789, 791 } },
-    { { 185, 1723, 902 }, { -1, -1, -1 }, { 812, 791, 807 } },
-    { { 185, 902, 1734 }, { -1, -1, -1 }, { 812, 807, 806 } },
-    { { 185, 1734, 907 }, { -1, -1, -1 }, { 812, 806, 813 } },
-    { { 186, 904, 1724 }, { -1, -1, -1 }, { 816, 809, 779 } },
-    { { 186, 1724, 888 }, { -1, -1, -1 }, { 816, 779, 778 } },
-    { { 186, 888, 1726 }, { -1, -1, -1 }, { 816, 778, 771 } },
-    { { 186, 1726, 908 }, { -1, -1, -1 }, { 816, 771, 817 } },
-    { { 186, 908, 1729 }, { -1, -1, -1 }, { 816, 817, 818 } },
-    { { 186, 1729, 909 }, { -1, -1, -1 }, { 816, 818, 819 } },
-    { { 186, 909, 1731 }, { -1, -1, -1 }, { 816, 819, 810 } },
-    { { 186, 1731, 904 }, { -1, -1, -1 }, { 816, 810, 809 } },
-    { { 187, 911, 1730 }, { -1, -1, -1 }, { 820, 821, 822 } },
-    { { 187, 1730, 910 }, { -1, -1, -1 }, { 820, 822, 823 } },
-    { { 187, 910, 1727 }, { -1, -1, -1 }, { 820, 823, 775 } },
-    { { 187, 1727, 891 }, { -1, -1, -1 }, { 820, 775, 781 } },
-    { { 187, 891, 1725 }, { -1, -1, -1 }, { 820, 781, 783 } },
-    { { 187, 1725, 906 }, { -1, -1, -1 }, { 820, 783, 815 } },
-    { { 187, 906, 1732 }, { -1, -1, -1 }, { 820, 815, 814 } },
-    { { 187, 1732, 911 }, { -1, -1, -1 }, { 820, 814, 821 } },
-    { { 188, 908, 1726 }, { -1, -1, -1 }, { 824, 817, 771 } },
-    { { 188, 1726, 884 }, { -1, -1, -1 }, { 824, 771, 770 } },
-    { { 188, 884, 1576 }, { -1, -1, -1 }, { 824, 770, 769 } },
-    { { 188, 1576, 912 }, { -1, -1, -1 }, { 824, 769, 825 } },
-    { { 188, 912, 1728 }, { -1, -1, -1 }, { 824, 825, 826 } },
-    { { 188, 1728, 913 }, { -1, -1, -1 }, { 824, 826, 827 } },
-    { { 188, 913, 1729 }, { -1, -1, -1 }, { 824, 827, 818 } },
-    { { 188, 1729, 908 }, { -1, -1, -1 }, { 824, 818, 817 } },
-    { { 189, 914, 1728 }, { -1, -1, -1 }, { 828, 829, 826 } },
-    { { 189, 1728, 912 }, { -1, -1, -1 }, { 828, 826, 825 } },
-    { { 189, 912, 1576 }, { -1, -1, -1 }, { 828, 825, 769 } },
-    { { 189, 1576, 887 }, { -1, -1, -1 }, { 828, 769, 773 } },
-    { { 189, 887, 1727 }, { -1, -1, -1 }, { 828, 773, 775 } },
-    { { 189, 1727, 910 }, { -1, -1, -1 }, { 828, 775, 823 } },
-    { { 189, 910, 1730 }, { -1, -1, -1 }, { 828, 823, 822 } },
-    { { 189, 1730, 914 }, { -1, -1, -1 }, { 828, 822, 829 } },
-    { { 190, 913, 1728 }, { -1, -1, -1 }, { 830, 827, 826 } },
-    { { 190, 1728, 915 }, { -1, -1, -1 }, { 830, 826, 831 } },
-    { { 190, 915, 1735 }, { -1, -1, -1 }, { 830, 831, 803 } },
-    { { 190, 1735, 900 }, { -1, -1, -1 }, { 830, 803, 802 } },
-    { { 190, 900, 1733 }, { -1, -1, -1 }, { 830, 802, 801 } },
-    { { 190, 1733, 916 }, { -1, -1, -1 }, { 830, 801, 832 } },
-    { { 190, 916, 1729 }, { -1, -1, -1 }, { 830, 832, 818 } },
-    { { 190, 1729, 913 }, { -1, -1, -1 }, { 830, 818, 827 } },
-    { { 191, 917, 1734 }, { -1, -1, -1 }, { 833, 834, 806 } },
-    { { 191, 1734, 903 }, { -1, -1, -1 }, { 833, 806, 805 } },
-    { { 191, 903, 1735 }, { -1, -1, -1 }, { 833, 805, 803 } },
-    { { 191, 1735, 915 }, { -1, -1, -1 }, { 833, 803, 831 } },
-    { { 191, 915, 1728 }, { -1, -1, -1 }, { 833, 831, 826 } },
-    { { 191, 1728, 914 }, { -1, -1, -1 }, { 833, 826, 829 } },
-    { { 191, 914, 1730 }, { -1, -1, -1 }, { 833, 829, 822 } },
-    { { 191, 1730, 917 }, { -1, -1, -1 }, { 833, 822, 834 } },
-    { { 192, 909, 1729 }, { -1, -1, -1 }, { 835, 819, 818 } },
-    { { 192, 1729, 916 }, { -1, -1, -1 }, { 835, 818, 832 } },
-    { { 192, 916, 1733 }, { -1, -1, -1 }, { 835, 832, 801 } },
-    { { 192, 1733, 905 }, { -1, -1, -1 }, { 835, 801, 811 } },
-    { { 192, 905, 1731 }, { -1, -1, -1 }, { 835, 811, 810 } },
-    { { 192, 1731, 909 }, { -1, -1, -1 }, { 835, 810, 819 } },
-    { { 193, 911, 1732 }, { -1, -1, -1 }, { 836, 821, 814 } },
-    { { 193, 1732, 907 }, { -1, -1, -1 }, { 836, 814, 813 } },
-    { { 193, 907, 1734 }, { -1, -1, -1 }, { 836, 813, 806 } },
-    { { 193, 1734, 917 }, { -1, -1, -1 }, { 836, 806, 834 } },
-    { { 193, 917, 1730 }, { -1, -1, -1 }, { 836, 834, 822 } },
-    { { 193, 1730, 911 }, { -1, -1, -1 }, { 836, 822, 821 } },
-    { { 194, 920, 1687 }, { -1, -1, -1 }, { 837, 838, 544 } },
-    { { 194, 1687, 773 }, { -1, -1, -1 }, { 837, 544, 551 } },
-    { { 194, 773, 1685 }, { -1, -1, -1 }, { 837, 551, 522 } },
-    { { 194, 1685, 918 }, { -1, -1, -1 }, { 837, 522, 839 } },
-    { { 194, 918, 1738 }, { -1, -1, -1 }, { 837, 839, 840 } },
-    { { 194, 1738, 919 }, { -1, -1, -1 }, { 837, 840, 841 } },
-    { { 194, 919, 1736 }, { -1, -1, -1 }, { 837, 841, 842 } },
-    { { 194, 1736, 920 }, { -1, -1, -1 }, { 837, 842, 838 } },
-    { { 195, 923, 1739 }, { -1, -1, -1 }, { 843, 844, 845 } },
-    { { 195, 1739, 921 }, { -1, -1, -1 }, { 843, 845, 846 } },
-    { { 195, 921, 1686 }, { -1, -1, -1 }, { 843, 846, 529 } },
-    { { 195, 1686, 775 }, { -1, -1, -1 }, { 843, 529, 553 } },
-    { { 195, 775, 1688 }, { -1, -1, -1 }, { 843, 553, 548 } },
-    { { 195, 1688, 922 }, { -1, -1, -1 }, { 843, 548, 847 } },
-    { { 195, 922, 1737 }, { -1, -1, -1 }, { 843, 847, 848 } },
-    { { 195, 1737, 923 }, { -1, -1, -1 }, { 843, 848, 844 } },
-    { { 196, 925, 1616 }, { -1, -1, -1 }, { 849, 850, 534 } },
-    { { 196, 1616, 770 }, { -1, -1, -1 }, { 849, 534, 540 } },
-    { { 196, 770, 1687 }, { -1, -1, -1 }, { 849, 540, 544 } },
-    { { 196, 1687, 920 }, { -1, -1, -1 }, { 849, 544, 838 } },
-    { { 196, 920, 1736 }, { -1, -1, -1 }, { 849, 838, 842 } },
-    { { 196, 1736, 924 }, { -1, -1, -1 }, { 849, 842, 851 } },
-    { { 196, 924, 1758 }, { -1, -1, -1 }, { 849, 851, 852 } },
-    { { 196, 1758, 925 }, { -1, -1, -1 }, { 849, 852, 850 } },
-    { { 197, 927, 1737 }, { -1, -1, -1 }, { 853, 854, 848 } },
-    { { 197, 1737, 922 }, { -1, -1, -1 }, { 853, 848, 847 } },
-    { { 197, 922, 1688 }, { -1, -1, -1 }, { 853, 847, 548 } },
-    { { 197, 1688, 771 }, { -1, -1, -1 }, { 853, 548, 547 } },
-    { { 197, 771, 1617 }, { -1, -1, -1 }, { 853, 547, 538 } },
-    { { 197, 1617, 926 }, { -1, -1, -1 }, { 853, 538, 855 } },
-    { { 197, 926, 1759 }, { -1, -1, -1 }, { 853, 855, 856 } },
-    { { 197, 1759, 927 }, { -1, -1, -1 }, { 853, 856, 854 } },
-    { { 198, 929, 1614 }, { -1, -1, -1 }, { 857, 858, 446 } },
-    { { 198, 1614, 765 }, { -1, -1, -1 }, { 857, 446, 532 } },
-    { { 198, 765, 1616 }, { -1, -1, -1 }, { 857, 532, 534 } },
-    { { 198, 1616, 925 }, { -1, -1, -1 }, { 857, 534, 850 } },
-    { { 198, 925, 1758 }, { -1, -1, -1 }, { 857, 850, 852 } },
-    { { 198, 1758, 928 }, { -1, -1, -1 }, { 857, 852, 859 } },
-    { { 198, 928, 1760 }, { -1, -1, -1 }, { 857, 859, 860 } },
-    { { 198, 1760, 929 }, { -1, -1, -1 }, { 857, 860, 858 } },
-    { { 199, 931, 1759 }, { -1, -1, -1 }, { 861, 862, 856 } },
-    { { 199, 1759, 926 }, { -1, -1, -1 }, { 861, 856, 855 } },
-    { { 199, 926, 1617 }, { -1, -1, -1 }, { 861, 855, 538 } },
-    { { 199, 1617, 766 }, { -1, -1, -1 }, { 861, 538, 537 } },
-    { { 199, 766, 1615 }, { -1, -1, -1 }, { 861, 537, 454 } },
-    { { 199, 1615, 930 }, { -1, -1, -1 }, { 861, 454, 863 } },
-    { { 199, 930, 1761 }, { -1, -1, -1 }, { 861, 863, 864 } },
-    { { 199, 1761, 931 }, { -1, -1, -1 }, { 861, 864, 862 } },
-    { { 200, 918, 1685 }, { -1, -1, -1 }, { 865, 839, 522 } },
-    { { 200, 1685, 758 }, { -1, -1, -1 }, { 865, 522, 521 } },
-    { { 200, 758, 1618 }, { -1, -1, -1 }, { 865, 521, 514 } },
-    { { 200, 1618, 932 }, { -1, -1, -1 }, { 865, 514, 866 } },
-    { { 200, 932, 1756 }, { -1, -1, -1 }, { 865, 866, 867 } },
-    { { 200, 1756, 933 }, { -1, -1, -1 }, { 865, 867, 868 } },
-    { { 200, 933, 1738 }, { -1, -1, -1 }, { 865, 868, 840 } },
-    { { 200, 1738, 918 }, { -1, -1, -1 }, { 865, 840, 839 } },
-    { { 201, 935, 1757 }, { -1, -1, -1 }, { 869, 870, 871 } },
-    { { 201, 1757, 934 }, { -1, -1, -1 }, { 869, 871, 872 } },
-    { { 201, 934, 1619 }, { -1, -1, -1 }, { 869, 872, 518 } },
-    { { 201, 1619, 762 }, { -1, -1, -1 }, { 869, 518, 530 } },
-    { { 201, 762, 1686 }, { -1, -1, -1 }, { 869, 530, 529 } },
-    { { 201, 1686, 921 }, { -1, -1, -1 }, { 869, 529, 846 } },
-    { { 201, 921, 1739 }, { -1, -1, -1 }, { 869, 846, 845 } },
-    { { 201, 1739, 935 }, { -1, -1, -1 }, { 869, 845, 870 } },
-    { { 202, 932, 1618 }, { -1, -1, -1 }, { 873, 866, 514 } },
-    { { 202, 1618, 755 }, { -1, -1, -1 }, { 873, 514, 513 } },
-    { { 202, 755, 1620 }, { -1, -1, -1 }, { 873, 513, 506 } },
-    { { 202, 1620, 936 }, { -1, -1, -1 }, { 873, 506, 874 } },
-    { { 202, 936, 1754 }, { -1, -1, -1 }, { 873, 874, 875 } },
-    { { 202, 1754, 937 }, { -1, -1, -1 }, { 873, 875, 876 } },
-    { { 202, 937, 1756 }, { -1, -1, -1 }, { 873, 876, 867 } },
-    { { 202, 1756, 932 }, { -1, -1, -1 }, { 873, 867, 866 } },
-    { { 203, 939, 1755 }, { -1, -1, -1 }, { 877, 878, 879 } },
-    { { 203, 1755, 938 }, { -1, -1, -1 }, { 877, 879, 880 } },
-    { { 203, 938, 1621 }, { -1, -1, -1 }, { 877, 880, 510 } },
-    { { 203, 1621, 757 }, { -1, -1, -1 }, { 877, 510, 519 } },
-    { { 203, 757, 1619 }, { -1, -1, -1 }, { 877, 519, 518 } },
-    { { 203, 1619, 934 }, { -1, -1, -1 }, { 877, 518, 872 } },
-    { { 203, 934, 1757 }, { -1, -1, -1 }, { 877, 872, 871 } },
-    { { 203, 1757, 939 }, { -1, -1, -1 }, { 877, 871, 878 } },
-    { { 204, 936, 1620 }, { -1, -1, -1 }, { 881, 874, 506 } },
-    { { 204, 1620, 751 }, { -1, -1, -1 }, { 881, 506, 505 } },
-    { { 204, 751, 1622 }, { -1, -1, -1 }, { 881, 505, 498 } },
-    { { 204, 1622, 940 }, { -1, -1, -1 }, { 881, 498, 882 } },
-    { { 204, 940, 1752 }, { -1, -1, -1 }, { 881, 882, 883 } },
-    { { 204, 1752, 941 }, { -1, -1, -1 }, { 881, 883, 884 } },
-    { { 204, 941, 1754 }, { -1, -1, -1 }, { 881, 884, 875 } },
-    { { 204, 1754, 936 }, { -1, -1, -1 }, { 881, 875, 874 } },
-    { { 205, 943, 1753 }, { -1, -1, -1 }, { 885, 886, 887 } },
-    { { 205, 1753, 942 }, { -1, -1, -1 }, { 885, 887, 888 } },
-    { { 205, 942, 1623 }, { -1, -1, -1 }, { 885, 888, 502 } },
-    { { 205, 1623, 753 }, { -1, -1, -1 }, { 885, 502, 511 } },
-    { { 205, 753, 1621 }, { -1, -1, -1 }, { 885, 511, 510 } },
-    { { 205, 1621, 938 }, { -1, -1, -1 }, { 885, 510, 880 } },
-    { { 205, 938, 1755 }, { -1, -1, -1 }, { 885, 880, 879 } },
-    { { 205, 1755, 943 }, { -1, -1, -1 }, { 885, 879, 886 } },
-    { { 206, 940, 1622 }, { -1, -1, -1 }, { 889, 882, 498 } },
-    { { 206, 1622, 747 }, { -1, -1, -1 }, { 889, 498, 497 } },
-    { { 206, 747, 1624 }, { -1, -1, -1 }, { 889, 497, 490 } },
-    { { 206, 1624, 944 }, { -1, -1, -1 }, { 889, 490, 890 } },
-    { { 206, 944, 1750 }, { -1, -1, -1 }, { 889, 890, 891 } },
-    { { 206, 1750, 945 }, { -1, -1, -1 }, { 889, 891, 892 } },
-    { { 206, 945, 1752 }, { -1, -1, -1 }, { 889, 892, 883 } },
-    { { 206, 1752, 940 }, { -1, -1, -1 }, { 889, 883, 882 } },
-    { { 207, 947, 1751 }, { -1, -1, -1 }, { 893, 894, 895 } },
-    { { 207, 1751, 946 }, { -1, -1, -1 }, { 893, 895, 896 } },
-    { { 207, 946, 1625 }, { -1, -1, -1 }, { 893, 896, 494 } },
-    { { 207, 1625, 749 }, { -1, -1, -1 }, { 893, 494, 503 } },
-    { { 207, 749, 1623 }, { -1, -1, -1 }, { 893, 503, 502 } },
-    { { 207, 1623, 942 }, { -1, -1, -1 }, { 893, 502, 888 } },
-    { { 207, 942, 1753 }, { -1, -1, -1 }, { 893, 888, 887 } },
-    { { 207, 1753, 947 }, { -1, -1, -1 }, { 893, 887, 894 } },
-    { { 208, 944, 1624 }, { -1, -1, -1 }, { 897, 890, 490 } },
-    { { 208, 1624, 743 }, { -1, -1, -1 }, { 897, 490, 489 } },
-    { { 208, 743, 1626 }, { -1, -1, -1 }, { 897, 489, 482 } },
-    { { 208, 1626, 948 }, { -1, -1, -1 }, { 897, 482, 898 } },
-    { { 208, 948, 1748 }, { -1, -1, -1 }, { 897, 898, 899 } },
-    { { 208, 1748, 949 }, { -1, -1, -1 }, { 897, 899, 900 } },
-    { { 208, 949, 1750 }, { -1, -1, -1 }, { 897, 900, 891 } },
-    { { 208, 1750, 944 }, { -1, -1, -1 }, { 897, 891, 890 } },
-    { { 209, 951, 1749 }, { -1, -1, -1 }, { 901, 902, 903 } },
-    { { 209, 1749, 950 }, { -1, -1, -1 }, { 901, 903, 904 } },
-    { { 209, 950, 1627 }, { -1, -1, -1 }, { 901, 904, 486 } },
-    { { 209, 1627, 745 }, { -1, -1, -1 }, { 901, 486, 495 } },
-    { { 209, 745, 1625 }, { -1, -1, -1 }, { 901, 495, 494 } },
-    { { 209, 1625, 946 }, { -1, -1, -1 }, { 901, 494, 896 } },
-    { { 209, 946, 1751 }, { -1, -1, -1 }, { 901, 896, 895 } },
-    { { 209, 1751, 951 }, { -1, -1, -1 }, { 901, 895, 902 } },
-    { { 210, 948, 1626 }, { -1, -1, -1 }, { 905, 898, 482 } },
-    { { 210, 1626, 739 }, { -1, -1, -1 }, { 905, 482, 481 } },
-    { { 210, 739, 1628 }, { -1, -1, -1 }, { 905, 481, 474 } },
-    { { 210, 1628, 952 }, { -1, -1, -1 }, { 905, 474, 906 } },
-    { { 210, 952, 1746 }, { -1, -1, -1 }, { 905, 906, 907 } },
-    { { 210, 1746, 953 }, { -1, -1, -1 }, { 905, 907, 908 } },
-    { { 210, 953, 1748 }, { -1, -1, -1 }, { 905, 908, 899 } },
-    { { 210, 1748, 948 }, { -1, -1, -1 }, { 905, 899, 898 } },
-    { { 211, 955, 1747 }, { -1, -1, -1 }, { 909, 910, 911 } },
-    { { 211, 1747, 954 }, { -1, -1, -1 }, { 909, 911, 912 } },
-    { { 211, 954, 1629 }, { -1, -1, -1 }, { 909, 912, 478 } },
-    { { 211, 1629, 741 }, { -1, -1, -1 }, { 909, 478, 487 } },
-    { { 211, 741, 1627 }, { -1, -1, -1 }, { 909, 487, 486 } },
-    { { 211, 1627, 950 }, { -1, -1, -1 }, { 909, 486, 904 } },
-    { { 211, 950, 1749 }, { -1, -1, -1 }, { 909, 904, 903 } },
-    { { 211, 1749, 955 }, { -1, -1, -1 }, { 909, 903, 910 } },
-    { { 212, 952, 1628 }, { -1, -1, -1 }, { 913, 906, 474 } },
-    { { 212, 1628, 735 }, { -1, -1, -1 }, { 913, 474, 473 } },
-    { { 212, 735, 1630 }, { -1, -1, -1 }, { 913, 473, 466 } },
-    { { 212, 1630, 956 }, { -1, -1, -1 }, { 913, 466, 914 } },
-    { { 212, 956, 1744 }, { -1, -1, -1 }, { 913, 914, 915 } },
-    { { 212, 1744, 957 }, { -1, -1, -1 }, { 913, 915, 916 } },
-    { { 212, 957, 1746 }, { -1, -1, -1 }, { 913, 916, 907 } },
-    { { 212, 1746, 952 }, { -1, -1, -1 }, { 913, 907, 906 } },
-    { { 213, 959, 1745 }, { -1, -1, -1 }, { 917, 918, 919 } },
-    { { 213, 1745, 958 }, { -1, -1, -1 }, { 917, 919, 920 } },
-    { { 213, 958, 1631 }, { -1, -1, -1 }, { 917, 920, 470 } },
-    { { 213, 1631, 737 }, { -1, -1, -1 }, { 917, 470, 479 } },
-    { { 213, 737, 1629 }, { -1, -1, -1 }, { 917, 479, 478 } },
-    { { 213, 1629, 954 }, { -1, -1, -1 }, { 917, 478, 912 } },
-    { { 213, 954, 1747 }, { -1, -1, -1 }, { 917, 912, 911 } },
-    { { 213, 1747, 959 }, { -1, -1, -1 }, { 917, 911, 918 } },
-    { { 214, 956, 1630 }, { -1, -1, -1 }, { 921, 914, 466 } },
-    { { 214, 1630, 731 }, { -1, -1, -1 }, { 921, 466, 465 } },
-    { { 214, 731, 1683 }, { -1, -1, -1 }, { 921, 465, 458 } },
-    { { 214, 1683, 960 }, { -1, -1, -1 }, { 921, 458, 922 } },
-    { { 214, 960, 1740 }, { -1, -1, -1 }, { 921, 922, 923 } },
-    { { 214, 1740, 961 }, { -1, -1, -1 }, { 921, 923, 924 } },
-    { { 214, 961, 1744 }, { -1, -1, -1 }, { 921, 924, 915 } },
-    { { 214, 1744, 956 }, { -1, -1, -1 }, { 921, 915, 914 } },
-    { { 215, 963, 1741 }, { -1, -1, -1 }, { 925, 926, 927 } },
-    { { 215, 1741, 962 }, { -1, -1, -1 }, { 925, 927, 928 } },
-    { { 215, 962, 1684 }, { -1, -1, -1 }, { 925, 928, 462 } },
-    { { 215, 1684, 733 }, { -1, -1, -1 }, { 925, 462, 471 } },
-    { { 215, 733, 1631 }, { -1, -1, -1 }, { 925, 471, 470 } },
-    { { 215, 1631, 958 }, { -1, -1, -1 }, { 925, 470, 920 } },
-    { { 215, 958, 1745 }, { -1, -1, -1 }, { 925, 920, 919 } },
-    { { 215, 1745, 963 }, { -1, -1, -1 }, { 925, 919, 926 } },
-    { { 216, 960, 1683 }, { -1, -1, -1 }, { 929, 922, 458 } },
-    { { 216, 1683, 726 }, { -1, -1, -1 }, { 929, 458, 457 } },
-    { { 216, 726, 1632 }, { -1, -1, -1 }, { 929, 457, 448 } },
-    { { 216, 1632, 964 }, { -1, -1, -1 }, { 929, 448, 930 } },
-    { { 216, 964, 1742 }, { -1, -1, -1 }, { 929, 930, 931 } },
-    { { 216, 1742, 965 }, { -1, -1, -1 }, { 929, 931, 932 } },
-    { { 216, 965, 1740 }, { -1, -1, -1 }, { 929, 932, 923 } },
-    { { 216, 1740, 960 }, { -1, -1, -1 }, { 929, 923, 922 } },
-    { { 217, 967, 1743 }, { -1, -1, -1 }, { 933, 934, 935 } },
-    { { 217, 1743, 966 }, { -1, -1, -1 }, { 933, 935, 936 } },
-    { { 217, 966, 1633 }, { -1, -1, -1 }, { 933, 936, 452 } },
-    { { 217, 1633, 729 }, { -1, -1, -1 }, { 933, 452, 463 } },
-    { { 217, 729, 1684 }, { -1, -1, -1 }, { 933, 463, 462 } },
-    { { 217, 1684, 962 }, { -1, -1, -1 }, { 933, 462, 928 } },
-    { { 217, 962, 1741 }, { -1, -1, -1 }, { 933, 928, 927 } },
-    { { 217, 1741, 967 }, { -1, -1, -1 }, { 933, 927, 934 } },
-    { { 218, 964, 1632 }, { -1, -1, -1 }, { 937, 930, 448 } },
-    { { 218, 1632, 720 }, { -1, -1, -1 }, { 937, 448, 447 } },
-    { { 218, 720, 1614 }, { -1, -1, -1 }, { 937, 447, 446 } },
-    { { 218, 1614, 929 }, { -1, -1, -1 }, { 937, 446, 858 } },
-    { { 218, 929, 1760 }, { -1, -1, -1 }, { 937, 858, 860 } },
-    { { 218, 1760, 968 }, { -1, -1, -1 }, { 937, 860, 938 } },
-    { { 218, 968, 1742 }, { -1, -1, -1 }, { 937, 938, 931 } },
-    { { 218, 1742, 964 }, { -1, -1, -1 }, { 937, 931, 930 } },
-    { { 219, 969, 1761 }, { -1, -1, -1 }, { 939, 940, 864 } },
-    { { 219, 1761, 930 }, { -1, -1, -1 }, { 939, 864, 863 } },
-    { { 219, 930, 1615 }, { -1, -1, -1 }, { 939, 863, 454 } },
-    { { 219, 1615, 724 }, { -1, -1, -1 }, { 939, 454, 453 } },
-    { { 219, 724, 1633 }, { -1, -1, -1 }, { 939, 453, 452 } },
-    { { 219, 1633, 966 }, { -1, -1, -1 }, { 939, 452, 936 } },
-    { { 219, 966, 1743 }, { -1, -1, -1 }, { 939, 936, 935 } },
-    { { 219, 1743, 969 }, { -1, -1, -1 }, { 939, 935, 940 } },
-    { { 220, 972, 1742 }, { -1, -1, -1 }, { 941, 942, 931 } },
-    { { 220, 1742, 968 }, { -1, -1, -1 }, { 941, 931, 938 } },
-    { { 220, 968, 1760 }, { -1, -1, -1 }, { 941, 938, 860 } },
-    { { 220, 1760, 970 }, { -1, -1, -1 }, { 941, 860, 943 } },
-    { { 220, 970, 1762 }, { -1, -1, -1 }, { 941, 943, 944 } },
-    { { 220, 1762, 971 }, { -1, -1, -1 }, { 941, 944, 945 } },
-    { { 220, 971, 1780 }, { -1, -1, -1 }, { 941, 945, 946 } },
-    { { 220, 1780, 972 }, { -1, -1, -1 }, { 941, 946, 942 } },
-    { { 221, 975, 1763 }, { -1, -1, -1 }, { 947, 948, 949 } },
-    { { 221, 1763, 973 }, { -1, -1, -1 }, { 947, 949, 950 } },
-    { { 221, 973, 1761 }, { -1, -1, -1 }, { 947, 950, 864 } },
-    { { 221, 1761, 969 }, { -1, -1, -1 }, { 947, 864, 940 } },
-    { { 221, 969, 1743 }, { -1, -1, -1 }, { 947, 940, 935 } },
-    { { 221, 1743, 974 }, { -1, -1, -1 }, { 947, 935, 951 } },
-    { { 221, 974, 1781 }, { -1, -1, -1 }, { 947, 951, 952 } },
-    { { 221, 1781, 975 }, { -1, -1, -1 }, { 947, 952, 948 } },
-    { { 222, 977, 1740 }, { -1, -1, -1 }, { 953, 954, 923 } },
-    { { 222, 1740, 965 }, { -1, -1, -1 }, { 953, 923, 932 } },
-    { { 222, 965, 1742 }, { -1, -1, -1 }, { 953, 932, 931 } },
-    { { 222, 1742, 972 }, { -1, -1, -1 }, { 953, 931, 942 } },
-    { { 222, 972, 1780 }, { -1, -1, -1 }, { 953, 942, 946 } },
-    { { 222, 1780, 976 }, { -1, -1, -1 }, { 953, 946, 955 } },
-    { { 222, 976, 1782 }, { -1, -1, -1 }, { 953, 955, 956 } },
-    { { 222, 1782, 977 }, { -1, -1, -1 }, { 953, 956, 954 } },
-    { { 223, 979, 1781 }, { -1, -1, -1 }, { 957, 958, 952 } },
-    { { 223, 1781, 974 }, { -1, -1, -1 }, { 957, 952, 951 } },
-    { { 223, 974, 1743 }, { -1, -1, -1 }, { 957, 951, 935 } },
-    { { 223, 1743, 967 }, { -1, -1, -1 }, { 957, 935, 934 } },
-    { { 223, 967, 1741 }, { -1, -1, -1 }, { 957, 934, 927 } },
-    { { 223, 1741, 978 }, { -1, -1, -1 }, { 957, 927, 959 } },
-    { { 223, 978, 1783 }, { -1, -1, -1 }, { 957, 959, 960 } },
-    { { 223, 1783, 979 }, { -1, -1, -1 }, { 957, 960, 958 } },
-    { { 224, 981, 1744 }, { -1, -1, -1 }, { 961, 962, 915 } },
-    { { 224, 1744, 961 }, { -1, -1, -1 }, { 961, 915, 924 } },
-    { { 224, 961, 1740 }, { -1, -1, -1 }, { 961, 924, 923 } },
-    { { 224, 1740, 977 }, { -1, -1, -1 }, { 961, 923, 954 } },
-    { { 224, 977, 1782 }, { -1, -1, -1 }, { 961, 954, 956 } },
-    { { 224, 1782, 980 }, { -1, -1, -1 }, { 961, 956, 963 } },
-    { { 224, 980, 1778 }, { -1, -1, -1 }, { 961, 963, 964 } },
-    { { 224, 1778, 981 }, { -1, -1, -1 }, { 961, 964, 962 } },
-    { { 225, 983, 1783 }, { -1, -1, -1 }, { 965, 966, 960 } },
-    { { 225, 1783, 978 }, { -1, -1, -1 }, { 965, 960, 959 } },
-    { { 225, 978, 1741 }, { -1, -1, -1 }, { 965, 959, 927 } },
-    { { 225, 1741, 963 }, { -1, -1, -1 }, { 965, 927, 926 } },
-    { { 225, 963, 1745 }, { -1, -1, -1 }, { 965, 926, 919 } },
-    { { 225, 1745, 982 }, { -1, -1, -1 }, { 965, 919, 967 } },
-    { { 225, 982, 1779 }, { -1, -1, -1 }, { 965, 967, 968 } },
-    { { 225, 1779, 983 }, { -1, -1, -1 }, { 965, 968, 966 } },
-    { { 226, 985, 1746 }, { -1, -1, -1 }, { 969, 970, 907 } },
-    { { 226, 1746, 957 }, { -1, -1, -1 }, { 969, 907, 916 } },
-    { { 226, 957, 1744 }, { -1, -1, -1 }, { 969, 916, 915 } },
-    { { 226, 1744, 981 }, { -1, -1, -1 }, { 969, 915, 962 } },
-    { { 226, 981, 1778 }, { -1, -1, -1 }, { 969, 962, 964 } },
-    { { 226, 1778, 984 }, { -1, -1, -1 }, { 969, 964, 971 } },
-    { { 226, 984, 1776 }, { -1, -1, -1 }, { 969, 971, 972 } },
-    { { 226, 1776, 985 }, { -1, -1, -1 }, { 969, 972, 970 } },
-    { { 227, 987, 1779 }, { -1, -1, -1 }, { 973, 974, 968 } },
-    { { 227, 1779, 982 }, { -1, -1, -1 }, { 973, 968, 967 } },
-    { { 227, 982, 1745 }, { -1, -1, -1 }, { 973, 967, 919 } },
-    { { 227, 1745, 959 }, { -1, -1, -1 }, { 973, 919, 918 } },
-    { { 227, 959, 1747 }, { -1, -1, -1 }, { 973, 918, 911 } },
-    { { 227, 1747, 986 }, { -1, -1, -1 }, { 973, 911, 975 } },
-    { { 227, 986, 1777 }, { -1, -1, -1 }, { 973, 975, 976 } },
-    { { 227, 1777, 987 }, { -1, -1, -1 }, { 973, 976, 974 } },
-    { { 228, 989, 1748 }, { -1, -1, -1 }, { 977, 978, 899 } },
-    { { 228, 1748, 953 }, { -1, -1, -1 }, { 977, 899, 908 } },
-    { { 228, 953, 1746 }, { -1, -1, -1 }, { 977, 908, 907 } },
-    { { 228, 1746, 985 }, { -1, -1, -1 }, { 977, 907, 970 } },
-    { { 228, 985, 1776 }, { -1, -1, -1 }, { 977, 970, 972 } },
-    { { 228, 1776, 988 }, { -1, -1, -1 }, { 977, 972, 979 } },
-    { { 228, 988, 1774 }, { -1, -1, -1 }, { 977, 979, 980 } },
-    { { 228, 1774, 989 }, { -1, -1, -1 }, { 977, 980, 978 } },
-    { { 229, 991, 1777 }, { -1, -1, -1 }, { 981, 982, 976 } },
-    { { 229, 1777, 986 }, { -1, -1, -1 }, { 981, 976, 975 } },
-    { { 229, 986, 1747 }, { -1, -1, -1 }, { 981, 975, 911 } },
-    { { 229, 1747, 955 }, { -1, -1, -1 }, { 981, 911, 910 } },
-    { { 229, 955, 1749 }, { -1, -1, -1 }, { 981, 910, 903 } },
-    { { 229, 1749, 990 }, { -1, -1, -1 }, { 981, 903, 983 } },
-    { { 229, 990, 1775 }, { -1, -1, -1 }, { 981, 983, 984 } },
-    { { 229, 1775, 991 }, { -1, -1, -1 }, { 981, 984, 982 } },
-    { { 230, 993, 1750 }, { -1, -1, -1 }, { 985, 986, 891 } },
-    { { 230, 1750, 949 }, { -1, -1, -1 }, { 985, 891, 900 } },
-    { { 230, 949, 1748 }, { -1, -1, -1 }, { 985, 900, 899 } },
-    { { 230, 1748, 989 }, { -1, -1, -1 }, { 985, 899, 978 } },
-    { { 230, 989, 1774 }, { -1, -1, -1 }, { 985, 978, 980 } },
-    { { 230, 1774, 992 }, { -1, -1, -1 }, { 985, 980, 987 } },
-    { { 230, 992, 1772 }, { -1, -1, -1 }, { 985, 987, 988 } },
-    { { 230, 1772, 993 }, { -1, -1, -1 }, { 985, 988, 986 } },
-    { { 231, 995, 1775 }, { -1, -1, -1 }, { 989, 990, 984 } },
-    { { 231, 1775, 990 }, { -1, -1, -1 }, { 989, 984, 983 } },
-    { { 231, 990, 1749 }, { -1, -1, -1 }, { 989, 983, 903 } },
-    { { 231, 1749, 951 }, { -1, -1, -1 }, { 989, 903, 902 } },
-    { { 231, 951, 1751 }, { -1, -1, -1 }, { 989, 902, 895 } },
-    { { 231, 1751, 994 }, { -1, -1, -1 }, { 989, 895, 991 } },
-    { { 231, 994, 1773 }, { -1, -1, -1 }, { 989, 991, 992 } },
-    { { 231, 1773, 995 }, { -1, -1, -1 }, { 989, 992, 990 } },
-    { { 232, 997, 1752 }, { -1, -1, -1 }, { 993, 994, 883 } },
-    { { 232, 1752, 945 }, { -1, -1, -1 }, { 993, 883, 892 } },
-    { { 232, 945, 1750 }, { -1, -1, -1 }, { 993, 892, 891 } },
-    { { 232, 1750, 993 }, { -1, -1, -1 }, { 993, 891, 986 } },
-    { { 232, 993, 1772 }, { -1, -1, -1 }, { 993, 986, 988 } },
-    { { 232, 1772, 996 }, { -1, -1, -1 }, { 993, 988, 995 } },
-    { { 232, 996, 1770 }, { -1, -1, -1 }, { 993, 995, 996 } },
-    { { 232, 1770, 997 }, { -1, -1, -1 }, { 993, 996, 994 } },
-    { { 233, 999, 1773 }, { -1, -1, -1 }, { 997, 998, 992 } },
-    { { 233, 1773, 994 }, { -1, -1, -1 }, { 997, 992, 991 } },
-    { { 233, 994, 1751 }, { -1, -1, -1 }, { 997, 991, 895 } },
-    { { 233, 1751, 947 }, { -1, -1, -1 }, { 997, 895, 894 } },
-    { { 233, 947, 1753 }, { -1, -1, -1 }, { 997, 894, 887 } },
-    { { 233, 1753, 998 }, { -1, -1, -1 }, { 997, 887, 999 } },
-    { { 233, 998, 1771 }, { -1, -1, -1 }, { 997, 999, 1000 } },
-    { { 233, 1771, 999 }, { -1, -1, -1 }, { 997, 1000, 998 } },
-    { { 234, 1001, 1754 }, { -1, -1, -1 }, { 1001, 1002, 875 } },
-    { { 234, 1754, 941 }, { -1, -1, -1 }, { 1001, 875, 884 } },
-    { { 234, 941, 1752 }, { -1, -1, -1 }, { 1001, 884, 883 } },
-    { { 234, 1752, 997 }, { -1, -1, -1 }, { 1001, 883, 994 } },
-    { { 234, 997, 1770 }, { -1, -1, -1 }, { 1001, 994, 996 } },
-    { { 234, 1770, 1000 }, { -1, -1, -1 }, { 1001, 996, 1003 } },
-    { { 234, 1000, 1768 }, { -1, -1, -1 }, { 1001, 1003, 1004 } },
-    { { 234, 1768, 1001 }, { -1, -1, -1 }, { 1001, 1004, 1002 } },
-    { { 235, 1003, 1771 }, { -1, -1, -1 }, { 1005, 1006, 1000 } },
-    { { 235, 1771, 998 }, { -1, -1, -1 }, { 1005, 1000, 999 } },
-    { { 235, 998, 1753 }, { -1, -1, -1 }, { 1005, 999, 887 } },
-    { { 235, 1753, 943 }, { -1, -1, -1 }, { 1005, 887, 886 } },
-    { { 235, 943, 1755 }, { -1, -1, -1 }, { 1005, 886, 879 } },
-    { { 235, 1755, 1002 }, { -1, -1, -1 }, { 1005, 879, 1007 } },
-    { { 235, 1002, 1769 }, { -1, -1, -1 }, { 1005, 1007, 1008 } },
-    { { 235, 1769, 1003 }, { -1, -1, -1 }, { 1005, 1008, 1006 } },
-    { { 236, 1005, 1756 }, { -1, -1, -1 }, { 1009, 1010, 867 } },
-    { { 236, 1756, 937 }, { -1, -1, -1 }, { 1009, 867, 876 } },
-    { { 236, 937, 1754 }, { -1, -1, -1 }, { 1009, 876, 875 } },
-    { { 236, 1754, 1001 }, { -1, -1, -1 }, { 1009, 875, 1002 } },
-    { { 236, 1001, 1768 }, { -1, -1, -1 }, { 1009, 1002, 1004 } },
-    { { 236, 1768, 1004 }, { -1, -1, -1 }, { 1009, 1004, 1011 } },
-    { { 236, 1004, 1766 }, { -1, -1, -1 }, { 1009, 1011, 1012 } },
-    { { 236, 1766, 1005 }, { -1, -1, -1 }, { 1009, 1012, 1010 } },
-    { { 237, 1007, 1769 }, { -1, -1, -1 }, { 1013, 1014, 1008 } },
-    { { 237, 1769, 1002 }, { -1, -1, -1 }, { 1013, 1008, 1007 } },
-    { { 237, 1002, 1755 }, { -1, -1, -1 }, { 1013, 1007, 879 } },
-    { { 237, 1755, 939 }, { -1, -1, -1 }, { 1013, 879, 878 } },
-    { { 237, 939, 1757 }, { -1, -1, -1 }, { 1013, 878, 871 } },
-    { { 237, 1757, 1006 }, { -1, -1, -1 }, { 1013, 871, 1015 } },
-    { { 237, 1006, 1767 }, { -1, -1, -1 }, { 1013, 1015, 1016 } },
-    { { 237, 1767, 1007 }, { -1, -1, -1 }, { 1013, 1016, 1014 } },
-    { { 238, 1009, 1738 }, { -1, -1, -1 }, { 1017, 1018, 840 } },
-    { { 238, 1738, 933 }, { -1, -1, -1 }, { 1017, 840, 868 } },
-    { { 238, 933, 1756 }, { -1, -1, -1 }, { 1017, 868, 867 } },
-    { { 238, 1756, 1005 }, { -1, -1, -1 }, { 1017, 867, 1010 } },
-    { { 238, 1005, 1766 }, { -1, -1, -1 }, { 1017, 1010, 1012 } },
-    { { 238, 1766, 1008 }, { -1, -1, -1 }, { 1017, 1012, 1019 } },
-    { { 238, 1008, 1784 }, { -1, -1, -1 }, { 1017, 1019, 1020 } },
-    { { 238, 1784, 1009 }, { -1, -1, -1 }, { 1017, 1020, 1018 } },
-    { { 239, 1011, 1767 }, { -1, -1, -1 }, { 1021, 1022, 1016 } },
-    { { 239, 1767, 1006 }, { -1, -1, -1 }, { 1021, 1016, 1015 } },
-    { { 239, 1006, 1757 }, { -1, -1, -1 }, { 1021, 1015, 871 } },
-    { { 239, 1757, 935 }, { -1, -1, -1 }, { 1021, 871, 870 } },
-    { { 239, 935, 1739 }, { -1, -1, -1 }, { 1021, 870, 845 } },
-    { { 239, 1739, 1010 }, { -1, -1, -1 }, { 1021, 845, 1023 } },
-    { { 239, 1010, 1785 }, { -1, -1, -1 }, { 1021, 1023, 1024 } },
-    { { 239, 1785, 1011 }, { -1, -1, -1 }, { 1021, 1024, 1022 } },
-    { { 240, 970, 1760 }, { -1, -1, -1 }, { 1025, 943, 860 } },
-    { { 240, 1760, 928 }, { -1, -1, -1 }, { 1025, 860, 859 } },
-    { { 240, 928, 1758 }, { -1, -1, -1 }, { 1025, 859, 852 } },
-    { { 240, 1758, 1012 }, { -1, -1, -1 }, { 1025, 852, 1026 } },
-    { { 240, 1012, 1764 }, { -1, -1, -1 }, { 1025, 1026, 1027 } },
-    { { 240, 1764, 1013 }, { -1, -1, -1 }, { 1025, 1027, 1028 } },
-    { { 240, 1013, 1762 }, { -1, -1, -1 }, { 1025, 1028, 944 } },
-    { { 240, 1762, 970 }, { -1, -1, -1 }, { 1025, 944, 943 } },
-    { { 241, 1015, 1765 }, { -1, -1, -1 }, { 1029, 1030, 1031 } },
-    { { 241, 1765, 1014 }, { -1, -1, -1 }, { 1029, 1031, 1032 } },
-    { { 241, 1014, 1759 }, { -1, -1, -1 }, { 1029, 1032, 856 } },
-    { { 241, 1759, 931 }, { -1, -1, -1 }, { 1029, 856, 862 } },
-    { { 241, 931, 1761 }, { -1, -1, -1 }, { 1029, 862, 864 } },
-    { { 241, 1761, 973 }, { -1, -1, -1 }, { 1029, 864, 950 } },
-    { { 241, 973, 1763 }, { -1, -1, -1 }, { 1029, 950, 949 } },
-    { { 241, 1763, 1015 }, { -1, -1, -1 }, { 1029, 949, 1030 } },
-    { { 242, 1012, 1758 }, { -1, -1, -1 }, { 1033, 1026, 852 } },
-    { { 242, 1758, 924 }, { -1, -1, -1 }, { 1033, 852, 851 } },
-    { { 242, 924, 1736 }, { -1, -1, -1 }, { 1033, 851, 842 } },
-    { { 242, 1736, 1016 }, { -1, -1, -1 }, { 1033, 842, 1034 } },
-    { { 242, 1016, 1786 }, { -1, -1, -1 }, { 1033, 1034, 1035 } },
-    { { 242, 1786, 1017 }, { -1, -1, -1 }, { 1033, 1035, 1036 } },
-    { { 242, 1017, 1764 }, { -1, -1, -1 }, { 1033, 1036, 1027 } },
-    { { 242, 1764, 1012 }, { -1, -1, -1 }, { 1033, 1027, 1026 } },
-    { { 243, 1019, 1787 }, { -1, -1, -1 }, { 1037, 1038, 1039 } },
-    { { 243, 1787, 1018 }, { -1, -1, -1 }, { 1037, 1039, 1040 } },
-    { { 243, 1018, 1737 }, { -1, -1, -1 }, { 1037, 1040, 848 } },
-    { { 243, 1737, 927 }, { -1, -1, -1 }, { 1037, 848, 854 } },
-    { { 243, 927, 1759 }, { -1, -1, -1 }, { 1037, 854, 856 } },
-    { { 243, 1759, 1014 }, { -1, -1, -1 }, { 1037, 856, 1032 } },
-    { { 243, 1014, 1765 }, { -1, -1, -1 }, { 1037, 1032, 1031 } },
-    { { 243, 1765, 1019 }, { -1, -1, -1 }, { 1037, 1031, 1038 } },
-    { { 244, 1016, 1736 }, { -1, -1, -1 }, { 1041, 1034, 842 } },
-    { { 244, 1736, 919 }, { -1, -1, -1 }, { 1041, 842, 841 } },
-    { { 244, 919, 1738 }, { -1, -1, -1 }, { 1041, 841, 840 } },
-    { { 244, 1738, 1009 }, { -1, -1, -1 }, { 1041, 840, 1018 } },
-    { { 244, 1009, 1784 }, { -1, -1, -1 }, { 1041, 1018, 1020 } },
-    { { 244, 1784, 1020 }, { -1, -1, -1 }, { 1041, 1020, 1042 } },
-    { { 244, 1020, 1786 }, { -1, -1, -1 }, { 1041, 1042, 1035 } },
-    { { 244, 1786, 1016 }, { -1, -1, -1 }, { 1041, 1035, 1034 } },
-    { { 245, 1021, 1785 }, { -1, -1, -1 }, { 1043, 1044, 1024 } },
-    { { 245, 1785, 1010 }, { -1, -1, -1 }, { 1043, 1024, 1023 } },
-    { { 245, 1010, 1739 }, { -1, -1, -1 }, { 1043, 1023, 845 } },
-    { { 245, 1739, 923 }, { -1, -1, -1 }, { 1043, 845, 844 } },
-    { { 245, 923, 1737 }, { -1, -1, -1 }, { 1043, 844, 848 } },
-    { { 245, 1737, 1018 }, { -1, -1, -1 }, { 1043, 848, 1040 } },
-    { { 245, 1018, 1787 }, { -1, -1, -1 }, { 1043, 1040, 1039 } },
-    { { 245, 1787, 1021 }, { -1, -1, -1 }, { 1043, 1039, 1044 } },
-    { { 246, 1024, 1571 }, { -1, -1, -1 }, { 1045, 1046, 437 } },
-    { { 246, 1571, 715 }, { -1, -1, -1 }, { 1045, 437, 436 } },
-    { { 246, 715, 1612 }, { -1, -1, -1 }, { 1045, 436, 425 } },
-    { { 246, 1612, 1022 }, { -1, -1, -1 }, { 1045, 425, 1047 } },
-    { { 246, 1022, 1788 }, { -1, -1, -1 }, { 1045, 1047, 1048 } },
-    { { 246, 1788, 1023 }, { -1, -1, -1 }, { 1045, 1048, 1049 } },
-    { { 246, 1023, 1577 }, { -1, -1, -1 }, { 1045, 1049, 1050 } },
-    { { 246, 1577, 1024 }, { -1, -1, -1 }, { 1045, 1050, 1046 } },
-    { { 247, 1026, 1789 }, { -1, -1, -1 }, { 1051, 1052, 1053 } },
-    { { 247, 1789, 1025 }, { -1, -1, -1 }, { 1051, 1053, 1054 } },
-    { { 247, 1025, 1613 }, { -1, -1, -1 }, { 1051, 1054, 433 } },
-    { { 247, 1613, 718 }, { -1, -1, -1 }, { 1051, 433, 443 } },
-    { { 247, 718, 1571 }, { -1, -1, -1 }, { 1051, 443, 437 } },
-    { { 247, 1571, 1024 }, { -1, -1, -1 }, { 1051, 437, 1046 } },
-    { { 247, 1024, 1577 }, { -1, -1, -1 }, { 1051, 1046, 1050 } },
-    { { 247, 1577, 1026 }, { -1, -1, -1 }, { 1051, 1050, 1052 } },
-    { { 248, 1022, 1612 }, { -1, -1, -1 }, { 1055, 1047, 425 } },
-    { { 248, 1612, 709 }, { -1, -1, -1 }, { 1055, 425, 424 } },
-    { { 248, 709, 1610 }, { -1, -1, -1 }, { 1055, 424, 413 } },
-    { { 248, 1610, 1027 }, { -1, -1, -1 }, { 1055, 413, 1056 } },
-    { { 248, 1027, 1790 }, { -1, -1, -1 }, { 1055, 1056, 1057 } },
-    { { 248, 1790, 1028 }, { -1, -1, -1 }, { 1055, 1057, 1058 } },
-    { { 248, 1028, 1788 }, { -1, -1, -1 }, { 1055, 1058, 1048 } },
-    { { 248, 1788, 1022 }, { -1, -1, -1 }, { 1055, 1048, 1047 } },
-    { { 249, 1030, 1791 }, { -1, -1, -1 }, { 1059, 1060, 1061 } },
-    { { 249, 1791, 1029 }, { -1, -1, -1 }, { 1059, 1061, 1062 } },
-    { { 249, 1029, 1611 }, { -1, -1, -1 }, { 1059, 1062, 421 } },
-    { { 249, 1611, 713 }, { -1, -1, -1 }, { 1059, 421, 434 } },
-    { { 249, 713, 1613 }, { -1, -1, -1 }, { 1059, 434, 433 } },
-    { { 249, 1613, 1025 }, { -1, -1, -1 }, { 1059, 433, 1054 } },
-    { { 249, 1025, 1789 }, { -1, -1, -1 }, { 1059, 1054, 1053 } },
-    { { 249, 1789, 1030 }, { -1, -1, -1 }, { 1059, 1053, 1060 } },
-    { { 250, 1027, 1610 }, { -1, -1, -1 }, { 1063, 1056, 413 } },
-    { { 250, 1610, 703 }, { -1, -1, -1 }, { 1063, 413, 412 } },
-    { { 250, 703, 1608 }, { -1, -1, -1 }, { 1063, 412, 401 } },
-    { { 250, 1608, 1031 }, { -1, -1, -1 }, { 1063, 401, 1064 } },
-    { { 250, 1031, 1792 }, { -1, -1, -1 }, { 1063, 1064, 1065 } },
-    { { 250, 1792, 1032 }, { -1, -1, -1 }, { 1063, 1065, 1066 } },
-    { { 250, 1032, 1790 }, { -1, -1, -1 }, { 1063, 1066, 1057 } },
-    { { 250, 1790, 1027 }, { -1, -1, -1 }, { 1063, 1057, 1056 } },
-    { { 251, 1034, 1793 }, { -1, -1, -1 }, { 1067, 1068, 1069 } },
-    { { 251, 1793, 1033 }, { -1, -1, -1 }, { 1067, 1069, 1070 } },
-    { { 251, 1033, 1609 }, { -1, -1, -1 }, { 1067, 1070, 409 } },
-    { { 251, 1609, 707 }, { -1, -1, -1 }, { 1067, 409, 422 } },
-    { { 251, 707, 1611 }, { -1, -1, -1 }, { 1067, 422, 421 } },
-    { { 251, 1611, 1029 }, { -1, -1, -1 }, { 1067, 421, 1062 } },
-    { { 251, 1029, 1791 }, { -1, -1, -1 }, { 1067, 1062, 1061 } },
-    { { 251, 1791, 1034 }, { -1, -1, -1 }, { 1067, 1061, 1068 } },
-    { { 252, 1031, 1608 }, { -1, -1, -1 }, { 1071, 1064, 401 } },
-    { { 252, 1608, 697 }, { -1, -1, -1 }, { 1071, 401, 400 } },
-    { { 252, 697, 1606 }, { -1, -1, -1 }, { 1071, 400, 389 } },
-    { { 252, 1606, 1035 }, { -1, -1, -1 }, { 1071, 389, 1072 } },
-    { { 252, 1035, 1794 }, { -1, -1, -1 }, { 1071, 1072, 1073 } },
-    { { 252, 1794, 1036 }, { -1, -1, -1 }, { 1071, 1073, 1074 } },
-    { { 252, 1036, 1792 }, { -1, -1, -1 }, { 1071, 1074, 1065 } },
-    { { 252, 1792, 1031 }, { -1, -1, -1 }, { 1071, 1065, 1064 } },
-    { { 253, 1038, 1795 }, { -1, -1, -1 }, { 1075, 1076, 1077 } },
-    { { 253, 1795, 1037 }, { -1, -1, -1 }, { 1075, 1077, 1078 } },
-    { { 253, 1037, 1607 }, { -1, -1, -1 }, { 1075, 1078, 397 } },
-    { { 253, 1607, 701 }, { -1, -1, -1 }, { 1075, 397, 410 } },
-    { { 253, 701, 1609 }, { -1, -1, -1 }, { 1075, 410, 409 } },
-    { { 253, 1609, 1033 }, { -1, -1, -1 }, { 1075, 409, 1070 } },
-    { { 253, 1033, 1793 }, { -1, -1, -1 }, { 1075, 1070, 1069 } },
-    { { 253, 1793, 1038 }, { -1, -1, -1 }, { 1075, 1069, 1076 } },
-    { { 254, 1035, 1606 }, { -1, -1, -1 }, { 1079, 1072, 389 } },
-    { { 254, 1606, 691 }, { -1, -1, -1 }, { 1079, 389, 388 } },
-    { { 254, 691, 1604 }, { -1, -1, -1 }, { 1079, 388, 377 } },
-    { { 254, 1604, 1039 }, { -1, -1, -1 }, { 1079, 377, 1080 } },
-    { { 254, 1039, 1796 }, { -1, -1, -1 }, { 1079, 1080, 1081 } },
-    { { 254, 1796, 1040 }, { -1, -1, -1 }, { 1079, 1081, 1082 } },
-    { { 254, 1040, 1794 }, { -1, -1, -1 }, { 1079, 1082, 1073 } },
-    { { 254, 1794, 1035 }, { -1, -1, -1 }, { 1079, 1073, 1072 } },
-    { { 255, 1042, 1797 }, { -1, -1, -1 }, { 1083, 1084, 1085 } },
-    { { 255, 1797, 1041 }, { -1, -1, -1 }, { 1083, 1085, 1086 } },
-    { { 255, 1041, 1605 }, { -1, -1, -1 }, { 1083, 1086, 385 } },
-    { { 255, 1605, 695 }, { -1, -1, -1 }, { 1083, 385, 398 } },
-    { { 255, 695, 1607 }, { -1, -1, -1 }, { 1083, 398, 397 } },
-    { { 255, 1607, 1037 }, { -1, -1, -1 }, { 1083, 397, 1078 } },
-    { { 255, 1037, 1795 }, { -1, -1, -1 }, { 1083, 1078, 1077 } },
-    { { 255, 1795, 1042 }, { -1, -1, -1 }, { 1083, 1077, 1084 } },
-    { { 256, 1039, 1604 }, { -1, -1, -1 }, { 1087, 1080, 377 } },
-    { { 256, 1604, 685 }, { -1, -1, -1 }, { 1087, 377, 376 } },
-    { { 256, 685, 1602 }, { -1, -1, -1 }, { 1087, 376, 365 } },
-    { { 256, 1602, 1043 }, { -1, -1, -1 }, { 1087, 365, 1088 } },
-    { { 256, 1043, 1798 }, { -1, -1, -1 }, { 1087, 1088, 1089 } },
-    { { 256, 1798, 1044 }, { -1, -1, -1 }, { 1087, 1089, 1090 } },
-    { { 256, 1044, 1796 }, { -1, -1, -1 }, { 1087, 1090, 1081 } },
-    { { 256, 1796, 1039 }, { -1, -1, -1 }, { 1087, 1081, 1080 } },
-    { { 257, 1046, 1799 }, { -1, -1, -1 }, { 1091, 1092, 1093 } },
-    { { 257, 1799, 1045 }, { -1, -1, -1 }, { 1091, 1093, 1094 } },
-    { { 257, 1045, 1603 }, { -1, -1, -1 }, { 1091, 1094, 373 } },
-    { { 257, 1603, 689 }, { -1, -1, -1 }, { 1091, 373, 386 } },
-    { { 257, 689, 1605 }, { -1, -1, -1 }, { 1091, 386, 385 } },
-    { { 257, 1605, 1041 }, { -1, -1, -1 }, { 1091, 385, 1086 } },
-    { { 257, 1041, 1797 }, { -1, -1, -1 }, { 1091, 1086, 1085 } },
-    { { 257, 1797, 1046 }, { -1, -1, -1 }, { 1091, 1085, 1092 } },
-    { { 258, 1043, 1602 }, { -1, -1, -1 }, { 1095, 1088, 365 } },
-    { { 258, 1602, 679 }, { -1, -1, -1 }, { 1095, 365, 364 } },
-    { { 258, 679, 1600 }, { -1, -1, -1 }, { 1095, 364, 353 } },
-    { { 258, 1600, 1047 }, { -1, -1, -1 }, { 1095, 353, 1096 } },
-    { { 258, 1047, 1800 }, { -1, -1, -1 }, { 1095, 1096, 1097 } },
-    { { 258, 1800, 1048 }, { -1, -1, -1 }, { 1095, 1097, 1098 } },
-    { { 258, 1048, 1798 }, { -1, -1, -1 }, { 1095, 1098, 1089 } },
-    { { 258, 1798, 1043 }, { -1, -1, -1 }, { 1095, 1089, 1088 } },
-    { { 259, 1050, 1801 }, { -1, -1, -1 }, { 1099, 1100, 1101 } },
-    { { 259, 1801, 1049 }, { -1, -1, -1 }, { 1099, 1101, 1102 } },
-    { { 259, 1049, 1601 }, { -1, -1, -1 }, { 1099, 1102, 361 } },
-    { { 259, 1601, 683 }, { -1, -1, -1 }, { 1099, 361, 374 } },
-    { { 259, 683, 1603 }, { -1, -1, -1 }, { 1099, 374, 373 } },
-    { { 259, 1603, 1045 }, { -1, -1, -1 }, { 1099, 373, 1094 } },
-    { { 259, 1045, 1799 }, { -1, -1, -1 }, { 1099, 1094, 1093 } },
-    { { 259, 1799, 1050 }, { -1, -1, -1 }, { 1099, 1093, 1100 } },
-    { { 260, 1047, 1600 }, { -1, -1, -1 }, { 1103, 1096, 353 } },
-    { { 260, 1600, 673 }, { -1, -1, -1 }, { 1103, 353, 352 } },
-    { { 260, 673, 1598 }, { -1, -1, -1 }, { 1103, 352, 341 } },
-    { { 260, 1598, 1051 }, { -1, -1, -1 }, { 1103, 341, 1104 } },
-    { { 260, 1051, 1802 }, { -1, -1, -1 }, { 1103, 1104, 1105 } },
-    { { 260, 1802, 1052 }, { -1, -1, -1 }, { 1103, 1105, 1106 } },
-    { { 260, 1052, 1800 }, { -1, -1, -1 }, { 1103, 1106, 1097 } },
-    { { 260, 1800, 1047 }, { -1, -1, -1 }, { 1103, 1097, 1096 } },
-    { { 261, 1054, 1803 }, { -1, -1, -1 }, { 1107, 1108, 1109 } },
-    { { 261, 1803, 1053 }, { -1, -1, -1 }, { 1107, 1109, 1110 } },
-    { { 261, 1053, 1599 }, { -1, -1, -1 }, { 1107, 1110, 349 } },
-    { { 261, 1599, 677 }, { -1, -1, -1 }, { 1107, 349, 362 } },
-    { { 261, 677, 1601 }, { -1, -1, -1 }, { 1107, 362, 361 } },
-    { { 261, 1601, 1049 }, { -1, -1, -1 }, { 1107, 361, 1102 } },
-    { { 261, 1049, 1801 }, { -1, -1, -1 }, { 1107, 1102, 1101 } },
-    { { 261, 1801, 1054 }, { -1, -1, -1 }, { 1107, 1101, 1108 } },
-    { { 262, 1051, 1598 }, { -1, -1, -1 }, { 1111, 1104, 341 } },
-    { { 262, 1598, 667 }, { -1, -1, -1 }, { 1111, 341, 340 } },
-    { { 262, 667, 1596 }, { -1, -1, -1 }, { 1111, 340, 325 } },
-    { { 262, 1596, 1055 }, { -1, -1, -1 }, { 1111, 325, 1112 } },
-    { { 262, 1055, 1804 }, { -1, -1, -1 }, { 1111, 1112, 1113 } },
-    { { 262, 1804, 1056 }, { -1, -1, -1 }, { 1111, 1113, 1114 } },
-    { { 262, 1056, 1802 }, { -1, -1, -1 }, { 1111, 1114, 1105 } },
-    { { 262, 1802, 1051 }, { -1, -1, -1 }, { 1111, 1105, 1104 } },
-    { { 263, 1058, 1805 }, { -1, -1, -1 }, { 1115, 1116, 1117 } },
-    { { 263, 1805, 1057 }, { -1, -1, -1 }, { 1115, 1117, 1118 } },
-    { { 263, 1057, 1597 }, { -1, -1, -1 }, { 1115, 1118, 334 } },
-    { { 263, 1597, 671 }, { -1, -1, -1 }, { 1115, 334, 350 } },
-    { { 263, 671, 1599 }, { -1, -1, -1 }, { 1115, 350, 349 } },
-    { { 263, 1599, 1053 }, { -1, -1, -1 }, { 1115, 349, 1110 } },
-    { { 263, 1053, 1803 }, { -1, -1, -1 }, { 1115, 1110, 1109 } },
-    { { 263, 1803, 1058 }, { -1, -1, -1 }, { 1115, 1109, 1116 } },
-    { { 264, 1062, 1812 }, { -1, -1, -1 }, { 1119, 1120, 1121 } },
-    { { 264, 1812, 1059 }, { -1, -1, -1 }, { 1119, 1121, 1122 } },
-    { { 264, 1059, 1813 }, { -1, -1, -1 }, { 1119, 1122, 1123 } },
-    { { 264, 1813, 1060 }, { -1, -1, -1 }, { 1119, 1123, 1124 } },
-    { { 264, 1060, 1832 }, { -1, -1, -1 }, { 1119, 1124, 1125 } },
-    { { 264, 1832, 1061 }, { -1, -1, -1 }, { 1119, 1125, 1126 } },
-    { { 264, 1061, 1842 }, { -1, -1, -1 }, { 1119, 1126, 1127 } },
-    { { 264, 1842, 1062 }, { -1, -1, -1 }, { 1119, 1127, 1120 } },
-    { { 265, 1065, 1833 }, { -1, -1, -1 }, { 1128, 1129, 1130 } },
-    { { 265, 1833, 1063 }, { -1, -1, -1 }, { 1128, 1130, 1131 } },
-    { { 265, 1063, 1813 }, { -1, -1, -1 }, { 1128, 1131, 1123 } },
-    { { 265, 1813, 1059 }, { -1, -1, -1 }, { 1128, 1123, 1122 } },
-    { { 265, 1059, 1812 }, { -1, -1, -1 }, { 1128, 1122, 1121 } },
-    { { 265, 1812, 1064 }, { -1, -1, -1 }, { 1128, 1121, 1132 } },
-    { { 265, 1064, 1843 }, { -1, -1, -1 }, { 1128, 1132, 1133 } },
-    { { 265, 1843, 1065 }, { -1, -1, -1 }, { 1128, 1133, 1129 } },
-    { { 266, 1068, 1811 }, { -1, -1, -1 }, { 1134, 1135, 1136 } },
-    { { 266, 1811, 1066 }, { -1, -1, -1 }, { 1134, 1136, 1137 } },
-    { { 266, 1066, 1812 }, { -1, -1, -1 }, { 1134, 1137, 1121 } },
-    { { 266, 1812, 1062 }, { -1, -1, -1 }, { 1134, 1121, 1120 } },
-    { { 266, 1062, 1842 }, { -1, -1, -1 }, { 1134, 1120, 1127 } },
-    { { 266, 1842, 1067 }, { -1, -1, -1 }, { 1134, 1127, 1138 } },
-    { { 266, 1067, 1840 }, { -1, -1, -1 }, { 1134, 1138, 1139 } },
-    { { 266, 1840, 1068 }, { -1, -1, -1 }, { 1134, 1139, 1135 } },
-    { { 267, 1070, 1843 }, { -1, -1, -1 }, { 1140, 1141, 1133 } },
-    { { 267, 1843, 1064 }, { -1, -1, -1 }, { 1140, 1133, 1132 } },
-    { { 267, 1064, 1812 }, { -1, -1, -1 }, { 1140, 1132, 1121 } },
-    { { 267, 1812, 1066 }, { -1, -1, -1 }, { 1140, 1121, 1137 } },
-    { { 267, 1066, 1811 }, { -1, -1, -1 }, { 1140, 1137, 1136 } },
-    { { 267, 1811, 1069 }, { -1, -1, -1 }, { 1140, 1136, 1142 } },
-    { { 267, 1069, 1841 }, { -1, -1, -1 }, { 1140, 1142, 1143 } },
-    { { 267, 1841, 1070 }, { -1, -1, -1 }, { 1140, 1143, 1141 } },
-    { { 268, 1073, 1810 }, { -1, -1, -1 }, { 1144, 1145, 1146 } },
-    { { 268, 1810, 1071 }, { -1, -1, -1 }, { 1144, 1146, 1147 } },
-    { { 268, 1071, 1811 }, { -1, -1, -1 }, { 1144, 1147, 1136 } },
-    { { 268, 1811, 1068 }, { -1, -1, -1 }, { 1144, 1136, 1135 } },
-    { { 268, 1068, 1840 }, { -1, -1, -1 }, { 1144, 1135, 1139 } },
-    { { 268, 1840, 1072 }, { -1, -1, -1 }, { 1144, 1139, 1148 } },
-    { { 268, 1072, 1844 }, { -1, -1, -1 }, { 1144, 1148, 1149 } },
-    { { 268, 1844, 1073 }, { -1, -1, -1 }, { 1144, 1149, 1145 } },
-    { { 269, 1075, 1841 }, { -1, -1, -1 }, { 1150, 1151, 1143 } },
-    { { 269, 1841, 1069 }, { -1, -1, -1 }, { 1150, 1143, 1142 } },
-    { { 269, 1069, 1811 }, { -1, -1, -1 }, { 1150, 1142, 1136 } },
-    { { 269, 1811, 1071 }, { -1, -1, -1 }, { 1150, 1136, 1147 } },
-    { { 269, 1071, 1810 }, { -1, -1, -1 }, { 1150, 1147, 1146 } },
-    { { 269, 1810, 1074 }, { -1, -1, -1 }, { 1150, 1146, 1152 } },
-    { { 269, 1074, 1845 }, { -1, -1, -1 }, { 1150, 1152, 1153 } },
-    { { 269, 1845, 1075 }, { -1, -1, -1 }, { 1150, 1153, 1151 } },
-    { { 270, 1077, 1593 }, { -1, -1, -1 }, { 1154, 1155, 260 } },
-    { { 270, 1593, 631 }, { -1, -1, -1 }, { 1154, 260, 259 } },
-    { { 270, 631, 1595 }, { -1, -1, -1 }, { 1154, 259, 266 } },
-    { { 270, 1595, 1076 }, { -1, -1, -1 }, { 1154, 266, 1156 } },
-    { { 270, 1076, 1810 }, { -1, -1, -1 }, { 1154, 1156, 1146 } },
-    { { 270, 1810, 1073 }, { -1, -1, -1 }, { 1154, 1146, 1145 } },
-    { { 270, 1073, 1844 }, { -1, -1, -1 }, { 1154, 1145, 1149 } },
-    { { 270, 1844, 1077 }, { -1, -1, -1 }, { 1154, 1149, 1155 } },
-    { { 271, 1074, 1810 }, { -1, -1, -1 }, { 1157, 1152, 1146 } },
-    { { 271, 1810, 1076 }, { -1, -1, -1 }, { 1157, 1146, 1156 } },
-    { { 271, 1076, 1595 }, { -1, -1, -1 }, { 1157, 1156, 266 } },
-    { { 271, 1595, 634 }, { -1, -1, -1 }, { 1157, 266, 272 } },
-    { { 271, 634, 1594 }, { -1, -1, -1 }, { 1157, 272, 271 } },
-    { { 271, 1594, 1078 }, { -1, -1, -1 }, { 1157, 271, 1158 } },
-    { { 271, 1078, 1845 }, { -1, -1, -1 }, { 1157, 1158, 1153 } },
-    { { 271, 1845, 1074 }, { -1, -1, -1 }, { 1157, 1153, 1152 } },
-    { { 272, 1080, 1591 }, { -1, -1, -1 }, { 1159, 1160, 275 } },
-    { { 272, 1591, 637 }, { -1, -1, -1 }, { 1159, 275, 274 } },
-    { { 272, 637, 1593 }, { -1, -1, -1 }, { 1159, 274, 260 } },
-    { { 272, 1593, 1077 }, { -1, -1, -1 }, { 1159, 260, 1155 } },
-    { { 272, 1077, 1844 }, { -1, -1, -1 }, { 1159, 1155, 1149 } },
-    { { 272, 1844, 1079 }, { -1, -1, -1 }, { 1159, 1149, 1161 } },
-    { { 272, 1079, 1838 }, { -1, -1, -1 }, { 1159, 1161, 1162 } },
-    { { 272, 1838, 1080 }, { -1, -1, -1 }, { 1159, 1162, 1160 } },
-    { { 273, 1082, 1845 }, { -1, -1, -1 }, { 1163, 1164, 1153 } },
-    { { 273, 1845, 1078 }, { -1, -1, -1 }, { 1163, 1153, 1158 } },
-    { { 273, 1078, 1594 }, { -1, -1, -1 }, { 1163, 1158, 271 } },
-    { { 273, 1594, 640 }, { -1, -1, -1 }, { 1163, 271, 284 } },
-    { { 273, 640, 1592 }, { -1, -1, -1 }, { 1163, 284, 283 } },
-    { { 273, 1592, 1081 }, { -1, -1, -1 }, { 1163, 283, 1165 } },
-    { { 273, 1081, 1839 }, { -1, -1, -1 }, { 1163, 1165, 1166 } },
-    { { 273, 1839, 1082 }, { -1, -1, -1 }, { 1163, 1166, 1164 } },
-    { { 274, 1084, 1589 }, { -1, -1, -1 }, { 1167, 1168, 287 } },
-    { { 274, 1589, 643 }, { -1, -1, -1 }, { 1167, 287, 286 } },
-    { { 274, 643, 1591 }, { -1, -1, -1 }, { 1167, 286, 275 } },
-    { { 274, 1591, 1080 }, { -1, -1, -1 }, { 1167, 275, 1160 } },
-    { { 274, 1080, 1838 }, { -1, -1, -1 }, { 1167, 1160, 1162 } },
-    { { 274, 1838, 1083 }, { -1, -1, -1 }, { 1167, 1162, 1169 } },
-    { { 274, 1083, 1834 }, { -1, -1, -1 }, { 1167, 1169, 1170 } },
-    { { 274, 1834, 1084 }, { -1, -1, -1 }, { 1167, 1170, 1168 } },
-    { { 275, 1086, 1839 }, { -1, -1, -1 }, { 1171, 1172, 1166 } },
-    { { 275, 1839, 1081 }, { -1, -1, -1 }, { 1171, 1166, 1165 } },
-    { { 275, 1081, 1592 }, { -1, -1, -1 }, { 1171, 1165, 283 } },
-    { { 275, 1592, 646 }, { -1, -1, -1 }, { 1171, 283, 296 } },
-    { { 275, 646, 1590 }, { -1, -1, -1 }, { 1171, 296, 295 } },
-    { { 275, 1590, 1085 }, { -1, -1, -1 }, { 1171, 295, 1173 } },
-    { { 275, 1085, 1835 }, { -1, -1, -1 }, { 1171, 1173, 1174 } },
-    { { 275, 1835, 1086 }, { -1, -1, -1 }, { 1171, 1174, 1172 } },
-    { { 276, 1088, 1587 }, { -1, -1, -1 }, { 1175, 1176, 299 } },
-    { { 276, 1587, 649 }, { -1, -1, -1 }, { 1175, 299, 298 } },
-    { { 276, 649, 1589 }, { -1, -1, -1 }, { 1175, 298, 287 } },
-    { { 276, 1589, 1084 }, { -1, -1, -1 }, { 1175, 287, 1168 } },
-    { { 276, 1084, 1834 }, { -1, -1, -1 }, { 1175, 1168, 1170 } },
-    { { 276, 1834, 1087 }, { -1, -1, -1 }, { 1175, 1170, 1177 } },
-    { { 276, 1087, 1836 }, { -1, -1, -1 }, { 1175, 1177, 1178 } },
-    { { 276, 1836, 1088 }, { -1, -1, -1 }, { 1175, 1178, 1176 } },
-    { { 277, 1090, 1835 }, { -1, -1, -1 }, { 1179, 1180, 1174 } },
-    { { 277, 1835, 1085 }, { -1, -1, -1 }, { 1179, 1174, 1173 } },
-    { { 277, 1085, 1590 }, { -1, -1, -1 }, { 1179, 1173, 295 } },
-    { { 277, 1590, 652 }, { -1, -1, -1 }, { 1179, 295, 308 } },
-    { { 277, 652, 1588 }, { -1, -1, -1 }, { 1179, 308, 307 } },
-    { { 277, 1588, 1089 }, { -1, -1, -1 }, { 1179, 307, 1181 } },
-    { { 277, 1089, 1837 }, { -1, -1, -1 }, { 1179, 1181, 1182 } },
-    { { 277, 1837, 1090 }, { -1, -1, -1 }, { 1179, 1182, 1180 } },
-    { { 278, 1087, 1834 }, { -1, -1, -1 }, { 1183, 1177, 1170 } },
-    { { 278, 1834, 1091 }, { -1, -1, -1 }, { 1183, 1170, 1184 } },
-    { { 278, 1091, 1840 }, { -1, -1, -1 }, { 1183, 1184, 1139 } },
-    { { 278, 1840, 1067 }, { -1, -1, -1 }, { 1183, 1139, 1138 } },
-    { { 278, 1067, 1842 }, { -1, -1, -1 }, { 1183, 1138, 1127 } },
-    { { 278, 1842, 1092 }, { -1, -1, -1 }, { 1183, 1127, 1185 } },
-    { { 278, 1092, 1836 }, { -1, -1, -1 }, { 1183, 1185, 1178 } },
-    { { 278, 1836, 1087 }, { -1, -1, -1 }, { 1183, 1178, 1177 } },
-    { { 279, 1094, 1843 }, { -1, -1, -1 }, { 1186, 1187, 1133 } },
-    { { 279, 1843, 1070 }, { -1, -1, -1 }, { 1186, 1133, 1141 } },
-    { { 279, 1070, 1841 }, { -1, -1, -1 }, { 1186, 1141, 1143 } },
-    { { 279, 1841, 1093 }, { -1, -1, -1 }, { 1186, 1143, 1188 } },
-    { { 279, 1093, 1835 }, { -1, -1, -1 }, { 1186, 1188, 1174 } },
-    { { 279, 1835, 1090 }, { -1, -1, -1 }, { 1186, 1174, 1180 } },
-    { { 279, 1090, 1837 }, { -1, -1, -1 }, { 1186, 1180, 1182 } },
-    { { 279, 1837, 1094 }, { -1, -1, -1 }, { 1186, 1182, 1187 } },
-    { { 280, 1091, 1834 }, { -1, -1, -1 }, { 1189, 1184, 1170 } },
-    { { 280, 1834, 1083 }, { -1, -1, -1 }, { 1189, 1170, 1169 } },
-    { { 280, 1083, 1838 }, { -1, -1, -1 }, { 1189, 1169, 1162 } },
-    { { 280, 1838, 1079 }, { -1, -1, -1 }, { 1189, 1162, 1161 } },
-    { { 280, 1079, 1844 }, { -1, -1, -1 }, { 1189, 1161, 1149 } },
-    { { 280, 1844, 1072 }, { -1, -1, -1 }, { 1189, 1149, 1148 } },
-    { { 280, 1072, 1840 }, { -1, -1, -1 }, { 1189, 1148, 1139 } },
-    { { 280, 1840, 1091 }, { -1, -1, -1 }, { 1189, 1139, 1184 } },
-    { { 281, 1075, 1845 }, { -1, -1, -1 }, { 1190, 1151, 1153 } },
-    { { 281, 1845, 1082 }, { -1, -1, -1 }, { 1190, 1153, 1164 } },
-    { { 281, 1082, 1839 }, { -1, -1, -1 }, { 1190, 1164, 1166 } },
-    { { 281, 1839, 1086 }, { -1, -1, -1 }, { 1190, 1166, 1172 } },
-    { { 281, 1086, 1835 }, { -1, -1, -1 }, { 1190, 1172, 1174 } },
-    { { 281, 1835, 1093 }, { -1, -1, -1 }, { 1190, 1174, 1188 } },
-    { { 281, 1093, 1841 }, { -1, -1, -1 }, { 1190, 1188, 1143 } },
-    { { 281, 1841, 1075 }, { -1, -1, -1 }, { 1190, 1143, 1151 } },
-    { { 282, 1096, 1830 }, { -1, -1, -1 }, { 1191, 1192, 1193 } },
-    { { 282, 1830, 1095 }, { -1, -1, -1 }, { 1191, 1193, 1194 } },
-    { { 282, 1095, 1836 }, { -1, -1, -1 }, { 1191, 1194, 1178 } },
-    { { 282, 1836, 1092 }, { -1, -1, -1 }, { 1191, 1178, 1185 } },
-    { { 282, 1092, 1842 }, { -1, -1, -1 }, { 1191, 1185, 1127 } },
-    { { 282, 1842, 1061 }, { -1, -1, -1 }, { 1191, 1127, 1126 } },
-    { { 282, 1061, 1832 }, { -1, -1, -1 }, { 1191, 1126, 1125 } },
-    { { 282, 1832, 1096 }, { -1, -1, -1 }, { 1191, 1125, 1192 } },
-    { { 283, 1065, 1843 }, { -1, -1, -1 }, { 1195, 1129, 1133 } },
-    { { 283, 1843, 1094 }, { -1, -1, -1 }, { 1195, 1133, 1187 } },
-    { { 283, 1094, 1837 }, { -1, -1, -1 }, { 1195, 1187, 1182 } },
-    { { 283, 1837, 1097 }, { -1, -1, -1 }, { 1195, 1182, 1196 } },
-    { { 283, 1097, 1831 }, { -1, -1, -1 }, { 1195, 1196, 1197 } },
-    { { 283, 1831, 1098 }, { -1, -1, -1 }, { 1195, 1197, 1198 } },
-    { { 283, 1098, 1833 }, { -1, -1, -1 }, { 1195, 1198, 1130 } },
-    { { 283, 1833, 1065 }, { -1, -1, -1 }, { 1195, 1130, 1129 } },
-    { { 284, 1099, 1585 }, { -1, -1, -1 }, { 1199, 1200, 311 } },
-    { { 284, 1585, 655 }, { -1, -1, -1 }, { 1199, 311, 310 } },
-    { { 284, 655, 1587 }, { -1, -1, -1 }, { 1199, 310, 299 } },
-    { { 284, 1587, 1088 }, { -1, -1, -1 }, { 1199, 299, 1176 } },
-    { { 284, 1088, 1836 }, { -1, -1, -1 }, { 1199, 1176, 1178 } },
-    { { 284, 1836, 1095 }, { -1, -1, -1 }, { 1199, 1178, 1194 } },
-    { { 284, 1095, 1830 }, { -1, -1, -1 }, { 1199, 1194, 1193 } },
-    { { 284, 1830, 1099 }, { -1, -1, -1 }, { 1199, 1193, 1200 } },
-    { { 285, 1097, 1837 }, { -1, -1, -1 }, { 1201, 1196, 1182 } },
-    { { 285, 1837, 1089 }, { -1, -1, -1 }, { 1201, 1182, 1181 } },
-    { { 285, 1089, 1588 }, { -1, -1, -1 }, { 1201, 1181, 307 } },
-    { { 285, 1588, 658 }, { -1, -1, -1 }, { 1201, 307, 320 } },
-    { { 285, 658, 1586 }, { -1, -1, -1 }, { 1201, 320, 319 } },
-    { { 285, 1586, 1100 }, { -1, -1, -1 }, { 1201, 319, 1202 } },
-    { { 285, 1100, 1831 }, { -1, -1, -1 }, { 1201, 1202, 1197 } },
-    { { 285, 1831, 1097 }, { -1, -1, -1 }, { 1201, 1197, 1196 } },
-    { { 286, 877, 1713 }, { -1, -1, -1 }, { 1203, 755, 748 } },
-    { { 286, 1713, 1101 }, { -1, -1, -1 }, { 1203, 748, 1204 } },
-    { { 286, 1101, 1846 }, { -1, -1, -1 }, { 1203, 1204, 1205 } },
-    { { 286, 1846, 1102 }, { -1, -1, -1 }, { 1203, 1205, 1206 } },
-    { { 286, 1102, 1848 }, { -1, -1, -1 }, { 1203, 1206, 1207 } },
-    { { 286, 1848, 1103 }, { -1, -1, -1 }, { 1203, 1207, 1208 } },
-    { { 286, 1103, 1719 }, { -1, -1, -1 }, { 1203, 1208, 756 } },
-    { { 286, 1719, 877 }, { -1, -1, -1 }, { 1203, 756, 755 } },
-    { { 287, 1106, 1849 }, { -1, -1, -1 }, { 1209, 1210, 1211 } },
-    { { 287, 1849, 1104 }, { -1, -1, -1 }, { 1209, 1211, 1212 } },
-    { { 287, 1104, 1847 }, { -1, -1, -1 }, { 1209, 1212, 1213 } },
-    { { 287, 1847, 1105 }, { -1, -1, -1 }, { 1209, 1213, 1214 } },
-    { { 287, 1105, 1714 }, { -1, -1, -1 }, { 1209, 1214, 752 } },
-    { { 287, 1714, 880 }, { -1, -1, -1 }, { 1209, 752, 761 } },
-    { { 287, 880, 1720 }, { -1, -1, -1 }, { 1209, 761, 760 } },
-    { { 287, 1720, 1106 }, { -1, -1, -1 }, { 1209, 760, 1210 } },
-    { { 288, 873, 1585 }, { -1, -1, -1 }, { 1215, 747, 311 } },
-    { { 288, 1585, 1099 }, { -1, -1, -1 }, { 1215, 311, 1200 } },
-    { { 288, 1099, 1830 }, { -1, -1, -1 }, { 1215, 1200, 1193 } },
-    { { 288, 1830, 1107 }, { -1, -1, -1 }, { 1215, 1193, 1216 } },
-    { { 288, 1107, 1846 }, { -1, -1, -1 }, { 1215, 1216, 1205 } },
-    { { 288, 1846, 1101 }, { -1, -1, -1 }, { 1215, 1205, 1204 } },
-    { { 288, 1101, 1713 }, { -1, -1, -1 }, { 1215, 1204, 748 } },
-    { { 288, 1713, 873 }, { -1, -1, -1 }, { 1215, 748, 747 } },
-    { { 289, 1105, 1847 }, { -1, -1, -1 }, { 1217, 1214, 1213 } },
-    { { 289, 1847, 1108 }, { -1, -1, -1 }, { 1217, 1213, 1218 } },
-    { { 289, 1108, 1831 }, { -1, -1, -1 }, { 1217, 1218, 1197 } },
-    { { 289, 1831, 1100 }, { -1, -1, -1 }, { 1217, 1197, 1202 } },
-    { { 289, 1100, 1586 }, { -1, -1, -1 }, { 1217, 1202, 319 } },
-    { { 289, 1586, 876 }, { -1, -1, -1 }, { 1217, 319, 753 } },
-    { { 289, 876, 1714 }, { -1, -1, -1 }, { 1217, 753, 752 } },
-    { { 289, 1714, 1105 }, { -1, -1, -1 }, { 1217, 752, 1214 } },
-    { { 290, 1110, 1583 }, { -1, -1, -1 }, { 1219, 1220, 323 } },
-    { { 290, 1583, 881 }, { -1, -1, -1 }, { 1219, 323, 763 } },
-    { { 290, 881, 1719 }, { -1, -1, -1 }, { 1219, 763, 756 } },
-    { { 290, 1719, 1103 }, { -1, -1, -1 }, { 1219, 756, 1208 } },
-    { { 290, 1103, 1848 }, { -1, -1, -1 }, { 1219, 1208, 1207 } },
-    { { 290, 1848, 1109 }, { -1, -1, -1 }, { 1219, 1207, 1221 } },
-    { { 290, 1109, 1850 }, { -1, -1, -1 }, { 1219, 1221, 1222 } },
-    { { 290, 1850, 1110 }, { -1, -1, -1 }, { 1219, 1222, 1220 } },
-    { { 291, 1112, 1849 }, { -1, -1, -1 }, { 1223, 1224, 1211 } },
-    { { 291, 1849, 1106 }, { -1, -1, -1 }, { 1223, 1211, 1210 } },
-    { { 291, 1106, 1720 }, { -1, -1, -1 }, { 1223, 1210, 760 } },
-    { { 291, 1720, 882 }, { -1, -1, -1 }, { 1223, 760, 765 } },
-    { { 291, 882, 1584 }, { -1, -1, -1 }, { 1223, 765, 336 } },
-    { { 291, 1584, 1111 }, { -1, -1, -1 }, { 1223, 336, 1225 } },
-    { { 291, 1111, 1851 }, { -1, -1, -1 }, { 1223, 1225, 1226 } },
-    { { 291, 1851, 1112 }, { -1, -1, -1 }, { 1223, 1226, 1224 } },
-    { { 292, 659, 1583 }, { -1, -1, -1 }, { 1227, 324, 323 } },
-    { { 292, 1583, 1110 }, { -1, -1, -1 }, { 1227, 323, 1220 } },
-    { { 292, 1110, 1850 }, { -1, -1, -1 }, { 1227, 1220, 1222 } },
-    { { 292, 1850, 1113 }, { -1, -1, -1 }, { 1227, 1222, 1228 } },
-    { { 292, 1113, 1804 }, { -1, -1, -1 }, { 1227, 1228, 1113 } },
-    { { 292, 1804, 1055 }, { -1, -1, -1 }, { 1227, 1113, 1112 } },
-    { { 292, 1055, 1596 }, { -1, -1, -1 }, { 1227, 1112, 325 } },
-    { { 292, 1596, 659 }, { -1, -1, -1 }, { 1227, 325, 324 } },
-    { { 293, 1057, 1805 }, { -1, -1, -1 }, { 1229, 1118, 1117 } },
-    { { 293, 1805, 1114 }, { -1, -1, -1 }, { 1229, 1117, 1230 } },
-    { { 293, 1114, 1851 }, { -1, -1, -1 }, { 1229, 1230, 1226 } },
-    { { 293, 1851, 1111 }, { -1, -1, -1 }, { 1229, 1226, 1225 } },
-    { { 293, 1111, 1584 }, { -1, -1, -1 }, { 1229, 1225, 336 } },
-    { { 293, 1584, 664 }, { -1, -1, -1 }, { 1229, 336, 335 } },
-    { { 293, 664, 1597 }, { -1, -1, -1 }, { 1229, 335, 334 } },
-    { { 293, 1597, 1057 }, { -1, -1, -1 }, { 1229, 334, 1118 } },
-    { { 294, 1118, 1581 }, { -1, -1, -1 }, { 1231, 1232, 1233 } },
-    { { 294, 1581, 1115 }, { -1, -1, -1 }, { 1231, 1233, 1234 } },
-    { { 294, 1115, 1828 }, { -1, -1, -1 }, { 1231, 1234, 1235 } },
-    { { 294, 1828, 1116 }, { -1, -1, -1 }, { 1231, 1235, 1236 } },
-    { { 294, 1116, 1856 }, { -1, -1, -1 }, { 1231, 1236, 1237 } },
-    { { 294, 1856, 1117 }, { -1, -1, -1 }, { 1231, 1237, 1238 } },
-    { { 294, 1117, 1808 }, { -1, -1, -1 }, { 1231, 1238, 1239 } },
-    { { 294, 1808, 1118 }, { -1, -1, -1 }, { 1231, 1239, 1232 } },
-    { { 295, 1121, 1857 }, { -1, -1, -1 }, { 1240, 1241, 1242 } },
-    { { 295, 1857, 1119 }, { -1, -1, -1 }, { 1240, 1242, 1243 } },
-    { { 295, 1119, 1829 }, { -1, -1, -1 }, { 1240, 1243, 1244 } },
-    { { 295, 1829, 1120 }, { -1, -1, -1 }, { 1240, 1244, 1245 } },
-    { { 295, 1120, 1581 }, { -1, -1, -1 }, { 1240, 1245, 1233 } },
-    { { 295, 1581, 1118 }, { -1, -1, -1 }, { 1240, 1233, 1232 } },
-    { { 295, 1118, 1808 }, { -1, -1, -1 }, { 1240, 1232, 1239 } },
-    { { 295, 1808, 1121 }, { -1, -1, -1 }, { 1240, 1239, 1241 } },
-    { { 296, 1124, 1808 }, { -1, -1, -1 }, { 1246, 1247, 1239 } },
-    { { 296, 1808, 1117 }, { -1, -1, -1 }, { 1246, 1239, 1238 } },
-    { { 296, 1117, 1856 }, { -1, -1, -1 }, { 1246, 1238, 1237 } },
-    { { 296, 1856, 1122 }, { -1, -1, -1 }, { 1246, 1237, 1248 } },
-    { { 296, 1122, 1854 }, { -1, -1, -1 }, { 1246, 1248, 1249 } },
-    { { 296, 1854, 1123 }, { -1, -1, -1 }, { 1246, 1249, 1250 } },
-    { { 296, 1123, 1582 }, { -1, -1, -1 }, { 1246, 1250, 1251 } },
-    { { 296, 1582, 1124 }, { -1, -1, -1 }, { 1246, 1251, 1247 } },
-    { { 297, 1126, 1855 }, { -1, -1, -1 }, { 1252, 1253, 1254 } },
-    { { 297, 1855, 1125 }, { -1, -1, -1 }, { 1252, 1254, 1255 } },
-    { { 297, 1125, 1857 }, { -1, -1, -1 }, { 1252, 1255, 1242 } },
-    { { 297, 1857, 1121 }, { -1, -1, -1 }, { 1252, 1242, 1241 } },
-    { { 297, 1121, 1808 }, { -1, -1, -1 }, { 1252, 1241, 1239 } },
-    { { 297, 1808, 1124 }, { -1, -1, -1 }, { 1252, 1239, 1247 } },
-    { { 297, 1124, 1582 }, { -1, -1, -1 }, { 1252, 1247, 1251 } },
-    { { 297, 1582, 1126 }, { -1, -1, -1 }, { 1252, 1251, 1253 } },
-    { { 298, 1129, 1582 }, { -1, -1, -1 }, { 1256, 1257, 1251 } },
-    { { 298, 1582, 1123 }, { -1, -1, -1 }, { 1256, 1251, 1250 } },
-    { { 298, 1123, 1854 }, { -1, -1, -1 }, { 1256, 1250, 1249 } },
-    { { 298, 1854, 1127 }, { -1, -1, -1 }, { 1256, 1249, 1258 } },
-    { { 298, 1127, 1852 }, { -1, -1, -1 }, { 1256, 1258, 1259 } },
-    { { 298, 1852, 1128 }, { -1, -1, -1 }, { 1256, 1259, 1260 } },
-    { { 298, 1128, 1809 }, { -1, -1, -1 }, { 1256, 1260, 1261 } },
-    { { 298, 1809, 1129 }, { -1, -1, -1 }, { 1256, 1261, 1257 } },
-    { { 299, 1131, 1853 }, { -1, -1, -1 }, { 1262, 1263, 1264 } },
-    { { 299, 1853, 1130 }, { -1, -1, -1 }, { 1262, 1264, 1265 } },
-    { { 299, 1130, 1855 }, { -1, -1, -1 }, { 1262, 1265, 1254 } },
-    { { 299, 1855, 1126 }, { -1, -1, -1 }, { 1262, 1254, 1253 } },
-    { { 299, 1126, 1582 }, { -1, -1, -1 }, { 1262, 1253, 1251 } },
-    { { 299, 1582, 1129 }, { -1, -1, -1 }, { 1262, 1251, 1257 } },
-    { { 299, 1129, 1809 }, { -1, -1, -1 }, { 1262, 1257, 1261 } },
-    { { 299, 1809, 1131 }, { -1, -1, -1 }, { 1262, 1261, 1263 } },
-    { { 300, 1133, 1809 }, { -1, -1, -1 }, { 1266, 1267, 1261 } },
-    { { 300, 1809, 1128 }, { -1, -1, -1 }, { 1266, 1261, 1260 } },
-    { { 300, 1128, 1852 }, { -1, -1, -1 }, { 1266, 1260, 1259 } },
-    { { 300, 1852, 1132 }, { -1, -1, -1 }, { 1266, 1259, 1268 } },
-    { { 300, 1132, 1832 }, { -1, -1, -1 }, { 1266, 1268, 1125 } },
-    { { 300, 1832, 1060 }, { -1, -1, -1 }, { 1266, 1125, 1124 } },
-    { { 300, 1060, 1813 }, { -1, -1, -1 }, { 1266, 1124, 1123 } },
-    { { 300, 1813, 1133 }, { -1, -1, -1 }, { 1266, 1123, 1267 } },
-    { { 301, 1063, 1833 }, { -1, -1, -1 }, { 1269, 1131, 1130 } },
-    { { 301, 1833, 1134 }, { -1, -1, -1 }, { 1269, 1130, 1270 } },
-    { { 301, 1134, 1853 }, { -1, -1, -1 }, { 1269, 1270, 1264 } },
-    { { 301, 1853, 1131 }, { -1, -1, -1 }, { 1269, 1264, 1263 } },
-    { { 301, 1131, 1809 }, { -1, -1, -1 }, { 1269, 1263, 1261 } },
-    { { 301, 1809, 1133 }, { -1, -1, -1 }, { 1269, 1261, 1267 } },
-    { { 301, 1133, 1813 }, { -1, -1, -1 }, { 1269, 1267, 1123 } },
-    { { 301, 1813, 1063 }, { -1, -1, -1 }, { 1269, 1123, 1131 } },
-    { { 302, 1107, 1830 }, { -1, -1, -1 }, { 1271, 1216, 1193 } },
-    { { 302, 1830, 1096 }, { -1, -1, -1 }, { 1271, 1193, 1192 } },
-    { { 302, 1096, 1832 }, { -1, -1, -1 }, { 1271, 1192, 1125 } },
-    { { 302, 1832, 1132 }, { -1, -1, -1 }, { 1271, 1125, 1268 } },
-    { { 302, 1132, 1852 }, { -1, -1, -1 }, { 1271, 1268, 1259 } },
-    { { 302, 1852, 1135 }, { -1, -1, -1 }, { 1271, 1259, 1272 } },
-    { { 302, 1135, 1846 }, { -1, -1, -1 }, { 1271, 1272, 1205 } },
-    { { 302, 1846, 1107 }, { -1, -1, -1 }, { 1271, 1205, 1216 } },
-    { { 303, 1136, 1853 }, { -1, -1, -1 }, { 1273, 1274, 1264 } },
-    { { 303, 1853, 1134 }, { -1, -1, -1 }, { 1273, 1264, 1270 } },
-    { { 303, 1134, 1833 }, { -1, -1, -1 }, { 1273, 1270, 1130 } },
-    { { 303, 1833, 1098 }, { -1, -1, -1 }, { 1273, 1130, 1198 } },
-    { { 303, 1098, 1831 }, { -1, -1, -1 }, { 1273, 1198, 1197 } },
-    { { 303, 1831, 1108 }, { -1, -1, -1 }, { 1273, 1197, 1218 } },
-    { { 303, 1108, 1847 }, { -1, -1, -1 }, { 1273, 1218, 1213 } },
-    { { 303, 1847, 1136 }, { -1, -1, -1 }, { 1273, 1213, 1274 } },
-    { { 304, 1139, 1800 }, { -1, -1, -1 }, { 1275, 1276, 1097 } },
-    { { 304, 1800, 1052 }, { -1, -1, -1 }, { 1275, 1097, 1106 } },
-    { { 304, 1052, 1802 }, { -1, -1, -1 }, { 1275, 1106, 1105 } },
-    { { 304, 1802, 1137 }, { -1, -1, -1 }, { 1275, 1105, 1277 } },
-    { { 304, 1137, 1822 }, { -1, -1, -1 }, { 1275, 1277, 1278 } },
-    { { 304, 1822, 1138 }, { -1, -1, -1 }, { 1275, 1278, 1279 } },
-    { { 304, 1138, 1814 }, { -1, -1, -1 }, { 1275, 1279, 1280 } },
-    { { 304, 1814, 1139 }, { -1, -1, -1 }, { 1275, 1280, 1276 } },
-    { { 305, 1142, 1823 }, { -1, -1, -1 }, { 1281, 1282, 1283 } },
-    { { 305, 1823, 1140 }, { -1, -1, -1 }, { 1281, 1283, 1284 } },
-    { { 305, 1140, 1803 }, { -1, -1, -1 }, { 1281, 1284, 1109 } },
-    { { 305, 1803, 1054 }, { -1, -1, -1 }, { 1281, 1109, 1108 } },
-    { { 305, 1054, 1801 }, { -1, -1, -1 }, { 1281, 1108, 1101 } },
-    { { 305, 1801, 1141 }, { -1, -1, -1 }, { 1281, 1101, 1285 } },
-    { { 305, 1141, 1815 }, { -1, -1, -1 }, { 1281, 1285, 1286 } },
-    { { 305, 1815, 1142 }, { -1, -1, -1 }, { 1281, 1286, 1282 } },
-    { { 306, 1145, 1580 }, { -1, -1, -1 }, { 1287, 1288, 1289 } },
-    { { 306, 1580, 1143 }, { -1, -1, -1 }, { 1287, 1289, 1290 } },
-    { { 306, 1143, 1820 }, { -1, -1, -1 }, { 1287, 1290, 1291 } },
-    { { 306, 1820, 1144 }, { -1, -1, -1 }, { 1287, 1291, 1292 } },
-    { { 306, 1144, 1828 }, { -1, -1, -1 }, { 1287, 1292, 1235 } },
-    { { 306, 1828, 1115 }, { -1, -1, -1 }, { 1287, 1235, 1234 } },
-    { { 306, 1115, 1581 }, { -1, -1, -1 }, { 1287, 1234, 1233 } },
-    { { 306, 1581, 1145 }, { -1, -1, -1 }, { 1287, 1233, 1288 } },
-    { { 307, 1120, 1829 }, { -1, -1, -1 }, { 1293, 1245, 1244 } },
-    { { 307, 1829, 1146 }, { -1, -1, -1 }, { 1293, 1244, 1294 } },
-    { { 307, 1146, 1821 }, { -1, -1, -1 }, { 1293, 1294, 1295 } },
-    { { 307, 1821, 1147 }, { -1, -1, -1 }, { 1293, 1295, 1296 } },
-    { { 307, 1147, 1580 }, { -1, -1, -1 }, { 1293, 1296, 1289 } },
-    { { 307, 1580, 1145 }, { -1, -1, -1 }, { 1293, 1289, 1288 } },
-    { { 307, 1145, 1581 }, { -1, -1, -1 }, { 1293, 1288, 1233 } },
-    { { 307, 1581, 1120 }, { -1, -1, -1 }, { 1293, 1233, 1245 } },
-    { { 308, 1151, 1806 }, { -1, -1, -1 }, { 1297, 1298, 1299 } },
-    { { 308, 1806, 1148 }, { -1, -1, -1 }, { 1297, 1299, 1300 } },
-    { { 308, 1148, 1862 }, { -1, -1, -1 }, { 1297, 1300, 1301 } },
-    { { 308, 1862, 1149 }, { -1, -1, -1 }, { 1297, 1301, 1302 } },
-    { { 308, 1149, 1860 }, { -1, -1, -1 }, { 1297, 1302, 1303 } },
-    { { 308, 1860, 1150 }, { -1, -1, -1 }, { 1297, 1303, 1304 } },
-    { { 308, 1150, 1807 }, { -1, -1, -1 }, { 1297, 1304, 1305 } },
-    { { 308, 1807, 1151 }, { -1, -1, -1 }, { 1297, 1305, 1298 } },
-    { { 309, 1154, 1861 }, { -1, -1, -1 }, { 1306, 1307, 1308 } },
-    { { 309, 1861, 1152 }, { -1, -1, -1 }, { 1306, 1308, 1309 } },
-    { { 309, 1152, 1863 }, { -1, -1, -1 }, { 1306, 1309, 1310 } },
-    { { 309, 1863, 1153 }, { -1, -1, -1 }, { 1306, 1310, 1311 } },
-    { { 309, 1153, 1806 }, { -1, -1, -1 }, { 1306, 1311, 1299 } },
-    { { 309, 1806, 1151 }, { -1, -1, -1 }, { 1306, 1299, 1298 } },
-    { { 309, 1151, 1807 }, { -1, -1, -1 }, { 1306, 1298, 1305 } },
-    { { 309, 1807, 1154 }, { -1, -1, -1 }, { 1306, 1305, 1307 } },
-    { { 310, 1157, 1807 }, { -1, -1, -1 }, { 1312, 1313, 1305 } },
-    { { 310, 1807, 1150 }, { -1, -1, -1 }, { 1312, 1305, 1304 } },
-    { { 310, 1150, 1860 }, { -1, -1, -1 }, { 1312, 1304, 1303 } },
-    { { 310, 1860, 1155 }, { -1, -1, -1 }, { 1312, 1303, 1314 } },
-    { { 310, 1155, 1858 }, { -1, -1, -1 }, { 1312, 1314, 1315 } },
-    { { 310, 1858, 1156 }, { -1, -1, -1 }, { 1312, 1315, 1316 } },
-    { { 310, 1156, 1579 }, { -1, -1, -1 }, { 1312, 1316, 1317 } },
-    { { 310, 1579, 1157 }, { -1, -1, -1 }, { 1312, 1317, 1313 } },
-    { { 311, 1159, 1859 }, { -1, -1, -1 }, { 1318, 1319, 1320 } },
-    { { 311, 1859, 1158 }, { -1, -1, -1 }, { 1318, 1320, 1321 } },
-    { { 311, 1158, 1861 }, { -1, -1, -1 }, { 1318, 1321, 1308 } },
-    { { 311, 1861, 1154 }, { -1, -1, -1 }, { 1318, 1308, 1307 } },
-    { { 311, 1154, 1807 }, { -1, -1, -1 }, { 1318, 1307, 1305 } },
-    { { 311, 1807, 1157 }, { -1, -1, -1 }, { 1318, 1305, 1313 } },
-    { { 311, 1157, 1579 }, { -1, -1, -1 }, { 1318, 1313, 1317 } },
-    { { 311, 1579, 1159 }, { -1, -1, -1 }, { 1318, 1317, 1319 } },
-    { { 312, 1161, 1579 }, { -1, -1, -1 }, { 1322, 1323, 1317 } },
-    { { 312, 1579, 1156 }, { -1, -1, -1 }, { 1322, 1317, 1316 } },
-    { { 312, 1156, 1858 }, { -1, -1, -1 }, { 1322, 1316, 1315 } },
-    { { 312, 1858, 1160 }, { -1, -1, -1 }, { 1322, 1315, 1324 } },
-    { { 312, 1160, 1820 }, { -1, -1, -1 }, { 1322, 1324, 1291 } },
-    { { 312, 1820, 1143 }, { -1, -1, -1 }, { 1322, 1291, 1290 } },
-    { { 312, 1143, 1580 }, { -1, -1, -1 }, { 1322, 1290, 1289 } },
-    { { 312, 1580, 1161 }, { -1, -1, -1 }, { 1322, 1289, 1323 } },
-    { { 313, 1147, 1821 }, { -1, -1, -1 }, { 1325, 1296, 1295 } },
-    { { 313, 1821, 1162 }, { -1, -1, -1 }, { 1325, 1295, 1326 } },
-    { { 313, 1162, 1859 }, { -1, -1, -1 }, { 1325, 1326, 1320 } },
-    { { 313, 1859, 1159 }, { -1, -1, -1 }, { 1325, 1320, 1319 } },
-    { { 313, 1159, 1579 }, { -1, -1, -1 }, { 1325, 1319, 1317 } },
-    { { 313, 1579, 1161 }, { -1, -1, -1 }, { 1325, 1317, 1323 } },
-    { { 313, 1161, 1580 }, { -1, -1, -1 }, { 1325, 1323, 1289 } },
-    { { 313, 1580, 1147 }, { -1, -1, -1 }, { 1325, 1289, 1296 } },
-    { { 314, 1165, 1796 }, { -1, -1, -1 }, { 1327, 1328, 1081 } },
-    { { 314, 1796, 1044 }, { -1, -1, -1 }, { 1327, 1081, 1090 } },
-    { { 314, 1044, 1798 }, { -1, -1, -1 }, { 1327, 1090, 1089 } },
-    { { 314, 1798, 1163 }, { -1, -1, -1 }, { 1327, 1089, 1329 } },
-    { { 314, 1163, 1866 }, { -1, -1, -1 }, { 1327, 1329, 1330 } },
-    { { 314, 1866, 1164 }, { -1, -1, -1 }, { 1327, 1330, 1331 } },
-    { { 314, 1164, 1868 }, { -1, -1, -1 }, { 1327, 1331, 1332 } },
-    { { 314, 1868, 1165 }, { -1, -1, -1 }, { 1327, 1332, 1328 } },
-    { { 315, 1168, 1867 }, { -1, -1, -1 }, { 1333, 1334, 1335 } },
-    { { 315, 1867, 1166 }, { -1, -1, -1 }, { 1333, 1335, 1336 } },
-    { { 315, 1166, 1799 }, { -1, -1, -1 }, { 1333, 1336, 1093 } },
-    { { 315, 1799, 1046 }, { -1, -1, -1 }, { 1333, 1093, 1092 } },
-    { { 315, 1046, 1797 }, { -1, -1, -1 }, { 1333, 1092, 1085 } },
-    { { 315, 1797, 1167 }, { -1, -1, -1 }, { 1333, 1085, 1337 } },
-    { { 315, 1167, 1869 }, { -1, -1, -1 }, { 1333, 1337, 1338 } },
-    { { 315, 1869, 1168 }, { -1, -1, -1 }, { 1333, 1338, 1334 } },
-    { { 316, 1171, 1868 }, { -1, -1, -1 }, { 1339, 1340, 1332 } },
-    { { 316, 1868, 1164 }, { -1, -1, -1 }, { 1339, 1332, 1331 } },
-    { { 316, 1164, 1866 }, { -1, -1, -1 }, { 1339, 1331, 1330 } },
-    { { 316, 1866, 1169 }, { -1, -1, -1 }, { 1339, 1330, 1341 } },
-    { { 316, 1169, 1872 }, { -1, -1, -1 }, { 1339, 1341, 1342 } },
-    { { 316, 1872, 1170 }, { -1, -1, -1 }, { 1339, 1342, 1343 } },
-    { { 316, 1170, 1870 }, { -1, -1, -1 }, { 1339, 1343, 1344 } },
-    { { 316, 1870, 1171 }, { -1, -1, -1 }, { 1339, 1344, 1340 } },
-    { { 317, 1174, 1873 }, { -1, -1, -1 }, { 1345, 1346, 1347 } },
-    { { 317, 1873, 1172 }, { -1, -1, -1 }, { 1345, 1347, 1348 } },
-    { { 317, 1172, 1867 }, { -1, -1, -1 }, { 1345, 1348, 1335 } },
-    { { 317, 1867, 1168 }, { -1, -1, -1 }, { 1345, 1335, 1334 } },
-    { { 317, 1168, 1869 }, { -1, -1, -1 }, { 1345, 1334, 1338 } },
-    { { 317, 1869, 1173 }, { -1, -1, -1 }, { 1345, 1338, 1349 } },
-    { { 317, 1173, 1871 }, { -1, -1, -1 }, { 1345, 1349, 1350 } },
-    { { 317, 1871, 1174 }, { -1, -1, -1 }, { 1345, 1350, 1346 } },
-    { { 318, 1177, 1870 }, { -1, -1, -1 }, { 1351, 1352, 1344 } },
-    { { 318, 1870, 1170 }, { -1, -1, -1 }, { 1351, 1344, 1343 } },
-    { { 318, 1170, 1872 }, { -1, -1, -1 }, { 1351, 1343, 1342 } },
-    { { 318, 1872, 1175 }, { -1, -1, -1 }, { 1351, 1342, 1353 } },
-    { { 318, 1175, 1874 }, { -1, -1, -1 }, { 1351, 1353, 1354 } },
-    { { 318, 1874, 1176 }, { -1, -1, -1 }, { 1351, 1354, 1355 } },
-    { { 318, 1176, 1876 }, { -1, -1, -1 }, { 1351, 1355, 1356 } },
-    { { 318, 1876, 1177 }, { -1, -1, -1 }, { 1351, 1356, 1352 } },
-    { { 319, 1180, 1875 }, { -1, -1, -1 }, { 1357, 1358, 1359 } },
-    { { 319, 1875, 1178 }, { -1, -1, -1 }, { 1357, 1359, 1360 } },
-    { { 319, 1178, 1873 }, { -1, -1, -1 }, { 1357, 1360, 1347 } },
-    { { 319, 1873, 1174 }, { -1, -1, -1 }, { 1357, 1347, 1346 } },
-    { { 319, 1174, 1871 }, { -1, -1, -1 }, { 1357, 1346, 1350 } },
-    { { 319, 1871, 1179 }, { -1, -1, -1 }, { 1357, 1350, 1361 } },
-    { { 319, 1179, 1877 }, { -1, -1, -1 }, { 1357, 1361, 1362 } },
-    { { 319, 1877, 1180 }, { -1, -1, -1 }, { 1357, 1362, 1358 } },
-    { { 320, 1183, 1876 }, { -1, -1, -1 }, { 1363, 1364, 1356 } },
-    { { 320, 1876, 1176 }, { -1, -1, -1 }, { 1363, 1356, 1355 } },
-    { { 320, 1176, 1874 }, { -1, -1, -1 }, { 1363, 1355, 1354 } },
-    { { 320, 1874, 1181 }, { -1, -1, -1 }, { 1363, 1354, 1365 } },
-    { { 320, 1181, 1880 }, { -1, -1, -1 }, { 1363, 1365, 1366 } },
-    { { 320, 1880, 1182 }, { -1, -1, -1 }, { 1363, 1366, 1367 } },
-    { { 320, 1182, 1878 }, { -1, -1, -1 }, { 1363, 1367, 1368 } },
-    { { 320, 1878, 1183 }, { -1, -1, -1 }, { 1363, 1368, 1364 } },
-    { { 321, 1186, 1881 }, { -1, -1, -1 }, { 1369, 1370, 1371 } },
-    { { 321, 1881, 1184 }, { -1, -1, -1 }, { 1369, 1371, 1372 } },
-    { { 321, 1184, 1875 }, { -1, -1, -1 }, { 1369, 1372, 1359 } },
-    { { 321, 1875, 1180 }, { -1, -1, -1 }, { 1369, 1359, 1358 } },
-    { { 321, 1180, 1877 }, { -1, -1, -1 }, { 1369, 1358, 1362 } },
-    { { 321, 1877, 1185 }, { -1, -1, -1 }, { 1369, 1362, 1373 } },
-    { { 321, 1185, 1879 }, { -1, -1, -1 }, { 1369, 1373, 1374 } },
-    { { 321, 1879, 1186 }, { -1, -1, -1 }, { 1369, 1374, 1370 } },
-    { { 322, 1189, 1818 }, { -1, -1, -1 }, { 1375, 1376, 1377 } },
-    { { 322, 1818, 1187 }, { -1, -1, -1 }, { 1375, 1377, 1378 } },
-    { { 322, 1187, 1882 }, { -1, -1, -1 }, { 1375, 1378, 1379 } },
-    { { 322, 1882, 1188 }, { -1, -1, -1 }, { 1375, 1379, 1380 } },
-    { { 322, 1188, 1878 }, { -1, -1, -1 }, { 1375, 1380, 1368 } },
-    { { 322, 1878, 1182 }, { -1, -1, -1 }, { 1375, 1368, 1367 } },
-    { { 322, 1182, 1880 }, { -1, -1, -1 }, { 1375, 1367, 1366 } },
-    { { 322, 1880, 1189 }, { -1, -1, -1 }, { 1375, 1366, 1376 } },
-    { { 323, 1186, 1879 }, { -1, -1, -1 }, { 1381, 1370, 1374 } },
-    { { 323, 1879, 1190 }, { -1, -1, -1 }, { 1381, 1374, 1382 } },
-    { { 323, 1190, 1883 }, { -1, -1, -1 }, { 1381, 1382, 1383 } },
-    { { 323, 1883, 1191 }, { -1, -1, -1 }, { 1381, 1383, 1384 } },
-    { { 323, 1191, 1819 }, { -1, -1, -1 }, { 1381, 1384, 1385 } },
-    { { 323, 1819, 1192 }, { -1, -1, -1 }, { 1381, 1385, 1386 } },
-    { { 323, 1192, 1881 }, { -1, -1, -1 }, { 1381, 1386, 1371 } },
-    { { 323, 1881, 1186 }, { -1, -1, -1 }, { 1381, 1371, 1370 } },
-    { { 324, 1194, 1820 }, { -1, -1, -1 }, { 1387, 1388, 1291 } },
-    { { 324, 1820, 1160 }, { -1, -1, -1 }, { 1387, 1291, 1324 } },
-    { { 324, 1160, 1858 }, { -1, -1, -1 }, { 1387, 1324, 1315 } },
-    { { 324, 1858, 1193 }, { -1, -1, -1 }, { 1387, 1315, 1389 } },
-    { { 324, 1193, 1878 }, { -1, -1, -1 }, { 1387, 1389, 1368 } },
-    { { 324, 1878, 1188 }, { -1, -1, -1 }, { 1387, 1368, 1380 } },
-    { { 324, 1188, 1882 }, { -1, -1, -1 }, { 1387, 1380, 1379 } },
-    { { 324, 1882, 1194 }, { -1, -1, -1 }, { 1387, 1379, 1388 } },
-    { { 325, 1190, 1879 }, { -1, -1, -1 }, { 1390, 1382, 1374 } },
-    { { 325, 1879, 1195 }, { -1, -1, -1 }, { 1390, 1374, 1391 } },
-    { { 325, 1195, 1859 }, { -1, -1, -1 }, { 1390, 1391, 1320 } },
-    { { 325, 1859, 1162 }, { -1, -1, -1 }, { 1390, 1320, 1326 } },
-    { { 325, 1162, 1821 }, { -1, -1, -1 }, { 1390, 1326, 1295 } },
-    { { 325, 1821, 1196 }, { -1, -1, -1 }, { 1390, 1295, 1392 } },
-    { { 325, 1196, 1883 }, { -1, -1, -1 }, { 1390, 1392, 1383 } },
-    { { 325, 1883, 1190 }, { -1, -1, -1 }, { 1390, 1383, 1382 } },
-    { { 326, 1193, 1858 }, { -1, -1, -1 }, { 1393, 1389, 1315 } },
-    { { 326, 1858, 1155 }, { -1, -1, -1 }, { 1393, 1315, 1314 } },
-    { { 326, 1155, 1860 }, { -1, -1, -1 }, { 1393, 1314, 1303 } },
-    { { 326, 1860, 1197 }, { -1, -1, -1 }, { 1393, 1303, 1394 } },
-    { { 326, 1197, 1876 }, { -1, -1, -1 }, { 1393, 1394, 1356 } },
-    { { 326, 1876, 1183 }, { -1, -1, -1 }, { 1393, 1356, 1364 } },
-    { { 326, 1183, 1878 }, { -1, -1, -1 }, { 1393, 1364, 1368 } },
-    { { 326, 1878, 1193 }, { -1, -1, -1 }, { 1393, 1368, 1389 } },
-    { { 327, 1185, 1877 }, { -1, -1, -1 }, { 1395, 1373, 1362 } },
-    { { 327, 1877, 1198 }, { -1, -1, -1 }, { 1395, 1362, 1396 } },
-    { { 327, 1198, 1861 }, { -1, -1, -1 }, { 1395, 1396, 1308 } },
-    { { 327, 1861, 1158 }, { -1, -1, -1 }, { 1395, 1308, 1321 } },
-    { { 327, 1158, 1859 }, { -1, -1, -1 }, { 1395, 1321, 1320 } },
-    { { 327, 1859, 1195 }, { -1, -1, -1 }, { 1395, 1320, 1391 } },
-    { { 327, 1195, 1879 }, { -1, -1, -1 }, { 1395, 1391, 1374 } },
-    { { 327, 1879, 1185 }, { -1, -1, -1 }, { 1395, 1374, 1373 } },
-    { { 328, 1197, 1860 }, { -1, -1, -1 }, { 1397, 1394, 1303 } },
-    { { 328, 1860, 1149 }, { -1, -1, -1 }, { 1397, 1303, 1302 } },
-    { { 328, 1149, 1862 }, { -1, -1, -1 }, { 1397, 1302, 1301 } },
-    { { 328, 1862, 1199 }, { -1, -1, -1 }, { 1397, 1301, 1398 } },
-    { { 328, 1199, 1870 }, { -1, -1, -1 }, { 1397, 1398, 1344 } },
-    { { 328, 1870, 1177 }, { -1, -1, -1 }, { 1397, 1344, 1352 } },
-    { { 328, 1177, 1876 }, { -1, -1, -1 }, { 1397, 1352, 1356 } },
-    { { 328, 1876, 1197 }, { -1, -1, -1 }, { 1397, 1356, 1394 } },
-    { { 329, 1179, 1871 }, { -1, -1, -1 }, { 1399, 1361, 1350 } },
-    { { 329, 1871, 1200 }, { -1, -1, -1 }, { 1399, 1350, 1400 } },
-    { { 329, 1200, 1863 }, { -1, -1, -1 }, { 1399, 1400, 1310 } },
-    { { 329, 1863, 1152 }, { -1, -1, -1 }, { 1399, 1310, 1309 } },
-    { { 329, 1152, 1861 }, { -1, -1, -1 }, { 1399, 1309, 1308 } },
-    { { 329, 1861, 1198 }, { -1, -1, -1 }, { 1399, 1308, 1396 } },
-    { { 329, 1198, 1877 }, { -1, -1, -1 }, { 1399, 1396, 1362 } },
-    { { 329, 1877, 1179 }, { -1, -1, -1 }, { 1399, 1362, 1361 } },
-    { { 330, 1199, 1862 }, { -1, -1, -1 }, { 1401, 1398, 1301 } },
-    { { 330, 1862, 1201 }, { -1, -1, -1 }, { 1401, 1301, 1402 } },
-    { { 330, 1201, 1864 }, { -1, -1, -1 }, { 1401, 1402, 1403 } },
-    { { 330, 1864, 1202 }, { -1, -1, -1 }, { 1401, 1403, 1404 } },
-    { { 330, 1202, 1868 }, { -1, -1, -1 }, { 1401, 1404, 1332 } },
-    { { 330, 1868, 1171 }, { -1, -1, -1 }, { 1401, 1332, 1340 } },
-    { { 330, 1171, 1870 }, { -1, -1, -1 }, { 1401, 1340, 1344 } },
-    { { 330, 1870, 1199 }, { -1, -1, -1 }, { 1401, 1344, 1398 } },
-    { { 331, 1173, 1869 }, { -1, -1, -1 }, { 1405, 1349, 1338 } },
-    { { 331, 1869, 1203 }, { -1, -1, -1 }, { 1405, 1338, 1406 } },
-    { { 331, 1203, 1865 }, { -1, -1, -1 }, { 1405, 1406, 1407 } },
-    { { 331, 1865, 1204 }, { -1, -1, -1 }, { 1405, 1407, 1408 } },
-    { { 331, 1204, 1863 }, { -1, -1, -1 }, { 1405, 1408, 1310 } },
-    { { 331, 1863, 1200 }, { -1, -1, -1 }, { 1405, 1310, 1400 } },
-    { { 331, 1200, 1871 }, { -1, -1, -1 }, { 1405, 1400, 1350 } },
-    { { 331, 1871, 1173 }, { -1, -1, -1 }, { 1405, 1350, 1349 } },
-    { { 332, 1205, 1794 }, { -1, -1, -1 }, { 1409, 1410, 1073 } },
-    { { 332, 1794, 1040 }, { -1, -1, -1 }, { 1409, 1073, 1082 } },
-    { { 332, 1040, 1796 }, { -1, -1, -1 }, { 1409, 1082, 1081 } },
-    { { 332, 1796, 1165 }, { -1, -1, -1 }, { 1409, 1081, 1328 } },
-    { { 332, 1165, 1868 }, { -1, -1, -1 }, { 1409, 1328, 1332 } },
-    { { 332, 1868, 1202 }, { -1, -1, -1 }, { 1409, 1332, 1404 } },
-    { { 332, 1202, 1864 }, { -1, -1, -1 }, { 1409, 1404, 1403 } },
-    { { 332, 1864, 1205 }, { -1, -1, -1 }, { 1409, 1403, 1410 } },
-    { { 333, 1203, 1869 }, { -1, -1, -1 }, { 1411, 1406, 1338 } },
-    { { 333, 1869, 1167 }, { -1, -1, -1 }, { 1411, 1338, 1337 } },
-    { { 333, 1167, 1797 }, { -1, -1, -1 }, { 1411, 1337, 1085 } },
-    { { 333, 1797, 1042 }, { -1, -1, -1 }, { 1411, 1085, 1084 } },
-    { { 333, 1042, 1795 }, { -1, -1, -1 }, { 1411, 1084, 1077 } },
-    { { 333, 1795, 1206 }, { -1, -1, -1 }, { 1411, 1077, 1412 } },
-    { { 333, 1206, 1865 }, { -1, -1, -1 }, { 1411, 1412, 1407 } },
-    { { 333, 1865, 1203 }, { -1, -1, -1 }, { 1411, 1407, 1406 } },
-    { { 334, 1208, 1578 }, { -1, -1, -1 }, { 1413, 1414, 1415 } },
-    { { 334, 1578, 1207 }, { -1, -1, -1 }, { 1413, 1415, 1416 } },
-    { { 334, 1207, 1864 }, { -1, -1, -1 }, { 1413, 1416, 1403 } },
-    { { 334, 1864, 1201 }, { -1, -1, -1 }, { 1413, 1403, 1402 } },
-    { { 334, 1201, 1862 }, { -1, -1, -1 }, { 1413, 1402, 1301 } },
-    { { 334, 1862, 1148 }, { -1, -1, -1 }, { 1413, 1301, 1300 } },
-    { { 334, 1148, 1806 }, { -1, -1, -1 }, { 1413, 1300, 1299 } },
-    { { 334, 1806, 1208 }, { -1, -1, -1 }, { 1413, 1299, 1414 } },
-    { { 335, 1153, 1863 }, { -1, -1, -1 }, { 1417, 1311, 1310 } },
-    { { 335, 1863, 1204 }, { -1, -1, -1 }, { 1417, 1310, 1408 } },
-    { { 335, 1204, 1865 }, { -1, -1, -1 }, { 1417, 1408, 1407 } },
-    { { 335, 1865, 1209 }, { -1, -1, -1 }, { 1417, 1407, 1418 } },
-    { { 335, 1209, 1578 }, { -1, -1, -1 }, { 1417, 1418, 1415 } },
-    { { 335, 1578, 1208 }, { -1, -1, -1 }, { 1417, 1415, 1414 } },
-    { { 335, 1208, 1806 }, { -1, -1, -1 }, { 1417, 1414, 1299 } },
-    { { 335, 1806, 1153 }, { -1, -1, -1 }, { 1417, 1299, 1311 } },
-    { { 336, 1210, 1788 }, { -1, -1, -1 }, { 1419, 1420, 1048 } },
-    { { 336, 1788, 1028 }, { -1, -1, -1 }, { 1419, 1048, 1058 } },
-    { { 336, 1028, 1790 }, { -1, -1, -1 }, { 1419, 1058, 1057 } },
-    { { 336, 1790, 1032 }, { -1, -1, -1 }, { 1419, 1057, 1066 } },
-    { { 336, 1032, 1792 }, { -1, -1, -1 }, { 1419, 1066, 1065 } },
-    { { 336, 1792, 1036 }, { -1, -1, -1 }, { 1419, 1065, 1074 } },
-    { { 336, 1036, 1794 }, { -1, -1, -1 }, { 1419, 1074, 1073 } },
-    { { 336, 1794, 1210 }, { -1, -1, -1 }, { 1419, 1073, 1420 } },
-    { { 337, 1038, 1793 }, { -1, -1, -1 }, { 1421, 1076, 1069 } },
-    { { 337, 1793, 1034 }, { -1, -1, -1 }, { 1421, 1069, 1068 } },
-    { { 337, 1034, 1791 }, { -1, -1, -1 }, { 1421, 1068, 1061 } },
-    { { 337, 1791, 1030 }, { -1, -1, -1 }, { 1421, 1061, 1060 } },
-    { { 337, 1030, 1789 }, { -1, -1, -1 }, { 1421, 1060, 1053 } },
-    { { 337, 1789, 1211 }, { -1, -1, -1 }, { 1421, 1053, 1422 } },
-    { { 337, 1211, 1795 }, { -1, -1, -1 }, { 1421, 1422, 1077 } },
-    { { 337, 1795, 1038 }, { -1, -1, -1 }, { 1421, 1077, 1076 } },
-    { { 338, 1212, 1788 }, { -1, -1, -1 }, { 1423, 1424, 1048 } },
-    { { 338, 1788, 1210 }, { -1, -1, -1 }, { 1423, 1048, 1420 } },
-    { { 338, 1210, 1794 }, { -1, -1, -1 }, { 1423, 1420, 1073 } },
-    { { 338, 1794, 1205 }, { -1, -1, -1 }, { 1423, 1073, 1410 } },
-    { { 338, 1205, 1864 }, { -1, -1, -1 }, { 1423, 1410, 1403 } },
-    { { 338, 1864, 1207 }, { -1, -1, -1 }, { 1423, 1403, 1416 } },
-    { { 338, 1207, 1578 }, { -1, -1, -1 }, { 1423, 1416, 1415 } },
-    { { 338, 1578, 1212 }, { -1, -1, -1 }, { 1423, 1415, 1424 } },
-    { { 339, 1209, 1865 }, { -1, -1, -1 }, { 1425, 1418, 1407 } },
-    { { 339, 1865, 1206 }, { -1, -1, -1 }, { 1425, 1407, 1412 } },
-    { { 339, 1206, 1795 }, { -1, -1, -1 }, { 1425, 1412, 1077 } },
-    { { 339, 1795, 1211 }, { -1, -1, -1 }, { 1425, 1077, 1422 } },
-    { { 339, 1211, 1789 }, { -1, -1, -1 }, { 1425, 1422, 1053 } },
-    { { 339, 1789, 1213 }, { -1, -1, -1 }, { 1425, 1053, 1426 } },
-    { { 339, 1213, 1578 }, { -1, -1, -1 }, { 1425, 1426, 1415 } },
-    { { 339, 1578, 1209 }, { -1, -1, -1 }, { 1425, 1415, 1418 } },
-    { { 340, 1214, 1577 }, { -1, -1, -1 }, { 1427, 1428, 1050 } },
-    { { 340, 1577, 1023 }, { -1, -1, -1 }, { 1427, 1050, 1049 } },
-    { { 340, 1023, 1788 }, { -1, -1, -1 }, { 1427, 1049, 1048 } },
-    { { 340, 1788, 1212 }, { -1, -1, -1 }, { 1427, 1048, 1424 } },
-    { { 340, 1212, 1578 }, { -1, -1, -1 }, { 1427, 1424, 1415 } },
-    { { 340, 1578, 1214 }, { -1, -1, -1 }, { 1427, 1415, 1428 } },
-    { { 341, 1214, 1578 }, { -1, -1, -1 }, { 1429, 1428, 1415 } },
-    { { 341, 1578, 1213 }, { -1, -1, -1 }, { 1429, 1415, 1426 } },
-    { { 341, 1213, 1789 }, { -1, -1, -1 }, { 1429, 1426, 1053 } },
-    { { 341, 1789, 1026 }, { -1, -1, -1 }, { 1429, 1053, 1052 } },
-    { { 341, 1026, 1577 }, { -1, -1, -1 }, { 1429, 1052, 1050 } },
-    { { 341, 1577, 1214 }, { -1, -1, -1 }, { 1429, 1050, 1428 } },
-    { { 342, 1163, 1798 }, { -1, -1, -1 }, { 1430, 1329, 1089 } },
-    { { 342, 1798, 1048 }, { -1, -1, -1 }, { 1430, 1089, 1098 } },
-    { { 342, 1048, 1800 }, { -1, -1, -1 }, { 1430, 1098, 1097 } },
-    { { 342, 1800, 1139 }, { -1, -1, -1 }, { 1430, 1097, 1276 } },
-    { { 342, 1139, 1814 }, { -1, -1, -1 }, { 1430, 1276, 1280 } },
-    { { 342, 1814, 1215 }, { -1, -1, -1 }, { 1430, 1280, 1431 } },
-    { { 342, 1215, 1866 }, { -1, -1, -1 }, { 1430, 1431, 1330 } },
-    { { 342, 1866, 1163 }, { -1, -1, -1 }, { 1430, 1330, 1329 } },
-    { { 343, 1216, 1815 }, { -1, -1, -1 }, { 1432, 1433, 1286 } },
-    { { 343, 1815, 1141 }, { -1, -1, -1 }, { 1432, 1286, 1285 } },
-    { { 343, 1141, 1801 }, { -1, -1, -1 }, { 1432, 1285, 1101 } },
-    { { 343, 1801, 1050 }, { -1, -1, -1 }, { 1432, 1101, 1100 } },
-    { { 343, 1050, 1799 }, { -1, -1, -1 }, { 1432, 1100, 1093 } },
-    { { 343, 1799, 1166 }, { -1, -1, -1 }, { 1432, 1093, 1336 } },
-    { { 343, 1166, 1867 }, { -1, -1, -1 }, { 1432, 1336, 1335 } },
-    { { 343, 1867, 1216 }, { -1, -1, -1 }, { 1432, 1335, 1433 } },
-    { { 344, 1215, 1814 }, { -1, -1, -1 }, { 1434, 1431, 1280 } },
-    { { 344, 1814, 1217 }, { -1, -1, -1 }, { 1434, 1280, 1435 } },
-    { { 344, 1217, 1816 }, { -1, -1, -1 }, { 1434, 1435, 1436 } },
-    { { 344, 1816, 1218 }, { -1, -1, -1 }, { 1434, 1436, 1437 } },
-    { { 344, 1218, 1872 }, { -1, -1, -1 }, { 1434, 1437, 1342 } },
-    { { 344, 1872, 1169 }, { -1, -1, -1 }, { 1434, 1342, 1341 } },
-    { { 344, 1169, 1866 }, { -1, -1, -1 }, { 1434, 1341, 1330 } },
-    { { 344, 1866, 1215 }, { -1, -1, -1 }, { 1434, 1330, 1431 } },
-    { { 345, 1172, 1873 }, { -1, -1, -1 }, { 1438, 1348, 1347 } },
-    { { 345, 1873, 1219 }, { -1, -1, -1 }, { 1438, 1347, 1439 } },
-    { { 345, 1219, 1817 }, { -1, -1, -1 }, { 1438, 1439, 1440 } },
-    { { 345, 1817, 1220 }, { -1, -1, -1 }, { 1438, 1440, 1441 } },
-    { { 345, 1220, 1815 }, { -1, -1, -1 }, { 1438, 1441, 1286 } },
-    { { 345, 1815, 1216 }, { -1, -1, -1 }, { 1438, 1286, 1433 } },
-    { { 345, 1216, 1867 }, { -1, -1, -1 }, { 1438, 1433, 1335 } },
-    { { 345, 1867, 1172 }, { -1, -1, -1 }, { 1438, 1335, 1348 } },
-    { { 346, 1218, 1816 }, { -1, -1, -1 }, { 1442, 1437, 1436 } },
-    { { 346, 1816, 1221 }, { -1, -1, -1 }, { 1442, 1436, 1443 } },
-    { { 346, 1221, 1886 }, { -1, -1, -1 }, { 1442, 1443, 1444 } },
-    { { 346, 1886, 1222 }, { -1, -1, -1 }, { 1442, 1444, 1445 } },
-    { { 346, 1222, 1874 }, { -1, -1, -1 }, { 1442, 1445, 1354 } },
-    { { 346, 1874, 1175 }, { -1, -1, -1 }, { 1442, 1354, 1353 } },
-    { { 346, 1175, 1872 }, { -1, -1, -1 }, { 1442, 1353, 1342 } },
-    { { 346, 1872, 1218 }, { -1, -1, -1 }, { 1442, 1342, 1437 } },
-    { { 347, 1178, 1875 }, { -1, -1, -1 }, { 1446, 1360, 1359 } },
-    { { 347, 1875, 1223 }, { -1, -1, -1 }, { 1446, 1359, 1447 } },
-    { { 347, 1223, 1887 }, { -1, -1, -1 }, { 1446, 1447, 1448 } },
-    { { 347, 1887, 1224 }, { -1, -1, -1 }, { 1446, 1448, 1449 } },
-    { { 347, 1224, 1817 }, { -1, -1, -1 }, { 1446, 1449, 1440 } },
-    { { 347, 1817, 1219 }, { -1, -1, -1 }, { 1446, 1440, 1439 } },
-    { { 347, 1219, 1873 }, { -1, -1, -1 }, { 1446, 1439, 1347 } },
-    { { 347, 1873, 1178 }, { -1, -1, -1 }, { 1446, 1347, 1360 } },
-    { { 348, 1225, 1818 }, { -1, -1, -1 }, { 1450, 1451, 1377 } },
-    { { 348, 1818, 1189 }, { -1, -1, -1 }, { 1450, 1377, 1376 } },
-    { { 348, 1189, 1880 }, { -1, -1, -1 }, { 1450, 1376, 1366 } },
-    { { 348, 1880, 1181 }, { -1, -1, -1 }, { 1450, 1366, 1365 } },
-    { { 348, 1181, 1874 }, { -1, -1, -1 }, { 1450, 1365, 1354 } },
-    { { 348, 1874, 1222 }, { -1, -1, -1 }, { 1450, 1354, 1445 } },
-    { { 348, 1222, 1886 }, { -1, -1, -1 }, { 1450, 1445, 1444 } },
-    { { 348, 1886, 1225 }, { -1, -1, -1 }, { 1450, 1444, 1451 } },
-    { { 349, 1223, 1875 }, { -1, -1, -1 }, { 1452, 1447, 1359 } },
-    { { 349, 1875, 1184 }, { -1, -1, -1 }, { 1452, 1359, 1372 } },
-    { { 349, 1184, 1881 }, { -1, -1, -1 }, { 1452, 1372, 1371 } },
-    { { 349, 1881, 1192 }, { -1, -1, -1 }, { 1452, 1371, 1386 } },
-    { { 349, 1192, 1819 }, { -1, -1, -1 }, { 1452, 1386, 1385 } },
-    { { 349, 1819, 1226 }, { -1, -1, -1 }, { 1452, 1385, 1453 } },
-    { { 349, 1226, 1887 }, { -1, -1, -1 }, { 1452, 1453, 1448 } },
-    { { 349, 1887, 1223 }, { -1, -1, -1 }, { 1452, 1448, 1447 } },
-    { { 350, 1229, 1852 }, { -1, -1, -1 }, { 1454, 1455, 1259 } },
-    { { 350, 1852, 1127 }, { -1, -1, -1 }, { 1454, 1259, 1258 } },
-    { { 350, 1127, 1854 }, { -1, -1, -1 }, { 1454, 1258, 1249 } },
-    { { 350, 1854, 1227 }, { -1, -1, -1 }, { 1454, 1249, 1456 } },
-    { { 350, 1227, 1890 }, { -1, -1, -1 }, { 1454, 1456, 1457 } },
-    { { 350, 1890, 1228 }, { -1, -1, -1 }, { 1454, 1457, 1458 } },
-    { { 350, 1228, 1888 }, { -1, -1, -1 }, { 1454, 1458, 1459 } },
-    { { 350, 1888, 1229 }, { -1, -1, -1 }, { 1454, 1459, 1455 } },
-    { { 351, 1232, 1891 }, { -1, -1, -1 }, { 1460, 1461, 1462 } },
-    { { 351, 1891, 1230 }, { -1, -1, -1 }, { 1460, 1462, 1463 } },
-    { { 351, 1230, 1855 }, { -1, -1, -1 }, { 1460, 1463, 1254 } },
-    { { 351, 1855, 1130 }, { -1, -1, -1 }, { 1460, 1254, 1265 } },
-    { { 351, 1130, 1853 }, { -1, -1, -1 }, { 1460, 1265, 1264 } },
-    { { 351, 1853, 1231 }, { -1, -1, -1 }, { 1460, 1264, 1464 } },
-    { { 351, 1231, 1889 }, { -1, -1, -1 }, { 1460, 1464, 1465 } },
-    { { 351, 1889, 1232 }, { -1, -1, -1 }, { 1460, 1465, 1461 } },
-    { { 352, 1235, 1822 }, { -1, -1, -1 }, { 1466, 1467, 1278 } },
-    { { 352, 1822, 1233 }, { -1, -1, -1 }, { 1466, 1278, 1468 } },
-    { { 352, 1233, 1888 }, { -1, -1, -1 }, { 1466, 1468, 1459 } },
-    { { 352, 1888, 1228 }, { -1, -1, -1 }, { 1466, 1459, 1458 } },
-    { { 352, 1228, 1890 }, { -1, -1, -1 }, { 1466, 1458, 1457 } },
-    { { 352, 1890, 1234 }, { -1, -1, -1 }, { 1466, 1457, 1469 } },
-    { { 352, 1234, 1824 }, { -1, -1, -1 }, { 1466, 1469, 1470 } },
-    { { 352, 1824, 1235 }, { -1, -1, -1 }, { 1466, 1470, 1467 } },
-    { { 353, 1238, 1891 }, { -1, -1, -1 }, { 1471, 1472, 1462 } },
-    { { 353, 1891, 1232 }, { -1, -1, -1 }, { 1471, 1462, 1461 } },
-    { { 353, 1232, 1889 }, { -1, -1, -1 }, { 1471, 1461, 1465 } },
-    { { 353, 1889, 1236 }, { -1, -1, -1 }, { 1471, 1465, 1473 } },
-    { { 353, 1236, 1823 }, { -1, -1, -1 }, { 1471, 1473, 1283 } },
-    { { 353, 1823, 1237 }, { -1, -1, -1 }, { 1471, 1283, 1474 } },
-    { { 353, 1237, 1825 }, { -1, -1, -1 }, { 1471, 1474, 1475 } },
-    { { 353, 1825, 1238 }, { -1, -1, -1 }, { 1471, 1475, 1472 } },
-    { { 354, 1137, 1802 }, { -1, -1, -1 }, { 1476, 1277, 1105 } },
-    { { 354, 1802, 1056 }, { -1, -1, -1 }, { 1476, 1105, 1114 } },
-    { { 354, 1056, 1804 }, { -1, -1, -1 }, { 1476, 1114, 1113 } },
-    { { 354, 1804, 1239 }, { -1, -1, -1 }, { 1476, 1113, 1477 } },
-    { { 354, 1239, 1888 }, { -1, -1, -1 }, { 1476, 1477, 1459 } },
-    { { 354, 1888, 1233 }, { -1, -1, -1 }, { 1476, 1459, 1468 } },
-    { { 354, 1233, 1822 }, { -1, -1, -1 }, { 1476, 1468, 1278 } },
-    { { 354, 1822, 1137 }, { -1, -1, -1 }, { 1476, 1278, 1277 } },
-    { { 355, 1236, 1889 }, { -1, -1, -1 }, { 1478, 1473, 1465 } },
-    { { 355, 1889, 1240 }, { -1, -1, -1 }, { 1478, 1465, 1479 } },
-    { { 355, 1240, 1805 }, { -1, -1, -1 }, { 1478, 1479, 1117 } },
-    { { 355, 1805, 1058 }, { -1, -1, -1 }, { 1478, 1117, 1116 } },
-    { { 355, 1058, 1803 }, { -1, -1, -1 }, { 1478, 1116, 1109 } },
-    { { 355, 1803, 1140 }, { -1, -1, -1 }, { 1478, 1109, 1284 } },
-    { { 355, 1140, 1823 }, { -1, -1, -1 }, { 1478, 1284, 1283 } },
-    { { 355, 1823, 1236 }, { -1, -1, -1 }, { 1478, 1283, 1473 } },
-    { { 356, 1239, 1804 }, { -1, -1, -1 }, { 1480, 1477, 1113 } },
-    { { 356, 1804, 1241 }, { -1, -1, -1 }, { 1480, 1113, 1481 } },
-    { { 356, 1241, 1848 }, { -1, -1, -1 }, { 1480, 1481, 1207 } },
-    { { 356, 1848, 1102 }, { -1, -1, -1 }, { 1480, 1207, 1206 } },
-    { { 356, 1102, 1846 }, { -1, -1, -1 }, { 1480, 1206, 1205 } },
-    { { 356, 1846, 1242 }, { -1, -1, -1 }, { 1480, 1205, 1482 } },
-    { { 356, 1242, 1888 }, { -1, -1, -1 }, { 1480, 1482, 1459 } },
-    { { 356, 1888, 1239 }, { -1, -1, -1 }, { 1480, 1459, 1477 } },
-    { { 357, 1244, 1847 }, { -1, -1, -1 }, { 1483, 1484, 1213 } },
-    { { 357, 1847, 1104 }, { -1, -1, -1 }, { 1483, 1213, 1212 } },
-    { { 357, 1104, 1849 }, { -1, -1, -1 }, { 1483, 1212, 1211 } },
-    { { 357, 1849, 1243 }, { -1, -1, -1 }, { 1483, 1211, 1485 } },
-    { { 357, 1243, 1805 }, { -1, -1, -1 }, { 1483, 1485, 1117 } },
-    { { 357, 1805, 1240 }, { -1, -1, -1 }, { 1483, 1117, 1479 } },
-    { { 357, 1240, 1889 }, { -1, -1, -1 }, { 1483, 1479, 1465 } },
-    { { 357, 1889, 1244 }, { -1, -1, -1 }, { 1483, 1465, 1484 } },
-    { { 358, 1242, 1846 }, { -1, -1, -1 }, { 1486, 1482, 1205 } },
-    { { 358, 1846, 1135 }, { -1, -1, -1 }, { 1486, 1205, 1272 } },
-    { { 358, 1135, 1852 }, { -1, -1, -1 }, { 1486, 1272, 1259 } },
-    { { 358, 1852, 1229 }, { -1, -1, -1 }, { 1486, 1259, 1455 } },
-    { { 358, 1229, 1888 }, { -1, -1, -1 }, { 1486, 1455, 1459 } },
-    { { 358, 1888, 1242 }, { -1, -1, -1 }, { 1486, 1459, 1482 } },
-    { { 359, 1244, 1889 }, { -1, -1, -1 }, { 1487, 1484, 1465 } },
-    { { 359, 1889, 1231 }, { -1, -1, -1 }, { 1487, 1465, 1464 } },
-    { { 359, 1231, 1853 }, { -1, -1, -1 }, { 1487, 1464, 1264 } },
-    { { 359, 1853, 1136 }, { -1, -1, -1 }, { 1487, 1264, 1274 } },
-    { { 359, 1136, 1847 }, { -1, -1, -1 }, { 1487, 1274, 1213 } },
-    { { 359, 1847, 1244 }, { -1, -1, -1 }, { 1487, 1213, 1484 } },
-    { { 360, 1241, 1804 }, { -1, -1, -1 }, { 1488, 1481, 1113 } },
-    { { 360, 1804, 1113 }, { -1, -1, -1 }, { 1488, 1113, 1228 } },
-    { { 360, 1113, 1850 }, { -1, -1, -1 }, { 1488, 1228, 1222 } },
-    { { 360, 1850, 1109 }, { -1, -1, -1 }, { 1488, 1222, 1221 } },
-    { { 360, 1109, 1848 }, { -1, -1, -1 }, { 1488, 1221, 1207 } },
-    { { 360, 1848, 1241 }, { -1, -1, -1 }, { 1488, 1207, 1481 } },
-    { { 361, 1243, 1849 }, { -1, -1, -1 }, { 1489, 1485, 1211 } },
-    { { 361, 1849, 1112 }, { -1, -1, -1 }, { 1489, 1211, 1224 } },
-    { { 361, 1112, 1851 }, { -1, -1, -1 }, { 1489, 1224, 1226 } },
-    { { 361, 1851, 1114 }, { -1, -1, -1 }, { 1489, 1226, 1230 } },
-    { { 361, 1114, 1805 }, { -1, -1, -1 }, { 1489, 1230, 1117 } },
-    { { 361, 1805, 1243 }, { -1, -1, -1 }, { 1489, 1117, 1485 } },
-    { { 362, 1187, 1818 }, { -1, -1, -1 }, { 1490, 1378, 1377 } },
-    { { 362, 1818, 1245 }, { -1, -1, -1 }, { 1490, 1377, 1491 } },
-    { { 362, 1245, 1826 }, { -1, -1, -1 }, { 1490, 1491, 1492 } },
-    { { 362, 1826, 1246 }, { -1, -1, -1 }, { 1490, 1492, 1493 } },
-    { { 362, 1246, 1884 }, { -1, -1, -1 }, { 1490, 1493, 1494 } },
-    { { 362, 1884, 1247 }, { -1, -1, -1 }, { 1490, 1494, 1495 } },
-    { { 362, 1247, 1882 }, { -1, -1, -1 }, { 1490, 1495, 1379 } },
-    { { 362, 1882, 1187 }, { -1, -1, -1 }, { 1490, 1379, 1378 } },
-    { { 363, 1250, 1885 }, { -1, -1, -1 }, { 1496, 1497, 1498 } },
-    { { 363, 1885, 1248 }, { -1, -1, -1 }, { 1496, 1498, 1499 } },
-    { { 363, 1248, 1827 }, { -1, -1, -1 }, { 1496, 1499, 1500 } },
-    { { 363, 1827, 1249 }, { -1, -1, -1 }, { 1496, 1500, 1501 } },
-    { { 363, 1249, 1819 }, { -1, -1, -1 }, { 1496, 1501, 1385 } },
-    { { 363, 1819, 1191 }, { -1, -1, -1 }, { 1496, 1385, 1384 } },
-    { { 363, 1191, 1883 }, { -1, -1, -1 }, { 1496, 1384, 1383 } },
-    { { 363, 1883, 1250 }, { -1, -1, -1 }, { 1496, 1383, 1497 } },
-    { { 364, 1144, 1820 }, { -1, -1, -1 }, { 1502, 1292, 1291 } },
-    { { 364, 1820, 1194 }, { -1, -1, -1 }, { 1502, 1291, 1388 } },
-    { { 364, 1194, 1882 }, { -1, -1, -1 }, { 1502, 1388, 1379 } },
-    { { 364, 1882, 1247 }, { -1, -1, -1 }, { 1502, 1379, 1495 } },
-    { { 364, 1247, 1884 }, { -1, -1, -1 }, { 1502, 1495, 1494 } },
-    { { 364, 1884, 1251 }, { -1, -1, -1 }, { 1502, 1494, 1503 } },
-    { { 364, 1251, 1828 }, { -1, -1, -1 }, { 1502, 1503, 1235 } },
-    { { 364, 1828, 1144 }, { -1, -1, -1 }, { 1502, 1235, 1292 } },
-    { { 365, 1252, 1885 }, { -1, -1, -1 }, { 1504, 1505, 1498 } },
-    { { 365, 1885, 1250 }, { -1, -1, -1 }, { 1504, 1498, 1497 } },
-    { { 365, 1250, 1883 }, { -1, -1, -1 }, { 1504, 1497, 1383 } },
-    { { 365, 1883, 1196 }, { -1, -1, -1 }, { 1504, 1383, 1392 } },
-    { { 365, 1196, 1821 }, { -1, -1, -1 }, { 1504, 1392, 1295 } },
-    { { 365, 1821, 1146 }, { -1, -1, -1 }, { 1504, 1295, 1294 } },
-    { { 365, 1146, 1829 }, { -1, -1, -1 }, { 1504, 1294, 1244 } },
-    { { 365, 1829, 1252 }, { -1, -1, -1 }, { 1504, 1244, 1505 } },
-    { { 366, 1254, 1824 }, { -1, -1, -1 }, { 1506, 1507, 1470 } },
-    { { 366, 1824, 1234 }, { -1, -1, -1 }, { 1506, 1470, 1469 } },
-    { { 366, 1234, 1890 }, { -1, -1, -1 }, { 1506, 1469, 1457 } },
-    { { 366, 1890, 1253 }, { -1, -1, -1 }, { 1506, 1457, 1508 } },
-    { { 366, 1253, 1884 }, { -1, -1, -1 }, { 1506, 1508, 1494 } },
-    { { 366, 1884, 1246 }, { -1, -1, -1 }, { 1506, 1494, 1493 } },
-    { { 366, 1246, 1826 }, { -1, -1, -1 }, { 1506, 1493, 1492 } },
-    { { 366, 1826, 1254 }, { -1, -1, -1 }, { 1506, 1492, 1507 } },
-    { { 367, 1248, 1885 }, { -1, -1, -1 }, { 1509, 1499, 1498 } },
-    { { 367, 1885, 1255 }, { -1, -1, -1 }, { 1509, 1498, 1510 } },
-    { { 367, 1255, 1891 }, { -1, -1, -1 }, { 1509, 1510, 1462 } },
-    { { 367, 1891, 1238 }, { -1, -1, -1 }, { 1509, 1462, 1472 } },
-    { { 367, 1238, 1825 }, { -1, -1, -1 }, { 1509, 1472, 1475 } },
-    { { 367, 1825, 1256 }, { -1, -1, -1 }, { 1509, 1475, 1511 } },
-    { { 367, 1256, 1827 }, { -1, -1, -1 }, { 1509, 1511, 1500 } },
-    { { 367, 1827, 1248 }, { -1, -1, -1 }, { 1509, 1500, 1499 } },
-    { { 368, 1227, 1854 }, { -1, -1, -1 }, { 1512, 1456, 1249 } },
-    { { 368, 1854, 1122 }, { -1, -1, -1 }, { 1512, 1249, 1248 } },
-    { { 368, 1122, 1856 }, { -1, -1, -1 }, { 1512, 1248, 1237 } },
-    { { 368, 1856, 1257 }, { -1, -1, -1 }, { 1512, 1237, 1513 } },
-    { { 368, 1257, 1884 }, { -1, -1, -1 }, { 1512, 1513, 1494 } },
-    { { 368, 1884, 1253 }, { -1, -1, -1 }, { 1512, 1494, 1508 } },
-    { { 368, 1253, 1890 }, { -1, -1, -1 }, { 1512, 1508, 1457 } },
-    { { 368, 1890, 1227 }, { -1, -1, -1 }, { 1512, 1457, 1456 } },
-    { { 369, 1255, 1885 }, { -1, -1, -1 }, { 1514, 1510, 1498 } },
-    { { 369, 1885, 1258 }, { -1, -1, -1 }, { 1514, 1498, 1515 } },
-    { { 369, 1258, 1857 }, { -1, -1, -1 }, { 1514, 1515, 1242 } },
-    { { 369, 1857, 1125 }, { -1, -1, -1 }, { 1514, 1242, 1255 } },
-    { { 369, 1125, 1855 }, { -1, -1, -1 }, { 1514, 1255, 1254 } },
-    { { 369, 1855, 1230 }, { -1, -1, -1 }, { 1514, 1254, 1463 } },
-    { { 369, 1230, 1891 }, { -1, -1, -1 }, { 1514, 1463, 1462 } },
-    { { 369, 1891, 1255 }, { -1, -1, -1 }, { 1514, 1462, 1510 } },
-    { { 370, 1116, 1828 }, { -1, -1, -1 }, { 1516, 1236, 1235 } },
-    { { 370, 1828, 1251 }, { -1, -1, -1 }, { 1516, 1235, 1503 } },
-    { { 370, 1251, 1884 }, { -1, -1, -1 }, { 1516, 1503, 1494 } },
-    { { 370, 1884, 1257 }, { -1, -1, -1 }, { 1516, 1494, 1513 } },
-    { { 370, 1257, 1856 }, { -1, -1, -1 }, { 1516, 1513, 1237 } },
-    { { 370, 1856, 1116 }, { -1, -1, -1 }, { 1516, 1237, 1236 } },
-    { { 371, 1119, 1857 }, { -1, -1, -1 }, { 1517, 1243, 1242 } },
-    { { 371, 1857, 1258 }, { -1, -1, -1 }, { 1517, 1242, 1515 } },
-    { { 371, 1258, 1885 }, { -1, -1, -1 }, { 1517, 1515, 1498 } },
-    { { 371, 1885, 1252 }, { -1, -1, -1 }, { 1517, 1498, 1505 } },
-    { { 371, 1252, 1829 }, { -1, -1, -1 }, { 1517, 1505, 1244 } },
-    { { 371, 1829, 1119 }, { -1, -1, -1 }, { 1517, 1244, 1243 } },
-    { { 372, 1262, 1904 }, { -1, -1, -1 }, { 1518, 1519, 1520 } },
-    { { 372, 1904, 1259 }, { -1, -1, -1 }, { 1518, 1520, 1521 } },
-    { { 372, 1259, 1892 }, { -1, -1, -1 }, { 1518, 1521, 1522 } },
-    { { 372, 1892, 1260 }, { -1, -1, -1 }, { 1518, 1522, 1523 } },
-    { { 372, 1260, 1918 }, { -1, -1, -1 }, { 1518, 1523, 1524 } },
-    { { 372, 1918, 1261 }, { -1, -1, -1 }, { 1518, 1524, 1525 } },
-    { { 372, 1261, 1906 }, { -1, -1, -1 }, { 1518, 1525, 1526 } },
-    { { 372, 1906, 1262 }, { -1, -1, -1 }, { 1518, 1526, 1519 } },
-    { { 373, 1266, 1919 }, { -1, -1, -1 }, { 1527, 1528, 1529 } },
-    { { 373, 1919, 1263 }, { -1, -1, -1 }, { 1527, 1529, 1530 } },
-    { { 373, 1263, 1893 }, { -1, -1, -1 }, { 1527, 1530, 1531 } },
-    { { 373, 1893, 1264 }, { -1, -1, -1 }, { 1527, 1531, 1532 } },
-    { { 373, 1264, 1905 }, { -1, -1, -1 }, { 1527, 1532, 1533 } },
-    { { 373, 1905, 1265 }, { -1, -1, -1 }, { 1527, 1533, 1534 } },
-    { { 373, 1265, 1907 }, { -1, -1, -1 }, { 1527, 1534, 1535 } },
-    { { 373, 1907, 1266 }, { -1, -1, -1 }, { 1527, 1535, 1528 } },
-    { { 374, 1269, 1904 }, { -1, -1, -1 }, { 1536, 1537, 1520 } },
-    { { 374, 1904, 1262 }, { -1, -1, -1 }, { 1536, 1520, 1519 } },
-    { { 374, 1262, 1906 }, { -1, -1, -1 }, { 1536, 1519, 1526 } },
-    { { 374, 1906, 1267 }, { -1, -1, -1 }, { 1536, 1526, 1538 } },
-    { { 374, 1267, 1908 }, { -1, -1, -1 }, { 1536, 1538, 1539 } },
-    { { 374, 1908, 1268 }, { -1, -1, -1 }, { 1536, 1539, 1540 } },
-    { { 374, 1268, 1902 }, { -1, -1, -1 }, { 1536, 1540, 1541 } },
-    { { 374, 1902, 1269 }, { -1, -1, -1 }, { 1536, 1541, 1537 } },
-    { { 375, 1272, 1909 }, { -1, -1, -1 }, { 1542, 1543, 1544 } },
-    { { 375, 1909, 1270 }, { -1, -1, -1 }, { 1542, 1544, 1545 } },
-    { { 375, 1270, 1907 }, { -1, -1, -1 }, { 1542, 1545, 1535 } },
-    { { 375, 1907, 1265 }, { -1, -1, -1 }, { 1542, 1535, 1534 } },
-    { { 375, 1265, 1905 }, { -1, -1, -1 }, { 1542, 1534, 1533 } },
-    { { 375, 1905, 1271 }, { -1, -1, -1 }, { 1542, 1533, 1546 } },
-    { { 375, 1271, 1903 }, { -1, -1, -1 }, { 1542, 1546, 1547 } },
-    { { 375, 1903, 1272 }, { -1, -1, -1 }, { 1542, 1547, 1543 } },
-    { { 376, 1275, 1902 }, { -1, -1, -1 }, { 1548, 1549, 1541 } },
-    { { 376, 1902, 1268 }, { -1, -1, -1 }, { 1548, 1541, 1540 } },
-    { { 376, 1268, 1908 }, { -1, -1, -1 }, { 1548, 1540, 1539 } },
-    { { 376, 1908, 1273 }, { -1, -1, -1 }, { 1548, 1539, 1550 } },
-    { { 376, 1273, 1910 }, { -1, -1, -1 }, { 1548, 1550, 1551 } },
-    { { 376, 1910, 1274 }, { -1, -1, -1 }, { 1548, 1551, 1552 } },
-    { { 376, 1274, 1900 }, { -1, -1, -1 }, { 1548, 1552, 1553 } },
-    { { 376, 1900, 1275 }, { -1, -1, -1 }, { 1548, 1553, 1549 } },
-    { { 377, 1278, 1911 }, { -1, -1, -1 }, { 1554, 1555, 1556 } },
-    { { 377, 1911, 1276 }, { -1, -1, -1 }, { 1554, 1556, 1557 } },
-    { { 377, 1276, 1909 }, { -1, -1, -1 }, { 1554, 1557, 1544 } },
-    { { 377, 1909, 1272 }, { -1, -1, -1 }, { 1554, 1544, 1543 } },
-    { { 377, 1272, 1903 }, { -1, -1, -1 }, { 1554, 1543, 1547 } },
-    { { 377, 1903, 1277 }, { -1, -1, -1 }, { 1554, 1547, 1558 } },
-    { { 377, 1277, 1901 }, { -1, -1, -1 }, { 1554, 1558, 1559 } },
-    { { 377, 1901, 1278 }, { -1, -1, -1 }, { 1554, 1559, 1555 } },
-    { { 378, 1281, 1900 }, { -1, -1, -1 }, { 1560, 1561, 1553 } },
-    { { 378, 1900, 1274 }, { -1, -1, -1 }, { 1560, 1553, 1552 } },
-    { { 378, 1274, 1910 }, { -1, -1, -1 }, { 1560, 1552, 1551 } },
-    { { 378, 1910, 1279 }, { -1, -1, -1 }, { 1560, 1551, 1562 } },
-    { { 378, 1279, 1912 }, { -1, -1, -1 }, { 1560, 1562, 1563 } },
-    { { 378, 1912, 1280 }, { -1, -1, -1 }, { 1560, 1563, 1564 } },
-    { { 378, 1280, 1898 }, { -1, -1, -1 }, { 1560, 1564, 1565 } },
-    { { 378, 1898, 1281 }, { -1, -1, -1 }, { 1560, 1565, 1561 } },
-    { { 379, 1284, 1913 }, { -1, -1, -1 }, { 1566, 1567, 1568 } },
-    { { 379, 1913, 1282 }, { -1, -1, -1 }, { 1566, 1568, 1569 } },
-    { { 379, 1282, 1911 }, { -1, -1, -1 }, { 1566, 1569, 1556 } },
-    { { 379, 1911, 1278 }, { -1, -1, -1 }, { 1566, 1556, 1555 } },
-    { { 379, 1278, 1901 }, { -1, -1, -1 }, { 1566, 1555, 1559 } },
-    { { 379, 1901, 1283 }, { -1, -1, -1 }, { 1566, 1559, 1570 } },
-    { { 379, 1283, 1899 }, { -1, -1, -1 }, { 1566, 1570, 1571 } },
-    { { 379, 1899, 1284 }, { -1, -1, -1 }, { 1566, 1571, 1567 } },
-    { { 380, 1287, 1898 }, { -1, -1, -1 }, { 1572, 1573, 1565 } },
-    { { 380, 1898, 1280 }, { -1, -1, -1 }, { 1572, 1565, 1564 } },
-    { { 380, 1280, 1912 }, { -1, -1, -1 }, { 1572, 1564, 1563 } },
-    { { 380, 1912, 1285 }, { -1, -1, -1 }, { 1572, 1563, 1574 } },
-    { { 380, 1285, 1914 }, { -1, -1, -1 }, { 1572, 1574, 1575 } },
-    { { 380, 1914, 1286 }, { -1, -1, -1 }, { 1572, 1575, 1576 } },
-    { { 380, 1286, 1896 }, { -1, -1, -1 }, { 1572, 1576, 1577 } },
-    { { 380, 1896, 1287 }, { -1, -1, -1 }, { 1572, 1577, 1573 } },
-    { { 381, 1290, 1915 }, { -1, -1, -1 }, { 1578, 1579, 1580 } },
-    { { 381, 1915, 1288 }, { -1, -1, -1 }, { 1578, 1580, 1581 } },
-    { { 381, 1288, 1913 }, { -1, -1, -1 }, { 1578, 1581, 1568 } },
-    { { 381, 1913, 1284 }, { -1, -1, -1 }, { 1578, 1568, 1567 } },
-    { { 381, 1284, 1899 }, { -1, -1, -1 }, { 1578, 1567, 1571 } },
-    { { 381, 1899, 1289 }, { -1, -1, -1 }, { 1578, 1571, 1582 } },
-    { { 381, 1289, 1897 }, { -1, -1, -1 }, { 1578, 1582, 1583 } },
-    { { 381, 1897, 1290 }, { -1, -1, -1 }, { 1578, 1583, 1579 } },
-    { { 382, 1293, 1896 }, { -1, -1, -1 }, { 1584, 1585, 1577 } },
-    { { 382, 1896, 1286 }, { -1, -1, -1 }, { 1584, 1577, 1576 } },
-    { { 382, 1286, 1914 }, { -1, -1, -1 }, { 1584, 1576, 1575 } },
-    { { 382, 1914, 1291 }, { -1, -1, -1 }, { 1584, 1575, 1586 } },
-    { { 382, 1291, 1916 }, { -1, -1, -1 }, { 1584, 1586, 1587 } },
-    { { 382, 1916, 1292 }, { -1, -1, -1 }, { 1584, 1587, 1588 } },
-    { { 382, 1292, 1894 }, { -1, -1, -1 }, { 1584, 1588, 1589 } },
-    { { 382, 1894, 1293 }, { -1, -1, -1 }, { 1584, 1589, 1585 } },
-    { { 383, 1296, 1917 }, { -1, -1, -1 }, { 1590, 1591, 1592 } },
-    { { 383, 1917, 1294 }, { -1, -1, -1 }, { 1590, 1592, 1593 } },
-    { { 383, 1294, 1915 }, { -1, -1, -1 }, { 1590, 1593, 1580 } },
-    { { 383, 1915, 1290 }, { -1, -1, -1 }, { 1590, 1580, 1579 } },
-    { { 383, 1290, 1897 }, { -1, -1, -1 }, { 1590, 1579, 1583 } },
-    { { 383, 1897, 1295 }, { -1, -1, -1 }, { 1590, 1583, 1594 } },
-    { { 383, 1295, 1895 }, { -1, -1, -1 }, { 1590, 1594, 1595 } },
-    { { 383, 1895, 1296 }, { -1, -1, -1 }, { 1590, 1595, 1591 } },
-    { { 384, 1291, 1914 }, { -1, -1, -1 }, { 1596, 1586, 1575 } },
-    { { 384, 1914, 1297 }, { -1, -1, -1 }, { 1596, 1575, 1597 } },
-    { { 384, 1297, 1924 }, { -1, -1, -1 }, { 1596, 1597, 1598 } },
-    { { 384, 1924, 1298 }, { -1, -1, -1 }, { 1596, 1598, 1599 } },
-    { { 384, 1298, 1922 }, { -1, -1, -1 }, { 1596, 1599, 1600 } },
-    { { 384, 1922, 1299 }, { -1, -1, -1 }, { 1596, 1600, 1601 } },
-    { { 384, 1299, 1916 }, { -1, -1, -1 }, { 1596, 1601, 1587 } },
-    { { 384, 1916, 1291 }, { -1, -1, -1 }, { 1596, 1587, 1586 } },
-    { { 385, 1302, 1923 }, { -1, -1, -1 }, { 1602, 1603, 1604 } },
-    { { 385, 1923, 1300 }, { -1, -1, -1 }, { 1602, 1604, 1605 } },
-    { { 385, 1300, 1925 }, { -1, -1, -1 }, { 1602, 1605, 1606 } },
-    { { 385, 1925, 1301 }, { -1, -1, -1 }, { 1602, 1606, 1607 } },
-    { { 385, 1301, 1915 }, { -1, -1, -1 }, { 1602, 1607, 1580 } },
-    { { 385, 1915, 1294 }, { -1, -1, -1 }, { 1602, 1580, 1593 } },
-    { { 385, 1294, 1917 }, { -1, -1, -1 }, { 1602, 1593, 1592 } },
-    { { 385, 1917, 1302 }, { -1, -1, -1 }, { 1602, 1592, 1603 } },
-    { { 386, 1285, 1912 }, { -1, -1, -1 }, { 1608, 1574, 1563 } },
-    { { 386, 1912, 1303 }, { -1, -1, -1 }, { 1608, 1563, 1609 } },
-    { { 386, 1303, 1926 }, { -1, -1, -1 }, { 1608, 1609, 1610 } },
-    { { 386, 1926, 1304 }, { -1, -1, -1 }, { 1608, 1610, 1611 } },
-    { { 386, 1304, 1924 }, { -1, -1, -1 }, { 1608, 1611, 1598 } },
-    { { 386, 1924, 1297 }, { -1, -1, -1 }, { 1608, 1598, 1597 } },
-    { { 386, 1297, 1914 }, { -1, -1, -1 }, { 1608, 1597, 1575 } },
-    { { 386, 1914, 1285 }, { -1, -1, -1 }, { 1608, 1575, 1574 } },
-    { { 387, 1301, 1925 }, { -1, -1, -1 }, { 1612, 1607, 1606 } },
-    { { 387, 1925, 1305 }, { -1, -1, -1 }, { 1612, 1606, 1613 } },
-    { { 387, 1305, 1927 }, { -1, -1, -1 }, { 1612, 1613, 1614 } },
-    { { 387, 1927, 1306 }, { -1, -1, -1 }, { 1612, 1614, 1615 } },
-    { { 387, 1306, 1913 }, { -1, -1, -1 }, { 1612, 1615, 1568 } },
-    { { 387, 1913, 1288 }, { -1, -1, -1 }, { 1612, 1568, 1581 } },
-    { { 387, 1288, 1915 }, { -1, -1, -1 }, { 1612, 1581, 1580 } },
-    { { 387, 1915, 1301 }, { -1, -1, -1 }, { 1612, 1580, 1607 } },
-    { { 388, 1279, 1910 }, { -1, -1, -1 }, { 1616, 1562, 1551 } },
-    { { 388, 1910, 1307 }, { -1, -1, -1 }, { 1616, 1551, 1617 } },
-    { { 388, 1307, 1928 }, { -1, -1, -1 }, { 1616, 1617, 1618 } },
-    { { 388, 1928, 1308 }, { -1, -1, -1 }, { 1616, 1618, 1619 } },
-    { { 388, 1308, 1926 }, { -1, -1, -1 }, { 1616, 1619, 1610 } },
-    { { 388, 1926, 1303 }, { -1, -1, -1 }, { 1616, 1610, 1609 } },
-    { { 388, 1303, 1912 }, { -1, -1, -1 }, { 1616, 1609, 1563 } },
-    { { 388, 1912, 1279 }, { -1, -1, -1 }, { 1616, 1563, 1562 } },
-    { { 389, 1306, 1927 }, { -1, -1, -1 }, { 1620, 1615, 1614 } },
-    { { 389, 1927, 1309 }, { -1, -1, -1 }, { 1620, 1614, 1621 } },
-    { { 389, 1309, 1929 }, { -1, -1, -1 }, { 1620, 1621, 1622 } },
-    { { 389, 1929, 1310 }, { -1, -1, -1 }, { 1620, 1622, 1623 } },
-    { { 389, 1310, 1911 }, { -1, -1, -1 }, { 1620, 1623, 1556 } },
-    { { 389, 1911, 1282 }, { -1, -1, -1 }, { 1620, 1556, 1569 } },
-    { { 389, 1282, 1913 }, { -1, -1, -1 }, { 1620, 1569, 1568 } },
-    { { 389, 1913, 1306 }, { -1, -1, -1 }, { 1620, 1568, 1615 } },
-    { { 390, 1273, 1908 }, { -1, -1, -1 }, { 1624, 1550, 1539 } },
-    { { 390, 1908, 1311 }, { -1, -1, -1 }, { 1624, 1539, 1625 } },
-    { { 390, 1311, 1930 }, { -1, -1, -1 }, { 1624, 1625, 1626 } },
-    { { 390, 1930, 1312 }, { -1, -1, -1 }, { 1624, 1626, 1627 } },
-    { { 390, 1312, 1928 }, { -1, -1, -1 }, { 1624, 1627, 1618 } },
-    { { 390, 1928, 1307 }, { -1, -1, -1 }, { 1624, 1618, 1617 } },
-    { { 390, 1307, 1910 }, { -1, -1, -1 }, { 1624, 1617, 1551 } },
-    { { 390, 1910, 1273 }, { -1, -1, -1 }, { 1624, 1551, 1550 } },
-    { { 391, 1310, 1929 }, { -1, -1, -1 }, { 1628, 1623, 1622 } },
-    { { 391, 1929, 1313 }, { -1, -1, -1 }, { 1628, 1622, 1629 } },
-    { { 391, 1313, 1931 }, { -1, -1, -1 }, { 1628, 1629, 1630 } },
-    { { 391, 1931, 1314 }, { -1, -1, -1 }, { 1628, 1630, 1631 } },
-    { { 391, 1314, 1909 }, { -1, -1, -1 }, { 1628, 1631, 1544 } },
-    { { 391, 1909, 1276 }, { -1, -1, -1 }, { 1628, 1544, 1557 } },
-    { { 391, 1276, 1911 }, { -1, -1, -1 }, { 1628, 1557, 1556 } },
-    { { 391, 1911, 1310 }, { -1, -1, -1 }, { 1628, 1556, 1623 } },
-    { { 392, 1267, 1906 }, { -1, -1, -1 }, { 1632, 1538, 1526 } },
-    { { 392, 1906, 1315 }, { -1, -1, -1 }, { 1632, 1526, 1633 } },
-    { { 392, 1315, 1932 }, { -1, -1, -1 }, { 1632, 1633, 1634 } },
-    { { 392, 1932, 1316 }, { -1, -1, -1 }, { 1632, 1634, 1635 } },
-    { { 392, 1316, 1930 }, { -1, -1, -1 }, { 1632, 1635, 1626 } },
-    { { 392, 1930, 1311 }, { -1, -1, -1 }, { 1632, 1626, 1625 } },
-    { { 392, 1311, 1908 }, { -1, -1, -1 }, { 1632, 1625, 1539 } },
-    { { 392, 1908, 1267 }, { -1, -1, -1 }, { 1632, 1539, 1538 } },
-    { { 393, 1314, 1931 }, { -1, -1, -1 }, { 1636, 1631, 1630 } },
-    { { 393, 1931, 1317 }, { -1, -1, -1 }, { 1636, 1630, 1637 } },
-    { { 393, 1317, 1933 }, { -1, -1, -1 }, { 1636, 1637, 1638 } },
-    { { 393, 1933, 1318 }, { -1, -1, -1 }, { 1636, 1638, 1639 } },
-    { { 393, 1318, 1907 }, { -1, -1, -1 }, { 1636, 1639, 1535 } },
-    { { 393, 1907, 1270 }, { -1, -1, -1 }, { 1636, 1535, 1545 } },
-    { { 393, 1270, 1909 }, { -1, -1, -1 }, { 1636, 1545, 1544 } },
-    { { 393, 1909, 1314 }, { -1, -1, -1 }, { 1636, 1544, 1631 } },
-    { { 394, 1315, 1906 }, { -1, -1, -1 }, { 1640, 1633, 1526 } },
-    { { 394, 1906, 1261 }, { -1, -1, -1 }, { 1640, 1526, 1525 } },
-    { { 394, 1261, 1918 }, { -1, -1, -1 }, { 1640, 1525, 1524 } },
-    { { 394, 1918, 1319 }, { -1, -1, -1 }, { 1640, 1524, 1641 } },
-    { { 394, 1319, 1920 }, { -1, -1, -1 }, { 1640, 1641, 1642 } },
-    { { 394, 1920, 1320 }, { -1, -1, -1 }, { 1640, 1642, 1643 } },
-    { { 394, 1320, 1932 }, { -1, -1, -1 }, { 1640, 1643, 1634 } },
-    { { 394, 1932, 1315 }, { -1, -1, -1 }, { 1640, 1634, 1633 } },
-    { { 395, 1322, 1921 }, { -1, -1, -1 }, { 1644, 1645, 1646 } },
-    { { 395, 1921, 1321 }, { -1, -1, -1 }, { 1644, 1646, 1647 } },
-    { { 395, 1321, 1919 }, { -1, -1, -1 }, { 1644, 1647, 1529 } },
-    { { 395, 1919, 1266 }, { -1, -1, -1 }, { 1644, 1529, 1528 } },
-    { { 395, 1266, 1907 }, { -1, -1, -1 }, { 1644, 1528, 1535 } },
-    { { 395, 1907, 1318 }, { -1, -1, -1 }, { 1644, 1535, 1639 } },
-    { { 395, 1318, 1933 }, { -1, -1, -1 }, { 1644, 1639, 1638 } },
-    { { 395, 1933, 1322 }, { -1, -1, -1 }, { 1644, 1638, 1645 } },
-    { { 396, 1325, 1822 }, { -1, -1, -1 }, { 1648, 1649, 1278 } },
-    { { 396, 1822, 1235 }, { -1, -1, -1 }, { 1648, 1278, 1467 } },
-    { { 396, 1235, 1824 }, { -1, -1, -1 }, { 1648, 1467, 1470 } },
-    { { 396, 1824, 1323 }, { -1, -1, -1 }, { 1648, 1470, 1650 } },
-    { { 396, 1323, 1948 }, { -1, -1, -1 }, { 1648, 1650, 1651 } },
-    { { 396, 1948, 1324 }, { -1, -1, -1 }, { 1648, 1651, 1652 } },
-    { { 396, 1324, 1946 }, { -1, -1, -1 }, { 1648, 1652, 1653 } },
-    { { 396, 1946, 1325 }, { -1, -1, -1 }, { 1648, 1653, 1649 } },
-    { { 397, 1328, 1949 }, { -1, -1, -1 }, { 1654, 1655, 1656 } },
-    { { 397, 1949, 1326 }, { -1, -1, -1 }, { 1654, 1656, 1657 } },
-    { { 397, 1326, 1825 }, { -1, -1, -1 }, { 1654, 1657, 1475 } },
-    { { 397, 1825, 1237 }, { -1, -1, -1 }, { 1654, 1475, 1474 } },
-    { { 397, 1237, 1823 }, { -1, -1, -1 }, { 1654, 1474, 1283 } },
-    { { 397, 1823, 1327 }, { -1, -1, -1 }, { 1654, 1283, 1658 } },
-    { { 397, 1327, 1947 }, { -1, -1, -1 }, { 1654, 1658, 1659 } },
-    { { 397, 1947, 1328 }, { -1, -1, -1 }, { 1654, 1659, 1655 } },
-    { { 398, 1323, 1824 }, { -1, -1, -1 }, { 1660, 1650, 1470 } },
-    { { 398, 1824, 1329 }, { -1, -1, -1 }, { 1660, 1470, 1661 } },
-    { { 398, 1329, 1894 }, { -1, -1, -1 }, { 1660, 1661, 1589 } },
-    { { 398, 1894, 1292 }, { -1, -1, -1 }, { 1660, 1589, 1588 } },
-    { { 398, 1292, 1916 }, { -1, -1, -1 }, { 1660, 1588, 1587 } },
-    { { 398, 1916, 1330 }, { -1, -1, -1 }, { 1660, 1587, 1662 } },
-    { { 398, 1330, 1948 }, { -1, -1, -1 }, { 1660, 1662, 1651 } },
-    { { 398, 1948, 1323 }, { -1, -1, -1 }, { 1660, 1651, 1650 } },
-    { { 399, 1332, 1917 }, { -1, -1, -1 }, { 1663, 1664, 1592 } },
-    { { 399, 1917, 1296 }, { -1, -1, -1 }, { 1663, 1592, 1591 } },
-    { { 399, 1296, 1895 }, { -1, -1, -1 }, { 1663, 1591, 1595 } },
-    { { 399, 1895, 1331 }, { -1, -1, -1 }, { 1663, 1595, 1665 } },
-    { { 399, 1331, 1825 }, { -1, -1, -1 }, { 1663, 1665, 1475 } },
-    { { 399, 1825, 1326 }, { -1, -1, -1 }, { 1663, 1475, 1657 } },
-    { { 399, 1326, 1949 }, { -1, -1, -1 }, { 1663, 1657, 1656 } },
-    { { 399, 1949, 1332 }, { -1, -1, -1 }, { 1663, 1656, 1664 } },
-    { { 400, 1217, 1814 }, { -1, -1, -1 }, { 1666, 1435, 1280 } },
-    { { 400, 1814, 1138 }, { -1, -1, -1 }, { 1666, 1280, 1279 } },
-    { { 400, 1138, 1822 }, { -1, -1, -1 }, { 1666, 1279, 1278 } },
-    { { 400, 1822, 1325 }, { -1, -1, -1 }, { 1666, 1278, 1649 } },
-    { { 400, 1325, 1946 }, { -1, -1, -1 }, { 1666, 1649, 1653 } },
-    { { 400, 1946, 1333 }, { -1, -1, -1 }, { 1666, 1653, 1667 } },
-    { { 400, 1333, 1816 }, { -1, -1, -1 }, { 1666, 1667, 1436 } },
-    { { 400, 1816, 1217 }, { -1, -1, -1 }, { 1666, 1436, 1435 } },
-    { { 401, 1334, 1947 }, { -1, -1, -1 }, { 1668, 1669, 1659 } },
-    { { 401, 1947, 1327 }, { -1, -1, -1 }, { 1668, 1659, 1658 } },
-    { { 401, 1327, 1823 }, { -1, -1, -1 }, { 1668, 1658, 1283 } },
-    { { 401, 1823, 1142 }, { -1, -1, -1 }, { 1668, 1283, 1282 } },
-    { { 401, 1142, 1815 }, { -1, -1, -1 }, { 1668, 1282, 1286 } },
-    { { 401, 1815, 1220 }, { -1, -1, -1 }, { 1668, 1286, 1441 } },
-    { { 401, 1220, 1817 }, { -1, -1, -1 }, { 1668, 1441, 1440 } },
-    { { 401, 1817, 1334 }, { -1, -1, -1 }, { 1668, 1440, 1669 } },
-    { { 402, 1337, 1886 }, { -1, -1, -1 }, { 1670, 1671, 1444 } },
-    { { 402, 1886, 1335 }, { -1, -1, -1 }, { 1670, 1444, 1672 } },
-    { { 402, 1335, 1934 }, { -1, -1, -1 }, { 1670, 1672, 1673 } },
-    { { 402, 1934, 1336 }, { -1, -1, -1 }, { 1670, 1673, 1674 } },
-    { { 402, 1336, 1918 }, { -1, -1, -1 }, { 1670, 1674, 1524 } },
-    { { 402, 1918, 1260 }, { -1, -1, -1 }, { 1670, 1524, 1523 } },
-    { { 402, 1260, 1892 }, { -1, -1, -1 }, { 1670, 1523, 1522 } },
-    { { 402, 1892, 1337 }, { -1, -1, -1 }, { 1670, 1522, 1671 } },
-    { { 403, 1263, 1919 }, { -1, -1, -1 }, { 1675, 1530, 1529 } },
-    { { 403, 1919, 1338 }, { -1, -1, -1 }, { 1675, 1529, 1676 } },
-    { { 403, 1338, 1935 }, { -1, -1, -1 }, { 1675, 1676, 1677 } },
-    { { 403, 1935, 1339 }, { -1, -1, -1 }, { 1675, 1677, 1678 } },
-    { { 403, 1339, 1887 }, { -1, -1, -1 }, { 1675, 1678, 1448 } },
-    { { 403, 1887, 1340 }, { -1, -1, -1 }, { 1675, 1448, 1679 } },
-    { { 403, 1340, 1893 }, { -1, -1, -1 }, { 1675, 1679, 1531 } },
-    { { 403, 1893, 1263 }, { -1, -1, -1 }, { 1675, 1531, 1530 } },
-    { { 404, 1330, 1916 }, { -1, -1, -1 }, { 1680, 1662, 1587 } },
-    { { 404, 1916, 1299 }, { -1, -1, -1 }, { 1680, 1587, 1601 } },
-    { { 404, 1299, 1922 }, { -1, -1, -1 }, { 1680, 1601, 1600 } },
-    { { 404, 1922, 1341 }, { -1, -1, -1 }, { 1680, 1600, 1681 } },
-    { { 404, 1341, 1944 }, { -1, -1, -1 }, { 1680, 1681, 1682 } },
-    { { 404, 1944, 1342 }, { -1, -1, -1 }, { 1680, 1682, 1683 } },
-    { { 404, 1342, 1948 }, { -1, -1, -1 }, { 1680, 1683, 1651 } },
-    { { 404, 1948, 1330 }, { -1, -1, -1 }, { 1680, 1651, 1662 } },
-    { { 405, 1344, 1945 }, { -1, -1, -1 }, { 1684, 1685, 1686 } },
-    { { 405, 1945, 1343 }, { -1, -1, -1 }, { 1684, 1686, 1687 } },
-    { { 405, 1343, 1923 }, { -1, -1, -1 }, { 1684, 1687, 1604 } },
-    { { 405, 1923, 1302 }, { -1, -1, -1 }, { 1684, 1604, 1603 } },
-    { { 405, 1302, 1917 }, { -1, -1, -1 }, { 1684, 1603, 1592 } },
-    { { 405, 1917, 1332 }, { -1, -1, -1 }, { 1684, 1592, 1664 } },
-    { { 405, 1332, 1949 }, { -1, -1, -1 }, { 1684, 1664, 1656 } },
-    { { 405, 1949, 1344 }, { -1, -1, -1 }, { 1684, 1656, 1685 } },
-    { { 406, 1347, 1942 }, { -1, -1, -1 }, { 1688, 1689, 1690 } },
-    { { 406, 1942, 1345 }, { -1, -1, -1 }, { 1688, 1690, 1691 } },
-    { { 406, 1345, 1950 }, { -1, -1, -1 }, { 1688, 1691, 1692 } },
-    { { 406, 1950, 1346 }, { -1, -1, -1 }, { 1688, 1692, 1693 } },
-    { { 406, 1346, 1948 }, { -1, -1, -1 }, { 1688, 1693, 1651 } },
-    { { 406, 1948, 1342 }, { -1, -1, -1 }, { 1688, 1651, 1683 } },
-    { { 406, 1342, 1944 }, { -1, -1, -1 }, { 1688, 1683, 1682 } },
-    { { 406, 1944, 1347 }, { -1, -1, -1 }, { 1688, 1682, 1689 } },
-    { { 407, 1344, 1949 }, { -1, -1, -1 }, { 1694, 1685, 1656 } },
-    { { 407, 1949, 1348 }, { -1, -1, -1 }, { 1694, 1656, 1695 } },
-    { { 407, 1348, 1951 }, { -1, -1, -1 }, { 1694, 1695, 1696 } },
-    { { 407, 1951, 1349 }, { -1, -1, -1 }, { 1694, 1696, 1697 } },
-    { { 407, 1349, 1943 }, { -1, -1, -1 }, { 1694, 1697, 1698 } },
-    { { 407, 1943, 1350 }, { -1, -1, -1 }, { 1694, 1698, 1699 } },
-    { { 407, 1350, 1945 }, { -1, -1, -1 }, { 1694, 1699, 1686 } },
-    { { 407, 1945, 1344 }, { -1, -1, -1 }, { 1694, 1686, 1685 } },
-    { { 408, 1353, 1938 }, { -1, -1, -1 }, { 1700, 1701, 1702 } },
-    { { 408, 1938, 1351 }, { -1, -1, -1 }, { 1700, 1702, 1703 } },
-    { { 408, 1351, 1950 }, { -1, -1, -1 }, { 1700, 1703, 1692 } },
-    { { 408, 1950, 1345 }, { -1, -1, -1 }, { 1700, 1692, 1691 } },
-    { { 408, 1345, 1942 }, { -1, -1, -1 }, { 1700, 1691, 1690 } },
-    { { 408, 1942, 1352 }, { -1, -1, -1 }, { 1700, 1690, 1704 } },
-    { { 408, 1352, 1940 }, { -1, -1, -1 }, { 1700, 1704, 1705 } },
-    { { 408, 1940, 1353 }, { -1, -1, -1 }, { 1700, 1705, 1701 } },
-    { { 409, 1356, 1943 }, { -1, -1, -1 }, { 1706, 1707, 1698 } },
-    { { 409, 1943, 1349 }, { -1, -1, -1 }, { 1706, 1698, 1697 } },
-    { { 409, 1349, 1951 }, { -1, -1, -1 }, { 1706, 1697, 1696 } },
-    { { 409, 1951, 1354 }, { -1, -1, -1 }, { 1706, 1696, 1708 } },
-    { { 409, 1354, 1939 }, { -1, -1, -1 }, { 1706, 1708, 1709 } },
-    { { 409, 1939, 1355 }, { -1, -1, -1 }, { 1706, 1709, 1710 } },
-    { { 409, 1355, 1941 }, { -1, -1, -1 }, { 1706, 1710, 1711 } },
-    { { 409, 1941, 1356 }, { -1, -1, -1 }, { 1706, 1711, 1707 } },
-    { { 410, 1359, 1936 }, { -1, -1, -1 }, { 1712, 1713, 1714 } },
-    { { 410, 1936, 1357 }, { -1, -1, -1 }, { 1712, 1714, 1715 } },
-    { { 410, 1357, 1952 }, { -1, -1, -1 }, { 1712, 1715, 1716 } },
-    { { 410, 1952, 1358 }, { -1, -1, -1 }, { 1712, 1716, 1717 } },
-    { { 410, 1358, 1950 }, { -1, -1, -1 }, { 1712, 1717, 1692 } },
-    { { 410, 1950, 1351 }, { -1, -1, -1 }, { 1712, 1692, 1703 } },
-    { { 410, 1351, 1938 }, { -1, -1, -1 }, { 1712, 1703, 1702 } },
-    { { 410, 1938, 1359 }, { -1, -1, -1 }, { 1712, 1702, 1713 } },
-    { { 411, 1354, 1951 }, { -1, -1, -1 }, { 1718, 1708, 1696 } },
-    { { 411, 1951, 1360 }, { -1, -1, -1 }, { 1718, 1696, 1719 } },
-    { { 411, 1360, 1953 }, { -1, -1, -1 }, { 1718, 1719, 1720 } },
-    { { 411, 1953, 1361 }, { -1, -1, -1 }, { 1718, 1720, 1721 } },
-    { { 411, 1361, 1937 }, { -1, -1, -1 }, { 1718, 1721, 1722 } },
-    { { 411, 1937, 1362 }, { -1, -1, -1 }, { 1718, 1722, 1723 } },
-    { { 411, 1362, 1939 }, { -1, -1, -1 }, { 1718, 1723, 1709 } },
-    { { 411, 1939, 1354 }, { -1, -1, -1 }, { 1718, 1709, 1708 } },
-    { { 412, 1365, 1934 }, { -1, -1, -1 }, { 1724, 1725, 1673 } },
-    { { 412, 1934, 1363 }, { -1, -1, -1 }, { 1724, 1673, 1726 } },
-    { { 412, 1363, 1952 }, { -1, -1, -1 }, { 1724, 1726, 1716 } },
-    { { 412, 1952, 1357 }, { -1, -1, -1 }, { 1724, 1716, 1715 } },
-    { { 412, 1357, 1936 }, { -1, -1, -1 }, { 1724, 1715, 1714 } },
-    { { 412, 1936, 1364 }, { -1, -1, -1 }, { 1724, 1714, 1727 } },
-    { { 412, 1364, 1954 }, { -1, -1, -1 }, { 1724, 1727, 1728 } },
-    { { 412, 1954, 1365 }, { -1, -1, -1 }, { 1724, 1728, 1725 } },
-    { { 413, 1368, 1937 }, { -1, -1, -1 }, { 1729, 1730, 1722 } },
-    { { 413, 1937, 1361 }, { -1, -1, -1 }, { 1729, 1722, 1721 } },
-    { { 413, 1361, 1953 }, { -1, -1, -1 }, { 1729, 1721, 1720 } },
-    { { 413, 1953, 1366 }, { -1, -1, -1 }, { 1729, 1720, 1731 } },
-    { { 413, 1366, 1935 }, { -1, -1, -1 }, { 1729, 1731, 1677 } },
-    { { 413, 1935, 1367 }, { -1, -1, -1 }, { 1729, 1677, 1732 } },
-    { { 413, 1367, 1955 }, { -1, -1, -1 }, { 1729, 1732, 1733 } },
-    { { 413, 1955, 1368 }, { -1, -1, -1 }, { 1729, 1733, 1730 } },
-    { { 414, 1319, 1918 }, { -1, -1, -1 }, { 1734, 1641, 1524 } },
-    { { 414, 1918, 1336 }, { -1, -1, -1 }, { 1734, 1524, 1674 } },
-    { { 414, 1336, 1934 }, { -1, -1, -1 }, { 1734, 1674, 1673 } },
-    { { 414, 1934, 1365 }, { -1, -1, -1 }, { 1734, 1673, 1725 } },
-    { { 414, 1365, 1954 }, { -1, -1, -1 }, { 1734, 1725, 1728 } },
-    { { 414, 1954, 1369 }, { -1, -1, -1 }, { 1734, 1728, 1735 } },
-    { { 414, 1369, 1920 }, { -1, -1, -1 }, { 1734, 1735, 1642 } },
-    { { 414, 1920, 1319 }, { -1, -1, -1 }, { 1734, 1642, 1641 } },
-    { { 415, 1370, 1955 }, { -1, -1, -1 }, { 1736, 1737, 1733 } },
-    { { 415, 1955, 1367 }, { -1, -1, -1 }, { 1736, 1733, 1732 } },
-    { { 415, 1367, 1935 }, { -1, -1, -1 }, { 1736, 1732, 1677 } },
-    { { 415, 1935, 1338 }, { -1, -1, -1 }, { 1736, 1677, 1676 } },
-    { { 415, 1338, 1919 }, { -1, -1, -1 }, { 1736, 1676, 1529 } },
-    { { 415, 1919, 1321 }, { -1, -1, -1 }, { 1736, 1529, 1647 } },
-    { { 415, 1321, 1921 }, { -1, -1, -1 }, { 1736, 1647, 1646 } },
-    { { 415, 1921, 1370 }, { -1, -1, -1 }, { 1736, 1646, 1737 } },
-    { { 416, 1221, 1816 }, { -1, -1, -1 }, { 1738, 1443, 1436 } },
-    { { 416, 1816, 1371 }, { -1, -1, -1 }, { 1738, 1436, 1739 } },
-    { { 416, 1371, 1952 }, { -1, -1, -1 }, { 1738, 1739, 1716 } },
-    { { 416, 1952, 1363 }, { -1, -1, -1 }, { 1738, 1716, 1726 } },
-    { { 416, 1363, 1934 }, { -1, -1, -1 }, { 1738, 1726, 1673 } },
-    { { 416, 1934, 1335 }, { -1, -1, -1 }, { 1738, 1673, 1672 } },
-    { { 416, 1335, 1886 }, { -1, -1, -1 }, { 1738, 1672, 1444 } },
-    { { 416, 1886, 1221 }, { -1, -1, -1 }, { 1738, 1444, 1443 } },
-    { { 417, 1339, 1935 }, { -1, -1, -1 }, { 1740, 1678, 1677 } },
-    { { 417, 1935, 1366 }, { -1, -1, -1 }, { 1740, 1677, 1731 } },
-    { { 417, 1366, 1953 }, { -1, -1, -1 }, { 1740, 1731, 1720 } },
-    { { 417, 1953, 1372 }, { -1, -1, -1 }, { 1740, 1720, 1741 } },
-    { { 417, 1372, 1817 }, { -1, -1, -1 }, { 1740, 1741, 1440 } },
-    { { 417, 1817, 1224 }, { -1, -1, -1 }, { 1740, 1440, 1449 } },
-    { { 417, 1224, 1887 }, { -1, -1, -1 }, { 1740, 1449, 1448 } },
-    { { 417, 1887, 1339 }, { -1, -1, -1 }, { 1740, 1448, 1678 } },
-    { { 418, 1371, 1816 }, { -1, -1, -1 }, { 1742, 1739, 1436 } },
-    { { 418, 1816, 1333 }, { -1, -1, -1 }, { 1742, 1436, 1667 } },
-    { { 418, 1333, 1946 }, { -1, -1, -1 }, { 1742, 1667, 1653 } },
-    { { 418, 1946, 1373 }, { -1, -1, -1 }, { 1742, 1653, 1743 } },
-    { { 418, 1373, 1950 }, { -1, -1, -1 }, { 1742, 1743, 1692 } },
-    { { 418, 1950, 1358 }, { -1, -1, -1 }, { 1742, 1692, 1717 } },
-    { { 418, 1358, 1952 }, { -1, -1, -1 }, { 1742, 1717, 1716 } },
-    { { 418, 1952, 1371 }, { -1, -1, -1 }, { 1742, 1716, 1739 } },
-    { { 419, 1360, 1951 }, { -1, -1, -1 }, { 1744, 1719, 1696 } },
-    { { 419, 1951, 1374 }, { -1, -1, -1 }, { 1744, 1696, 1745 } },
-    { { 419, 1374, 1947 }, { -1, -1, -1 }, { 1744, 1745, 1659 } },
-    { { 419, 1947, 1334 }, { -1, -1, -1 }, { 1744, 1659, 1669 } },
-    { { 419, 1334, 1817 }, { -1, -1, -1 }, { 1744, 1669, 1440 } },
-    { { 419, 1817, 1372 }, { -1, -1, -1 }, { 1744, 1440, 1741 } },
-    { { 419, 1372, 1953 }, { -1, -1, -1 }, { 1744, 1741, 1720 } },
-    { { 419, 1953, 1360 }, { -1, -1, -1 }, { 1744, 1720, 1719 } },
-    { { 420, 1373, 1946 }, { -1, -1, -1 }, { 1746, 1743, 1653 } },
-    { { 420, 1946, 1324 }, { -1, -1, -1 }, { 1746, 1653, 1652 } },
-    { { 420, 1324, 1948 }, { -1, -1, -1 }, { 1746, 1652, 1651 } },
-    { { 420, 1948, 1346 }, { -1, -1, -1 }, { 1746, 1651, 1693 } },
-    { { 420, 1346, 1950 }, { -1, -1, -1 }, { 1746, 1693, 1692 } },
-    { { 420, 1950, 1373 }, { -1, -1, -1 }, { 1746, 1692, 1743 } },
-    { { 421, 1374, 1951 }, { -1, -1, -1 }, { 1747, 1745, 1696 } },
-    { { 421, 1951, 1348 }, { -1, -1, -1 }, { 1747, 1696, 1695 } },
-    { { 421, 1348, 1949 }, { -1, -1, -1 }, { 1747, 1695, 1656 } },
-    { { 421, 1949, 1328 }, { -1, -1, -1 }, { 1747, 1656, 1655 } },
-    { { 421, 1328, 1947 }, { -1, -1, -1 }, { 1747, 1655, 1659 } },
-    { { 421, 1947, 1374 }, { -1, -1, -1 }, { 1747, 1659, 1745 } },
-    { { 422, 1377, 1920 }, { -1, -1, -1 }, { 1748, 1749, 1642 } },
-    { { 422, 1920, 1369 }, { -1, -1, -1 }, { 1748, 1642, 1735 } },
-    { { 422, 1369, 1954 }, { -1, -1, -1 }, { 1748, 1735, 1728 } },
-    { { 422, 1954, 1375 }, { -1, -1, -1 }, { 1748, 1728, 1750 } },
-    { { 422, 1375, 1956 }, { -1, -1, -1 }, { 1748, 1750, 1751 } },
-    { { 422, 1956, 1376 }, { -1, -1, -1 }, { 1748, 1751, 1752 } },
-    { { 422, 1376, 1980 }, { -1, -1, -1 }, { 1748, 1752, 1753 } },
-    { { 422, 1980, 1377 }, { -1, -1, -1 }, { 1748, 1753, 1749 } },
-    { { 423, 1380, 1957 }, { -1, -1, -1 }, { 1754, 1755, 1756 } },
-    { { 423, 1957, 1378 }, { -1, -1, -1 }, { 1754, 1756, 1757 } },
-    { { 423, 1378, 1955 }, { -1, -1, -1 }, { 1754, 1757, 1733 } },
-    { { 423, 1955, 1370 }, { -1, -1, -1 }, { 1754, 1733, 1737 } },
-    { { 423, 1370, 1921 }, { -1, -1, -1 }, { 1754, 1737, 1646 } },
-    { { 423, 1921, 1379 }, { -1, -1, -1 }, { 1754, 1646, 1758 } },
-    { { 423, 1379, 1981 }, { -1, -1, -1 }, { 1754, 1758, 1759 } },
-    { { 423, 1981, 1380 }, { -1, -1, -1 }, { 1754, 1759, 1755 } },
-    { { 424, 1375, 1954 }, { -1, -1, -1 }, { 1760, 1750, 1728 } },
-    { { 424, 1954, 1364 }, { -1, -1, -1 }, { 1760, 1728, 1727 } },
-    { { 424, 1364, 1936 }, { -1, -1, -1 }, { 1760, 1727, 1714 } },
-    { { 424, 1936, 1381 }, { -1, -1, -1 }, { 1760, 1714, 1761 } },
-    { { 424, 1381, 1966 }, { -1, -1, -1 }, { 1760, 1761, 1762 } },
-    { { 424, 1966, 1382 }, { -1, -1, -1 }, { 1760, 1762, 1763 } },
-    { { 424, 1382, 1956 }, { -1, -1, -1 }, { 1760, 1763, 1751 } },
-    { { 424, 1956, 1375 }, { -1, -1, -1 }, { 1760, 1751, 1750 } },
-    { { 425, 1384, 1967 }, { -1, -1, -1 }, { 1764, 1765, 1766 } },
-    { { 425, 1967, 1383 }, { -1, -1, -1 }, { 1764, 1766, 1767 } },
-    { { 425, 1383, 1937 }, { -1, -1, -1 }, { 1764, 1767, 1722 } },
-    { { 425, 1937, 1368 }, { -1, -1, -1 }, { 1764, 1722, 1730 } },
-    { { 425, 1368, 1955 }, { -1, -1, -1 }, { 1764, 1730, 1733 } },
-    { { 425, 1955, 1378 }, { -1, -1, -1 }, { 1764, 1733, 1757 } },
-    { { 425, 1378, 1957 }, { -1, -1, -1 }, { 1764, 1757, 1756 } },
-    { { 425, 1957, 1384 }, { -1, -1, -1 }, { 1764, 1756, 1765 } },
-    { { 426, 1381, 1936 }, { -1, -1, -1 }, { 1768, 1761, 1714 } },
-    { { 426, 1936, 1359 }, { -1, -1, -1 }, { 1768, 1714, 1713 } },
-    { { 426, 1359, 1938 }, { -1, -1, -1 }, { 1768, 1713, 1702 } },
-    { { 426, 1938, 1385 }, { -1, -1, -1 }, { 1768, 1702, 1769 } },
-    { { 426, 1385, 1964 }, { -1, -1, -1 }, { 1768, 1769, 1770 } },
-    { { 426, 1964, 1386 }, { -1, -1, -1 }, { 1768, 1770, 1771 } },
-    { { 426, 1386, 1966 }, { -1, -1, -1 }, { 1768, 1771, 1762 } },
-    { { 426, 1966, 1381 }, { -1, -1, -1 }, { 1768, 1762, 1761 } },
-    { { 427, 1388, 1965 }, { -1, -1, -1 }, { 1772, 1773, 1774 } },
-    { { 427, 1965, 1387 }, { -1, -1, -1 }, { 1772, 1774, 1775 } },
-    { { 427, 1387, 1939 }, { -1, -1, -1 }, { 1772, 1775, 1709 } },
-    { { 427, 1939, 1362 }, { -1, -1, -1 }, { 1772, 1709, 1723 } },
-    { { 427, 1362, 1937 }, { -1, -1, -1 }, { 1772, 1723, 1722 } },
-    { { 427, 1937, 1383 }, { -1, -1, -1 }, { 1772, 1722, 1767 } },
-    { { 427, 1383, 1967 }, { -1, -1, -1 }, { 1772, 1767, 1766 } },
-    { { 427, 1967, 1388 }, { -1, -1, -1 }, { 1772, 1766, 1773 } },
-    { { 428, 1385, 1938 }, { -1, -1, -1 }, { 1776, 1769, 1702 } },
-    { { 428, 1938, 1353 }, { -1, -1, -1 }, { 1776, 1702, 1701 } },
-    { { 428, 1353, 1940 }, { -1, -1, -1 }, { 1776, 1701, 1705 } },
-    { { 428, 1940, 1389 }, { -1, -1, -1 }, { 1776, 1705, 1777 } },
-    { { 428, 1389, 1962 }, { -1, -1, -1 }, { 1776, 1777, 1778 } },
-    { { 428, 1962, 1390 }, { -1, -1, -1 }, { 1776, 1778, 1779 } },
-    { { 428, 1390, 1964 }, { -1, -1, -1 }, { 1776, 1779, 1770 } },
-    { { 428, 1964, 1385 }, { -1, -1, -1 }, { 1776, 1770, 1769 } },
-    { { 429, 1392, 1963 }, { -1, -1, -1 }, { 1780, 1781, 1782 } },
-    { { 429, 1963, 1391 }, { -1, -1, -1 }, { 1780, 1782, 1783 } },
-    { { 429, 1391, 1941 }, { -1, -1, -1 }, { 1780, 1783, 1711 } },
-    { { 429, 1941, 1355 }, { -1, -1, -1 }, { 1780, 1711, 1710 } },
-    { { 429, 1355, 1939 }, { -1, -1, -1 }, { 1780, 1710, 1709 } },
-    { { 429, 1939, 1387 }, { -1, -1, -1 }, { 1780, 1709, 1775 } },
-    { { 429, 1387, 1965 }, { -1, -1, -1 }, { 1780, 1775, 1774 } },
-    { { 429, 1965, 1392 }, { -1, -1, -1 }, { 1780, 1774, 1781 } },
-    { { 430, 1389, 1940 }, { -1, -1, -1 }, { 1784, 1777, 1705 } },
-    { { 430, 1940, 1352 }, { -1, -1, -1 }, { 1784, 1705, 1704 } },
-    { { 430, 1352, 1942 }, { -1, -1, -1 }, { 1784, 1704, 1690 } },
-    { { 430, 1942, 1393 }, { -1, -1, -1 }, { 1784, 1690, 1785 } },
-    { { 430, 1393, 1960 }, { -1, -1, -1 }, { 1784, 1785, 1786 } },
-    { { 430, 1960, 1394 }, { -1, -1, -1 }, { 1784, 1786, 1787 } },
-    { { 430, 1394, 1962 }, { -1, -1, -1 }, { 1784, 1787, 1778 } },
-    { { 430, 1962, 1389 }, { -1, -1, -1 }, { 1784, 1778, 1777 } },
-    { { 431, 1396, 1961 }, { -1, -1, -1 }, { 1788, 1789, 1790 } },
-    { { 431, 1961, 1395 }, { -1, -1, -1 }, { 1788, 1790, 1791 } },
-    { { 431, 1395, 1943 }, { -1, -1, -1 }, { 1788, 1791, 1698 } },
-    { { 431, 1943, 1356 }, { -1, -1, -1 }, { 1788, 1698, 1707 } },
-    { { 431, 1356, 1941 }, { -1, -1, -1 }, { 1788, 1707, 1711 } },
-    { { 431, 1941, 1391 }, { -1, -1, -1 }, { 1788, 1711, 1783 } },
-    { { 431, 1391, 1963 }, { -1, -1, -1 }, { 1788, 1783, 1782 } },
-    { { 431, 1963, 1396 }, { -1, -1, -1 }, { 1788, 1782, 1789 } },
-    { { 432, 1393, 1942 }, { -1, -1, -1 }, { 1792, 1785, 1690 } },
-    { { 432, 1942, 1347 }, { -1, -1, -1 }, { 1792, 1690, 1689 } },
-    { { 432, 1347, 1944 }, { -1, -1, -1 }, { 1792, 1689, 1682 } },
-    { { 432, 1944, 1397 }, { -1, -1, -1 }, { 1792, 1682, 1793 } },
-    { { 432, 1397, 1958 }, { -1, -1, -1 }, { 1792, 1793, 1794 } },
-    { { 432, 1958, 1398 }, { -1, -1, -1 }, { 1792, 1794, 1795 } },
-    { { 432, 1398, 1960 }, { -1, -1, -1 }, { 1792, 1795, 1786 } },
-    { { 432, 1960, 1393 }, { -1, -1, -1 }, { 1792, 1786, 1785 } },
-    { { 433, 1400, 1959 }, { -1, -1, -1 }, { 1796, 1797, 1798 } },
-    { { 433, 1959, 1399 }, { -1, -1, -1 }, { 1796, 1798, 1799 } },
-    { { 433, 1399, 1945 }, { -1, -1, -1 }, { 1796, 1799, 1686 } },
-    { { 433, 1945, 1350 }, { -1, -1, -1 }, { 1796, 1686, 1699 } },
-    { { 433, 1350, 1943 }, { -1, -1, -1 }, { 1796, 1699, 1698 } },
-    { { 433, 1943, 1395 }, { -1, -1, -1 }, { 1796, 1698, 1791 } },
-    { { 433, 1395, 1961 }, { -1, -1, -1 }, { 1796, 1791, 1790 } },
-    { { 433, 1961, 1400 }, { -1, -1, -1 }, { 1796, 1790, 1797 } },
-    { { 434, 1397, 1944 }, { -1, -1, -1 }, { 1800, 1793, 1682 } },
-    { { 434, 1944, 1341 }, { -1, -1, -1 }, { 1800, 1682, 1681 } },
-    { { 434, 1341, 1922 }, { -1, -1, -1 }, { 1800, 1681, 1600 } },
-    { { 434, 1922, 1401 }, { -1, -1, -1 }, { 1800, 1600, 1801 } },
-    { { 434, 1401, 1978 }, { -1, -1, -1 }, { 1800, 1801, 1802 } },
-    { { 434, 1978, 1402 }, { -1, -1, -1 }, { 1800, 1802, 1803 } },
-    { { 434, 1402, 1958 }, { -1, -1, -1 }, { 1800, 1803, 1794 } },
-    { { 434, 1958, 1397 }, { -1, -1, -1 }, { 1800, 1794, 1793 } },
-    { { 435, 1404, 1979 }, { -1, -1, -1 }, { 1804, 1805, 1806 } },
-    { { 435, 1979, 1403 }, { -1, -1, -1 }, { 1804, 1806, 1807 } },
-    { { 435, 1403, 1923 }, { -1, -1, -1 }, { 1804, 1807, 1604 } },
-    { { 435, 1923, 1343 }, { -1, -1, -1 }, { 1804, 1604, 1687 } },
-    { { 435, 1343, 1945 }, { -1, -1, -1 }, { 1804, 1687, 1686 } },
-    { { 435, 1945, 1399 }, { -1, -1, -1 }, { 1804, 1686, 1799 } },
-    { { 435, 1399, 1959 }, { -1, -1, -1 }, { 1804, 1799, 1798 } },
-    { { 435, 1959, 1404 }, { -1, -1, -1 }, { 1804, 1798, 1805 } },
-    { { 436, 1406, 1932 }, { -1, -1, -1 }, { 1808, 1809, 1634 } },
-    { { 436, 1932, 1320 }, { -1, -1, -1 }, { 1808, 1634, 1643 } },
-    { { 436, 1320, 1920 }, { -1, -1, -1 }, { 1808, 1643, 1642 } },
-    { { 436, 1920, 1377 }, { -1, -1, -1 }, { 1808, 1642, 1749 } },
-    { { 436, 1377, 1980 }, { -1, -1, -1 }, { 1808, 1749, 1753 } },
-    { { 436, 1980, 1405 }, { -1, -1, -1 }, { 1808, 1753, 1810 } },
-    { { 436, 1405, 1968 }, { -1, -1, -1 }, { 1808, 1810, 1811 } },
-    { { 436, 1968, 1406 }, { -1, -1, -1 }, { 1808, 1811, 1809 } },
-    { { 437, 1408, 1981 }, { -1, -1, -1 }, { 1812, 1813, 1759 } },
-    { { 437, 1981, 1379 }, { -1, -1, -1 }, { 1812, 1759, 1758 } },
-    { { 437, 1379, 1921 }, { -1, -1, -1 }, { 1812, 1758, 1646 } },
-    { { 437, 1921, 1322 }, { -1, -1, -1 }, { 1812, 1646, 1645 } },
-    { { 437, 1322, 1933 }, { -1, -1, -1 }, { 1812, 1645, 1638 } },
-    { { 437, 1933, 1407 }, { -1, -1, -1 }, { 1812, 1638, 1814 } },
-    { { 437, 1407, 1969 }, { -1, -1, -1 }, { 1812, 1814, 1815 } },
-    { { 437, 1969, 1408 }, { -1, -1, -1 }, { 1812, 1815, 1813 } },
-    { { 438, 1410, 1930 }, { -1, -1, -1 }, { 1816, 1817, 1626 } },
-    { { 438, 1930, 1316 }, { -1, -1, -1 }, { 1816, 1626, 1635 } },
-    { { 438, 1316, 1932 }, { -1, -1, -1 }, { 1816, 1635, 1634 } },
-    { { 438, 1932, 1406 }, { -1, -1, -1 }, { 1816, 1634, 1809 } },
-    { { 438, 1406, 1968 }, { -1, -1, -1 }, { 1816, 1809, 1811 } },
-    { { 438, 1968, 1409 }, { -1, -1, -1 }, { 1816, 1811, 1818 } },
-    { { 438, 1409, 1970 }, { -1, -1, -1 }, { 1816, 1818, 1819 } },
-    { { 438, 1970, 1410 }, { -1, -1, -1 }, { 1816, 1819, 1817 } },
-    { { 439, 1412, 1969 }, { -1, -1, -1 }, { 1820, 1821, 1815 } },
-    { { 439, 1969, 1407 }, { -1, -1, -1 }, { 1820, 1815, 1814 } },
-    { { 439, 1407, 1933 }, { -1, -1, -1 }, { 1820, 1814, 1638 } },
-    { { 439, 1933, 1317 }, { -1, -1, -1 }, { 1820, 1638, 1637 } },
-    { { 439, 1317, 1931 }, { -1, -1, -1 }, { 1820, 1637, 1630 } },
-    { { 439, 1931, 1411 }, { -1, -1, -1 }, { 1820, 1630, 1822 } },
-    { { 439, 1411, 1971 }, { -1, -1, -1 }, { 1820, 1822, 1823 } },
-    { { 439, 1971, 1412 }, { -1, -1, -1 }, { 1820, 1823, 1821 } },
-    { { 440, 1414, 1928 }, { -1, -1, -1 }, { 1824, 1825, 1618 } },
-    { { 440, 1928, 1312 }, { -1, -1, -1 }, { 1824, 1618, 1627 } },
-    { { 440, 1312, 1930 }, { -1, -1, -1 }, { 1824, 1627, 1626 } },
-    { { 440, 1930, 1410 }, { -1, -1, -1 }, { 1824, 1626, 1817 } },
-    { { 440, 1410, 1970 }, { -1, -1, -1 }, { 1824, 1817, 1819 } },
-    { { 440, 1970, 1413 }, { -1, -1, -1 }, { 1824, 1819, 1826 } },
-    { { 440, 1413, 1972 }, { -1, -1, -1 }, { 1824, 1826, 1827 } },
-    { { 440, 1972, 1414 }, { -1, -1, -1 }, { 1824, 1827, 1825 } },
-    { { 441, 1416, 1971 }, { -1, -1, -1 }, { 1828, 1829, 1823 } },
-    { { 441, 1971, 1411 }, { -1, -1, -1 }, { 1828, 1823, 1822 } },
-    { { 441, 1411, 1931 }, { -1, -1, -1 }, { 1828, 1822, 1630 } },
-    { { 441, 1931, 1313 }, { -1, -1, -1 }, { 1828, 1630, 1629 } },
-    { { 441, 1313, 1929 }, { -1, -1, -1 }, { 1828, 1629, 1622 } },
-    { { 441, 1929, 1415 }, { -1, -1, -1 }, { 1828, 1622, 1830 } },
-    { { 441, 1415, 1973 }, { -1, -1, -1 }, { 1828, 1830, 1831 } },
-    { { 441, 1973, 1416 }, { -1, -1, -1 }, { 1828, 1831, 1829 } },
-    { { 442, 1418, 1926 }, { -1, -1, -1 }, { 1832, 1833, 1610 } },
-    { { 442, 1926, 1308 }, { -1, -1, -1 }, { 1832, 1610, 1619 } },
-    { { 442, 1308, 1928 }, { -1, -1, -1 }, { 1832, 1619, 1618 } },
-    { { 442, 1928, 1414 }, { -1, -1, -1 }, { 1832, 1618, 1825 } },
-    { { 442, 1414, 1972 }, { -1, -1, -1 }, { 1832, 1825, 1827 } },
-    { { 442, 1972, 1417 }, { -1, -1, -1 }, { 1832, 1827, 1834 } },
-    { { 442, 1417, 1974 }, { -1, -1, -1 }, { 1832, 1834, 1835 } },
-    { { 442, 1974, 1418 }, { -1, -1, -1 }, { 1832, 1835, 1833 } },
-    { { 443, 1420, 1973 }, { -1, -1, -1 }, { 1836, 1837, 1831 } },
-    { { 443, 1973, 1415 }, { -1, -1, -1 }, { 1836, 1831, 1830 } },
-    { { 443, 1415, 1929 }, { -1, -1, -1 }, { 1836, 1830, 1622 } },
-    { { 443, 1929, 1309 }, { -1, -1, -1 }, { 1836, 1622, 1621 } },
-    { { 443, 1309, 1927 }, { -1, -1, -1 }, { 1836, 1621, 1614 } },
-    { { 443, 1927, 1419 }, { -1, -1, -1 }, { 1836, 1614, 1838 } },
-    { { 443, 1419, 1975 }, { -1, -1, -1 }, { 1836, 1838, 1839 } },
-    { { 443, 1975, 1420 }, { -1, -1, -1 }, { 1836, 1839, 1837 } },
-    { { 444, 1422, 1924 }, { -1, -1, -1 }, { 1840, 1841, 1598 } },
-    { { 444, 1924, 1304 }, { -1, -1, -1 }, { 1840, 1598, 1611 } },
-    { { 444, 1304, 1926 }, { -1, -1, -1 }, { 1840, 1611, 1610 } },
-    { { 444, 1926, 1418 }, { -1, -1, -1 }, { 1840, 1610, 1833 } },
-    { { 444, 1418, 1974 }, { -1, -1, -1 }, { 1840, 1833, 1835 } },
-    { { 444, 1974, 1421 }, { -1, -1, -1 }, { 1840, 1835, 1842 } },
-    { { 444, 1421, 1976 }, { -1, -1, -1 }, { 1840, 1842, 1843 } },
-    { { 444, 1976, 1422 }, { -1, -1, -1 }, { 1840, 1843, 1841 } },
-    { { 445, 1424, 1975 }, { -1, -1, -1 }, { 1844, 1845, 1839 } },
-    { { 445, 1975, 1419 }, { -1, -1, -1 }, { 1844, 1839, 1838 } },
-    { { 445, 1419, 1927 }, { -1, -1, -1 }, { 1844, 1838, 1614 } },
-    { { 445, 1927, 1305 }, { -1, -1, -1 }, { 1844, 1614, 1613 } },
-    { { 445, 1305, 1925 }, { -1, -1, -1 }, { 1844, 1613, 1606 } },
-    { { 445, 1925, 1423 }, { -1, -1, -1 }, { 1844, 1606, 1846 } },
-    { { 445, 1423, 1977 }, { -1, -1, -1 }, { 1844, 1846, 1847 } },
-    { { 445, 1977, 1424 }, { -1, -1, -1 }, { 1844, 1847, 1845 } },
-    { { 446, 1401, 1922 }, { -1, -1, -1 }, { 1848, 1801, 1600 } },
-    { { 446, 1922, 1298 }, { -1, -1, -1 }, { 1848, 1600, 1599 } },
-    { { 446, 1298, 1924 }, { -1, -1, -1 }, { 1848, 1599, 1598 } },
-    { { 446, 1924, 1422 }, { -1, -1, -1 }, { 1848, 1598, 1841 } },
-    { { 446, 1422, 1976 }, { -1, -1, -1 }, { 1848, 1841, 1843 } },
-    { { 446, 1976, 1425 }, { -1, -1, -1 }, { 1848, 1843, 1849 } },
-    { { 446, 1425, 1978 }, { -1, -1, -1 }, { 1848, 1849, 1802 } },
-    { { 446, 1978, 1401 }, { -1, -1, -1 }, { 1848, 1802, 1801 } },
-    { { 447, 1426, 1977 }, { -1, -1, -1 }, { 1850, 1851, 1847 } },
-    { { 447, 1977, 1423 }, { -1, -1, -1 }, { 1850, 1847, 1846 } },
-    { { 447, 1423, 1925 }, { -1, -1, -1 }, { 1850, 1846, 1606 } },
-    { { 447, 1925, 1300 }, { -1, -1, -1 }, { 1850, 1606, 1605 } },
-    { { 447, 1300, 1923 }, { -1, -1, -1 }, { 1850, 1605, 1604 } },
-    { { 447, 1923, 1403 }, { -1, -1, -1 }, { 1850, 1604, 1807 } },
-    { { 447, 1403, 1979 }, { -1, -1, -1 }, { 1850, 1807, 1806 } },
-    { { 447, 1979, 1426 }, { -1, -1, -1 }, { 1850, 1806, 1851 } },
-    { { 448, 1429, 1962 }, { -1, -1, -1 }, { 1852, 1853, 1778 } },
-    { { 448, 1962, 1394 }, { -1, -1, -1 }, { 1852, 1778, 1787 } },
-    { { 448, 1394, 1960 }, { -1, -1, -1 }, { 1852, 1787, 1786 } },
-    { { 448, 1960, 1427 }, { -1, -1, -1 }, { 1852, 1786, 1854 } },
-    { { 448, 1427, 1984 }, { -1, -1, -1 }, { 1852, 1854, 1855 } },
-    { { 448, 1984, 1428 }, { -1, -1, -1 }, { 1852, 1855, 1856 } },
-    { { 448, 1428, 1982 }, { -1, -1, -1 }, { 1852, 1856, 1857 } },
-    { { 448, 1982, 1429 }, { -1, -1, -1 }, { 1852, 1857, 1853 } },
-    { { 449, 1432, 1985 }, { -1, -1, -1 }, { 1858, 1859, 1860 } },
-    { { 449, 1985, 1430 }, { -1, -1, -1 }, { 1858, 1860, 1861 } },
-    { { 449, 1430, 1961 }, { -1, -1, -1 }, { 1858, 1861, 1790 } },
-    { { 449, 1961, 1396 }, { -1, -1, -1 }, { 1858, 1790, 1789 } },
-    { { 449, 1396, 1963 }, { -1, -1, -1 }, { 1858, 1789, 1782 } },
-    { { 449, 1963, 1431 }, { -1, -1, -1 }, { 1858, 1782, 1862 } },
-    { { 449, 1431, 1983 }, { -1, -1, -1 }, { 1858, 1862, 1863 } },
-    { { 449, 1983, 1432 }, { -1, -1, -1 }, { 1858, 1863, 1859 } },
-    { { 450, 1435, 1982 }, { -1, -1, -1 }, { 1864, 1865, 1857 } },
-    { { 450, 1982, 1428 }, { -1, -1, -1 }, { 1864, 1857, 1856 } },
-    { { 450, 1428, 1984 }, { -1, -1, -1 }, { 1864, 1856, 1855 } },
-    { { 450, 1984, 1433 }, { -1, -1, -1 }, { 1864, 1855, 1866 } },
-    { { 450, 1433, 1986 }, { -1, -1, -1 }, { 1864, 1866, 1867 } },
-    { { 450, 1986, 1434 }, { -1, -1, -1 }, { 1864, 1867, 1868 } },
-    { { 450, 1434, 1988 }, { -1, -1, -1 }, { 1864, 1868, 1869 } },
-    { { 450, 1988, 1435 }, { -1, -1, -1 }, { 1864, 1869, 1865 } },
-    { { 451, 1438, 1987 }, { -1, -1, -1 }, { 1870, 1871, 1872 } },
-    { { 451, 1987, 1436 }, { -1, -1, -1 }, { 1870, 1872, 1873 } },
-    { { 451, 1436, 1985 }, { -1, -1, -1 }, { 1870, 1873, 1860 } },
-    { { 451, 1985, 1432 }, { -1, -1, -1 }, { 1870, 1860, 1859 } },
-    { { 451, 1432, 1983 }, { -1, -1, -1 }, { 1870, 1859, 1863 } },
-    { { 451, 1983, 1437 }, { -1, -1, -1 }, { 1870, 1863, 1874 } },
-    { { 451, 1437, 1989 }, { -1, -1, -1 }, { 1870, 1874, 1875 } },
-    { { 451, 1989, 1438 }, { -1, -1, -1 }, { 1870, 1875, 1871 } },
-    { { 452, 1441, 1988 }, { -1, -1, -1 }, { 1876, 1877, 1869 } },
-    { { 452, 1988, 1434 }, { -1, -1, -1 }, { 1876, 1869, 1868 } },
-    { { 452, 1434, 1986 }, { -1, -1, -1 }, { 1876, 1868, 1867 } },
-    { { 452, 1986, 1439 }, { -1, -1, -1 }, { 1876, 1867, 1878 } },
-    { { 452, 1439, 1992 }, { -1, -1, -1 }, { 1876, 1878, 1879 } },
-    { { 452, 1992, 1440 }, { -1, -1, -1 }, { 1876, 1879, 1880 } },
-    { { 452, 1440, 1990 }, { -1, -1, -1 }, { 1876, 1880, 1881 } },
-    { { 452, 1990, 1441 }, { -1, -1, -1 }, { 1876, 1881, 1877 } },
-    { { 453, 1444, 1993 }, { -1, -1, -1 }, { 1882, 1883, 1884 } },
-    { { 453, 1993, 1442 }, { -1, -1, -1 }, { 1882, 1884, 1885 } },
-    { { 453, 1442, 1987 }, { -1, -1, -1 }, { 1882, 1885, 1872 } },
-    { { 453, 1987, 1438 }, { -1, -1, -1 }, { 1882, 1872, 1871 } },
-    { { 453, 1438, 1989 }, { -1, -1, -1 }, { 1882, 1871, 1875 } },
-    { { 453, 1989, 1443 }, { -1, -1, -1 }, { 1882, 1875, 1886 } },
-    { { 453, 1443, 1991 }, { -1, -1, -1 }, { 1882, 1886, 1887 } },
-    { { 453, 1991, 1444 }, { -1, -1, -1 }, { 1882, 1887, 1883 } },
-    { { 454, 1447, 1990 }, { -1, -1, -1 }, { 1888, 1889, 1881 } },
-    { { 454, 1990, 1440 }, { -1, -1, -1 }, { 1888, 1881, 1880 } },
-    { { 454, 1440, 1992 }, { -1, -1, -1 }, { 1888, 1880, 1879 } },
-    { { 454, 1992, 1445 }, { -1, -1, -1 }, { 1888, 1879, 1890 } },
-    { { 454, 1445, 1994 }, { -1, -1, -1 }, { 1888, 1890, 1891 } },
-    { { 454, 1994, 1446 }, { -1, -1, -1 }, { 1888, 1891, 1892 } },
-    { { 454, 1446, 1996 }, { -1, -1, -1 }, { 1888, 1892, 1893 } },
-    { { 454, 1996, 1447 }, { -1, -1, -1 }, { 1888, 1893, 1889 } },
-    { { 455, 1450, 1995 }, { -1, -1, -1 }, { 1894, 1895, 1896 } },
-    { { 455, 1995, 1448 }, { -1, -1, -1 }, { 1894, 1896, 1897 } },
-    { { 455, 1448, 1993 }, { -1, -1, -1 }, { 1894, 1897, 1884 } },
-    { { 455, 1993, 1444 }, { -1, -1, -1 }, { 1894, 1884, 1883 } },
-    { { 455, 1444, 1991 }, { -1, -1, -1 }, { 1894, 1883, 1887 } },
-    { { 455, 1991, 1449 }, { -1, -1, -1 }, { 1894, 1887, 1898 } },
-    { { 455, 1449, 1997 }, { -1, -1, -1 }, { 1894, 1898, 1899 } },
-    { { 455, 1997, 1450 }, { -1, -1, -1 }, { 1894, 1899, 1895 } },
-    { { 456, 1452, 1968 }, { -1, -1, -1 }, { 1900, 1901, 1811 } },
-    { { 456, 1968, 1405 }, { -1, -1, -1 }, { 1900, 1811, 1810 } },
-    { { 456, 1405, 1980 }, { -1, -1, -1 }, { 1900, 1810, 1753 } },
-    { { 456, 1980, 1451 }, { -1, -1, -1 }, { 1900, 1753, 1902 } },
-    { { 456, 1451, 1990 }, { -1, -1, -1 }, { 1900, 1902, 1881 } },
-    { { 456, 1990, 1447 }, { -1, -1, -1 }, { 1900, 1881, 1889 } },
-    { { 456, 1447, 1996 }, { -1, -1, -1 }, { 1900, 1889, 1893 } },
-    { { 456, 1996, 1452 }, { -1, -1, -1 }, { 1900, 1893, 1901 } },
-    { { 457, 1449, 1991 }, { -1, -1, -1 }, { 1903, 1898, 1887 } },
-    { { 457, 1991, 1453 }, { -1, -1, -1 }, { 1903, 1887, 1904 } },
-    { { 457, 1453, 1981 }, { -1, -1, -1 }, { 1903, 1904, 1759 } },
-    { { 457, 1981, 1408 }, { -1, -1, -1 }, { 1903, 1759, 1813 } },
-    { { 457, 1408, 1969 }, { -1, -1, -1 }, { 1903, 1813, 1815 } },
-    { { 457, 1969, 1454 }, { -1, -1, -1 }, { 1903, 1815, 1905 } },
-    { { 457, 1454, 1997 }, { -1, -1, -1 }, { 1903, 1905, 1899 } },
-    { { 457, 1997, 1449 }, { -1, -1, -1 }, { 1903, 1899, 1898 } },
-    { { 458, 1376, 1956 }, { -1, -1, -1 }, { 1906, 1752, 1751 } },
-    { { 458, 1956, 1455 }, { -1, -1, -1 }, { 1906, 1751, 1907 } },
-    { { 458, 1455, 1988 }, { -1, -1, -1 }, { 1906, 1907, 1869 } },
-    { { 458, 1988, 1441 }, { -1, -1, -1 }, { 1906, 1869, 1877 } },
-    { { 458, 1441, 1990 }, { -1, -1, -1 }, { 1906, 1877, 1881 } },
-    { { 458, 1990, 1451 }, { -1, -1, -1 }, { 1906, 1881, 1902 } },
-    { { 458, 1451, 1980 }, { -1, -1, -1 }, { 1906, 1902, 1753 } },
-    { { 458, 1980, 1376 }, { -1, -1, -1 }, { 1906, 1753, 1752 } },
-    { { 459, 1453, 1991 }, { -1, -1, -1 }, { 1908, 1904, 1887 } },
-    { { 459, 1991, 1443 }, { -1, -1, -1 }, { 1908, 1887, 1886 } },
-    { { 459, 1443, 1989 }, { -1, -1, -1 }, { 1908, 1886, 1875 } },
-    { { 459, 1989, 1456 }, { -1, -1, -1 }, { 1908, 1875, 1909 } },
-    { { 459, 1456, 1957 }, { -1, -1, -1 }, { 1908, 1909, 1756 } },
-    { { 459, 1957, 1380 }, { -1, -1, -1 }, { 1908, 1756, 1755 } },
-    { { 459, 1380, 1981 }, { -1, -1, -1 }, { 1908, 1755, 1759 } },
-    { { 459, 1981, 1453 }, { -1, -1, -1 }, { 1908, 1759, 1904 } },
-    { { 460, 1455, 1956 }, { -1, -1, -1 }, { 1910, 1907, 1751 } },
-    { { 460, 1956, 1382 }, { -1, -1, -1 }, { 1910, 1751, 1763 } },
-    { { 460, 1382, 1966 }, { -1, -1, -1 }, { 1910, 1763, 1762 } },
-    { { 460, 1966, 1457 }, { -1, -1, -1 }, { 1910, 1762, 1911 } },
-    { { 460, 1457, 1982 }, { -1, -1, -1 }, { 1910, 1911, 1857 } },
-    { { 460, 1982, 1435 }, { -1, -1, -1 }, { 1910, 1857, 1865 } },
-    { { 460, 1435, 1988 }, { -1, -1, -1 }, { 1910, 1865, 1869 } },
-    { { 460, 1988, 1455 }, { -1, -1, -1 }, { 1910, 1869, 1907 } },
-    { { 461, 1437, 1983 }, { -1, -1, -1 }, { 1912, 1874, 1863 } },
-    { { 461, 1983, 1458 }, { -1, -1, -1 }, { 1912, 1863, 1913 } },
-    { { 461, 1458, 1967 }, { -1, -1, -1 }, { 1912, 1913, 1766 } },
-    { { 461, 1967, 1384 }, { -1, -1, -1 }, { 1912, 1766, 1765 } },
-    { { 461, 1384, 1957 }, { -1, -1, -1 }, { 1912, 1765, 1756 } },
-    { { 461, 1957, 1456 }, { -1, -1, -1 }, { 1912, 1756, 1909 } },
-    { { 461, 1456, 1989 }, { -1, -1, -1 }, { 1912, 1909, 1875 } },
-    { { 461, 1989, 1437 }, { -1, -1, -1 }, { 1912, 1875, 1874 } },
-    { { 462, 1390, 1962 }, { -1, -1, -1 }, { 1914, 1779, 1778 } },
-    { { 462, 1962, 1429 }, { -1, -1, -1 }, { 1914, 1778, 1853 } },
-    { { 462, 1429, 1982 }, { -1, -1, -1 }, { 1914, 1853, 1857 } },
-    { { 462, 1982, 1457 }, { -1, -1, -1 }, { 1914, 1857, 1911 } },
-    { { 462, 1457, 1966 }, { -1, -1, -1 }, { 1914, 1911, 1762 } },
-    { { 462, 1966, 1386 }, { -1, -1, -1 }, { 1914, 1762, 1771 } },
-    { { 462, 1386, 1964 }, { -1, -1, -1 }, { 1914, 1771, 1770 } },
-    { { 462, 1964, 1390 }, { -1, -1, -1 }, { 1914, 1770, 1779 } },
-    { { 463, 1388, 1967 }, { -1, -1, -1 }, { 1915, 1773, 1766 } },
-    { { 463, 1967, 1458 }, { -1, -1, -1 }, { 1915, 1766, 1913 } },
-    { { 463, 1458, 1983 }, { -1, -1, -1 }, { 1915, 1913, 1863 } },
-    { { 463, 1983, 1431 }, { -1, -1, -1 }, { 1915, 1863, 1862 } },
-    { { 463, 1431, 1963 }, { -1, -1, -1 }, { 1915, 1862, 1782 } },
-    { { 463, 1963, 1392 }, { -1, -1, -1 }, { 1915, 1782, 1781 } },
-    { { 463, 1392, 1965 }, { -1, -1, -1 }, { 1915, 1781, 1774 } },
-    { { 463, 1965, 1388 }, { -1, -1, -1 }, { 1915, 1774, 1773 } },
-    { { 464, 1398, 1958 }, { -1, -1, -1 }, { 1916, 1795, 1794 } },
-    { { 464, 1958, 1402 }, { -1, -1, -1 }, { 1916, 1794, 1803 } },
-    { { 464, 1402, 1978 }, { -1, -1, -1 }, { 1916, 1803, 1802 } },
-    { { 464, 1978, 1459 }, { -1, -1, -1 }, { 1916, 1802, 1917 } },
-    { { 464, 1459, 1984 }, { -1, -1, -1 }, { 1916, 1917, 1855 } },
-    { { 464, 1984, 1427 }, { -1, -1, -1 }, { 1916, 1855, 1854 } },
-    { { 464, 1427, 1960 }, { -1, -1, -1 }, { 1916, 1854, 1786 } },
-    { { 464, 1960, 1398 }, { -1, -1, -1 }, { 1916, 1786, 1795 } },
-    { { 465, 1430, 1985 }, { -1, -1, -1 }, { 1918, 1861, 1860 } },
-    { { 465, 1985, 1460 }, { -1, -1, -1 }, { 1918, 1860, 1919 } },
-    { { 465, 1460, 1979 }, { -1, -1, -1 }, { 1918, 1919, 1806 } },
-    { { 465, 1979, 1404 }, { -1, -1, -1 }, { 1918, 1806, 1805 } },
-    { { 465, 1404, 1959 }, { -1, -1, -1 }, { 1918, 1805, 1798 } },
-    { { 465, 1959, 1400 }, { -1, -1, -1 }, { 1918, 1798, 1797 } },
-    { { 465, 1400, 1961 }, { -1, -1, -1 }, { 1918, 1797, 1790 } },
-    { { 465, 1961, 1430 }, { -1, -1, -1 }, { 1918, 1790, 1861 } },
-    { { 466, 1425, 1976 }, { -1, -1, -1 }, { 1920, 1849, 1843 } },
-    { { 466, 1976, 1461 }, { -1, -1, -1 }, { 1920, 1843, 1921 } },
-    { { 466, 1461, 1986 }, { -1, -1, -1 }, { 1920, 1921, 1867 } },
-    { { 466, 1986, 1433 }, { -1, -1, -1 }, { 1920, 1867, 1866 } },
-    { { 466, 1433, 1984 }, { -1, -1, -1 }, { 1920, 1866, 1855 } },
-    { { 466, 1984, 1459 }, { -1, -1, -1 }, { 1920, 1855, 1917 } },
-    { { 466, 1459, 1978 }, { -1, -1, -1 }, { 1920, 1917, 1802 } },
-    { { 466, 1978, 1425 }, { -1, -1, -1 }, { 1920, 1802, 1849 } },
-    { { 467, 1460, 1985 }, { -1, -1, -1 }, { 1922, 1919, 1860 } },
-    { { 467, 1985, 1436 }, { -1, -1, -1 }, { 1922, 1860, 1873 } },
-    { { 467, 1436, 1987 }, { -1, -1, -1 }, { 1922, 1873, 1872 } },
-    { { 467, 1987, 1462 }, { -1, -1, -1 }, { 1922, 1872, 1923 } },
-    { { 467, 1462, 1977 }, { -1, -1, -1 }, { 1922, 1923, 1847 } },
-    { { 467, 1977, 1426 }, { -1, -1, -1 }, { 1922, 1847, 1851 } },
-    { { 467, 1426, 1979 }, { -1, -1, -1 }, { 1922, 1851, 1806 } },
-    { { 467, 1979, 1460 }, { -1, -1, -1 }, { 1922, 1806, 1919 } },
-    { { 468, 1421, 1974 }, { -1, -1, -1 }, { 1924, 1842, 1835 } },
-    { { 468, 1974, 1463 }, { -1, -1, -1 }, { 1924, 1835, 1925 } },
-    { { 468, 1463, 1992 }, { -1, -1, -1 }, { 1924, 1925, 1879 } },
-    { { 468, 1992, 1439 }, { -1, -1, -1 }, { 1924, 1879, 1878 } },
-    { { 468, 1439, 1986 }, { -1, -1, -1 }, { 1924, 1878, 1867 } },
-    { { 468, 1986, 1461 }, { -1, -1, -1 }, { 1924, 1867, 1921 } },
-    { { 468, 1461, 1976 }, { -1, -1, -1 }, { 1924, 1921, 1843 } },
-    { { 468, 1976, 1421 }, { -1, -1, -1 }, { 1924, 1843, 1842 } },
-    { { 469, 1462, 1987 }, { -1, -1, -1 }, { 1926, 1923, 1872 } },
-    { { 469, 1987, 1442 }, { -1, -1, -1 }, { 1926, 1872, 1885 } },
-    { { 469, 1442, 1993 }, { -1, -1, -1 }, { 1926, 1885, 1884 } },
-    { { 469, 1993, 1464 }, { -1, -1, -1 }, { 1926, 1884, 1927 } },
-    { { 469, 1464, 1975 }, { -1, -1, -1 }, { 1926, 1927, 1839 } },
-    { { 469, 1975, 1424 }, { -1, -1, -1 }, { 1926, 1839, 1845 } },
-    { { 469, 1424, 1977 }, { -1, -1, -1 }, { 1926, 1845, 1847 } },
-    { { 469, 1977, 1462 }, { -1, -1, -1 }, { 1926, 1847, 1923 } },
-    { { 470, 1417, 1972 }, { -1, -1, -1 }, { 1928, 1834, 1827 } },
-    { { 470, 1972, 1465 }, { -1, -1, -1 }, { 1928, 1827, 1929 } },
-    { { 470, 1465, 1994 }, { -1, -1, -1 }, { 1928, 1929, 1891 } },
-    { { 470, 1994, 1445 }, { -1, -1, -1 }, { 1928, 1891, 1890 } },
-    { { 470, 1445, 1992 }, { -1, -1, -1 }, { 1928, 1890, 1879 } },
-    { { 470, 1992, 1463 }, { -1, -1, -1 }, { 1928, 1879, 1925 } },
-    { { 470, 1463, 1974 }, { -1, -1, -1 }, { 1928, 1925, 1835 } },
-    { { 470, 1974, 1417 }, { -1, -1, -1 }, { 1928, 1835, 1834 } },
-    { { 471, 1464, 1993 }, { -1, -1, -1 }, { 1930, 1927, 1884 } },
-    { { 471, 1993, 1448 }, { -1, -1, -1 }, { 1930, 1884, 1897 } },
-    { { 471, 1448, 1995 }, { -1, -1, -1 }, { 1930, 1897, 1896 } },
-    { { 471, 1995, 1466 }, { -1, -1, -1 }, { 1930, 1896, 1931 } },
-    { { 471, 1466, 1973 }, { -1, -1, -1 }, { 1930, 1931, 1831 } },
-    { { 471, 1973, 1420 }, { -1, -1, -1 }, { 1930, 1831, 1837 } },
-    { { 471, 1420, 1975 }, { -1, -1, -1 }, { 1930, 1837, 1839 } },
-    { { 471, 1975, 1464 }, { -1, -1, -1 }, { 1930, 1839, 1927 } },
-    { { 472, 1413, 1970 }, { -1, -1, -1 }, { 1932, 1826, 1819 } },
-    { { 472, 1970, 1467 }, { -1, -1, -1 }, { 1932, 1819, 1933 } },
-    { { 472, 1467, 1996 }, { -1, -1, -1 }, { 1932, 1933, 1893 } },
-    { { 472, 1996, 1446 }, { -1, -1, -1 }, { 1932, 1893, 1892 } },
-    { { 472, 1446, 1994 }, { -1, -1, -1 }, { 1932, 1892, 1891 } },
-    { { 472, 1994, 1465 }, { -1, -1, -1 }, { 1932, 1891, 1929 } },
-    { { 472, 1465, 1972 }, { -1, -1, -1 }, { 1932, 1929, 1827 } },
-    { { 472, 1972, 1413 }, { -1, -1, -1 }, { 1932, 1827, 1826 } },
-    { { 473, 1466, 1995 }, { -1, -1, -1 }, { 1934, 1931, 1896 } },
-    { { 473, 1995, 1450 }, { -1, -1, -1 }, { 1934, 1896, 1895 } },
-    { { 473, 1450, 1997 }, { -1, -1, -1 }, { 1934, 1895, 1899 } },
-    { { 473, 1997, 1468 }, { -1, -1, -1 }, { 1934, 1899, 1935 } },
-    { { 473, 1468, 1971 }, { -1, -1, -1 }, { 1934, 1935, 1823 } },
-    { { 473, 1971, 1416 }, { -1, -1, -1 }, { 1934, 1823, 1829 } },
-    { { 473, 1416, 1973 }, { -1, -1, -1 }, { 1934, 1829, 1831 } },
-    { { 473, 1973, 1466 }, { -1, -1, -1 }, { 1934, 1831, 1931 } },
-    { { 474, 1409, 1968 }, { -1, -1, -1 }, { 1936, 1818, 1811 } },
-    { { 474, 1968, 1452 }, { -1, -1, -1 }, { 1936, 1811, 1901 } },
-    { { 474, 1452, 1996 }, { -1, -1, -1 }, { 1936, 1901, 1893 } },
-    { { 474, 1996, 1467 }, { -1, -1, -1 }, { 1936, 1893, 1933 } },
-    { { 474, 1467, 1970 }, { -1, -1, -1 }, { 1936, 1933, 1819 } },
-    { { 474, 1970, 1409 }, { -1, -1, -1 }, { 1936, 1819, 1818 } },
-    { { 475, 1412, 1971 }, { -1, -1, -1 }, { 1937, 1821, 1823 } },
-    { { 475, 1971, 1468 }, { -1, -1, -1 }, { 1937, 1823, 1935 } },
-    { { 475, 1468, 1997 }, { -1, -1, -1 }, { 1937, 1935, 1899 } },
-    { { 475, 1997, 1454 }, { -1, -1, -1 }, { 1937, 1899, 1905 } },
-    { { 475, 1454, 1969 }, { -1, -1, -1 }, { 1937, 1905, 1815 } },
-    { { 475, 1969, 1412 }, { -1, -1, -1 }, { 1937, 1815, 1821 } },
-    { { 476, 1471, 1896 }, { -1, -1, -1 }, { 1938, 1939, 1577 } },
-    { { 476, 1896, 1293 }, { -1, -1, -1 }, { 1938, 1577, 1585 } },
-    { { 476, 1293, 1894 }, { -1, -1, -1 }, { 1938, 1585, 1589 } },
-    { { 476, 1894, 1469 }, { -1, -1, -1 }, { 1938, 1589, 1940 } },
-    { { 476, 1469, 2008 }, { -1, -1, -1 }, { 1938, 1940, 1941 } },
-    { { 476, 2008, 1470 }, { -1, -1, -1 }, { 1938, 1941, 1942 } },
-    { { 476, 1470, 2006 }, { -1, -1, -1 }, { 1938, 1942, 1943 } },
-    { { 476, 2006, 1471 }, { -1, -1, -1 }, { 1938, 1943, 1939 } },
-    { { 477, 1474, 2009 }, { -1, -1, -1 }, { 1944, 1945, 1946 } },
-    { { 477, 2009, 1472 }, { -1, -1, -1 }, { 1944, 1946, 1947 } },
-    { { 477, 1472, 1895 }, { -1, -1, -1 }, { 1944, 1947, 1595 } },
-    { { 477, 1895, 1295 }, { -1, -1, -1 }, { 1944, 1595, 1594 } },
-    { { 477, 1295, 1897 }, { -1, -1, -1 }, { 1944, 1594, 1583 } },
-    { { 477, 1897, 1473 }, { -1, -1, -1 }, { 1944, 1583, 1948 } },
-    { { 477, 1473, 2007 }, { -1, -1, -1 }, { 1944, 1948, 1949 } },
-    { { 477, 2007, 1474 }, { -1, -1, -1 }, { 1944, 1949, 1945 } },
-    { { 478, 1476, 1898 }, { -1, -1, -1 }, { 1950, 1951, 1565 } },
-    { { 478, 1898, 1287 }, { -1, -1, -1 }, { 1950, 1565, 1573 } },
-    { { 478, 1287, 1896 }, { -1, -1, -1 }, { 1950, 1573, 1577 } },
-    { { 478, 1896, 1471 }, { -1, -1, -1 }, { 1950, 1577, 1939 } },
-    { { 478, 1471, 2006 }, { -1, -1, -1 }, { 1950, 1939, 1943 } },
-    { { 478, 2006, 1475 }, { -1, -1, -1 }, { 1950, 1943, 1952 } },
-    { { 478, 1475, 2004 }, { -1, -1, -1 }, { 1950, 1952, 1953 } },
-    { { 478, 2004, 1476 }, { -1, -1, -1 }, { 1950, 1953, 1951 } },
-    { { 479, 1478, 2007 }, { -1, -1, -1 }, { 1954, 1955, 1949 } },
-    { { 479, 2007, 1473 }, { -1, -1, -1 }, { 1954, 1949, 1948 } },
-    { { 479, 1473, 1897 }, { -1, -1, -1 }, { 1954, 1948, 1583 } },
-    { { 479, 1897, 1289 }, { -1, -1, -1 }, { 1954, 1583, 1582 } },
-    { { 479, 1289, 1899 }, { -1, -1, -1 }, { 1954, 1582, 1571 } },
-    { { 479, 1899, 1477 }, { -1, -1, -1 }, { 1954, 1571, 1956 } },
-    { { 479, 1477, 2005 }, { -1, -1, -1 }, { 1954, 1956, 1957 } },
-    { { 479, 2005, 1478 }, { -1, -1, -1 }, { 1954, 1957, 1955 } },
-    { { 480, 1480, 1900 }, { -1, -1, -1 }, { 1958, 1959, 1553 } },
-    { { 480, 1900, 1281 }, { -1, -1, -1 }, { 1958, 1553, 1561 } },
-    { { 480, 1281, 1898 }, { -1, -1, -1 }, { 1958, 1561, 1565 } },
-    { { 480, 1898, 1476 }, { -1, -1, -1 }, { 1958, 1565, 1951 } },
-    { { 480, 1476, 2004 }, { -1, -1, -1 }, { 1958, 1951, 1953 } },
-    { { 480, 2004, 1479 }, { -1, -1, -1 }, { 1958, 1953, 1960 } },
-    { { 480, 1479, 2002 }, { -1, -1, -1 }, { 1958, 1960, 1961 } },
-    { { 480, 2002, 1480 }, { -1, -1, -1 }, { 1958, 1961, 1959 } },
-    { { 481, 1482, 2005 }, { -1, -1, -1 }, { 1962, 1963, 1957 } },
-    { { 481, 2005, 1477 }, { -1, -1, -1 }, { 1962, 1957, 1956 } },
-    { { 481, 1477, 1899 }, { -1, -1, -1 }, { 1962, 1956, 1571 } },
-    { { 481, 1899, 1283 }, { -1, -1, -1 }, { 1962, 1571, 1570 } },
-    { { 481, 1283, 1901 }, { -1, -1, -1 }, { 1962, 1570, 1559 } },
-    { { 481, 1901, 1481 }, { -1, -1, -1 }, { 1962, 1559, 1964 } },
-    { { 481, 1481, 2003 }, { -1, -1, -1 }, { 1962, 1964, 1965 } },
-    { { 481, 2003, 1482 }, { -1, -1, -1 }, { 1962, 1965, 1963 } },
-    { { 482, 1484, 1902 }, { -1, -1, -1 }, { 1966, 1967, 1541 } },
-    { { 482, 1902, 1275 }, { -1, -1, -1 }, { 1966, 1541, 1549 } },
-    { { 482, 1275, 1900 }, { -1, -1, -1 }, { 1966, 1549, 1553 } },
-    { { 482, 1900, 1480 }, { -1, -1, -1 }, { 1966, 1553, 1959 } },
-    { { 482, 1480, 2002 }, { -1, -1, -1 }, { 1966, 1959, 1961 } },
-    { { 482, 2002, 1483 }, { -1, -1, -1 }, { 1966, 1961, 1968 } },
-    { { 482, 1483, 2000 }, { -1, -1, -1 }, { 1966, 1968, 1969 } },
-    { { 482, 2000, 1484 }, { -1, -1, -1 }, { 1966, 1969, 1967 } },
-    { { 483, 1486, 2003 }, { -1, -1, -1 }, { 1970, 1971, 1965 } },
-    { { 483, 2003, 1481 }, { -1, -1, -1 }, { 1970, 1965, 1964 } },
-    { { 483, 1481, 1901 }, { -1, -1, -1 }, { 1970, 1964, 1559 } },
-    { { 483, 1901, 1277 }, { -1, -1, -1 }, { 1970, 1559, 1558 } },
-    { { 483, 1277, 1903 }, { -1, -1, -1 }, { 1970, 1558, 1547 } },
-    { { 483, 1903, 1485 }, { -1, -1, -1 }, { 1970, 1547, 1972 } },
-    { { 483, 1485, 2001 }, { -1, -1, -1 }, { 1970, 1972, 1973 } },
-    { { 483, 2001, 1486 }, { -1, -1, -1 }, { 1970, 1973, 1971 } },
-    { { 484, 1488, 1904 }, { -1, -1, -1 }, { 1974, 1975, 1520 } },
-    { { 484, 1904, 1269 }, { -1, -1, -1 }, { 1974, 1520, 1537 } },
-    { { 484, 1269, 1902 }, { -1, -1, -1 }, { 1974, 1537, 1541 } },
-    { { 484, 1902, 1484 }, { -1, -1, -1 }, { 1974, 1541, 1967 } },
-    { { 484, 1484, 2000 }, { -1, -1, -1 }, { 1974, 1967, 1969 } },
-    { { 484, 2000, 1487 }, { -1, -1, -1 }, { 1974, 1969, 1976 } },
-    { { 484, 1487, 1998 }, { -1, -1, -1 }, { 1974, 1976, 1977 } },
-    { { 484, 1998, 1488 }, { -1, -1, -1 }, { 1974, 1977, 1975 } },
-    { { 485, 1490, 2001 }, { -1, -1, -1 }, { 1978, 1979, 1973 } },
-    { { 485, 2001, 1485 }, { -1, -1, -1 }, { 1978, 1973, 1972 } },
-    { { 485, 1485, 1903 }, { -1, -1, -1 }, { 1978, 1972, 1547 } },
-    { { 485, 1903, 1271 }, { -1, -1, -1 }, { 1978, 1547, 1546 } },
-    { { 485, 1271, 1905 }, { -1, -1, -1 }, { 1978, 1546, 1533 } },
-    { { 485, 1905, 1489 }, { -1, -1, -1 }, { 1978, 1533, 1980 } },
-    { { 485, 1489, 1999 }, { -1, -1, -1 }, { 1978, 1980, 1981 } },
-    { { 485, 1999, 1490 }, { -1, -1, -1 }, { 1978, 1981, 1979 } },
-    { { 486, 1492, 1892 }, { -1, -1, -1 }, { 1982, 1983, 1522 } },
-    { { 486, 1892, 1259 }, { -1, -1, -1 }, { 1982, 1522, 1521 } },
-    { { 486, 1259, 1904 }, { -1, -1, -1 }, { 1982, 1521, 1520 } },
-    { { 486, 1904, 1488 }, { -1, -1, -1 }, { 1982, 1520, 1975 } },
-    { { 486, 1488, 1998 }, { -1, -1, -1 }, { 1982, 1975, 1977 } },
-    { { 486, 1998, 1491 }, { -1, -1, -1 }, { 1982, 1977, 1984 } },
-    { { 486, 1491, 2010 }, { -1, -1, -1 }, { 1982, 1984, 1985 } },
-    { { 486, 2010, 1492 }, { -1, -1, -1 }, { 1982, 1985, 1983 } },
-    { { 487, 1494, 1999 }, { -1, -1, -1 }, { 1986, 1987, 1981 } },
-    { { 487, 1999, 1489 }, { -1, -1, -1 }, { 1986, 1981, 1980 } },
-    { { 487, 1489, 1905 }, { -1, -1, -1 }, { 1986, 1980, 1533 } },
-    { { 487, 1905, 1264 }, { -1, -1, -1 }, { 1986, 1533, 1532 } },
-    { { 487, 1264, 1893 }, { -1, -1, -1 }, { 1986, 1532, 1531 } },
-    { { 487, 1893, 1493 }, { -1, -1, -1 }, { 1986, 1531, 1988 } },
-    { { 487, 1493, 2011 }, { -1, -1, -1 }, { 1986, 1988, 1989 } },
-    { { 487, 2011, 1494 }, { -1, -1, -1 }, { 1986, 1989, 1987 } },
-    { { 488, 1491, 1998 }, { -1, -1, -1 }, { 1990, 1984, 1977 } },
-    { { 488, 1998, 1495 }, { -1, -1, -1 }, { 1990, 1977, 1991 } },
-    { { 488, 1495, 2006 }, { -1, -1, -1 }, { 1990, 1991, 1943 } },
-    { { 488, 2006, 1470 }, { -1, -1, -1 }, { 1990, 1943, 1942 } },
-    { { 488, 1470, 2008 }, { -1, -1, -1 }, { 1990, 1942, 1941 } },
-    { { 488, 2008, 1496 }, { -1, -1, -1 }, { 1990, 1941, 1992 } },
-    { { 488, 1496, 2010 }, { -1, -1, -1 }, { 1990, 1992, 1985 } },
-    { { 488, 2010, 1491 }, { -1, -1, -1 }, { 1990, 1985, 1984 } },
-    { { 489, 1498, 2009 }, { -1, -1, -1 }, { 1993, 1994, 1946 } },
-    { { 489, 2009, 1474 }, { -1, -1, -1 }, { 1993, 1946, 1945 } },
-    { { 489, 1474, 2007 }, { -1, -1, -1 }, { 1993, 1945, 1949 } },
-    { { 489, 2007, 1497 }, { -1, -1, -1 }, { 1993, 1949, 1995 } },
-    { { 489, 1497, 1999 }, { -1, -1, -1 }, { 1993, 1995, 1981 } },
-    { { 489, 1999, 1494 }, { -1, -1, -1 }, { 1993, 1981, 1987 } },
-    { { 489, 1494, 2011 }, { -1, -1, -1 }, { 1993, 1987, 1989 } },
-    { { 489, 2011, 1498 }, { -1, -1, -1 }, { 1993, 1989, 1994 } },
-    { { 490, 1495, 1998 }, { -1, -1, -1 }, { 1996, 1991, 1977 } },
-    { { 490, 1998, 1487 }, { -1, -1, -1 }, { 1996, 1977, 1976 } },
-    { { 490, 1487, 2000 }, { -1, -1, -1 }, { 1996, 1976, 1969 } },
-    { { 490, 2000, 1499 }, { -1, -1, -1 }, { 1996, 1969, 1997 } },
-    { { 490, 1499, 2004 }, { -1, -1, -1 }, { 1996, 1997, 1953 } },
-    { { 490, 2004, 1475 }, { -1, -1, -1 }, { 1996, 1953, 1952 } },
-    { { 490, 1475, 2006 }, { -1, -1, -1 }, { 1996, 1952, 1943 } },
-    { { 490, 2006, 1495 }, { -1, -1, -1 }, { 1996, 1943, 1991 } },
-    { { 491, 1478, 2005 }, { -1, -1, -1 }, { 1998, 1955, 1957 } },
-    { { 491, 2005, 1500 }, { -1, -1, -1 }, { 1998, 1957, 1999 } },
-    { { 491, 1500, 2001 }, { -1, -1, -1 }, { 1998, 1999, 1973 } },
-    { { 491, 2001, 1490 }, { -1, -1, -1 }, { 1998, 1973, 1979 } },
-    { { 491, 1490, 1999 }, { -1, -1, -1 }, { 1998, 1979, 1981 } },
-    { { 491, 1999, 1497 }, { -1, -1, -1 }, { 1998, 1981, 1995 } },
-    { { 491, 1497, 2007 }, { -1, -1, -1 }, { 1998, 1995, 1949 } },
-    { { 491, 2007, 1478 }, { -1, -1, -1 }, { 1998, 1949, 1955 } },
-    { { 492, 1499, 2000 }, { -1, -1, -1 }, { 2000, 1997, 1969 } },
-    { { 492, 2000, 1483 }, { -1, -1, -1 }, { 2000, 1969, 1968 } },
-    { { 492, 1483, 2002 }, { -1, -1, -1 }, { 2000, 1968, 1961 } },
-    { { 492, 2002, 1479 }, { -1, -1, -1 }, { 2000, 1961, 1960 } },
-    { { 492, 1479, 2004 }, { -1, -1, -1 }, { 2000, 1960, 1953 } },
-    { { 492, 2004, 1499 }, { -1, -1, -1 }, { 2000, 1953, 1997 } },
-    { { 493, 1500, 2005 }, { -1, -1, -1 }, { 2001, 1999, 1957 } },
-    { { 493, 2005, 1482 }, { -1, -1, -1 }, { 2001, 1957, 1963 } },
-    { { 493, 1482, 2003 }, { -1, -1, -1 }, { 2001, 1963, 1965 } },
-    { { 493, 2003, 1486 }, { -1, -1, -1 }, { 2001, 1965, 1971 } },
-    { { 493, 1486, 2001 }, { -1, -1, -1 }, { 2001, 1971, 1973 } },
-    { { 493, 2001, 1500 }, { -1, -1, -1 }, { 2001, 1973, 1999 } },
-    { { 494, 1501, 1818 }, { -1, -1, -1 }, { 2002, 2003, 1377 } },
-    { { 494, 1818, 1225 }, { -1, -1, -1 }, { 2002, 1377, 1451 } },
-    { { 494, 1225, 1886 }, { -1, -1, -1 }, { 2002, 1451, 1444 } },
-    { { 494, 1886, 1337 }, { -1, -1, -1 }, { 2002, 1444, 1671 } },
-    { { 494, 1337, 1892 }, { -1, -1, -1 }, { 2002, 1671, 1522 } },
-    { { 494, 1892, 1492 }, { -1, -1, -1 }, { 2002, 1522, 1983 } },
-    { { 494, 1492, 2010 }, { -1, -1, -1 }, { 2002, 1983, 1985 } },
-    { { 494, 2010, 1501 }, { -1, -1, -1 }, { 2002, 1985, 2003 } },
-    { { 495, 1493, 1893 }, { -1, -1, -1 }, { 2004, 1988, 1531 } },
-    { { 495, 1893, 1340 }, { -1, -1, -1 }, { 2004, 1531, 1679 } },
-    { { 495, 1340, 1887 }, { -1, -1, -1 }, { 2004, 1679, 1448 } },
-    { { 495, 1887, 1226 }, { -1, -1, -1 }, { 2004, 1448, 1453 } },
-    { { 495, 1226, 1819 }, { -1, -1, -1 }, { 2004, 1453, 1385 } },
-    { { 495, 1819, 1502 }, { -1, -1, -1 }, { 2004, 1385, 2005 } },
-    { { 495, 1502, 2011 }, { -1, -1, -1 }, { 2004, 2005, 1989 } },
-    { { 495, 2011, 1493 }, { -1, -1, -1 }, { 2004, 1989, 1988 } },
-    { { 496, 1245, 1818 }, { -1, -1, -1 }, { 2006, 1491, 1377 } },
-    { { 496, 1818, 1501 }, { -1, -1, -1 }, { 2006, 1377, 2003 } },
-    { { 496, 1501, 2010 }, { -1, -1, -1 }, { 2006, 2003, 1985 } },
-    { { 496, 2010, 1496 }, { -1, -1, -1 }, { 2006, 1985, 1992 } },
-    { { 496, 1496, 2008 }, { -1, -1, -1 }, { 2006, 1992, 1941 } },
-    { { 496, 2008, 1503 }, { -1, -1, -1 }, { 2006, 1941, 2007 } },
-    { { 496, 1503, 1826 }, { -1, -1, -1 }, { 2006, 2007, 1492 } },
-    { { 496, 1826, 1245 }, { -1, -1, -1 }, { 2006, 1492, 1491 } },
-    { { 497, 1504, 2009 }, { -1, -1, -1 }, { 2008, 2009, 1946 } },
-    { { 497, 2009, 1498 }, { -1, -1, -1 }, { 2008, 1946, 1994 } },
-    { { 497, 1498, 2011 }, { -1, -1, -1 }, { 2008, 1994, 1989 } },
-    { { 497, 2011, 1502 }, { -1, -1, -1 }, { 2008, 1989, 2005 } },
-    { { 497, 1502, 1819 }, { -1, -1, -1 }, { 2008, 2005, 1385 } },
-    { { 497, 1819, 1249 }, { -1, -1, -1 }, { 2008, 1385, 1501 } },
-    { { 497, 1249, 1827 }, { -1, -1, -1 }, { 2008, 1501, 1500 } },
-    { { 497, 1827, 1504 }, { -1, -1, -1 }, { 2008, 1500, 2009 } },
-    { { 498, 1329, 1824 }, { -1, -1, -1 }, { 2010, 1661, 1470 } },
-    { { 498, 1824, 1254 }, { -1, -1, -1 }, { 2010, 1470, 1507 } },
-    { { 498, 1254, 1826 }, { -1, -1, -1 }, { 2010, 1507, 1492 } },
-    { { 498, 1826, 1503 }, { -1, -1, -1 }, { 2010, 1492, 2007 } },
-    { { 498, 1503, 2008 }, { -1, -1, -1 }, { 2010, 2007, 1941 } },
-    { { 498, 2008, 1469 }, { -1, -1, -1 }, { 2010, 1941, 1940 } },
-    { { 498, 1469, 1894 }, { -1, -1, -1 }, { 2010, 1940, 1589 } },
-    { { 498, 1894, 1329 }, { -1, -1, -1 }, { 2010, 1589, 1661 } },
-    { { 499, 1472, 2009 }, { -1, -1, -1 }, { 2011, 1947, 1946 } },
-    { { 499, 2009, 1504 }, { -1, -1, -1 }, { 2011, 1946, 2009 } },
-    { { 499, 1504, 1827 }, { -1, -1, -1 }, { 2011, 2009, 1500 } },
-    { { 499, 1827, 1256 }, { -1, -1, -1 }, { 2011, 1500, 1511 } },
-    { { 499, 1256, 1825 }, { -1, -1, -1 }, { 2011, 1511, 1475 } },
-    { { 499, 1825, 1331 }, { -1, -1, -1 }, { 2011, 1475, 1665 } },
-    { { 499, 1331, 1895 }, { -1, -1, -1 }, { 2011, 1665, 1595 } },
-    { { 499, 1895, 1472 }, { -1, -1, -1 }, { 2011, 1595, 1947 } },
-};
-
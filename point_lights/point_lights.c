@@ -4,6 +4,14 @@
  * - shading implemented only using vertex color interpolation
  * - point lights
  * - fast vertex transformations using the matrix asm macros
+ * - shadows from the first light with modifier volumes, built from the
+ *   edge adjacency obj2h --edges precomputes
+ *
+ * the Makefile generates monkey.h from monkey.obj with
+ *
+ * ```sh
+ * obj2h --edges monkey.obj > monkey.h
+ * ```
  *
  * ![](https://i.imgur.com/vXgC0gR.png)
  *
@@ -13,6 +21,7 @@
  * - b (x in the emulator) to go backwards
  * - x (a in the emulator) to go up
  * - y (s in the emulator) to go down
+ * - start (enter in the emulator) to toggle shadows
  *
  * # license
  * this is free and unencumbered software released into the
@@ -45,6 +54,7 @@ KOS_INIT_ROMDISK(romdisk);
 
 /* I wrote a little tool that converts obj models to headers, see obj2h */
 #include "monkey.h"
+#include "obj2h_shadow.h"
 
 /* --------------------------------------------------------------------- */
 
@@ -69,7 +79,24 @@ void angle_add(float* angle, float amt)
 
 /* --------------------------------------------------------------------- */
 
+/* the modifier volume list needs a bin and room for the volumes */
+static
+pvr_init_params_t pvr_params = {
+    {
+        PVR_BINSIZE_16, PVR_BINSIZE_16, PVR_BINSIZE_16, PVR_BINSIZE_0,
+        PVR_BINSIZE_0
+    },
+    1024 * 1024
+};
+
 static pvr_poly_hdr_t poly;
+static pvr_mod_hdr_t mod, mod_last;
+
+/* how much darker things are inside a shadow volume */
+#define SHADOW_SCALE 0.35f
+
+/* how far shadows reach. short so the volumes stay in front of the camera */
+#define SHADOW_EXTRUDE 2.5f
 
 static
 void init()
@@ -77,7 +104,15 @@ void init()
     pvr_poly_cxt_t cxt;
 
     pvr_poly_cxt_col(&cxt, PVR_LIST_OP_POLY);
+    cxt.fmt.modifier = PVR_MODIFIER_ENABLE;
+    cxt.gen.modifier_mode = PVR_MODIFIER_CHEAP_SHADOW;
     pvr_poly_compile(&poly, &cxt);
+
+    pvr_mod_compile(&mod, PVR_LIST_OP_MOD, PVR_MODIFIER_OTHER_POLY,
+        PVR_CULLING_NONE);
+    pvr_mod_compile(&mod_last, PVR_LIST_OP_MOD,
+        PVR_MODIFIER_INCLUDE_LAST_POLY, PVR_CULLING_NONE);
+    pvr_set_shadow_scale(1, SHADOW_SCALE);
 }
 
 static float ambient = .01f;
@@ -150,6 +185,7 @@ uint32 light(vector_t const* v, vector_t const* n)
 
 static vector_t camera_pos = { -0.5, -0.8f, 1.5f, 1 };
 static vector_t camera_rot = { F_PI/8, F_PI*2-F_PI/6, 0, 1 };
+static int shadows = 1;
 
 #define SENS (F_PI/60.0f)
 #define MOVSPEED (4.0f/60.0f)
@@ -157,6 +193,7 @@ static vector_t camera_rot = { F_PI/8, F_PI*2-F_PI/6, 0, 1 };
 static
 void update()
 {
+    static uint32 prev_buttons = 0;
     maple_device_t* joy;
     cont_state_t* st;
 
@@ -166,6 +203,12 @@ void update()
     st = (cont_state_t*)maple_dev_status(joy);
     if (!st) return;
 
+    if ((st->buttons & CONT_START) && !(prev_buttons & CONT_START)) {
+        shadows = !shadows;
+    }
+
+    prev_buttons = st->buttons;
+
     if (st->buttons & CONT_DPAD_UP   ) angle_sub(&camera_rot.x, SENS);
     if (st->buttons & CONT_DPAD_DOWN ) angle_add(&camera_rot.x, SENS);
     if (st->buttons & CONT_DPAD_RIGHT) angle_sub(&camera_rot.y, SENS);
@@ -207,6 +250,41 @@ static
 vector_t tbuf[ARRAY_LENGTH(monkey_vertices)]
 __attribute__((aligned(32)));
 
+static uint8 lit[ARRAY_LENGTH(monkey_faces)];
+static int silhouette[ARRAY_LENGTH(monkey_edges) * 2];
+
+/* shadow volume triangles, built in model space and transformed */
+static
+vector_t volume[OBJ2H_SHADOW_MAX_VERTICES(ARRAY_LENGTH(monkey_faces),
+    ARRAY_LENGTH(monkey_edges))]
+__attribute__((aligned(32)));
+
+/*
+ * the model sits at the origin unrotated, so lights are already in model
+ * space. the adjacency makes finding the silhouette a pass over the
+ * faces and one over the edges
+ */
+static
+size_t build_shadow(light_t const* l)
+{
+    vector_t pos = l->pos;
+    size_t n;
+
+    pos.w = 1;
+
+    obj2h_shadow_facing(monkey_planes, ARRAY_LENGTH(monkey_faces), &pos,
+        lit);
+    n = obj2h_shadow_silhouette(monkey_edges, ARRAY_LENGTH(monkey_edges),
+        lit, silhouette);
+    n = obj2h_shadow_volume(monkey_vertices, monkey_faces,
+        ARRAY_LENGTH(monkey_faces), lit, silhouette, n, &pos,
+        SHADOW_EXTRUDE, volume);
+
+    mat_transform(volume, volume, (int)(n * 3), sizeof(vector_t));
+
+    return n;
+}
+
 static
 void draw()
 {
@@ -216,6 +294,7 @@ void draw()
     vector_t* v; /* current vertex */
     vector_t* t; /* transformed vertex */
     vector_t* n; /* current normal */
+    size_t nshadow = 0; /* shadow volume triangles */
 
     mat_identity();
     mat_perspective(320, 240, 1, 1, 100);
@@ -224,6 +303,10 @@ void draw()
     mat_transform(monkey_vertices, tbuf, ARRAY_LENGTH(tbuf),
         sizeof(vector_t));
 
+    if (shadows) {
+        nshadow = build_shadow(&lights[0]);
+    }
+
     /* TODO: transform into the store queues */
 
     pvr_wait_ready();
@@ -256,6 +339,14 @@ void draw()
     }
 
     pvr_list_finish();
+
+    if (nshadow)
+    {
+        pvr_list_begin(PVR_LIST_OP_MOD);
+        obj2h_shadow_submit(&mod, &mod_last, volume, nshadow);
+        pvr_list_finish();
+    }
+
     pvr_scene_finish();
 }
 
@@ -263,7 +354,7 @@ int main()
 {
     puts(VERSION_STR);
 
-    pvr_init_defaults();
+    pvr_init(&pvr_params);
     init();
 
     while (1)
@@ -0,0 +1,276 @@
+/*
+ * this dreamcast demo showcases
+ * - meshes lit offline, with the light baked into per-vertex colors
+ * - drawing them with no lighting math at runtime
+ * - pre-baked vertex streams from obj2h --pvr carrying those colors
+ * - the same strips drawn by code obj2h --draw generated for this model
+ *
+ * monkey.obj was lit in a dcc tool (a warm key light, a cool fill and
+ * a bit of sky) and exported with `v x y z r g b` vertices. obj2h keeps
+ * the colors as ARGB8888 words in monkey_colors and bakes them into the
+ * stream. the Makefile generates monkey.h from monkey.obj with
+ *
+ * ```sh
+ * obj2h --incbin --cache --strips --pvr --draw monkey.obj > monkey.h
+ * ```
+ *
+ * --incbin puts the vertices, normals, faces and colors in monkey.bin,
+ * which monkey.S pulls in, so only the strips, the stream and
+ * monkey_draw are left for the compiler to parse.
+ *
+ * the four ways of drawing it can be switched between:
+ * - faces lit at runtime by a directional light, the way the other
+ *   demos do it, for comparison
+ * - strips that copy their color from monkey_colors, no lighting
+ * - monkey_draw, the same strips with the loop unrolled at build time
+ * - the pre-baked stream, transformed in place and sent to the ta in
+ *   one go
+ *
+ * # controls
+ * - d-pad (arrow keys in the emulator) to rotate the model
+ * - a (z in the emulator) to zoom in
+ * - b (x in the emulator) to zoom out
+ * - x (a in the emulator) to switch how the model is drawn
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#include <kos.h>
+
+KOS_INIT_FLAGS(INIT_DEFAULT);
+
+/* assets -------------------------------------------------------------- */
+
+#include "monkey.h"
+#include "obj2h_pvr.h"
+
+/* --------------------------------------------------------------------- */
+
+#define ARRAY_LENGTH(a) (sizeof(a) / sizeof((a)[0]))
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#define CLAMP(x, a, b) MAX(a, MIN(x, b))
+
+static
+void angle_sub(float* angle, float amt)
+{
+    *angle -= amt;
+    while (*angle < 0) *angle += F_PI*2;
+}
+
+static
+void angle_add(float* angle, float amt)
+{
+    *angle += amt;
+    while (*angle > F_PI*2) *angle -= F_PI*2;
+}
+
+/* --------------------------------------------------------------------- */
+
+enum
+{
+    DRAW_FACES_LIT, DRAW_STRIPS_COLORS, DRAW_UNROLLED, DRAW_STREAM,
+    NDRAW_MODES
+};
+
+static pvr_poly_hdr_t poly;
+
+static vector_t t[ARRAY_LENGTH(monkey_vertices)];
+static pvr_vertex_t stream[ARRAY_LENGTH(monkey_pvr.vertices) + 1]
+__attribute__((aligned(32)));
+
+/* roughly the key light of the bake */
+static vector_t light_dir = { 0.3f, -0.8f, 0.5f, 0 };
+static float ambient = .01f;
+
+static int mode = DRAW_STREAM;
+static vector_t model_rot = { 0, 0, 0, 1 };
+static float distance = 3;
+
+static
+void init()
+{
+    pvr_poly_cxt_t cxt;
+    float len;
+
+    pvr_poly_cxt_col(&cxt, PVR_LIST_OP_POLY);
+    pvr_poly_compile(&poly, &cxt);
+    pvr_poly_compile(&monkey_pvr.hdr, &cxt);
+
+    vec3f_length(light_dir.x, light_dir.y, light_dir.z, len);
+    light_dir.x /= len;
+    light_dir.y /= len;
+    light_dir.z /= len;
+}
+
+#define SENS (F_PI/60.0f)
+#define MOVSPEED (4.0f/60.0f)
+
+static
+void update()
+{
+    static uint32 prev_buttons = 0;
+    maple_device_t* joy;
+    cont_state_t* st;
+
+    joy = maple_enum_type(0, MAPLE_FUNC_CONTROLLER);
+    if (!joy) return;
+
+    st = (cont_state_t*)maple_dev_status(joy);
+    if (!st) return;
+
+    if ((st->buttons & CONT_X) && !(prev_buttons & CONT_X)) {
+        mode = (mode + 1) % NDRAW_MODES;
+    }
+
+    prev_buttons = st->buttons;
+
+    if (st->buttons & CONT_DPAD_UP   ) angle_sub(&model_rot.x, SENS);
+    if (st->buttons & CONT_DPAD_DOWN ) angle_add(&model_rot.x, SENS);
+    if (st->buttons & CONT_DPAD_RIGHT) angle_sub(&model_rot.y, SENS);
+    if (st->buttons & CONT_DPAD_LEFT ) angle_add(&model_rot.y, SENS);
+
+    if (st->buttons & CONT_A) distance -= MOVSPEED;
+    if (st->buttons & CONT_B) distance += MOVSPEED;
+    distance = CLAMP(distance, 1.5f, 20);
+}
+
+/* what the baked colors save: a dot product and a clamp per corner */
+static
+uint32 light_argb(int normal_index)
+{
+    vector_t const* n = &monkey_normals[normal_index];
+    float light;
+
+    vec3f_dot(light_dir.x, light_dir.y, light_dir.z, n->x, n->y, n->z,
+        light);
+    light = CLAMP(light, 0, 1);
+    light = ambient + light * (1 - ambient);
+
+    return 0xFF000000 | 0x00010101 * (uint32)(light * 255);
+}
+
+/* the classic way, every corner of every face lit on the fly */
+static
+void draw_faces_lit()
+{
+    size_t i, j;
+    pvr_vertex_t pv;
+
+    pvr_prim(&poly, sizeof(poly));
+    pv.u = pv.v = 0;
+    pv.oargb = 0;
+
+    for (i = 0; i < ARRAY_LENGTH(monkey_faces); ++i)
+    {
+        face_t const* f = &monkey_faces[i];
+
+        for (j = 0; j < 3; ++j)
+        {
+            vector_t const* v = &t[f->vertex_indices[2-j]];
+
+            pv.x = v->x;
+            pv.y = v->y;
+            pv.z = v->z;
+            pv.argb = light_argb(f->normal_indices[2-j]);
+            pv.flags = j == 2 ? PVR_CMD_VERTEX_EOL : PVR_CMD_VERTEX;
+            pvr_prim(&pv, sizeof(pv));
+        }
+    }
+}
+
+/* strips, the color is just another vertex attribute */
+static
+void draw_strips_colors()
+{
+    size_t i;
+    pvr_vertex_t pv;
+
+    pvr_prim(&poly, sizeof(poly));
+    pv.u = pv.v = 0;
+    pv.oargb = 0;
+
+    for (i = 0; i < ARRAY_LENGTH(monkey_strips); ++i)
+    {
+        corner_t const* c = &monkey_strips[i];
+        vector_t const* v;
+
+        if (c->vertex_index < 0) continue;
+
+        v = &t[c->vertex_index];
+        pv.x = v->x;
+        pv.y = v->y;
+        pv.z = v->z;
+        pv.argb = monkey_colors[c->vertex_index];
+        pv.flags = c[1].vertex_index < 0 ? PVR_CMD_VERTEX_EOL :
+            PVR_CMD_VERTEX;
+        pvr_prim(&pv, sizeof(pv));
+    }
+}
+
+static
+void draw()
+{
+    mat_identity();
+    mat_perspective(320, 240, 1, 1, 100);
+    mat_translate(0, 0, -distance);
+    mat_rotate(model_rot.x, model_rot.y, model_rot.z);
+
+    if (mode == DRAW_STREAM)
+    {
+        obj2h_pvr_transform(&monkey_pvr, stream,
+            ARRAY_LENGTH(monkey_pvr.vertices));
+    }
+
+    else
+    {
+        mat_transform(monkey_vertices, t, ARRAY_LENGTH(t),
+            sizeof(vector_t));
+    }
+
+    pvr_wait_ready();
+    pvr_scene_begin();
+    pvr_list_begin(PVR_LIST_OP_POLY);
+
+    switch (mode)
+    {
+    case DRAW_FACES_LIT:
+        draw_faces_lit();
+        break;
+
+    case DRAW_STRIPS_COLORS:
+        draw_strips_colors();
+        break;
+
+    /* what draw_strips_colors does, minus the loop */
+    case DRAW_UNROLLED:
+        pvr_prim(&poly, sizeof(poly));
+        monkey_draw(t);
+        break;
+
+    default:
+        obj2h_pvr_submit(stream, ARRAY_LENGTH(monkey_pvr.vertices));
+        break;
+    }
+
+    pvr_list_finish();
+    pvr_scene_finish();
+}
+
+int main()
+{
+    pvr_init_defaults();
+    init();
+
+    while (1)
+    {
+        update();
+        draw();
+    }
+
+    return 0;
+}
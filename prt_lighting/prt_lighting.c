@@ -0,0 +1,260 @@
+/*
+ * this dreamcast demo showcases
+ * - precomputed radiance transfer: soft, self-shadowed lighting of a
+ *   static mesh under lights that move
+ * - lighting every vertex with three 9-term dot products, however many
+ *   lights there are
+ *
+ * obj2h shot 256 rays from every vertex of monkey.obj and baked what
+ * they saw into 9 spherical harmonic coefficients per vertex. every
+ * frame the lights are projected onto the same 9 functions once, and a
+ * vertex's color is the dot product of the two per channel. the eyes
+ * and ears shadow the head, and the creases are darker under the sky.
+ * the Makefile generates monkey.h from monkey.obj with
+ *
+ * ```sh
+ * obj2h --incbin --cache --strips --prt 256 monkey.obj > monkey.h
+ * ```
+ *
+ * the mesh itself comes from monkey.bin through monkey.S, so the
+ * compiler only parses the strips and the coefficients
+ *
+ * the same lights can be switched to the usual per-light loop (like
+ * light() in point_lights), which has no shadows and costs more as
+ * lights are added
+ *
+ * # controls
+ * - d-pad (arrow keys in the emulator) to move the key light around
+ * - a (z in the emulator) to zoom in
+ * - b (x in the emulator) to zoom out
+ * - x (a in the emulator) to switch between prt and per-light lighting
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#include <kos.h>
+
+KOS_INIT_FLAGS(INIT_DEFAULT);
+
+/* assets -------------------------------------------------------------- */
+
+#include "monkey.h"
+#include "obj2h_prt.h"
+
+/* --------------------------------------------------------------------- */
+
+#define ARRAY_LENGTH(a) (sizeof(a) / sizeof((a)[0]))
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#define CLAMP(x, a, b) MAX(a, MIN(x, b))
+
+static
+void angle_sub(float* angle, float amt)
+{
+    *angle -= amt;
+    while (*angle < 0) *angle += F_PI*2;
+}
+
+static
+void angle_add(float* angle, float amt)
+{
+    *angle += amt;
+    while (*angle > F_PI*2) *angle -= F_PI*2;
+}
+
+/* --------------------------------------------------------------------- */
+
+enum { DRAW_PRT, DRAW_PER_LIGHT, NDRAW_MODES };
+
+/* directional, dir points at the light in model space (y is down) */
+struct light
+{
+    vector_t dir;
+    float r, g, b;
+};
+
+typedef struct light light_t;
+
+static
+light_t lights[] = {
+    { { 0 }, 1, 0.85f, 0.7f },               /* key, moved with the d-pad */
+    { { 0, -1, 0, 0 }, 0.15f, 0.2f, 0.35f }, /* sky, straight up */
+};
+
+static float ambient = .05f;
+
+static pvr_poly_hdr_t poly;
+
+static vector_t t[ARRAY_LENGTH(monkey_vertices)];
+static uint32_t colors[ARRAY_LENGTH(monkey_prt)];
+
+static int mode = DRAW_PRT;
+static float key_azimuth = 0.6f, key_elevation = 0.5f;
+static float distance = 3;
+
+static
+void init()
+{
+    pvr_poly_cxt_t cxt;
+
+    pvr_poly_cxt_col(&cxt, PVR_LIST_OP_POLY);
+    pvr_poly_compile(&poly, &cxt);
+}
+
+#define SENS (F_PI/60.0f)
+#define MOVSPEED (4.0f/60.0f)
+
+static
+void update()
+{
+    static uint32 prev_buttons = 0;
+    maple_device_t* joy;
+    cont_state_t* st;
+
+    joy = maple_enum_type(0, MAPLE_FUNC_CONTROLLER);
+    if (!joy) return;
+
+    st = (cont_state_t*)maple_dev_status(joy);
+    if (!st) return;
+
+    if ((st->buttons & CONT_X) && !(prev_buttons & CONT_X)) {
+        mode = (mode + 1) % NDRAW_MODES;
+    }
+
+    prev_buttons = st->buttons;
+
+    if (st->buttons & CONT_DPAD_UP   ) key_elevation += SENS;
+    if (st->buttons & CONT_DPAD_DOWN ) key_elevation -= SENS;
+    if (st->buttons & CONT_DPAD_RIGHT) angle_sub(&key_azimuth, SENS);
+    if (st->buttons & CONT_DPAD_LEFT ) angle_add(&key_azimuth, SENS);
+    key_elevation = CLAMP(key_elevation, -F_PI/2, F_PI/2);
+
+    if (st->buttons & CONT_A) distance -= MOVSPEED;
+    if (st->buttons & CONT_B) distance += MOVSPEED;
+    distance = CLAMP(distance, 1.5f, 20);
+
+    lights[0].dir.x = fcos(key_elevation) * fsin(key_azimuth);
+    lights[0].dir.y = -fsin(key_elevation);
+    lights[0].dir.z = fcos(key_elevation) * fcos(key_azimuth);
+}
+
+/*
+ * the lights projected once for the whole model, then 27 multiply-adds
+ * per vertex
+ */
+static
+void shade_prt()
+{
+    obj2h_prt_light_t sh;
+    size_t i;
+
+    obj2h_prt_clear(&sh);
+    obj2h_prt_ambient(&sh, ambient, ambient, ambient);
+
+    for (i = 0; i < ARRAY_LENGTH(lights); ++i)
+    {
+        light_t const* l = &lights[i];
+        obj2h_prt_directional(&sh, &l->dir, l->r, l->g, l->b);
+    }
+
+    obj2h_prt_shade(monkey_prt, ARRAY_LENGTH(monkey_prt), &sh, colors);
+}
+
+/* the usual loop over the lights, per corner and without shadows */
+static
+uint32 light(int normal_index)
+{
+    vector_t const* n = &monkey_normals[normal_index];
+    float r = ambient, g = ambient, b = ambient;
+    float amt;
+    size_t i;
+
+    for (i = 0; i < ARRAY_LENGTH(lights); ++i)
+    {
+        light_t const* l = &lights[i];
+
+        /*
+         * monkey_normals are as the .obj had them, their y isn't flipped
+         * like the vertices', so the light is mirrored for them
+         */
+        vec3f_dot(l->dir.x, -l->dir.y, l->dir.z, n->x, n->y, n->z, amt);
+        amt = MAX(amt, 0);
+
+        r += l->r * amt;
+        g += l->g * amt;
+        b += l->b * amt;
+    }
+
+    return 0xFF000000 |
+        (uint32)(MIN(r, 1) * 255) << 16 |
+        (uint32)(MIN(g, 1) * 255) << 8 |
+        (uint32)(MIN(b, 1) * 255);
+}
+
+static
+void draw_strips()
+{
+    size_t i;
+    pvr_vertex_t pv;
+
+    pvr_prim(&poly, sizeof(poly));
+    pv.u = pv.v = 0;
+    pv.oargb = 0;
+
+    for (i = 0; i < ARRAY_LENGTH(monkey_strips); ++i)
+    {
+        corner_t const* c = &monkey_strips[i];
+        vector_t const* v;
+
+        if (c->vertex_index < 0) continue;
+
+        v = &t[c->vertex_index];
+        pv.x = v->x;
+        pv.y = v->y;
+        pv.z = v->z;
+        pv.argb = mode == DRAW_PRT ? colors[c->vertex_index] :
+            light(c->normal_index);
+        pv.flags = c[1].vertex_index < 0 ? PVR_CMD_VERTEX_EOL :
+            PVR_CMD_VERTEX;
+        pvr_prim(&pv, sizeof(pv));
+    }
+}
+
+static
+void draw()
+{
+    /* the model isn't rotated, so the lights are already in its space */
+    mat_identity();
+    mat_perspective(320, 240, 1, 1, 100);
+    mat_translate(0, 0, -distance);
+    mat_transform(monkey_vertices, t, ARRAY_LENGTH(t), sizeof(vector_t));
+
+    if (mode == DRAW_PRT) {
+        shade_prt();
+    }
+
+    pvr_wait_ready();
+    pvr_scene_begin();
+    pvr_list_begin(PVR_LIST_OP_POLY);
+    draw_strips();
+    pvr_list_finish();
+    pvr_scene_finish();
+}
+
+int main()
+{
+    pvr_init_defaults();
+    init();
+
+    while (1)
+    {
+        update();
+        draw();
+    }
+
+    return 0;
+}
@@ -0,0 +1,1455 @@
+/*
+ * converts .png and .tga images into pvr-native texture data, ready to
+ * be handed to pvr_txr_load as is
+ *
+ * ```sh
+ * gcc tex2pvr.c -o tex2pvr -lm -lpthread
+ * tex2pvr --mipmap --vq texture.png > romdisk_boot/texture.pvr
+ * ```
+ *
+ * options:
+ * - --format f: rgb565, argb1555 or argb4444. the default picks
+ *   argb4444 if any texel isn't fully opaque and rgb565 otherwise
+ * - --mipmap: append every mipmap level down to 1x1 in the order and
+ *   with the padding the pvr expects. square textures only
+ * - --vq: vector quantize 2x2 texel blocks against a 256-entry codebook
+ *   trained with k-means, about 1/8 of the size of the plain texture
+ * - --threads n: k-means worker threads (default 4). the result doesn't
+ *   depend on the number of threads
+ * - --iterations n: k-means iterations (default 16)
+ * - --linear: write rows in order instead of twiddled. not allowed with
+ *   --mipmap or --vq, the pvr can't do those non twiddled
+ *
+ * the flags to give pvr_poly_cxt_txr are printed to stderr
+ *
+ * png files can be grayscale, rgb, palette, with alpha or not, 1 to 16
+ * bits per channel, not interlaced. tga files can be uncompressed or
+ * rle, 24 or 32 bit truecolor or 8 bit grayscale. textures must be
+ * powers of two from 8 to 1024 on each side
+ *
+ * # license
+ * this is free and unencumbered software released into the
+ * public domain.
+ *
+ * refer to the attached UNLICENSE or http://unlicense.org/
+ */
+
+#define WHOAMI "tex2pvr"
+#define VERSION_MAJOR 1
+#define VERSION_MINOR 0
+#define VERSION_PATCH 0
+
+#define STRINGIFY_(x) #x
+#define STRINGIFY(x) STRINGIFY_(x)
+#define VERSION_STR \
+    WHOAMI " " \
+    STRINGIFY(VERSION_MAJOR) "." \
+    STRINGIFY(VERSION_MINOR) "." \
+    STRINGIFY(VERSION_PATCH)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <math.h>
+#include <pthread.h>
+
+#define MIN_SIZE 8
+#define MAX_SIZE 1024
+
+enum { FORMAT_AUTO, FORMAT_RGB565, FORMAT_ARGB1555, FORMAT_ARGB4444 };
+
+static int opt_format = FORMAT_AUTO;
+static int opt_mipmap = 0;
+static int opt_vq = 0;
+static int opt_linear = 0;
+static int opt_threads = 4;
+static int opt_iterations = 16;
+
+/* growable byte buffers ----------------------------------------------- */
+
+struct buf { unsigned char* data; size_t size, cap; };
+typedef struct buf buf_t;
+
+static
+int buf_reserve(buf_t* b, size_t size)
+{
+    size_t cap = b->cap ? b->cap : 4096;
+
+    if (size <= b->cap) return 0;
+    while (cap < size) cap *= 2;
+
+    b->data = realloc(b->data, cap);
+    if (!b->data) {
+        perror("realloc");
+        return 1;
+    }
+
+    b->cap = cap;
+
+    return 0;
+}
+
+static
+int buf_put(buf_t* b, void const* p, size_t size)
+{
+    if (buf_reserve(b, b->size + size)) return 1;
+
+    memcpy(b->data + b->size, p, size);
+    b->size += size;
+
+    return 0;
+}
+
+static
+int buf_u16(buf_t* b, unsigned x)
+{
+    unsigned char p[2];
+
+    p[0] = x & 0xFF;
+    p[1] = (x >> 8) & 0xFF;
+
+    return buf_put(b, p, 2);
+}
+
+static
+unsigned char* read_file(char const* path, size_t* size)
+{
+    FILE* f = fopen(path, "rb");
+    unsigned char* data;
+    long n;
+
+    if (!f) {
+        perror(path);
+        return 0;
+    }
+
+    if (fseek(f, 0, SEEK_END) || (n = ftell(f)) < 0 ||
+        fseek(f, 0, SEEK_SET))
+    {
+        perror(path);
+        fclose(f);
+        return 0;
+    }
+
+    data = malloc(n + 1);
+
+    if (!data || fread(data, 1, n, f) != (size_t)n)
+    {
+        perror(path);
+        fclose(f);
+        free(data);
+        return 0;
+    }
+
+    fclose(f);
+    *size = (size_t)n;
+
+    return data;
+}
+
+/* inflate ------------------------------------------------------------- */
+
+/*
+ * a plain canonical huffman decoder in the spirit of zlib's puff. png
+ * is the only user, so speed is secondary to size
+ */
+
+struct inflater
+{
+    unsigned char const* in;
+    size_t size, pos;
+    unsigned long bits;
+    int nbits;
+    buf_t* out;
+};
+
+typedef struct inflater inflater_t;
+
+struct huffman { short counts[16], symbols[320]; };
+typedef struct huffman huffman_t;
+
+/* -1 once the input runs out */
+static
+long inflate_bits(inflater_t* s, int n)
+{
+    long x;
+
+    while (s->nbits < n)
+    {
+        if (s->pos >= s->size) return -1;
+        s->bits |= (unsigned long)s->in[s->pos++] << s->nbits;
+        s->nbits += 8;
+    }
+
+    x = (long)(s->bits & ((1ul << n) - 1));
+    s->bits >>= n;
+    s->nbits -= n;
+
+    return x;
+}
+
+static
+int huffman_build(huffman_t* h, unsigned char const* lengths, int n)
+{
+    short offsets[16];
+    int i, left = 1;
+
+    memset(h->counts, 0, sizeof(h->counts));
+
+    for (i = 0; i < n; ++i) {
+        ++h->counts[lengths[i]];
+    }
+
+    /* over-subscribed codes are errors, incomplete ones are allowed */
+    for (i = 1; i < 16; ++i)
+    {
+        left = left * 2 - h->counts[i];
+        if (left < 0) return 1;
+    }
+
+    offsets[1] = 0;
+
+    for (i = 1; i < 15; ++i) {
+        offsets[i + 1] = offsets[i] + h->counts[i];
+    }
+
+    for (i = 0; i < n; ++i) {
+        if (lengths[i]) h->symbols[offsets[lengths[i]]++] = (short)i;
+    }
+
+    return 0;
+}
+
+static
+int huffman_decode(inflater_t* s, huffman_t const* h)
+{
+    int code = 0, first = 0, index = 0, len;
+
+    for (len = 1; len < 16; ++len)
+    {
+        long bit = inflate_bits(s, 1);
+        int count = h->counts[len];
+
+        if (bit < 0) return -1;
+
+        code |= (int)bit;
+        if (code - first < count) return h->symbols[index + code - first];
+
+        index += count;
+        first = (first + count) << 1;
+        code <<= 1;
+    }
+
+    return -1;
+}
+
+static
+int inflate_codes(inflater_t* s, huffman_t const* lit, huffman_t const* dist)
+{
+    static short const length_base[29] = {
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43,
+        51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+    };
+    static short const length_extra[29] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4,
+        4, 4, 5, 5, 5, 5, 0
+    };
+    static short const dist_base[30] = {
+        1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257,
+        385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289,
+        16385, 24577
+    };
+    static short const dist_extra[30] = {
+        0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9,
+        10, 10, 11, 11, 12, 12, 13, 13
+    };
+
+    for (;;)
+    {
+        int symbol = huffman_decode(s, lit);
+        long len, d, extra;
+
+        if (symbol < 0) return 1;
+        if (symbol == 256) return 0;
+
+        if (symbol < 256)
+        {
+            unsigned char c = (unsigned char)symbol;
+            if (buf_put(s->out, &c, 1)) return 1;
+            continue;
+        }
+
+        symbol -= 257;
+        if (symbol >= 29) return 1;
+
+        extra = inflate_bits(s, length_extra[symbol]);
+        if (extra < 0) return 1;
+        len = length_base[symbol] + extra;
+
+        symbol = huffman_decode(s, dist);
+        if (symbol < 0 || symbol >= 30) return 1;
+
+        extra = inflate_bits(s, dist_extra[symbol]);
+        if (extra < 0) return 1;
+        d = dist_base[symbol] + extra;
+
+        if ((size_t)d > s->out->size) return 1;
+        if (buf_reserve(s->out, s->out->size + len)) return 1;
+
+        /* byte by byte, the match may overlap what it produces */
+        for (; len > 0; --len)
+        {
+            s->out->data[s->out->size] = s->out->data[s->out->size - d];
+            ++s->out->size;
+        }
+    }
+}
+
+static
+int inflate_dynamic(inflater_t* s)
+{
+    static unsigned char const order[19] = {
+        16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15
+    };
+
+    unsigned char lengths[320];
+    huffman_t lit, dist, code;
+    long nlit, ndist, ncode;
+    int i;
+
+    nlit = inflate_bits(s, 5);
+    ndist = inflate_bits(s, 5);
+    ncode = inflate_bits(s, 4);
+    if (nlit < 0 || ndist < 0 || ncode < 0) return 1;
+
+    nlit += 257;
+    ndist += 1;
+    ncode += 4;
+    if (nlit > 286 || ndist > 30) return 1;
+
+    memset(lengths, 0, sizeof(lengths));
+
+    for (i = 0; i < ncode; ++i)
+    {
+        long x = inflate_bits(s, 3);
+        if (x < 0) return 1;
+        lengths[order[i]] = (unsigned char)x;
+    }
+
+    if (huffman_build(&code, lengths, 19)) return 1;
+
+    for (i = 0; i < nlit + ndist;)
+    {
+        int symbol = huffman_decode(s, &code);
+        long repeat;
+        unsigned char len = 0;
+
+        if (symbol < 0) return 1;
+
+        if (symbol < 16)
+        {
+            lengths[i++] = (unsigned char)symbol;
+            continue;
+        }
+
+        if (symbol == 16)
+        {
+            if (!i) return 1;
+            len = lengths[i - 1];
+            repeat = inflate_bits(s, 2);
+            repeat = repeat < 0 ? -1 : repeat + 3;
+        }
+
+        else if (symbol == 17)
+        {
+            repeat = inflate_bits(s, 3);
+            repeat = repeat < 0 ? -1 : repeat + 3;
+        }
+
+        else
+        {
+            repeat = inflate_bits(s, 7);
+            repeat = repeat < 0 ? -1 : repeat + 11;
+        }
+
+        if (repeat < 0 || i + repeat > nlit + ndist) return 1;
+        while (repeat--) lengths[i++] = len;
+    }
+
+    if (!lengths[256]) return 1;
+
+    if (huffman_build(&lit, lengths, (int)nlit) ||
+        huffman_build(&dist, lengths + nlit, (int)ndist))
+    {
+        return 1;
+    }
+
+    return inflate_codes(s, &lit, &dist);
+}
+
+static
+int inflate_fixed(inflater_t* s)
+{
+    static huffman_t lit, dist;
+    static int built = 0;
+
+    if (!built)
+    {
+        unsigned char lengths[288];
+        int i;
+
+        for (i = 0; i < 144; ++i) lengths[i] = 8;
+        for (; i < 256; ++i) lengths[i] = 9;
+        for (; i < 280; ++i) lengths[i] = 7;
+        for (; i < 288; ++i) lengths[i] = 8;
+        huffman_build(&lit, lengths, 288);
+
+        for (i = 0; i < 30; ++i) lengths[i] = 5;
+        huffman_build(&dist, lengths, 30);
+
+        built = 1;
+    }
+
+    return inflate_codes(s, &lit, &dist);
+}
+
+/* decodes a zlib stream (header, deflate blocks, adler32 unchecked) */
+static
+int zlib_inflate(unsigned char const* in, size_t size, buf_t* out)
+{
+    inflater_t s;
+    long last;
+
+    if (size < 2 || (in[0] & 0x0F) != 8 || (in[0] << 8 | in[1]) % 31 ||
+        (in[1] & 0x20))
+    {
+        return 1;
+    }
+
+    memset(&s, 0, sizeof(s));
+    s.in = in;
+    s.size = size;
+    s.pos = 2;
+    s.out = out;
+
+    do
+    {
+        long type;
+        int err;
+
+        last = inflate_bits(&s, 1);
+        type = inflate_bits(&s, 2);
+        if (last < 0 || type < 0) return 1;
+
+        if (!type)
+        {
+            size_t len;
+
+            /* stored blocks start on a byte boundary */
+            s.bits = 0;
+            s.nbits = 0;
+
+            if (s.pos + 4 > s.size) return 1;
+            len = s.in[s.pos] | s.in[s.pos + 1] << 8;
+            if ((len ^ (s.in[s.pos + 2] | s.in[s.pos + 3] << 8)) != 0xFFFF) {
+                return 1;
+            }
+
+            s.pos += 4;
+            if (s.pos + len > s.size) return 1;
+            if (buf_put(out, s.in + s.pos, len)) return 1;
+            s.pos += len;
+            continue;
+        }
+
+        if (type == 1) {
+            err = inflate_fixed(&s);
+        } else if (type == 2) {
+            err = inflate_dynamic(&s);
+        } else {
+            return 1;
+        }
+
+        if (err) return 1;
+    }
+    while (!last);
+
+    return 0;
+}
+
+/* image loading ------------------------------------------------------- */
+
+/* images are loaded as 8-bit rgba, rows top to bottom */
+struct image { size_t width, height; unsigned char* rgba; };
+typedef struct image image_t;
+
+static
+unsigned long be32(unsigned char const* p)
+{
+    return (unsigned long)p[0] << 24 | (unsigned long)p[1] << 16 |
+        (unsigned long)p[2] << 8 | p[3];
+}
+
+static
+int paeth(int a, int b, int c)
+{
+    int p = a + b - c;
+    int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+
+    if (pa <= pb && pa <= pc) return a;
+    return pb <= pc ? b : c;
+}
+
+/* reverses the per-row filters in place */
+static
+int png_unfilter(unsigned char* data, size_t height, size_t stride,
+    size_t bpp)
+{
+    size_t x, y;
+
+    for (y = 0; y < height; ++y)
+    {
+        unsigned char* row = data + y * (stride + 1);
+        unsigned char* prior = y ? row - stride - 1 : 0;
+        int filter = row[0];
+
+        row[0] = 0;
+        ++row;
+        if (prior) ++prior;
+
+        for (x = 0; x < stride; ++x)
+        {
+            int a = x >= bpp ? row[x - bpp] : 0;
+            int b = prior ? prior[x] : 0;
+            int c = prior && x >= bpp ? prior[x - bpp] : 0;
+
+            switch (filter)
+            {
+            case 0: break;
+            case 1: row[x] += a; break;
+            case 2: row[x] += b; break;
+            case 3: row[x] += (a + b) / 2; break;
+            case 4: row[x] += paeth(a, b, c); break;
+            default: return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/* sample n of a row of depth-bit samples, scaled to 8 bits */
+static
+unsigned png_sample(unsigned char const* row, size_t n, int depth,
+    int scale)
+{
+    unsigned x;
+
+    switch (depth)
+    {
+    case 16: return row[n * 2];
+    case 8: return row[n];
+    default:
+        x = row[n * depth / 8] >> (8 - depth - n * depth % 8);
+        x &= (1u << depth) - 1;
+        return scale ? x * 255 / ((1u << depth) - 1) : x;
+    }
+}
+
+static
+int load_png(char const* path, unsigned char const* data, size_t size,
+    image_t* img)
+{
+    static unsigned char const signature[8] = {
+        0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'
+    };
+
+    unsigned char palette[256][4];
+    size_t npalette = 0, pos = 8, x, y, stride, channels = 0, bpp;
+    int depth = 0, color = -1, interlace = 0;
+    buf_t idat = { 0, 0, 0 };
+    buf_t raw = { 0, 0, 0 };
+
+    if (size < 8 || memcmp(data, signature, 8)) return 1;
+
+    memset(palette, 0xFF, sizeof(palette));
+
+    while (pos + 12 <= size)
+    {
+        unsigned long len = be32(data + pos);
+        unsigned char const* type = data + pos + 4;
+        unsigned char const* chunk = data + pos + 8;
+
+        if (len > size - pos - 12)
+        {
+            fprintf(stderr, "%s: truncated chunk\n", path);
+            return 1;
+        }
+
+        if (!memcmp(type, "IHDR", 4) && len >= 13)
+        {
+            img->width = be32(chunk);
+            img->height = be32(chunk + 4);
+            depth = chunk[8];
+            color = chunk[9];
+            interlace = chunk[12];
+        }
+
+        else if (!memcmp(type, "PLTE", 4))
+        {
+            for (npalette = 0; npalette < len / 3 && npalette < 256;
+                ++npalette)
+            {
+                palette[npalette][0] = chunk[npalette * 3];
+                palette[npalette][1] = chunk[npalette * 3 + 1];
+                palette[npalette][2] = chunk[npalette * 3 + 2];
+            }
+        }
+
+        else if (!memcmp(type, "tRNS", 4) && color == 3)
+        {
+            for (x = 0; x < len && x < 256; ++x) {
+                palette[x][3] = chunk[x];
+            }
+        }
+
+        else if (!memcmp(type, "IDAT", 4))
+        {
+            if (buf_put(&idat, chunk, len)) return 1;
+        }
+
+        else if (!memcmp(type, "IEND", 4)) {
+            break;
+        }
+
+        pos += len + 12;
+    }
+
+    switch (color)
+    {
+    case 0: channels = 1; break; /* gray */
+    case 2: channels = 3; break; /* rgb */
+    case 3: channels = 1; break; /* palette */
+    case 4: channels = 2; break; /* gray, alpha */
+    case 6: channels = 4; break; /* rgba */
+    }
+
+    if (!channels || !img->width || !img->height || interlace ||
+        (depth != 1 && depth != 2 && depth != 4 && depth != 8 &&
+        depth != 16) || (color == 3 && depth > 8) ||
+        (color != 0 && color != 3 && depth < 8) ||
+        img->width > MAX_SIZE * 4 || img->height > MAX_SIZE * 4)
+    {
+        fprintf(stderr, "%s: unsupported png (color type %d, %d bits%s)\n",
+            path, color, depth, interlace ? ", interlaced" : "");
+        return 1;
+    }
+
+    stride = (img->width * channels * depth + 7) / 8;
+    bpp = (channels * depth + 7) / 8;
+
+    if (zlib_inflate(idat.data, idat.size, &raw) ||
+        raw.size < (stride + 1) * img->height ||
+        png_unfilter(raw.data, img->height, stride, bpp))
+    {
+        fprintf(stderr, "%s: corrupt image data\n", path);
+        return 1;
+    }
+
+    img->rgba = malloc(img->width * img->height * 4);
+    if (!img->rgba) {
+        perror("malloc");
+        return 1;
+    }
+
+    for (y = 0; y < img->height; ++y)
+    {
+        unsigned char const* row = raw.data + y * (stride + 1) + 1;
+
+        for (x = 0; x < img->width; ++x)
+        {
+            unsigned char* p = img->rgba + (y * img->width + x) * 4;
+            unsigned s0 = png_sample(row, x * channels, depth, color != 3);
+
+            switch (color)
+            {
+            case 0:
+                p[0] = p[1] = p[2] = (unsigned char)s0;
+                p[3] = 255;
+                break;
+
+            case 3:
+                memcpy(p, palette[s0], 4);
+                break;
+
+            case 4:
+                p[0] = p[1] = p[2] = (unsigned char)s0;
+                p[3] = (unsigned char)png_sample(row, x * 2 + 1, depth, 1);
+                break;
+
+            default:
+                p[0] = (unsigned char)s0;
+                p[1] = (unsigned char)png_sample(row, x * channels + 1,
+                    depth, 1);
+                p[2] = (unsigned char)png_sample(row, x * channels + 2,
+                    depth, 1);
+                p[3] = channels == 4 ? (unsigned char)png_sample(row,
+                    x * 4 + 3, depth, 1) : 255;
+                break;
+            }
+        }
+    }
+
+    free(idat.data);
+    free(raw.data);
+
+    return 0;
+}
+
+static
+int load_tga(char const* path, unsigned char const* data, size_t size,
+    image_t* img)
+{
+    unsigned char const* p;
+    unsigned char const* end = data + size;
+    size_t n, i, texel_size;
+    int type, depth, top_down;
+
+    if (size < 18) return 1;
+
+    type = data[2];
+    depth = data[16];
+    top_down = data[17] & 0x20;
+    img->width = data[12] | data[13] << 8;
+    img->height = data[14] | data[15] << 8;
+    p = data + 18 + data[0];
+    texel_size = (size_t)depth / 8;
+
+    if ((type != 2 && type != 3 && type != 10 && type != 11) ||
+        data[1] || ((type & 3) == 2 && depth != 24 && depth != 32) ||
+        ((type & 3) == 3 && depth != 8) || !img->width || !img->height)
+    {
+        fprintf(stderr, "%s: unsupported tga (type %d, %d bits)\n", path,
+            type, depth);
+        return 1;
+    }
+
+    n = img->width * img->height;
+    img->rgba = malloc(n * 4);
+    if (!img->rgba) {
+        perror("malloc");
+        return 1;
+    }
+
+    /* rle packets are a count byte then one texel or count raw ones */
+    for (i = 0; i < n;)
+    {
+        size_t count = 1, j;
+        int repeat = 0;
+
+        if (type >= 10)
+        {
+            if (p >= end) break;
+            count = (*p & 0x7F) + 1u;
+            repeat = *p++ & 0x80;
+        }
+
+        for (j = 0; j < count && i < n; ++j, ++i)
+        {
+            size_t row = top_down ? i / img->width :
+                img->height - 1 - i / img->width;
+            unsigned char* q = img->rgba +
+                (row * img->width + i % img->width) * 4;
+
+            if (p + texel_size > end) break;
+
+            if (texel_size == 1)
+            {
+                q[0] = q[1] = q[2] = p[0];
+                q[3] = 255;
+            }
+
+            else
+            {
+                q[0] = p[2];
+                q[1] = p[1];
+                q[2] = p[0];
+                q[3] = texel_size == 4 ? p[3] : 255;
+            }
+
+            if (!repeat) p += texel_size;
+        }
+
+        if (repeat) p += texel_size;
+        if (j < count && i < n) break;
+    }
+
+    if (i < n)
+    {
+        fprintf(stderr, "%s: truncated image data\n", path);
+        return 1;
+    }
+
+    return 0;
+}
+
+static
+int load_image(char const* path, image_t* img)
+{
+    unsigned char* data;
+    size_t size;
+    char const* ext = strrchr(path, '.');
+    int err;
+
+    data = read_file(path, &size);
+    if (!data) return 1;
+
+    memset(img, 0, sizeof(*img));
+
+    if (ext && !strcasecmp(ext, ".tga")) {
+        err = load_tga(path, data, size, img);
+    } else {
+        err = load_png(path, data, size, img);
+        if (err && !img->rgba && !img->width) {
+            fprintf(stderr, "%s: not a png or tga file\n", path);
+        }
+    }
+
+    free(data);
+
+    return err;
+}
+
+/* box filters a level down to half its size */
+static
+int downsample(image_t const* src, image_t* dst)
+{
+    size_t x, y;
+    int c;
+
+    dst->width = src->width > 1 ? src->width / 2 : 1;
+    dst->height = src->height > 1 ? src->height / 2 : 1;
+    dst->rgba = malloc(dst->width * dst->height * 4);
+
+    if (!dst->rgba) {
+        perror("malloc");
+        return 1;
+    }
+
+    for (y = 0; y < dst->height; ++y)
+    {
+        for (x = 0; x < dst->width; ++x)
+        {
+            size_t x0 = x * 2 % src->width, x1 = (x * 2 + 1) % src->width;
+            size_t y0 = y * 2 % src->height, y1 = (y * 2 + 1) % src->height;
+
+            for (c = 0; c < 4; ++c)
+            {
+                unsigned sum = src->rgba[(y0 * src->width + x0) * 4 + c] +
+                    src->rgba[(y0 * src->width + x1) * 4 + c] +
+                    src->rgba[(y1 * src->width + x0) * 4 + c] +
+                    src->rgba[(y1 * src->width + x1) * 4 + c];
+
+                dst->rgba[(y * dst->width + x) * 4 + c] =
+                    (unsigned char)((sum + 2) / 4);
+            }
+        }
+    }
+
+    return 0;
+}
+
+/* pixel formats and twiddling ----------------------------------------- */
+
+static
+unsigned pack_texel(unsigned char const* p)
+{
+    switch (opt_format)
+    {
+    case FORMAT_ARGB1555:
+        return (p[3] >= 128 ? 0x8000u : 0) | (p[0] >> 3) << 10 |
+            (p[1] >> 3) << 5 | p[2] >> 3;
+
+    case FORMAT_ARGB4444:
+        return (unsigned)(p[3] >> 4) << 12 | (p[0] >> 4) << 8 |
+            (p[1] >> 4) << 4 | p[2] >> 4;
+
+    default:
+        return (unsigned)(p[0] >> 3) << 11 | (p[1] >> 2) << 5 | p[2] >> 3;
+    }
+}
+
+/*
+ * texel (x, y) of a twiddled w by h texture: x and y bits interleaved,
+ * y in the low bit. rectangles are a row or column of squares
+ */
+static
+size_t twiddle(size_t x, size_t y, size_t w, size_t h)
+{
+    size_t side = w < h ? w : h;
+    size_t block = (x / side + y / side) * side * side;
+    size_t t = 0;
+    int bit;
+
+    x %= side;
+    y %= side;
+
+    for (bit = 0; (size_t)1 << bit < side; ++bit)
+    {
+        t |= ((y >> bit) & 1) << (bit * 2);
+        t |= ((x >> bit) & 1) << (bit * 2 + 1);
+    }
+
+    return block + t;
+}
+
+static
+int write_texels(buf_t* out, image_t const* img)
+{
+    size_t n = img->width * img->height, i;
+    unsigned short* t = malloc(sizeof(unsigned short) * n);
+
+    if (!t) {
+        perror("malloc");
+        return 1;
+    }
+
+    for (i = 0; i < n; ++i)
+    {
+        size_t x = i % img->width, y = i / img->width;
+        size_t j = opt_linear ? i : twiddle(x, y, img->width, img->height);
+
+        t[j] = (unsigned short)pack_texel(img->rgba + i * 4);
+    }
+
+    for (i = 0; i < n; ++i) {
+        if (buf_u16(out, t[i])) return 1;
+    }
+
+    free(t);
+
+    return 0;
+}
+
+/* vector quantization ------------------------------------------------- */
+
+/*
+ * every 2x2 block of every level is a 16 dimensional vector (4 texels,
+ * rgba, in twiddled order like the codebook stores them). k-means runs
+ * in fixed chunks of vectors whose partial sums are added up in chunk
+ * order, so threads only change how fast it goes
+ */
+
+#define VQ_CODES 256
+#define VQ_DIMS 16
+#define VQ_CHUNK 4096
+
+struct vq_partial { double sums[VQ_CODES][VQ_DIMS]; size_t counts[VQ_CODES]; };
+typedef struct vq_partial vq_partial_t;
+
+static float* vq_vectors = 0;
+static size_t nvq_vectors = 0;
+static float vq_codebook[VQ_CODES][VQ_DIMS];
+static unsigned char* vq_indices = 0;
+static float* vq_errors = 0;
+static vq_partial_t* vq_partials = 0;
+static size_t vq_next_chunk = 0;
+static pthread_mutex_t vq_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* channels the format doesn't have don't count towards the error */
+static float vq_weights[VQ_DIMS];
+
+static
+float vq_distance(float const* a, float const* b)
+{
+    float d = 0;
+    int i;
+
+    for (i = 0; i < VQ_DIMS; ++i)
+    {
+        float x = a[i] - b[i];
+        d += x * x * vq_weights[i];
+    }
+
+    return d;
+}
+
+static
+void vq_assign_chunk(size_t chunk)
+{
+    vq_partial_t* p = &vq_partials[chunk];
+    size_t first = chunk * VQ_CHUNK, i;
+    size_t last = first + VQ_CHUNK < nvq_vectors ? first + VQ_CHUNK :
+        nvq_vectors;
+    int c, j;
+
+    memset(p, 0, sizeof(*p));
+
+    for (i = first; i < last; ++i)
+    {
+        float const* v = vq_vectors + i * VQ_DIMS;
+        float best = vq_distance(v, vq_codebook[0]);
+        int code = 0;
+
+        for (c = 1; c < VQ_CODES; ++c)
+        {
+            float d = vq_distance(v, vq_codebook[c]);
+
+            if (d < best)
+            {
+                best = d;
+                code = c;
+            }
+        }
+
+        vq_indices[i] = (unsigned char)code;
+        vq_errors[i] = best;
+        ++p->counts[code];
+
+        for (j = 0; j < VQ_DIMS; ++j) {
+            p->sums[code][j] += v[j];
+        }
+    }
+}
+
+static
+void* vq_worker(void* arg)
+{
+    (void)arg;
+
+    for (;;)
+    {
+        size_t chunk;
+
+        pthread_mutex_lock(&vq_lock);
+        chunk = vq_next_chunk++;
+        pthread_mutex_unlock(&vq_lock);
+
+        if (chunk * VQ_CHUNK >= nvq_vectors) break;
+        vq_assign_chunk(chunk);
+    }
+
+    return 0;
+}
+
+/* assigns every vector to its closest code on opt_threads threads */
+static
+int vq_assign()
+{
+    pthread_t threads[64];
+    int i, nthreads = opt_threads;
+
+    vq_next_chunk = 0;
+
+    for (i = 1; i < nthreads; ++i)
+    {
+        if (pthread_create(&threads[i], 0, vq_worker, 0))
+        {
+            fprintf(stderr, "pthread_create failed, going on with %d "
+                "threads\n", i);
+            nthreads = i;
+            break;
+        }
+    }
+
+    vq_worker(0);
+
+    for (i = 1; i < nthreads; ++i) {
+        pthread_join(threads[i], 0);
+    }
+
+    return 0;
+}
+
+/*
+ * moves every code to the mean of its vectors. codes nobody uses take
+ * over the vectors that are currently worst off, one each
+ */
+static
+void vq_update()
+{
+    size_t nchunks = (nvq_vectors + VQ_CHUNK - 1) / VQ_CHUNK;
+    double sums[VQ_CODES][VQ_DIMS];
+    size_t counts[VQ_CODES];
+    size_t i;
+    int c, j;
+
+    memset(sums, 0, sizeof(sums));
+    memset(counts, 0, sizeof(counts));
+
+    for (i = 0; i < nchunks; ++i)
+    {
+        for (c = 0; c < VQ_CODES; ++c)
+        {
+            counts[c] += vq_partials[i].counts[c];
+
+            for (j = 0; j < VQ_DIMS; ++j) {
+                sums[c][j] += vq_partials[i].sums[c][j];
+            }
+        }
+    }
+
+    for (c = 0; c < VQ_CODES; ++c)
+    {
+        if (counts[c])
+        {
+            for (j = 0; j < VQ_DIMS; ++j) {
+                vq_codebook[c][j] = (float)(sums[c][j] / counts[c]);
+            }
+
+            continue;
+        }
+
+        /* the worst vector, ties to the lowest index */
+        {
+            size_t worst = 0;
+
+            for (i = 1; i < nvq_vectors; ++i) {
+                if (vq_errors[i] > vq_errors[worst]) worst = i;
+            }
+
+            memcpy(vq_codebook[c], vq_vectors + worst * VQ_DIMS,
+                sizeof(vq_codebook[c]));
+            vq_errors[worst] = 0;
+        }
+    }
+}
+
+/* what the code will look like once packed, so indices match the data */
+static
+void vq_snap_codebook()
+{
+    int c, t, j;
+
+    for (c = 0; c < VQ_CODES; ++c)
+    {
+        for (t = 0; t < 4; ++t)
+        {
+            unsigned char p[4];
+            unsigned x;
+
+            for (j = 0; j < 4; ++j)
+            {
+                float f = vq_codebook[c][t * 4 + j];
+                p[j] = (unsigned char)(f < 0 ? 0 : f > 255 ? 255 : f + 0.5f);
+            }
+
+            x = pack_texel(p);
+
+            switch (opt_format)
+            {
+            case FORMAT_ARGB1555:
+                p[3] = x & 0x8000 ? 255 : 0;
+                p[0] = (x >> 10 & 31) * 255 / 31;
+                p[1] = (x >> 5 & 31) * 255 / 31;
+                p[2] = (x & 31) * 255 / 31;
+                break;
+
+            case FORMAT_ARGB4444:
+                p[3] = (x >> 12) * 17;
+                p[0] = (x >> 8 & 15) * 17;
+                p[1] = (x >> 4 & 15) * 17;
+                p[2] = (x & 15) * 17;
+                break;
+
+            default:
+                p[0] = (x >> 11) * 255 / 31;
+                p[1] = (x >> 5 & 63) * 255 / 63;
+                p[2] = (x & 31) * 255 / 31;
+                break;
+            }
+
+            for (j = 0; j < 4; ++j) {
+                vq_codebook[c][t * 4 + j] = p[j];
+            }
+        }
+    }
+}
+
+/* appends the 2x2 blocks of img to the vectors, in twiddled order */
+static
+int vq_add_level(image_t const* img)
+{
+    size_t bw = img->width > 1 ? img->width / 2 : 1;
+    size_t bh = img->height > 1 ? img->height / 2 : 1;
+    size_t n = bw * bh, i;
+    float* v;
+
+    v = realloc(vq_vectors, sizeof(float) * VQ_DIMS * (nvq_vectors + n));
+    if (!v) {
+        perror("realloc");
+        return 1;
+    }
+
+    vq_vectors = v;
+
+    for (i = 0; i < n; ++i)
+    {
+        size_t bx = i % bw, by = i / bw;
+        float* dst = vq_vectors + (nvq_vectors +
+            twiddle(bx, by, bw, bh)) * VQ_DIMS;
+        int t, j;
+
+        /* codebook texels go top left, bottom left, top right, ... */
+        for (t = 0; t < 4; ++t)
+        {
+            size_t x = (bx * 2 + (t >> 1)) % img->width;
+            size_t y = (by * 2 + (t & 1)) % img->height;
+
+            for (j = 0; j < 4; ++j) {
+                dst[t * 4 + j] = img->rgba[(y * img->width + x) * 4 + j];
+            }
+        }
+    }
+
+    nvq_vectors += n;
+
+    return 0;
+}
+
+/* trains the codebook and finds every block's code */
+static
+int vq_train()
+{
+    size_t nchunks = (nvq_vectors + VQ_CHUNK - 1) / VQ_CHUNK;
+    size_t i;
+    int it, c, j;
+
+    vq_indices = malloc(nvq_vectors + 1);
+    vq_errors = malloc(sizeof(float) * (nvq_vectors + 1));
+    vq_partials = malloc(sizeof(vq_partial_t) * (nchunks + 1));
+
+    if (!vq_indices || !vq_errors || !vq_partials) {
+        perror("malloc");
+        return 1;
+    }
+
+    for (j = 0; j < VQ_DIMS; ++j) {
+        vq_weights[j] = j % 4 == 3 && opt_format == FORMAT_RGB565 ? 0 : 1;
+    }
+
+    /* evenly spaced vectors to start with */
+    for (c = 0; c < VQ_CODES; ++c)
+    {
+        i = (size_t)c * nvq_vectors / VQ_CODES;
+        memcpy(vq_codebook[c], vq_vectors + i * VQ_DIMS,
+            sizeof(vq_codebook[c]));
+    }
+
+    for (it = 0; it < opt_iterations; ++it)
+    {
+        if (vq_assign()) return 1;
+        vq_update();
+    }
+
+    vq_snap_codebook();
+
+    return vq_assign();
+}
+
+static
+int write_codebook(buf_t* out)
+{
+    int c, t;
+
+    for (c = 0; c < VQ_CODES; ++c)
+    {
+        for (t = 0; t < 4; ++t)
+        {
+            unsigned char p[4];
+            int j;
+
+            for (j = 0; j < 4; ++j) {
+                p[j] = (unsigned char)vq_codebook[c][t * 4 + j];
+            }
+
+            if (buf_u16(out, pack_texel(p))) return 1;
+        }
+    }
+
+    return 0;
+}
+
+/* --------------------------------------------------------------------- */
+
+static
+void usage(char const* argv0)
+{
+    fprintf(stderr, VERSION_STR "\n");
+    fprintf(stderr, "converts a .png or .tga image into pvr texture "
+        "data\n\n");
+    fprintf(stderr, "usage: %s [options] texture.png > texture.pvr\n\n",
+        argv0);
+    fprintf(stderr, "options:\n");
+    fprintf(stderr, "  --format f\n            rgb565, argb1555 or "
+        "argb4444 (default: argb4444\n            if anything is "
+        "translucent, rgb565 otherwise)\n");
+    fprintf(stderr, "  --mipmap  append mipmap levels, square textures "
+        "only\n");
+    fprintf(stderr, "  --vq      vector quantize to a 256 entry "
+        "codebook\n");
+    fprintf(stderr, "  --threads n\n            k-means threads (default "
+        "4)\n");
+    fprintf(stderr, "  --iterations n\n            k-means iterations "
+        "(default 16)\n");
+    fprintf(stderr, "  --linear  don't twiddle, not with --mipmap or "
+        "--vq\n");
+}
+
+static
+char const* format_name()
+{
+    switch (opt_format)
+    {
+    case FORMAT_ARGB1555: return "ARGB1555";
+    case FORMAT_ARGB4444: return "ARGB4444";
+    default: return "RGB565";
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    image_t levels[12];
+    size_t nlevels = 1, i;
+    char* path = 0;
+    buf_t out = { 0, 0, 0 };
+    int a;
+
+    for (a = 1; a < argc; ++a)
+    {
+        if (!strcmp(argv[a], "--format") && a + 1 < argc) {
+            char const* f = argv[++a];
+
+            if (!strcasecmp(f, "rgb565")) {
+                opt_format = FORMAT_RGB565;
+            } else if (!strcasecmp(f, "argb1555")) {
+                opt_format = FORMAT_ARGB1555;
+            } else if (!strcasecmp(f, "argb4444")) {
+                opt_format = FORMAT_ARGB4444;
+            } else {
+                usage(argv[0]);
+                return 1;
+            }
+        } else if (!strcmp(argv[a], "--mipmap")) {
+            opt_mipmap = 1;
+        } else if (!strcmp(argv[a], "--vq")) {
+            opt_vq = 1;
+        } else if (!strcmp(argv[a], "--linear")) {
+            opt_linear = 1;
+        } else if (!strcmp(argv[a], "--threads") && a + 1 < argc) {
+            opt_threads = atoi(argv[++a]);
+            opt_threads = opt_threads < 1 ? 1 : opt_threads > 64 ? 64 :
+                opt_threads;
+        } else if (!strcmp(argv[a], "--iterations") && a + 1 < argc) {
+            opt_iterations = atoi(argv[++a]);
+            opt_iterations = opt_iterations < 0 ? 0 : opt_iterations;
+        } else if (argv[a][0] == '-' || path) {
+            usage(argv[0]);
+            return 1;
+        } else {
+            path = argv[a];
+        }
+    }
+
+    if (!path || (opt_linear && (opt_mipmap || opt_vq))) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (load_image(path, &levels[0])) {
+        return 1;
+    }
+
+    if (levels[0].width < MIN_SIZE || levels[0].width > MAX_SIZE ||
+        levels[0].height < MIN_SIZE || levels[0].height > MAX_SIZE ||
+        (levels[0].width & (levels[0].width - 1)) ||
+        (levels[0].height & (levels[0].height - 1)))
+    {
+        fprintf(stderr, "%s: %zdx%zd, textures need power of two sides "
+            "from %d to %d\n", path, levels[0].width, levels[0].height,
+            MIN_SIZE, MAX_SIZE);
+        return 1;
+    }
+
+    if (opt_mipmap && levels[0].width != levels[0].height)
+    {
+        fprintf(stderr, "%s: mipmapped textures have to be square\n",
+            path);
+        return 1;
+    }
+
+    if (opt_format == FORMAT_AUTO)
+    {
+        opt_format = FORMAT_RGB565;
+
+        for (i = 0; i < levels[0].width * levels[0].height; ++i) {
+            if (levels[0].rgba[i * 4 + 3] != 255) opt_format = FORMAT_ARGB4444;
+        }
+    }
+
+    /* 1x1 last, they're written smallest first */
+    while (opt_mipmap && levels[nlevels - 1].width > 1)
+    {
+        if (downsample(&levels[nlevels - 1], &levels[nlevels])) return 1;
+        ++nlevels;
+    }
+
+    if (opt_vq)
+    {
+        size_t first = 0;
+
+        for (i = nlevels; i-- > 0;) {
+            if (vq_add_level(&levels[i])) return 1;
+        }
+
+        if (vq_train() || write_codebook(&out)) return 1;
+
+        /* a 1x1 level still takes up one index */
+        for (i = nlevels; i-- > 0;)
+        {
+            size_t bw = levels[i].width > 1 ? levels[i].width / 2 : 1;
+            size_t bh = levels[i].height > 1 ? levels[i].height / 2 : 1;
+
+            if (buf_put(&out, vq_indices + first, bw * bh)) return 1;
+            first += bw * bh;
+        }
+    }
+
+    else
+    {
+        /* 16 bit mipmaps start after 3 texels of padding */
+        if (opt_mipmap && buf_put(&out, "\0\0\0\0\0\0", 6)) return 1;
+
+        for (i = nlevels; i-- > 0;) {
+            if (write_texels(&out, &levels[i])) return 1;
+        }
+    }
+
+    if (fwrite(out.data, 1, out.size, stdout) != out.size)
+    {
+        perror("fwrite");
+        return 1;
+    }
+
+    fprintf(stderr, "%zdx%zd %s%s%s, %zd bytes\n", levels[0].width,
+        levels[0].height, format_name(), opt_vq ? " vq" : "",
+        opt_mipmap ? " mipmapped" : "", out.size);
+    fprintf(stderr, "pvr_poly_cxt_txr(&cxt, list, PVR_TXRFMT_%s | "
+        "PVR_TXRFMT_%s%s, %zd, %zd, tex, filter);\n", format_name(),
+        opt_linear ? "NONTWIDDLED" : "TWIDDLED",
+        opt_vq ? " | PVR_TXRFMT_VQ_ENABLE" : "", levels[0].width,
+        levels[0].height);
+
+    if (opt_mipmap) {
+        fprintf(stderr, "cxt.txr.mipmap = PVR_MIPMAP_ENABLE;\n");
+    }
+
+    for (i = 0; i < nlevels; ++i) {
+        free(levels[i].rgba);
+    }
+
+    free(out.data);
+
+    return 0;
+}